@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/component/animation.cpp" "CMakeFiles/component.dir/src/ftxui/component/animation.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/animation.cpp.o.d"
+  "/root/repo/src/ftxui/component/background_renderer.cpp" "CMakeFiles/component.dir/src/ftxui/component/background_renderer.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/background_renderer.cpp.o.d"
+  "/root/repo/src/ftxui/component/button.cpp" "CMakeFiles/component.dir/src/ftxui/component/button.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/button.cpp.o.d"
+  "/root/repo/src/ftxui/component/catch_event.cpp" "CMakeFiles/component.dir/src/ftxui/component/catch_event.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/catch_event.cpp.o.d"
+  "/root/repo/src/ftxui/component/checkbox.cpp" "CMakeFiles/component.dir/src/ftxui/component/checkbox.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/checkbox.cpp.o.d"
+  "/root/repo/src/ftxui/component/checklist.cpp" "CMakeFiles/component.dir/src/ftxui/component/checklist.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/checklist.cpp.o.d"
+  "/root/repo/src/ftxui/component/collapsible.cpp" "CMakeFiles/component.dir/src/ftxui/component/collapsible.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/collapsible.cpp.o.d"
+  "/root/repo/src/ftxui/component/component.cpp" "CMakeFiles/component.dir/src/ftxui/component/component.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/component.cpp.o.d"
+  "/root/repo/src/ftxui/component/component_options.cpp" "CMakeFiles/component.dir/src/ftxui/component/component_options.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/component_options.cpp.o.d"
+  "/root/repo/src/ftxui/component/component_profiler.cpp" "CMakeFiles/component.dir/src/ftxui/component/component_profiler.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/component_profiler.cpp.o.d"
+  "/root/repo/src/ftxui/component/container.cpp" "CMakeFiles/component.dir/src/ftxui/component/container.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/container.cpp.o.d"
+  "/root/repo/src/ftxui/component/dropdown.cpp" "CMakeFiles/component.dir/src/ftxui/component/dropdown.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/dropdown.cpp.o.d"
+  "/root/repo/src/ftxui/component/entry.cpp" "CMakeFiles/component.dir/src/ftxui/component/entry.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/entry.cpp.o.d"
+  "/root/repo/src/ftxui/component/event.cpp" "CMakeFiles/component.dir/src/ftxui/component/event.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/event.cpp.o.d"
+  "/root/repo/src/ftxui/component/file_viewer.cpp" "CMakeFiles/component.dir/src/ftxui/component/file_viewer.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/file_viewer.cpp.o.d"
+  "/root/repo/src/ftxui/component/frame_stats_overlay.cpp" "CMakeFiles/component.dir/src/ftxui/component/frame_stats_overlay.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/frame_stats_overlay.cpp.o.d"
+  "/root/repo/src/ftxui/component/hoverable.cpp" "CMakeFiles/component.dir/src/ftxui/component/hoverable.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/hoverable.cpp.o.d"
+  "/root/repo/src/ftxui/component/input.cpp" "CMakeFiles/component.dir/src/ftxui/component/input.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/input.cpp.o.d"
+  "/root/repo/src/ftxui/component/lazy.cpp" "CMakeFiles/component.dir/src/ftxui/component/lazy.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/lazy.cpp.o.d"
+  "/root/repo/src/ftxui/component/log_buffer.cpp" "CMakeFiles/component.dir/src/ftxui/component/log_buffer.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/log_buffer.cpp.o.d"
+  "/root/repo/src/ftxui/component/log_view.cpp" "CMakeFiles/component.dir/src/ftxui/component/log_view.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/log_view.cpp.o.d"
+  "/root/repo/src/ftxui/component/loop.cpp" "CMakeFiles/component.dir/src/ftxui/component/loop.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/loop.cpp.o.d"
+  "/root/repo/src/ftxui/component/maybe.cpp" "CMakeFiles/component.dir/src/ftxui/component/maybe.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/maybe.cpp.o.d"
+  "/root/repo/src/ftxui/component/memo.cpp" "CMakeFiles/component.dir/src/ftxui/component/memo.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/memo.cpp.o.d"
+  "/root/repo/src/ftxui/component/menu.cpp" "CMakeFiles/component.dir/src/ftxui/component/menu.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/menu.cpp.o.d"
+  "/root/repo/src/ftxui/component/modal.cpp" "CMakeFiles/component.dir/src/ftxui/component/modal.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/modal.cpp.o.d"
+  "/root/repo/src/ftxui/component/profile_component.cpp" "CMakeFiles/component.dir/src/ftxui/component/profile_component.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/profile_component.cpp.o.d"
+  "/root/repo/src/ftxui/component/profile_nodes.cpp" "CMakeFiles/component.dir/src/ftxui/component/profile_nodes.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/profile_nodes.cpp.o.d"
+  "/root/repo/src/ftxui/component/radiobox.cpp" "CMakeFiles/component.dir/src/ftxui/component/radiobox.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/radiobox.cpp.o.d"
+  "/root/repo/src/ftxui/component/recycler.cpp" "CMakeFiles/component.dir/src/ftxui/component/recycler.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/recycler.cpp.o.d"
+  "/root/repo/src/ftxui/component/render_when_visible.cpp" "CMakeFiles/component.dir/src/ftxui/component/render_when_visible.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/render_when_visible.cpp.o.d"
+  "/root/repo/src/ftxui/component/renderer.cpp" "CMakeFiles/component.dir/src/ftxui/component/renderer.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/renderer.cpp.o.d"
+  "/root/repo/src/ftxui/component/resizable_split.cpp" "CMakeFiles/component.dir/src/ftxui/component/resizable_split.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/resizable_split.cpp.o.d"
+  "/root/repo/src/ftxui/component/row_index.cpp" "CMakeFiles/component.dir/src/ftxui/component/row_index.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/row_index.cpp.o.d"
+  "/root/repo/src/ftxui/component/screen_interactive.cpp" "CMakeFiles/component.dir/src/ftxui/component/screen_interactive.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/screen_interactive.cpp.o.d"
+  "/root/repo/src/ftxui/component/session_recording.cpp" "CMakeFiles/component.dir/src/ftxui/component/session_recording.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/session_recording.cpp.o.d"
+  "/root/repo/src/ftxui/component/slider.cpp" "CMakeFiles/component.dir/src/ftxui/component/slider.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/slider.cpp.o.d"
+  "/root/repo/src/ftxui/component/terminal_input_parser.cpp" "CMakeFiles/component.dir/src/ftxui/component/terminal_input_parser.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/terminal_input_parser.cpp.o.d"
+  "/root/repo/src/ftxui/component/text_buffer.cpp" "CMakeFiles/component.dir/src/ftxui/component/text_buffer.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/text_buffer.cpp.o.d"
+  "/root/repo/src/ftxui/component/util.cpp" "CMakeFiles/component.dir/src/ftxui/component/util.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/util.cpp.o.d"
+  "/root/repo/src/ftxui/component/window.cpp" "CMakeFiles/component.dir/src/ftxui/component/window.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/window.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_minimal_build/CMakeFiles/dom.dir/DependInfo.cmake"
+  "/root/repo/_minimal_build/CMakeFiles/screen.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/component.dir/src/ftxui/component/animation.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/animation.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/background_renderer.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/background_renderer.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/button.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/button.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/catch_event.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/catch_event.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/checkbox.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/checkbox.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/checklist.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/checklist.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/collapsible.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/collapsible.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/component.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/component.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/component_options.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/component_options.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/component_profiler.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/component_profiler.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/container.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/container.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/dropdown.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/dropdown.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/entry.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/entry.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/event.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/event.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/file_viewer.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/file_viewer.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/frame_stats_overlay.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/frame_stats_overlay.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/hoverable.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/hoverable.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/input.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/input.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/lazy.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/lazy.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/log_buffer.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/log_buffer.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/log_view.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/log_view.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/loop.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/loop.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/maybe.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/maybe.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/memo.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/memo.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/menu.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/menu.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/modal.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/modal.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/profile_component.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/profile_component.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/profile_nodes.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/profile_nodes.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/radiobox.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/radiobox.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/recycler.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/recycler.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/render_when_visible.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/render_when_visible.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/renderer.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/renderer.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/resizable_split.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/resizable_split.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/row_index.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/row_index.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/screen_interactive.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/screen_interactive.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/session_recording.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/session_recording.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/slider.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/slider.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/terminal_input_parser.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/terminal_input_parser.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/text_buffer.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/text_buffer.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/util.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/util.cpp.o.d"
+  "CMakeFiles/component.dir/src/ftxui/component/window.cpp.o"
+  "CMakeFiles/component.dir/src/ftxui/component/window.cpp.o.d"
+  "libftxui-component.a"
+  "libftxui-component.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/component.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/component/allocation_test.cpp" "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/component/allocation_test.cpp.o" "gcc" "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/component/allocation_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/allocation_test.cpp" "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/dom/allocation_test.cpp.o" "gcc" "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/dom/allocation_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_minimal_build/CMakeFiles/component.dir/DependInfo.cmake"
+  "/root/repo/_minimal_build/CMakeFiles/dom.dir/DependInfo.cmake"
+  "/root/repo/_minimal_build/CMakeFiles/screen.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/component/allocation_test.cpp.o"
+  "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/component/allocation_test.cpp.o.d"
+  "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/dom/allocation_test.cpp.o"
+  "CMakeFiles/ftxui-allocation-tests.dir/src/ftxui/dom/allocation_test.cpp.o.d"
+  "ftxui-allocation-tests"
+  "ftxui-allocation-tests.pdb"
+  "ftxui-allocation-tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui-allocation-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,166 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/animation_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/animation_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/background_renderer_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/background_renderer_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/button_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/button_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/checklist_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/checklist_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/collapsible_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/collapsible_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/component_profiler_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/component_profiler_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/component_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/component_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/container_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/container_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/coroutine_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/coroutine_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/dropdown_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/dropdown_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/entry_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/entry_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/file_viewer_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/file_viewer_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/frame_stats_overlay_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/frame_stats_overlay_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/hoverable_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/hoverable_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/input_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/input_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/log_view_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/log_view_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/memo_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/memo_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/menu_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/menu_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/modal_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/modal_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/radiobox_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/radiobox_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/receiver_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/receiver_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/recycler_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/recycler_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/render_when_visible_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/render_when_visible_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/resizable_split_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/resizable_split_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/row_index_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/row_index_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/screen_interactive_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/screen_interactive_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/session_recording_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/session_recording_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/shared_state_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/shared_state_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/slider_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/slider_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/terminal_input_parser_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/terminal_input_parser_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/text_buffer_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/text_buffer_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/toggle_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/toggle_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/window_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/component/window_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/blink_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/blink_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/bold_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/bold_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/border_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/border_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/cached_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/cached_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/canvas_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/canvas_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/color_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/color_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/data_table_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/data_table_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dbox_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dbox_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dim_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dim_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_helper_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_helper_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/frame_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/frame_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gauge_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gauge_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gridbox_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gridbox_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hbox_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hbox_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hyperlink_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hyperlink_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/layout_cache_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/layout_cache_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/lazy_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/lazy_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/linear_gradient_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/linear_gradient_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_arena_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_arena_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_profiler_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_profiler_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/paragraph_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/paragraph_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/parallel_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/parallel_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/plot_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/plot_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/retained_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/retained_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/scroll_indicator_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/scroll_indicator_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/separator_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/separator_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/size_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/size_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/spinner_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/spinner_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/style_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/style_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/table_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/table_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/text_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/text_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/time_series_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/time_series_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/underlined_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/underlined_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/vbox_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/vbox_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/virtual_list_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/virtual_list_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/cell_buffer_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/cell_buffer_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/color_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/color_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/compact_pixel_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/compact_pixel_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/frame_recorder_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/frame_recorder_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_encoder_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_encoder_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/string_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/string_test.cpp.o.d"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/trace_test.cpp.o"
+  "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/trace_test.cpp.o.d"
+  "ftxui-tests"
+  "ftxui-tests.pdb"
+  "ftxui-tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/cell_buffer.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/cell_buffer.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/compact_pixel.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/compact_pixel.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/frame_recorder.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/frame_recorder.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen_encoder.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen_encoder.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/thread_pool.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/thread_pool.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/trace.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/trace.cpp.o.d"
+  "libftxui-screen.a"
+  "libftxui-screen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/screen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
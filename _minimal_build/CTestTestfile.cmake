@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_minimal_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_minimal_build/ftxui-tests[1]_include.cmake")
+include("/root/repo/_minimal_build/ftxui-allocation-tests[1]_include.cmake")
+subdirs("examples")
+subdirs("doc")
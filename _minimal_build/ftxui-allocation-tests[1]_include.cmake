@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_minimal_build/ftxui-allocation-tests[1]_tests.cmake")
+  include("/root/repo/_minimal_build/ftxui-allocation-tests[1]_tests.cmake")
+else()
+  add_test(ftxui-allocation-tests_NOT_BUILT ftxui-allocation-tests_NOT_BUILT)
+endif()
@@ -0,0 +1,17 @@
+add_test([=[TerminalInputParserAllocation.MouseMotions]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=TerminalInputParserAllocation.MouseMotions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TerminalInputParserAllocation.MouseMotions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllocationTest.ToString]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=AllocationTest.ToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationTest.ToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllocationTest.ToStringDiff]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=AllocationTest.ToStringDiff]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationTest.ToStringDiff]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllocationTest.ColorPrint]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=AllocationTest.ColorPrint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationTest.ColorPrint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllocationTest.StringWidth]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=AllocationTest.StringWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationTest.StringWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllocationTest.Utf8ToGlyphs]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=AllocationTest.Utf8ToGlyphs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationTest.Utf8ToGlyphs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllocationTest.RenderUnchangedGallery]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=AllocationTest.RenderUnchangedGallery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationTest.RenderUnchangedGallery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllocationTest.RenderUnchangedGalleryWithArena]=]  /root/repo/_minimal_build/ftxui-allocation-tests [==[--gtest_filter=AllocationTest.RenderUnchangedGalleryWithArena]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationTest.RenderUnchangedGalleryWithArena]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  ftxui-allocation-tests_TESTS TerminalInputParserAllocation.MouseMotions AllocationTest.ToString AllocationTest.ToStringDiff AllocationTest.ColorPrint AllocationTest.StringWidth AllocationTest.Utf8ToGlyphs AllocationTest.RenderUnchangedGallery AllocationTest.RenderUnchangedGalleryWithArena)
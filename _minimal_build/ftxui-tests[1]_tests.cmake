@@ -0,0 +1,1035 @@
+add_test([=[AnimationTest.StartAndEnd]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=AnimationTest.StartAndEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnimationTest.StartAndEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BackgroundRenderer.OutlivesScreen]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BackgroundRenderer.OutlivesScreen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BackgroundRenderer.OutlivesScreen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BackgroundRenderer.Destroyed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BackgroundRenderer.Destroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BackgroundRenderer.Destroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ButtonTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ButtonTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ButtonTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ButtonTest.AnimationForegroundOnly]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ButtonTest.AnimationForegroundOnly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ButtonTest.AnimationForegroundOnly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ChecklistTest.Toggle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ChecklistTest.Toggle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ChecklistTest.Toggle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ChecklistTest.Range]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ChecklistTest.Range]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ChecklistTest.Range]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ChecklistTest.Virtualized]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ChecklistTest.Virtualized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ChecklistTest.Virtualized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollapsibleTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CollapsibleTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollapsibleTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollapsibleTest.Lazy]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CollapsibleTest.Lazy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollapsibleTest.Lazy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentProfilerTest.InclusiveExclusive]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ComponentProfilerTest.InclusiveExclusive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentProfilerTest.InclusiveExclusive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentProfilerTest.Screen]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ComponentProfilerTest.Screen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentProfilerTest.Screen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.DeleteParentFirst]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.DeleteParentFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.DeleteParentFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.DeleteChildFirst]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.DeleteChildFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.DeleteChildFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.Detach]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.Detach]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.Detach]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.DetachAllChildren]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.DetachAllChildren]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.DetachAllChildren]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.Add]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.Add]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.Add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.ChildAt]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.ChildAt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.ChildAt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.HorizontalEvent]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.HorizontalEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.HorizontalEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.VerticalEvent]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.VerticalEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.VerticalEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.VerticalPageAndHomeEnd]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.VerticalPageAndHomeEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.VerticalPageAndHomeEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.SetActiveChild]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.SetActiveChild]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.SetActiveChild]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.TakeFocus]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.TakeFocus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.TakeFocus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.TabFocusable]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.TabFocusable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.TabFocusable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.MouseEventUnderPointer]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.MouseEventUnderPointer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.MouseEventUnderPointer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.TabLazy]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.TabLazy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.TabLazy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.TabLazyKept]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ContainerTest.TabLazyKept]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.TabLazyKept]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentTest.NonFocusableAreNotFocused]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ComponentTest.NonFocusableAreNotFocused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentTest.NonFocusableAreNotFocused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentTest.EventSubscription]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ComponentTest.EventSubscription]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentTest.EventSubscription]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentTest.MemoryUsage]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ComponentTest.MemoryUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentTest.MemoryUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DropdownTest.EntriesOnlyReadWhileOpen]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DropdownTest.EntriesOnlyReadWhileOpen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DropdownTest.EntriesOnlyReadWhileOpen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EntryTest.Checkbox]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=EntryTest.Checkbox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EntryTest.Checkbox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EntryTest.Radiobox]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=EntryTest.Radiobox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EntryTest.Radiobox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EntryTest.Menu]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=EntryTest.Menu]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EntryTest.Menu]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EntryTest.Button]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=EntryTest.Button]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EntryTest.Button]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EntryTest.CustomTransform]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=EntryTest.CustomTransform]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EntryTest.CustomTransform]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileViewerTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FileViewerTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileViewerTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileViewerTest.Scroll]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FileViewerTest.Scroll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileViewerTest.Scroll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileViewerTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FileViewerTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileViewerTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileViewerTest.MissingFile]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FileViewerTest.MissingFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileViewerTest.MissingFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameStatsOverlayTest.WithoutScreenInteractive]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameStatsOverlayTest.WithoutScreenInteractive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameStatsOverlayTest.WithoutScreenInteractive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameStatsOverlayTest.WithScreenInteractive]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameStatsOverlayTest.WithScreenInteractive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameStatsOverlayTest.WithScreenInteractive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.BasicBool]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HoverableTest.BasicBool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.BasicBool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.BasicCallback]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HoverableTest.BasicCallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.BasicCallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.BasicBoolCallback]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HoverableTest.BasicBoolCallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.BasicBoolCallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.Coverage]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HoverableTest.Coverage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.Coverage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Init]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Init]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Init]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Type]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Type]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Type]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Paste]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Paste]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Paste]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.ArrowLeftRight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.ArrowLeftRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.ArrowLeftRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.ArrowUpDown]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.ArrowUpDown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.ArrowUpDown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Insert]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Insert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Home]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Home]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Home]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.End]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.End]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.End]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Delete]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Delete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Delete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Backspace]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Backspace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Backspace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.CtrlArrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowLeft2]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.CtrlArrowLeft2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowLeft2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowRight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.CtrlArrowRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowRight2]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.CtrlArrowRight2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowRight2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.TypePassword]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.TypePassword]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.TypePassword]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.MouseClick]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.MouseClick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.MouseClick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.MouseClickComplex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.MouseClickComplex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.MouseClickComplex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.OnEnter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.OnEnter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.OnEnter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.InsertMode]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.InsertMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.InsertMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Buffer]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Buffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Buffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Virtualized]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Virtualized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Virtualized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.ReuseLines]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.ReuseLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.ReuseLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Keymap]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=InputTest.Keymap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Keymap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogViewTest.RingBuffer]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LogViewTest.RingBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogViewTest.RingBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogViewTest.Follow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LogViewTest.Follow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogViewTest.Follow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogViewTest.ScrollUp]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LogViewTest.ScrollUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogViewTest.ScrollUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogViewTest.BatchedRedraws]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LogViewTest.BatchedRedraws]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogViewTest.BatchedRedraws]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoTest.ReuseElement]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MemoTest.ReuseElement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoTest.ReuseElement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoTest.FocusChange]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MemoTest.FocusChange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoTest.FocusChange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoTest.Invalidate]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MemoTest.Invalidate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoTest.Invalidate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoTest.InvalidatedByEvent]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MemoTest.InvalidatedByEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoTest.InvalidatedByEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.RemoveEntries]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.RemoveEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.RemoveEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionDown]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.DirectionDown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionDown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionsUp]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.DirectionsUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionsUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionsRight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.DirectionsRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionsRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionsLeft]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.DirectionsLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionsLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.Virtualized]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.Virtualized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.Virtualized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.VirtualizedCallbacks]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.VirtualizedCallbacks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.VirtualizedCallbacks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.VirtualizedSameAsDefault]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.VirtualizedSameAsDefault]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.VirtualizedSameAsDefault]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.VirtualizedMouse]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.VirtualizedMouse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.VirtualizedMouse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.Keymap]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=MenuTest.Keymap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.Keymap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ModalTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ModalTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ModalTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ModalTest.Snapshot]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ModalTest.Snapshot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ModalTest.Snapshot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ModalTest.Dim]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ModalTest.Dim]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ModalTest.Dim]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationArrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.NavigationArrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationArrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationArrowVim]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.NavigationArrowVim]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationArrowVim]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationTab]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.NavigationTab]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationTab]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationHome]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.NavigationHome]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationHome]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationPageDown]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.NavigationPageDown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationPageDown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationPageUp]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.NavigationPageUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationPageUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationEnd]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.NavigationEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.EventSpace]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.EventSpace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.EventSpace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.RemoveEntries]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RadioboxTest.RemoveEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.RemoveEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.BasicWithThread]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.BasicWithThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.BasicWithThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.ReceiveAll]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.ReceiveAll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.ReceiveAll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.NotDefaultConstructible]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.NotDefaultConstructible]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.NotDefaultConstructible]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.ManySenders]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.ManySenders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.ManySenders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.DropOldest]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.DropOldest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.DropOldest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.DropNewest]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.DropNewest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.DropNewest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.Block]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Receiver.Block]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.Block]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecyclerTest.OnlyVisibleRowsAreBuilt]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RecyclerTest.OnlyVisibleRowsAreBuilt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RecyclerTest.OnlyVisibleRowsAreBuilt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecyclerTest.SelectionScrolls]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RecyclerTest.SelectionScrolls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RecyclerTest.SelectionScrolls]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecyclerTest.FocusFollowsTheRow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RecyclerTest.FocusFollowsTheRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RecyclerTest.FocusFollowsTheRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecyclerTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RecyclerTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RecyclerTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RenderWhenVisibleTest.CullHiddenRows]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RenderWhenVisibleTest.CullHiddenRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RenderWhenVisibleTest.CullHiddenRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RenderWhenVisibleTest.PlaceholderComingIntoView]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RenderWhenVisibleTest.PlaceholderComingIntoView]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RenderWhenVisibleTest.PlaceholderComingIntoView]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicLeft]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicLeftWithCustomSeparator]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicLeftWithCustomSeparator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicLeftWithCustomSeparator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicRight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicRightWithCustomSeparator]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicRightWithCustomSeparator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicRightWithCustomSeparator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicTop]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicTop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicTop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicTopWithCustomSeparator]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicTopWithCustomSeparator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicTopWithCustomSeparator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicBottom]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicBottom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicBottom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicBottomWithCustomSeparator]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.BasicBottomWithCustomSeparator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicBottomWithCustomSeparator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.DragReusesPanes]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ResizableSplit.DragReusesPanes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.DragReusesPanes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowIndexTest.FilterAndSort]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RowIndexTest.FilterAndSort]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowIndexTest.FilterAndSort]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowIndexTest.Menu]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RowIndexTest.Menu]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowIndexTest.Menu]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGTERM]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Signal_SIGTERM]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGTERM]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGSEGV]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Signal_SIGSEGV]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGSEGV]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGINT]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Signal_SIGINT]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGINT]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGILL]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Signal_SIGILL]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGILL]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGABRT]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Signal_SIGABRT]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGABRT]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGFPE]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Signal_SIGFPE]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGFPE]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PostEventToNonActive]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.PostEventToNonActive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PostEventToNonActive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PostTaskToNonActive]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.PostTaskToNonActive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PostTaskToNonActive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.CoalesceTasks]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.CoalesceTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.CoalesceTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PostEventToTarget]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.PostEventToTarget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PostEventToTarget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.LimitFrameRate]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.LimitFrameRate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.LimitFrameRate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.TerminalSizeCachedUntilResize]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.TerminalSizeCachedUntilResize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.TerminalSizeCachedUntilResize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ExternalEventLoop]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ExternalEventLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ExternalEventLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ExternalEventLoopResize]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ExternalEventLoopResize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ExternalEventLoopResize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ReadInputOnLoopThread]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ReadInputOnLoopThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ReadInputOnLoopThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ThreadedOutput]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ThreadedOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ThreadedOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.SynchronizedOutput]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.SynchronizedOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.SynchronizedOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.DropStaleFrames]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.DropStaleFrames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.DropStaleFrames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.HeadlessInputOutput]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.HeadlessInputOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.HeadlessInputOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.HeadlessEscapeTimeout]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.HeadlessEscapeTimeout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.HeadlessEscapeTimeout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.FrameStats]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.FrameStats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.FrameStats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ProbeTerminal]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ProbeTerminal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ProbeTerminal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ExportMetrics]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ExportMetrics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ExportMetrics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.NodeProfiler]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.NodeProfiler]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.NodeProfiler]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ThrottleMouseMotionFrameRate]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ThrottleMouseMotionFrameRate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ThrottleMouseMotionFrameRate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.CapturedMouseDrag]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.CapturedMouseDrag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.CapturedMouseDrag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.RunOnceDeadline]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.RunOnceDeadline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.RunOnceDeadline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.TaskLanes]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.TaskLanes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.TaskLanes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ExportCells]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.ExportCells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ExportCells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.CursorPositionRequests]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.CursorPositionRequests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.CursorPositionRequests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Commit]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Commit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Commit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Timers]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.Timers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Timers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.TimersWakeUpTheLoop]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenInteractive.TimersWakeUpTheLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.TimersWakeUpTheLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SessionRecording.Encoding]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SessionRecording.Encoding]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SessionRecording.Encoding]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SessionRecording.Malformed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SessionRecording.Malformed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SessionRecording.Malformed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SessionRecording.RecordAndReplay]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SessionRecording.RecordAndReplay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SessionRecording.RecordAndReplay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedStateTest.UpdateBeforeLoop]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SharedStateTest.UpdateBeforeLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedStateTest.UpdateBeforeLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedStateTest.BatchedUpdates]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SharedStateTest.BatchedUpdates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedStateTest.BatchedUpdates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Right]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SliderTest.Right]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Right]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Left]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SliderTest.Left]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Left]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Down]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SliderTest.Down]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Down]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Up]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SliderTest.Up]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Up]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Focus]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SliderTest.Focus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Focus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Character]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.Character]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Character]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.EscapeKeyWithoutWaiting]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.EscapeKeyWithoutWaiting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.EscapeKeyWithoutWaiting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.EscapeKeyNotEnoughWait]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.EscapeKeyNotEnoughWait]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.EscapeKeyNotEnoughWait]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.EscapeKeyEnoughWait]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.EscapeKeyEnoughWait]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.EscapeKeyEnoughWait]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseLeftClickPressed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.MouseLeftClickPressed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseLeftClickPressed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseLeftMoved]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.MouseLeftMoved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseLeftMoved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseLeftClickReleased]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.MouseLeftClickReleased]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseLeftClickReleased]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseReporting]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.MouseReporting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseReporting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseMiddleClick]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.MouseMiddleClick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseMiddleClick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseRightClick]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.MouseRightClick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseRightClick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.UTF8]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.UTF8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.UTF8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.NewLine]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.NewLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.NewLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Control]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.Control]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Control]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Special]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.Special]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Special]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.DeviceControlString]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.DeviceControlString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.DeviceControlString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.ModeReport]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.ModeReport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.ModeReport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.TerminalReport]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.TerminalReport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.TerminalReport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Equality]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.Equality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Equality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.BracketedPaste]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.BracketedPaste]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.BracketedPaste]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.AddString]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=Event.AddString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.AddString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextBufferTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextBufferTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextBufferTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextBufferTest.Lines]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextBufferTest.Lines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextBufferTest.Lines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextBufferTest.Insert]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextBufferTest.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextBufferTest.Insert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextBufferTest.Erase]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextBufferTest.Erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextBufferTest.Erase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextBufferTest.ManyLines]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextBufferTest.ManyLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextBufferTest.ManyLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.leftRightArrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ToggleTest.leftRightArrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.leftRightArrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.Tab]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ToggleTest.Tab]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.Tab]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.OnChange]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ToggleTest.OnChange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.OnChange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.OnEnter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ToggleTest.OnEnter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.OnEnter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.RemoveEntries]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ToggleTest.RemoveEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.RemoveEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WindowTest.Composited]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=WindowTest.Composited]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WindowTest.Composited]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BlinkTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BlinkTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BlinkTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoldTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BoldTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoldTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Default]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Default]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Default]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Light]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Light]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Light]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Double]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Double]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Double]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Rounded]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Rounded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Rounded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Heavy]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Heavy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Heavy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Styled]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Styled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Styled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.WithPixel]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.WithPixel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.WithPixel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Window]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=BorderTest.Window]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Window]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.ReusePixels]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CachedTest.ReusePixels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.ReusePixels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.Resized]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CachedTest.Resized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.Resized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldPoint]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.GoldPoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldPoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldPointColor]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.GoldPointColor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldPointColor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldBlock]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.GoldBlock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldBlock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldBlockColor]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.GoldBlockColor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldBlockColor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldText]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.GoldText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GetPixel]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.GetPixel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GetPixel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.BrailleGlyphs]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.BrailleGlyphs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.BrailleGlyphs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawImage]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawImage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawImage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawPointScatterParallel]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawPointScatterParallel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawPointScatterParallel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.ManyStyles]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.ManyStyles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.ManyStyles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawPointPolyline]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawPointPolyline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawPointPolyline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawPointPolylineClipped]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawPointPolylineClipped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawPointPolylineClipped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawPointScatter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawPointScatter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawPointScatter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawBlockPolyline]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawBlockPolyline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawBlockPolyline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawPointPolylineStyleOncePerStyle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawPointPolylineStyleOncePerStyle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawPointPolylineStyleOncePerStyle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawShapeStyleOncePerStyle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.DrawShapeStyleOncePerStyle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawShapeStyleOncePerStyle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.StyleRectangle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.StyleRectangle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.StyleRectangle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.Clear]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.Clear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.ClearRegion]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.ClearRegion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.ClearRegion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.Scroll]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.Scroll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.Scroll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.ScrollingChart]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CanvasTest.ScrollingChart]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.ScrollingChart]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Foreground]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.Foreground]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Foreground]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Background]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.Background]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Background]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.API_default]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.API_default]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.API_default]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.API_builder]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.API_builder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.API_builder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.API_constructor_bicolor]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.API_constructor_bicolor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.API_constructor_bicolor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.API_constructor_bicolor_angle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.API_constructor_bicolor_angle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.API_constructor_bicolor_angle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.GradientForeground]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.GradientForeground]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.GradientForeground]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.GradientBackground]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.GradientBackground]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.GradientBackground]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.GradientEveryCell]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.GradientEveryCell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.GradientEveryCell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.GradientDiagonal]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.GradientDiagonal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.GradientDiagonal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.GradientSingleCell]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.GradientSingleCell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.GradientSingleCell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintTransparent]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.PrintTransparent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintTransparent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintColor16]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.PrintColor16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintColor16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintColor256]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.PrintColor256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintColor256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintTrueCOlor]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.PrintTrueCOlor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintTrueCOlor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.FallbackTo256]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.FallbackTo256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.FallbackTo256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.FallbackTo256Closest]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.FallbackTo256Closest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.FallbackTo256Closest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.FallbackTo16]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.FallbackTo16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.FallbackTo16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Downsample]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.Downsample]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Downsample]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Litterals]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.Litterals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Litterals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Interpolate]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.Interpolate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Interpolate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.InterpolateBatch]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.InterpolateBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.InterpolateBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.HSV]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.HSV]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.HSV]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintAppend]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ColorTest.PrintAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataTableTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DataTableTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataTableTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataTableTest.AlignAndWidth]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DataTableTest.AlignAndWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataTableTest.AlignAndWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataTableTest.Formatter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DataTableTest.Formatter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataTableTest.Formatter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataTableTest.OnlyVisibleRowsAreFormatted]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DataTableTest.OnlyVisibleRowsAreFormatted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataTableTest.OnlyVisibleRowsAreFormatted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DBoxTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.Occluded]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DBoxTest.Occluded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.Occluded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.PartiallyOccluded]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DBoxTest.PartiallyOccluded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.PartiallyOccluded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DimTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=DimTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DimTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicRow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxHelperTest.BasicRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicColumn]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxHelperTest.BasicColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicRowInversed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxHelperTest.BasicRowInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicRowInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicColumnInversed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxHelperTest.BasicColumnInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicColumnInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.MixedFastAndSlowLines]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxHelperTest.MixedFastAndSlowLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.MixedFastAndSlowLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicRow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.BasicRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicRowInversed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.BasicRowInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicRowInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicColumn]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.BasicColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicColumnInversed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.BasicColumnInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicColumnInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentCenter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.JustifyContentCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentSpaceBetween]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.JustifyContentSpaceBetween]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentSpaceBetween]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentSpaceAround]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.JustifyContentSpaceAround]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentSpaceAround]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentSpaceEvenly]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.JustifyContentSpaceEvenly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentSpaceEvenly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignItemsFlexEnd]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.AlignItemsFlexEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignItemsFlexEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignItemsCenter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.AlignItemsCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignItemsCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentFlexEnd]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.AlignContentFlexEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentFlexEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentCenter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.AlignContentCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentSpaceBetween]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.AlignContentSpaceBetween]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentSpaceBetween]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentSpaceAround]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.AlignContentSpaceAround]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentSpaceAround]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentSpaceEvenly]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.AlignContentSpaceEvenly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentSpaceEvenly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.GapX]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.GapX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.GapX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.GapX2]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.GapX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.GapX2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.GapY]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.GapY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.GapY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.Focus]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FlexboxTest.Focus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.Focus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameTest.CullRowsOutsideOfTheFrame]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameTest.CullRowsOutsideOfTheFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameTest.CullRowsOutsideOfTheFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameTest.CullColumnsOutsideOfTheFrame]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameTest.CullColumnsOutsideOfTheFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameTest.CullColumnsOutsideOfTheFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameTest.ReflectCulledRow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameTest.ReflectCulledRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameTest.ReflectCulledRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.ZeroHorizontal]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.ZeroHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.ZeroHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.HalfHorizontal]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.HalfHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.HalfHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.OneHorizontal]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.OneHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.OneHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.ZeroVertical]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.ZeroVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.ZeroVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.HalfVertical]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.HalfVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.HalfVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.OneVertical]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.OneVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.OneVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.Gauges]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.Gauges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.Gauges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.GaugesWithoutLabels]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.GaugesWithoutLabels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.GaugesWithoutLabels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.GaugesMatchGauge]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.GaugesMatchGauge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.GaugesMatchGauge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.GaugesUp]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.GaugesUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.GaugesUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.GaugesOnlyDrawTheVisibleRows]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GaugeTest.GaugesOnlyDrawTheVisibleRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.GaugesOnlyDrawTheVisibleRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.UnfilledRectangular]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.UnfilledRectangular]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.UnfilledRectangular]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.DifferentSize]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.DifferentSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.DifferentSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.CenterFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterFlexCross]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.CenterFlexCross]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterFlexCross]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.CenterShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterShrinkColumn]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.CenterShrinkColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterShrinkColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Vertical_NoFlex_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Vertical_NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Vertical_NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.MissingCells]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.MissingCells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.MissingCells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Focus]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.Focus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Focus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.FocusLeftmostColumn]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=GridboxTest.FocusLeftmostColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.FocusLeftmostColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_FlexGrow_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.NoFlex_FlexGrow_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_FlexGrow_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_NoFlex_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.NoFlex_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_NoFlex_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.FlexGrow_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_FlexGrow_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.FlexGrow_FlexGrow_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_FlexGrow_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexShrink_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.FlexShrink_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexShrink_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_FlexShrink_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.NoFlex_FlexShrink_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_FlexShrink_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_NoFlex_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.NoFlex_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexShrink_NoFlex_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.FlexShrink_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexShrink_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexShrink_FlexShrink_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.FlexShrink_FlexShrink_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexShrink_FlexShrink_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_NoFlex_FlewShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.FlexGrow_NoFlex_FlewShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_NoFlex_FlewShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.ManyChildren]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=HBoxTest.ManyChildren]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.ManyChildren]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutCacheTest.FitThenRender]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LayoutCacheTest.FitThenRender]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutCacheTest.FitThenRender]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutCacheTest.OtherBox]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LayoutCacheTest.OtherBox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutCacheTest.OtherBox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutCacheTest.OtherElement]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LayoutCacheTest.OtherElement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutCacheTest.OtherElement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutCacheTest.Paragraph]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LayoutCacheTest.Paragraph]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutCacheTest.Paragraph]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LazyTest.OnlyVisibleElementsAreBuilt]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LazyTest.OnlyVisibleElementsAreBuilt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LazyTest.OnlyVisibleElementsAreBuilt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LazyTest.HintedSize]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=LazyTest.HintedSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LazyTest.HintedSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeArenaTest.Render]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeArenaTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeArenaTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeArenaTest.NoArena]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeArenaTest.NoArena]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeArenaTest.NoArena]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeArenaTest.MemoryReused]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeArenaTest.MemoryReused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeArenaTest.MemoryReused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeArenaTest.ElementOutliveScope]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeArenaTest.ElementOutliveScope]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeArenaTest.ElementOutliveScope]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeArenaTest.ElementOutliveArena]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeArenaTest.ElementOutliveArena]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeArenaTest.ElementOutliveArena]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeProfilerTest.ByType]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeProfilerTest.ByType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeProfilerTest.ByType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeProfilerTest.Label]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeProfilerTest.Label]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeProfilerTest.Label]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeProfilerTest.Frames]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeProfilerTest.Frames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeProfilerTest.Frames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeProfilerTest.Arena]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeProfilerTest.Arena]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeProfilerTest.Arena]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeProfilerTest.ToString]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeProfilerTest.ToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeProfilerTest.ToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.RenderTiled]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeTest.RenderTiled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.RenderTiled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.OnlyUnconvergedSubtreesIterate]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeTest.OnlyUnconvergedSubtreesIterate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.OnlyUnconvergedSubtreesIterate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.ReflectInCustomNode]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeTest.ReflectInCustomNode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.ReflectInCustomNode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.MemoryUsage]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=NodeTest.MemoryUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.MemoryUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ParagraphTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.View]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ParagraphTest.View]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.View]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.SameAsFlexbox]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ParagraphTest.SameAsFlexbox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.SameAsFlexbox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.SameAsSequential]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ParallelTest.SameAsSequential]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.SameAsSequential]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.Nested]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ParallelTest.Nested]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.Nested]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.Overlapping]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ParallelTest.Overlapping]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.Overlapping]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.Cursor]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ParallelTest.Cursor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.Cursor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PlotTest.YRange]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=PlotTest.YRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlotTest.YRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PlotTest.ClipLine]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=PlotTest.ClipLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlotTest.ClipLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PlotTest.Sparse]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=PlotTest.Sparse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlotTest.Sparse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PlotTest.Dense]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=PlotTest.Dense]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlotTest.Dense]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.ReusePixels]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RetainedTest.ReusePixels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.ReusePixels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.Moved]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RetainedTest.Moved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.Moved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.BackgroundChanged]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RetainedTest.BackgroundChanged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.BackgroundChanged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.ReuseLayout]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RetainedTest.ReuseLayout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.ReuseLayout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.FlexboxResized]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=RetainedTest.FlexboxResized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.FlexboxResized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.BasicVertical]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.BasicVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.BasicVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.VerticalColorable]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.VerticalColorable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.VerticalColorable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.VerticalBackgroundColorable]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.VerticalBackgroundColorable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.VerticalBackgroundColorable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.VerticalFullColorable]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.VerticalFullColorable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.VerticalFullColorable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.BasicHorizontal]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.BasicHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.BasicHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.HorizontalColorable]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.HorizontalColorable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.HorizontalColorable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.HorizontalBackgroundColorable]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.HorizontalBackgroundColorable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.HorizontalBackgroundColorable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.HorizontalFullColorable]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.HorizontalFullColorable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.HorizontalFullColorable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.HorizontalFlexbox]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScrollIndicator.HorizontalFlexbox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.HorizontalFlexbox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Default]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.Default]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Default]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Light]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.Light]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Light]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Dashed]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.Dashed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Dashed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Double]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.Double]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Double]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Heavy]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.Heavy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Heavy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Styled]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.Styled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Styled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.WithPixel]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SeparatorTest.WithPixel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.WithPixel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SizeTest.Equal]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SizeTest.Equal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SizeTest.Equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SizeTest.FixedSize]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SizeTest.FixedSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SizeTest.FixedSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner1]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SpinnerTest.Spinner1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner2]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SpinnerTest.Spinner2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner3]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SpinnerTest.Spinner3]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner3]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner4]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SpinnerTest.Spinner4]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner4]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.MultipleLines]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SpinnerTest.MultipleLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.MultipleLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Clipped]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=SpinnerTest.Clipped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Clipped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.SingleNode]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=StyleTest.SingleNode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.SingleNode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.InnerColorWins]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=StyleTest.InnerColorWins]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.InnerColorWins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.InvertedTwice]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=StyleTest.InvertedTwice]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.InvertedTwice]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.SharedElement]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=StyleTest.SharedElement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.SharedElement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.Spec]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=StyleTest.Spec]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.Spec]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorVerticalEmpty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SeparatorVerticalEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorVerticalEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorHorizontalEmpty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SeparatorHorizontalEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorHorizontalEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorHorizontalLight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SeparatorHorizontalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorHorizontalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorVerticalLight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SeparatorVerticalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorVerticalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorLight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SeparatorLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorVerticalHorizontalLight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SeparatorVerticalHorizontalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorVerticalHorizontalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorHorizontalVerticalLight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SeparatorHorizontalVerticalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorHorizontalVerticalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.BorderLight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.BorderLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.BorderLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.BorderSeparatorLight]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.BorderSeparatorLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.BorderSeparatorLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRowNegative]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectRowNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRowNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumn]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumnNegative]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectColumnNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumnNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.CrossingBorders]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.CrossingBorders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.CrossingBorders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.CrossingBordersLightAndDouble]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.CrossingBordersLightAndDouble]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.CrossingBordersLightAndDouble]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumns]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRows]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRectangle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectRectangle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRectangle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumnsNegative]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectColumnsNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumnsNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectInverted]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.SelectInverted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectInverted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.ColumnFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnFlexCenter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.ColumnFlexCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnFlexCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnCenter]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.ColumnCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnFlexTwo]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.ColumnFlexTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnFlexTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.RowFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.RowFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.RowFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.RowFlexTwo]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.RowFlexTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.RowFlexTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Merge]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.Merge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Merge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Virtual]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.Virtual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Virtual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.VirtualWidths]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.VirtualWidths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.VirtualWidths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Style]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.Style]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Style]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.StyleNodes]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.StyleNodes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.StyleNodes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.BorderNodes]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TableTest.BorderNodes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.BorderNodes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenHeightSmaller]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.ScreenHeightSmaller]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenHeightSmaller]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenSmaller]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.ScreenSmaller]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenSmaller]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenFit]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.ScreenFit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenFit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenBigger]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.ScreenBigger]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenBigger]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenBigger2]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.ScreenBigger2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenBigger2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.MaskedText]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.MaskedText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.MaskedText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.MaskedTextClipped]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.MaskedTextClipped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.MaskedTextClipped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.MeasuredTextIntern]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.MeasuredTextIntern]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.MeasuredTextIntern]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.TextLines]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.TextLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.TextLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.TextLinesFrame]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TextTest.TextLinesFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.TextLinesFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TimeSeriesTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.OneSamplePerColumn]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TimeSeriesTest.OneSamplePerColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.OneSamplePerColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.PartiallyFilled]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TimeSeriesTest.PartiallyFilled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.PartiallyFilled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.RingBuffer]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TimeSeriesTest.RingBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.RingBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.Clamped]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TimeSeriesTest.Clamped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.Clamped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.Decimated]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TimeSeriesTest.Decimated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.Decimated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.PushFromThreads]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TimeSeriesTest.PushFromThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.PushFromThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnderlinedTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=UnderlinedTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnderlinedTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_FlexGrow_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.NoFlex_FlexGrow_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_FlexGrow_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_NoFlex_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.NoFlex_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_NoFlex_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.FlexGrow_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_FlexGrow_FlexGrow]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.FlexGrow_FlexGrow_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_FlexGrow_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexShrink_NoFlex_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.FlexShrink_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexShrink_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_FlexShrink_NoFlex]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.NoFlex_FlexShrink_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_FlexShrink_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_NoFlex_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.NoFlex_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexShrink_NoFlex_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.FlexShrink_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexShrink_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexShrink_FlexShrink_FlexShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.FlexShrink_FlexShrink_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexShrink_FlexShrink_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_NoFlex_FlewShrink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VBoxText.FlexGrow_NoFlex_FlewShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_NoFlex_FlewShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.Basic]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VirtualListTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.OnlyVisibleRowsAreBuilt]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VirtualListTest.OnlyVisibleRowsAreBuilt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.OnlyVisibleRowsAreBuilt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.RowsAreClipped]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VirtualListTest.RowsAreClipped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.RowsAreClipped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.Empty]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=VirtualListTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CellBufferTest.Cells]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CellBufferTest.Cells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CellBufferTest.Cells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CellBufferTest.RowFrames]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CellBufferTest.RowFrames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CellBufferTest.RowFrames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CellBufferTest.Cursor]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CellBufferTest.Cursor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CellBufferTest.Cursor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactPixelTest.Size]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CompactPixelTest.Size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactPixelTest.Size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactPixelTest.Default]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CompactPixelTest.Default]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactPixelTest.Default]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactPixelTest.RoundTrip]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CompactPixelTest.RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactPixelTest.RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactPixelTest.Interned]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=CompactPixelTest.Interned]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactPixelTest.Interned]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameRecorderTest.Seek]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameRecorderTest.Seek]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameRecorderTest.Seek]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameRecorderTest.OnlyChangedCells]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameRecorderTest.OnlyChangedCells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameRecorderTest.OnlyChangedCells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameRecorderTest.Resize]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameRecorderTest.Resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameRecorderTest.Resize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameRecorderTest.Hyperlink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameRecorderTest.Hyperlink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameRecorderTest.Hyperlink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameRecorderTest.Truncated]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=FrameRecorderTest.Truncated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameRecorderTest.Truncated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenEncoderTest.Diff]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenEncoderTest.Diff]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenEncoderTest.Diff]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenEncoderTest.ColorSupport]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenEncoderTest.ColorSupport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenEncoderTest.ColorSupport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenEncoderTest.Dimensions]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenEncoderTest.Dimensions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenEncoderTest.Dimensions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenEncoderTest.ScrollRegions]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenEncoderTest.ScrollRegions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenEncoderTest.ScrollRegions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenEncoderTest.Hyperlink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenEncoderTest.Hyperlink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenEncoderTest.Hyperlink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ApplyShader]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ApplyShader]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ApplyShader]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringAppend]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringSink]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringSink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringSink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringLarge]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringLarge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringLarge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.WriteTo]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.WriteTo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.WriteTo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffAppend]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffIdentical]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffIdentical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffIdentical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffWrittenRows]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffWrittenRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffWrittenRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffSingleCell]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffSingleCell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffSingleCell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffMergeSmallGaps]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffMergeSmallGaps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffMergeSmallGaps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffAbsoluteColumn]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffAbsoluteColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffAbsoluteColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffScroll]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffScroll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffScroll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ResetPosition]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ResetPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ResetPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffStyle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffStyle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffStyle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffDifferentDimensions]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffDifferentDimensions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffDifferentDimensions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringManyFullWidth]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringManyFullWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringManyFullWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.Clear]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.Clear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ForEachPixel]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ForEachPixel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ForEachPixel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ApplyStyle]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ApplyStyle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ApplyStyle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringColorSupport]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringColorSupport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringColorSupport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringCompression]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringCompression]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringCompression]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffCompression]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.ToStringDiffCompression]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffCompression]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.MemoryUsage]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.MemoryUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.MemoryUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.Resize]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=ScreenTest.Resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.Resize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.to_string]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=StringTest.to_string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.to_string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.to_wstring]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=StringTest.to_wstring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.to_wstring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceTest.Recording]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TraceTest.Recording]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TraceTest.Recording]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceTest.StartDiscardsPreviousEvents]=]  /root/repo/_minimal_build/ftxui-tests [==[--gtest_filter=TraceTest.StartDiscardsPreviousEvents]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TraceTest.StartDiscardsPreviousEvents]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_minimal_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  ftxui-tests_TESTS AnimationTest.StartAndEnd BackgroundRenderer.OutlivesScreen BackgroundRenderer.Destroyed ButtonTest.Basic ButtonTest.AnimationForegroundOnly ChecklistTest.Toggle ChecklistTest.Range ChecklistTest.Virtualized CollapsibleTest.Basic CollapsibleTest.Lazy ComponentProfilerTest.InclusiveExclusive ComponentProfilerTest.Screen ContainerTest.DeleteParentFirst ContainerTest.DeleteChildFirst ContainerTest.Detach ContainerTest.DetachAllChildren ContainerTest.Add ContainerTest.ChildAt ContainerTest.HorizontalEvent ContainerTest.VerticalEvent ContainerTest.VerticalPageAndHomeEnd ContainerTest.SetActiveChild ContainerTest.TakeFocus ContainerTest.TabFocusable ContainerTest.MouseEventUnderPointer ContainerTest.TabLazy ContainerTest.TabLazyKept ComponentTest.NonFocusableAreNotFocused ComponentTest.EventSubscription ComponentTest.MemoryUsage DropdownTest.EntriesOnlyReadWhileOpen EntryTest.Checkbox EntryTest.Radiobox EntryTest.Menu EntryTest.Button EntryTest.CustomTransform FileViewerTest.Basic FileViewerTest.Scroll FileViewerTest.Empty FileViewerTest.MissingFile FrameStatsOverlayTest.WithoutScreenInteractive FrameStatsOverlayTest.WithScreenInteractive HoverableTest.BasicBool HoverableTest.BasicCallback HoverableTest.BasicBoolCallback HoverableTest.Coverage InputTest.Init InputTest.Type InputTest.Paste InputTest.ArrowLeftRight InputTest.ArrowUpDown InputTest.Insert InputTest.Home InputTest.End InputTest.Delete InputTest.Backspace InputTest.CtrlArrow InputTest.CtrlArrowLeft2 InputTest.CtrlArrowRight InputTest.CtrlArrowRight2 InputTest.TypePassword InputTest.MouseClick InputTest.MouseClickComplex InputTest.OnEnter InputTest.InsertMode InputTest.Buffer InputTest.Virtualized InputTest.ReuseLines InputTest.Keymap LogViewTest.RingBuffer LogViewTest.Follow LogViewTest.ScrollUp LogViewTest.BatchedRedraws MemoTest.ReuseElement MemoTest.FocusChange MemoTest.Invalidate MemoTest.InvalidatedByEvent MenuTest.RemoveEntries MenuTest.DirectionDown MenuTest.DirectionsUp MenuTest.DirectionsRight MenuTest.DirectionsLeft MenuTest.Virtualized MenuTest.VirtualizedCallbacks MenuTest.VirtualizedSameAsDefault MenuTest.VirtualizedMouse MenuTest.Keymap ModalTest.Basic ModalTest.Snapshot ModalTest.Dim RadioboxTest.NavigationArrow RadioboxTest.NavigationArrowVim RadioboxTest.NavigationTab RadioboxTest.NavigationHome RadioboxTest.NavigationPageDown RadioboxTest.NavigationPageUp RadioboxTest.NavigationEnd RadioboxTest.EventSpace RadioboxTest.RemoveEntries Receiver.Basic Receiver.BasicWithThread Receiver.ReceiveAll Receiver.NotDefaultConstructible Receiver.ManySenders Receiver.DropOldest Receiver.DropNewest Receiver.Block RecyclerTest.OnlyVisibleRowsAreBuilt RecyclerTest.SelectionScrolls RecyclerTest.FocusFollowsTheRow RecyclerTest.Empty RenderWhenVisibleTest.CullHiddenRows RenderWhenVisibleTest.PlaceholderComingIntoView ResizableSplit.BasicLeft ResizableSplit.BasicLeftWithCustomSeparator ResizableSplit.BasicRight ResizableSplit.BasicRightWithCustomSeparator ResizableSplit.BasicTop ResizableSplit.BasicTopWithCustomSeparator ResizableSplit.BasicBottom ResizableSplit.BasicBottomWithCustomSeparator ResizableSplit.DragReusesPanes RowIndexTest.FilterAndSort RowIndexTest.Menu ScreenInteractive.Signal_SIGTERM ScreenInteractive.Signal_SIGSEGV ScreenInteractive.Signal_SIGINT ScreenInteractive.Signal_SIGILL ScreenInteractive.Signal_SIGABRT ScreenInteractive.Signal_SIGFPE ScreenInteractive.PostEventToNonActive ScreenInteractive.PostTaskToNonActive ScreenInteractive.CoalesceTasks ScreenInteractive.PostEventToTarget ScreenInteractive.LimitFrameRate ScreenInteractive.TerminalSizeCachedUntilResize ScreenInteractive.ExternalEventLoop ScreenInteractive.ExternalEventLoopResize ScreenInteractive.ReadInputOnLoopThread ScreenInteractive.ThreadedOutput ScreenInteractive.SynchronizedOutput ScreenInteractive.DropStaleFrames ScreenInteractive.HeadlessInputOutput ScreenInteractive.HeadlessEscapeTimeout ScreenInteractive.FrameStats ScreenInteractive.ProbeTerminal ScreenInteractive.ExportMetrics ScreenInteractive.NodeProfiler ScreenInteractive.ThrottleMouseMotionFrameRate ScreenInteractive.CapturedMouseDrag ScreenInteractive.RunOnceDeadline ScreenInteractive.TaskLanes ScreenInteractive.ExportCells ScreenInteractive.CursorPositionRequests ScreenInteractive.Commit ScreenInteractive.Timers ScreenInteractive.TimersWakeUpTheLoop SessionRecording.Encoding SessionRecording.Malformed SessionRecording.RecordAndReplay SharedStateTest.UpdateBeforeLoop SharedStateTest.BatchedUpdates SliderTest.Right SliderTest.Left SliderTest.Down SliderTest.Up SliderTest.Focus Event.Character Event.EscapeKeyWithoutWaiting Event.EscapeKeyNotEnoughWait Event.EscapeKeyEnoughWait Event.MouseLeftClickPressed Event.MouseLeftMoved Event.MouseLeftClickReleased Event.MouseReporting Event.MouseMiddleClick Event.MouseRightClick Event.UTF8 Event.NewLine Event.Control Event.Special Event.DeviceControlString Event.ModeReport Event.TerminalReport Event.Equality Event.BracketedPaste Event.AddString TextBufferTest.Empty TextBufferTest.Lines TextBufferTest.Insert TextBufferTest.Erase TextBufferTest.ManyLines ToggleTest.leftRightArrow ToggleTest.Tab ToggleTest.OnChange ToggleTest.OnEnter ToggleTest.RemoveEntries WindowTest.Composited BlinkTest.Basic BoldTest.Basic BorderTest.Default BorderTest.Light BorderTest.Double BorderTest.Rounded BorderTest.Heavy BorderTest.Empty BorderTest.Styled BorderTest.WithPixel BorderTest.Window CachedTest.ReusePixels CachedTest.Resized CanvasTest.GoldPoint CanvasTest.GoldPointColor CanvasTest.GoldBlock CanvasTest.GoldBlockColor CanvasTest.GoldText CanvasTest.GetPixel CanvasTest.BrailleGlyphs CanvasTest.DrawImage CanvasTest.DrawPointScatterParallel CanvasTest.ManyStyles CanvasTest.DrawPointPolyline CanvasTest.DrawPointPolylineClipped CanvasTest.DrawPointScatter CanvasTest.DrawBlockPolyline CanvasTest.DrawPointPolylineStyleOncePerStyle CanvasTest.DrawShapeStyleOncePerStyle CanvasTest.StyleRectangle CanvasTest.Clear CanvasTest.ClearRegion CanvasTest.Scroll CanvasTest.ScrollingChart ColorTest.Foreground ColorTest.Background ColorTest.API_default ColorTest.API_builder ColorTest.API_constructor_bicolor ColorTest.API_constructor_bicolor_angle ColorTest.GradientForeground ColorTest.GradientBackground ColorTest.GradientEveryCell ColorTest.GradientDiagonal ColorTest.GradientSingleCell ColorTest.PrintTransparent ColorTest.PrintColor16 ColorTest.PrintColor256 ColorTest.PrintTrueCOlor ColorTest.FallbackTo256 ColorTest.FallbackTo256Closest ColorTest.FallbackTo16 ColorTest.Downsample ColorTest.Litterals ColorTest.Interpolate ColorTest.InterpolateBatch ColorTest.HSV ColorTest.PrintAppend DataTableTest.Basic DataTableTest.AlignAndWidth DataTableTest.Formatter DataTableTest.OnlyVisibleRowsAreFormatted DBoxTest.Basic DBoxTest.Occluded DBoxTest.PartiallyOccluded DimTest.Basic FlexboxHelperTest.BasicRow FlexboxHelperTest.BasicColumn FlexboxHelperTest.BasicRowInversed FlexboxHelperTest.BasicColumnInversed FlexboxHelperTest.MixedFastAndSlowLines FlexboxTest.BasicRow FlexboxTest.BasicRowInversed FlexboxTest.BasicColumn FlexboxTest.BasicColumnInversed FlexboxTest.JustifyContentCenter FlexboxTest.JustifyContentSpaceBetween FlexboxTest.JustifyContentSpaceAround FlexboxTest.JustifyContentSpaceEvenly FlexboxTest.AlignItemsFlexEnd FlexboxTest.AlignItemsCenter FlexboxTest.AlignContentFlexEnd FlexboxTest.AlignContentCenter FlexboxTest.AlignContentSpaceBetween FlexboxTest.AlignContentSpaceAround FlexboxTest.AlignContentSpaceEvenly FlexboxTest.GapX FlexboxTest.GapX2 FlexboxTest.GapY FlexboxTest.Focus FrameTest.CullRowsOutsideOfTheFrame FrameTest.CullColumnsOutsideOfTheFrame FrameTest.ReflectCulledRow GaugeTest.ZeroHorizontal GaugeTest.HalfHorizontal GaugeTest.OneHorizontal GaugeTest.ZeroVertical GaugeTest.HalfVertical GaugeTest.OneVertical GaugeTest.Gauges GaugeTest.GaugesWithoutLabels GaugeTest.GaugesMatchGauge GaugeTest.GaugesUp GaugeTest.GaugesOnlyDrawTheVisibleRows GridboxTest.UnfilledRectangular GridboxTest.DifferentSize GridboxTest.CenterFlex GridboxTest.CenterFlexCross GridboxTest.CenterShrink GridboxTest.CenterShrinkColumn GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex GridboxTest.Vertical_NoFlex_NoFlex_NoFlex GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink GridboxTest.MissingCells GridboxTest.Focus GridboxTest.FocusLeftmostColumn HBoxTest.NoFlex_NoFlex_NoFlex HBoxTest.FlexGrow_NoFlex_NoFlex HBoxTest.NoFlex_FlexGrow_NoFlex HBoxTest.NoFlex_NoFlex_FlexGrow HBoxTest.FlexGrow_NoFlex_FlexGrow HBoxTest.FlexGrow_FlexGrow_FlexGrow HBoxTest.FlexShrink_NoFlex_NoFlex HBoxTest.NoFlex_FlexShrink_NoFlex HBoxTest.NoFlex_NoFlex_FlexShrink HBoxTest.FlexShrink_NoFlex_FlexShrink HBoxTest.FlexShrink_FlexShrink_FlexShrink HBoxTest.FlexGrow_NoFlex_FlewShrink HBoxTest.ManyChildren LayoutCacheTest.FitThenRender LayoutCacheTest.OtherBox LayoutCacheTest.OtherElement LayoutCacheTest.Paragraph LazyTest.OnlyVisibleElementsAreBuilt LazyTest.HintedSize NodeArenaTest.Render NodeArenaTest.NoArena NodeArenaTest.MemoryReused NodeArenaTest.ElementOutliveScope NodeArenaTest.ElementOutliveArena NodeProfilerTest.ByType NodeProfilerTest.Label NodeProfilerTest.Frames NodeProfilerTest.Arena NodeProfilerTest.ToString NodeTest.RenderTiled NodeTest.OnlyUnconvergedSubtreesIterate NodeTest.ReflectInCustomNode NodeTest.MemoryUsage ParagraphTest.Basic ParagraphTest.View ParagraphTest.SameAsFlexbox ParallelTest.SameAsSequential ParallelTest.Nested ParallelTest.Overlapping ParallelTest.Cursor PlotTest.YRange PlotTest.ClipLine PlotTest.Sparse PlotTest.Dense RetainedTest.ReusePixels RetainedTest.Moved RetainedTest.BackgroundChanged RetainedTest.ReuseLayout RetainedTest.FlexboxResized ScrollIndicator.BasicVertical ScrollIndicator.VerticalColorable ScrollIndicator.VerticalBackgroundColorable ScrollIndicator.VerticalFullColorable ScrollIndicator.BasicHorizontal ScrollIndicator.HorizontalColorable ScrollIndicator.HorizontalBackgroundColorable ScrollIndicator.HorizontalFullColorable ScrollIndicator.HorizontalFlexbox SeparatorTest.Default SeparatorTest.Light SeparatorTest.Dashed SeparatorTest.Double SeparatorTest.Heavy SeparatorTest.Empty SeparatorTest.Styled SeparatorTest.WithPixel SizeTest.Equal SizeTest.FixedSize SpinnerTest.Spinner1 SpinnerTest.Spinner2 SpinnerTest.Spinner3 SpinnerTest.Spinner4 SpinnerTest.MultipleLines SpinnerTest.Clipped StyleTest.SingleNode StyleTest.InnerColorWins StyleTest.InvertedTwice StyleTest.SharedElement StyleTest.Spec TableTest.Empty TableTest.Basic TableTest.SeparatorVerticalEmpty TableTest.SeparatorHorizontalEmpty TableTest.SeparatorHorizontalLight TableTest.SeparatorVerticalLight TableTest.SeparatorLight TableTest.SeparatorVerticalHorizontalLight TableTest.SeparatorHorizontalVerticalLight TableTest.BorderLight TableTest.BorderSeparatorLight TableTest.SelectRow TableTest.SelectRowNegative TableTest.SelectColumn TableTest.SelectColumnNegative TableTest.CrossingBorders TableTest.CrossingBordersLightAndDouble TableTest.SelectColumns TableTest.SelectRows TableTest.SelectRectangle TableTest.SelectColumnsNegative TableTest.SelectInverted TableTest.ColumnFlex TableTest.ColumnFlexCenter TableTest.ColumnCenter TableTest.ColumnFlexTwo TableTest.RowFlex TableTest.RowFlexTwo TableTest.Merge TableTest.Virtual TableTest.VirtualWidths TableTest.Style TableTest.StyleNodes TableTest.BorderNodes TextTest.ScreenHeightSmaller TextTest.ScreenSmaller TextTest.ScreenFit TextTest.ScreenBigger TextTest.ScreenBigger2 TextTest.MaskedText TextTest.MaskedTextClipped TextTest.MeasuredTextIntern TextTest.TextLines TextTest.TextLinesFrame TimeSeriesTest.Empty TimeSeriesTest.OneSamplePerColumn TimeSeriesTest.PartiallyFilled TimeSeriesTest.RingBuffer TimeSeriesTest.Clamped TimeSeriesTest.Decimated TimeSeriesTest.PushFromThreads UnderlinedTest.Basic VBoxText.NoFlex_NoFlex_NoFlex VBoxText.FlexGrow_NoFlex_NoFlex VBoxText.NoFlex_FlexGrow_NoFlex VBoxText.NoFlex_NoFlex_FlexGrow VBoxText.FlexGrow_NoFlex_FlexGrow VBoxText.FlexGrow_FlexGrow_FlexGrow VBoxText.FlexShrink_NoFlex_NoFlex VBoxText.NoFlex_FlexShrink_NoFlex VBoxText.NoFlex_NoFlex_FlexShrink VBoxText.FlexShrink_NoFlex_FlexShrink VBoxText.FlexShrink_FlexShrink_FlexShrink VBoxText.FlexGrow_NoFlex_FlewShrink VirtualListTest.Basic VirtualListTest.OnlyVisibleRowsAreBuilt VirtualListTest.RowsAreClipped VirtualListTest.Empty CellBufferTest.Cells CellBufferTest.RowFrames CellBufferTest.Cursor CompactPixelTest.Size CompactPixelTest.Default CompactPixelTest.RoundTrip CompactPixelTest.Interned FrameRecorderTest.Seek FrameRecorderTest.OnlyChangedCells FrameRecorderTest.Resize FrameRecorderTest.Hyperlink FrameRecorderTest.Truncated ScreenEncoderTest.Diff ScreenEncoderTest.ColorSupport ScreenEncoderTest.Dimensions ScreenEncoderTest.ScrollRegions ScreenEncoderTest.Hyperlink ScreenTest.ApplyShader ScreenTest.ToStringAppend ScreenTest.ToStringSink ScreenTest.ToStringLarge ScreenTest.WriteTo ScreenTest.ToStringDiffAppend ScreenTest.ToStringDiffIdentical ScreenTest.ToStringDiffWrittenRows ScreenTest.ToStringDiffSingleCell ScreenTest.ToStringDiffMergeSmallGaps ScreenTest.ToStringDiffAbsoluteColumn ScreenTest.ToStringDiffScroll ScreenTest.ResetPosition ScreenTest.ToStringDiffStyle ScreenTest.ToStringDiffDifferentDimensions ScreenTest.ToStringManyFullWidth ScreenTest.Clear ScreenTest.ForEachPixel ScreenTest.ApplyStyle ScreenTest.ToStringColorSupport ScreenTest.ToStringCompression ScreenTest.ToStringDiffCompression ScreenTest.MemoryUsage ScreenTest.Resize StringTest.to_string StringTest.to_wstring TraceTest.Recording TraceTest.StartDiscardsPreviousEvents)
@@ -0,0 +1,182 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/ftxui-config.cmake.in"
+  "/root/repo/cmake/ftxui_benchmark.cmake"
+  "/root/repo/cmake/ftxui_coverage.cmake"
+  "/root/repo/cmake/ftxui_export.cmake"
+  "/root/repo/cmake/ftxui_find_google_benchmark.cmake"
+  "/root/repo/cmake/ftxui_find_google_test.cmake"
+  "/root/repo/cmake/ftxui_fuzzer.cmake"
+  "/root/repo/cmake/ftxui_install.cmake"
+  "/root/repo/cmake/ftxui_message.cmake"
+  "/root/repo/cmake/ftxui_package.cmake"
+  "/root/repo/cmake/ftxui_set_options.cmake"
+  "/root/repo/cmake/ftxui_test.cmake"
+  "/root/repo/cmake/iwyu.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/component/CMakeLists.txt"
+  "/root/repo/examples/dom/CMakeLists.txt"
+  "/root/repo/ftxui.pc.in"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "cmake/ftxui-config.cmake"
+  "cmake/ftxui-config-version.cmake"
+  "ftxui.pc"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/component/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dom/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/screen.dir/DependInfo.cmake"
+  "CMakeFiles/dom.dir/DependInfo.cmake"
+  "CMakeFiles/component.dir/DependInfo.cmake"
+  "CMakeFiles/ftxui-tests.dir/DependInfo.cmake"
+  "CMakeFiles/ftxui-allocation-tests.dir/DependInfo.cmake"
+  "CMakeFiles/ftxui-benchmark.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_button.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_button_animated.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_button_in_frame.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_button_style.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_canvas_animated.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_checkbox.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_checkbox_in_frame.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_collapsible.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_composition.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_custom_loop.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_dropdown.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_dropdown_custom.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_flexbox_gallery.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_focus.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_focus_cursor.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_gallery.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_homescreen.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_input.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_input_style.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_linear_gradient_gallery.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_maybe.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu2.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu_entries.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu_entries_animated.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu_in_frame.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu_in_frame_horizontal.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu_multiple.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu_style.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_menu_underline_animated_gallery.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_modal_dialog.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_modal_dialog_custom.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_nested_screen.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_print_key_press.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_radiobox.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_radiobox_in_frame.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_renderer.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_resizable_split.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_slider.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_slider_direction.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_slider_rgb.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_tab_horizontal.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_tab_vertical.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_textarea.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_toggle.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_window.dir/DependInfo.cmake"
+  "examples/component/CMakeFiles/ftxui_example_with_restored_io.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_border.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_border_colored.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_border_style.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_canvas.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_color_gallery.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_color_info_palette256.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_color_truecolor_HSV.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_color_truecolor_RGB.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_dbox.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_gauge.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_gauge_direction.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_graph.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_gridbox.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_hflow.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_html_like.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_linear_gradient.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_package_manager.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_paragraph.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_separator.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_separator_style.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_size.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_spinner.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_blink.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_bold.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_color.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_dim.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_gallery.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_hyperlink.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_inverted.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_strikethrough.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_underlined.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_style_underlined_double.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_table.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_vbox_hbox.dir/DependInfo.cmake"
+  "examples/dom/CMakeFiles/ftxui_example_vflow.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/screen/box.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o.d"
+  "/root/repo/src/ftxui/screen/cell_buffer.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/cell_buffer.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/cell_buffer.cpp.o.d"
+  "/root/repo/src/ftxui/screen/color.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o.d"
+  "/root/repo/src/ftxui/screen/color_info.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o.d"
+  "/root/repo/src/ftxui/screen/compact_pixel.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/compact_pixel.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/compact_pixel.cpp.o.d"
+  "/root/repo/src/ftxui/screen/frame_recorder.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/frame_recorder.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/frame_recorder.cpp.o.d"
+  "/root/repo/src/ftxui/screen/screen.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o.d"
+  "/root/repo/src/ftxui/screen/screen_encoder.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/screen_encoder.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/screen_encoder.cpp.o.d"
+  "/root/repo/src/ftxui/screen/string.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o.d"
+  "/root/repo/src/ftxui/screen/terminal.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o.d"
+  "/root/repo/src/ftxui/screen/thread_pool.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/thread_pool.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/thread_pool.cpp.o.d"
+  "/root/repo/src/ftxui/screen/trace.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/trace.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/trace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_checkbox.dir/checkbox.cpp.o"
+  "CMakeFiles/ftxui_example_checkbox.dir/checkbox.cpp.o.d"
+  "ftxui_example_checkbox"
+  "ftxui_example_checkbox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_checkbox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
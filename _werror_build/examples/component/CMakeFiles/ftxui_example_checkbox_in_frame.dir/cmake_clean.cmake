@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_checkbox_in_frame.dir/checkbox_in_frame.cpp.o"
+  "CMakeFiles/ftxui_example_checkbox_in_frame.dir/checkbox_in_frame.cpp.o.d"
+  "ftxui_example_checkbox_in_frame"
+  "ftxui_example_checkbox_in_frame.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_checkbox_in_frame.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
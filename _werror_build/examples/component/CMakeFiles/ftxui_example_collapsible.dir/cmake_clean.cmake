@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_collapsible.dir/collapsible.cpp.o"
+  "CMakeFiles/ftxui_example_collapsible.dir/collapsible.cpp.o.d"
+  "ftxui_example_collapsible"
+  "ftxui_example_collapsible.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_collapsible.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
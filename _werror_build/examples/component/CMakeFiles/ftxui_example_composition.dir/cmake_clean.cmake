@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_composition.dir/composition.cpp.o"
+  "CMakeFiles/ftxui_example_composition.dir/composition.cpp.o.d"
+  "ftxui_example_composition"
+  "ftxui_example_composition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_composition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
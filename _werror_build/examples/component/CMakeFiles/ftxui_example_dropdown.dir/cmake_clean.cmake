@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_dropdown.dir/dropdown.cpp.o"
+  "CMakeFiles/ftxui_example_dropdown.dir/dropdown.cpp.o.d"
+  "ftxui_example_dropdown"
+  "ftxui_example_dropdown.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_dropdown.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
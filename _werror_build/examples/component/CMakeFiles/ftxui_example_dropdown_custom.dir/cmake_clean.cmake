@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_dropdown_custom.dir/dropdown_custom.cpp.o"
+  "CMakeFiles/ftxui_example_dropdown_custom.dir/dropdown_custom.cpp.o.d"
+  "ftxui_example_dropdown_custom"
+  "ftxui_example_dropdown_custom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_dropdown_custom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
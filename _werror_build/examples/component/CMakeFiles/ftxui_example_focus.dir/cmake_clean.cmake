@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_focus.dir/focus.cpp.o"
+  "CMakeFiles/ftxui_example_focus.dir/focus.cpp.o.d"
+  "ftxui_example_focus"
+  "ftxui_example_focus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_focus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
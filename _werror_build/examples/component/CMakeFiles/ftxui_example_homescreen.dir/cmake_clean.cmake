@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_homescreen.dir/homescreen.cpp.o"
+  "CMakeFiles/ftxui_example_homescreen.dir/homescreen.cpp.o.d"
+  "ftxui_example_homescreen"
+  "ftxui_example_homescreen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_homescreen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
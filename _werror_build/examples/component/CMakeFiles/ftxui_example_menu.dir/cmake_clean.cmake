@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_menu.dir/menu.cpp.o"
+  "CMakeFiles/ftxui_example_menu.dir/menu.cpp.o.d"
+  "ftxui_example_menu"
+  "ftxui_example_menu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_menu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
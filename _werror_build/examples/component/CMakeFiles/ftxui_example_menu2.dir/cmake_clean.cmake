@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_menu2.dir/menu2.cpp.o"
+  "CMakeFiles/ftxui_example_menu2.dir/menu2.cpp.o.d"
+  "ftxui_example_menu2"
+  "ftxui_example_menu2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_menu2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_menu_entries.dir/menu_entries.cpp.o"
+  "CMakeFiles/ftxui_example_menu_entries.dir/menu_entries.cpp.o.d"
+  "ftxui_example_menu_entries"
+  "ftxui_example_menu_entries.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_menu_entries.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
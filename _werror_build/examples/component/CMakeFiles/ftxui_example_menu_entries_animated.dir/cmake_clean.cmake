@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_menu_entries_animated.dir/menu_entries_animated.cpp.o"
+  "CMakeFiles/ftxui_example_menu_entries_animated.dir/menu_entries_animated.cpp.o.d"
+  "ftxui_example_menu_entries_animated"
+  "ftxui_example_menu_entries_animated.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_menu_entries_animated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
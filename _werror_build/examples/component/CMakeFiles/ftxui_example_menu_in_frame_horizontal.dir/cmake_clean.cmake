@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_menu_in_frame_horizontal.dir/menu_in_frame_horizontal.cpp.o"
+  "CMakeFiles/ftxui_example_menu_in_frame_horizontal.dir/menu_in_frame_horizontal.cpp.o.d"
+  "ftxui_example_menu_in_frame_horizontal"
+  "ftxui_example_menu_in_frame_horizontal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_menu_in_frame_horizontal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
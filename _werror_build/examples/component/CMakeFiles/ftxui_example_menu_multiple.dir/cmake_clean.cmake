@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_menu_multiple.dir/menu_multiple.cpp.o"
+  "CMakeFiles/ftxui_example_menu_multiple.dir/menu_multiple.cpp.o.d"
+  "ftxui_example_menu_multiple"
+  "ftxui_example_menu_multiple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_menu_multiple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
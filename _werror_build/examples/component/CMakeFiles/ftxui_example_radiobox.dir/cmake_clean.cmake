@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_radiobox.dir/radiobox.cpp.o"
+  "CMakeFiles/ftxui_example_radiobox.dir/radiobox.cpp.o.d"
+  "ftxui_example_radiobox"
+  "ftxui_example_radiobox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_radiobox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
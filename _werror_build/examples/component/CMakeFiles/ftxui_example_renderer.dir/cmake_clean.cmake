@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_renderer.dir/renderer.cpp.o"
+  "CMakeFiles/ftxui_example_renderer.dir/renderer.cpp.o.d"
+  "ftxui_example_renderer"
+  "ftxui_example_renderer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_renderer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
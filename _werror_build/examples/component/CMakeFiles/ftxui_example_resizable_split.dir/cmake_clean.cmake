@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_resizable_split.dir/resizable_split.cpp.o"
+  "CMakeFiles/ftxui_example_resizable_split.dir/resizable_split.cpp.o.d"
+  "ftxui_example_resizable_split"
+  "ftxui_example_resizable_split.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_resizable_split.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_slider.dir/slider.cpp.o"
+  "CMakeFiles/ftxui_example_slider.dir/slider.cpp.o.d"
+  "ftxui_example_slider"
+  "ftxui_example_slider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_slider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_slider_direction.dir/slider_direction.cpp.o"
+  "CMakeFiles/ftxui_example_slider_direction.dir/slider_direction.cpp.o.d"
+  "ftxui_example_slider_direction"
+  "ftxui_example_slider_direction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_slider_direction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_slider_rgb.dir/slider_rgb.cpp.o"
+  "CMakeFiles/ftxui_example_slider_rgb.dir/slider_rgb.cpp.o.d"
+  "ftxui_example_slider_rgb"
+  "ftxui_example_slider_rgb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_slider_rgb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_tab_vertical.dir/tab_vertical.cpp.o"
+  "CMakeFiles/ftxui_example_tab_vertical.dir/tab_vertical.cpp.o.d"
+  "ftxui_example_tab_vertical"
+  "ftxui_example_tab_vertical.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_tab_vertical.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_textarea.dir/textarea.cpp.o"
+  "CMakeFiles/ftxui_example_textarea.dir/textarea.cpp.o.d"
+  "ftxui_example_textarea"
+  "ftxui_example_textarea.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_textarea.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
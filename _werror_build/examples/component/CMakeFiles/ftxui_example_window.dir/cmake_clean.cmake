@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_window.dir/window.cpp.o"
+  "CMakeFiles/ftxui_example_window.dir/window.cpp.o.d"
+  "ftxui_example_window"
+  "ftxui_example_window.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_window.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_border_colored.dir/border_colored.cpp.o"
+  "CMakeFiles/ftxui_example_border_colored.dir/border_colored.cpp.o.d"
+  "ftxui_example_border_colored"
+  "ftxui_example_border_colored.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_border_colored.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_color_truecolor_HSV.dir/color_truecolor_HSV.cpp.o"
+  "CMakeFiles/ftxui_example_color_truecolor_HSV.dir/color_truecolor_HSV.cpp.o.d"
+  "ftxui_example_color_truecolor_HSV"
+  "ftxui_example_color_truecolor_HSV.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_color_truecolor_HSV.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_color_truecolor_RGB.dir/color_truecolor_RGB.cpp.o"
+  "CMakeFiles/ftxui_example_color_truecolor_RGB.dir/color_truecolor_RGB.cpp.o.d"
+  "ftxui_example_color_truecolor_RGB"
+  "ftxui_example_color_truecolor_RGB.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_color_truecolor_RGB.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_gauge_direction.dir/gauge_direction.cpp.o"
+  "CMakeFiles/ftxui_example_gauge_direction.dir/gauge_direction.cpp.o.d"
+  "ftxui_example_gauge_direction"
+  "ftxui_example_gauge_direction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_gauge_direction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
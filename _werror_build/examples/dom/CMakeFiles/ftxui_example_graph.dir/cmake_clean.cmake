@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_graph.dir/graph.cpp.o"
+  "CMakeFiles/ftxui_example_graph.dir/graph.cpp.o.d"
+  "ftxui_example_graph"
+  "ftxui_example_graph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_linear_gradient.dir/linear_gradient.cpp.o"
+  "CMakeFiles/ftxui_example_linear_gradient.dir/linear_gradient.cpp.o.d"
+  "ftxui_example_linear_gradient"
+  "ftxui_example_linear_gradient.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_linear_gradient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
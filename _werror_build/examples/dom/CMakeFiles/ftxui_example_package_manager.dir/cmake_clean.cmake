@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_package_manager.dir/package_manager.cpp.o"
+  "CMakeFiles/ftxui_example_package_manager.dir/package_manager.cpp.o.d"
+  "ftxui_example_package_manager"
+  "ftxui_example_package_manager.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_package_manager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_separator.dir/separator.cpp.o"
+  "CMakeFiles/ftxui_example_separator.dir/separator.cpp.o.d"
+  "ftxui_example_separator"
+  "ftxui_example_separator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_separator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
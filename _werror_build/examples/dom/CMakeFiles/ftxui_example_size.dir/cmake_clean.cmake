@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_size.dir/size.cpp.o"
+  "CMakeFiles/ftxui_example_size.dir/size.cpp.o.d"
+  "ftxui_example_size"
+  "ftxui_example_size.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_size.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
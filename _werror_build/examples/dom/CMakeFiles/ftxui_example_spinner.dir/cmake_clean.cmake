@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_spinner.dir/spinner.cpp.o"
+  "CMakeFiles/ftxui_example_spinner.dir/spinner.cpp.o.d"
+  "ftxui_example_spinner"
+  "ftxui_example_spinner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_spinner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_hyperlink.dir/style_hyperlink.cpp.o"
+  "CMakeFiles/ftxui_example_style_hyperlink.dir/style_hyperlink.cpp.o.d"
+  "ftxui_example_style_hyperlink"
+  "ftxui_example_style_hyperlink.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_hyperlink.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_inverted.dir/style_inverted.cpp.o"
+  "CMakeFiles/ftxui_example_style_inverted.dir/style_inverted.cpp.o.d"
+  "ftxui_example_style_inverted"
+  "ftxui_example_style_inverted.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_inverted.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_underlined.dir/style_underlined.cpp.o"
+  "CMakeFiles/ftxui_example_style_underlined.dir/style_underlined.cpp.o.d"
+  "ftxui_example_style_underlined"
+  "ftxui_example_style_underlined.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_underlined.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_table.dir/table.cpp.o"
+  "CMakeFiles/ftxui_example_table.dir/table.cpp.o.d"
+  "ftxui_example_table"
+  "ftxui_example_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_vflow.dir/vflow.cpp.o"
+  "CMakeFiles/ftxui_example_vflow.dir/vflow.cpp.o.d"
+  "ftxui_example_vflow"
+  "ftxui_example_vflow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_vflow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -19,3 +19,4 @@ endfunction(fuzz)
 
 fuzz(terminal_input_parser_test_fuzzer)
 fuzz(component_fuzzer)
+fuzz(performance_fuzzer)
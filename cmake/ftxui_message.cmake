@@ -14,4 +14,9 @@ ftxui_message("│ FTXUI_BUILD_TESTS_FUZZER : ${FTXUI_BUILD_TESTS_FUZZER}")
 ftxui_message("│ FTXUI_ENABLE_COVERAGE    : ${FTXUI_ENABLE_COVERAGE}")
 ftxui_message("│ FTXUI_DEV_WARNINGS       : ${FTXUI_DEV_WARNINGS}")
 ftxui_message("│ FTXUI_CLANG_TIDY         : ${FTXUI_CLANG_TIDY}")
+ftxui_message("│ FTXUI_ENABLE_ANIMATIONS  : ${FTXUI_ENABLE_ANIMATIONS}")
+ftxui_message("│ FTXUI_ENABLE_MOUSE       : ${FTXUI_ENABLE_MOUSE}")
+ftxui_message("│ FTXUI_ENABLE_HYPERLINKS  : ${FTXUI_ENABLE_HYPERLINKS}")
+ftxui_message("│ FTXUI_ENABLE_UNICODE_TABLES : ${FTXUI_ENABLE_UNICODE_TABLES}")
+ftxui_message("│ FTXUI_ENABLE_THREADS     : ${FTXUI_ENABLE_THREADS}")
 ftxui_message("└─────────────────────────────────────")
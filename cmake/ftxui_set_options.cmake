@@ -95,6 +95,31 @@ function(ftxui_set_options library)
     target_compile_definitions(${library}
       PRIVATE "FTXUI_MICROSOFT_TERMINAL_FALLBACK")
   endif()
+
+  if (FTXUI_ENABLE_TRACING)
+    target_compile_definitions(${library}
+      PRIVATE "FTXUI_ENABLE_TRACING")
+  endif()
+
+  if (NOT FTXUI_ENABLE_ANIMATIONS)
+    target_compile_definitions(${library} PRIVATE "FTXUI_NO_ANIMATIONS")
+  endif()
+
+  if (NOT FTXUI_ENABLE_MOUSE)
+    target_compile_definitions(${library} PRIVATE "FTXUI_NO_MOUSE")
+  endif()
+
+  if (NOT FTXUI_ENABLE_HYPERLINKS)
+    target_compile_definitions(${library} PRIVATE "FTXUI_NO_HYPERLINKS")
+  endif()
+
+  if (NOT FTXUI_ENABLE_UNICODE_TABLES)
+    target_compile_definitions(${library} PRIVATE "FTXUI_NO_UNICODE_TABLES")
+  endif()
+
+  if (NOT FTXUI_ENABLE_THREADS)
+    target_compile_definitions(${library} PRIVATE "FTXUI_NO_THREADS")
+  endif()
 endfunction()
 
 if (EMSCRIPTEN)
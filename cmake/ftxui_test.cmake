@@ -8,45 +8,84 @@ include(cmake/ftxui_find_google_test.cmake)
 
 add_executable(ftxui-tests
   src/ftxui/component/animation_test.cpp
+  src/ftxui/component/background_renderer_test.cpp
   src/ftxui/component/button_test.cpp
+  src/ftxui/component/checklist_test.cpp
   src/ftxui/component/collapsible_test.cpp
+  src/ftxui/component/component_profiler_test.cpp
   src/ftxui/component/component_test.cpp
   src/ftxui/component/component_test.cpp
   src/ftxui/component/container_test.cpp
+  src/ftxui/component/coroutine_test.cpp
+  src/ftxui/component/dropdown_test.cpp
+  src/ftxui/component/entry_test.cpp
+  src/ftxui/component/file_viewer_test.cpp
+  src/ftxui/component/frame_stats_overlay_test.cpp
   src/ftxui/component/hoverable_test.cpp
   src/ftxui/component/input_test.cpp
+  src/ftxui/component/log_view_test.cpp
+  src/ftxui/component/memo_test.cpp
   src/ftxui/component/menu_test.cpp
   src/ftxui/component/modal_test.cpp
   src/ftxui/component/radiobox_test.cpp
   src/ftxui/component/receiver_test.cpp
+  src/ftxui/component/recycler_test.cpp
+  src/ftxui/component/render_when_visible_test.cpp
   src/ftxui/component/resizable_split_test.cpp
+  src/ftxui/component/row_index_test.cpp
   src/ftxui/component/screen_interactive_test.cpp
+  src/ftxui/component/session_recording_test.cpp
+  src/ftxui/component/shared_state_test.cpp
   src/ftxui/component/slider_test.cpp
   src/ftxui/component/terminal_input_parser_test.cpp
+  src/ftxui/component/text_buffer_test.cpp
   src/ftxui/component/toggle_test.cpp
+  src/ftxui/component/window_test.cpp
   src/ftxui/dom/blink_test.cpp
   src/ftxui/dom/bold_test.cpp
   src/ftxui/dom/border_test.cpp
+  src/ftxui/dom/cached_test.cpp
   src/ftxui/dom/canvas_test.cpp
   src/ftxui/dom/color_test.cpp
+  src/ftxui/dom/data_table_test.cpp
   src/ftxui/dom/dbox_test.cpp
   src/ftxui/dom/dim_test.cpp
   src/ftxui/dom/flexbox_helper_test.cpp
   src/ftxui/dom/flexbox_test.cpp
+  src/ftxui/dom/frame_test.cpp
   src/ftxui/dom/gauge_test.cpp
   src/ftxui/dom/gridbox_test.cpp
   src/ftxui/dom/hbox_test.cpp
   src/ftxui/dom/hyperlink_test.cpp
+  src/ftxui/dom/layout_cache_test.cpp
+  src/ftxui/dom/lazy_test.cpp
   src/ftxui/dom/linear_gradient_test.cpp
+  src/ftxui/dom/node_arena_test.cpp
+  src/ftxui/dom/node_profiler_test.cpp
+  src/ftxui/dom/node_test.cpp
+  src/ftxui/dom/paragraph_test.cpp
+  src/ftxui/dom/parallel_test.cpp
+  src/ftxui/dom/plot_test.cpp
+  src/ftxui/dom/retained_test.cpp
   src/ftxui/dom/scroll_indicator_test.cpp
   src/ftxui/dom/separator_test.cpp
+  src/ftxui/dom/size_test.cpp
   src/ftxui/dom/spinner_test.cpp
+  src/ftxui/dom/style_test.cpp
   src/ftxui/dom/table_test.cpp
   src/ftxui/dom/text_test.cpp
+  src/ftxui/dom/time_series_test.cpp
   src/ftxui/dom/underlined_test.cpp
   src/ftxui/dom/vbox_test.cpp
+  src/ftxui/dom/virtual_list_test.cpp
+  src/ftxui/screen/cell_buffer_test.cpp
   src/ftxui/screen/color_test.cpp
+  src/ftxui/screen/compact_pixel_test.cpp
+  src/ftxui/screen/frame_recorder_test.cpp
+  src/ftxui/screen/screen_encoder_test.cpp
+  src/ftxui/screen/screen_test.cpp
   src/ftxui/screen/string_test.cpp
+  src/ftxui/screen/trace_test.cpp
 )
 
 target_link_libraries(ftxui-tests
@@ -69,10 +108,53 @@ if (FTXUI_MICROSOFT_TERMINAL_FALLBACK)
     PRIVATE "FTXUI_MICROSOFT_TERMINAL_FALLBACK")
 endif()
 
+if (FTXUI_ENABLE_TRACING)
+  target_compile_definitions(ftxui-tests
+    PRIVATE "FTXUI_ENABLE_TRACING")
+endif()
+
+# The allocation tests replace the global operator new. They are built apart
+# from the other tests.
+add_executable(ftxui-allocation-tests
+  src/ftxui/component/allocation_test.cpp
+  src/ftxui/dom/allocation_test.cpp
+)
+target_link_libraries(ftxui-allocation-tests
+  PRIVATE component
+  PRIVATE GTest::gtest
+  PRIVATE GTest::gtest_main
+)
+target_include_directories(ftxui-allocation-tests
+  PRIVATE src
+)
+target_compile_features(ftxui-allocation-tests PRIVATE cxx_std_20)
+
+# The tests of the features compiled out are skipped.
+foreach(target ftxui-tests ftxui-allocation-tests)
+  if (NOT FTXUI_ENABLE_ANIMATIONS)
+    target_compile_definitions(${target} PRIVATE "FTXUI_NO_ANIMATIONS")
+  endif()
+  if (NOT FTXUI_ENABLE_MOUSE)
+    target_compile_definitions(${target} PRIVATE "FTXUI_NO_MOUSE")
+  endif()
+  if (NOT FTXUI_ENABLE_HYPERLINKS)
+    target_compile_definitions(${target} PRIVATE "FTXUI_NO_HYPERLINKS")
+  endif()
+  if (NOT FTXUI_ENABLE_UNICODE_TABLES)
+    target_compile_definitions(${target} PRIVATE "FTXUI_NO_UNICODE_TABLES")
+  endif()
+  if (NOT FTXUI_ENABLE_THREADS)
+    target_compile_definitions(${target} PRIVATE "FTXUI_NO_THREADS")
+  endif()
+endforeach()
+
 include(GoogleTest)
 gtest_discover_tests(ftxui-tests
   DISCOVERY_TIMEOUT 600
 )
+gtest_discover_tests(ftxui-allocation-tests
+  DISCOVERY_TIMEOUT 600
+)
 
 #set(CMAKE_CTEST_ARGUMENTS "--rerun-failed --output-on-failure")
 #set_tests_properties(gen_init_queries PROPERTIES FIXTURES_SETUP f_init_queries)
@@ -191,6 +191,23 @@ int main() {
     return canvas(std::move(c));
   });
 
+  // A chart scrolling to the left. The canvas is kept across frames: only the
+  // newest sample is drawn.
+  auto chart = Canvas(100, 100);
+  int chart_time = 0;
+  auto renderer_plot_4 = Renderer([&] {
+    auto sample = [&](int t) {
+      return 50 + int(20 * std::sin(t * 0.1f) + (mouse_y - 50) * 0.5f);
+    };
+    chart.Scroll(-2, 0);
+    chart.Clear(0, 0, 100, 4);
+    chart.DrawText(0, 0, "A scrolling chart");
+    chart.DrawPointPolyline(
+        {{97, sample(chart_time)}, {99, sample(chart_time + 1)}}, Color::Green);
+    chart_time++;
+    return canvas(&chart);
+  });
+
   int selected_tab = 12;
   auto tab = Container::Tab(
       {
@@ -208,6 +225,7 @@ int main() {
           renderer_plot_1,
           renderer_plot_2,
           renderer_plot_3,
+          renderer_plot_4,
 
           renderer_text,
       },
@@ -236,6 +254,7 @@ int main() {
       "plot_1 simple",
       "plot_2 filled",
       "plot_3 3D",
+      "plot_4 scrolling",
       "text",
   };
   auto tab_toggle = Menu(&tab_titles, &selected_tab);
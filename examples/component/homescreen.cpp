@@ -3,13 +3,11 @@
 // the LICENSE file.
 #include <stddef.h>    // for size_t
 #include <array>       // for array
-#include <atomic>      // for atomic
-#include <chrono>      // for operator""s, chrono_literals
+#include <chrono>      // for milliseconds
 #include <cmath>       // for sin
 #include <functional>  // for ref, reference_wrapper, function
 #include <memory>      // for allocator, shared_ptr, __shared_ptr_access
 #include <string>  // for string, basic_string, char_traits, operator+, to_string
-#include <thread>   // for sleep_for, thread
 #include <utility>  // for move
 #include <vector>   // for vector
 
@@ -512,24 +510,11 @@ int main() {
     });
   });
 
-  std::atomic<bool> refresh_ui_continue = true;
-  std::thread refresh_ui([&] {
-    while (refresh_ui_continue) {
-      using namespace std::chrono_literals;
-      std::this_thread::sleep_for(0.05s);
-      // The |shift| variable belong to the main thread. `screen.Post(task)`
-      // will execute the update on the thread where |screen| lives (e.g. the
-      // main thread). Using `screen.Post(task)` is threadsafe.
-      screen.Post([&] { shift++; });
-      // After updating the state, request a new frame to be drawn. This is done
-      // by simulating a new "custom" event to be handled.
-      screen.Post(Event::Custom);
-    }
-  });
+  // Refresh the UI periodically. The timer runs on the loop thread: it can
+  // update |shift| directly, and the frame is drawn again after it.
+  screen.SetInterval([&] { shift++; }, std::chrono::milliseconds(50));
 
   screen.Loop(main_renderer);
-  refresh_ui_continue = false;
-  refresh_ui.join();
 
   return 0;
 }
@@ -6,6 +6,8 @@
 
 #include <chrono>      // for milliseconds, duration, steady_clock, time_point
 #include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <vector>      // for vector
 
 #include "ftxui/component/event.hpp"
 
@@ -89,6 +91,27 @@ float BackInOut(float p);
 float BounceIn(float p);
 float BounceOut(float p);
 float BounceInOut(float p);
+
+// A Function sampled once into a lookup table, and evaluated by linear
+// interpolation. Copies share the samples. An Animator evaluates it directly,
+// without the std::function indirection, and without recomputing the curve.
+// Curves with an unbounded slope, like Circular at the endpoints, are less
+// accurate there.
+//
+// Example:
+// const easing::Table elastic(easing::ElasticOut);
+// animator = Animator(&value, 1.f, std::chrono::milliseconds(500), elastic);
+class Table {
+ public:
+  Table() = default;
+  explicit Table(const Function& function, int samples = 256);
+
+  float operator()(float p) const;
+  bool empty() const { return !samples_; }
+
+ private:
+  std::shared_ptr<const std::vector<float>> samples_;
+};
 }  // namespace easing
 
 class Animator {
@@ -102,6 +125,9 @@ class Animator {
   void OnAnimation(Params&);
 
   float to() const { return to_; }
+  // Whether the next OnAnimation() might change the value. Once the target
+  // is reached, the animator is settled: OnAnimation() returns immediately.
+  bool running() const { return !settled_; }
 
  private:
   float* value_;
@@ -110,6 +136,8 @@ class Animator {
   Duration duration_;
   easing::Function easing_function_;
   Duration current_;
+  bool settled_ = false;
+  easing::Table easing_table_;  // When |easing_function_| is a Table.
 };
 
 }  // namespace animation
@@ -11,17 +11,20 @@
 #include <vector>      // for vector
 
 #include "ftxui/component/component_base.hpp"  // for Component, Components
-#include "ftxui/component/component_options.hpp"  // for ButtonOption, CheckboxOption, MenuOption
+#include "ftxui/component/component_options.hpp"  // for ButtonOption, CheckboxOption, ChecklistOption, LazyOption, MenuOption, ModalOption, RecyclerOption
 #include "ftxui/dom/elements.hpp"  // for Element
 #include "ftxui/util/ref.hpp"  // for ConstRef, Ref, ConstStringRef, ConstStringListRef, StringRef
 
 namespace ftxui {
 struct ButtonOption;
 struct CheckboxOption;
+struct ChecklistOption;
 struct Event;
+class LogBuffer;
 struct InputOption;
 struct MenuOption;
 struct RadioboxOption;
+struct RecyclerOption;
 struct MenuEntryOption;
 
 template <class T, class... Args>
@@ -32,6 +35,9 @@ std::shared_ptr<T> Make(Args&&... args) {
 // Pipe operator to decorate components.
 using ComponentDecorator = std::function<Component(Component)>;
 using ElementDecorator = std::function<Element(Element)>;
+
+// Build a component on demand.
+using ComponentFactory = std::function<Component()>;
 Component operator|(Component component, ComponentDecorator decorator);
 Component operator|(Component component, ElementDecorator decorator);
 Component& operator|=(Component& component, ComponentDecorator decorator);
@@ -43,7 +49,11 @@ Component Vertical(Components children, int* selector);
 Component Horizontal(Components children);
 Component Horizontal(Components children, int* selector);
 Component Tab(Components children, int* selector);
+Component Tab(std::vector<ComponentFactory> children,
+              int* selector,
+              LazyOption option = {});
 Component Stacked(Components children);
+Component Recycler(RecyclerOption option);
 }  // namespace Container
 
 Component Button(ButtonOption options);
@@ -56,6 +66,11 @@ Component Checkbox(ConstStringRef label,
                    bool* checked,
                    CheckboxOption options = CheckboxOption::Simple());
 
+Component Checklist(ChecklistOption options);
+Component Checklist(ConstStringListRef entries,
+                    std::vector<bool>* checked,
+                    ChecklistOption options = {});
+
 Component Input(InputOption options = {});
 Component Input(StringRef content, InputOption options = {});
 Component Input(StringRef content,
@@ -119,12 +134,41 @@ Component Maybe(Component, std::function<bool()>);
 ComponentDecorator Maybe(const bool* show);
 ComponentDecorator Maybe(std::function<bool()>);
 
-Component Modal(Component main, Component modal, const bool* show_modal);
-ComponentDecorator Modal(Component modal, const bool* show_modal);
+Component Memo(Component child);
+Component Memo(Component child, std::function<size_t()> key);
+ComponentDecorator Memo();
+ComponentDecorator Memo(std::function<size_t()> key);
+
+Component RenderWhenVisible(Component child);
+ComponentDecorator RenderWhenVisible();
+
+Component BackgroundRenderer(std::function<std::function<Element()>()> snapshot,
+                             std::function<size_t()> key = nullptr);
+
+Component FrameStatsOverlay(Component child);
+ComponentDecorator FrameStatsOverlay();
+
+Component ProfileNodes(Component child, std::string name);
+ComponentDecorator ProfileNodes(std::string name);
+
+Component ProfileComponent(Component child, std::string name);
+ComponentDecorator ProfileComponent(std::string name);
+
+Component Modal(Component main,
+                Component modal,
+                const bool* show_modal,
+                ModalOption option = {});
+ComponentDecorator Modal(Component modal,
+                         const bool* show_modal,
+                         ModalOption option = {});
 
 Component Collapsible(ConstStringRef label,
                       Component child,
                       Ref<bool> show = false);
+Component Collapsible(ConstStringRef label,
+                      ComponentFactory child,
+                      Ref<bool> show = false,
+                      LazyOption option = {});
 
 Component Hoverable(Component component, bool* hover);
 Component Hoverable(Component component,
@@ -139,6 +183,9 @@ ComponentDecorator Hoverable(std::function<void(bool)> on_change);
 
 Component Window(WindowOptions option);
 
+Component FileViewer(std::string path);
+Component LogView(LogBuffer* log);
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_COMPONENT_HPP */
@@ -4,8 +4,9 @@
 #ifndef FTXUI_COMPONENT_BASE_HPP
 #define FTXUI_COMPONENT_BASE_HPP
 
-#include <memory>  // for unique_ptr
-#include <vector>  // for vector
+#include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr
+#include <vector>   // for vector
 
 #include "ftxui/component/captured_mouse.hpp"  // for CaptureMouse
 #include "ftxui/dom/elements.hpp"              // for Element
@@ -58,6 +59,40 @@ class ComponentBase {
   // Handle an animation step.
   virtual void OnAnimation(animation::Params& params);
 
+  // Event subscription --------------------------------------------------------
+  //
+  // The categories of events, combined as a bitmask.
+  enum EventCategory {
+    KeyboardEvents = 1 << 0,     // Characters, special keys and pastes.
+    MouseButtonEvents = 1 << 1,  // Mouse presses, releases and wheel.
+    MouseMotionEvents = 1 << 2,  // Mouse moves and drags.
+    CustomEvents = 1 << 3,       // Event::Custom and Event::Resize.
+    AllEvents = KeyboardEvents | MouseButtonEvents | MouseMotionEvents |
+                CustomEvents,
+  };
+  static EventCategory CategoryOf(const Event& event);
+
+  // The categories of events the component handles itself, as opposed to
+  // forwarding them to its children. All of them by default. The value must
+  // not change once the component is built.
+  virtual int EventCategories() const;
+
+  // Whether the component, or one of its descendants, handles the |event|.
+  // When it returns false, OnEvent doesn't need to be called.
+  bool Subscribes(const Event& event) const;
+
+  // Memory --------------------------------------------------------------------
+  //
+  // The bytes retained by this component, excluding its children. See
+  // ftxui::MemoryUsage(const Component&) for the whole tree.
+  virtual size_t MemoryUsage() const;
+
+  // Invalidation --------------------------------------------------------------
+  //
+  // Mark the component, and its ancestors, as needing to be rendered again.
+  // Memo(component) reuses what it rendered until then.
+  void Invalidate();
+
   // Focus management ----------------------------------------------------------
   //
   // If this component contains children, this indicates which one is active,
@@ -87,12 +122,25 @@ class ComponentBase {
  protected:
   CapturedMouse CaptureMouse(const Event& event);
 
+  // Whether Invalidate() was called on the component, or one of its
+  // descendants, since the last call to Validate().
+  bool Invalidated() const { return invalidated_; }
+  void Validate() { invalidated_ = false; }
+
   Components children_;
 
  private:
+  int Subscriptions() const;
+  void InvalidateSubscriptions();
+
   ComponentBase* parent_ = nullptr;
+  mutable int subscriptions_ = -1;  // EventCategories() of the subtree.
+  bool invalidated_ = true;
 };
 
+// The bytes retained by |component| and its descendants.
+size_t MemoryUsage(const Component& component);
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_COMPONENT_BASE_HPP */
@@ -12,8 +12,11 @@
 #include <functional>              // for function
 #include <optional>                // for optional
 #include <string>                  // for string
+#include <vector>                  // for vector
 
 #include "ftxui/component/component_base.hpp"  // for Component
+#include "ftxui/component/keymap.hpp"          // for Keymap
+#include "ftxui/component/text_buffer.hpp"     // for TextBuffer
 #include "ftxui/screen/color.hpp"  // for Color, Color::GrayDark, Color::White
 
 namespace ftxui {
@@ -80,6 +83,23 @@ struct MenuEntryOption {
   AnimatedColorsOption animated_colors;
 };
 
+/// @brief The actions of the Menu component, bound to keys by
+/// |MenuOption::keymap|.
+/// @ingroup component
+enum class MenuAction {
+  Up,        ///< Move the selection toward the top.
+  Down,      ///< Move the selection toward the bottom.
+  Left,      ///< Move the selection toward the left.
+  Right,     ///< Move the selection toward the right.
+  PageUp,    ///< Move the selection up by a page.
+  PageDown,  ///< Move the selection down by a page.
+  First,     ///< Select the first entry.
+  Last,      ///< Select the last entry.
+  Next,      ///< Select the next entry, wrapping around.
+  Previous,  ///< Select the previous entry, wrapping around.
+  Enter,     ///< Call |MenuOption::on_enter|.
+};
+
 /// @brief Option for the Menu component.
 /// @ingroup component
 struct MenuOption {
@@ -90,6 +110,10 @@ struct MenuOption {
   static MenuOption VerticalAnimated();
   static MenuOption Toggle();
 
+  /// @brief The arrows, the vim keys, PageUp, PageDown, Home, End, Tab and
+  /// Return.
+  static Keymap<MenuAction> DefaultKeymap();
+
   ConstStringListRef entries;  ///> The list of entries.
   Ref<int> selected = 0;       ///> The index of the selected entry.
 
@@ -101,10 +125,18 @@ struct MenuOption {
   std::function<Element()> elements_infix;
   std::function<Element()> elements_postfix;
 
+  // Only build the entries visible on screen, when displayed inside a `frame`.
+  // This is meant for vertical menus with a large number of entries. Every
+  // entry, and every infix, must be one cell tall.
+  bool virtualized = false;
+
   // Observers:
   std::function<void()> on_change;  ///> Called when the selected entry changes.
   std::function<void()> on_enter;   ///> Called when the user presses enter.
   Ref<int> focused_entry = 0;
+
+  // The keys handled by the menu.
+  Keymap<MenuAction> keymap = DefaultKeymap();
 };
 
 /// @brief Option for the AnimatedButton component.
@@ -148,6 +180,24 @@ struct CheckboxOption {
   std::function<void()> on_change = [] {};
 };
 
+/// @brief Option for the Checklist component.
+/// @ingroup component
+struct ChecklistOption {
+  // Content:
+  ConstStringListRef entries;
+  /// Whether every entry is checked, one bit per entry. It is resized to the
+  /// number of entries.
+  Ref<std::vector<bool>> checked;
+
+  // Style:
+  std::function<Element(const EntryState&)> transform;
+
+  // Observers:
+  /// Called when some entries are checked or unchecked.
+  std::function<void()> on_change = [] {};
+  Ref<int> focused_entry = 0;
+};
+
 /// @brief Used to define style for the Input component.
 struct InputState {
   Element element;
@@ -157,6 +207,24 @@ struct InputState {
                         ///< placeholder.
 };
 
+/// @brief The actions of the Input component, bound to keys by
+/// |InputOption::keymap|.
+/// @ingroup component
+enum class InputAction {
+  Enter,           ///< Insert a newline, or call |InputOption::on_enter|.
+  MoveLeft,        ///< Move the cursor by one character.
+  MoveRight,       ///< Move the cursor by one character.
+  MoveUp,          ///< Move the cursor by one line.
+  MoveDown,        ///< Move the cursor by one line.
+  MoveWordLeft,    ///< Move the cursor to the previous word.
+  MoveWordRight,   ///< Move the cursor past the next word.
+  MoveHome,        ///< Move the cursor to the beginning of the content.
+  MoveEnd,         ///< Move the cursor to the end of the content.
+  DeleteBackward,  ///< Delete the character before the cursor.
+  DeleteForward,   ///< Delete the character after the cursor.
+  ToggleInsert,    ///< Switch between the insert and overtype modes.
+};
+
 /// @brief Option for the Input component.
 /// @ingroup component
 struct InputOption {
@@ -167,9 +235,16 @@ struct InputOption {
   /// @brief A white on black style with high margins:
   static InputOption Spacious();
 
+  /// @brief The arrows, Home, End, Backspace, Delete, Insert and Return.
+  static Keymap<InputAction> DefaultKeymap();
+
   /// The content of the input.
   StringRef content = "";
 
+  /// When set, the input edits this buffer instead of `content`. This is meant
+  /// for large texts: edits only touch the lines involved.
+  TextBuffer* buffer = nullptr;
+
   /// The content of the input when it's empty.
   StringRef placeholder = "";
 
@@ -179,6 +254,10 @@ struct InputOption {
   Ref<bool> multiline = true;  ///< Whether the input can be multiline.
   Ref<bool> insert = true;     ///< Insert or overtype character mode.
 
+  // Only build the lines visible on screen. This is meant for large multiline
+  // contents. The input doesn't require the width of its longest line anymore.
+  bool virtualized = false;
+
   /// Called when the content changes.
   std::function<void()> on_change = [] {};
   /// Called when the user presses enter.
@@ -186,6 +265,9 @@ struct InputOption {
 
   // The char position of the cursor:
   Ref<int> cursor_position = 0;
+
+  // The keys handled by the input. The characters not bound are inserted.
+  Keymap<InputAction> keymap = DefaultKeymap();
 };
 
 /// @brief Option for the Radiobox component.
@@ -201,6 +283,11 @@ struct RadioboxOption {
   // Style:
   std::function<Element(const EntryState&)> transform;
 
+  // Only build the entries visible on screen, when displayed inside a `frame`.
+  // This is meant for a large number of entries. Every entry must be one cell
+  // tall.
+  bool virtualized = false;
+
   // Observers:
   /// Called when the selected entry changes.
   std::function<void()> on_change = [] {};
@@ -261,6 +348,49 @@ struct WindowOptions {
 
   /// An optional function to customize how the window looks like:
   std::function<Element(const WindowRenderState&)> render;
+
+  /// Whether the window is drawn into its own offscreen Screen, and copied
+  /// from there. It is only rendered again when what it displays changes,
+  /// so moving or raising it doesn't render its content.
+  bool composited = false;
+};
+
+/// @brief Option for the Modal component.
+/// @ingroup component
+struct ModalOption {
+  /// Whether the main component is drawn once when the modal is shown, and
+  /// its pixels copied while it stays shown, instead of being rendered again
+  /// every frame. What the main component displays meanwhile isn't updated.
+  bool snapshot = false;
+
+  /// Whether the main component is dimmed while the modal is shown. With
+  /// |snapshot|, the dimmed pixels are computed once.
+  bool dim = false;
+};
+
+/// @brief Option for the Container::Recycler component.
+/// @ingroup component
+struct RecyclerOption {
+  /// The number of rows.
+  ConstRef<int> size = 0;
+
+  /// Build a component drawing the row at |*index|. Only the rows visible at
+  /// once are built. While scrolling, they are bound to other rows by changing
+  /// |*index|, so they must read it every time, instead of copying it.
+  std::function<Component(const int* index)> row;
+
+  /// The index of the selected row.
+  Ref<int> selected = 0;
+};
+
+/// @brief Option for the components built on demand, like Collapsible and
+/// Container::Tab given component factories.
+/// @ingroup component
+struct LazyOption {
+  /// Release a component once it has been hidden for this long. It is built
+  /// again, with a fresh state, the next time it is shown. Components are never
+  /// released when unset.
+  std::optional<animation::Duration> release_after;
 };
 
 /// @brief Option for the Dropdown component.
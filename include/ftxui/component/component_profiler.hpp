@@ -0,0 +1,112 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_COMPONENT_PROFILER_HPP
+#define FTXUI_COMPONENT_COMPONENT_PROFILER_HPP
+
+#include <chrono>   // for nanoseconds, steady_clock
+#include <cstddef>  // for size_t
+#include <map>      // for map
+#include <string>   // for string
+#include <vector>   // for vector
+
+namespace ftxui {
+
+/// @brief Measure the time spent in the Render() and OnEvent() of the
+/// components, by name.
+///
+/// While a ComponentProfiler::Scope is alive, the ComponentProfiler::Timer
+/// opened on its thread are recorded. They are usually opened by the
+/// `ProfileComponent` decorator. The time of a Timer is:
+/// - inclusive: from its opening to its closing.
+/// - exclusive: the same, minus the time of the Timers nested in it.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// ComponentProfiler profiler;
+/// screen.UseComponentProfiler(&profiler);
+/// auto sidebar = ProfileComponent(Sidebar(), "sidebar");
+/// auto editor = ProfileComponent(Editor(), "editor");
+/// screen.Loop(Container::Horizontal({sidebar, editor}));
+/// std::cerr << profiler.ToString();
+/// ```
+class ComponentProfiler {
+ public:
+  enum class Phase { Render, Event };
+  struct Entry {
+    std::string name;
+    size_t calls = 0;
+    std::chrono::nanoseconds inclusive{0};
+    std::chrono::nanoseconds exclusive{0};
+  };
+
+  ComponentProfiler() = default;
+  ComponentProfiler(const ComponentProfiler&) = delete;
+  ComponentProfiler& operator=(const ComponentProfiler&) = delete;
+
+  // Make |profiler| the current profiler of the calling thread, until
+  // destroyed. nullptr disables the profiling.
+  class Scope {
+   public:
+    explicit Scope(ComponentProfiler* profiler);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    ComponentProfiler* previous_;
+  };
+
+  // Attribute the time elapsed until destroyed to |name|. It has no effect
+  // without a current profiler.
+  class Timer {
+   public:
+    Timer(Phase phase, const std::string& name);
+    ~Timer();
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+   private:
+    ComponentProfiler* profiler_;
+  };
+
+  // Return the current profiler of the calling thread, nullptr if none.
+  static ComponentProfiler* Current();
+
+  // The time recorded since the last Clear(), by name, sorted by decreasing
+  // exclusive time. A name nested in itself counts its inclusive time twice.
+  std::vector<Entry> ByName(Phase phase) const;
+
+  // The exclusive time of every stack of names, in microseconds, one stack per
+  // line: "render;root;sidebar 1234". This is the "folded" input of the flame
+  // graph tools, like flamegraph.pl or speedscope.
+  std::string FoldedStacks() const;
+
+  void Clear();
+
+  // A human readable report of ByName().
+  std::string ToString() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  struct Frame {
+    Phase phase;
+    const std::string* name;
+    std::string stack;
+    Clock::time_point start;
+    std::chrono::nanoseconds children{0};
+  };
+
+  void Open(Phase phase, const std::string& name);
+  void Close();
+
+  std::vector<Frame> frames_;
+  std::map<std::string, Entry> by_name_[2];  // NOLINT
+  std::map<std::string, std::chrono::nanoseconds> by_stack_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_COMPONENT_PROFILER_HPP
@@ -0,0 +1,128 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_COROUTINE_HPP
+#define FTXUI_COMPONENT_COROUTINE_HPP
+
+// The coroutines require C++20. The library itself is built with C++17: this
+// header is only available to the code built with C++20.
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>    // for coroutine_handle, suspend_never
+#include <exception>    // for terminate
+#include <optional>     // for optional
+#include <type_traits>  // for conditional_t, invoke_result_t, is_void_v
+#include <utility>      // for move
+
+#include "ftxui/component/animation.hpp"           // for Duration
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+/// @brief The return type of a coroutine driven by the loop of a
+/// ScreenInteractive. It starts running immediately, and its frame is freed
+/// once it returns.
+///
+/// It resumes on the loop thread, when the awaited NextFrame(), Sleep() or
+/// Async() completes. A coroutine whose awaited event never happens, for
+/// instance because the loop exited, is never resumed.
+///
+/// ### Example
+///
+/// ```cpp
+/// Coroutine Load(ScreenInteractive& screen, std::vector<std::string>& rows) {
+///   rows = co_await Async(screen, [] { return Query(); });
+/// }
+/// ```
+/// @ingroup component
+struct Coroutine {
+  struct promise_type {
+    Coroutine get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+namespace coroutine {
+
+// Resume a coroutine. It fits in the small buffer of a Closure: awaiting
+// doesn't allocate one.
+struct Resume {
+  std::coroutine_handle<> handle;
+  void operator()() const { handle.resume(); }
+};
+
+}  // namespace coroutine
+
+/// @brief Suspend the coroutine until the next frame of |screen| is drawn.
+/// @ingroup component
+inline auto NextFrame(ScreenInteractive& screen) {
+  struct Awaiter {
+    ScreenInteractive& screen;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) {
+      screen.AfterNextFrame(coroutine::Resume{handle});
+    }
+    void await_resume() const noexcept {}
+  };
+  return Awaiter{screen};
+}
+
+/// @brief Suspend the coroutine for |duration|, without blocking the loop of
+/// |screen|. See ScreenInteractive::SetTimeout().
+/// @ingroup component
+inline auto Sleep(ScreenInteractive& screen, animation::Duration duration) {
+  struct Awaiter {
+    ScreenInteractive& screen;
+    animation::Duration duration;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) {
+      screen.SetTimeout(coroutine::Resume{handle}, duration);
+    }
+    void await_resume() const noexcept {}
+  };
+  return Awaiter{screen, duration};
+}
+
+/// @brief Run |work| on a background thread of |screen|, and resume the
+/// coroutine on the loop thread with its result.
+/// See ScreenInteractive::Async().
+/// @ingroup component
+template <typename Work>
+auto Async(ScreenInteractive& screen, Work work) {
+  using Result = std::invoke_result_t<Work&>;
+  struct Awaiter {
+    ScreenInteractive& screen;
+    Work work;
+    std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>>
+        result = {};
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) {
+      // The awaiter lives in the suspended coroutine's frame until it resumes.
+      screen.Async(
+          [this] {
+            if constexpr (std::is_void_v<Result>) {
+              work();
+            } else {
+              result.emplace(work());
+            }
+          },
+          coroutine::Resume{handle});
+    }
+    Result await_resume() {
+      if constexpr (!std::is_void_v<Result>) {
+        return std::move(*result);
+      }
+    }
+  };
+  return Awaiter{screen, std::move(work)};
+}
+
+}  // namespace ftxui
+
+#endif  // defined(__cpp_impl_coroutine)
+
+#endif  // FTXUI_COMPONENT_COROUTINE_HPP
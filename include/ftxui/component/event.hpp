@@ -5,7 +5,9 @@
 #define FTXUI_COMPONENT_EVENT_HPP
 
 #include <ftxui/component/mouse.hpp>  // for Mouse
-#include <functional>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <functional>  // for hash
 #include <string>  // for string, operator==
 #include <vector>
 
@@ -33,8 +35,11 @@ struct Event {
   static Event Character(wchar_t);
   static Event Special(std::string);
   static Event Mouse(std::string, Mouse mouse);
-  static Event CursorPosition(std::string, int x, int y);  // Internal
-  static Event CursorShape(std::string, int shape);        // Internal
+  static Event Paste(std::string text);
+  static Event CursorPosition(std::string, int x, int y);     // Internal
+  static Event CursorShape(std::string, int shape);           // Internal
+  static Event ModeReport(std::string, int mode, int value);  // Internal
+  static Event TerminalReport(std::string);                    // Internal
 
   // --- Arrow ---
   static const Event ArrowLeft;
@@ -63,13 +68,26 @@ struct Event {
   static const Event PageUp;
   static const Event PageDown;
 
+  // The terminal was resized.
+  static const Event Resize;
+
   // --- Custom ---
   static const Event Custom;
 
   //--- Method section ---------------------------------------------------------
-  bool operator==(const Event& other) const { return input_ == other.input_; }
+  bool operator==(const Event& other) const {
+    return key_ == other.key_ &&
+           (input_.size() < sizeof(key_) || input_ == other.input_);
+  }
   bool operator!=(const Event& other) const { return !operator==(other); }
 
+  // Hash the events consistently with operator==, for the hashed containers.
+  struct Hash {
+    size_t operator()(const Event& event) const {
+      return std::hash<uint64_t>()(event.key_);
+    }
+  };
+
   const std::string& input() const { return input_; }
 
   bool is_character() const { return type_ == Type::Character; }
@@ -78,6 +96,9 @@ struct Event {
   bool is_mouse() const { return type_ == Type::Mouse; }
   struct Mouse& mouse() { return data_.mouse; }
 
+  bool is_paste() const { return type_ == Type::Paste; }
+  std::string paste() const;
+
   // --- Internal Method section -----------------------------------------------
   bool is_cursor_position() const { return type_ == Type::CursorPosition; }
   int cursor_x() const { return data_.cursor.x; }
@@ -86,6 +107,14 @@ struct Event {
   bool is_cursor_shape() const { return type_ == Type::CursorShape; }
   int cursor_shape() const { return data_.cursor_shape; }
 
+  // The terminal's answer to a DEC mode request (DECRQM).
+  bool is_mode_report() const { return type_ == Type::ModeReport; }
+  int reported_mode() const { return data_.mode_report.mode; }
+  int reported_mode_value() const { return data_.mode_report.value; }
+
+  // The terminal's answer to XTVERSION or XTGETTCAP, in input().
+  bool is_terminal_report() const { return type_ == Type::TerminalReport; }
+
   //--- State section ----------------------------------------------------------
   ScreenInteractive* screen_ = nullptr;
 
@@ -96,8 +125,11 @@ struct Event {
     Unknown,
     Character,
     Mouse,
+    Paste,
     CursorPosition,
     CursorShape,
+    ModeReport,
+    TerminalReport,
   };
   Type type_ = Type::Unknown;
 
@@ -106,13 +138,22 @@ struct Event {
     int y = 0;
   };
 
+  struct ModeReport {
+    int mode = 0;
+    int value = 0;
+  };
+
   union {
     struct Mouse mouse;
     struct Cursor cursor;
     int cursor_shape;
+    struct ModeReport mode_report;
   } data_ = {};
 
+  void SetInput(std::string input);
   std::string input_;
+  // Compared before |input_|. See SetInput().
+  uint64_t key_ = 0;
 };
 
 }  // namespace ftxui
@@ -0,0 +1,49 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_KEYMAP_HPP
+#define FTXUI_COMPONENT_KEYMAP_HPP
+
+#include <initializer_list>  // for initializer_list
+#include <unordered_map>     // for unordered_map
+#include <utility>           // for pair
+
+#include "ftxui/component/event.hpp"  // for Event
+
+namespace ftxui {
+
+/// @brief The table binding the keys to the actions of a component.
+///
+/// A component looks up the event once, instead of comparing it against every
+/// key it handles. Users rebind the keys by editing the table of the option:
+/// ```cpp
+/// auto option = InputOption::Default();
+/// option.keymap.Bind(Event::Special({2}), InputAction::MoveLeft);  // Ctrl+B
+/// ```
+/// @ingroup component
+template <typename Action>
+class Keymap {
+ public:
+  Keymap() = default;
+  Keymap(std::initializer_list<std::pair<const Event, Action>> bindings)
+      : bindings_(bindings) {}
+
+  // Bind |event| to |action|, replacing its previous action.
+  void Bind(const Event& event, Action action) { bindings_[event] = action; }
+
+  // Remove the action bound to |event|.
+  void Unbind(const Event& event) { bindings_.erase(event); }
+
+  // The action bound to |event|, or nullptr.
+  const Action* Find(const Event& event) const {
+    auto it = bindings_.find(event);
+    return it == bindings_.end() ? nullptr : &it->second;
+  }
+
+ private:
+  std::unordered_map<Event, Action, Event::Hash> bindings_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_KEYMAP_HPP
@@ -0,0 +1,83 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_LOG_BUFFER_HPP
+#define FTXUI_COMPONENT_LOG_BUFFER_HPP
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <deque>    // for deque
+#include <mutex>    // for mutex
+#include <string>   // for string
+#include <vector>   // for vector
+
+namespace ftxui {
+
+class ScreenInteractive;
+
+/// @brief The last lines of a log, appended from any thread, and displayed by
+/// `LogView`.
+///
+/// The lines are kept in a ring buffer of a fixed capacity: the oldest ones are
+/// dropped. Append() queues the lines. The first one following a publication
+/// posts a single Event::Custom to redraw the screen, the next ones are batched
+/// with it. The lines are moved into the ring buffer when the loop thread reads
+/// them, so there is at most one redraw per frame, however many lines were
+/// appended.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// LogBuffer log(screen, 10000);
+///
+/// // From the process reader thread:
+/// log.Append(line);
+///
+/// // From the loop thread:
+/// screen.Loop(LogView(&log));
+/// ```
+class LogBuffer {
+ public:
+  explicit LogBuffer(size_t capacity);
+  LogBuffer(ScreenInteractive& screen, size_t capacity);
+
+  LogBuffer(const LogBuffer&) = delete;
+  LogBuffer& operator=(const LogBuffer&) = delete;
+
+  // Append a line. It can be called from any thread.
+  void Append(std::string line);
+
+  // The lines kept, from the oldest. Only from the loop thread.
+  size_t size();
+  const std::string& operator[](size_t index);
+
+  // The number of lines appended since the creation, including the ones
+  // dropped. Only from the loop thread.
+  size_t appended();
+
+  size_t capacity() const { return capacity_; }
+
+ private:
+  void Publish();
+
+  ScreenInteractive* screen_ = nullptr;
+  const size_t capacity_;
+
+  // Owned by the loop thread.
+  std::vector<std::string> ring_;
+  size_t start_ = 0;
+  size_t appended_ = 0;
+
+  // Filled by the other threads.
+  std::mutex mutex_;
+  std::deque<std::string> pending_;
+  size_t pending_appended_ = 0;
+  std::atomic<bool> has_pending_{false};
+  bool scheduled_ = false;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_LOG_BUFFER_HPP
@@ -6,6 +6,7 @@
 
 #include <memory>  // for shared_ptr
 
+#include "ftxui/component/animation.hpp"       // for TimePoint
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
 
 namespace ftxui {
@@ -21,9 +22,16 @@ class Loop {
 
   bool HasQuitted();
   void RunOnce();
+  void RunOnce(animation::TimePoint deadline);
   void RunOnceBlocking();
   void Run();
 
+  // Integration with an external event loop. See
+  // ScreenInteractive::ExternalEventLoop().
+  int InputFileDescriptor() const;
+  int WakeUpFileDescriptor() const;
+  animation::TimePoint NextDeadline() const;
+
  private:
   // This class is non copyable.
   Loop(const ScreenInteractive&) = delete;
@@ -4,15 +4,15 @@
 #ifndef FTXUI_COMPONENT_RECEIVER_HPP_
 #define FTXUI_COMPONENT_RECEIVER_HPP_
 
-#include <algorithm>           // for copy, max
-#include <atomic>              // for atomic, __atomic_base
+#include <atomic>              // for atomic
+#include <chrono>              // for time_point
 #include <condition_variable>  // for condition_variable
-#include <functional>
-#include <iostream>
-#include <memory>   // for unique_ptr, make_unique
-#include <mutex>    // for mutex, unique_lock
-#include <queue>    // for queue
-#include <utility>  // for move
+#include <cstddef>             // for size_t
+#include <memory>              // for unique_ptr, make_unique
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <optional>            // for optional, nullopt
+#include <utility>             // for move
+#include <vector>              // for vector
 
 namespace ftxui {
 
@@ -39,6 +39,26 @@ namespace ftxui {
 //   print(c)
 //
 // Receiver::Receive() returns true when there are no more senders.
+//
+// Sending is lock-free. The receiving side must be used from a single thread.
+//
+// Bounded queue:
+// --------------
+// auto receiver = MakeReceiver<Line>(1000, ReceiverOverflow::DropOldest);
+//
+// Past |capacity| pending values, Send() applies the overflow policy. The
+// bounded queues take a lock to send and receive. size(), peak_size() and
+// dropped() tell how loaded the queue is.
+
+// What Send() does when a bounded queue is full.
+enum class ReceiverOverflow {
+  // Wait for the receiver to make room. Never send from the receiving thread.
+  Block,
+  // Drop the oldest pending value, to make room for the new one.
+  DropOldest,
+  // Drop the new value.
+  DropNewest,
+};
 
 // clang-format off
 template<class T> class SenderImpl;
@@ -46,7 +66,9 @@ template<class T> class ReceiverImpl;
 
 template<class T> using Sender = std::unique_ptr<SenderImpl<T>>;
 template<class T> using Receiver = std::unique_ptr<ReceiverImpl<T>>;
-template<class T> Receiver<T> MakeReceiver();
+template<class T> Receiver<T> MakeReceiver(
+    size_t capacity = 0,
+    ReceiverOverflow overflow = ReceiverOverflow::Block);
 // clang-format on
 
 // ---- Implementation part ----
@@ -65,74 +87,261 @@ class SenderImpl {
   ReceiverImpl<T>* receiver_;
 };
 
+// The queue is a linked list of nodes, from the oldest |tail_| to the newest
+// |head_|. The senders append nodes by exchanging |head_|, then linking the
+// previous one to it. The receiver pops the nodes following |tail_|, which is
+// always a node whose value was already received.
+//
+// The mutex and the condition variable are only used by the receiver to
+// sleep, and by the senders to wake it up. When the queue is bounded, the
+// mutex also guards |tail_|: a sender may drop the oldest node.
 template <class T>
 class ReceiverImpl {
  public:
   Sender<T> MakeSender() {
-    std::unique_lock<std::mutex> lock(mutex_);
     senders_++;
     return std::unique_ptr<SenderImpl<T>>(new SenderImpl<T>(this));
   }
-  ReceiverImpl() { senders_ = 0; }
+  // |capacity| is the maximum number of pending values, 0 for unbounded.
+  explicit ReceiverImpl(size_t capacity = 0,
+                        ReceiverOverflow overflow = ReceiverOverflow::Block)
+      : head_(new Node()),
+        tail_(head_.load()),
+        capacity_(capacity),
+        overflow_(overflow) {}
+  ~ReceiverImpl() {
+    while (tail_) {
+      Node* next = tail_->next.load();
+      delete tail_;
+      tail_ = next;
+    }
+  }
+  ReceiverImpl(const ReceiverImpl&) = delete;
+  ReceiverImpl(ReceiverImpl&&) = delete;
+  ReceiverImpl& operator=(const ReceiverImpl&) = delete;
+  ReceiverImpl& operator=(ReceiverImpl&&) = delete;
 
   bool Receive(T* t) {
-    while (senders_ || !queue_.empty()) {
-      std::unique_lock<std::mutex> lock(mutex_);
-      if (queue_.empty())
-        notifier_.wait(lock);
-      if (queue_.empty())
-        continue;
-      *t = std::move(queue_.front());
-      queue_.pop();
-      return true;
+    while (true) {
+      if (Pop(t)) {
+        return true;
+      }
+      if (NoSenders()) {
+        return Pop(t);
+      }
+      Wait();
     }
-    return false;
   }
 
-  bool ReceiveNonBlocking(T* t) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (queue_.empty())
-      return false;
-    *t = queue_.front();
-    queue_.pop();
-    return true;
+  // Same as Receive, but give up at |deadline|.
+  template <class Clock, class Duration>
+  bool ReceiveUntil(T* t,
+                    const std::chrono::time_point<Clock, Duration>& deadline) {
+    while (true) {
+      if (Pop(t)) {
+        return true;
+      }
+      if (NoSenders()) {
+        return Pop(t);
+      }
+      if (!Wait(&deadline)) {
+        return Pop(t);
+      }
+    }
   }
 
-  bool HasPending() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return !queue_.empty();
-  }
+  bool ReceiveNonBlocking(T* t) { return Pop(t); }
 
-  bool HasQuitted() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return queue_.empty() && !senders_;
+  // Append every pending value to |out|. Return whether there were any.
+  bool ReceiveAll(std::vector<T>* out) {
+    const size_t size = out->size();
+    while (std::optional<T> t = Pop()) {
+      out->push_back(std::move(*t));
+    }
+    return out->size() != size;
   }
 
+  bool HasPending() { return !EmptyLocked(); }
+
+  bool HasQuitted() { return EmptyLocked() && NoSenders(); }
+
+  // The number of pending values.
+  size_t size() const { return size_; }
+  // The maximum number of pending values reached.
+  size_t peak_size() const { return peak_size_; }
+  // The number of values dropped by the overflow policy.
+  size_t dropped() const { return dropped_; }
+
  private:
   friend class SenderImpl<T>;
 
+  // The first node, and the ones already received, hold no value. T isn't
+  // required to be default constructible.
+  struct Node {
+    Node() = default;
+    explicit Node(T t) : value(std::move(t)) {}
+    std::atomic<Node*> next{nullptr};
+    std::optional<T> value;
+  };
+
   void Receive(T t) {
+    if (capacity_ != 0) {
+      ReceiveBounded(std::move(t));
+      return;
+    }
+    Push(std::move(t));
+  }
+
+  void ReceiveBounded(T t) {
     {
       std::unique_lock<std::mutex> lock(mutex_);
-      queue_.push(std::move(t));
+      if (size_ >= capacity_) {
+        switch (overflow_) {
+          case ReceiverOverflow::Block:
+            space_.wait(lock, [&] { return size_ < capacity_; });
+            break;
+          case ReceiverOverflow::DropOldest: {
+            Node* next = tail_->next.load();
+            delete tail_;
+            tail_ = next;
+            tail_->value.reset();
+            size_--;
+            dropped_++;
+            break;
+          }
+          case ReceiverOverflow::DropNewest:
+            dropped_++;
+            return;
+        }
+      }
+      Link(std::move(t));
     }
     notifier_.notify_one();
   }
 
+  void Push(T t) {
+    Link(std::move(t));
+
+    // Wake up the receiver. Taking the lock guarantees it is either waiting
+    // on the condition variable, or hasn't checked for new nodes yet.
+    if (waiting_) {
+      { const std::lock_guard<std::mutex> lock(mutex_); }
+      notifier_.notify_one();
+    }
+  }
+
+  void Link(T t) {
+    Node* node = new Node(std::move(t));
+    const size_t size = ++size_;
+    size_t peak = peak_size_;
+    while (size > peak && !peak_size_.compare_exchange_weak(peak, size)) {
+    }
+    Node* previous = head_.exchange(node);
+    previous->next.store(node);
+  }
+
+
   void ReleaseSender() {
+    const std::lock_guard<std::mutex> lock(mutex_);
     senders_--;
     notifier_.notify_one();
   }
 
+  // Whether every sender was released. The lock guarantees the last one is
+  // done using this object, which can then be destroyed.
+  bool NoSenders() {
+    if (senders_ != 0) {
+      return false;
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return true;
+  }
+
+  // |mutex_| must be held, when the queue is bounded.
+  bool Empty() const { return tail_->next.load() == nullptr; }
+
+  bool EmptyLocked() {
+    if (capacity_ == 0) {
+      return Empty();
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return Empty();
+  }
+
+  bool Pop(T* t) {
+    std::optional<T> value = Pop();
+    if (!value) {
+      return false;
+    }
+    *t = std::move(*value);
+    return true;
+  }
+
+  std::optional<T> Pop() {
+    if (capacity_ == 0) {
+      return PopUnlocked();
+    }
+    std::optional<T> value;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      value = PopUnlocked();
+      if (!value) {
+        return std::nullopt;
+      }
+    }
+    space_.notify_one();
+    return value;
+  }
+
+  std::optional<T> PopUnlocked() {
+    Node* next = tail_->next.load();
+    if (!next) {
+      return std::nullopt;
+    }
+    std::optional<T> value = std::move(next->value);
+    next->value.reset();
+    delete tail_;
+    tail_ = next;
+    size_--;
+    return value;
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_ = true;
+    notifier_.wait(lock, [&] { return !Empty() || senders_ == 0; });
+    waiting_ = false;
+  }
+
+  // Return false when |deadline| is reached first.
+  template <class Clock, class Duration>
+  bool Wait(const std::chrono::time_point<Clock, Duration>* deadline) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_ = true;
+    const bool woken = notifier_.wait_until(
+        lock, *deadline, [&] { return !Empty() || senders_ == 0; });
+    waiting_ = false;
+    return woken;
+  }
+
+  std::atomic<Node*> head_;
+  Node* tail_;
+  std::atomic<int> senders_{0};
+  std::atomic<bool> waiting_{false};
   std::mutex mutex_;
-  std::queue<T> queue_;
   std::condition_variable notifier_;
-  std::atomic<int> senders_;
+
+  const size_t capacity_;
+  const ReceiverOverflow overflow_;
+  std::condition_variable space_;  // Notified when a value is received.
+  std::atomic<size_t> size_{0};
+  std::atomic<size_t> peak_size_{0};
+  std::atomic<size_t> dropped_{0};
 };
 
 template <class T>
-Receiver<T> MakeReceiver() {
-  return std::make_unique<ReceiverImpl<T>>();
+Receiver<T> MakeReceiver(size_t capacity, ReceiverOverflow overflow) {
+  return std::make_unique<ReceiverImpl<T>>(capacity, overflow);
 }
 
 }  // namespace ftxui
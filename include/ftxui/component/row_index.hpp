@@ -0,0 +1,142 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_ROW_INDEX_HPP
+#define FTXUI_COMPONENT_ROW_INDEX_HPP
+
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>               // for deque
+#include <functional>          // for function
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+#include "ftxui/util/ref.hpp"  // for ConstStringListRef
+
+namespace ftxui {
+
+class ScreenInteractive;
+
+/// @brief The rows of a data source kept by a filter, in the order of a sort.
+///
+/// The index is a permutation of the row numbers. Views display the position
+/// `i` using the row `index[i]` of the data source, for instance with
+/// `virtualTable`, `dataTable` or a `Menu` listing `IndexedEntries`.
+///
+/// - SetFilter() and SetRows() filter every row again, then sort them.
+/// - NarrowFilter() only filters the rows currently kept. They stay sorted.
+/// - SetSort() sorts the rows currently kept. The rows comparing equal keep the
+///   order of the data source.
+///
+/// Built with a ScreenInteractive, the index is computed on a background
+/// thread. Until it is done, the previous one is displayed. The screen is
+/// redrawn once it is. The filter and the sort are then called from that
+/// thread: the data source must not be modified meanwhile. With
+/// FTXUI_ENABLE_THREADS=OFF, it is always computed on the calling thread.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// RowIndex index(screen, rows.size());
+/// index.SetSort([&](size_t a, size_t b) { return rows[a].cpu > rows[b].cpu; });
+/// auto view = Renderer([&] {
+///   return virtualTable(index.size(), {20, 0}, [&](int row, int column) {
+///     return text(rows[index[row]].field(column));
+///   }) | yframe;
+/// });
+/// ```
+class RowIndex {
+ public:
+  // Whether a row is kept.
+  using Filter = std::function<bool(size_t row)>;
+  // Whether the row |a| is sorted before the row |b|.
+  using Less = std::function<bool(size_t a, size_t b)>;
+
+  explicit RowIndex(size_t rows);
+  RowIndex(ScreenInteractive& screen, size_t rows);
+  ~RowIndex();
+
+  RowIndex(const RowIndex&) = delete;
+  RowIndex& operator=(const RowIndex&) = delete;
+
+  // Change the index. Only from the loop thread.
+  void SetRows(size_t rows);
+  void SetFilter(Filter filter);
+  // Replace the filter by one rejecting the same rows, and more.
+  void NarrowFilter(Filter filter);
+  // A null |less| sorts the rows in the order of the data source.
+  void SetSort(Less less);
+
+  // The index computed last. Only from the loop thread.
+  size_t size();
+  size_t operator[](size_t position);
+
+  // Whether the index is being computed on the background thread.
+  bool computing() const { return jobs_pending_ != 0; }
+
+ private:
+  struct Job {
+    enum Kind { Full, Narrow, Sort };
+    Kind kind;
+    size_t rows;
+    Filter filter;
+    Less less;
+  };
+  void Submit(Job job);
+  static void Apply(const Job& job,
+                    std::vector<size_t>& order,
+                    const std::atomic<bool>* cancel);
+  void Run();
+  void Publish();
+
+  ScreenInteractive* screen_ = nullptr;
+
+  // Owned by the loop thread.
+  size_t rows_;
+  Filter filter_;
+  Less less_;
+  std::vector<size_t> order_;
+
+  // Shared with the background thread.
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<Job> jobs_;
+  std::vector<size_t> computed_;
+  std::atomic<bool> has_computed_{false};
+  std::atomic<bool> cancel_{false};
+  std::atomic<int> jobs_pending_{0};
+  bool stopped_ = false;
+  std::thread thread_;
+};
+
+/// @brief The entries of a `Menu`, in the order of a RowIndex.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// IndexedEntries entries(&names, &index);
+/// auto menu = Menu(&entries, &selected, {.virtualized = true});
+/// ```
+class IndexedEntries : public ConstStringListRef::Adapter {
+ public:
+  IndexedEntries(const std::vector<std::string>* entries, RowIndex* index)
+      : entries_(entries), index_(index) {}
+  size_t size() const override { return index_->size(); }
+  std::string operator[](size_t i) const override {
+    return (*entries_)[(*index_)[i]];
+  }
+
+ private:
+  const std::vector<std::string>* entries_;
+  RowIndex* index_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_ROW_INDEX_HPP
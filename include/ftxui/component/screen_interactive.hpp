@@ -4,18 +4,25 @@
 #ifndef FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 #define FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 
-#include <atomic>                        // for atomic
+#include <cstddef>                       // for size_t
 #include <ftxui/component/receiver.hpp>  // for Receiver, Sender
 #include <functional>                    // for function
+#include <map>                           // for multimap
 #include <memory>                        // for shared_ptr
 #include <string>                        // for string
-#include <thread>                        // for thread
+#include <string_view>                   // for string_view
 #include <variant>                       // for variant
+#include <vector>                        // for vector
 
 #include "ftxui/component/animation.hpp"       // for TimePoint
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
+#include "ftxui/component/component_profiler.hpp"  // for ComponentProfiler
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/task.hpp"            // for Task, Closure
+#include "ftxui/dom/elements.hpp"              // for Element
+#include "ftxui/dom/node_arena.hpp"            // for NodeArena
+#include "ftxui/dom/node_profiler.hpp"         // for NodeProfiler
+#include "ftxui/screen/cell_buffer.hpp"        // for CellBuffer
 #include "ftxui/screen/screen.hpp"             // for Screen
 
 namespace ftxui {
@@ -25,6 +32,41 @@ struct Event;
 
 using Component = std::shared_ptr<ComponentBase>;
 class ScreenInteractivePrivate;
+class SessionRecording;
+
+// Where the time went while drawing a frame. See
+// ScreenInteractive::CollectFrameStats().
+struct FrameStats {
+  animation::Duration render{};     // Component::Render().
+  animation::Duration layout{};     // Computing the requirements and boxes.
+  animation::Duration draw{};       // Drawing the elements on the screen.
+  animation::Duration shader{};     // Screen::ApplyShader().
+  animation::Duration serialize{};  // Producing the terminal sequences.
+  animation::Duration write{};      // Writing them to the terminal.
+  animation::Duration total{};      // The sum of the above.
+  int layout_iterations = 0;
+  size_t nodes = 0;  // The elements built by Component::Render().
+  size_t bytes = 0;  // The bytes written to the terminal.
+  size_t tasks = 0;  // The tasks handled since the previous frame.
+};
+
+// Counters aggregated over a period, to be forwarded to a monitoring system.
+// See ScreenInteractive::ExportMetrics().
+struct FrameMetrics {
+  animation::Duration period{};  // The time covered.
+  size_t frames_rendered = 0;
+  // The frames held back by LimitFrameRate() or by a busy terminal, merging
+  // the updates that followed, and the frames replaced by newer ones before
+  // being written.
+  size_t frames_skipped = 0;
+  animation::Duration frame_time_p50{};  // See FrameStats::total.
+  animation::Duration frame_time_p99{};
+  size_t tasks = 0;            // The events and closures handled.
+  size_t tasks_coalesced = 0;  // Merged into others. See CoalesceTasks().
+  size_t task_queue_high_water = 0;  // The most tasks pending at once.
+  size_t bytes = 0;                  // Written to the terminal.
+  size_t write_stalls = 0;  // The frames waiting for the terminal.
+};
 
 class ScreenInteractive : public Screen {
  public:
@@ -35,9 +77,38 @@ class ScreenInteractive : public Screen {
   static ScreenInteractive FullscreenAlternateScreen();
   static ScreenInteractive FitComponent();
   static ScreenInteractive TerminalOutput();
+  static ScreenInteractive Headless(int dimx, int dimy);
+
+  // Drive a Headless() screen. From the thread running the loop.
+  void HeadlessInput(std::string_view input);
+  std::string HeadlessOutput();
+  void HeadlessAdvanceTime(animation::Duration duration);
 
   // Options. Must be called before Loop().
   void TrackMouse(bool enable = true);
+  void ThrottleMouseMotion(bool enable = true);
+  void UseNodeArena(bool enable = true);
+  void UseNodeProfiler(NodeProfiler* profiler);
+  void UseComponentProfiler(ComponentProfiler* profiler);
+  void RecordSession(SessionRecording* recording);
+  void CoalesceTasks(bool enable = true);
+  void LimitFrameRate(float max_frame_rate);
+  void ExternalEventLoop(bool enable = true);
+  void ReadInputOnLoopThread(bool enable = true);
+  void ThreadedOutput(bool enable = true);
+  void ProbeTerminal(bool enable = true);
+  void DropStaleFrames(bool enable = true);
+  void CollectFrameStats(bool enable = true);
+  void OnFrameStats(std::function<void(const FrameStats&)> on_frame);
+  void ExportMetrics(animation::Duration period,
+                     std::function<void(const FrameMetrics&)> on_metrics);
+  void ExportCells(bool enable = true);
+
+  // The statistics of the last frame, when collected.
+  const FrameStats& LastFrameStats() const;
+
+  // The cells of the last frame, when exported.
+  const CellBuffer& ExportedCells() const;
 
   // Return the currently active screen, nullptr if none.
   static ScreenInteractive* Active();
@@ -50,7 +121,23 @@ class ScreenInteractive : public Screen {
   // Post tasks to be executed by the loop.
   void Post(Task task);
   void PostEvent(Event event);
+  void PostEvent(const Component& target, Event event);
   void RequestAnimationFrame();
+  void RequestCursorPosition();
+  void AfterNextFrame(Closure closure);
+
+  // Print |element| once above the frame, in the scrollback of the terminal.
+  void Commit(Element element);
+
+  // Run |closure| on the loop thread after |delay|, or every |period|. Return
+  // an id for ClearTimer().
+  int SetTimeout(Closure closure, animation::Duration delay);
+  int SetInterval(Closure closure, animation::Duration period);
+  void ClearTimer(int id);
+
+  // Run |work| on a background thread, then |on_done| on the loop thread.
+  void Async(Closure work, Closure on_done = nullptr);
+  void BackgroundThreads(int count);
 
   CapturedMouse CaptureMouse();
 
@@ -61,20 +148,37 @@ class ScreenInteractive : public Screen {
 
  private:
   void ExitNow();
+  bool InputOnLoopThread() const;
+  int InputFileDescriptor() const;
+  int WakeUpFileDescriptor() const;
 
   void Install();
+  void InstallSession();
+  void InstallTerminal();
+  void Deactivate();
   void Uninstall();
 
   void PreMain();
   void PostMain();
 
   bool HasQuitted();
-  void RunOnce(Component component);
+  void RunOnce(Component component,
+               animation::TimePoint deadline = animation::TimePoint::max());
+  animation::TimePoint NextDeadline() const;
+  animation::TimePoint Now() const;
+  bool FrameDeferred() const;
+  bool OutputBacklogged() const;
+  void RunTimers(std::vector<Task>* tasks);
   void RunOnceBlocking(Component component);
 
   void HandleTask(Component component, Task& task);
   void Draw(Component component);
+  void ReportMetrics();
+  Dimensions TerminalSize();
   void ResetCursorPosition();
+  void ReleaseFrames();
+  void StopOutputThread();
+  std::string UpdateMouseMotionMode();
 
   void Signal(int signal);
 
@@ -90,32 +194,108 @@ class ScreenInteractive : public Screen {
   ScreenInteractive(int dimx,
                     int dimy,
                     Dimension dimension,
-                    bool use_alternative_screen);
+                    bool use_alternative_screen,
+                    bool headless = false);
+
+  // Not attached to the terminal. See Headless().
+  bool headless_ = false;
+  std::string headless_input_;
+  std::string headless_output_;
+  animation::TimePoint headless_time_;
 
   bool track_mouse_ = true;
+  // Whether the motions without a button pressed are only reported while the
+  // mouse is captured, and whether they currently are.
+  bool throttle_mouse_motion_ = false;
+  bool any_motion_reported_ = false;
+  bool use_node_arena_ = false;
+  bool coalesce_tasks_ = false;
+  bool external_event_loop_ = false;
+  bool read_input_on_loop_thread_ = false;
+  bool probe_terminal_ = false;
+
+  // The frames are drawn at least |min_frame_interval_| apart, unless they
+  // follow an input event.
+  animation::Duration min_frame_interval_ = animation::Duration(0);
+  animation::TimePoint previous_frame_time_;
+  bool input_handled_ = false;
+  NodeArena node_arena_;
+  NodeProfiler* node_profiler_ = nullptr;
+  ComponentProfiler* component_profiler_ = nullptr;
+  SessionRecording* session_recording_ = nullptr;
 
   Sender<Task> task_sender_;
   Receiver<Task> task_receiver_;
+  std::vector<Task> tasks_;
+  std::vector<Element> committed_;
+  std::vector<Closure> after_next_frame_;
 
   std::string set_cursor_position;
   std::string reset_cursor_position;
 
-  std::atomic<bool> quit_ = false;
-  std::thread event_listener_;
-  std::thread animation_listener_;
   bool animation_requested_ = false;
   animation::TimePoint previous_animation_time_;
+  animation::TimePoint animation_deadline_;
+
+  // The timers, by deadline. See SetTimeout().
+  struct Timer {
+    int id = 0;
+    animation::Duration period{};  // Zero for a timeout.
+    Closure closure;
+  };
+  std::multimap<animation::TimePoint, Timer> timers_;
+  int next_timer_id_ = 0;
 
   int cursor_x_ = 1;
   int cursor_y_ = 1;
 
   bool mouse_captured = false;
   bool previous_frame_resized_ = false;
+  bool cursor_position_stale_ = true;
 
   bool frame_valid_ = false;
 
-  // The style of the cursor to restore on exit.
-  int cursor_reset_shape_ = 1;
+  // Cached, until the terminal is resized.
+  Dimensions terminal_size_ = {0, 0};
+  bool terminal_size_valid_ = false;
+
+  // The last frame printed to the terminal. When valid, only the cells that
+  // changed since are printed.
+  Screen previous_frame_ = Screen(0, 0);
+  bool previous_frame_valid_ = false;
+
+  // Writes the frames to the terminal, when `ThreadedOutput` is enabled.
+  class OutputThread;
+  bool threaded_output_ = false;
+  bool drop_stale_frames_ = false;
+  std::shared_ptr<OutputThread> output_thread_;
+
+  bool collect_frame_stats_ = false;
+  FrameStats frame_stats_;
+  size_t tasks_handled_ = 0;  // Since the previous frame.
+  std::function<void(const FrameStats&)> on_frame_stats_;
+
+  // Aggregated until the end of the period of ExportMetrics().
+  std::function<void(const FrameMetrics&)> on_metrics_;
+  animation::Duration metrics_period_{};
+  animation::TimePoint metrics_start_;
+  FrameMetrics metrics_;
+  std::vector<animation::Duration> frame_times_;
+  bool frame_held_ = false;  // Whether the pending frame is skipped already.
+
+  // The frames are copied there, instead of being written to the terminal.
+  bool export_cells_ = false;
+  CellBuffer exported_cells_;
+
+  // Whether the terminal supports synchronized output (DEC mode 2026). Each
+  // frame is then displayed at once.
+  bool synchronized_output_ = false;
+
+  // Runs the work of Async(). Declared last, so that its threads are joined
+  // before the rest of the screen is destroyed.
+  class Executor;
+  int background_threads_ = 1;
+  std::shared_ptr<Executor> executor_;
 
   friend class Loop;
 
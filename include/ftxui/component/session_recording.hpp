@@ -0,0 +1,89 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_SESSION_RECORDING_HPP
+#define FTXUI_COMPONENT_SESSION_RECORDING_HPP
+
+#include <cstddef>      // for size_t
+#include <mutex>        // for mutex
+#include <optional>     // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/component/animation.hpp"  // for Duration, TimePoint
+
+namespace ftxui {
+
+class Loop;
+class ScreenInteractive;
+
+/// @brief A compact binary log of a ScreenInteractive session: the raw bytes
+/// read from the terminal, and the size of every frame written, with their
+/// time. It is filled by ScreenInteractive::RecordSession(), and replayed into
+/// a Headless() screen, turning a session into a deterministic benchmark.
+///
+/// The log starts with the "FTXR" magic and a version byte. Each record is a
+/// type byte, followed by LEB128 varints: the microseconds since the previous
+/// record, then for an input its length and its bytes, and for a frame its
+/// width, height and the number of bytes written.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// SessionRecording recording;
+/// screen.RecordSession(&recording);
+/// screen.Loop(component);
+/// std::ofstream("session.ftxr", std::ios::binary) << recording.Data();
+///
+/// // Later, in a benchmark:
+/// SessionRecording replayed(data);
+/// auto screen = ScreenInteractive::Headless(80, 24);
+/// Loop loop(&screen, component);
+/// replayed.Replay(&screen, &loop);
+/// ```
+class SessionRecording {
+ public:
+  struct Record {
+    enum class Type { Input, Frame };
+    Type type = Type::Input;
+    animation::Duration time{};  // Since the first record.
+    std::string input;           // Type::Input
+    int dimx = 0;                // Type::Frame
+    int dimy = 0;                // Type::Frame
+    size_t bytes = 0;            // Type::Frame
+  };
+
+  SessionRecording();
+  // A log previously returned by Data().
+  explicit SessionRecording(std::string data);
+  SessionRecording(const SessionRecording&) = delete;
+  SessionRecording& operator=(const SessionRecording&) = delete;
+
+  // Recording. Thread safe.
+  void RecordInput(std::string_view input);
+  void RecordFrame(int dimx, int dimy, size_t bytes);
+
+  // The encoded log.
+  std::string Data() const;
+
+  // The decoded log. Nothing when it is malformed.
+  std::optional<std::vector<Record>> Records() const;
+
+  // Feed the recorded input into the Headless() |screen| driven by |loop|,
+  // advancing its clock as the time passed while recording. Return false when
+  // the log is malformed.
+  bool Replay(ScreenInteractive* screen, Loop* loop) const;
+
+ private:
+  void Append(Record::Type type, animation::TimePoint now);
+
+  mutable std::mutex mutex_;
+  std::string data_;
+  std::optional<animation::TimePoint> previous_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_SESSION_RECORDING_HPP
@@ -0,0 +1,99 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_SHARED_STATE_HPP
+#define FTXUI_COMPONENT_SHARED_STATE_HPP
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <mutex>    // for mutex, lock_guard
+#include <utility>  // for move
+
+#include "ftxui/component/event.hpp"               // for Event
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+/// @brief A model updated by worker threads and displayed by the loop thread.
+///
+/// The workers mutate a back copy of the model with Update(). The first update
+/// following a publication posts a single Event::Custom to redraw the screen.
+/// The next ones are batched with it. When the frame reads the model, the back
+/// copy is published into the front one. This produces one task and one copy
+/// per frame, however many updates were made.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// SharedState<std::map<std::string, float>> prices(screen);
+///
+/// // From the feed thread, thousands of times per second:
+/// prices.Update([&](auto& prices) { prices[symbol] = price; });
+///
+/// // From the loop thread:
+/// auto table = Renderer([&] { return Table(prices.Get()); });
+/// auto memo = Memo(table, [&] { return prices.version(); });
+/// ```
+template <typename T>
+class SharedState {
+ public:
+  explicit SharedState(ScreenInteractive& screen, T initial = T())
+      : screen_(&screen), front_(initial), back_(std::move(initial)) {}
+
+  SharedState(const SharedState&) = delete;
+  SharedState& operator=(const SharedState&) = delete;
+
+  // Apply |mutation| to the back model. It can be called from any thread.
+  template <typename Mutation>
+  void Update(Mutation mutation) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      mutation(back_);
+      pending_ = true;
+      if (scheduled_) {
+        return;
+      }
+      scheduled_ = true;
+    }
+    screen_->PostEvent(Event::Custom);
+  }
+
+  // The model, including every update made so far. Only from the loop thread.
+  const T& Get() {
+    Publish();
+    return front_;
+  }
+
+  // Incremented every time updates are published. Only from the loop thread.
+  size_t version() {
+    Publish();
+    return version_;
+  }
+
+ private:
+  void Publish() {
+    if (!pending_) {
+      return;
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    front_ = back_;
+    pending_ = false;
+    scheduled_ = false;
+    ++version_;
+  }
+
+  ScreenInteractive* screen_;
+  T front_;
+  size_t version_ = 0;
+
+  std::mutex mutex_;
+  T back_;
+  std::atomic<bool> pending_{false};
+  bool scheduled_ = false;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_SHARED_STATE_HPP
@@ -5,13 +5,44 @@
 #define FTXUI_COMPONENT_ANIMATION_HPP
 
 #include <functional>
+#include <memory>
 #include <variant>
 #include "ftxui/component/event.hpp"
 
 namespace ftxui {
+class ComponentBase;
 class AnimationTask {};
 using Closure = std::function<void()>;
-using Task = std::variant<Event, Closure, AnimationTask>;
+
+// A closure superseded by any later one with the same |key|, when the tasks
+// are coalesced. Otherwise, the same as a Closure.
+// See ScreenInteractive::CoalesceTasks.
+struct LatestClosure {
+  int key = 0;
+  Closure closure;
+};
+
+// An event delivered to |target| only, instead of the whole component tree.
+// It is dropped if |target| was destroyed in the meantime.
+// See ScreenInteractive::PostEvent.
+struct TargetedEvent {
+  std::weak_ptr<ComponentBase> target;
+  Event event;
+};
+
+// A closure for low priority work, handled after the other pending tasks: the
+// input, the closures and the animation frames.
+// See ScreenInteractive::Post.
+struct BackgroundClosure {
+  Closure closure;
+};
+
+using Task = std::variant<Event,
+                          Closure,
+                          AnimationTask,
+                          LatestClosure,
+                          TargetedEvent,
+                          BackgroundClosure>;
 }  // namespace ftxui
 
 #endif  // FTXUI_COMPONENT_ANIMATION_HPP
@@ -0,0 +1,73 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_TEXT_BUFFER_HPP
+#define FTXUI_COMPONENT_TEXT_BUFFER_HPP
+
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+namespace ftxui {
+
+/// @brief A text, stored as a list of lines. It is meant to be edited by the
+/// `Input` component, through `InputOption::buffer`, when the text is too large
+/// to be copied on every keystroke.
+///
+/// The lines are grouped in blocks. Each block knows where it starts, so that
+/// a line can be found from its index or from a byte offset without walking the
+/// whole text. Editing only touches the lines involved.
+///
+/// Offsets are expressed in bytes, as if the lines were joined by '\n'.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// TextBuffer buffer(LoadFile("config.json"));
+/// auto input = Input({.buffer = &buffer});
+/// ```
+class TextBuffer {
+ public:
+  TextBuffer();
+  explicit TextBuffer(const std::string& text);
+
+  // The whole text, joined by '\n'.
+  std::string str() const;
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  // There is always at least one line.
+  size_t LineCount() const { return line_count_; }
+  const std::string& Line(size_t line) const;
+  // The offset of the first character of |line|.
+  size_t LineStart(size_t line) const;
+  // The line containing |offset|. The '\n' belongs to the line it ends.
+  size_t LineOf(size_t offset) const;
+
+  void Insert(size_t offset, const std::string& text);
+  void Erase(size_t offset, size_t count);
+
+ private:
+  struct Block {
+    std::vector<std::string> lines;
+    size_t bytes = 0;  // Including one '\n' per line.
+    size_t first_line = 0;
+    size_t first_byte = 0;
+  };
+
+  size_t BlockOfLine(size_t line) const;
+  void Locate(size_t offset, size_t* block, size_t* index, size_t* column)
+      const;
+  void Measure(size_t block);
+  void Split(size_t block);
+  void Update(size_t block);
+
+  std::vector<Block> blocks_;
+  size_t line_count_ = 1;
+  size_t size_ = 0;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_TEXT_BUFFER_HPP
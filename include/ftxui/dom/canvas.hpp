@@ -4,10 +4,12 @@
 #ifndef FTXUI_DOM_CANVAS_HPP
 #define FTXUI_DOM_CANVAS_HPP
 
-#include <cstddef>        // for size_t
-#include <functional>     // for function
-#include <string>         // for string
-#include <unordered_map>  // for unordered_map
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t, uint32_t
+#include <functional>  // for function
+#include <string>      // for string
+#include <vector>      // for vector
 
 #include "ftxui/screen/color.hpp"   // for Color
 #include "ftxui/screen/screen.hpp"  // for Pixel
@@ -55,6 +57,20 @@ struct Canvas {
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Color& color);
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Stylizer& s);
 
+  // Draws many dots at once. The style is computed once per distinct cell
+  // style, instead of once per dot. Large scatters are drawn on several
+  // threads.
+  struct Point {
+    int x = 0;
+    int y = 0;
+  };
+  void DrawPointPolyline(const std::vector<Point>& points);
+  void DrawPointPolyline(const std::vector<Point>& points, const Stylizer& s);
+  void DrawPointPolyline(const std::vector<Point>& points, const Color& color);
+  void DrawPointScatter(const std::vector<Point>& points);
+  void DrawPointScatter(const std::vector<Point>& points, const Stylizer& s);
+  void DrawPointScatter(const std::vector<Point>& points, const Color& color);
+
   // Draw using box characters -------------------------------------------------
   // Block are of size 1x2. y is considered to be a multiple of 2.
   void DrawBlockOn(int x, int y);
@@ -86,6 +102,9 @@ struct Canvas {
                               int r1,
                               int r2,
                               const Color& color);
+  void DrawBlockPolyline(const std::vector<Point>& points);
+  void DrawBlockPolyline(const std::vector<Point>& points, const Stylizer& s);
+  void DrawBlockPolyline(const std::vector<Point>& points, const Color& color);
 
   // Draw using normal characters ----------------------------------------------
   // Draw using character of size 2x4 at position (x,y)
@@ -95,42 +114,93 @@ struct Canvas {
   void DrawText(int x, int y, const std::string& value, const Color& color);
   void DrawText(int x, int y, const std::string& value, const Stylizer& style);
 
+  // Draw an image -------------------------------------------------------------
+  // Draw a raster of RGB pixels, 3 bytes each, with |stride| bytes in between
+  // two rows. A cell displays two pixels stacked, using "▀".
+  // x is considered to be a multiple of 2.
+  // y is considered to be a multiple of 4.
+  void DrawImage(int x,
+                 int y,
+                 const uint8_t* rgb,
+                 int width,
+                 int height,
+                 int stride);
+
   // Decorator:
   // x is considered to be a multiple of 2.
   // y is considered to be a multiple of 4.
   void Style(int x, int y, const Stylizer& style);
+  // Modify every cell of a rectangle. The Stylizer runs once per distinct
+  // style, instead of once per cell.
+  void Style(int x, int y, int width, int height, const Stylizer& style);
+
+  // Incremental updates -------------------------------------------------------
+  // A Canvas can be kept across frames, and passed by pointer to `canvas()`.
+  // Only the parts that changed need to be drawn again.
+  void Clear();
+  void Clear(int x, int y, int width, int height);
+  // Move the content by (dx, dy). The area uncovered is cleared.
+  // dx is considered to be a multiple of 2.
+  // dy is considered to be a multiple of 4.
+  void Scroll(int dx, int dy);
 
  private:
   bool IsIn(int x, int y) const {
     return x >= 0 && x < width_ && y >= 0 && y < height_;
   }
-  enum CellType {
+  enum CellType : uint8_t {
     kBraille,
     kBlock,
     kText,
   };
+
+  // A cell is 2x4 braille dots. The dots, or the 2x2 blocks, are stored as a
+  // bit pattern, so that drawing them does not touch any string. The colors and
+  // the text are stored once in |styles_|, and referenced by index.
   struct Cell {
     CellType type = kText;
-    Pixel content;
-  };
-  struct XY {
-    int x;
-    int y;
-    bool operator==(const XY& other) const {
-      return x == other.x && y == other.y;
-    }
+    uint8_t bits = 0;
+    uint32_t style = 0;
   };
 
-  struct XYHash {
-    size_t operator()(const XY& xy) const {
-      constexpr size_t shift = 1024;
-      return size_t(xy.x) * shift + size_t(xy.y);
-    }
+  Cell* CellAt(int x, int y) {
+    return &cells_[size_t(y) / 4 * size_t(cells_x_) + size_t(x) / 2];
+  }
+  void SetStyle(Cell* cell, const Pixel& pixel);
+  void CompactStyles();
+
+  // Remembers the styles produced by a Stylizer, indexed by the style it was
+  // applied to. The entries store the index plus one, 0 meaning empty.
+  struct StyleMemo {
+    static constexpr size_t kSize = 16;
+    uint32_t epoch = 0;
+    uint32_t last = 0;
+    std::array<uint32_t, kSize> from = {};
+    std::array<uint32_t, kSize> to = {};
   };
+  void Style(Cell* cell, const Stylizer& style, StyleMemo* memo);
+  void DrawPoint(int x,
+                 int y,
+                 bool value,
+                 const Stylizer& style,
+                 StyleMemo* memo);
+  void DrawBlock(int x,
+                 int y,
+                 bool value,
+                 const Stylizer& style,
+                 StyleMemo* memo);
+  void DrawPointsOn(const std::vector<Point>& points,
+                    CellType type,
+                    bool connected,
+                    const Stylizer* style);
 
   int width_ = 0;
   int height_ = 0;
-  std::unordered_map<XY, Cell, XYHash> storage_;
+  int cells_x_ = 0;
+  int cells_y_ = 0;
+  std::vector<Cell> cells_;
+  std::vector<Pixel> styles_{Pixel()};
+  uint32_t styles_epoch_ = 0;  // Incremented when |styles_| is compacted.
 };
 
 }  // namespace ftxui
@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <string_view>
 
 #include "ftxui/dom/canvas.hpp"
 #include "ftxui/dom/direction.hpp"
@@ -20,6 +21,9 @@
 
 namespace ftxui {
 class Node;
+class MeasuredText;
+class InternedString;
+class TimeSeries;
 using Element = std::shared_ptr<Node>;
 using Elements = std::vector<Element>;
 using Decorator = std::function<Element(Element)>;
@@ -45,7 +49,14 @@ Decorator operator|(Decorator, Decorator);
 
 // --- Widget ---
 Element text(std::string text);
+Element text(std::shared_ptr<const MeasuredText> text);
+Element text(InternedString text);
 Element vtext(std::string text);
+Element textLines(std::vector<std::string> lines);
+// Non-owning: |text| must outlive the rendering of the element.
+Element textView(std::string_view text);
+Element vtextView(std::string_view text);
+Element maskedText(int width, std::string glyph = "•");
 Element separator();
 Element separatorLight();
 Element separatorDashed();
@@ -69,6 +80,11 @@ Element gaugeRight(float progress);
 Element gaugeUp(float progress);
 Element gaugeDown(float progress);
 Element gaugeDirection(float progress, Direction direction);
+Element gauges(std::vector<float> progress,
+               std::vector<std::string> labels = {});
+Element gaugesDirection(std::vector<float> progress,
+                        std::vector<std::string> labels,
+                        Direction direction);
 Element border(Element);
 Element borderLight(Element);
 Element borderDashed(Element);
@@ -87,7 +103,9 @@ Element paragraphAlignLeft(const std::string& text);
 Element paragraphAlignRight(const std::string& text);
 Element paragraphAlignCenter(const std::string& text);
 Element paragraphAlignJustify(const std::string& text);
+Element paragraphView(std::string_view text);
 Element graph(GraphFunction);
+Element graph(std::shared_ptr<const TimeSeries> series);
 Element emptyElement();
 Element canvas(ConstRef<Canvas>);
 Element canvas(int width, int height, std::function<void(Canvas&)>);
@@ -109,6 +127,8 @@ Element color(Color, Element);
 Element bgcolor(Color, Element);
 Element color(const LinearGradient&, Element);
 Element bgcolor(const LinearGradient&, Element);
+Decorator style(const PixelStyle&);
+Element style(const PixelStyle&, Element);
 Decorator focusPosition(int x, int y);
 Decorator focusPositionRelative(float x, float y);
 Element automerge(Element child);
@@ -123,6 +143,16 @@ Element dbox(Elements);
 Element flexbox(Elements, FlexboxConfig config = FlexboxConfig());
 Element gridbox(std::vector<Elements> lines);
 
+// A vertical list of |size| rows, one cell tall. Only the visible rows are
+// built, by calling |row|.
+Element virtualList(int size,
+                    std::function<Element(int)> row,
+                    int selected = 0);
+
+// An element requiring the size of |hint|, built by calling |build| only once
+// it is visible.
+Element lazy(Requirement hint, std::function<Element()> build);
+
 Element hflow(Elements);  // Helper: default flexbox with row direction.
 Element vflow(Elements);  // Helper: default flexbox with column direction.
 
@@ -148,6 +178,9 @@ Element filler();          // A blank expandable element.
 enum WidthOrHeight { WIDTH, HEIGHT };
 enum Constraint { LESS_THAN, EQUAL, GREATER_THAN };
 Decorator size(WidthOrHeight, Constraint, int value);
+// Like size(WIDTH, EQUAL, width) | size(HEIGHT, EQUAL, height), without
+// measuring the element. Only for the elements laid out from their box alone.
+Decorator fixedSize(int width, int height);
 
 // --- Frame ---
 // A frame is a scrollable area. The internal area is potentially larger than
@@ -175,6 +208,15 @@ Decorator reflect(Box& box);
 // Before drawing the |element| clear the pixel below. This is useful in
 // combinaison with dbox.
 Element clear_under(Element element);
+// Keep the pixels drawn by |element| in between frames, and copy them back
+// when it is drawn again at the same place.
+Element retained(Element element);
+// Draw |element| once into an offscreen Screen, and copy its pixels on the
+// following frames, until the |key| or the dimensions change.
+Decorator cached(size_t key);
+// Allow |element| to be rendered concurrently with its siblings also
+// decorated with `parallel`.
+Element parallel(Element element);
 
 // --- Util --------------------------------------------------------------------
 Element hcenter(Element);
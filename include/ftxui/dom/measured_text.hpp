@@ -0,0 +1,90 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_MEASURED_TEXT_HPP
+#define FTXUI_DOM_MEASURED_TEXT_HPP
+
+#include <memory>       // for shared_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/util/ref.hpp"  // for ConstStringRef
+
+namespace ftxui {
+
+/// @brief A string, split into its glyphs and measured once. Displaying it with
+/// `text(measured_text)` doesn't decode it again.
+///
+/// This is meant for the labels displayed on every frame. `Intern` returns the
+/// same MeasuredText for the same string, for the lifetime of the program.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// static const auto label = MeasuredText::Make("Save");
+/// Element document = hbox({text(label), text(MeasuredText::Intern("Quit"))});
+/// ```
+class MeasuredText {
+ public:
+  static std::shared_ptr<const MeasuredText> Make(std::string text);
+  static std::shared_ptr<const MeasuredText> Intern(std::string_view text);
+
+  explicit MeasuredText(std::string text);
+
+  // The glyphs are views inside the text, so it can't be copied.
+  MeasuredText(const MeasuredText&) = delete;
+  MeasuredText& operator=(const MeasuredText&) = delete;
+
+  const std::string& str() const { return text_; }
+  int width() const { return width_; }
+  // The glyphs, as Utf8Glyphs produces them.
+  const std::vector<std::string_view>& glyphs() const { return glyphs_; }
+
+ private:
+  const std::string text_;
+  int width_ = 0;
+  std::vector<std::string_view> glyphs_;
+};
+
+/// @brief A handle to an interned MeasuredText: the same string always gives
+/// the same one, measured the first time, and kept until the end of the
+/// program. Copying it, or displaying it with `text(interned)`, only copies a
+/// pointer. It can be given to the components as their label.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// static const InternedString save("Save");
+/// auto button = Button(save, on_save);
+/// Element unit = text(InternedString("ms"));
+/// ```
+class InternedString {
+ public:
+  InternedString() : InternedString(std::string_view()) {}
+  explicit InternedString(std::string_view text);
+
+  const MeasuredText& measured() const { return *text_; }
+  const std::string& str() const { return text_->str(); }
+  int width() const { return text_->width(); }
+
+  // Interned strings are equal when they are the same.
+  bool operator==(const InternedString& other) const {
+    return text_ == other.text_;
+  }
+  bool operator!=(const InternedString& other) const {
+    return text_ != other.text_;
+  }
+
+ private:
+  const MeasuredText* text_;
+};
+
+inline ConstStringRef::ConstStringRef(const InternedString& ref)
+    : ConstStringRef(&ref.str()) {}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_MEASURED_TEXT_HPP
@@ -4,8 +4,12 @@
 #ifndef FTXUI_DOM_NODE_HPP
 #define FTXUI_DOM_NODE_HPP
 
-#include <memory>  // for shared_ptr
-#include <vector>  // for vector
+#include <chrono>       // for steady_clock
+#include <cstddef>      // for size_t
+#include <functional>   // for function
+#include <memory>       // for shared_ptr
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -15,6 +19,7 @@ namespace ftxui {
 
 class Node;
 class Screen;
+struct ElementMemory;
 
 using Element = std::shared_ptr<Node>;
 using Elements = std::vector<Element>;
@@ -39,6 +44,7 @@ class Node {
   // Step 2: Assign this element its final dimensions.
   //         Propagated from Parents to Children.
   virtual void SetBox(Box box);
+  const Box& box() const { return box_; }
 
   // Step 3: Draw this element.
   virtual void Render(Screen& screen);
@@ -52,14 +58,68 @@ class Node {
   };
   virtual void Check(Status* status);
 
+  // The same as ComputeRequirement(), SetBox() and Check(), used to lay out
+  // the children. After the first iteration, the subtrees whose layout
+  // converged, and given the same box again, are skipped: only the ones
+  // requesting another iteration, and their ancestors, are laid out again.
+  void UpdateRequirement();
+  void UpdateBox(Box box);
+  void UpdateCheck(Status* status);
+
+  // Whether this element can be rendered concurrently with its siblings. See
+  // ftxui::parallel.
+  virtual bool IsParallel() const { return false; }
+
+  // The part of its box this element covers entirely, hiding whatever was
+  // drawn below, like `clear_under`. By default, the largest one of its
+  // children. Used by `dbox` to skip the hidden layers.
+  virtual Box OpaqueBox() const;
+
+  // Add this element and its children to |usage|. See ftxui::MemoryUsage.
+  virtual void MemoryUsage(ElementMemory* usage) const;
+
  protected:
   Elements children_;
   Requirement requirement_;
   Box box_;
+
+ private:
+  // Whether the layout of this subtree converged, in the last iteration.
+  bool converged_ = false;
+};
+
+// What Render() did, and how long it took.
+struct RenderStats {
+  int layout_iterations = 0;
+  std::chrono::steady_clock::duration layout{};  // Steps 1 and 2.
+  std::chrono::steady_clock::duration draw{};    // Step 3.
+  std::chrono::steady_clock::duration shader{};  // Screen::ApplyShader().
+};
+
+// The memory used by an element tree. The elements shared by several parents
+// are counted once per parent.
+struct ElementMemory {
+  size_t nodes = 0;
+  size_t bytes = 0;    // The nodes, and everything they allocated.
+  size_t strings = 0;  // The characters of the texts, included in |bytes|.
 };
 
+ElementMemory MemoryUsage(const Element& element);
+
 void Render(Screen& screen, const Element& element);
 void Render(Screen& screen, Node* node);
+void Render(Screen& screen, Node* node, RenderStats* stats);
+
+// Render |element| over |dimx| columns, as tall as it requires, and stream it
+// to |sink| like Screen::ToString(sink). It is drawn in bands of |band_rows|
+// rows, so the memory used doesn't grow with its height.
+void RenderTiled(const Element& element,
+                 int dimx,
+                 int band_rows,
+                 const std::function<void(std::string_view)>& sink);
+
+// The number of nodes constructed by the calling thread so far.
+size_t NodesConstructed();
 
 }  // namespace ftxui
 
@@ -0,0 +1,184 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_NODE_ARENA_HPP
+#define FTXUI_DOM_NODE_ARENA_HPP
+
+#include <cstddef>   // for size_t
+#include <memory>    // for shared_ptr, allocate_shared, make_shared, allocator
+#include <typeinfo>  // for type_info
+#include <utility>   // for forward
+
+#include "ftxui/dom/node_profiler.hpp"  // for NodeProfiler
+
+namespace ftxui {
+
+/// @brief Memory reused to allocate Nodes. While a NodeArena::Scope is alive,
+/// the Nodes created on its thread are carved out of large contiguous blocks,
+/// instead of being allocated one by one.
+///
+/// Nodes allocated from an arena remain valid for as long as they are
+/// referenced. The memory is reused by the next Scope, once all of them have
+/// been destroyed.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// NodeArena arena;
+/// while (running) {
+///   NodeArena::Scope scope(&arena);
+///   Element document = BuildDocument();
+///   Render(screen, document);
+/// }
+/// ```
+class NodeArena {
+ public:
+  NodeArena();
+  ~NodeArena();
+  NodeArena(const NodeArena&) = delete;
+  NodeArena(NodeArena&&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+  NodeArena& operator=(NodeArena&&) = delete;
+
+  // Make |arena| the current arena of the calling thread, until destroyed.
+  // nullptr means Nodes are allocated individually.
+  class Scope {
+   public:
+    explicit Scope(NodeArena* arena);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+   private:
+    NodeArena* previous_;
+  };
+
+  // The memory. It counts its references itself: one for the arena, and one
+  // for each allocation not deallocated yet. It is deleted with the last one.
+  class Buffer;
+  static void* Allocate(Buffer& buffer, size_t size, size_t alignment);
+  static void Deallocate(Buffer& buffer);
+
+  // Return the current arena of the calling thread, nullptr if none.
+  static NodeArena* Current();
+  Buffer* buffer() const { return buffer_; }
+
+ private:
+  void Reuse();
+  Buffer* buffer_ = nullptr;
+};
+
+/// @brief An allocator taking its memory from a NodeArena::Buffer.
+/// Deallocation only releases a reference to the Buffer: the memory is
+/// released with it.
+///
+/// It holds a plain pointer, so that the copies std::allocate_shared makes
+/// do not touch any reference count. Only allocate() and deallocate() do.
+/// @ingroup dom
+template <class T>
+class NodeArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit NodeArenaAllocator(NodeArena::Buffer* buffer) : buffer_(buffer) {}
+  template <class U>
+  NodeArenaAllocator(const NodeArenaAllocator<U>& other)  // NOLINT
+      : buffer_(other.buffer_) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(
+        NodeArena::Allocate(*buffer_, n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T* /*ptr*/, size_t /*n*/) { NodeArena::Deallocate(*buffer_); }
+
+  template <class U>
+  bool operator==(const NodeArenaAllocator<U>& other) const {
+    return buffer_ == other.buffer_;
+  }
+  template <class U>
+  bool operator!=(const NodeArenaAllocator<U>& other) const {
+    return buffer_ != other.buffer_;
+  }
+
+ private:
+  template <class U>
+  friend class NodeArenaAllocator;
+  NodeArena::Buffer* buffer_;
+};
+
+/// @brief An allocator recording the allocations of a Node of type |type|
+/// into a NodeProfiler. The memory comes from a NodeArena::Buffer if any.
+/// @ingroup dom
+template <class T>
+class NodeProfilerAllocator {
+ public:
+  using value_type = T;
+
+  NodeProfilerAllocator(NodeProfiler* profiler,
+                        const std::type_info* type,
+                        NodeArena::Buffer* buffer)
+      : profiler_(profiler), type_(type), buffer_(buffer) {}
+  template <class U>
+  NodeProfilerAllocator(const NodeProfilerAllocator<U>& other)  // NOLINT
+      : profiler_(other.profiler_),
+        type_(other.type_),
+        buffer_(other.buffer_) {}
+
+  T* allocate(size_t n) {
+    profiler_->Record(*type_, n * sizeof(T));
+    if (!buffer_) {
+      return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T*>(
+        NodeArena::Allocate(*buffer_, n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T* ptr, size_t n) {
+    if (!buffer_) {
+      std::allocator<T>().deallocate(ptr, n);
+      return;
+    }
+    NodeArena::Deallocate(*buffer_);
+  }
+
+  template <class U>
+  bool operator==(const NodeProfilerAllocator<U>& other) const {
+    return buffer_ == other.buffer_;
+  }
+  template <class U>
+  bool operator!=(const NodeProfilerAllocator<U>& other) const {
+    return buffer_ != other.buffer_;
+  }
+
+ private:
+  template <class U>
+  friend class NodeProfilerAllocator;
+  NodeProfiler* profiler_;
+  const std::type_info* type_;
+  NodeArena::Buffer* buffer_;
+};
+
+/// @brief Create a Node of type |T|. It is allocated from the current
+/// NodeArena if any, and recorded by the current NodeProfiler if any.
+/// @ingroup dom
+template <class T, class... Args>
+std::shared_ptr<T> MakeNode(Args&&... args) {
+  NodeArena* arena = NodeArena::Current();
+  if (NodeProfiler* profiler = NodeProfiler::Current()) {
+    return std::allocate_shared<T>(
+        NodeProfilerAllocator<T>(profiler, &typeid(T),
+                                 arena ? arena->buffer() : nullptr),
+        std::forward<Args>(args)...);
+  }
+  if (!arena) {
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<T>(NodeArenaAllocator<T>(arena->buffer()),
+                                 std::forward<Args>(args)...);
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_NODE_ARENA_HPP
@@ -0,0 +1,106 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_NODE_PROFILER_HPP
+#define FTXUI_DOM_NODE_PROFILER_HPP
+
+#include <cstddef>        // for size_t
+#include <string>         // for string
+#include <typeindex>      // for type_index
+#include <typeinfo>       // for type_info
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+namespace ftxui {
+
+/// @brief Count the Nodes created by MakeNode, and the bytes allocated for
+/// them, by type of Node and by label.
+///
+/// While a NodeProfiler::Scope is alive, the Nodes created on its thread are
+/// recorded. They are attributed to the innermost NodeProfiler::Label, which is
+/// usually opened by the `ProfileNodes` component decorator.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// NodeProfiler profiler;
+/// screen.UseNodeProfiler(&profiler);
+/// screen.Loop(ProfileNodes(component, "root"));
+/// std::cout << profiler.ToString();
+/// ```
+class NodeProfiler {
+ public:
+  struct Count {
+    size_t nodes = 0;
+    size_t bytes = 0;  // The allocations of MakeNode, control blocks included.
+  };
+  struct Entry {
+    std::string name;
+    Count count;
+  };
+
+  NodeProfiler();
+  NodeProfiler(const NodeProfiler&) = delete;
+  NodeProfiler& operator=(const NodeProfiler&) = delete;
+
+  // Make |profiler| the current profiler of the calling thread, until
+  // destroyed. A Scope is a frame: nullptr disables the profiling.
+  class Scope {
+   public:
+    explicit Scope(NodeProfiler* profiler);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    NodeProfiler* previous_;
+  };
+
+  // Attribute the Nodes created until destroyed to |name|. It has no effect
+  // without a current profiler.
+  class Label {
+   public:
+    explicit Label(const std::string& name);
+    ~Label();
+    Label(const Label&) = delete;
+    Label& operator=(const Label&) = delete;
+
+   private:
+    NodeProfiler* profiler_;
+    Count* previous_ = nullptr;
+  };
+
+  // Return the current profiler of the calling thread, nullptr if none.
+  static NodeProfiler* Current();
+
+  // Called by MakeNode.
+  void Record(const std::type_info& type, size_t bytes);
+
+  // The Nodes recorded since the last Clear(), sorted by decreasing bytes.
+  // The type names are demangled when possible. The Nodes created outside of
+  // any Label are reported with an empty name.
+  std::vector<Entry> ByType() const;
+  std::vector<Entry> ByLabel() const;
+  Count total() const { return total_; }
+  Count last_frame() const { return last_frame_; }
+  int frames() const { return frames_; }
+
+  void Clear();
+
+  // A human readable report of the above.
+  std::string ToString() const;
+
+ private:
+  std::unordered_map<std::type_index, Count> by_type_;
+  // The counts are never erased, so that the open Labels can point to them.
+  std::unordered_map<std::string, Count> by_label_;
+  Count* label_;
+  Count total_;
+  Count last_frame_;
+  int frames_ = 0;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_NODE_PROFILER_HPP
@@ -0,0 +1,99 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_PLOT_HPP
+#define FTXUI_DOM_PLOT_HPP
+
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
+#include "ftxui/dom/canvas.hpp"    // for Canvas
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+/// @brief Samples sorted by x, for `Plot::DrawSeries()`. The lowest and
+/// highest y of every block of 2, 4, 8... samples are computed once, so that
+/// the samples under a column of the canvas are summarized in O(log(size)),
+/// however many there are.
+///
+/// The blocks take as much memory as the y of the samples.
+/// @ingroup dom
+class PlotSeries {
+ public:
+  // |x| must be sorted in increasing order, and as long as |y|.
+  PlotSeries(std::vector<double> x, std::vector<double> y);
+
+  size_t size() const { return x_.size(); }
+  const std::vector<double>& x() const { return x_; }
+  const std::vector<double>& y() const { return y_; }
+
+  struct Range {
+    double low;
+    double high;
+  };
+
+  // The lowest and highest y of the samples [begin, end).
+  Range YRange(size_t begin, size_t end) const;
+
+ private:
+  std::vector<double> x_;
+  std::vector<double> y_;
+  // levels_[k][i] holds the range of the samples [i << (k + 1), (i + 1) <<
+  // (k + 1)).
+  std::vector<std::vector<Range>> levels_;
+};
+
+/// @brief Draw data, in its own coordinates, on a Canvas with braille dots.
+///
+/// The |viewport| of the data is stretched over the whole canvas, the y axis
+/// pointing up. The geometry is clipped against it before being rasterized,
+/// so that zooming in doesn't cost the parts outside. A series denser than
+/// the canvas is drawn as the lowest and highest sample under every column.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// PlotSeries samples(std::move(times), std::move(values));
+/// auto c = Canvas(100, 100);
+/// Plot plot(&c, {.x_min = t0, .x_max = t1, .y_min = -1.0, .y_max = 1.0});
+/// plot.DrawLine(t0, 0.0, t1, 0.0, Color::GrayDark);
+/// plot.DrawSeries(samples, Color::Green);
+/// Element chart = canvas(std::move(c));
+/// ```
+class Plot {
+ public:
+  struct Viewport {
+    double x_min = 0.0;
+    double x_max = 1.0;
+    double y_min = 0.0;
+    double y_max = 1.0;
+  };
+
+  Plot(Canvas* canvas, Viewport viewport);
+
+  // The dot of the canvas displaying the point of data (x, y).
+  double DotX(double x) const;
+  double DotY(double y) const;
+
+  void DrawLine(double x1, double y1, double x2, double y2);
+  void DrawLine(double x1, double y1, double x2, double y2, const Color& color);
+  void DrawLine(double x1,
+                double y1,
+                double x2,
+                double y2,
+                const Canvas::Stylizer& style);
+
+  void DrawSeries(const PlotSeries& series);
+  void DrawSeries(const PlotSeries& series, const Color& color);
+  void DrawSeries(const PlotSeries& series, const Canvas::Stylizer& style);
+
+ private:
+  Canvas* canvas_;
+  Viewport viewport_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_PLOT_HPP
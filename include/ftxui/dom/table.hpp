@@ -4,11 +4,16 @@
 #ifndef FTXUI_DOM_TABLE
 #define FTXUI_DOM_TABLE
 
-#include <memory>
-#include <string>  // for string
-#include <vector>  // for vector
+#include <functional>  // for function
+#include <memory>       // for shared_ptr
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, Decorator
+#include "ftxui/screen/screen.hpp"  // for PixelStyle
 
 namespace ftxui {
 
@@ -30,6 +35,18 @@ namespace ftxui {
 // table.SelectRow(1).SeparatorInternal(Light);
 //
 // std::move(table).Element();
+//
+// Styling:
+// --------
+//
+// The Style* methods record a PixelStyle for the selection. As opposed to the
+// Decorate* ones, they don't wrap the cells into decorator elements: the
+// styles are applied while the table is drawn, before the decorators.
+//
+// PixelStyle stripe;
+// stripe.fields = PixelStyle::kBackground;
+// stripe.background_color = Color::GrayDark;
+// table.SelectAll().StyleAlternateRow(stripe);
 
 class Table;
 class TableSelection;
@@ -53,8 +70,35 @@ class Table {
 
  private:
   void Initialize(std::vector<std::vector<Element>>);
+  void SetLine(int x, int y, std::string_view glyph);
   friend TableSelection;
+  friend class TableLine;
+  friend class TableStyles;
+
+  // The box drawing character of every line and corner of |elements_|, or an
+  // empty string. They are read by the TableLine elements drawing them.
+  using Glyphs = std::vector<std::vector<std::string>>;
+
+  // A style applied to the elements of |elements_| inside a rectangle, and
+  // matching the filters below.
+  struct StyleRule {
+    int x_min = 0;
+    int x_max = 0;
+    int y_min = 0;
+    int y_max = 0;
+    PixelStyle style;
+    bool odd_x = false;  // Only the cells and the horizontal lines.
+    bool odd_y = false;  // Only the cells and the vertical lines.
+    int x_modulo = 1;    // Only when (x / 2) % x_modulo == x_shift.
+    int x_shift = 0;
+    int y_modulo = 1;  // Only when (y / 2) % y_modulo == y_shift.
+    int y_shift = 0;
+    bool Contains(int x, int y) const;
+  };
+
   std::vector<std::vector<Element>> elements_;
+  std::vector<StyleRule> styles_;
+  std::shared_ptr<Glyphs> glyphs_;
   int input_dim_x_ = 0;
   int input_dim_y_ = 0;
   int dim_x_ = 0;
@@ -71,6 +115,16 @@ class TableSelection {
   void DecorateCellsAlternateColumn(Decorator, int modulo = 2, int shift = 0);
   void DecorateCellsAlternateRow(Decorator, int modulo = 2, int shift = 0);
 
+  void Style(const PixelStyle&);
+  void StyleAlternateRow(const PixelStyle&, int modulo = 2, int shift = 0);
+  void StyleAlternateColumn(const PixelStyle&, int modulo = 2, int shift = 0);
+
+  void StyleCells(const PixelStyle&);
+  void StyleCellsAlternateColumn(const PixelStyle&,
+                                 int modulo = 2,
+                                 int shift = 0);
+  void StyleCellsAlternateRow(const PixelStyle&, int modulo = 2, int shift = 0);
+
   void Border(BorderStyle border = LIGHT);
   void BorderLeft(BorderStyle border = LIGHT);
   void BorderRight(BorderStyle border = LIGHT);
@@ -83,6 +137,7 @@ class TableSelection {
 
  private:
   friend Table;
+  Table::StyleRule Rule(const PixelStyle& style) const;
   Table* table_;
   int x_min_;
   int x_max_;
@@ -90,6 +145,66 @@ class TableSelection {
   int y_max_;
 };
 
+// A table with |rows| rows, one cell tall, whose cells are built on demand by
+// |cell(row, column)|, only for the rows visible inside a `frame`.
+//
+// The number of columns is |widths.size()|. A width of 0 or less is computed
+// from a sample of the rows.
+Element virtualTable(int rows,
+                     std::vector<int> widths,
+                     std::function<Element(int row, int column)> cell,
+                     int selected = 0);
+
+// Resolve the widths of 0 or less, the same way |virtualTable| does. This is
+// useful to build a header aligned with the table.
+std::vector<int> virtualTableWidths(
+    int rows,
+    std::vector<int> widths,
+    const std::function<Element(int row, int column)>& cell);
+
+// A column of a `dataTable`, whose cells are formatted while they are drawn.
+// The values are not copied: they must outlive the element.
+class DataColumn {
+ public:
+  enum Align { Left, Center, Right };
+
+  // Append the text of the cell at |row| to |output|.
+  using Formatter = std::function<void(size_t row, std::string& output)>;
+
+  DataColumn(std::string header, const std::vector<int64_t>& values);
+  DataColumn(std::string header,
+             const std::vector<double>& values,
+             int precision = 2);
+  DataColumn(std::string header, const std::vector<std::string_view>& values);
+  DataColumn(std::string header, size_t size, Formatter formatter);
+
+  // The numbers are aligned to the right, the texts to the left by default.
+  DataColumn& SetAlign(Align align);
+  // A width of 0 or less is computed from the header, and a sample of the rows.
+  DataColumn& SetWidth(int width);
+  // Replace the default formatting of the values.
+  DataColumn& SetFormatter(Formatter formatter);
+
+  size_t size() const;
+  void Format(size_t row, std::string& output) const;
+
+ private:
+  friend class DataTable;
+  std::string header_;
+  const std::vector<int64_t>* ints_ = nullptr;
+  const std::vector<double>* doubles_ = nullptr;
+  const std::vector<std::string_view>* strings_ = nullptr;
+  size_t size_ = 0;
+  int precision_ = 2;
+  Align align_ = Left;
+  int width_ = 0;
+  Formatter formatter_;
+};
+
+// A table of typed columns, drawn by a single element. Only the rows visible
+// inside a `frame` are formatted.
+Element dataTable(std::vector<DataColumn> columns, int selected = 0);
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_DOM_TABLE */
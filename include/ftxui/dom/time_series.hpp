@@ -0,0 +1,94 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_TIME_SERIES_HPP
+#define FTXUI_DOM_TIME_SERIES_HPP
+
+#include <algorithm>  // for min, max
+#include <cstddef>    // for size_t
+#include <mutex>      // for mutex, lock_guard
+#include <vector>     // for vector
+
+namespace ftxui {
+
+/// @brief The last samples of a value, kept in a ring buffer of fixed size.
+/// Displaying it with `graph(time_series)` doesn't copy the samples.
+///
+/// Samples can be pushed from any thread, while the graph is being rendered.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// auto cpu = std::make_shared<TimeSeries>(/*capacity=*/512, 0.f, 100.f);
+/// std::thread([&] { while (true) cpu->Push(CpuUsage()); }).detach();
+/// Element document = graph(cpu) | border;
+/// ```
+class TimeSeries {
+ public:
+  // The samples are expected to be in [min, max]. The others are clamped.
+  TimeSeries(size_t capacity, float min, float max);
+
+  TimeSeries(const TimeSeries&) = delete;
+  TimeSeries& operator=(const TimeSeries&) = delete;
+
+  void Push(float value);
+  void Clear();
+
+  size_t capacity() const { return values_.size(); }
+  size_t size() const;
+  float min() const { return min_; }
+  float max() const { return max_; }
+
+  // Divide the last |capacity| samples, from the oldest to the newest, into
+  // |count| columns. Call |fn(column, low, high)| for every column holding
+  // samples, with the lowest and highest of them. The sample preceding the
+  // column is included, so that consecutive columns are connected.
+  template <typename Fn>
+  void ForEachColumn(int count, Fn fn) const;
+
+ private:
+  // The sample |age| pushes ago. 0 is the newest.
+  float At(size_t age) const {
+    return values_[(head_ + values_.size() - 1 - age) % values_.size()];
+  }
+
+  std::vector<float> values_;
+  size_t head_ = 0;  // Where the next sample is written.
+  size_t size_ = 0;
+  const float min_;
+  const float max_;
+  mutable std::mutex mutex_;
+};
+
+template <typename Fn>
+void TimeSeries::ForEachColumn(int count, Fn fn) const {
+  if (count <= 0) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  const size_t capacity = values_.size();
+  const size_t columns = size_t(count);
+  // The window position of the oldest sample available.
+  const size_t first = capacity - size_;
+  for (size_t column = 0; column < columns; ++column) {
+    const size_t begin = column * capacity / columns;
+    const size_t end = std::max(begin + 1, (column + 1) * capacity / columns);
+    if (end <= first) {
+      continue;
+    }
+    size_t i = std::max(begin, first + 1) - 1;
+    float low = At(capacity - 1 - i);
+    float high = low;
+    for (++i; i < end; ++i) {
+      const float value = At(capacity - 1 - i);
+      low = std::min(low, value);
+      high = std::max(high, value);
+    }
+    fn(int(column), low, high);
+  }
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_TIME_SERIES_HPP
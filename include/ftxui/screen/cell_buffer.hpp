@@ -0,0 +1,79 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_CELL_BUFFER_HPP
+#define FTXUI_SCREEN_CELL_BUFFER_HPP
+
+#include <cstdint>  // for uint32_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ftxui/screen/compact_pixel.hpp"  // for GraphemeTable
+#include "ftxui/screen/screen.hpp"         // for Screen
+
+namespace ftxui {
+
+/// @brief The cells of a Screen, as 32-bit words, for a renderer drawing them
+/// directly instead of parsing escape sequences. For instance a canvas, reading
+/// the WebAssembly memory.
+///
+/// Every cell takes `kWordsPerCell` words, row by row:
+/// - 0: The UTF-8 bytes of the grapheme, from the lowest byte, padded with
+///      zeros. With `kInterned`, the id of the grapheme instead. See Grapheme().
+/// - 1: The foreground color, as `kColorSet | 0xRRGGBB`. 0 is the default one.
+/// - 2: The background color, the same way.
+/// - 3: The style, as a combination of the Flag.
+///
+/// Update() tells which rows changed: a renderer redraws the rows whose
+/// row_frames() are past the frame() it drew last.
+/// @ingroup screen
+class CellBuffer {
+ public:
+  static constexpr int kWordsPerCell = 4;
+  static constexpr uint32_t kColorSet = 0xFF000000;
+
+  enum Flag : uint32_t {
+    kBlink = 1 << 0,
+    kBold = 1 << 1,
+    kDim = 1 << 2,
+    kInverted = 1 << 3,
+    kUnderlined = 1 << 4,
+    kUnderlinedDouble = 1 << 5,
+    kStrikethrough = 1 << 6,
+    kInterned = 1 << 7,
+  };
+
+  // Copy the cells of |screen|. Return whether any changed.
+  bool Update(const Screen& screen);
+
+  int dimx() const { return dimx_; }
+  int dimy() const { return dimy_; }
+
+  // The number of updates that changed some cells.
+  uint32_t frame() const { return frame_; }
+
+  // dimx() * dimy() * kWordsPerCell words.
+  const uint32_t* cells() const { return cells_.data(); }
+
+  // For every row, the frame() in which it last changed.
+  const uint32_t* row_frames() const { return row_frames_.data(); }
+
+  // The cursor of the screen: x, y and shape.
+  const int32_t* cursor() const { return cursor_; }
+
+  // The grapheme of a cell with the kInterned flag.
+  const std::string& Grapheme(uint32_t id) const { return graphemes_.Get(id); }
+
+ private:
+  int dimx_ = 0;
+  int dimy_ = 0;
+  uint32_t frame_ = 0;
+  std::vector<uint32_t> cells_;
+  std::vector<uint32_t> row_frames_;
+  int32_t cursor_[3] = {0, 0, 0};  // NOLINT
+  GraphemeTable graphemes_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_CELL_BUFFER_HPP
@@ -4,10 +4,13 @@
 #ifndef FTXUI_SCREEN_COLOR_HPP
 #define FTXUI_SCREEN_COLOR_HPP
 
+#include <cstddef>  // for size_t
 #include <cstdint>  // for uint8_t
 #include <string>   // for string
 #include <vector>   // for vector
 
+#include "ftxui/screen/terminal.hpp"  // for Terminal::Color
+
 #ifdef RGB
 // Workaround for wingdi.h (via Windows.h) defining macros that break things.
 // https://docs.microsoft.com/en-us/windows/win32/api/wingdi/nf-wingdi-rgb
@@ -32,6 +35,11 @@ class Color {
   static Color RGB(uint8_t red, uint8_t green, uint8_t blue);
   static Color HSV(uint8_t hue, uint8_t saturation, uint8_t value);
   static Color Interpolate(float t, const Color& a, const Color& b);
+  static void Interpolate(const float* t,
+                          size_t size,
+                          const Color& a,
+                          const Color& b,
+                          Color* out);
 
   //---------------------------
   // List of colors:
@@ -305,10 +313,27 @@ class Color {
   // clang-format on
 
   // --- Operators ------
-  bool operator==(const Color& rhs) const;
-  bool operator!=(const Color& rhs) const;
+  bool operator==(const Color& rhs) const {
+    return red_ == rhs.red_ && green_ == rhs.green_ && blue_ == rhs.blue_ &&
+           type_ == rhs.type_;
+  }
+  bool operator!=(const Color& rhs) const { return !operator==(rhs); }
 
+  // The SGR parameters selecting this color, downsampled to the colors
+  // supported by the terminal.
   std::string Print(bool is_background_color) const;
+  void Print(bool is_background_color, std::string& output) const;
+  void Print(bool is_background_color,
+             std::string& output,
+             Terminal::Color color_support) const;
+
+  // The closest color displayable with |color_support|. Colors keep the value
+  // they were built with, and are only downsampled when printed.
+  Color Downsample(Terminal::Color color_support) const;
+
+  // The red, green and blue components. The palette colors use the xterm
+  // values. Return false for the terminal's default color, which has none.
+  bool ToRGB(uint8_t* red, uint8_t* green, uint8_t* blue) const;
 
  private:
   enum class ColorType : uint8_t {
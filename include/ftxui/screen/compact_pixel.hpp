@@ -0,0 +1,80 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_COMPACT_PIXEL_HPP
+#define FTXUI_SCREEN_COMPACT_PIXEL_HPP
+
+#include <cstdint>        // for uint8_t, uint16_t, uint32_t
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Pixel
+
+namespace ftxui {
+
+/// @brief Store the graphemes too long to be stored inline in a CompactPixel.
+/// Every distinct grapheme is stored once, and identified by its id.
+/// @ingroup screen
+class GraphemeTable {
+ public:
+  uint32_t Intern(const std::string& grapheme);
+  const std::string& Get(uint32_t id) const;
+  size_t size() const { return graphemes_.size(); }
+  void Clear();
+
+ private:
+  std::vector<std::string> graphemes_;
+  std::unordered_map<std::string, uint32_t> ids_;
+};
+
+/// @brief A fixed size alternative to Pixel, using 16 bytes.
+///
+/// Graphemes of up to 4 bytes, which includes every single codepoint, are
+/// stored inline. Longer ones, like combining characters, are stored in a
+/// GraphemeTable.
+/// @ingroup screen
+struct CompactPixel {
+  static CompactPixel Pack(const Pixel& pixel, GraphemeTable& table);
+  Pixel Unpack(const GraphemeTable& table) const;
+
+  bool operator==(const CompactPixel& other) const;
+  bool operator!=(const CompactPixel& other) const;
+
+  // The inline UTF-8 bytes of the grapheme, padded with zeros. When
+  // `interned` is set, this is the grapheme id in the GraphemeTable instead.
+  uint32_t grapheme = ' ';
+
+  // The style, using the same bits as Pixel:
+  uint8_t blink : 1;
+  uint8_t bold : 1;
+  uint8_t dim : 1;
+  uint8_t inverted : 1;
+  uint8_t underlined : 1;
+  uint8_t underlined_double : 1;
+  uint8_t strikethrough : 1;
+  uint8_t automerge : 1;
+
+  uint8_t interned : 1;
+
+  uint16_t hyperlink = 0;
+
+  Color background_color = Color::Default;
+  Color foreground_color = Color::Default;
+
+  CompactPixel()
+      : blink(false),
+        bold(false),
+        dim(false),
+        inverted(false),
+        underlined(false),
+        underlined_double(false),
+        strikethrough(false),
+        automerge(false),
+        interned(false) {}
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_COMPACT_PIXEL_HPP
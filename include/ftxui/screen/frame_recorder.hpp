@@ -0,0 +1,123 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_FRAME_RECORDER_HPP
+#define FTXUI_SCREEN_FRAME_RECORDER_HPP
+
+#include <chrono>              // for microseconds, steady_clock
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>               // for deque
+#include <functional>          // for function
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <string_view>         // for string_view
+#include <thread>              // for thread
+#include <unordered_map>       // for unordered_map
+#include <vector>              // for vector
+
+#include "ftxui/screen/compact_pixel.hpp"  // for CompactPixel, GraphemeTable
+#include "ftxui/screen/screen.hpp"         // for Screen
+
+namespace ftxui {
+
+/// @brief Record every frame of a Screen, as a compact binary log: keyframes
+/// holding every cell, and in between, only the cells that changed since the
+/// previous frame. Read it back with FrameRecording.
+///
+/// The cells are compared on the calling thread, as CompactPixel, like the
+/// CellBuffer does. Only the changed ones are encoded, with the URLs of their
+/// hyperlinks. The log is given to |write| on a background thread, so the disk
+/// I/O never blocks the UI.
+/// @ingroup screen
+///
+/// ### Example
+///
+/// ```cpp
+/// std::ofstream file("console.ftxf", std::ios::binary);
+/// FrameRecorder recorder([&](std::string_view data) {
+///   file.write(data.data(), std::streamsize(data.size()));
+/// });
+/// Render(screen, document);
+/// recorder.Record(screen);
+/// ```
+class FrameRecorder {
+ public:
+  // |write| receives the log, piece by piece, on a background thread, or on
+  // the calling thread with FTXUI_ENABLE_THREADS=OFF. Every
+  // |keyframe_interval| frames, a keyframe is recorded.
+  explicit FrameRecorder(std::function<void(std::string_view)> write,
+                         int keyframe_interval = 100);
+  ~FrameRecorder();
+  FrameRecorder(const FrameRecorder&) = delete;
+  FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+  // Record a frame.
+  void Record(const Screen& screen);
+
+  // Wait for the frames recorded to be given to |write|.
+  void Flush();
+
+ private:
+  void WriteLoop();
+
+  std::function<void(std::string_view)> write_;
+  int keyframe_interval_;
+  size_t frames_ = 0;
+  std::chrono::steady_clock::time_point previous_time_;
+
+  // The previous frame, to compare the next one with.
+  int dimx_ = 0;
+  int dimy_ = 0;
+  std::vector<CompactPixel> cells_;
+  GraphemeTable graphemes_;
+  // The number of every hyperlink in the log, since the last keyframe.
+  std::unordered_map<std::string, uint16_t> hyperlink_ids_;
+  std::string cells_data_;
+  std::string hyperlinks_data_;
+
+  // The log not yet written, shared with the background thread.
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::string> pending_;
+  bool writing_ = false;
+  bool quit_ = false;
+  std::thread thread_;
+};
+
+/// @brief A log written by a FrameRecorder. The frames are indexed when it is
+/// loaded, without being decoded, so that seeking to one only decodes the
+/// frames since the keyframe before it.
+/// @ingroup screen
+class FrameRecording {
+ public:
+  explicit FrameRecording(std::string data);
+
+  // Whether the log is well formed. A log cut in the middle of a frame keeps
+  // the frames before.
+  bool valid() const { return valid_; }
+
+  // The number of frames.
+  size_t size() const { return frames_.size(); }
+
+  // The time of the frame |index|, since the first one.
+  std::chrono::microseconds Time(size_t index) const;
+
+  // The frame |index|.
+  Screen At(size_t index) const;
+
+ private:
+  struct Frame {
+    size_t offset = 0;    // Of the payload, in |data_|.
+    size_t keyframe = 0;  // The index of the keyframe before, or this one.
+    std::chrono::microseconds time{};
+  };
+
+  std::string data_;
+  std::vector<Frame> frames_;
+  bool valid_ = false;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_FRAME_RECORDER_HPP
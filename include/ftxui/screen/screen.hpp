@@ -4,10 +4,14 @@
 #ifndef FTXUI_SCREEN_SCREEN_HPP
 #define FTXUI_SCREEN_SCREEN_HPP
 
-#include <cstdint>  // for uint8_t
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t, uint16_t
+#include <functional>  // for function
 #include <memory>
-#include <string>  // for string, basic_string, allocator
-#include <vector>  // for vector
+#include <string>         // for string, basic_string, allocator
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/color.hpp"     // for Color, Color::Default
@@ -40,7 +44,7 @@ struct Pixel {
 
   // The hyperlink associated with the pixel.
   // 0 is the default value, meaning no hyperlink.
-  uint8_t hyperlink = 0;
+  uint16_t hyperlink = 0;
 
   // The graphemes stored into the pixel. To support combining characters,
   // like: a⃦, this can potentially contain multiple codepoints.
@@ -51,6 +55,33 @@ struct Pixel {
   Color foreground_color = Color::Default;
 };
 
+/// @brief A change of the style of Pixels. See Screen::ApplyStyle().
+/// @ingroup screen
+struct PixelStyle {
+  // The fields to set.
+  enum Field : uint16_t {
+    kForeground = 1 << 0,
+    kBackground = 1 << 1,
+    kHyperlink = 1 << 2,
+    kBlink = 1 << 3,
+    kBold = 1 << 4,
+    kDim = 1 << 5,
+    kUnderlined = 1 << 6,
+    kUnderlinedDouble = 1 << 7,
+    kStrikethrough = 1 << 8,
+  };
+  uint16_t fields = 0;
+  bool invert = false;  // Toggle Pixel::inverted.
+  Color foreground_color;
+  Color background_color;
+  uint16_t hyperlink = 0;
+
+  void Apply(Pixel& pixel) const;
+
+  // Merge |next|, to be applied after this one.
+  void Then(const PixelStyle& next);
+};
+
 /// @brief Define how the Screen's dimensions should look like.
 /// @ingroup screen
 namespace Dimension {
@@ -75,10 +106,55 @@ class Screen {
   Pixel& PixelAt(int x, int y);
   const Pixel& PixelAt(int x, int y) const;
 
+  // Call |fn(pixel)| on every cell of |box| inside the stencil. The box is
+  // clipped once, and the cells are visited row by row.
+  template <typename Fn>
+  void ForEachPixel(Box box, Fn fn);
+
+  // Apply |style| to every cell of |box| inside the stencil. This is deferred
+  // until the cells are accessed. The styles applied consecutively to the
+  // same box are merged, and the cells are updated in a single pass.
+  void ApplyStyle(Box box, const PixelStyle& style);
+  // Apply the pending styles to the cells now. Drawing an Element ends with
+  // it, see ApplyShader().
+  void ResolveStyles() const;
+
   std::string ToString() const;
+  void ToString(std::string& output) const;
+  void ToString(std::string& output, Terminal::Color color_support) const;
+  // With |compression|, the blank cells and the repeated glyphs are printed
+  // by the terminal sequences shortening them.
+  void ToString(std::string& output,
+                Terminal::Color color_support,
+                Terminal::Compression compression) const;
+  void ToString(const std::function<void(std::string_view)>& sink) const;
+  void ToString(const std::function<void(std::string_view)>& sink,
+                int y_begin,
+                int y_end) const;
+
+  // Produce the minimal update turning a terminal displaying `previous` into
+  // one displaying this Screen. Both screens must have the same dimensions.
+  std::string ToStringDiff(const Screen& previous) const;
+  void ToStringDiff(const Screen& previous, std::string& output) const;
+  void ToStringDiff(const Screen& previous,
+                    std::string& output,
+                    Terminal::Color color_support) const;
+  // With |scroll|, the rows shifted vertically since `previous` are moved by
+  // scrolling the terminal. The Screen must be displayed from its top left
+  // corner, over its full width.
+  void ToStringDiff(const Screen& previous,
+                    std::string& output,
+                    Terminal::Color color_support,
+                    bool scroll) const;
+  void ToStringDiff(const Screen& previous,
+                    std::string& output,
+                    Terminal::Color color_support,
+                    bool scroll,
+                    Terminal::Compression compression) const;
 
   // Print the Screen on to the terminal.
   void Print() const;
+  bool WriteTo(int fd) const;
 
   // Get screen dimensions.
   int dimx() const { return dimx_; }
@@ -90,6 +166,14 @@ class Screen {
   // Fill the screen with space.
   void Clear();
 
+  // Change the dimensions, and clear the screen. The storage is kept, and
+  // reused when the cells fit in it.
+  void Resize(int dimx, int dimy);
+
+  // Give back the storage not used by the current dimensions, for instance
+  // after shrinking, or once the Screen is resized to 0x0 while unused.
+  void ShrinkToFit();
+
   void ApplyShader();
 
   struct Cursor {
@@ -112,19 +196,53 @@ class Screen {
 
   // Store an hyperlink in the screen. Return the id of the hyperlink. The id is
   // used to identify the hyperlink when the user click on it.
-  uint8_t RegisterHyperlink(const std::string& link);
-  const std::string& Hyperlink(uint8_t id) const;
+  uint16_t RegisterHyperlink(const std::string& link);
+  const std::string& Hyperlink(uint16_t id) const;
+
+  // The bytes allocated by the Screen, including itself.
+  size_t MemoryUsage() const;
 
   Box stencil;
 
  protected:
   int dimx_;
   int dimy_;
-  std::vector<std::vector<Pixel>> pixels_;
+  // The cells, stored contiguously row after row. The cell (x,y) is at index
+  // `y * dimx_ + x`. They are up to date after ResolveStyles(), which may run
+  // from the const accessors, hence mutable.
+  mutable std::vector<Pixel> pixels_;
+  // Whether every row was written since the last Clear(). The others are
+  // blank, so they are compared and cleared without visiting their cells.
+  // A row accessed through PixelAt() counts as written.
+  mutable std::vector<uint8_t> written_rows_;
   Cursor cursor_;
   std::vector<std::string> hyperlinks_ = {""};
+  // The id of every hyperlink in |hyperlinks_|, except the empty one.
+  std::unordered_map<std::string, uint16_t> hyperlink_ids_;
+
+ private:
+  // The styles not applied to |pixels_| yet, in order.
+  struct PendingStyle {
+    Box box;
+    PixelStyle style;
+  };
+  mutable std::vector<PendingStyle> pending_styles_;
 };
 
+template <typename Fn>
+void Screen::ForEachPixel(Box box, Fn fn) {
+  ResolveStyles();
+  box = Box::Intersection(box, stencil);
+  box = Box::Intersection(box, Box{0, dimx_ - 1, 0, dimy_ - 1});
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    written_rows_[y] = 1;
+    Pixel* row = pixels_.data() + y * dimx_;
+    for (int x = box.x_min; x <= box.x_max; ++x) {
+      fn(row[x]);  // NOLINT
+    }
+  }
+}
+
 }  // namespace ftxui
 
 #endif  // FTXUI_SCREEN_SCREEN_HPP
@@ -0,0 +1,76 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_SCREEN_ENCODER_HPP
+#define FTXUI_SCREEN_SCREEN_ENCODER_HPP
+
+#include <string>  // for string
+
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/terminal.hpp"  // for Dimensions, Terminal::Color
+
+namespace ftxui {
+
+/// @brief Turn the frames of a Screen into the output of one terminal.
+///
+/// Every encoder keeps the frame its terminal displays, its color support and
+/// its dimensions. A Screen rendered once can feed the encoders of many
+/// terminals, like the clients watching the same UI. Each one only prints the
+/// cells that changed for its terminal.
+/// @ingroup screen
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = Screen::Create(Dimension::Fixed(80), Dimension::Fixed(24));
+/// Render(screen, document);
+/// for (Client& client : clients) {
+///   client.output.clear();
+///   client.encoder.Encode(screen, client.output);
+///   client.Send(client.output);
+/// }
+/// ```
+class ScreenEncoder {
+ public:
+  explicit ScreenEncoder(
+      Terminal::Color color_support = Terminal::ColorSupport());
+
+  // The dimensions of the terminal. The part of the frames outside is not
+  // printed. By default, the frames are printed fully.
+  void SetDimensions(Dimensions dimensions);
+
+  // Whether the frames are displayed from the top left corner of the
+  // terminal, over its full width. The rows shifted from one frame to the next
+  // are then moved by scrolling the terminal, instead of being printed again.
+  void SetScrollRegions(bool enable);
+
+  // The sequences supported by the terminal to print the frames in fewer
+  // bytes. None by default. See Terminal::Compression.
+  void SetCompression(Terminal::Compression compression);
+
+  // Append to |output| the string updating the terminal, from the last frame
+  // encoded to |screen|. The first frame is printed fully.
+  void Encode(const Screen& screen, std::string& output);
+
+  // Forget the frame displayed by the terminal, for instance when it was
+  // cleared. The next frame is printed fully.
+  void Reset();
+
+  Terminal::Color color_support() const { return color_support_; }
+
+ private:
+  // Copy the part of |screen| displayed by the terminal into |frame_|.
+  void Crop(const Screen& screen);
+
+  Terminal::Color color_support_;
+  Dimensions dimensions_;
+  Screen frame_ = Screen(0, 0);
+  Screen printed_ = Screen(0, 0);
+  bool printed_valid_ = false;
+  bool scroll_regions_ = false;
+  Terminal::Compression compression_ = Terminal::Compression::None;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_SCREEN_ENCODER_HPP
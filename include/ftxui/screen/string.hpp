@@ -4,29 +4,90 @@
 #ifndef FTXUI_SCREEN_STRING_HPP
 #define FTXUI_SCREEN_STRING_HPP
 
-#include <stddef.h>  // for size_t
-#include <cstdint>   // for uint8_t
-#include <string>    // for string, wstring, to_string
-#include <vector>    // for vector
+#include <stddef.h>     // for size_t, ptrdiff_t
+#include <cstdint>      // for uint8_t
+#include <iterator>     // for forward_iterator_tag
+#include <string>       // for string, wstring, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 namespace ftxui {
 std::string to_string(const std::wstring& s);
 std::wstring to_wstring(const std::string& s);
 
+// The same, stored into |out|. Its storage is reused, so converting in a loop
+// into the same buffer doesn't allocate.
+void to_string(std::wstring_view s, std::string& out);
+void to_wstring(std::string_view s, std::wstring& out);
+
 template <typename T>
 std::wstring to_wstring(T s) {
   return to_wstring(std::to_string(s));
 }
 
-int string_width(const std::string&);
+int string_width(std::string_view);
 
 // Split the string into a its glyphs. An empty one is inserted ater fullwidth
 // ones.
 std::vector<std::string> Utf8ToGlyphs(const std::string& input);
 
+// The same, stored into |out|. The strings already in |out| are reused.
+void Utf8ToGlyphs(std::string_view input, std::vector<std::string>& out);
+
+// Iterate over the glyphs of a string, as views inside it. As opposed to
+// Utf8ToGlyphs, nothing is allocated.
+class GlyphIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::string_view;
+  using difference_type = ptrdiff_t;
+  using pointer = const std::string_view*;
+  using reference = const std::string_view&;
+
+  GlyphIterator() = default;
+  GlyphIterator(std::string_view input, size_t start);
+
+  reference operator*() const { return glyph_; }
+  pointer operator->() const { return &glyph_; }
+  GlyphIterator& operator++();
+  GlyphIterator operator++(int);
+
+  bool operator==(const GlyphIterator& other) const {
+    return start_ == other.start_ && filler_ == other.filler_;
+  }
+  bool operator!=(const GlyphIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  void Eat(size_t start);
+
+  std::string_view input_;
+  std::string_view glyph_;
+  size_t start_ = 0;
+  size_t end_ = 0;
+  bool fullwidth_ = false;
+  bool filler_ = false;
+};
+
+class GlyphRange {
+ public:
+  explicit GlyphRange(std::string_view input) : input_(input) {}
+  GlyphIterator begin() const { return {input_, 0}; }
+  GlyphIterator end() const { return {input_, input_.size()}; }
+
+ private:
+  std::string_view input_;
+};
+
+// The glyphs of |input|, the same as Utf8ToGlyphs. |input| must outlive the
+// range.
+GlyphRange Utf8Glyphs(std::string_view input);
+
 // Map every cells drawn by |input| to their corresponding Glyphs. Half-size
 // Glyphs takes one cell, full-size Glyphs take two cells.
 std::vector<int> CellToGlyphIndex(const std::string& input);
+void CellToGlyphIndex(std::string_view input, std::vector<int>& out);
 
 }  // namespace ftxui
 
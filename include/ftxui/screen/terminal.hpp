@@ -23,6 +23,20 @@ enum Color {
 Color ColorSupport();
 void SetColorSupport(Color color);
 
+// The sequences the terminal supports to print a frame in fewer bytes.
+enum class Compression {
+  None,    // Every cell is printed.
+  Erase,   // The blank cells are erased: ECH and EL.
+  Repeat,  // Also, the repeated glyphs are repeated: REP.
+};
+Compression CompressionSupport();
+void SetCompressionSupport(Compression compression);
+
+// Whether the terminal supports scrolling a region (DECSTBM). The rows shifted
+// between two fullscreen frames are then scrolled, instead of printed again.
+bool ScrollRegionSupport();
+void SetScrollRegionSupport(bool supported);
+
 }  // namespace Terminal
 
 }  // namespace ftxui
@@ -0,0 +1,51 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_TRACE_HPP
+#define FTXUI_SCREEN_TRACE_HPP
+
+#include <chrono>  // for steady_clock
+#include <string>  // for string
+
+namespace ftxui::trace {
+
+// Record the trace points, until Stop() is called.
+void Start();
+
+// Stop recording. Return the trace points recorded since Start(), in the
+// Chrome trace event JSON format. It can be opened by chrome://tracing and
+// Perfetto. The timestamps are the microseconds of std::chrono::steady_clock,
+// so that they can be correlated with the application's own traces.
+std::string Stop();
+
+bool Recording();
+
+// A trace point, lasting from its construction to its destruction. |name|
+// must outlive the recording, a string literal for instance.
+class Scope {
+ public:
+  explicit Scope(const char* name);
+  ~Scope();
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  const char* name_;
+  std::chrono::steady_clock::time_point begin_;
+};
+
+}  // namespace ftxui::trace
+
+// The trace points of FTXUI are compiled out, unless FTXUI is built with the
+// FTXUI_ENABLE_TRACING option.
+#if defined(FTXUI_ENABLE_TRACING)
+#define FTXUI_TRACE_CONCAT_INNER(a, b) a##b
+#define FTXUI_TRACE_CONCAT(a, b) FTXUI_TRACE_CONCAT_INNER(a, b)
+#define FTXUI_TRACE(name) \
+  const ::ftxui::trace::Scope FTXUI_TRACE_CONCAT(ftxui_trace_, __LINE__)(name)
+#else
+#define FTXUI_TRACE(name) static_cast<void>(0)
+#endif
+
+#endif  // FTXUI_SCREEN_TRACE_HPP
@@ -4,12 +4,19 @@
 #ifndef FTXUI_UTIL_REF_HPP
 #define FTXUI_UTIL_REF_HPP
 
+#include <cstddef>
 #include <ftxui/screen/string.hpp>
+#include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <variant>
 
 namespace ftxui {
 
+class InternedString;
+
 /// @brief An adapter. Own or reference an immutable object.
 template <typename T>
 class ConstRef {
@@ -92,14 +99,38 @@ class ConstStringRef : public ConstRef<std::string> {
   ConstStringRef(const wchar_t* ref)
       : ConstStringRef(to_string(std::wstring(ref))) {}
   ConstStringRef(const char* ref) : ConstStringRef(std::string(ref)) {}
+  // Reference the interned string. See ftxui/dom/measured_text.hpp.
+  ConstStringRef(const InternedString& ref);
 };
 
 /// @brief An adapter. Reference a list of strings.
 class ConstStringListRef {
  public:
+  /// @brief A list of strings produced on demand. It must outlive the
+  /// references to it.
+  class Adapter {
+   public:
+    Adapter() = default;
+    Adapter(const Adapter&) = default;
+    Adapter& operator=(const Adapter&) = default;
+    virtual ~Adapter() = default;
+    virtual size_t size() const = 0;
+    virtual std::string operator[](size_t i) const = 0;
+  };
+
   ConstStringListRef() = default;
   ConstStringListRef(const std::vector<std::string>* ref) : ref_(ref) {}
   ConstStringListRef(const std::vector<std::wstring>* ref) : ref_wide_(ref) {}
+  ConstStringListRef(const Adapter* adapter) : adapter_(adapter) {}
+
+  /// @brief A list of strings read on demand from the application's storage:
+  /// |size| gives their number, and |at| the one at an index. Only the
+  /// strings displayed are read, and nothing is kept in between two frames.
+  ConstStringListRef(std::function<size_t()> size,
+                     std::function<std::string_view(size_t)> at)
+      : owned_adapter_(
+            std::make_shared<Callbacks>(std::move(size), std::move(at))),
+        adapter_(owned_adapter_.get()) {}
   ConstStringListRef(const ConstStringListRef& other) = default;
   ConstStringListRef& operator=(const ConstStringListRef& other) = default;
 
@@ -110,6 +141,9 @@ class ConstStringListRef {
     if (ref_wide_) {
       return ref_wide_->size();
     }
+    if (adapter_) {
+      return adapter_->size();
+    }
     return 0;
   }
 
@@ -120,12 +154,32 @@ class ConstStringListRef {
     if (ref_wide_) {
       return to_string((*ref_wide_)[i]);
     }
+    if (adapter_) {
+      return (*adapter_)[i];
+    }
     return "";
   }
 
  private:
+  class Callbacks : public Adapter {
+   public:
+    Callbacks(std::function<size_t()> size,
+              std::function<std::string_view(size_t)> at)
+        : size_(std::move(size)), at_(std::move(at)) {}
+    size_t size() const override { return size_(); }
+    std::string operator[](size_t i) const override {
+      return std::string(at_(i));
+    }
+
+   private:
+    std::function<size_t()> size_;
+    std::function<std::string_view(size_t)> at_;
+  };
+
   const std::vector<std::string>* ref_ = nullptr;
   const std::vector<std::wstring>* ref_wide_ = nullptr;
+  std::shared_ptr<const Adapter> owned_adapter_;
+  const Adapter* adapter_ = nullptr;
 };
 
 }  // namespace ftxui
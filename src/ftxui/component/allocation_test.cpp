@@ -0,0 +1,51 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <cstddef>  // for size_t
+#include <string>   // for string, to_string
+#include <variant>  // for get
+
+#include "ftxui/component/event.hpp"     // for Event
+#include "ftxui/component/receiver.hpp"  // for MakeReceiver
+#include "ftxui/component/task.hpp"      // for Task
+#include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+
+// Part of ftxui-allocation-tests. See dom/allocation_test.cpp, counting the
+// allocations.
+size_t AllocationCount();
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(TerminalInputParserAllocation, MouseMotions) {
+  auto receiver = MakeReceiver<Task>();
+  auto parser = TerminalInputParser(receiver->MakeSender());
+
+  std::string input;
+  for (int i = 0; i < 100; ++i) {
+    input += "\x1B[<35;" + std::to_string(100 + i) + ";" +
+             std::to_string(50 + i) + "M";
+  }
+  // Reach the steady state: the pending input has grown to its final size.
+  parser.Add(input);
+  Task task;
+  while (receiver->HasPending()) {
+    receiver->Receive(&task);
+  }
+
+  // A single allocation per event, for the node of the queue it is sent to.
+  const size_t before = AllocationCount();
+  parser.Add(input);
+  EXPECT_EQ(AllocationCount() - before, 100u);
+
+  size_t motions = 0;
+  while (receiver->HasPending()) {
+    receiver->Receive(&task);
+    motions += std::get<Event>(task).is_mouse();
+  }
+  EXPECT_EQ(motions, 100u);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,6 +1,10 @@
-#include <cmath>    // for sin, pow, sqrt, cos
-#include <ratio>    // for ratio
-#include <utility>  // for move
+#include <algorithm>  // for min, max
+#include <cmath>      // for sin, pow, sqrt, cos
+#include <cstddef>    // for size_t
+#include <memory>     // for make_shared
+#include <ratio>      // for ratio
+#include <utility>    // for move
+#include <vector>     // for vector
 
 #include "ftxui/component/animation.hpp"
 
@@ -249,6 +253,27 @@ float BounceInOut(float p) {
   return 0.5f * BounceOut(p * 2.f - 1.f) + 0.5f;
 }
 
+/// @brief Sample |function| at |samples| + 1 evenly spaced points of [0, 1].
+Table::Table(const Function& function, int samples) {
+  samples = std::max(samples, 1);
+  std::vector<float> values(size_t(samples) + 1);
+  for (int i = 0; i <= samples; ++i) {
+    values[size_t(i)] = function(float(i) / float(samples));
+  }
+  samples_ = std::make_shared<const std::vector<float>>(std::move(values));
+}
+
+/// @brief Interpolate linearly in between the two closest samples. |p| is
+/// clamped to [0, 1].
+float Table::operator()(float p) const {
+  const std::vector<float>& values = *samples_;
+  const size_t last = values.size() - 1;
+  const float x = std::min(std::max(p, 0.f), 1.f) * float(last);
+  const size_t i = std::min(size_t(x), last - 1);
+  const float t = x - float(i);
+  return values[i] + (values[i + 1] - values[i]) * t;
+}
+
 }  // namespace easing
 
 Animator::Animator(float* from,
@@ -262,21 +287,37 @@ Animator::Animator(float* from,
       duration_(duration),
       easing_function_(std::move(easing_function)),
       current_(-delay) {
+#if defined(FTXUI_NO_ANIMATIONS)
+  // The value jumps to its target.
+  *value_ = to_;
+  settled_ = true;
+#else
+  if (const auto* table = easing_function_.target<easing::Table>()) {
+    easing_table_ = *table;
+  }
   RequestAnimationFrame();
+#endif
 }
 
 void Animator::OnAnimation(Params& params) {
+  if (settled_) {
+    return;
+  }
   current_ += params.duration();
 
   if (current_ >= duration_) {
     *value_ = to_;
+    settled_ = true;
     return;
   }
 
   if (current_ <= Duration()) {
     *value_ = from_;
   } else {
-    *value_ = from_ + (to_ - from_) * easing_function_(current_ / duration_);
+    const float p = current_ / duration_;
+    const float eased =
+        easing_table_.empty() ? easing_function_(p) : easing_table_(p);
+    *value_ = from_ + (to_ - from_) * eased;
   }
 
   RequestAnimationFrame();
@@ -3,6 +3,7 @@
 // the LICENSE file.
 
 #include <gtest/gtest.h>
+#include <chrono>      // for milliseconds
 #include <functional>  // for function
 #include <vector>      // for allocator, vector
 
@@ -35,4 +36,65 @@ TEST(AnimationTest, StartAndEnd) {
   }
 }
 
+#if !defined(FTXUI_NO_ANIMATIONS)
+TEST(AnimationTest, Table) {
+  const std::vector<animation::easing::Function> functions = {
+      animation::easing::Linear,       animation::easing::SineInOut,
+      animation::easing::ElasticOut,   animation::easing::BounceInOut,
+      animation::easing::BackInOut,    animation::easing::ExponentialIn,
+      animation::easing::CubicOut,     animation::easing::QuinticInOut,
+  };
+  for (const auto& function : functions) {
+    const animation::easing::Table table(function);
+    EXPECT_EQ(table(0.F), function(0.F));
+    EXPECT_EQ(table(1.F), function(1.F));
+    for (int i = 0; i <= 1000; ++i) {
+      const float p = float(i) / 1000.F;
+      EXPECT_NEAR(table(p), function(p), 1.0e-2);
+    }
+  }
+
+  // The Animator evaluates the table.
+  float value = 0.F;
+  animation::Animator animator(&value, 1.F, std::chrono::milliseconds(100),
+                               animation::easing::Table(
+                                   animation::easing::QuadraticIn, 2));
+  animation::Params params(std::chrono::milliseconds(25));
+  animator.OnAnimation(params);
+  // Interpolated in between QuadraticIn(0) = 0 and QuadraticIn(0.5) = 0.25.
+  EXPECT_NEAR(value, 0.125F, 1.0e-4);
+}
+
+TEST(AnimationTest, Settle) {
+  float value = 0.F;
+  animation::Animator animator(&value, 1.F, std::chrono::milliseconds(100));
+  EXPECT_TRUE(animator.running());
+
+  animation::Params half(std::chrono::milliseconds(50));
+  animator.OnAnimation(half);
+  EXPECT_NEAR(value, 0.5F, 1.0e-4);
+  EXPECT_TRUE(animator.running());
+
+  animator.OnAnimation(half);
+  EXPECT_EQ(value, 1.F);
+  EXPECT_FALSE(animator.running());
+
+  // A settled animator doesn't touch the value anymore.
+  value = 2.F;
+  animator.OnAnimation(half);
+  EXPECT_EQ(value, 2.F);
+}
+
+TEST(AnimationTest, ZeroDuration) {
+  float value = 0.F;
+  animation::Animator animator(&value, 1.F, std::chrono::milliseconds(0));
+  EXPECT_TRUE(animator.running());
+
+  animation::Params params(std::chrono::milliseconds(16));
+  animator.OnAnimation(params);
+  EXPECT_EQ(value, 1.F);
+  EXPECT_FALSE(animator.running());
+}
+#endif
+
 }  // namespace ftxui
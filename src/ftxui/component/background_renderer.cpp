@@ -0,0 +1,153 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <atomic>      // for atomic
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <memory>      // for make_shared, shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/component/component.hpp"  // for BackgroundRenderer, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/event.hpp"           // for Event, Event::Custom
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"  // for Element, emptyElement, reflect, retained
+#include "ftxui/dom/node.hpp"    // for Node
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui {
+
+namespace {
+
+// Lay out |node| in |box|, the way Render() does. Once drawn in the same box,
+// a retained node reuses this layout.
+void Layout(Node* node, Box box) {
+  Node::Status status;
+  node->Check(&status);
+  const int max_iterations = 20;
+  while (status.need_iteration && status.iteration < max_iterations) {
+    node->ComputeRequirement();
+    node->SetBox(box);
+    status.need_iteration = false;
+    status.iteration++;
+    node->Check(&status);
+  }
+}
+
+// Build the Element of |job|, laid out in |box|.
+Element Build(const std::function<Element()>& job, Box box) {
+  Element element = retained(job());
+  if (box.x_min <= box.x_max && box.y_min <= box.y_max) {
+    Layout(element.get(), box);
+  }
+  return element;
+}
+
+// Build the Element with ScreenInteractive::Async(), from a snapshot taken on
+// the loop thread. The last Element built is displayed meanwhile.
+class BackgroundRendererImpl : public ComponentBase {
+ public:
+  BackgroundRendererImpl(std::function<std::function<Element()>()> snapshot,
+                         std::function<size_t()> key)
+      : snapshot_(std::move(snapshot)), key_(std::move(key)) {}
+
+ private:
+  // A build, shared with the background thread. |done| publishes |element|.
+  struct Job {
+    std::atomic<bool> done{false};
+    Element element;
+  };
+
+  Element Render() override {
+    // A job nobody else holds was dropped, with the screen running it.
+    if (job_ && (job_->done || job_.use_count() == 1)) {
+      if (job_->done) {
+        element_ = std::move(job_->element);
+      } else {
+        requested_ = false;
+      }
+      job_ = nullptr;
+    }
+    // A single build at a time. A change happening meanwhile is seen once it
+    // is done.
+    const size_t key = key_ ? key_() : 0;
+    const bool stale = !requested_ || key != key_value_ || Invalidated();
+    if (stale && !job_) {
+      requested_ = true;
+      key_value_ = key;
+      Validate();
+      Start(snapshot_());
+    }
+    return (element_ ? element_ : emptyElement()) | reflect(box_);
+  }
+
+  void Start(std::function<Element()> build) {
+#if !defined(FTXUI_NO_THREADS)
+    // The screen owns the thread, and waits for it before being destroyed.
+    // The work only accesses its own copies, since this component may be
+    // destroyed first. The loop draws the result once notified.
+    if (ScreenInteractive* screen = ScreenInteractive::Active()) {
+      job_ = std::make_shared<Job>();
+      screen->Async(
+          [job = job_, build = std::move(build), box = box_] {
+            job->element = Build(build, box);
+            job->done = true;
+          },
+          [] {
+            if (ScreenInteractive* active = ScreenInteractive::Active()) {
+              active->PostEvent(Event::Custom);
+            }
+          });
+      return;
+    }
+#endif
+    element_ = Build(build, box_);
+  }
+
+  const std::function<std::function<Element()>()> snapshot_;
+  const std::function<size_t()> key_;
+
+  Element element_;
+  size_t key_value_ = 0;
+  bool requested_ = false;
+  Box box_;
+  std::shared_ptr<Job> job_;  // The build running, if any.
+};
+
+}  // namespace
+
+/// @brief Build the Element displayed on a background thread, so that an
+/// expensive view doesn't delay the input handling.
+///
+/// On the loop thread, |snapshot| copies what the view displays, and returns
+/// the function building the Element from this copy. It runs on a background
+/// thread of the screen, see ScreenInteractive::Async(), and must not access
+/// anything else the loop thread may modify. The Element is laid out there
+/// too, in the box of the previous frame. Then, the loop thread swaps it in,
+/// and draws it. Outside of a loop, or with FTXUI_ENABLE_THREADS=OFF, it is
+/// built on the loop thread, in Render().
+///
+/// Meanwhile, the previous Element is displayed. A new one is built when |key|
+/// returns a different value, or the component is invalidated.
+/// @param snapshot Copy the model, and return the function building the
+/// Element from the copy.
+/// @param key a function returning a value identifying what is displayed. For
+/// instance a version number incremented on every change of the model.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto chart = BackgroundRenderer(
+///     [&] {
+///       return [samples = samples] { return BuildChart(samples); };
+///     },
+///     [&] { return version; });
+/// ```
+Component BackgroundRenderer(
+    std::function<std::function<Element()>()> snapshot,
+    std::function<size_t()> key) {
+  return Make<BackgroundRendererImpl>(std::move(snapshot), std::move(key));
+}
+
+}  // namespace ftxui
@@ -0,0 +1,76 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+#include <thread>  // for thread::id, this_thread
+
+#include "ftxui/component/component.hpp"  // for BackgroundRenderer
+#include "ftxui/component/event.hpp"      // for Event
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+
+// NOLINTBEGIN
+namespace ftxui {
+
+#if !defined(FTXUI_NO_THREADS)
+TEST(BackgroundRenderer, BuildOnWorker) {
+  std::string model = "first";
+  std::thread::id builder;
+  auto component = BackgroundRenderer(
+      [&] {
+        return [snapshot = model, &builder] {
+          builder = std::this_thread::get_id();
+          return text("model " + snapshot);
+        };
+      },
+      [&] { return model.size(); });
+
+  auto screen = ScreenInteractive::Headless(20, 1);
+  Loop loop(&screen, component);
+
+  // The first frame starts building. The next one displays it.
+  loop.RunOnce();
+  loop.RunOnceBlocking();
+  EXPECT_NE(screen.HeadlessOutput().find("model first"), std::string::npos);
+  EXPECT_NE(builder, std::this_thread::get_id());
+
+  // A change of the key builds it again. Only the difference is printed.
+  model = "second";
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  loop.RunOnceBlocking();
+  EXPECT_NE(screen.HeadlessOutput().find("second"), std::string::npos);
+}
+#endif
+
+TEST(BackgroundRenderer, OutlivesScreen) {
+  auto component =
+      BackgroundRenderer([] { return [] { return text("built"); }; });
+  {
+    // The screen waits for the build started, or drops it.
+    auto screen = ScreenInteractive::Headless(20, 1);
+    Loop loop(&screen, component);
+    loop.RunOnce();
+  }
+
+  auto screen = ScreenInteractive::Headless(20, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  std::string output = screen.HeadlessOutput();
+  if (output.find("built") == std::string::npos) {
+    loop.RunOnceBlocking();
+    output += screen.HeadlessOutput();
+  }
+  EXPECT_NE(output.find("built"), std::string::npos);
+}
+
+TEST(BackgroundRenderer, Destroyed) {
+  // Without a screen to draw on, it is built in Render().
+  auto component = BackgroundRenderer([] { return [] { return text("a"); }; });
+  component->Render();
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,650 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <benchmark/benchmark.h>
+#include <memory>       // for shared_ptr, make_shared
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/component/component.hpp"  // for Button, Checkbox, Horizontal, Menu, Renderer, Vertical
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/loop.hpp"            // for Loop
+#include "ftxui/component/mouse.hpp"           // for Mouse
+#include "ftxui/component/receiver.hpp"        // for MakeReceiver
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/component/task.hpp"                // for Task
+#include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/canvas.hpp"    // for Canvas
+#include "ftxui/dom/elements.hpp"  // for text, frame, vbox, border, Element
+#include "ftxui/dom/node.hpp"      // for Render, NodesConstructed
+#include "ftxui/dom/table.hpp"     // for Table
+#include "ftxui/screen/color.hpp"  // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A grid of |rows| lines of buttons and checkboxes.
+Component Form(int rows, bool* checked) {
+  auto container = Container::Vertical({});
+  for (int i = 0; i < rows; ++i) {
+    container->Add(Container::Horizontal({
+        Button("Edit", [] {}),
+        Button("Delete", [] {}),
+        Checkbox("Enabled " + std::to_string(i), checked),
+    }));
+  }
+  return container;
+}
+
+Event MouseMovedAt(int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::None;
+  mouse.motion = Mouse::Moved;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
+
+// A menu of |size| entries, displayed in a frame.
+Component ScrollingMenu(std::vector<std::string>* entries,
+                        int* selected,
+                        int size) {
+  for (int i = 0; i < size; ++i) {
+    entries->push_back("Entry " + std::to_string(i));
+  }
+  auto menu = Menu(entries, selected);
+  return Renderer(menu, [menu, selected] {
+    return vbox({
+               text("Selected: " + std::to_string(*selected)),
+               menu->Render() | frame,
+           }) |
+           border;
+  });
+}
+
+}  // namespace
+
+// Terminal input parsing ----------------------------------------------------
+
+static void BenchmarkTerminalInputParser(benchmark::State& state) {
+  std::string input;
+  for (int i = 0; i < state.range(0); ++i) {
+    input += "hello";            // Characters.
+    input += "\x1B[A\x1B[B";     // Arrows.
+    input += "\x1B[<0;12;7M";    // Mouse press.
+    input += "\x1B[<35;13;8M";   // Mouse move.
+    input += "\x1B[<0;12;7m";    // Mouse release.
+    input += "é測";              // UTF-8.
+    input += "\x1B[200~paste\x1B[201~";
+  }
+  auto receiver = MakeReceiver<Task>();
+  TerminalInputParser parser(receiver->MakeSender());
+  std::vector<Task> tasks;
+  for (auto _ : state) {
+    parser.Add(input);
+    tasks.clear();
+    receiver->ReceiveAll(&tasks);
+    benchmark::DoNotOptimize(tasks);
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(input.size()));
+}
+BENCHMARK(BenchmarkTerminalInputParser)->RangeMultiplier(8)->Range(1, 512);
+
+// Parse |input| read by chunks of |chunk| bytes, as the terminal delivers
+// them. Report the events and the bytes parsed per second.
+static void ParseStream(benchmark::State& state,
+                        const std::string& input,
+                        size_t chunk) {
+  auto receiver = MakeReceiver<Task>();
+  TerminalInputParser parser(receiver->MakeSender());
+  std::vector<Task> tasks;
+  size_t events = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < input.size(); i += chunk) {
+      parser.Add(std::string_view(input).substr(i, chunk));
+    }
+    tasks.clear();
+    receiver->ReceiveAll(&tasks);
+    events += tasks.size();
+    benchmark::DoNotOptimize(tasks);
+  }
+  state.SetItemsProcessed(int64_t(events));
+  state.SetBytesProcessed(state.iterations() * int64_t(input.size()));
+}
+
+// A mouse dragged across the terminal, reported with SGR mouse mode. Every
+// report is a distinct event.
+static void BenchmarkParserMouseStorm(benchmark::State& state) {
+  std::string input;
+  for (int i = 0; i < 4096; ++i) {
+    const int x = 1 + i % 200;
+    const int y = 1 + (i / 200) % 60;
+    input += "\x1B[<35;" + std::to_string(x) + ";" + std::to_string(y) + "M";
+  }
+  ParseStream(state, input, size_t(state.range(0)));
+}
+BENCHMARK(BenchmarkParserMouseStorm)->Arg(1)->Arg(64)->Arg(4096);
+
+// A large source file pasted with the bracketed paste mode.
+static void BenchmarkParserLargePaste(benchmark::State& state) {
+  std::string input = "\x1B[200~";
+  while (input.size() < size_t(state.range(0))) {
+    input += "  for (int i = 0; i < size; ++i) { sum += values[i]; }\r\n";
+  }
+  input += "\x1B[201~";
+  ParseStream(state, input, 4096);
+}
+BENCHMARK(BenchmarkParserLargePaste)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 20);
+
+// The same text, typed or pasted without the bracketed paste mode. Every
+// character is an event.
+static void BenchmarkParserTyping(benchmark::State& state) {
+  std::string input;
+  while (input.size() < 64 * 1024) {
+    input += "The quick brown fox jumps over the lazy dog. ";
+    input += "Größe, 測試, ℏ.\r";
+  }
+  ParseStream(state, input, size_t(state.range(0)));
+}
+BENCHMARK(BenchmarkParserTyping)->Arg(1)->Arg(4096);
+
+// Long escape sequences: the answers to the terminal queries, and keys with
+// modifiers.
+static void BenchmarkParserLongSequences(benchmark::State& state) {
+  std::string input;
+  for (int i = 0; i < 256; ++i) {
+    // DECRQSS answer, background color, mode report and cursor position.
+    input += "\x1BP1$r0;38;2;255;128;64;48;2;12;34;56m\x1B\\";
+    input += "\x1B]11;rgb:1e1e/1e1e/2e2e\x1B\\";
+    input += "\x1B[?2026;2$y";
+    input += "\x1B[" + std::to_string(1 + i % 60) + ";" +
+             std::to_string(1 + i % 200) + "R";
+    // Ctrl+Up, Ctrl+Shift+Right and Ctrl+Delete.
+    input += "\x1B[1;5A\x1B[1;6C\x1B[3;5~";
+  }
+  ParseStream(state, input, size_t(state.range(0)));
+}
+BENCHMARK(BenchmarkParserLongSequences)->Arg(1)->Arg(4096);
+
+// Component event dispatch --------------------------------------------------
+
+static void BenchmarkKeyboardDispatch(benchmark::State& state) {
+  bool checked = false;
+  auto form = Form(int(state.range(0)), &checked);
+  for (auto _ : state) {
+    for (int i = 0; i < 10; ++i) {
+      form->OnEvent(Event::ArrowDown);
+    }
+    for (int i = 0; i < 10; ++i) {
+      form->OnEvent(Event::ArrowUp);
+    }
+    form->OnEvent(Event::End);
+    form->OnEvent(Event::Home);
+  }
+}
+BENCHMARK(BenchmarkKeyboardDispatch)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BenchmarkMouseDispatch(benchmark::State& state) {
+  bool checked = false;
+  auto form = Form(int(state.range(0)), &checked);
+  Screen screen(80, int(state.range(0)));
+  Render(screen, form->Render());
+  for (auto _ : state) {
+    for (int y = 0; y < 20; ++y) {
+      form->OnEvent(MouseMovedAt(3, y));
+    }
+  }
+}
+BENCHMARK(BenchmarkMouseDispatch)->RangeMultiplier(8)->Range(8, 4096);
+
+// ScreenInteractive frame loop ----------------------------------------------
+
+// One key press, from the bytes received to the frame written.
+static void BenchmarkFrameLoop(benchmark::State& state) {
+  std::vector<std::string> entries;
+  int selected = 0;
+  auto component = ScrollingMenu(&entries, &selected, int(state.range(0)));
+
+  auto screen = ScreenInteractive::Headless(80, 24);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.HeadlessOutput();
+  int64_t bytes = 0;
+  for (auto _ : state) {
+    screen.HeadlessInput(selected + 1 < int(entries.size()) ? "\x1B[B"
+                                                             : "\x1B[H");
+    loop.RunOnce();
+    bytes += int64_t(screen.HeadlessOutput().size());
+  }
+  state.counters["frames/s"] =
+      benchmark::Counter(double(state.iterations()), benchmark::Counter::kIsRate);
+  state.counters["bytes/frame"] =
+      benchmark::Counter(double(bytes) / double(state.iterations()));
+}
+BENCHMARK(BenchmarkFrameLoop)->RangeMultiplier(8)->Range(8, 4096);
+
+// A burst of key presses, handled before drawing a single frame.
+static void BenchmarkEventThroughput(benchmark::State& state) {
+  std::vector<std::string> entries;
+  int selected = 0;
+  auto component = ScrollingMenu(&entries, &selected, 1000);
+
+  std::string input;
+  for (int i = 0; i < state.range(0); ++i) {
+    input += i % 2 ? "\x1B[A" : "\x1B[B";
+  }
+
+  auto screen = ScreenInteractive::Headless(80, 24);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  for (auto _ : state) {
+    screen.HeadlessInput(input);
+    loop.RunOnce();
+    screen.HeadlessOutput();
+  }
+  state.counters["events/s"] = benchmark::Counter(
+      double(state.iterations() * state.range(0)), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BenchmarkEventThroughput)->RangeMultiplier(8)->Range(1, 512);
+
+// Examples ------------------------------------------------------------------
+// The UIs of examples/component, driven headlessly by a script of inputs, one
+// per frame. The examples are programs of their own, so they are mirrored
+// here.
+
+namespace {
+
+struct Example {
+  Component component;
+  std::vector<std::string> script;  // The input of every frame, in a loop.
+  std::shared_ptr<void> state;      // What the component points to.
+};
+
+// examples/component/gallery.cpp
+Example Gallery() {
+  struct State {
+    std::vector<std::string> menu_entries = {"Menu 1", "Menu 2", "Menu 3"};
+    int menu_selected = 0;
+    std::vector<std::string> toggle_entries = {"Toggle_1", "Toggle_2"};
+    int toggle_selected = 0;
+    bool checked[3] = {false, false, false};
+    std::vector<std::string> radiobox_entries = {"Radiobox 1", "Radiobox 2",
+                                                 "Radiobox 3"};
+    int radiobox_selected = 0;
+    std::string input_content;
+    int slider_value = 42;
+    int clicks = 0;
+  };
+  auto s = std::make_shared<State>();
+
+  auto wrap = [](std::string name, Component component) {
+    return Renderer(component, [name, component] {
+      return hbox({
+                 text(name) | size(WIDTH, EQUAL, 8),
+                 separator(),
+                 component->Render() | xflex,
+             }) |
+             xflex;
+    });
+  };
+
+  auto layout = Container::Vertical({
+      wrap("Menu", Menu(&s->menu_entries, &s->menu_selected)),
+      wrap("Toggle", Toggle(&s->toggle_entries, &s->toggle_selected)),
+      wrap("Checkbox", Container::Vertical({
+                           Checkbox("checkbox1", &s->checked[0]),
+                           Checkbox("checkbox2", &s->checked[1]),
+                           Checkbox("checkbox3", &s->checked[2]),
+                       })),
+      wrap("Radiobox", Radiobox(&s->radiobox_entries, &s->radiobox_selected)),
+      wrap("Input", Input(&s->input_content, "placeholder")),
+      wrap("Button", Button("Click", [s = s.get()] { s->clicks++; })),
+      wrap("Slider", Slider("", &s->slider_value, 0, 100, 1)),
+  });
+  auto component = Renderer(layout, [layout] {
+    return vbox({
+               layout->Render(),
+               separator(),
+               gauge(0.5F),
+           }) |
+           border;
+  });
+
+  return {
+      component,
+      {"\x1B[B", "\t", "\x1B[C", "\t", " ", "\t", "\x1B[B", "\t", "a", "b",
+       "\x7F", "\t", "\r", "\t", "\x1B[C", "\x1B[D", "\x1B[Z"},
+      s,
+  };
+}
+
+// examples/component/menu_multiple.cpp
+Example MenuMultiple() {
+  struct State {
+    std::vector<std::string> entries[4];
+    int selected[4] = {0, 0, 0, 0};
+  };
+  auto s = std::make_shared<State>();
+
+  auto layout = Container::Horizontal({});
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 30; ++j) {
+      s->entries[i].push_back("entry " + std::to_string(i * 30 + j));
+    }
+    layout->Add(Menu(&s->entries[i], &s->selected[i]));
+  }
+  auto component = Renderer(layout, [layout, s = s.get()] {
+    Elements menus;
+    for (size_t i = 0; i < layout->ChildCount(); ++i) {
+      if (i != 0) {
+        menus.push_back(separator());
+      }
+      menus.push_back(layout->ChildAt(i)->Render() | vscroll_indicator |
+                      frame);
+    }
+    return vbox({
+               hbox(std::move(menus)) | flex,
+               separator(),
+               text("Selected: " + std::to_string(s->selected[0]) + " " +
+                    std::to_string(s->selected[1]) + " " +
+                    std::to_string(s->selected[2]) + " " +
+                    std::to_string(s->selected[3])),
+           }) |
+           border;
+  });
+
+  return {
+      component,
+      {"\x1B[B", "\x1B[B", "\x1B[B", "\x1B[C", "\x1B[B", "\x1B[B", "\x1B[C",
+       "\x1B[A", "\x1B[C", "\x1B[B", "\x1B[D", "\x1B[D", "\x1B[D"},
+      s,
+  };
+}
+
+// examples/component/canvas_animated.cpp
+Example CanvasAnimated() {
+  struct State {
+    int mouse_x = 0;
+    int mouse_y = 0;
+  };
+  auto s = std::make_shared<State>();
+
+  auto renderer = Renderer([s = s.get()] {
+    auto c = Canvas(100, 100);
+    c.DrawText(0, 0, "Several lines (braille)");
+    c.DrawPointLine(s->mouse_x, s->mouse_y, 80, 10, Color::Red);
+    c.DrawPointLine(80, 10, 80, 40, Color::Blue);
+    c.DrawPointLine(80, 40, s->mouse_x, s->mouse_y, Color::Green);
+    c.DrawPointCircleFilled(s->mouse_x, s->mouse_y, 20);
+    c.DrawBlockCircle(s->mouse_x, s->mouse_y, 30, Color::Yellow);
+    return canvas(std::move(c)) | border;
+  });
+  auto component = CatchEvent(renderer, [s = s.get()](Event event) {
+    if (event.is_mouse()) {
+      s->mouse_x = (event.mouse().x - 1) * 2;
+      s->mouse_y = (event.mouse().y - 1) * 4;
+    }
+    return false;
+  });
+
+  std::vector<std::string> script;
+  for (int i = 0; i < 40; ++i) {
+    const int x = 2 + i;
+    const int y = 2 + (i * 7) % 20;
+    script.push_back("\x1B[<35;" + std::to_string(x) + ";" +
+                     std::to_string(y) + "M");
+  }
+  return {component, std::move(script), s};
+}
+
+// examples/component/homescreen.cpp, reduced to its tabs: a table, gauges
+// and a text area.
+Example Homescreen() {
+  struct State {
+    std::vector<std::string> tab_entries = {"table", "gauges", "text"};
+    int tab_selected = 0;
+    std::string text;
+    int frame = 0;
+  };
+  auto s = std::make_shared<State>();
+
+  auto table = Renderer([s = s.get()] {
+    std::vector<std::vector<std::string>> rows = {
+        {"Version", "Marketing name", "Release date", "API level"}};
+    for (int i = 0; i < 16; ++i) {
+      rows.push_back({std::to_string(i + 1), "Name " + std::to_string(i),
+                      std::to_string(2000 + i + s->frame % 3),
+                      std::to_string(i * 3)});
+    }
+    auto t = Table(rows);
+    t.SelectAll().Border(LIGHT);
+    t.SelectRow(0).Decorate(bold);
+    t.SelectRow(0).SeparatorVertical(LIGHT);
+    t.SelectColumn(0).DecorateCells(align_right);
+    t.SelectRows(1, -1).DecorateCellsAlternateRow(color(Color::Blue), 3, 0);
+    return t.Render() | frame;
+  });
+  auto gauges = Renderer([s = s.get()] {
+    Elements lines;
+    for (int i = 0; i < 16; ++i) {
+      const float progress = float((s->frame + i * 7) % 100) / 100.F;
+      lines.push_back(hbox({
+          text("task " + std::to_string(i) + " "),
+          gauge(progress) | color(Color::Green) | flex,
+      }));
+    }
+    return vbox(std::move(lines));
+  });
+  InputOption area_option;
+  area_option.multiline = true;
+  auto area = Input(&s->text, "text", area_option);
+
+  auto tab = Container::Tab({table, gauges, area}, &s->tab_selected);
+  auto toggle = Toggle(&s->tab_entries, &s->tab_selected);
+  auto layout = Container::Vertical({toggle, tab});
+  auto component = Renderer(layout, [toggle, tab, s = s.get()] {
+    s->frame++;
+    return vbox({
+               text("FTXUI Demo") | bold | hcenter,
+               toggle->Render(),
+               separator(),
+               tab->Render() | flex,
+           }) |
+           border;
+  });
+
+  return {
+      component,
+      {"\x1B[B", "\x1B[A", "\x1B[C", "", "", "\x1B[C", "\x1B[B", "h", "e", "l",
+       "l", "o", "\r", "\x1B[A", "\x1B[D", "\x1B[D"},
+      s,
+  };
+}
+
+Example MakeExample(int64_t index) {
+  switch (index) {
+    case 0:
+      return Gallery();
+    case 1:
+      return MenuMultiple();
+    case 2:
+      return CanvasAnimated();
+    default:
+      return Homescreen();
+  }
+}
+
+}  // namespace
+
+// Run an example for as many frames as the benchmark requires. Report the
+// time per frame, the nodes constructed per frame (the allocations of the
+// Element trees), and the bytes printed per frame.
+static void BenchmarkExample(benchmark::State& state) {
+  const Example example = MakeExample(state.range(0));
+  auto screen = ScreenInteractive::Headless(80, 24);
+  Loop loop(&screen, example.component);
+  loop.RunOnce();
+  screen.HeadlessOutput();
+
+  int64_t bytes = 0;
+  const size_t nodes = NodesConstructed();
+  size_t step = 0;
+  for (auto _ : state) {
+    screen.HeadlessInput(example.script[step++ % example.script.size()]);
+    // Draw a frame, even when the input is empty.
+    screen.RequestAnimationFrame();
+    loop.RunOnce();
+    bytes += int64_t(screen.HeadlessOutput().size());
+  }
+  const auto frames = double(state.iterations());
+  state.counters["frames/s"] =
+      benchmark::Counter(frames, benchmark::Counter::kIsRate);
+  state.counters["bytes/frame"] = benchmark::Counter(double(bytes) / frames);
+  state.counters["nodes/frame"] =
+      benchmark::Counter(double(NodesConstructed() - nodes) / frames);
+  state.counters["memory"] =
+      benchmark::Counter(double(MemoryUsage(example.component)));
+}
+BENCHMARK(BenchmarkExample)
+    ->ArgName("example")
+    ->Arg(0)   // gallery
+    ->Arg(1)   // menu_multiple
+    ->Arg(2)   // canvas_animated
+    ->Arg(3);  // homescreen
+
+// Scaling -------------------------------------------------------------------
+// The complexity reported must stay linear. A quadratic behavior shows up as
+// "BigO: N^2".
+
+namespace {
+
+// A Container::Vertical of |size| rows.
+Component Rows(int size) {
+  auto container = Container::Vertical({});
+  for (int i = 0; i < size; ++i) {
+    container->Add(Renderer([i](bool focused) {
+      auto element = text("Row " + std::to_string(i));
+      return focused ? element | inverted | focus : element;
+    }));
+  }
+  return container;
+}
+
+// |depth| containers, nested into each other, alternating the directions.
+// Return the innermost component in |leaf|.
+Component Nested(int depth, Component* leaf) {
+  *leaf = Renderer([](bool focused) {
+    return focused ? text("leaf") | inverted : text("leaf");
+  });
+  Component component = *leaf;
+  for (int i = 0; i < depth; ++i) {
+    auto child = component;
+    auto container = i % 2 ? Container::Horizontal({child, Button("x", [] {})})
+                           : Container::Vertical({child, Button("y", [] {})});
+    component = Renderer(container, [container, i] {
+      Elements children;
+      for (size_t c = 0; c < container->ChildCount(); ++c) {
+        children.push_back(container->ChildAt(c)->Render());
+      }
+      return i % 2 ? hbox(std::move(children)) : vbox(std::move(children));
+    });
+  }
+  return component;
+}
+
+}  // namespace
+
+static void BenchmarkScalingRowsRender(benchmark::State& state) {
+  auto rows = Rows(int(state.range(0)));
+  Screen screen(80, 24);
+  for (auto _ : state) {
+    Render(screen, rows->Render() | vscroll_indicator | frame);
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BenchmarkScalingRowsRender)
+    ->RangeMultiplier(4)
+    ->Range(16, 16 << 10)
+    ->Complexity();
+
+static void BenchmarkScalingRowsOnEvent(benchmark::State& state) {
+  auto rows = Rows(int(state.range(0)));
+  for (auto _ : state) {
+    rows->OnEvent(Event::ArrowDown);
+    rows->OnEvent(Event::ArrowUp);
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BenchmarkScalingRowsOnEvent)
+    ->RangeMultiplier(4)
+    ->Range(16, 16 << 10)
+    ->Complexity();
+
+// Every row asks whether it is focused, as they do while rendering.
+static void BenchmarkScalingRowsFocused(benchmark::State& state) {
+  auto rows = Rows(int(state.range(0)));
+  for (auto _ : state) {
+    int focused = 0;
+    for (size_t i = 0; i < rows->ChildCount(); ++i) {
+      focused += rows->ChildAt(i)->Focused();
+    }
+    benchmark::DoNotOptimize(focused);
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BenchmarkScalingRowsFocused)
+    ->RangeMultiplier(4)
+    ->Range(16, 16 << 10)
+    ->Complexity();
+
+static void BenchmarkScalingDepthRender(benchmark::State& state) {
+  Component leaf;
+  auto component = Nested(int(state.range(0)), &leaf);
+  Screen screen(80, 24);
+  for (auto _ : state) {
+    Render(screen, component->Render());
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BenchmarkScalingDepthRender)
+    ->RangeMultiplier(2)
+    ->Range(8, 256)
+    ->Complexity();
+
+// The events go from the root to the leaf, through every level.
+static void BenchmarkScalingDepthOnEvent(benchmark::State& state) {
+  Component leaf;
+  auto component = Nested(int(state.range(0)), &leaf);
+  for (auto _ : state) {
+    component->OnEvent(Event::Character('a'));
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BenchmarkScalingDepthOnEvent)
+    ->RangeMultiplier(2)
+    ->Range(8, 256)
+    ->Complexity();
+
+// Focused() walks from the leaf to the root.
+static void BenchmarkScalingDepthFocused(benchmark::State& state) {
+  Component leaf;
+  auto component = Nested(int(state.range(0)), &leaf);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(leaf->Focused());
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BenchmarkScalingDepthFocused)
+    ->RangeMultiplier(2)
+    ->Range(8, 256)
+    ->Complexity();
+
+}  // namespace ftxui
+// NOLINTEND
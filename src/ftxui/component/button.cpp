@@ -11,6 +11,7 @@
 #include "ftxui/component/component.hpp"       // for Make, Button
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for ButtonOption, AnimatedColorOption, AnimatedColorsOption, EntryState
+#include "ftxui/component/entry.hpp"  // for Transform, ButtonTransform
 #include "ftxui/component/event.hpp"  // for Event, Event::Return
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/component/screen_interactive.hpp"  // for Component
@@ -23,17 +24,6 @@ namespace ftxui {
 
 namespace {
 
-Element DefaultTransform(EntryState params) {  // NOLINT
-  auto element = text(params.label) | border;
-  if (params.active) {
-    element |= bold;
-  }
-  if (params.focused) {
-    element |= inverted;
-  }
-  return element;
-}
-
 class ButtonBase : public ComponentBase, public ButtonOption {
  public:
   explicit ButtonBase(ButtonOption option) : ButtonOption(std::move(option)) {}
@@ -45,7 +35,7 @@ class ButtonBase : public ComponentBase, public ButtonOption {
     const bool focused_or_hover = focused || mouse_hover_;
 
     float target = focused_or_hover ? 1.f : 0.f;  // NOLINT
-    if (target != animator_background_.to()) {
+    if (target != animation_target_) {
       SetAnimationTarget(target);
     }
 
@@ -57,8 +47,7 @@ class ButtonBase : public ComponentBase, public ButtonOption {
         focused_or_hover,
     };
 
-    auto element = (transform ? transform : DefaultTransform)  //
-        (state);
+    auto element = Transform(transform, ButtonTransform, state);
     return element | AnimatedColorStyle() | focus_management | reflect(box_);
   }
 
@@ -79,7 +68,10 @@ class ButtonBase : public ComponentBase, public ButtonOption {
     return style;
   }
 
+  // Only the enabled colors are animated. Comparing the target with the one
+  // of a disabled animator would restart the others on every frame.
   void SetAnimationTarget(float target) {
+    animation_target_ = target;
     if (animated_colors.foreground.enabled) {
       animator_foreground_ = animation::Animator(
           &animation_foreground_, target, animated_colors.foreground.duration,
@@ -93,6 +85,9 @@ class ButtonBase : public ComponentBase, public ButtonOption {
   }
 
   void OnAnimation(animation::Params& p) override {
+    if (animator_background_.running() || animator_foreground_.running()) {
+      Invalidate();
+    }
     animator_background_.OnAnimation(p);
     animator_foreground_.OnAnimation(p);
   }
@@ -138,11 +133,15 @@ class ButtonBase : public ComponentBase, public ButtonOption {
   }
 
   bool Focusable() const final { return true; }
+  int EventCategories() const final {
+    return KeyboardEvents | MouseButtonEvents | MouseMotionEvents;
+  }
 
  private:
   bool mouse_hover_ = false;
   Box box_;
   ButtonOption option_;
+  float animation_target_ = 0;
   float animation_background_ = 0;
   float animation_foreground_ = 0;
   animation::Animator animator_background_ =
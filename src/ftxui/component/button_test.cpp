@@ -11,6 +11,7 @@
 #include "ftxui/component/component_options.hpp"  // for ButtonOption
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowLeft, Event::ArrowRight
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"     // for text
 #include "ftxui/dom/node.hpp"         // for Render
 #include "ftxui/screen/screen.hpp"    // for Screen
 #include "ftxui/screen/terminal.hpp"  // for SetColorSupport, Color, TrueColor
@@ -96,6 +97,7 @@ TEST(ButtonTest, Basic) {
   (void)container->Render();
 }
 
+#if !defined(FTXUI_NO_ANIMATIONS)
 TEST(ButtonTest, Animation) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   int press_count = 0;
@@ -191,6 +193,30 @@ TEST(ButtonTest, Animation) {
         "\x1B[39m\x1B[49m");
   }
 }
+#endif
+
+// The animation isn't restarted on every frame, when only the foreground is
+// animated.
+TEST(ButtonTest, AnimationForegroundOnly) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  ButtonOption option;
+  option.transform = [](const EntryState& s) { return text(s.label); };
+  option.animated_colors.foreground.Set(
+      Color::RGB(0, 0, 0), Color::RGB(200, 0, 0),
+      std::chrono::milliseconds(100), animation::easing::Linear);
+  auto button = Button("b", [] {}, option);
+
+  animation::Params params(std::chrono::milliseconds(60));
+  Screen screen(1, 1);
+  for (int i = 0; i < 2; ++i) {
+    Render(screen, button->Render());
+    button->OnAnimation(params);
+  }
+  Render(screen, button->Render());
+  const Color active =
+      Color::Interpolate(1.F, Color::RGB(0, 0, 0), Color::RGB(200, 0, 0));
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, active);
+}
 
 }  // namespace ftxui
 // NOLINTEND
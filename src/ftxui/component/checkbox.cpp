@@ -8,6 +8,7 @@
 #include "ftxui/component/component.hpp"       // for Make, Checkbox
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
 #include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState
+#include "ftxui/component/entry.hpp"  // for Transform, CheckboxTransform
 #include "ftxui/component/event.hpp"              // for Event, Event::Return
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, focus, nothing, select
@@ -34,8 +35,7 @@ class CheckboxBase : public ComponentBase, public CheckboxOption {
         is_active,
         is_focused || hovered_,
     };
-    auto element = (transform ? transform : CheckboxOption::Simple().transform)(
-        entry_state);
+    auto element = Transform(transform, CheckboxTransform, entry_state);
     return element | focus_management | reflect(box_);
   }
 
@@ -81,6 +81,9 @@ class CheckboxBase : public ComponentBase, public CheckboxOption {
   }
 
   bool Focusable() const final { return true; }
+  int EventCategories() const final {
+    return KeyboardEvents | MouseButtonEvents | MouseMotionEvents;
+  }
 
   bool hovered_ = false;
   Box box_;
@@ -0,0 +1,270 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>   // for fill, max, min
+#include <deque>       // for deque
+#include <functional>  // for function
+#include <utility>     // for move
+#include <vector>      // for vector
+
+#include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
+#include "ftxui/component/component.hpp"       // for Make, Checklist
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for ChecklistOption, EntryState
+#include "ftxui/component/entry.hpp"  // for Transform, CheckboxTransform
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, focus, nothing, select, virtualList
+#include "ftxui/screen/box.hpp"   // for Box
+#include "ftxui/screen/util.hpp"  // for clamp
+#include "ftxui/util/ref.hpp"     // for Ref, ConstStringListRef
+
+namespace ftxui {
+
+namespace {
+
+/// @brief A list of checkboxes, whose states are bits of a single vector.
+/// Only the entries visible on screen are built.
+/// @ingroup component
+class ChecklistBase : public ComponentBase, public ChecklistOption {
+ public:
+  explicit ChecklistBase(ChecklistOption option)
+      : ChecklistOption(std::move(option)) {}
+
+ private:
+  Element Render() override {
+    Clamp();
+    const bool is_focused = Focused();
+    rendered_.clear();
+    boxes_.clear();
+    auto row = [this, is_focused](int i) {
+      return RenderEntry(i, is_focused);
+    };
+    return virtualList(size(), std::move(row), focused_entry()) |
+           reflect(box_);
+  }
+
+  Element RenderEntry(int i, bool is_focused) {
+    const bool is_hovered = focused_entry() == i;
+    auto focus_management = !is_hovered ? nothing
+                            : is_focused ? focus
+                                         : select;
+    auto state = EntryState{
+        entries[i],
+        bool(checked()[i]),
+        is_hovered,
+        is_hovered && is_focused,
+    };
+    auto element = Transform(transform, CheckboxTransform, state);
+    rendered_.push_back(i);
+    boxes_.emplace_back();
+    return element | focus_management | reflect(boxes_.back());
+  }
+
+  bool OnEvent(Event event) override {
+    Clamp();
+    if (!CaptureMouse(event)) {
+      return false;
+    }
+
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+
+    if (!Focused()) {
+      return false;
+    }
+
+    const int old_focused = focused_entry();
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      focused_entry()--;
+    }
+    if (event == Event::ArrowDown || event == Event::Character('j')) {
+      focused_entry()++;
+    }
+    if (event == Event::PageUp) {
+      focused_entry() -= box_.y_max - box_.y_min;
+    }
+    if (event == Event::PageDown) {
+      focused_entry() += box_.y_max - box_.y_min;
+    }
+    if (event == Event::Home) {
+      focused_entry() = 0;
+    }
+    if (event == Event::End) {
+      focused_entry() = size() - 1;
+    }
+
+    // Extend the range from the anchor, with the state of the anchor.
+    if (event == Event::Character('K')) {
+      focused_entry()--;
+      Clamp();
+      SetRange(focused_entry());
+      return true;
+    }
+    if (event == Event::Character('J')) {
+      focused_entry()++;
+      Clamp();
+      SetRange(focused_entry());
+      return true;
+    }
+
+    Clamp();
+    if (focused_entry() != old_focused) {
+      return true;
+    }
+
+    if (event == Event::Character(' ') || event == Event::Return) {
+      Toggle(focused_entry());
+      return true;
+    }
+
+    return false;
+  }
+
+  bool OnMouseEvent(Event event) {
+    if (event.mouse().button == Mouse::WheelDown ||
+        event.mouse().button == Mouse::WheelUp) {
+      return OnMouseWheel(event);
+    }
+
+    if (event.mouse().button != Mouse::Left ||
+        event.mouse().motion != Mouse::Pressed) {
+      return false;
+    }
+
+    const int i = EntryAt(event.mouse().x, event.mouse().y);
+    if (i == -1) {
+      return false;
+    }
+
+    TakeFocus();
+    focused_entry() = i;
+    if (event.mouse().shift) {
+      SetRange(i);
+    } else {
+      Toggle(i);
+    }
+    return true;
+  }
+
+  bool OnMouseWheel(Event event) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+    if (event.mouse().button == Mouse::WheelUp) {
+      focused_entry()--;
+    }
+    if (event.mouse().button == Mouse::WheelDown) {
+      focused_entry()++;
+    }
+    Clamp();
+    return true;
+  }
+
+  // Return the entry displayed at (x,y), -1 if none.
+  int EntryAt(int x, int y) const {
+    for (size_t k = 0; k < rendered_.size(); ++k) {
+      if (rendered_[k] < size() && boxes_[k].Contain(x, y)) {
+        return rendered_[k];
+      }
+    }
+    return -1;
+  }
+
+  void Toggle(int i) {
+    if (i < 0 || i >= size()) {
+      return;
+    }
+    checked()[i] = !checked()[i];
+    anchor_ = i;
+    on_change();
+  }
+
+  // Give the entries between the anchor and |i| the state of the anchor.
+  void SetRange(int i) {
+    if (size() == 0) {
+      return;
+    }
+    anchor_ = util::clamp(anchor_, 0, size() - 1);
+    const bool value = checked()[anchor_];
+    const int begin = std::min(anchor_, i);
+    const int end = std::max(anchor_, i);
+    std::fill(checked().begin() + begin, checked().begin() + end + 1, value);
+    on_change();
+  }
+
+  void Clamp() {
+    if (int(checked().size()) != size()) {
+      checked().resize(size());
+    }
+    focused_entry() = util::clamp(focused_entry(), 0, size() - 1);
+  }
+
+  bool Focusable() const final { return entries.size(); }
+  int EventCategories() const final {
+    return KeyboardEvents | MouseButtonEvents;
+  }
+  int size() const { return int(entries.size()); }
+
+  int anchor_ = 0;
+  Box box_;
+
+  // The entries built by the last Render, and their boxes. A deque, so that
+  // the boxes stay in place while entries are built.
+  std::vector<int> rendered_;
+  std::deque<Box> boxes_;
+};
+
+}  // namespace
+
+/// @brief A list of checkboxes, for a large number of entries. As opposed to
+/// one Checkbox per entry, this is a single component, storing the states as
+/// one bit per entry, and building only the entries visible inside a `frame`.
+///
+/// Space, Return or a click toggles an entry. `J`/`K`, or a click with Shift,
+/// give the state of the last entry toggled to every entry up to the new one.
+/// @param option The parameters
+/// @ingroup component
+/// @see Checkbox
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::TerminalOutput();
+/// std::vector<std::string> entries = ListPackages();
+/// std::vector<bool> checked;
+/// auto checklist = Checklist({
+///   .entries = &entries,
+///   .checked = &checked,
+/// });
+/// screen.Loop(checklist | vscroll_indicator | frame);
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// ☐ entry 1
+/// ▣ entry 2
+/// ☐ entry 3
+/// ```
+Component Checklist(ChecklistOption option) {
+  return Make<ChecklistBase>(std::move(option));
+}
+
+/// @brief A list of checkboxes, for a large number of entries.
+/// @param entries The list of entries.
+/// @param checked Whether every entry is checked. It is resized to the number
+/// of entries.
+/// @param option Additional optional parameters.
+/// @ingroup component
+/// @see Checkbox
+Component Checklist(ConstStringListRef entries,
+                    std::vector<bool>* checked,
+                    ChecklistOption option) {
+  option.entries = entries;
+  option.checked = checked;
+  return Make<ChecklistBase>(std::move(option));
+}
+
+}  // namespace ftxui
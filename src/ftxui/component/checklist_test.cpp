@@ -0,0 +1,102 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/component/component.hpp"  // for Checklist
+#include "ftxui/component/component_options.hpp"  // for ChecklistOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"     // for yframe
+#include "ftxui/dom/node.hpp"         // for Render, NodesConstructed
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Event MousePressed(int x, int y, bool shift) {
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.shift = shift;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
+
+}  // namespace
+
+TEST(ChecklistTest, Toggle) {
+  std::vector<std::string> entries = {"a", "b", "c"};
+  std::vector<bool> checked;
+  auto checklist = Checklist(&entries, &checked);
+
+  EXPECT_TRUE(checklist->OnEvent(Event::Return));
+  EXPECT_EQ(checked, std::vector<bool>({true, false, false}));
+  EXPECT_TRUE(checklist->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(checklist->OnEvent(Event::Character(' ')));
+  EXPECT_EQ(checked, std::vector<bool>({true, true, false}));
+  EXPECT_TRUE(checklist->OnEvent(Event::Return));
+  EXPECT_EQ(checked, std::vector<bool>({true, false, false}));
+}
+
+TEST(ChecklistTest, Range) {
+  std::vector<std::string> entries = {"a", "b", "c", "d", "e"};
+  std::vector<bool> checked;
+  int changes = 0;
+  auto checklist = Checklist({
+      .entries = &entries,
+      .checked = &checked,
+      .on_change = [&] { changes++; },
+  });
+
+  // Extend the range with the keyboard.
+  EXPECT_TRUE(checklist->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(checklist->OnEvent(Event::Return));
+  EXPECT_TRUE(checklist->OnEvent(Event::Character('J')));
+  EXPECT_TRUE(checklist->OnEvent(Event::Character('J')));
+  EXPECT_EQ(checked, std::vector<bool>({false, true, true, true, false}));
+  EXPECT_EQ(changes, 3);
+
+  // Extend the range with the mouse.
+  Screen screen(10, 5);
+  Render(screen, checklist->Render());
+  EXPECT_TRUE(checklist->OnEvent(MousePressed(0, 4, false)));
+  EXPECT_EQ(checked, std::vector<bool>({false, true, true, true, true}));
+  EXPECT_TRUE(checklist->OnEvent(MousePressed(0, 0, false)));
+  EXPECT_TRUE(checklist->OnEvent(MousePressed(0, 2, true)));
+  EXPECT_EQ(checked, std::vector<bool>({true, true, true, true, true}));
+}
+
+TEST(ChecklistTest, Virtualized) {
+  std::vector<bool> checked(100000);
+  checked[99998] = true;
+  auto checklist = Checklist({
+      .entries = {[] { return size_t(100000); },
+                  [](size_t i) -> std::string_view {
+                    return i % 2 ? "odd" : "even";
+                  }},
+      .checked = &checked,
+  });
+  EXPECT_TRUE(checklist->OnEvent(Event::End));
+
+  Screen screen(8, 2);
+  const size_t before = NodesConstructed();
+  Render(screen, checklist->Render() | yframe);
+  // Only the visible entries are built.
+  EXPECT_LT(NodesConstructed() - before, size_t(100));
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "▣");
+  EXPECT_EQ(screen.PixelAt(2, 0).character, "e");
+  EXPECT_EQ(screen.PixelAt(0, 1).character, "☐");
+  EXPECT_EQ(screen.PixelAt(2, 1).character, "o");
+  EXPECT_TRUE(screen.PixelAt(2, 1).inverted);
+}
+
+}  // namespace ftxui
+// NOLINTEND
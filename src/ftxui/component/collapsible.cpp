@@ -5,9 +5,10 @@
 #include <memory>      // for shared_ptr, allocator
 #include <utility>     // for move
 
-#include "ftxui/component/component.hpp"  // for Checkbox, Maybe, Make, Vertical, Collapsible
+#include "ftxui/component/component.hpp"  // for Checkbox, Maybe, Make, Vertical, Collapsible, ComponentFactory
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
-#include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState
+#include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState, LazyOption
+#include "ftxui/component/lazy.hpp"  // for LazyBase
 #include "ftxui/dom/elements.hpp"  // for operator|=, text, hbox, Element, bold, inverted
 #include "ftxui/util/ref.hpp"  // for Ref, ConstStringRef
 
@@ -30,32 +31,106 @@ namespace ftxui {
 /// ▼ Show details
 /// <details component>
 ///  ```
+namespace {
+
+Element CollapsibleTransform(const EntryState& s) {
+  auto prefix = text(s.state ? "▼ " : "▶ ");  // NOLINT
+  auto t = text(s.label);
+  if (s.active) {
+    t |= bold;
+  }
+  if (s.focused) {
+    t |= inverted;
+  }
+  return hbox({prefix, t});
+}
+
+}  // namespace
+
+/// @brief A collapsible component. It display a checkbox with an arrow. Once
+/// activated, the children is displayed.
+/// @param label The label of the checkbox.
+/// @param child The children to display.
+/// @param show Hold the state about whether the children is displayed or not.
+///
+/// ### Example
+/// ```cpp
+/// auto component = Collapsible("Show details", details);
+/// ```
+///
+/// ### Output
+/// ```
+///
+/// ▼ Show details
+/// <details component>
+///  ```
 // NOLINTNEXTLINE
 Component Collapsible(ConstStringRef label, Component child, Ref<bool> show) {
   class Impl : public ComponentBase {
    public:
     Impl(ConstStringRef label, Component child, Ref<bool> show) : show_(show) {
       CheckboxOption opt;
-      opt.transform = [](EntryState s) {            // NOLINT
-        auto prefix = text(s.state ? "▼ " : "▶ ");  // NOLINT
-        auto t = text(s.label);
-        if (s.active) {
-          t |= bold;
-        }
-        if (s.focused) {
-          t |= inverted;
-        }
-        return hbox({prefix, t});
-      };
+      opt.transform = CollapsibleTransform;
       Add(Container::Vertical({
           Checkbox(label, show_.operator->(), opt),
           Maybe(std::move(child), show_.operator->()),
       }));
     }
+    int EventCategories() const override { return 0; }
     Ref<bool> show_;
   };
 
   return Make<Impl>(std::move(label), std::move(child), show);
 }
 
+/// @brief A collapsible component, whose child is built by |child| the first
+/// time it is expanded. Useful when most sections are never opened.
+/// @param label The label of the checkbox.
+/// @param child Build the children to display.
+/// @param show Hold the state about whether the children is displayed or not.
+/// @param option With |release_after|, the children is destroyed once
+/// collapsed for this long, and built again when expanded.
+///
+/// ### Example
+/// ```cpp
+/// auto component = Collapsible("Show details", [] { return Details(); });
+/// ```
+// NOLINTNEXTLINE
+Component Collapsible(ConstStringRef label,
+                      ComponentFactory child,
+                      Ref<bool> show,
+                      LazyOption option) {
+  class Impl : public ComponentBase {
+   public:
+    Impl(ConstStringRef label,
+         ComponentFactory child,
+         Ref<bool> show,
+         LazyOption option)
+        : show_(show),
+          lazy_(Make<LazyBase>(std::move(child), std::move(option))) {
+      CheckboxOption opt;
+      opt.transform = CollapsibleTransform;
+      Add(Container::Vertical({
+          Checkbox(label, show_.operator->(), opt),
+          Maybe(lazy_, show_.operator->()),
+      }));
+    }
+
+   private:
+    Element Render() override {
+      if (!*show_) {
+        lazy_->Hide();
+      }
+      return ComponentBase::Render();
+    }
+    int EventCategories() const override { return 0; }
+
+    Ref<bool> show_;
+    std::shared_ptr<LazyBase> lazy_;
+  };
+
+  return Make<Impl>(std::move(label), std::move(child), show,
+                    std::move(option));
+}
+
 }  // namespace ftxui
@@ -1,3 +1,4 @@
+#include <chrono>  // for milliseconds
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator
 #include <string>  // for string
 
@@ -48,6 +49,39 @@ TEST(CollapsibleTest, Basic) {
   EXPECT_EQ(show, false);
 }
 
+TEST(CollapsibleTest, Lazy) {
+  int built = 0;
+  bool show = false;
+  auto collapsible = Collapsible(
+      "parent",
+      [&] {
+        built++;
+        return Renderer([] { return text("child"); });
+      },
+      &show, {.release_after = std::chrono::milliseconds(0)});
+
+  Screen screen(8, 2);
+  Render(screen, collapsible->Render());
+  EXPECT_EQ(built, 0);
+
+  // The child is built once expanded.
+  collapsible->OnEvent(Event::Return);
+  EXPECT_EQ(show, true);
+  Render(screen, collapsible->Render());
+  EXPECT_EQ(built, 1);
+  EXPECT_EQ(screen.PixelAt(0, 1).character, "c");
+  Render(screen, collapsible->Render());
+  EXPECT_EQ(built, 1);
+
+  // It is released once collapsed, and built again when expanded.
+  collapsible->OnEvent(Event::Return);
+  EXPECT_EQ(show, false);
+  collapsible->Render();
+  collapsible->OnEvent(Event::Return);
+  collapsible->Render();
+  EXPECT_EQ(built, 2);
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -12,6 +12,7 @@
 #include "ftxui/component/component.hpp"
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Components
 #include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/mouse.hpp"           // for Mouse, Mouse::Moved
 #include "ftxui/component/screen_interactive.hpp"  // for Component, ScreenInteractive
 #include "ftxui/dom/elements.hpp"                  // for text, Element
 
@@ -57,6 +58,8 @@ void ComponentBase::Add(Component child) {
   child->Detach();
   child->parent_ = this;
   children_.push_back(std::move(child));
+  InvalidateSubscriptions();
+  Invalidate();
 }
 
 /// @brief Detach this child from its parent.
@@ -74,6 +77,8 @@ void ComponentBase::Detach() {
                          });
   ComponentBase* parent = parent_;
   parent_ = nullptr;
+  parent->InvalidateSubscriptions();
+  parent->Invalidate();
   parent->children_.erase(it);  // Might delete |this|.
 }
 
@@ -105,7 +110,7 @@ Element ComponentBase::Render() {
 /// @ingroup component
 bool ComponentBase::OnEvent(Event event) {  // NOLINT
   for (Component& child : children_) {      // NOLINT
-    if (child->OnEvent(event)) {
+    if (child->Subscribes(event) && child->OnEvent(event)) {
       return true;
     }
   }
@@ -122,6 +127,71 @@ void ComponentBase::OnAnimation(animation::Params& params) {
   }
 }
 
+/// @brief Return the category of |event|.
+/// @ingroup component
+ComponentBase::EventCategory ComponentBase::CategoryOf(const Event& event) {
+  if (event.type_ == Event::Type::Mouse) {
+    return event.data_.mouse.motion == Mouse::Moved ? MouseMotionEvents
+                                                    : MouseButtonEvents;
+  }
+  if (event == Event::Custom || event == Event::Resize) {
+    return CustomEvents;
+  }
+  return KeyboardEvents;
+}
+
+/// @brief The categories of events handled by the component itself. The
+/// events of the other categories are only forwarded to its children, if any.
+/// The default implementation returns AllEvents. Components overriding it
+/// aren't offered the events they didn't subscribe to, unless one of their
+/// descendants did.
+/// @ingroup component
+int ComponentBase::EventCategories() const {
+  return AllEvents;
+}
+
+/// @brief Whether the component, or one of its descendants, subscribed to the
+/// category of |event|. The result is cached until the children change.
+/// @param event The event.
+/// @ingroup component
+bool ComponentBase::Subscribes(const Event& event) const {
+  return (Subscriptions() & CategoryOf(event)) != 0;
+}
+
+int ComponentBase::Subscriptions() const {
+  if (subscriptions_ < 0) {
+    int subscriptions = EventCategories();
+    for (const Component& child : children_) {
+      if (subscriptions == AllEvents) {
+        break;
+      }
+      subscriptions |= child->Subscriptions();
+    }
+    subscriptions_ = subscriptions;
+  }
+  return subscriptions_;
+}
+
+void ComponentBase::InvalidateSubscriptions() {
+  for (ComponentBase* it = this; it && it->subscriptions_ >= 0;
+       it = it->parent_) {
+    it->subscriptions_ = -1;
+  }
+}
+
+/// @brief Mark the component and its ancestors as needing to be rendered
+/// again. The components reusing what they rendered, like Memo(component), do
+/// it again on the next frame.
+///
+/// This must be called from the thread running the loop. From another thread,
+/// post a closure calling it.
+/// @ingroup component
+void ComponentBase::Invalidate() {
+  for (ComponentBase* it = this; it; it = it->parent_) {
+    it->invalidated_ = true;
+  }
+}
+
 /// @brief Return the currently Active child.
 /// @return the currently Active child.
 /// @ingroup component
@@ -147,6 +217,23 @@ bool ComponentBase::Focusable() const {
   return false;
 }
 
+/// @brief The bytes retained by the component, excluding its children. The
+/// components retaining more than their base class add the difference.
+/// @ingroup component
+size_t ComponentBase::MemoryUsage() const {
+  return sizeof(ComponentBase) + children_.capacity() * sizeof(Component);
+}
+
+/// @brief The bytes retained by |component| and all its descendants.
+/// @ingroup component
+size_t MemoryUsage(const Component& component) {
+  size_t bytes = component->MemoryUsage();
+  for (size_t i = 0; i < component->ChildCount(); ++i) {
+    bytes += MemoryUsage(component->ChildAt(i));
+  }
+  return bytes;
+}
+
 /// @brief Returns if the element if the currently active child of its parent.
 /// @ingroup component
 bool ComponentBase::Active() const {
@@ -9,6 +9,9 @@
 #include <utility>                 // for move
 
 #include "ftxui/component/animation.hpp"  // for Function, Duration
+#include "ftxui/component/entry.hpp"  // for ButtonTransform, CheckboxTransform, InputTransform, MenuHorizontalTransform, MenuVerticalTransform, RadioboxTransform, ButtonSimpleTransform
+#include "ftxui/component/event.hpp"      // for Event
+#include "ftxui/component/keymap.hpp"     // for Keymap
 #include "ftxui/dom/elements.hpp"  // for operator|=, Element, text, bgcolor, inverted, bold, dim, operator|, color, borderEmpty, hbox, automerge, border, borderLight
 
 namespace ftxui {
@@ -76,19 +79,7 @@ void UnderlineOption::SetAnimationFunction(
 MenuOption MenuOption::Horizontal() {
   MenuOption option;
   option.direction = Direction::Right;
-  option.entries_option.transform = [](const EntryState& state) {
-    Element e = text(state.label);
-    if (state.focused) {
-      e |= inverted;
-    }
-    if (state.active) {
-      e |= bold;
-    }
-    if (!state.focused && !state.active) {
-      e |= dim;
-    }
-    return e;
-  };
+  option.entries_option.transform = MenuHorizontalTransform;
   option.elements_infix = [] { return text(" "); };
 
   return option;
@@ -110,19 +101,7 @@ MenuOption MenuOption::HorizontalAnimated() {
 // static
 MenuOption MenuOption::Vertical() {
   MenuOption option;
-  option.entries_option.transform = [](const EntryState& state) {
-    Element e = text((state.active ? "> " : "  ") + state.label);  // NOLINT
-    if (state.focused) {
-      e |= inverted;
-    }
-    if (state.active) {
-      e |= bold;
-    }
-    if (!state.focused && !state.active) {
-      e |= dim;
-    }
-    return e;
-  };
+  option.entries_option.transform = MenuVerticalTransform;
   return option;
 }
 
@@ -132,19 +111,7 @@ MenuOption MenuOption::Vertical() {
 // static
 MenuOption MenuOption::VerticalAnimated() {
   auto option = MenuOption::Vertical();
-  option.entries_option.transform = [](const EntryState& state) {
-    Element e = text(state.label);
-    if (state.focused) {
-      e |= inverted;
-    }
-    if (state.active) {
-      e |= bold;
-    }
-    if (!state.focused && !state.active) {
-      e |= dim;
-    }
-    return e;
-  };
+  option.entries_option.transform = MenuHorizontalTransform;
   option.underline.enabled = true;
   return option;
 }
@@ -159,6 +126,29 @@ MenuOption MenuOption::Toggle() {
   return option;
 }
 
+/// @brief The keys handled by the menu by default.
+/// @ingroup component
+// static
+Keymap<MenuAction> MenuOption::DefaultKeymap() {
+  return {
+      {Event::ArrowUp, MenuAction::Up},
+      {Event::Character('k'), MenuAction::Up},
+      {Event::ArrowDown, MenuAction::Down},
+      {Event::Character('j'), MenuAction::Down},
+      {Event::ArrowLeft, MenuAction::Left},
+      {Event::Character('h'), MenuAction::Left},
+      {Event::ArrowRight, MenuAction::Right},
+      {Event::Character('l'), MenuAction::Right},
+      {Event::PageUp, MenuAction::PageUp},
+      {Event::PageDown, MenuAction::PageDown},
+      {Event::Home, MenuAction::First},
+      {Event::End, MenuAction::Last},
+      {Event::Tab, MenuAction::Next},
+      {Event::TabReverse, MenuAction::Previous},
+      {Event::Return, MenuAction::Enter},
+  };
+}
+
 /// @brief Create a ButtonOption, highlighted using [] characters.
 /// @ingroup component
 // static
@@ -177,13 +167,7 @@ ButtonOption ButtonOption::Ascii() {
 // static
 ButtonOption ButtonOption::Simple() {
   ButtonOption option;
-  option.transform = [](const EntryState& s) {
-    auto element = text(s.label) | borderLight;
-    if (s.focused) {
-      element |= inverted;
-    }
-    return element;
-  };
+  option.transform = ButtonSimpleTransform;
   return option;
 }
 
@@ -192,16 +176,7 @@ ButtonOption ButtonOption::Simple() {
 /// @ingroup component
 ButtonOption ButtonOption::Border() {
   ButtonOption option;
-  option.transform = [](const EntryState& s) {
-    auto element = text(s.label) | border;
-    if (s.active) {
-      element |= bold;
-    }
-    if (s.focused) {
-      element |= inverted;
-    }
-    return element;
-  };
+  option.transform = ButtonTransform;
   return option;
 }
 
@@ -262,23 +237,7 @@ ButtonOption ButtonOption::Animated(Color background,
 // static
 CheckboxOption CheckboxOption::Simple() {
   auto option = CheckboxOption();
-  option.transform = [](const EntryState& s) {
-#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
-    // Microsoft terminal do not use fonts able to render properly the default
-    // radiobox glyph.
-    auto prefix = text(s.state ? "[X] " : "[ ] ");  // NOLINT
-#else
-    auto prefix = text(s.state ? "▣ " : "☐ ");  // NOLINT
-#endif
-    auto t = text(s.label);
-    if (s.active) {
-      t |= bold;
-    }
-    if (s.focused) {
-      t |= inverted;
-    }
-    return hbox({prefix, t});
-  };
+  option.transform = CheckboxTransform;
   return option;
 }
 
@@ -287,23 +246,7 @@ CheckboxOption CheckboxOption::Simple() {
 // static
 RadioboxOption RadioboxOption::Simple() {
   auto option = RadioboxOption();
-  option.transform = [](const EntryState& s) {
-#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
-    // Microsoft terminal do not use fonts able to render properly the default
-    // radiobox glyph.
-    auto prefix = text(s.state ? "(*) " : "( ) ");  // NOLINT
-#else
-    auto prefix = text(s.state ? "◉ " : "○ ");  // NOLINT
-#endif
-    auto t = text(s.label);
-    if (s.active) {
-      t |= bold;
-    }
-    if (s.focused) {
-      t |= inverted;
-    }
-    return hbox({prefix, t});
-  };
+  option.transform = RadioboxTransform;
   return option;
 }
 
@@ -312,21 +255,7 @@ RadioboxOption RadioboxOption::Simple() {
 // static
 InputOption InputOption::Default() {
   InputOption option;
-  option.transform = [](InputState state) {
-    state.element |= color(Color::White);
-
-    if (state.is_placeholder) {
-      state.element |= dim;
-    }
-
-    if (state.focused) {
-      state.element |= inverted;
-    } else if (state.hovered) {
-      state.element |= bgcolor(Color::GrayDark);
-    }
-
-    return state.element;
-  };
+  option.transform = InputTransform;
   return option;
 }
 
@@ -356,4 +285,24 @@ InputOption InputOption::Spacious() {
   return option;
 }
 
+/// @brief The keys handled by the input by default.
+/// @ingroup component
+// static
+Keymap<InputAction> InputOption::DefaultKeymap() {
+  return {
+      {Event::Return, InputAction::Enter},
+      {Event::ArrowLeft, InputAction::MoveLeft},
+      {Event::ArrowRight, InputAction::MoveRight},
+      {Event::ArrowUp, InputAction::MoveUp},
+      {Event::ArrowDown, InputAction::MoveDown},
+      {Event::ArrowLeftCtrl, InputAction::MoveWordLeft},
+      {Event::ArrowRightCtrl, InputAction::MoveWordRight},
+      {Event::Home, InputAction::MoveHome},
+      {Event::End, InputAction::MoveEnd},
+      {Event::Backspace, InputAction::DeleteBackward},
+      {Event::Delete, InputAction::DeleteForward},
+      {Event::Insert, InputAction::ToggleInsert},
+  };
+}
+
 }  // namespace ftxui
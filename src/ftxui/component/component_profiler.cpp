@@ -0,0 +1,148 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/component_profiler.hpp"
+
+#include <algorithm>  // for sort, max
+#include <chrono>     // for duration_cast, microseconds, nanoseconds
+#include <string>     // for string, to_string
+#include <vector>     // for vector
+
+namespace ftxui {
+
+namespace {
+thread_local ComponentProfiler* g_current_profiler = nullptr;  // NOLINT
+
+const char* PhaseName(ComponentProfiler::Phase phase) {
+  return phase == ComponentProfiler::Phase::Render ? "render" : "event";
+}
+
+std::string Microseconds(std::chrono::nanoseconds duration) {
+  return std::to_string(
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+void Print(std::string& out,
+           const std::string& title,
+           const std::vector<ComponentProfiler::Entry>& entries) {
+  size_t width = title.size();
+  for (const auto& entry : entries) {
+    width = std::max(width, entry.name.size());
+  }
+  auto column = [](std::string value, size_t size) {
+    if (value.size() < size) {
+      value.insert(0, size - value.size(), ' ');
+    }
+    return value;
+  };
+  out += title + std::string(width - title.size(), ' ');
+  out += column("calls", 10) + column("inclusive us", 14) +
+         column("exclusive us", 14);
+  out += "\n";
+  for (const auto& entry : entries) {
+    out += entry.name + std::string(width - entry.name.size(), ' ');
+    out += column(std::to_string(entry.calls), 10);
+    out += column(Microseconds(entry.inclusive), 14);
+    out += column(Microseconds(entry.exclusive), 14);
+    out += "\n";
+  }
+}
+
+}  // namespace
+
+ComponentProfiler::Scope::Scope(ComponentProfiler* profiler)
+    : previous_(g_current_profiler) {
+  g_current_profiler = profiler;
+}
+
+ComponentProfiler::Scope::~Scope() {
+  g_current_profiler = previous_;
+}
+
+ComponentProfiler::Timer::Timer(Phase phase, const std::string& name)
+    : profiler_(g_current_profiler) {
+  if (profiler_) {
+    profiler_->Open(phase, name);
+  }
+}
+
+ComponentProfiler::Timer::~Timer() {
+  if (profiler_) {
+    profiler_->Close();
+  }
+}
+
+// static
+ComponentProfiler* ComponentProfiler::Current() {
+  return g_current_profiler;
+}
+
+void ComponentProfiler::Open(Phase phase, const std::string& name) {
+  Frame frame{phase, &name, {}, {}};
+  frame.stack = frames_.empty() ? PhaseName(phase) : frames_.back().stack;
+  frame.stack += ';';
+  frame.stack += name;
+  frames_.push_back(std::move(frame));
+  // Started last, so that the bookkeeping above isn't measured.
+  frames_.back().start = Clock::now();
+}
+
+void ComponentProfiler::Close() {
+  const Clock::time_point end = Clock::now();
+  Frame& frame = frames_.back();
+  const auto inclusive =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - frame.start);
+  const auto exclusive = inclusive - frame.children;
+
+  Entry& entry = by_name_[int(frame.phase)][*frame.name];
+  entry.calls++;
+  entry.inclusive += inclusive;
+  entry.exclusive += exclusive;
+  by_stack_[frame.stack] += exclusive;
+
+  frames_.pop_back();
+  if (!frames_.empty()) {
+    frames_.back().children += inclusive;
+  }
+}
+
+std::vector<ComponentProfiler::Entry> ComponentProfiler::ByName(
+    Phase phase) const {
+  std::vector<Entry> entries;
+  for (const auto& [name, entry] : by_name_[int(phase)]) {
+    entries.push_back(entry);
+    entries.back().name = name;
+  }
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+    if (a.exclusive != b.exclusive) {
+      return a.exclusive > b.exclusive;
+    }
+    return a.name < b.name;
+  });
+  return entries;
+}
+
+std::string ComponentProfiler::FoldedStacks() const {
+  std::string out;
+  for (const auto& [stack, exclusive] : by_stack_) {
+    out += stack + " " + Microseconds(exclusive) + "\n";
+  }
+  return out;
+}
+
+void ComponentProfiler::Clear() {
+  by_name_[0].clear();
+  by_name_[1].clear();
+  by_stack_.clear();
+}
+
+/// @brief Return the time by name, in a table for each phase.
+std::string ComponentProfiler::ToString() const {
+  std::string out;
+  Print(out, "render", ByName(Phase::Render));
+  out += "\n";
+  Print(out, "event", ByName(Phase::Event));
+  return out;
+}
+
+}  // namespace ftxui
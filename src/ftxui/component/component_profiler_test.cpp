@@ -0,0 +1,110 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/component_profiler.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>  // for milliseconds
+#include <string>  // for string
+#include <thread>  // for sleep_for
+#include <vector>  // for vector
+
+#include "ftxui/component/component.hpp"  // for ProfileComponent, Renderer, CatchEvent
+#include "ftxui/component/event.hpp"               // for Event
+#include "ftxui/component/loop.hpp"                // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text, hbox
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+ComponentProfiler::Entry Find(const std::vector<ComponentProfiler::Entry>& v,
+                              const std::string& name) {
+  for (const auto& entry : v) {
+    if (entry.name == name) {
+      return entry;
+    }
+  }
+  return {};
+}
+
+}  // namespace
+
+TEST(ComponentProfilerTest, InclusiveExclusive) {
+  auto child = Renderer([] {
+                 std::this_thread::sleep_for(std::chrono::milliseconds(4));
+                 return text("child");
+               }) |
+               ProfileComponent("child");
+  auto root = Renderer(child, [&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                return hbox({child->Render()});
+              }) |
+              ProfileComponent("root");
+
+  ComponentProfiler profiler;
+  {
+    ComponentProfiler::Scope scope(&profiler);
+    EXPECT_EQ(ComponentProfiler::Current(), &profiler);
+    root->Render();
+    root->Render();
+  }
+  EXPECT_EQ(ComponentProfiler::Current(), nullptr);
+  root->Render();  // Not recorded.
+
+  const auto render = profiler.ByName(ComponentProfiler::Phase::Render);
+  ASSERT_EQ(render.size(), 2u);
+  const auto root_entry = Find(render, "root");
+  const auto child_entry = Find(render, "child");
+  EXPECT_EQ(root_entry.calls, 2u);
+  EXPECT_EQ(child_entry.calls, 2u);
+  EXPECT_GE(child_entry.inclusive, std::chrono::milliseconds(8));
+  EXPECT_EQ(child_entry.exclusive, child_entry.inclusive);
+  EXPECT_EQ(root_entry.exclusive,
+            root_entry.inclusive - child_entry.inclusive);
+  EXPECT_GE(root_entry.exclusive, std::chrono::milliseconds(4));
+
+  // Sorted by decreasing exclusive time.
+  EXPECT_GE(render[0].exclusive, render[1].exclusive);
+
+  const std::string folded = profiler.FoldedStacks();
+  EXPECT_NE(folded.find("render;root "), std::string::npos);
+  EXPECT_NE(folded.find("render;root;child "), std::string::npos);
+
+  profiler.Clear();
+  EXPECT_TRUE(profiler.ByName(ComponentProfiler::Phase::Render).empty());
+  EXPECT_EQ(profiler.FoldedStacks(), "");
+}
+
+TEST(ComponentProfilerTest, Screen) {
+  int events = 0;
+  auto component = Renderer([] { return text("text"); }) |
+                   CatchEvent([&](Event) {
+                     events++;
+                     return false;
+                   }) |
+                   ProfileComponent("root");
+
+  ComponentProfiler profiler;
+  auto screen = ScreenInteractive::Headless(10, 1);
+  screen.UseComponentProfiler(&profiler);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.HeadlessInput("a");
+  loop.RunOnce();
+
+  EXPECT_EQ(events, 1);
+  EXPECT_EQ(Find(profiler.ByName(ComponentProfiler::Phase::Render), "root")
+                .calls,
+            2u);
+  EXPECT_EQ(
+      Find(profiler.ByName(ComponentProfiler::Phase::Event), "root").calls,
+      1u);
+  EXPECT_NE(profiler.FoldedStacks().find("event;root "), std::string::npos);
+  EXPECT_NE(profiler.ToString().find("root"), std::string::npos);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -3,9 +3,12 @@
 // the LICENSE file.
 #include <memory>  // for shared_ptr, __shared_ptr_access, allocator, __shared_ptr_access<>::element_type, make_shared
 #include <string>  // for string
+#include <vector>  // for vector
 
-#include "ftxui/component/component.hpp"       // for Make
+#include "ftxui/component/component.hpp"       // for Make, Input, Menu
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"           // for Event, Event::Custom
+#include "ftxui/dom/elements.hpp"              // for text
 #include "gtest/gtest.h"  // for Message, TestPartResult, EXPECT_EQ, Test, AssertionResult, TEST, EXPECT_FALSE
 
 namespace ftxui {
@@ -173,4 +176,60 @@ TEST(ComponentTest, NonFocusableAreNotFocused) {
   EXPECT_EQ(child->ActiveChild(), nullptr);
 }
 
+TEST(ComponentTest, EventSubscription) {
+  class KeyboardOnly : public ComponentBase {
+   public:
+    int EventCategories() const override { return KeyboardEvents; }
+    bool OnEvent(Event) override {
+      ++events;
+      return false;
+    }
+    int events = 0;
+  };
+  auto child = Make<KeyboardOnly>();
+  auto root = Renderer(child, [] { return text(""); });
+
+  EXPECT_TRUE(root->Subscribes(Event::Character('a')));
+  EXPECT_FALSE(root->Subscribes(Event::Custom));
+
+  root->OnEvent(Event::Custom);
+  EXPECT_EQ(child->events, 0);
+  root->OnEvent(Event::Character('a'));
+  EXPECT_EQ(child->events, 1);
+
+  // The events are offered to the ancestors of a subscribed descendant.
+  auto other = Make<ComponentBase>();
+  child->Add(other);
+  EXPECT_TRUE(root->Subscribes(Event::Custom));
+  root->OnEvent(Event::Custom);
+  EXPECT_EQ(child->events, 2);
+
+  other->Detach();
+  EXPECT_FALSE(root->Subscribes(Event::Custom));
+}
+
+TEST(ComponentTest, MemoryUsage) {
+  std::string content;
+  std::vector<std::string> entries = {"a", "b", "c"};
+  int selected = 0;
+  auto input = Input(&content);
+  auto menu = Menu(&entries, &selected);
+  auto container = Container::Vertical({input, menu});
+
+  EXPECT_GE(container->MemoryUsage(), sizeof(ComponentBase));
+  const size_t total = MemoryUsage(container);
+  EXPECT_EQ(total, container->MemoryUsage() + input->MemoryUsage() +
+                       menu->MemoryUsage());
+
+  // The text edited by the input is counted.
+  const size_t input_bytes = input->MemoryUsage();
+  content = std::string(1000, 'a');
+  EXPECT_GE(input->MemoryUsage(), input_bytes + 1000);
+
+  // The menu retains the animations of its entries once rendered.
+  const size_t menu_bytes = menu->MemoryUsage();
+  menu->Render();
+  EXPECT_GT(menu->MemoryUsage(), menu_bytes);
+}
+
 }  // namespace ftxui
@@ -7,9 +7,11 @@
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Tab
+#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Tab, ComponentFactory, Make
 #include "ftxui/component/component_base.hpp"  // for Components, Component, ComponentBase
+#include "ftxui/component/component_options.hpp"  // for LazyOption
 #include "ftxui/component/event.hpp"  // for Event, Event::Tab, Event::TabReverse, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
+#include "ftxui/component/lazy.hpp"  // for LazyBase
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
 #include "ftxui/dom/elements.hpp"  // for text, Elements, operator|, reflect, Element, hbox, vbox
 #include "ftxui/screen/box.hpp"  // for Box
@@ -35,13 +37,18 @@ class ContainerBase : public ComponentBase {
       return false;
     }
 
-    if (ActiveChild() && ActiveChild()->OnEvent(event)) {
+    const Component active_child = ActiveChild();
+    if (active_child && active_child->Subscribes(event) &&
+        active_child->OnEvent(event)) {
       return true;
     }
 
     return EventHandler(event);
   }
 
+  // The keyboard navigation, handled by EventHandler.
+  int EventCategories() const override { return KeyboardEvents; }
+
   Component ActiveChild() override {
     if (children_.empty()) {
       return nullptr;
@@ -64,18 +71,58 @@ class ContainerBase : public ComponentBase {
   virtual bool EventHandler(Event /*unused*/) { return false; }  // NOLINT
 
   virtual bool OnMouseEvent(Event event) {
-    return ComponentBase::OnEvent(std::move(event));
+    if (!MouseIndexValid()) {
+      mouse_ = {};
+      return ComponentBase::OnEvent(std::move(event));
+    }
+
+    // Only offer the event to the children under the pointer, or which were
+    // under the previous one, so that they notice it left. The child handling
+    // the previous event, for instance while dragging, also receives it.
+    const MousePosition previous = mouse_;
+    mouse_ = {true, event.mouse().x, event.mouse().y};
+    ComponentBase* handler = nullptr;
+    for (size_t i = 0; i < children_.size(); ++i) {
+      ComponentBase* child = children_[i].get();
+      const Box& box = child_boxes_[i].box;
+      const bool under_pointer =
+          box.Contain(mouse_.x, mouse_.y) ||
+          (previous.valid && box.Contain(previous.x, previous.y));
+      if (!under_pointer && child != mouse_handler_) {
+        continue;
+      }
+      if (child->Subscribes(event) && child->OnEvent(event)) {
+        handler = child;
+        break;
+      }
+    }
+    mouse_handler_ = handler;
+    return handler != nullptr;
+  }
+
+  // Render the children, recording the box they are drawn in.
+  Elements RenderChildren() {
+    child_boxes_.resize(children_.size());
+    Elements elements;
+    elements.reserve(children_.size());
+    for (size_t i = 0; i < children_.size(); ++i) {
+      child_boxes_[i].child = children_[i].get();
+      elements.push_back(children_[i]->Render() | reflect(child_boxes_[i].box));
+    }
+    return elements;
   }
 
   int selected_ = 0;
   int* selector_ = nullptr;
 
-  void MoveSelector(int dir) {
-    for (int i = *selector_ + dir; i >= 0 && i < int(children_.size());
-         i += dir) {
+  // Move the selector by |count| focusable children in the direction |dir|,
+  // or as far as possible. Every child is checked at most once.
+  void MoveSelector(int dir, int count = 1) {
+    for (int i = *selector_ + dir;
+         count > 0 && i >= 0 && i < int(children_.size()); i += dir) {
       if (children_[i]->Focusable()) {
         *selector_ = i;
-        return;
+        --count;
       }
     }
   }
@@ -93,6 +140,34 @@ class ContainerBase : public ComponentBase {
       }
     }
   }
+
+ private:
+  // Whether the boxes recorded by RenderChildren() match the current children.
+  bool MouseIndexValid() const {
+    if (child_boxes_.size() != children_.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < children_.size(); ++i) {
+      if (child_boxes_[i].child != children_[i].get()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  struct ChildBox {
+    ComponentBase* child = nullptr;
+    Box box;
+  };
+  std::vector<ChildBox> child_boxes_;
+
+  struct MousePosition {
+    bool valid = false;
+    int x = 0;
+    int y = 0;
+  };
+  MousePosition mouse_;
+  ComponentBase* mouse_handler_ = nullptr;
 };
 
 class VerticalContainer : public ContainerBase {
@@ -100,17 +175,18 @@ class VerticalContainer : public ContainerBase {
   using ContainerBase::ContainerBase;
 
   Element Render() override {
-    Elements elements;
-    elements.reserve(children_.size());
-    for (auto& it : children_) {
-      elements.push_back(it->Render());
-    }
+    Elements elements = RenderChildren();
     if (elements.empty()) {
       return text("Empty container") | reflect(box_);
     }
     return vbox(std::move(elements)) | reflect(box_);
   }
 
+  // The keyboard navigation and the mouse wheel.
+  int EventCategories() const override {
+    return KeyboardEvents | MouseButtonEvents;
+  }
+
   bool EventHandler(Event event) override {
     const int old_selected = *selector_;
     if (event == Event::ArrowUp || event == Event::Character('k')) {
@@ -120,24 +196,16 @@ class VerticalContainer : public ContainerBase {
       MoveSelector(+1);
     }
     if (event == Event::PageUp) {
-      for (int i = 0; i < box_.y_max - box_.y_min; ++i) {
-        MoveSelector(-1);
-      }
+      MoveSelector(-1, box_.y_max - box_.y_min);
     }
     if (event == Event::PageDown) {
-      for (int i = 0; i < box_.y_max - box_.y_min; ++i) {
-        MoveSelector(1);
-      }
+      MoveSelector(+1, box_.y_max - box_.y_min);
     }
     if (event == Event::Home) {
-      for (size_t i = 0; i < children_.size(); ++i) {
-        MoveSelector(-1);
-      }
+      MoveSelector(-1, int(children_.size()));
     }
     if (event == Event::End) {
-      for (size_t i = 0; i < children_.size(); ++i) {
-        MoveSelector(1);
-      }
+      MoveSelector(+1, int(children_.size()));
     }
     if (event == Event::Tab) {
       MoveSelectorWrap(+1);
@@ -183,11 +251,7 @@ class HorizontalContainer : public ContainerBase {
   using ContainerBase::ContainerBase;
 
   Element Render() override {
-    Elements elements;
-    elements.reserve(children_.size());
-    for (auto& it : children_) {
-      elements.push_back(it->Render());
-    }
+    Elements elements = RenderChildren();
     if (elements.empty()) {
       return text("Empty container");
     }
@@ -233,8 +297,35 @@ class TabContainer : public ContainerBase {
     return children_[size_t(*selector_) % children_.size()]->Focusable();
   }
 
+  int EventCategories() const override { return 0; }
+
   bool OnMouseEvent(Event event) override {
-    return ActiveChild() && ActiveChild()->OnEvent(event);
+    const Component active_child = ActiveChild();
+    return active_child && active_child->Subscribes(event) &&
+           active_child->OnEvent(event);
+  }
+};
+
+// A TabContainer whose children are built the first time they are selected.
+class LazyTabContainer : public TabContainer {
+ public:
+  LazyTabContainer(std::vector<ComponentFactory> factories,
+                   int* selector,
+                   const LazyOption& option)
+      : TabContainer({}, selector) {
+    for (ComponentFactory& factory : factories) {
+      Add(Make<LazyBase>(std::move(factory), option));
+    }
+  }
+
+  Element Render() override {
+    const Component active_child = ActiveChild();
+    for (const Component& child : children_) {
+      if (child != active_child) {
+        static_cast<LazyBase*>(child.get())->Hide();  // NOLINT
+      }
+    }
+    return TabContainer::Render();
   }
 };
 
@@ -286,9 +377,11 @@ class StackedContainer : public ContainerBase {
     std::rotate(children_.begin(), it, it + 1);
   }
 
+  int EventCategories() const final { return 0; }
+
   bool OnEvent(Event event) final {
     for (auto& child : children_) {
-      if (child->OnEvent(event)) {
+      if (child->Subscribes(event) && child->OnEvent(event)) {
         return true;
       }
     }
@@ -406,6 +499,32 @@ Component Tab(Components children, int* selector) {
   return std::make_shared<TabContainer>(std::move(children), selector);
 }
 
+/// @brief A list of components, where only one is drawn and interacted with at
+/// a time, like the other Tab. Every component is built by its factory the
+/// first time it is selected, so the tabs never visited are never built.
+/// @param children The factories building the components.
+/// @param selector The index of the drawn children.
+/// @param option With |release_after|, a component is destroyed once
+/// unselected for this long, and built again when selected.
+/// @ingroup component
+/// @see ContainerBase
+///
+/// ### Example
+///
+/// ```cpp
+/// int tab_drawn = 0;
+/// auto container = Container::Tab({
+///   [] { return GeneralSettings(); },
+///   [] { return NetworkSettings(); },
+/// }, &tab_drawn, {.release_after = std::chrono::seconds(30)});
+/// ```
+Component Tab(std::vector<ComponentFactory> children,
+              int* selector,
+              LazyOption option) {
+  return std::make_shared<LazyTabContainer>(std::move(children), selector,
+                                            option);
+}
+
 /// @brief A list of components to be stacked on top of each other.
 /// Events are propagated to the first component, then the second if not
 /// handled, etc.
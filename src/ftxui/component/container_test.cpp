@@ -1,12 +1,18 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <chrono>  // for milliseconds
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator
-#include <string>  // for string
+#include <string>  // for string, to_string
+#include <vector>  // for vector
 
-#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Button, Tab
+#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Button, Tab, Renderer
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
 #include "ftxui/component/event.hpp"  // for Event, Event::Tab, Event::TabReverse, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Moved
+#include "ftxui/dom/elements.hpp"     // for text, frame
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
 #include "gtest/gtest.h"  // for AssertionResult, Message, TestPartResult, EXPECT_EQ, EXPECT_FALSE, Test, EXPECT_TRUE, TEST
 
 namespace ftxui {
@@ -18,6 +24,28 @@ Component Focusable() {
 Component NonFocusable() {
   return Container::Horizontal({});
 }
+
+// Count the mouse events it receives.
+class MouseCounter : public ComponentBase {
+ public:
+  Element Render() override { return text("x"); }
+  bool OnEvent(Event event) override {
+    if (event.is_mouse()) {
+      ++events;
+    }
+    return false;
+  }
+  int events = 0;
+};
+
+Event MouseMovedAt(int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::None;
+  mouse.motion = Mouse::Moved;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
 }  // namespace
 
 TEST(ContainerTest, HorizontalEvent) {
@@ -172,6 +200,38 @@ TEST(ContainerTest, VerticalEvent) {
   container->OnEvent(Event::TabReverse);
 }
 
+TEST(ContainerTest, VerticalPageAndHomeEnd) {
+  auto container = Container::Vertical({});
+  Components focusables;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3 == 0) {
+      focusables.push_back(Focusable());
+      container->Add(focusables.back());
+    } else {
+      container->Add(NonFocusable());
+    }
+  }
+
+  // The page is 5 rows high: PageDown skips 4 focusable children.
+  Screen screen(1, 5);
+  Render(screen, container->Render() | frame);
+
+  container->OnEvent(Event::PageDown);
+  EXPECT_EQ(container->ActiveChild(), focusables[4]);
+  container->OnEvent(Event::PageDown);
+  EXPECT_EQ(container->ActiveChild(), focusables[8]);
+  container->OnEvent(Event::PageUp);
+  EXPECT_EQ(container->ActiveChild(), focusables[4]);
+  container->OnEvent(Event::End);
+  EXPECT_EQ(container->ActiveChild(), focusables.back());
+  container->OnEvent(Event::PageDown);
+  EXPECT_EQ(container->ActiveChild(), focusables.back());
+  container->OnEvent(Event::Home);
+  EXPECT_EQ(container->ActiveChild(), focusables.front());
+  container->OnEvent(Event::PageUp);
+  EXPECT_EQ(container->ActiveChild(), focusables.front());
+}
+
 TEST(ContainerTest, SetActiveChild) {
   auto container = Container::Horizontal({});
   auto c0 = Focusable();
@@ -336,4 +396,83 @@ TEST(ContainerTest, TabFocusable) {
   EXPECT_FALSE(c->Focused());
 }
 
+TEST(ContainerTest, MouseEventUnderPointer) {
+  std::vector<std::shared_ptr<MouseCounter>> counters;
+  auto container = Container::Vertical({});
+  for (int i = 0; i < 100; ++i) {
+    counters.push_back(std::make_shared<MouseCounter>());
+    container->Add(counters.back());
+  }
+
+  // Before being rendered, every child receives the event.
+  container->OnEvent(MouseMovedAt(0, 3));
+  for (auto& counter : counters) {
+    EXPECT_EQ(counter->events, 1);
+    counter->events = 0;
+  }
+
+  Screen screen(1, 100);
+  Render(screen, container->Render());
+
+  container->OnEvent(MouseMovedAt(0, 3));
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(counters[i]->events, i == 3 ? 1 : 0);
+  }
+
+  // The child previously under the pointer is notified the pointer left.
+  container->OnEvent(MouseMovedAt(0, 42));
+  EXPECT_EQ(counters[3]->events, 2);
+  EXPECT_EQ(counters[42]->events, 1);
+  EXPECT_EQ(counters[50]->events, 0);
+}
+
+TEST(ContainerTest, TabLazy) {
+  int selected = 0;
+  std::vector<int> built(3);
+  auto factory = [&](int i) -> ComponentFactory {
+    return [&built, i] {
+      built[i]++;
+      return Renderer([i] { return text(std::to_string(i)); });
+    };
+  };
+  auto tab = Container::Tab({factory(0), factory(1), factory(2)}, &selected,
+                            {.release_after = std::chrono::milliseconds(0)});
+  EXPECT_EQ(built, std::vector<int>({0, 0, 0}));
+
+  Screen screen(1, 1);
+  Render(screen, tab->Render());
+  EXPECT_EQ(screen.ToString(), "0");
+  EXPECT_EQ(built, std::vector<int>({1, 0, 0}));
+
+  // Only the selected tab is built, and the hidden ones are released.
+  selected = 2;
+  Render(screen, tab->Render());
+  EXPECT_EQ(screen.ToString(), "2");
+  EXPECT_EQ(built, std::vector<int>({1, 0, 1}));
+  EXPECT_EQ(tab->ChildAt(0)->ChildCount(), size_t(0));
+
+  selected = 0;
+  Render(screen, tab->Render());
+  EXPECT_EQ(built, std::vector<int>({2, 0, 1}));
+}
+
+TEST(ContainerTest, TabLazyKept) {
+  int selected = 0;
+  int built = 0;
+  auto factory = [&]() -> Component {
+    built++;
+    return Focusable();
+  };
+  auto tab = Container::Tab({factory, factory}, &selected);
+  EXPECT_TRUE(tab->Focusable());
+  EXPECT_EQ(built, 1);
+
+  // Without |release_after|, the tabs visited are kept.
+  selected = 1;
+  tab->Render();
+  selected = 0;
+  tab->Render();
+  EXPECT_EQ(built, 2);
+}
+
 }  // namespace ftxui
@@ -0,0 +1,65 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/coroutine.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>  // for milliseconds, seconds
+#include <string>  // for string
+#include <thread>  // for get_id
+#include <vector>  // for vector
+
+#include "ftxui/component/component.hpp"           // for Renderer
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+
+// NOLINTBEGIN
+namespace ftxui {
+
+#if !defined(FTXUI_NO_THREADS)
+TEST(CoroutineTest, Await) {
+  auto screen = ScreenInteractive::Headless(4, 1);
+  const auto loop_thread = std::this_thread::get_id();
+  int frames = 0;
+  std::string label = "....";
+  std::vector<std::string> steps;
+
+  auto run = [&]() -> Coroutine {
+    co_await Sleep(screen, std::chrono::seconds(1));
+    steps.push_back("slept");
+
+    const int before = frames;
+    label = "next";
+    co_await NextFrame(screen);
+    EXPECT_EQ(frames, before + 1);
+    steps.push_back("frame");
+
+    label = co_await Async(screen, [&] {
+      EXPECT_NE(std::this_thread::get_id(), loop_thread);
+      return std::string("done");
+    });
+    EXPECT_EQ(std::this_thread::get_id(), loop_thread);
+    steps.push_back("async");
+
+    co_await Async(screen, [] {});
+    screen.Exit();
+  };
+
+  bool started = false;
+  auto component = Renderer([&] {
+    frames++;
+    if (!started) {
+      started = true;
+      run();
+    }
+    return text(label);
+  });
+  screen.Loop(component);
+
+  EXPECT_EQ(steps, (std::vector<std::string>{"slept", "frame", "async"}));
+  EXPECT_EQ(label, "done");
+}
+#endif
+
+}  // namespace ftxui
+// NOLINTEND
@@ -6,10 +6,10 @@
 #include <memory>      // for __shared_ptr_access, allocator, shared_ptr
 #include <string>      // for string
 
-#include "ftxui/component/component.hpp"  // for Maybe, Checkbox, Make, Radiobox, Vertical, Dropdown
+#include "ftxui/component/component.hpp"  // for Checkbox, Make, Radiobox, Vertical, Dropdown
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
 #include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState
-#include "ftxui/dom/elements.hpp"  // for operator|, Element, border, filler, operator|=, separator, size, text, vbox, frame, vscroll_indicator, hbox, HEIGHT, LESS_THAN, bold, inverted
+#include "ftxui/dom/elements.hpp"  // for operator|, Element, border, filler, operator|=, separator, size, text, vbox, frame, vscroll_indicator, hbox, HEIGHT, LESS_THAN, bold, inverted, emptyElement
 #include "ftxui/screen/util.hpp"   // for clamp
 #include "ftxui/util/ref.hpp"      // for ConstStringListRef
 
@@ -35,41 +35,54 @@ Component Dropdown(DropdownOption option) {
     Impl(DropdownOption option) : DropdownOption(std::move(option)) {
       FillDefault();
       checkbox_ = Checkbox(checkbox);
-      radiobox_ = Radiobox(radiobox);
-
-      Add(Container::Vertical({
-          checkbox_,
-          Maybe(radiobox_, checkbox.checked),
-      }));
+      container_ = Container::Vertical({checkbox_});
+      Add(container_);
     }
 
     Element Render() override {
-      radiobox.selected =
-          util::clamp(radiobox.selected(), 0, int(radiobox.entries.size()) - 1);
-      checkbox.label =
-          radiobox.entries[static_cast<size_t>(radiobox.selected())];
+      selected_() =
+          util::clamp(selected_(), 0, int(radiobox.entries.size()) - 1);
+      checkbox.label = radiobox.entries[static_cast<size_t>(selected_())];
 
-      return transform(*open_, checkbox_->Render(), radiobox_->Render());
+      UpdateRadiobox();
+      return transform(*open_, checkbox_->Render(),
+                       radiobox_ ? radiobox_->Render() : emptyElement());
     }
 
+    int EventCategories() const override { return 0; }
+
     // Switch focus in between the checkbox and the radiobox when selecting it.
     bool OnEvent(ftxui::Event event) override {
       const bool show_old = open_();
       const int selected_old = selected_();
       const bool handled = ComponentBase::OnEvent(event);
 
+      UpdateRadiobox();
       if (!show_old && open_()) {
         radiobox_->TakeFocus();
       }
 
       if (selected_old != selected_()) {
         checkbox_->TakeFocus();
-        open_ = false;
+        open_() = false;
+        UpdateRadiobox();
       }
 
       return handled;
     }
 
+    // The list of entries only exists while the dropdown is open.
+    void UpdateRadiobox() {
+      if (open_() && !radiobox_) {
+        radiobox_ = Radiobox(radiobox);
+        container_->Add(radiobox_);
+      }
+      if (!open_() && radiobox_) {
+        radiobox_->Detach();
+        radiobox_ = nullptr;
+      }
+    }
+
     void FillDefault() {
       open_ = std::move(checkbox.checked);
       selected_ = std::move(radiobox.selected);
@@ -113,6 +126,7 @@ Component Dropdown(DropdownOption option) {
     Ref<int> selected_;
     Component checkbox_;
     Component radiobox_;
+    Component container_;
   };
 
   return Make<Impl>(option);
@@ -0,0 +1,65 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <cstddef>      // for size_t
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/component/component.hpp"          // for Dropdown
+#include "ftxui/component/component_options.hpp"  // for DropdownOption
+#include "ftxui/component/event.hpp"              // for Event
+#include "ftxui/dom/node.hpp"                     // for Render
+#include "ftxui/screen/screen.hpp"                // for Screen
+#include "ftxui/util/ref.hpp"                     // for ConstStringListRef
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(DropdownTest, EntriesOnlyReadWhileOpen) {
+  std::vector<std::string> names;
+  for (int i = 0; i < 10000; ++i) {
+    names.push_back("entry " + std::to_string(i));
+  }
+  int reads = 0;
+  ConstStringListRef entries([&] { return names.size(); },
+                             [&](size_t i) -> std::string_view {
+                               reads++;
+                               return names[i];
+                             });
+  int selected = 0;
+  bool open = false;
+  DropdownOption option;
+  option.checkbox.checked = &open;
+  option.radiobox.entries = entries;
+  option.radiobox.selected = &selected;
+  option.radiobox.virtualized = true;
+  auto dropdown = Dropdown(option);
+
+  // Closed, only the label is read.
+  Screen screen(20, 14);
+  Render(screen, dropdown->Render());
+  EXPECT_EQ(reads, 1);
+  EXPECT_EQ(dropdown->ChildAt(0)->ChildCount(), 1u);
+
+  // Open, only the visible entries are read.
+  EXPECT_TRUE(dropdown->OnEvent(Event::Return));
+  EXPECT_TRUE(open);
+  EXPECT_EQ(dropdown->ChildAt(0)->ChildCount(), 2u);
+  reads = 0;
+  Render(screen, dropdown->Render());
+  EXPECT_GT(reads, 1);
+  EXPECT_LT(reads, 20);
+  EXPECT_NE(screen.ToString().find("entry 9"), std::string::npos);
+
+  // Selecting an entry closes the dropdown, and releases the list.
+  EXPECT_TRUE(dropdown->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(dropdown->OnEvent(Event::Return));
+  EXPECT_EQ(selected, 1);
+  EXPECT_FALSE(open);
+  EXPECT_EQ(dropdown->ChildAt(0)->ChildCount(), 1u);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,235 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/entry.hpp"
+
+#include <algorithm>    // for min
+#include <array>        // for array
+#include <cstdint>      // for uint16_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/component/component_options.hpp"  // for EntryState, InputState
+#include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, style
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Pixel, PixelStyle, Screen
+#include "ftxui/screen/string.hpp"    // for string_width, Utf8Glyphs
+
+namespace ftxui {
+
+namespace {
+
+using Charset = std::array<std::string_view, 6>;  // NOLINT
+
+// The same characters as the `borderStyled` ones.
+// NOLINTNEXTLINE
+constexpr std::array<Charset, 6> charsets = {
+    Charset{"┌", "┐", "└", "┘", "─", "│"},  // LIGHT
+    Charset{"┏", "┓", "┗", "┛", "╍", "╏"},  // DASHED
+    Charset{"┏", "┓", "┗", "┛", "━", "┃"},  // HEAVY
+    Charset{"╔", "╗", "╚", "╝", "═", "║"},  // DOUBLE
+    Charset{"╭", "╮", "╰", "╯", "─", "│"},  // ROUNDED
+    Charset{" ", " ", " ", " ", " ", " "},  // EMPTY
+};
+
+bool IsEmpty(const PixelStyle& style) {
+  return style.fields == 0 && !style.invert;
+}
+
+// The style of the standard entries.
+PixelStyle EntryStyle(bool bold, bool inverted, bool dim) {
+  PixelStyle style;
+  style.fields = uint16_t((bold ? PixelStyle::kBold : 0) |
+                          (dim ? PixelStyle::kDim : 0));
+  style.invert = inverted;
+  return style;
+}
+
+class Entry : public Node {
+ public:
+  Entry(std::string_view prefix,
+        std::string_view label,
+        const PixelStyle& style,
+        bool style_prefix,
+        const Charset* border)
+      : text_(std::string(prefix) + std::string(label)),
+        prefix_width_(string_width(prefix)),
+        label_width_(string_width(label)),
+        style_(style),
+        style_prefix_(style_prefix),
+        border_(border) {}
+
+  void ComputeRequirement() override {
+    const int border = border_ ? 2 : 0;
+    requirement_.min_x = prefix_width_ + label_width_ + border;
+    requirement_.min_y = 1 + border;
+    if (border_) {
+      requirement_.selected_box = {1, 1, 1, 1};
+    }
+  }
+
+  void Render(Screen& screen) override {
+    Box inner = box_;
+    if (border_) {
+      inner.x_min++;
+      inner.x_max--;
+      inner.y_min++;
+      inner.y_max--;
+    }
+    RenderText(screen, inner);
+    if (border_) {
+      RenderBorder(screen);
+    }
+    if (IsEmpty(style_)) {
+      return;
+    }
+    if (style_prefix_) {
+      screen.ApplyStyle(box_, style_);
+      return;
+    }
+    Box label = inner;
+    label.x_min = inner.x_min + prefix_width_;
+    label.x_max = std::min(inner.x_max, label.x_min + label_width_ - 1);
+    screen.ApplyStyle(label, style_);
+  }
+
+ private:
+  void RenderText(Screen& screen, const Box& box) const {
+    if (box.y_min > box.y_max) {
+      return;
+    }
+    int x = box.x_min;
+    for (const std::string_view cell : Utf8Glyphs(text_)) {
+      if (x > box.x_max) {
+        return;
+      }
+      if (cell == "\n") {
+        continue;
+      }
+      screen.PixelAt(x++, box.y_min).character = cell;
+    }
+  }
+
+  void RenderBorder(Screen& screen) const {
+    if (box_.x_min >= box_.x_max || box_.y_min >= box_.y_max) {
+      return;
+    }
+    const Charset& charset = *border_;
+    screen.at(box_.x_min, box_.y_min) = charset[0];
+    screen.at(box_.x_max, box_.y_min) = charset[1];
+    screen.at(box_.x_min, box_.y_max) = charset[2];
+    screen.at(box_.x_max, box_.y_max) = charset[3];
+    for (int x = box_.x_min + 1; x < box_.x_max; ++x) {
+      for (const int y : {box_.y_min, box_.y_max}) {
+        Pixel& pixel = screen.PixelAt(x, y);
+        pixel.character = charset[4];
+        pixel.automerge = true;
+      }
+    }
+    for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
+      for (const int x : {box_.x_min, box_.x_max}) {
+        Pixel& pixel = screen.PixelAt(x, y);
+        pixel.character = charset[5];
+        pixel.automerge = true;
+      }
+    }
+  }
+
+  const std::string text_;
+  const int prefix_width_;
+  const int label_width_;
+  const PixelStyle style_;
+  const bool style_prefix_;
+  const Charset* const border_;
+};
+
+}  // namespace
+
+Element EntryText(std::string_view prefix,
+                  std::string_view label,
+                  const PixelStyle& style,
+                  bool style_prefix) {
+  return MakeNode<Entry>(prefix, label, style, style_prefix, nullptr);
+}
+
+Element EntryBorder(std::string_view label,
+                    BorderStyle border,
+                    const PixelStyle& style) {
+  return MakeNode<Entry>("", label, style, true,
+                         &charsets[border]);  // NOLINT
+}
+
+Element CheckboxTransform(const EntryState& state) {
+#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
+  // Microsoft terminal do not use fonts able to render properly the default
+  // checkbox glyph.
+  const std::string_view prefix = state.state ? "[X] " : "[ ] ";
+#else
+  const std::string_view prefix = state.state ? "▣ " : "☐ ";
+#endif
+  return EntryText(prefix, state.label,
+                   EntryStyle(state.active, state.focused, false), false);
+}
+
+Element RadioboxTransform(const EntryState& state) {
+#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
+  // Microsoft terminal do not use fonts able to render properly the default
+  // radiobox glyph.
+  const std::string_view prefix = state.state ? "(*) " : "( ) ";
+#else
+  const std::string_view prefix = state.state ? "◉ " : "○ ";
+#endif
+  return EntryText(prefix, state.label,
+                   EntryStyle(state.active, state.focused, false), false);
+}
+
+Element MenuEntryTransform(const EntryState& state) {
+  return EntryText(state.active ? "> " : "  ", state.label,
+                   EntryStyle(state.active, state.focused, false), true);
+}
+
+Element MenuVerticalTransform(const EntryState& state) {
+  const bool dim = !state.focused && !state.active;
+  return EntryText(state.active ? "> " : "  ", state.label,
+                   EntryStyle(state.active, state.focused, dim), true);
+}
+
+Element MenuHorizontalTransform(const EntryState& state) {
+  const bool dim = !state.focused && !state.active;
+  return EntryText("", state.label,
+                   EntryStyle(state.active, state.focused, dim), true);
+}
+
+Element ButtonTransform(const EntryState& state) {
+  return EntryBorder(state.label, ROUNDED,
+                     EntryStyle(state.active, state.focused, false));
+}
+
+Element ButtonSimpleTransform(const EntryState& state) {
+  return EntryBorder(state.label, LIGHT,
+                     EntryStyle(false, state.focused, false));
+}
+
+Element InputTransform(InputState state) {
+  // The decorators below, merged into a single style.
+  PixelStyle input_style;
+  input_style.fields = PixelStyle::kForeground;
+  input_style.foreground_color = Color::White;
+  if (state.is_placeholder) {
+    input_style.fields |= PixelStyle::kDim;
+  }
+  if (state.focused) {
+    input_style.invert = true;
+  } else if (state.hovered) {
+    input_style.fields |= PixelStyle::kBackground;
+    input_style.background_color = Color::GrayDark;
+  }
+  return std::move(state.element) | style(input_style);
+}
+
+}  // namespace ftxui
@@ -0,0 +1,63 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_ENTRY_HPP
+#define FTXUI_COMPONENT_ENTRY_HPP
+
+#include <functional>   // for function
+#include <string_view>  // for string_view
+#include <utility>      // for forward
+
+#include "ftxui/component/component_options.hpp"  // for EntryState, InputState
+#include "ftxui/dom/elements.hpp"  // for Element, BorderStyle
+#include "ftxui/screen/screen.hpp"  // for PixelStyle
+
+namespace ftxui {
+
+// |prefix| followed by |label|, on a single line. The |style| is applied to the
+// label, or to the whole entry with |style_prefix|. This draws the same as:
+//   hbox({text(prefix), text(label) | style(style)})
+// but with a single node.
+Element EntryText(std::string_view prefix,
+                  std::string_view label,
+                  const PixelStyle& style,
+                  bool style_prefix);
+
+// |label| inside a |border|, with the |style| applied to both. This draws the
+// same as:
+//   text(label) | borderStyled(border) | style(style)
+// but with a single node.
+Element EntryBorder(std::string_view label,
+                    BorderStyle border,
+                    const PixelStyle& style);
+
+// The transforms of the standard options. They draw the entries with a single
+// node.
+Element CheckboxTransform(const EntryState& state);
+Element RadioboxTransform(const EntryState& state);
+Element MenuEntryTransform(const EntryState& state);
+Element MenuVerticalTransform(const EntryState& state);
+Element MenuHorizontalTransform(const EntryState& state);
+Element ButtonTransform(const EntryState& state);
+Element ButtonSimpleTransform(const EntryState& state);
+Element InputTransform(InputState state);
+
+// Call |transform| with |state|, or |standard| when it is empty. The standard
+// transforms, held as function pointers, are called directly instead of
+// through the std::function.
+template <class Arg, class State>
+Element Transform(const std::function<Element(Arg)>& transform,
+                  Element (*standard)(Arg),
+                  State&& state) {
+  if (!transform) {
+    return standard(std::forward<State>(state));
+  }
+  if (auto* function = transform.template target<Element (*)(Arg)>()) {
+    return (*function)(std::forward<State>(state));
+  }
+  return transform(std::forward<State>(state));
+}
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_ENTRY_HPP */
@@ -0,0 +1,145 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/entry.hpp"
+
+#include <gtest/gtest.h>
+#include <functional>  // for function
+#include <string>      // for string
+#include <vector>      // for vector
+
+#include "ftxui/component/component.hpp"  // for Checkbox, Button, Menu
+#include "ftxui/component/component_options.hpp"  // for EntryState, CheckboxOption, ButtonOption, MenuOption, RadioboxOption
+#include "ftxui/dom/elements.hpp"  // for text, hbox, bold, inverted, dim, border, borderLight
+#include "ftxui/dom/node.hpp"       // for Render, NodesConstructed
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+using TransformFunction = std::function<Element(const EntryState&)>;
+
+std::vector<EntryState> States() {
+  std::vector<EntryState> states;
+  for (int i = 0; i < 8; ++i) {
+    states.push_back({
+        .label = "label",
+        .state = bool(i & 1),
+        .active = bool(i & 2),
+        .focused = bool(i & 4),
+    });
+  }
+  return states;
+}
+
+std::string RenderToString(Element element) {
+  Screen screen(12, 4);
+  Render(screen, std::move(element));
+  return screen.ToString();
+}
+
+// Draws the same as |reference|, using a single node.
+void ExpectSameAs(const TransformFunction& transform,
+                  const TransformFunction& reference) {
+  for (const EntryState& state : States()) {
+    const size_t before = NodesConstructed();
+    Element element = transform(state);
+    EXPECT_EQ(NodesConstructed() - before, size_t(1));
+    EXPECT_EQ(RenderToString(element), RenderToString(reference(state)));
+  }
+}
+
+Element Styled(Element e, const EntryState& s, bool dim_inactive) {
+  if (s.focused) {
+    e |= inverted;
+  }
+  if (s.active) {
+    e |= bold;
+  }
+  if (dim_inactive && !s.focused && !s.active) {
+    e |= dim;
+  }
+  return e;
+}
+
+}  // namespace
+
+TEST(EntryTest, Checkbox) {
+  ExpectSameAs(CheckboxOption::Simple().transform, [](const EntryState& s) {
+    auto t = text(s.label);
+    if (s.active) {
+      t |= bold;
+    }
+    if (s.focused) {
+      t |= inverted;
+    }
+    return hbox({text(s.state ? "▣ " : "☐ "), t});
+  });
+}
+
+TEST(EntryTest, Radiobox) {
+  ExpectSameAs(RadioboxOption::Simple().transform, [](const EntryState& s) {
+    auto t = text(s.label);
+    if (s.active) {
+      t |= bold;
+    }
+    if (s.focused) {
+      t |= inverted;
+    }
+    return hbox({text(s.state ? "◉ " : "○ "), t});
+  });
+}
+
+TEST(EntryTest, Menu) {
+  ExpectSameAs(MenuEntryTransform, [](const EntryState& s) {
+    return Styled(text((s.active ? "> " : "  ") + s.label), s, false);
+  });
+  ExpectSameAs(MenuOption::Vertical().entries_option.transform,
+               [](const EntryState& s) {
+                 return Styled(text((s.active ? "> " : "  ") + s.label), s,
+                               true);
+               });
+  ExpectSameAs(MenuOption::Horizontal().entries_option.transform,
+               [](const EntryState& s) {
+                 return Styled(text(s.label), s, true);
+               });
+}
+
+TEST(EntryTest, Button) {
+  ExpectSameAs(ButtonOption::Border().transform, [](const EntryState& s) {
+    auto element = text(s.label) | border;
+    if (s.active) {
+      element |= bold;
+    }
+    if (s.focused) {
+      element |= inverted;
+    }
+    return element;
+  });
+  ExpectSameAs(ButtonOption::Simple().transform, [](const EntryState& s) {
+    auto element = text(s.label) | borderLight;
+    if (s.focused) {
+      element |= inverted;
+    }
+    return element;
+  });
+}
+
+TEST(EntryTest, CustomTransform) {
+  int called = 0;
+  TransformFunction custom = [&](const EntryState& s) {
+    called++;
+    return text(s.label);
+  };
+  auto checkbox = Checkbox({
+      .label = "label",
+      .transform = custom,
+  });
+  checkbox->Render();
+  EXPECT_EQ(called, 1);
+}
+
+}  // namespace ftxui
+// NOLINTEND
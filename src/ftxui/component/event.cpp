@@ -1,7 +1,10 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <utility>  // for move
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t, uint8_t
+#include <utility>    // for move
 
 #include "ftxui/component/event.hpp"
 #include "ftxui/component/mouse.hpp"  // for Mouse
@@ -15,7 +18,7 @@ namespace ftxui {
 // static
 Event Event::Character(std::string input) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   event.type_ = Type::Character;
   return event;
 }
@@ -43,37 +46,91 @@ Event Event::Character(wchar_t c) {
 // static
 Event Event::Mouse(std::string input, struct Mouse mouse) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   event.type_ = Type::Mouse;
   event.data_.mouse = mouse;  // NOLINT
   return event;
 }
 
+/// @brief An event corresponding to a text pasted in the terminal, when it
+/// supports the bracketed paste mode.
+/// @param text The text pasted. The new lines are `\n`.
+/// @ingroup component
+// static
+Event Event::Paste(std::string text) {
+  Event event;
+  event.SetInput("\x1B[200~" + text + "\x1B[201~");
+  event.type_ = Type::Paste;
+  return event;
+}
+
+/// @brief The text pasted, without the brackets.
+std::string Event::paste() const {
+  const size_t bracket_size = 6;
+  return input_.substr(bracket_size, input_.size() - 2 * bracket_size);
+}
+
 /// @brief An event corresponding to a terminal DCS (Device Control String).
 // static
 Event Event::CursorShape(std::string input, int shape) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   event.type_ = Type::CursorShape;
   event.data_.cursor_shape = shape;  // NOLINT
   return event;
 }
 
+/// @brief An event corresponding to a terminal DECRPM (Report Mode). The
+/// |value| is 1 or 2 when the |mode| is supported, and currently set or reset.
+/// @internal
+// static
+Event Event::ModeReport(std::string input, int mode, int value) {
+  Event event;
+  event.SetInput(std::move(input));
+  event.type_ = Type::ModeReport;
+  event.data_.mode_report = {mode, value};  // NOLINT
+  return event;
+}
+
+/// @brief An event corresponding to the terminal's answer to a query about
+/// itself: XTVERSION or XTGETTCAP.
+/// @internal
+// static
+Event Event::TerminalReport(std::string input) {
+  Event event;
+  event.SetInput(std::move(input));
+  event.type_ = Type::TerminalReport;
+  return event;
+}
+
 /// @brief An custom event whose meaning is defined by the user of the library.
 /// @param input An arbitrary sequence of character defined by the developer.
 /// @ingroup component.
 // static
 Event Event::Special(std::string input) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   return event;
 }
 
+// private
+// Set the input, and the key summarizing it. The key holds the size, in its
+// most significant byte, and the first bytes of the input. It identifies the
+// inputs shorter than its size.
+void Event::SetInput(std::string input) {
+  input_ = std::move(input);
+  const size_t size = std::min(input_.size(), size_t(0xFF));  // NOLINT
+  key_ = uint64_t(size) << 56U;                                // NOLINT
+  for (size_t i = 0; i < std::min(size, sizeof(key_) - 1); ++i) {
+    key_ |= uint64_t(uint8_t(input_[i])) << (8U * i);  // NOLINT
+  }
+}
+
 /// @internal
 // static
 Event Event::CursorPosition(std::string input, int x, int y) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   event.type_ = Type::CursorPosition;
   event.data_.cursor = {x, y};  // NOLINT
   return event;
@@ -117,4 +174,7 @@ const Event Event::PageUp = Event::Special({27, 91, 53, 126});    // NOLINT
 const Event Event::PageDown = Event::Special({27, 91, 54, 126});  // NOLINT
 const Event Event::Custom = Event::Special({0});                  // NOLINT
 
+// A terminal can't send this input, as "\x1B[r" is a complete sequence.
+const Event Event::Resize = Event::Special("\x1B[resize]");  // NOLINT
+
 }  // namespace ftxui
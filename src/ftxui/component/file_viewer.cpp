@@ -0,0 +1,421 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>    // for max, min
+#include <atomic>       // for atomic
+#include <cstddef>      // for size_t
+#include <cstring>      // for memchr
+#include <memory>       // for shared_ptr, make_shared
+#include <mutex>        // for mutex, lock_guard
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <thread>       // for thread
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/component/animation.hpp"  // for RequestAnimationFrame
+#include "ftxui/component/component.hpp"  // for FileViewer, Make
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
+#include "ftxui/dom/elements.hpp"  // for text, Element, filler, hbox, inverted, reflect, vbox, vscroll_indicator, xflex_shrink, yframe, yflex
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::SELECTED
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Utf8Glyphs
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>     // for open, O_RDONLY
+#include <sys/mman.h>  // for mmap, munmap, MAP_FAILED
+#include <sys/stat.h>  // for fstat, stat
+#include <unistd.h>    // for close
+#endif
+
+namespace ftxui {
+
+namespace {
+
+// A file mapped read-only into memory. The pages are loaded by the system when
+// they are read, so opening a file costs nothing, whatever its size.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& path) { Map(path); }
+  ~MappedFile() { Unmap(); }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool ok() const { return ok_; }
+  std::string_view data() const { return {data_, size_}; }
+
+ private:
+#if defined(_WIN32)
+  void Map(const std::string& path) {
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+      return;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size)) {
+      return;
+    }
+    size_ = size_t(size.QuadPart);
+    ok_ = true;
+    if (size_ == 0) {
+      return;
+    }
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_) {
+      ok_ = false;
+      return;
+    }
+    data_ = static_cast<const char*>(
+        MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    ok_ = data_ != nullptr;
+  }
+
+  void Unmap() {
+    if (data_) {
+      UnmapViewOfFile(data_);
+    }
+    if (mapping_) {
+      CloseHandle(mapping_);
+    }
+    if (file_ != INVALID_HANDLE_VALUE) {
+      CloseHandle(file_);
+    }
+  }
+
+  HANDLE file_ = INVALID_HANDLE_VALUE;
+  HANDLE mapping_ = nullptr;
+#else
+  void Map(const std::string& path) {
+    const int fd = open(path.c_str(), O_RDONLY);  // NOLINT
+    if (fd < 0) {
+      return;
+    }
+    struct stat status = {};
+    if (fstat(fd, &status) == 0) {
+      size_ = size_t(status.st_size);
+      ok_ = true;
+      if (size_ != 0) {
+        void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {  // NOLINT
+          ok_ = false;
+        } else {
+          data_ = static_cast<const char*>(data);
+        }
+      }
+    }
+    close(fd);
+  }
+
+  void Unmap() {
+    if (data_) {
+      munmap(const_cast<char*>(data_), size_);  // NOLINT
+    }
+  }
+#endif
+
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  bool ok_ = false;
+};
+
+// The offset of one line every |kStride|. It is built by a background thread,
+// and can be used while it is built. Its size is bounded by the number of lines
+// divided by |kStride|.
+class LineIndex {
+ public:
+  static constexpr size_t kStride = 1024;
+
+  explicit LineIndex(std::string_view data) : data_(data) {}
+  ~LineIndex() {
+    stop_ = true;
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+  LineIndex(const LineIndex&) = delete;
+  LineIndex& operator=(const LineIndex&) = delete;
+
+  // Start building the index, if not already started. Without threads, it is
+  // built entirely, on the calling thread.
+  void Start() {
+#if defined(FTXUI_NO_THREADS)
+    if (!done_) {
+      Build();
+    }
+#else
+    if (!thread_.joinable() && !done_) {
+      thread_ = std::thread([this] { Build(); });
+    }
+#endif
+  }
+
+  // The number of lines indexed so far.
+  size_t lines() const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return lines_;
+  }
+
+  bool done() const { return done_; }
+
+  // The offset of the line |line|. |line| must be lower than lines().
+  size_t Offset(size_t line) const {
+    size_t start = 0;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      start = checkpoints_[line / kStride];
+    }
+    for (size_t i = line % kStride; i != 0; --i) {
+      start = Next(start);
+    }
+    return start;
+  }
+
+  // The line starting at |*start|, without its end of line. |*start| is moved
+  // to the next line.
+  std::string_view Line(size_t* start) const {
+    const size_t begin = *start;
+    *start = Next(begin);
+    size_t end = *start;
+    if (end > begin && data_[end - 1] == '\n') {
+      --end;
+    }
+    if (end > begin && data_[end - 1] == '\r') {
+      --end;
+    }
+    return data_.substr(begin, end - begin);
+  }
+
+ private:
+  // The start of the line following the one starting at |start|.
+  size_t Next(size_t start) const {
+    const void* end =
+        std::memchr(data_.data() + start, '\n', data_.size() - start);
+    if (!end) {
+      return data_.size();
+    }
+    return size_t(static_cast<const char*>(end) - data_.data()) + 1;
+  }
+
+  void Build() {
+    // The file is scanned by chunks, so that the lines are published
+    // progressively.
+    constexpr size_t kChunkLines = 64 * kStride;
+    size_t start = 0;
+    size_t lines = 0;
+    std::vector<size_t> checkpoints;
+    while (start < data_.size() && !stop_) {
+      for (size_t i = 0; i < kChunkLines && start < data_.size(); ++i) {
+        if (lines % kStride == 0) {
+          checkpoints.push_back(start);
+        }
+        start = Next(start);
+        ++lines;
+      }
+      const std::lock_guard<std::mutex> lock(mutex_);
+      checkpoints_.insert(checkpoints_.end(), checkpoints.begin(),
+                          checkpoints.end());
+      checkpoints.clear();
+      lines_ = lines;
+    }
+    done_ = !stop_;
+  }
+
+  const std::string_view data_;
+
+  mutable std::mutex mutex_;
+  std::vector<size_t> checkpoints_;
+  size_t lines_ = 0;
+
+  std::atomic<bool> stop_{false};
+  std::atomic<bool> done_{false};
+  std::thread thread_;
+};
+
+struct File {
+  explicit File(const std::string& path) : mapped(path), index(mapped.data()) {}
+  MappedFile mapped;
+  LineIndex index;
+};
+
+// The lines of the file. Its height is the number of lines indexed so far, but
+// only the lines inside the stencil are read and drawn.
+class Lines : public Node {
+ public:
+  Lines(std::shared_ptr<const File> file, size_t lines, Box selected_box)
+      : file_(std::move(file)), lines_(lines), selected_box_(selected_box) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 0;
+    requirement_.min_y = int(lines_);
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.selection = Requirement::SELECTED;
+    requirement_.selected_box = selected_box_;
+  }
+
+  void Render(Screen& screen) override {
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    if (y_min > y_max || size_t(y_min - box_.y_min) >= lines_) {
+      return;
+    }
+    // The first visible line is found from the index, the next ones follow.
+    size_t start = file_->index.Offset(size_t(y_min - box_.y_min));
+    for (int y = y_min; y <= y_max; ++y) {
+      if (size_t(y - box_.y_min) >= lines_) {
+        return;
+      }
+      const std::string_view line = file_->index.Line(&start);
+      int x = box_.x_min;
+      for (const std::string_view cell : Utf8Glyphs(line)) {
+        if (x > box_.x_max) {
+          break;
+        }
+        screen.PixelAt(x++, y).character = cell;
+      }
+    }
+  }
+
+ private:
+  std::shared_ptr<const File> file_;
+  size_t lines_;
+  Box selected_box_;
+};
+
+class FileViewerBase : public ComponentBase {
+ public:
+  explicit FileViewerBase(std::string path)
+      : path_(std::move(path)), file_(std::make_shared<File>(path_)) {}
+
+ private:
+  Element Render() override {
+    if (!file_->mapped.ok()) {
+      return text("Cannot open " + path_);
+    }
+    file_->index.Start();
+    const size_t lines = file_->index.lines();
+    const bool done = file_->index.done();
+    // Redraw until the whole file is indexed, to show the new lines.
+    if (!done) {
+      animation::RequestAnimationFrame();
+    }
+    Clamp(lines);
+
+    // The selected box is the page, so that `yframe` shows it from its top.
+    const int page = std::max(1, box_.y_max - box_.y_min + 1);
+    const Box selected_box = {0, 0, top_, top_ + page - 1};
+    auto content = MakeNode<Lines>(file_, lines, selected_box);
+
+    std::string position = std::to_string(lines ? top_ + 1 : 0) + "/" +
+                           std::to_string(lines);
+    if (!done) {
+      position += "+";
+    }
+    return vbox({
+        content | vscroll_indicator | yframe | yflex | reflect(box_),
+        hbox({text(path_) | xflex_shrink, filler(), text(position)}) | inverted,
+    });
+  }
+
+  bool OnEvent(Event event) override {
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+    if (!Focused()) {
+      return false;
+    }
+    const int page = std::max(1, box_.y_max - box_.y_min);
+    const int old_top = top_;
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      top_--;
+    }
+    if (event == Event::ArrowDown || event == Event::Character('j')) {
+      top_++;
+    }
+    if (event == Event::PageUp) {
+      top_ -= page;
+    }
+    if (event == Event::PageDown) {
+      top_ += page;
+    }
+    if (event == Event::Home) {
+      top_ = 0;
+    }
+    if (event == Event::End) {
+      top_ = kEnd;
+    }
+    Clamp(file_->index.lines());
+    return top_ != old_top;
+  }
+
+  bool OnMouseEvent(Event event) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+    const int old_top = top_;
+    if (event.mouse().button == Mouse::WheelUp) {
+      top_ -= 3;
+    }
+    if (event.mouse().button == Mouse::WheelDown) {
+      top_ += 3;
+    }
+    Clamp(file_->index.lines());
+    return top_ != old_top;
+  }
+
+  // Keep the last page full.
+  void Clamp(size_t lines) {
+    const int page = box_.y_max - box_.y_min + 1;
+    const int max_top =
+        std::max(0, int(std::min(lines, size_t(kEnd))) - std::max(1, page));
+    top_ = std::max(0, std::min(top_, max_top));
+  }
+
+  bool Focusable() const override { return true; }
+
+  static constexpr int kEnd = 1 << 30;
+
+  std::string path_;
+  std::shared_ptr<File> file_;
+  int top_ = 0;
+  Box box_;
+};
+
+}  // namespace
+
+/// @brief A pager, displaying a file of any size.
+///
+/// The file is mapped into memory instead of being read. The offsets of its
+/// lines are indexed by a background thread, one line every 1024, so the
+/// memory used stays small. Only the visible lines are read and drawn, without
+/// copying them. With FTXUI_ENABLE_THREADS=OFF, the index is built when the
+/// file is first drawn.
+///
+/// It scrolls with the arrow keys, `j`/`k`, PageUp/PageDown, Home/End and the
+/// mouse wheel. The last line shows the path and the position in the file.
+/// @param path The file to display.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.Loop(FileViewer("/var/log/syslog"));
+/// ```
+Component FileViewer(std::string path) {
+  return Make<FileViewerBase>(std::move(path));
+}
+
+}  // namespace ftxui
@@ -0,0 +1,136 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <cstdio>   // for remove
+#include <fstream>  // for ofstream
+#include <string>   // for string, to_string
+
+#include "ftxui/component/component.hpp"       // for FileViewer
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::End, Event::Home, Event::PageDown
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A file removed at the end of the test.
+class TempFile {
+ public:
+  explicit TempFile(const std::string& content)
+      : path_(::testing::TempDir() + "ftxui_file_viewer_" +
+              ::testing::UnitTest::GetInstance()->current_test_info()->name()) {
+    std::ofstream(path_, std::ios::binary) << content;
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+// The characters drawn by |component|, without their style.
+std::string Draw(Component component, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, component->Render());
+  std::string out;
+  for (int y = 0; y < height; ++y) {
+    if (y) {
+      out += "\n";
+    }
+    for (int x = 0; x < width; ++x) {
+      out += screen.PixelAt(x, y).character;
+    }
+  }
+  return out;
+}
+
+// The last line: the path, then the position.
+std::string Status(const TempFile& file, const std::string& position, int width) {
+  std::string path = file.path();
+  path.resize(size_t(width) - position.size(), ' ');
+  return path + position;
+}
+
+// Render |component| until its file is fully indexed.
+std::string DrawIndexed(Component component, int width, int height) {
+  std::string out;
+  do {
+    out = Draw(component, width, height);
+  } while (out.back() == '+');
+  return out;
+}
+
+std::string Lines(int count) {
+  std::string out;
+  for (int i = 0; i < count; ++i) {
+    out += "line " + std::to_string(i) + "\n";
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(FileViewerTest, Basic) {
+  TempFile file("first\r\nsecond\nthird");
+  auto viewer = FileViewer(file.path());
+  EXPECT_EQ(DrawIndexed(viewer, 8, 4),
+            "first   \n"
+            "second  \n"
+            "third   \n" +
+                Status(file, "1/3", 8));
+}
+
+TEST(FileViewerTest, Scroll) {
+  TempFile file(Lines(5000));
+  auto viewer = FileViewer(file.path());
+  DrawIndexed(viewer, 20, 4);
+
+  EXPECT_TRUE(viewer->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(Draw(viewer, 20, 4),
+            "line 1             ┃\n"
+            "line 2              \n"
+            "line 3              \n" +
+                Status(file, "2/5000", 20));
+
+  EXPECT_TRUE(viewer->OnEvent(Event::PageDown));
+  EXPECT_EQ(Draw(viewer, 20, 4),
+            "line 3             ┃\n"
+            "line 4              \n"
+            "line 5              \n" +
+                Status(file, "4/5000", 20));
+
+  // The lines are found from the index, past its first checkpoints.
+  EXPECT_TRUE(viewer->OnEvent(Event::End));
+  EXPECT_EQ(Draw(viewer, 20, 4),
+            "line 4997           \n"
+            "line 4998           \n"
+            "line 4999          ╻\n" +
+                Status(file, "4998/5000", 20));
+  EXPECT_FALSE(viewer->OnEvent(Event::ArrowDown));
+
+  EXPECT_TRUE(viewer->OnEvent(Event::Home));
+  EXPECT_EQ(Draw(viewer, 20, 4),
+            "line 0             ┃\n"
+            "line 1              \n"
+            "line 2              \n" +
+                Status(file, "1/5000", 20));
+  EXPECT_FALSE(viewer->OnEvent(Event::ArrowUp));
+}
+
+TEST(FileViewerTest, Empty) {
+  TempFile file("");
+  auto viewer = FileViewer(file.path());
+  EXPECT_EQ(DrawIndexed(viewer, 5, 2), "     \n" + Status(file, "0/0", 5));
+}
+
+TEST(FileViewerTest, MissingFile) {
+  auto viewer = FileViewer(::testing::TempDir() + "ftxui_missing_file");
+  EXPECT_EQ(Draw(viewer, 6, 1), "Cannot");
+}
+
+}  // namespace ftxui
+// NOLINTEND
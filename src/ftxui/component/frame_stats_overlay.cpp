@@ -0,0 +1,107 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <chrono>   // for seconds, duration
+#include <deque>    // for deque
+#include <string>   // for string, to_string
+#include <utility>  // for move
+
+#include "ftxui/component/animation.hpp"  // for Clock, Duration, TimePoint
+#include "ftxui/component/component.hpp"  // for ComponentDecorator, FrameStatsOverlay, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive, FrameStats
+#include "ftxui/dom/elements.hpp"  // for text, hbox, vbox, dbox, filler, border, clear_under, Element
+
+namespace ftxui {
+
+namespace {
+
+// Format |duration| as milliseconds, with two decimals.
+std::string Milliseconds(animation::Duration duration) {
+  const long microseconds = long(duration.count() * 1e6F);  // NOLINT
+  const long hundredths = (microseconds % 1000) / 10;       // NOLINT
+  return std::to_string(microseconds / 1000) + "." +        // NOLINT
+         (hundredths < 10 ? "0" : "") + std::to_string(hundredths) + "ms";
+}
+
+Element Row(const std::string& label, const std::string& value) {
+  return hbox({text(label), filler(), text(" " + value)});
+}
+
+}  // namespace
+
+/// @brief Draw the performance of the screen in the top right corner of
+/// |child|: the frames per second, how long the previous frame took in each
+/// phase, the tasks handled before it, the elements it built, and the bytes it
+/// wrote. The events are forwarded to |child|.
+///
+/// The statistics are collected from the active ScreenInteractive, which is
+/// asked to collect them. See `ScreenInteractive::CollectFrameStats()`.
+/// @param child the component to decorate.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto dashboard = Dashboard();
+/// if (debug) {
+///   dashboard |= FrameStatsOverlay();
+/// }
+/// screen.Loop(dashboard);
+/// ```
+Component FrameStatsOverlay(Component child) {
+  class Impl : public ComponentBase {
+   private:
+    Element Render() override {
+      // The frames drawn during the last second.
+      const animation::TimePoint now = animation::Clock::now();
+      frames_.push_back(now);
+      while (now - frames_.front() > std::chrono::seconds(1)) {
+        frames_.pop_front();
+      }
+
+      Elements rows = {Row("fps", std::to_string(frames_.size()))};
+      if (ScreenInteractive* screen = ScreenInteractive::Active()) {
+        screen->CollectFrameStats();
+        const FrameStats& stats = screen->LastFrameStats();
+        rows.push_back(Row("frame", Milliseconds(stats.total)));
+        rows.push_back(Row(" render", Milliseconds(stats.render)));
+        rows.push_back(Row(" layout", Milliseconds(stats.layout)));
+        rows.push_back(Row(" draw", Milliseconds(stats.draw + stats.shader)));
+        rows.push_back(
+            Row(" output", Milliseconds(stats.serialize + stats.write)));
+        rows.push_back(Row("tasks", std::to_string(stats.tasks)));
+        rows.push_back(Row("nodes", std::to_string(stats.nodes)));
+        rows.push_back(Row("bytes", std::to_string(stats.bytes)));
+      }
+
+      auto overlay = vbox(std::move(rows)) | border | clear_under;
+      return dbox({
+          ComponentBase::Render(),
+          vbox({hbox({filler(), std::move(overlay)}), filler()}),
+      });
+    }
+    int EventCategories() const override { return 0; }
+
+    std::deque<animation::TimePoint> frames_;
+  };
+
+  auto impl = Make<Impl>();
+  impl->Add(std::move(child));
+  return impl;
+}
+
+/// @brief Draw the performance of the screen in the top right corner of the
+/// component.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto dashboard = Dashboard() | FrameStatsOverlay();
+/// ```
+ComponentDecorator FrameStatsOverlay() {
+  return [](Component child) { return FrameStatsOverlay(std::move(child)); };
+}
+
+}  // namespace ftxui
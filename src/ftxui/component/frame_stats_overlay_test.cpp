@@ -0,0 +1,47 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/component/component.hpp"  // for FrameStatsOverlay, Renderer
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+#include "ftxui/dom/node.hpp"                      // for Render
+#include "ftxui/screen/screen.hpp"                 // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(FrameStatsOverlayTest, WithoutScreenInteractive) {
+  auto component = Renderer([] { return text("content"); }) |
+                   FrameStatsOverlay();
+  Screen screen(16, 4);
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(),
+            "content  ╭─────╮\r\n"
+            "         │fps 1│\r\n"
+            "         ╰─────╯\r\n"
+            "                ");
+}
+
+TEST(FrameStatsOverlayTest, WithScreenInteractive) {
+  auto component = Renderer([] { return text("content"); }) |
+                   FrameStatsOverlay();
+  auto screen = ScreenInteractive::Headless(40, 12);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+
+  const std::string output = screen.HeadlessOutput();
+  for (const char* label : {"fps", "frame", "render", "layout", "draw",
+                            "output", "tasks", "nodes", "bytes"}) {
+    EXPECT_NE(output.find(label), std::string::npos) << label;
+  }
+  EXPECT_NE(output.find("content"), std::string::npos);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -54,6 +54,10 @@ Component Hoverable(Component component, bool* hover) {
       return ComponentBase::Render() | reflect(box_);
     }
 
+    int EventCategories() const override {
+      return MouseButtonEvents | MouseMotionEvents;
+    }
+
     bool OnEvent(Event event) override {
       if (event.is_mouse()) {
         *hover_ = box_.Contain(event.mouse().x, event.mouse().y) &&
@@ -103,6 +107,10 @@ Component Hoverable(Component component,
       return ComponentBase::Render() | reflect(box_);
     }
 
+    int EventCategories() const override {
+      return MouseButtonEvents | MouseMotionEvents;
+    }
+
     bool OnEvent(Event event) override {
       if (event.is_mouse()) {
         const bool hover = box_.Contain(event.mouse().x, event.mouse().y) &&
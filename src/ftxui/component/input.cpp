@@ -1,7 +1,7 @@
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <algorithm>   // for max, min
+#include <algorithm>   // for max, min, remove
 #include <cstddef>     // for size_t
 #include <cstdint>     // for uint32_t
 #include <functional>  // for function
@@ -15,9 +15,11 @@
 #include "ftxui/component/component.hpp"          // for Make, Input
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for InputOption
+#include "ftxui/component/entry.hpp"  // for Transform, InputTransform
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowLeftCtrl, Event::ArrowRight, Event::ArrowRightCtrl, Event::ArrowUp, Event::Backspace, Event::Delete, Event::End, Event::Home, Event::Return
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/component/screen_interactive.hpp"  // for Component
+#include "ftxui/component/text_buffer.hpp"         // for TextBuffer
 #include "ftxui/dom/elements.hpp"  // for operator|, reflect, text, Element, xflex, hbox, Elements, frame, operator|=, vbox, focus, focusCursorBarBlinking, select
 #include "ftxui/screen/box.hpp"    // for Box
 #include "ftxui/screen/string.hpp"           // for string_width
@@ -90,6 +92,42 @@ bool IsWordCharacter(const std::string& input, size_t iter) {
   return IsWordCodePoint(ucs);
 }
 
+// The lines of the edited text. They are either split from the content, or
+// read directly from the TextBuffer.
+class Lines {
+ public:
+  explicit Lines(const std::string& content) : split_(Split(content)) {}
+  explicit Lines(const TextBuffer* buffer) : buffer_(buffer) {}
+
+  size_t size() const { return buffer_ ? buffer_->LineCount() : split_.size(); }
+  bool empty() const { return size() == 0; }
+  const std::string& operator[](size_t i) const {
+    return buffer_ ? buffer_->Line(i) : split_[i];
+  }
+
+  // Find the line and index of |position|.
+  void Locate(int position, int* line, int* index) const {
+    if (buffer_) {
+      *line = int(buffer_->LineOf(position));
+      *index = position - int(buffer_->LineStart(*line));
+      return;
+    }
+    *line = 0;
+    *index = position;
+    for (const auto& l : split_) {
+      if (*index <= (int)l.size()) {
+        break;
+      }
+      *index -= l.size() + 1;
+      (*line)++;
+    }
+  }
+
+ private:
+  const TextBuffer* buffer_ = nullptr;
+  std::vector<std::string> split_;
+};
+
 // An input box. The user can type text into it.
 class InputBase : public ComponentBase, public InputOption {
  public:
@@ -104,86 +142,111 @@ class InputBase : public ComponentBase, public InputOption {
                          : insert()                 ? focusCursorBarBlinking
                                                     : focusCursorBlockBlinking;
 
-    auto transform_func =
-        transform ? transform : InputOption::Default().transform;
-
     // placeholder.
-    if (content->empty()) {
+    if (Size() == 0) {
       auto element = text(placeholder()) | xflex | frame;
       if (is_focused) {
         element |= focus;
       }
 
-      return transform_func({
-                 std::move(element), hovered_, is_focused,
-                 true  // placeholder
-             }) |
+      return Transform(transform, InputTransform,
+                       InputState{
+                           std::move(element), hovered_, is_focused,
+                           true  // placeholder
+                       }) |
              reflect(box_);
     }
 
-    Elements elements;
-    const std::vector<std::string> lines = Split(*content);
+    auto lines = std::make_shared<const Lines>(GetLines());
 
-    cursor_position() = util::clamp(cursor_position(), 0, (int)content->size());
+    cursor_position() = util::clamp(cursor_position(), 0, (int)Size());
 
     // Find the line and index of the cursor.
     int cursor_line = 0;
-    int cursor_char_index = cursor_position();
-    for (const auto& line : lines) {
-      if (cursor_char_index <= (int)line.size()) {
-        break;
+    int cursor_char_index = 0;
+    lines->Locate(cursor_position(), &cursor_line, &cursor_char_index);
+
+    Element element;
+    if (virtualized) {
+      // Only the lines visible inside the frame are built.
+      auto row = [this, lines, cursor_line, cursor_char_index,
+                  focused](int i) {
+        return RenderLine((*lines)[i], i == cursor_line, cursor_char_index,
+                          focused);
+      };
+      element = virtualList(int(lines->size()), row, cursor_line);
+    } else {
+      Elements elements;
+      if (lines->empty()) {
+        elements.push_back(text("") | focused);
       }
 
-      cursor_char_index -= line.size() + 1;
-      cursor_line++;
-    }
-
-    if (lines.empty()) {
-      elements.push_back(text("") | focused);
-    }
-
-    elements.reserve(lines.size());
-    for (size_t i = 0; i < lines.size(); ++i) {
-      const std::string& line = lines[i];
-
-      // This is not the cursor line.
-      if (int(i) != cursor_line) {
-        elements.push_back(Text(line));
-        continue;
-      }
-
-      // The cursor is at the end of the line.
-      if (cursor_char_index >= (int)line.size()) {
-        elements.push_back(hbox({
-                               Text(line),
-                               text(" ") | focused | reflect(cursor_box_),
-                           }) |
-                           xflex);
-        continue;
+      // The lines without the cursor are reused from the previous frame,
+      // unless they changed.
+      line_cache_.resize(lines->size());
+      elements.reserve(lines->size());
+      for (size_t i = 0; i < lines->size(); ++i) {
+        elements.push_back(int(i) == cursor_line
+                               ? RenderLine((*lines)[i], true,
+                                            cursor_char_index, focused)
+                               : CachedLine(i, (*lines)[i]));
       }
+      element = vbox(std::move(elements));
+    }
 
-      // The cursor is on this line.
-      const int glyph_start = cursor_char_index;
-      const int glyph_end = GlyphNext(line, glyph_start);
-      const std::string part_before_cursor = line.substr(0, glyph_start);
-      const std::string part_at_cursor =
-          line.substr(glyph_start, glyph_end - glyph_start);
-      const std::string part_after_cursor = line.substr(glyph_end);
-      auto element = hbox({
-                         Text(part_before_cursor),
-                         Text(part_at_cursor) | focused | reflect(cursor_box_),
-                         Text(part_after_cursor),
+    element |= frame;
+    return Transform(transform, InputTransform,
+                     InputState{
+                         std::move(element), hovered_, is_focused,
+                         false  // placeholder
                      }) |
-                     xflex;
-      elements.push_back(element);
+           xflex | reflect(box_);
+  }
+
+  Element RenderLine(const std::string& line,
+                     bool is_cursor_line,
+                     int cursor_char_index,
+                     const Decorator& focused) {
+    // This is not the cursor line.
+    if (!is_cursor_line) {
+      return Text(line);
     }
 
-    auto element = vbox(std::move(elements)) | frame;
-    return transform_func({
-               std::move(element), hovered_, is_focused,
-               false  // placeholder
+    // The cursor is at the end of the line.
+    if (cursor_char_index >= (int)line.size()) {
+      return hbox({
+                 Text(line),
+                 text(" ") | focused | reflect(cursor_box_),
+             }) |
+             xflex;
+    }
+
+    // The cursor is on this line.
+    const int glyph_start = cursor_char_index;
+    const int glyph_end = GlyphNext(line, glyph_start);
+    const std::string part_before_cursor = line.substr(0, glyph_start);
+    const std::string part_at_cursor =
+        line.substr(glyph_start, glyph_end - glyph_start);
+    const std::string part_after_cursor = line.substr(glyph_end);
+    return hbox({
+               Text(part_before_cursor),
+               Text(part_at_cursor) | focused | reflect(cursor_box_),
+               Text(part_after_cursor),
            }) |
-           xflex | reflect(box_);
+           xflex;
+  }
+
+  // The Element of the line |i|, not holding the cursor. It is built again
+  // only when the line changed.
+  Element CachedLine(size_t i, const std::string& line) {
+    LineElement& cached = line_cache_[i];
+    if (!cached.element || cached.line != line ||
+        cached.password != password()) {
+      cached.line = line;
+      cached.password = password();
+      cached.element = Text(line);
+    }
+    return cached.element;
   }
 
   Element Text(const std::string& input) {
@@ -191,33 +254,110 @@ class InputBase : public ComponentBase, public InputOption {
       return text(input);
     }
 
-    std::string out;
-    out.reserve(10 + input.size() * 3 / 2);
-    for (size_t i = 0; i < input.size(); ++i) {
-      out += "•";
+    return maskedText(string_width(input));
+  }
+
+  // Access to the edited text. It is `buffer` when set, `content` otherwise.
+  Lines GetLines() const { return buffer ? Lines(buffer) : Lines(*content); }
+
+  size_t Size() const { return buffer ? buffer->size() : content->size(); }
+
+  // The line containing |iter|, and where it starts.
+  const std::string& LineAt(size_t iter, size_t* start) const {
+    const size_t line = buffer->LineOf(iter);
+    *start = buffer->LineStart(line);
+    return buffer->Line(line);
+  }
+
+  bool IsNewline(size_t iter) const {
+    if (!buffer) {
+      return content()[iter] == '\n';
+    }
+    size_t start = 0;
+    const std::string& line = LineAt(iter, &start);
+    return iter - start == line.size() && iter != buffer->size();
+  }
+
+  size_t Next(size_t iter) const {
+    if (!buffer) {
+      return GlyphNext(content(), iter);
+    }
+    size_t start = 0;
+    const std::string& line = LineAt(iter, &start);
+    if (iter - start >= line.size()) {
+      return iter + 1;
+    }
+    return start + GlyphNext(line, iter - start);
+  }
+
+  size_t Previous(size_t iter) const {
+    if (!buffer) {
+      return GlyphPrevious(content(), iter);
+    }
+    size_t start = 0;
+    const std::string& line = LineAt(iter, &start);
+    if (iter == start) {
+      return iter == 0 ? 0 : iter - 1;
+    }
+    return start + GlyphPrevious(line, iter - start);
+  }
+
+  size_t Width(size_t iter) const {
+    if (!buffer) {
+      return GlyphWidth(content(), iter);
+    }
+    if (iter >= buffer->size()) {
+      return 0;
+    }
+    size_t start = 0;
+    const std::string& line = LineAt(iter, &start);
+    return iter - start >= line.size() ? 1 : GlyphWidth(line, iter - start);
+  }
+
+  bool IsWord(size_t iter) const {
+    if (!buffer) {
+      return IsWordCharacter(content(), iter);
+    }
+    size_t start = 0;
+    const std::string& line = LineAt(iter, &start);
+    return IsWordCharacter(line, iter - start);
+  }
+
+  void Insert(size_t iter, const std::string& text) {
+    if (buffer) {
+      buffer->Insert(iter, text);
+    } else {
+      content->insert(iter, text);
+    }
+  }
+
+  void Erase(size_t iter, size_t count) {
+    if (buffer) {
+      buffer->Erase(iter, count);
+    } else {
+      content->erase(iter, count);
     }
-    return text(out);
   }
 
   bool HandleBackspace() {
     if (cursor_position() == 0) {
       return false;
     }
-    const size_t start = GlyphPrevious(content(), cursor_position());
+    const size_t start = Previous(cursor_position());
     const size_t end = cursor_position();
-    content->erase(start, end - start);
+    Erase(start, end - start);
     cursor_position() = start;
     on_change();
     return true;
   }
 
   bool DeleteImpl() {
-    if (cursor_position() == (int)content->size()) {
+    if (cursor_position() == (int)Size()) {
       return false;
     }
     const size_t start = cursor_position();
-    const size_t end = GlyphNext(content(), cursor_position());
-    content->erase(start, end - start);
+    const size_t end = Next(cursor_position());
+    Erase(start, end - start);
     return true;
   }
 
@@ -234,46 +374,67 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
 
-    cursor_position() = GlyphPrevious(content(), cursor_position());
+    cursor_position() = Previous(cursor_position());
     return true;
   }
 
   bool HandleArrowRight() {
-    if (cursor_position() == (int)content->size()) {
+    if (cursor_position() == (int)Size()) {
       return false;
     }
 
-    cursor_position() = GlyphNext(content(), cursor_position());
+    cursor_position() = Next(cursor_position());
     return true;
   }
 
-  size_t CursorColumn() {
-    size_t iter = cursor_position();
+  // A line of the text: the range [begin, end) of |text|. Adding |offset|
+  // converts a position in |text| into a cursor position.
+  struct LineRange {
+    const std::string* text;
+    size_t offset;
+    size_t begin;
+    size_t end;
+  };
+
+  // The line containing the cursor |position|. Only this line is scanned.
+  LineRange LineContaining(size_t position) const {
+    if (buffer) {
+      size_t start = 0;
+      const std::string& line = LineAt(position, &start);
+      return {&line, start, 0, line.size()};
+    }
+    const std::string& text = content();
+    const size_t previous =
+        position == 0 ? std::string::npos : text.rfind('\n', position - 1);
+    const size_t next = text.find('\n', position);
+    return {
+        &text,
+        0,
+        previous == std::string::npos ? 0 : previous + 1,
+        next == std::string::npos ? text.size() : next,
+    };
+  }
+
+  // The width of |line|, up to |position|.
+  static int Column(const LineRange& line, size_t position) {
     int width = 0;
-    while (true) {
-      if (iter == 0) {
-        break;
-      }
-      iter = GlyphPrevious(content(), iter);
-      if (content()[iter] == '\n') {
-        break;
-      }
-      width += GlyphWidth(content(), iter);
+    size_t iter = line.begin;
+    while (iter < position - line.offset) {
+      width += GlyphWidth(*line.text, iter);
+      iter = GlyphNext(*line.text, iter);
     }
     return width;
   }
 
-  // Move the cursor `columns` on the right, if possible.
-  void MoveCursorColumn(int columns) {
-    while (columns > 0) {
-      if (cursor_position() == (int)content().size() ||
-          content()[cursor_position()] == '\n') {
-        return;
-      }
-
-      columns -= GlyphWidth(content(), cursor_position());
-      cursor_position() = GlyphNext(content(), cursor_position());
+  // The position `columns` on the right of the beginning of |line|, if
+  // possible.
+  static size_t PositionAt(const LineRange& line, int columns) {
+    size_t iter = line.begin;
+    while (columns > 0 && iter < line.end) {
+      columns -= GlyphWidth(*line.text, iter);
+      iter = GlyphNext(*line.text, iter);
     }
+    return line.offset + iter;
   }
 
   bool HandleArrowUp() {
@@ -281,55 +442,32 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
 
-    const size_t columns = CursorColumn();
-
-    // Move cursor at the beginning of 2 lines above.
-    while (true) {
-      if (cursor_position() == 0) {
-        return true;
-      }
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (content()[previous] == '\n') {
-        break;
-      }
-      cursor_position() = previous;
-    }
-    cursor_position() = GlyphPrevious(content(), cursor_position());
-    while (true) {
-      if (cursor_position() == 0) {
-        break;
-      }
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (content()[previous] == '\n') {
-        break;
-      }
-      cursor_position() = previous;
+    const LineRange line = LineContaining(cursor_position());
+    const size_t start = line.offset + line.begin;
+    if (start == 0) {
+      cursor_position() = 0;
+      return true;
     }
 
-    MoveCursorColumn(columns);
+    const int columns = Column(line, cursor_position());
+    cursor_position() = PositionAt(LineContaining(start - 1), columns);
     return true;
   }
 
   bool HandleArrowDown() {
-    if (cursor_position() == (int)content->size()) {
+    if (cursor_position() == (int)Size()) {
       return false;
     }
 
-    const size_t columns = CursorColumn();
-
-    // Move cursor at the beginning of the next line
-    while (true) {
-      if (content()[cursor_position()] == '\n') {
-        break;
-      }
-      cursor_position() = GlyphNext(content(), cursor_position());
-      if (cursor_position() == (int)content().size()) {
-        return true;
-      }
+    const LineRange line = LineContaining(cursor_position());
+    const size_t end = line.offset + line.end;
+    if (end == Size()) {
+      cursor_position() = end;
+      return true;
     }
-    cursor_position() = GlyphNext(content(), cursor_position());
 
-    MoveCursorColumn(columns);
+    const int columns = Column(line, cursor_position());
+    cursor_position() = PositionAt(LineContaining(end + 1), columns);
     return true;
   }
 
@@ -339,7 +477,7 @@ class InputBase : public ComponentBase, public InputOption {
   }
 
   bool HandleEnd() {
-    cursor_position() = content->size();
+    cursor_position() = Size();
     return true;
   }
 
@@ -352,60 +490,71 @@ class InputBase : public ComponentBase, public InputOption {
   }
 
   bool HandleCharacter(const std::string& character) {
-    if (!insert() && cursor_position() < (int)content->size() &&
-        content()[cursor_position()] != '\n') {
+    if (!insert() && cursor_position() < (int)Size() &&
+        !IsNewline(cursor_position())) {
       DeleteImpl();
     }
-    content->insert(cursor_position(), character);
+    Insert(cursor_position(), character);
     cursor_position() += character.size();
     on_change();
     return true;
   }
 
+  // The pasted text is inserted at once, even in overtype mode.
+  bool HandlePaste(std::string text) {
+    if (!multiline()) {
+      text.erase(std::remove(text.begin(), text.end(), '\n'), text.end());
+    }
+    Insert(cursor_position(), text);
+    cursor_position() += text.size();
+    on_change();
+    return true;
+  }
+
   bool OnEvent(Event event) override {
-    cursor_position() = util::clamp(cursor_position(), 0, (int)content->size());
+    cursor_position() = util::clamp(cursor_position(), 0, (int)Size());
 
-    if (event == Event::Return) {
-      return HandleReturn();
-    }
-    if (event.is_character()) {
-      return HandleCharacter(event.character());
+    if (event.is_paste()) {
+      return HandlePaste(event.paste());
     }
     if (event.is_mouse()) {
       return HandleMouse(event);
     }
-    if (event == Event::Backspace) {
-      return HandleBackspace();
-    }
-    if (event == Event::Delete) {
-      return HandleDelete();
-    }
-    if (event == Event::ArrowLeft) {
-      return HandleArrowLeft();
+    if (const InputAction* action = keymap.Find(event)) {
+      return HandleAction(*action);
     }
-    if (event == Event::ArrowRight) {
-      return HandleArrowRight();
-    }
-    if (event == Event::ArrowUp) {
-      return HandleArrowUp();
-    }
-    if (event == Event::ArrowDown) {
-      return HandleArrowDown();
-    }
-    if (event == Event::Home) {
-      return HandleHome();
-    }
-    if (event == Event::End) {
-      return HandleEnd();
-    }
-    if (event == Event::ArrowLeftCtrl) {
-      return HandleLeftCtrl();
-    }
-    if (event == Event::ArrowRightCtrl) {
-      return HandleRightCtrl();
+    if (event.is_character()) {
+      return HandleCharacter(event.character());
     }
-    if (event == Event::Insert) {
-      return HandleInsert();
+    return false;
+  }
+
+  bool HandleAction(InputAction action) {
+    switch (action) {
+      case InputAction::Enter:
+        return HandleReturn();
+      case InputAction::MoveLeft:
+        return HandleArrowLeft();
+      case InputAction::MoveRight:
+        return HandleArrowRight();
+      case InputAction::MoveUp:
+        return HandleArrowUp();
+      case InputAction::MoveDown:
+        return HandleArrowDown();
+      case InputAction::MoveWordLeft:
+        return HandleLeftCtrl();
+      case InputAction::MoveWordRight:
+        return HandleRightCtrl();
+      case InputAction::MoveHome:
+        return HandleHome();
+      case InputAction::MoveEnd:
+        return HandleEnd();
+      case InputAction::DeleteBackward:
+        return HandleBackspace();
+      case InputAction::DeleteForward:
+        return HandleDelete();
+      case InputAction::ToggleInsert:
+        return HandleInsert();
     }
     return false;
   }
@@ -417,16 +566,16 @@ class InputBase : public ComponentBase, public InputOption {
 
     // Move left, as long as left it not a word.
     while (cursor_position()) {
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (IsWordCharacter(content(), previous)) {
+      const size_t previous = Previous(cursor_position());
+      if (IsWord(previous)) {
         break;
       }
       cursor_position() = previous;
     }
     // Move left, as long as left is a word character:
     while (cursor_position()) {
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (!IsWordCharacter(content(), previous)) {
+      const size_t previous = Previous(cursor_position());
+      if (!IsWord(previous)) {
         break;
       }
       cursor_position() = previous;
@@ -435,21 +584,21 @@ class InputBase : public ComponentBase, public InputOption {
   }
 
   bool HandleRightCtrl() {
-    if (cursor_position() == (int)content().size()) {
+    if (cursor_position() == (int)Size()) {
       return false;
     }
 
     // Move right, until entering a word.
-    while (cursor_position() < (int)content().size()) {
-      cursor_position() = GlyphNext(content(), cursor_position());
-      if (IsWordCharacter(content(), cursor_position())) {
+    while (cursor_position() < (int)Size()) {
+      cursor_position() = Next(cursor_position());
+      if (IsWord(cursor_position())) {
         break;
       }
     }
     // Move right, as long as right is a word character:
-    while (cursor_position() < (int)content().size()) {
-      const size_t next = GlyphNext(content(), cursor_position());
-      if (!IsWordCharacter(content(), cursor_position())) {
+    while (cursor_position() < (int)Size()) {
+      const size_t next = Next(cursor_position());
+      if (!IsWord(cursor_position())) {
         break;
       }
       cursor_position() = next;
@@ -475,52 +624,54 @@ class InputBase : public ComponentBase, public InputOption {
 
     TakeFocus();
 
-    if (content->empty()) {
+    if (Size() == 0) {
       cursor_position() = 0;
       return true;
     }
 
-    // Find the line and index of the cursor.
-    std::vector<std::string> lines = Split(*content);
-    int cursor_line = 0;
-    int cursor_char_index = cursor_position();
-    for (const auto& line : lines) {
-      if (cursor_char_index <= (int)line.size()) {
-        break;
-      }
-
-      cursor_char_index -= line.size() + 1;
-      cursor_line++;
-    }
-    const int cursor_column =
-        string_width(lines[cursor_line].substr(0, cursor_char_index));
+    // Find the line and column of the cursor.
+    const LineRange line = LineContaining(cursor_position());
+    const int cursor_column = string_width(line.text->substr(
+        line.begin, cursor_position() - line.offset - line.begin));
 
     int new_cursor_column = cursor_column + event.mouse().x - cursor_box_.x_min;
-    int new_cursor_line = cursor_line + event.mouse().y - cursor_box_.y_min;
+    int lines = event.mouse().y - cursor_box_.y_min;
+
+    // Move to the new line, one line at a time:
+    LineRange new_line = line;
+    while (lines < 0 && new_line.offset + new_line.begin != 0) {
+      new_line = LineContaining(new_line.offset + new_line.begin - 1);
+      lines++;
+    }
+    while (lines > 0 && new_line.offset + new_line.end != Size()) {
+      new_line = LineContaining(new_line.offset + new_line.end + 1);
+      lines--;
+    }
 
-    // Fix the new cursor position:
-    new_cursor_line = std::max(std::min(new_cursor_line, (int)lines.size()), 0);
+    // Below the last line.
+    if (lines > 0) {
+      cursor_position() = Size();
+      on_change();
+      return true;
+    }
 
-    const std::string empty_string;
-    const std::string& line = new_cursor_line < (int)lines.size()
-                                  ? lines[new_cursor_line]
-                                  : empty_string;
-    new_cursor_column = util::clamp(new_cursor_column, 0, string_width(line));
+    new_cursor_column = util::clamp(
+        new_cursor_column, 0,
+        string_width(new_line.text->substr(new_line.begin,
+                                           new_line.end - new_line.begin)));
 
     if (new_cursor_column == cursor_column &&  //
-        new_cursor_line == cursor_line) {
+        new_line.offset + new_line.begin == line.offset + line.begin) {
       return false;
     }
 
-    // Convert back the new_cursor_{line,column} toward cursor_position:
-    cursor_position() = 0;
-    for (int i = 0; i < new_cursor_line; ++i) {
-      cursor_position() += lines[i].size() + 1;
-    }
+    // Convert back the new_cursor_column toward cursor_position:
+    size_t iter = new_line.begin;
     while (new_cursor_column > 0) {
-      new_cursor_column -= GlyphWidth(content(), cursor_position());
-      cursor_position() = GlyphNext(content(), cursor_position());
+      new_cursor_column -= GlyphWidth(*new_line.text, iter);
+      iter = GlyphNext(*new_line.text, iter);
     }
+    cursor_position() = new_line.offset + iter;
 
     on_change();
     return true;
@@ -532,9 +683,35 @@ class InputBase : public ComponentBase, public InputOption {
   }
 
   bool Focusable() const final { return true; }
+  int EventCategories() const final {
+    return KeyboardEvents | MouseButtonEvents | MouseMotionEvents;
+  }
+
+  // The edited text is counted, unless a TextBuffer holds it.
+  size_t MemoryUsage() const override {
+    size_t bytes = ComponentBase::MemoryUsage();
+    bytes += sizeof(InputBase) - sizeof(ComponentBase);
+    bytes += StringHeapBytes(placeholder());
+    if (!buffer) {
+      bytes += StringHeapBytes(content());
+    }
+    bytes += line_cache_.capacity() * sizeof(LineElement);
+    for (const LineElement& cached : line_cache_) {
+      bytes += StringHeapBytes(cached.line);
+    }
+    return bytes;
+  }
 
   bool hovered_ = false;
 
+  // The Elements of the lines, rendered by the previous frame.
+  struct LineElement {
+    std::string line;
+    bool password = false;
+    Element element;
+  };
+  std::vector<LineElement> line_cache_;
+
   Box box_;
   Box cursor_box_;
 };
@@ -8,9 +8,10 @@
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
 #include "ftxui/component/component_options.hpp"  // for InputOption
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowRightCtrl, Event::ArrowLeftCtrl, Event::ArrowLeft, Event::ArrowRight, Event::ArrowDown, Event::ArrowUp, Event::Delete, Event::Backspace, Event::Return, Event::End, Event::Home
+#include "ftxui/component/text_buffer.hpp"  // for TextBuffer
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Button, Mouse::Left, Mouse::Motion, Mouse::Pressed
 #include "ftxui/dom/elements.hpp"   // for Fit
-#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/node.hpp"       // for Render, NodesConstructed
 #include "ftxui/screen/screen.hpp"  // for Fixed, Screen, Pixel
 #include "ftxui/util/ref.hpp"       // for Ref
 #include "gtest/gtest.h"  // for AssertionResult, Message, TestPartResult, EXPECT_EQ, EXPECT_TRUE, Test, EXPECT_FALSE, TEST
@@ -60,6 +61,29 @@ TEST(InputTest, Type) {
   EXPECT_EQ(screen.PixelAt(1, 1).character, " ");
 }
 
+TEST(InputTest, Paste) {
+  std::string content = "ad";
+  int cursor_position = 1;
+  Component input = Input(&content, {
+                                        .cursor_position = &cursor_position,
+                                    });
+
+  input->OnEvent(Event::Paste("b\nc"));
+  EXPECT_EQ(content, "ab\ncd");
+  EXPECT_EQ(cursor_position, 4);
+
+  // Single line inputs drop the new lines.
+  content = "";
+  cursor_position = 0;
+  Component single_line = Input(&content, {
+                                              .multiline = false,
+                                              .cursor_position = &cursor_position,
+                                          });
+  single_line->OnEvent(Event::Paste("a\nb\n"));
+  EXPECT_EQ(content, "ab");
+  EXPECT_EQ(cursor_position, 2);
+}
+
 TEST(InputTest, ArrowLeftRight) {
   std::string content = "abc测测a测\na测\n";
   int cursor_position = 0;
@@ -591,6 +615,22 @@ TEST(InputTest, TypePassword) {
   EXPECT_EQ(screen.PixelAt(1, 0).character, "•");
 }
 
+#if !defined(FTXUI_NO_UNICODE_TABLES)
+TEST(InputTest, TypePasswordMultiByte) {
+  std::string content = "é测";
+  Component input = Input(&content, {.password = true});
+
+  // One mask per cell, instead of one per byte.
+  auto document = input->Render();
+  auto screen = Screen::Create(Dimension::Fixed(6), Dimension::Fixed(1));
+  Render(screen, document);
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "•");
+  EXPECT_EQ(screen.PixelAt(1, 0).character, "•");
+  EXPECT_EQ(screen.PixelAt(2, 0).character, "•");
+  EXPECT_EQ(screen.PixelAt(3, 0).character, " ");
+}
+#endif
+
 TEST(InputTest, MouseClick) {
   std::string content;
   int cursor_position = 0;
@@ -782,4 +822,149 @@ TEST(InputTest, InsertMode) {
   EXPECT_EQ(content, "axyz\nefgX");
 }
 
+TEST(InputTest, Buffer) {
+  // The same events are applied to an input editing a string, and to one
+  // editing a TextBuffer.
+  std::string content = "hello world\nfoo\n\nbar baz";
+  TextBuffer buffer(content);
+  int cursor_string = 0;
+  int cursor_buffer = 0;
+  Component input_string = Input(&content, {
+                                               .cursor_position = &cursor_string,
+                                           });
+  Component input_buffer = Input({
+      .buffer = &buffer,
+      .cursor_position = &cursor_buffer,
+  });
+
+  const Event events[] = {
+      Event::ArrowRightCtrl, Event::ArrowDown,     Event::ArrowDown,
+      Event::ArrowDown,      Event::Character('x'), Event::ArrowUp,
+      Event::Backspace,      Event::Backspace,      Event::ArrowLeftCtrl,
+      Event::Delete,         Event::Return,         Event::ArrowRight,
+      Event::End,            Event::Backspace,      Event::Home,
+      Event::ArrowDown,      Event::Paste("a\nb"), Event::ArrowLeft,
+  };
+  for (const Event& event : events) {
+    EXPECT_EQ(input_string->OnEvent(event), input_buffer->OnEvent(event));
+    EXPECT_EQ(buffer.str(), content);
+    EXPECT_EQ(cursor_buffer, cursor_string);
+  }
+
+  auto screen_string = Screen::Create(Dimension::Fixed(12), Dimension::Fixed(5));
+  auto screen_buffer = Screen::Create(Dimension::Fixed(12), Dimension::Fixed(5));
+  Render(screen_string, input_string->Render());
+  Render(screen_buffer, input_buffer->Render());
+  EXPECT_EQ(screen_buffer.ToString(), screen_string.ToString());
+
+  // Click on every cell.
+  for (int y = 0; y < 5; ++y) {
+    for (int x = 0; x < 12; ++x) {
+      Mouse mouse;
+      mouse.button = Mouse::Button::Left;
+      mouse.motion = Mouse::Motion::Pressed;
+      mouse.x = x;
+      mouse.y = y;
+      EXPECT_EQ(input_string->OnEvent(Event::Mouse("", mouse)),
+                input_buffer->OnEvent(Event::Mouse("", mouse)));
+      EXPECT_EQ(cursor_buffer, cursor_string);
+      Render(screen_string, input_string->Render());
+      Render(screen_buffer, input_buffer->Render());
+    }
+  }
+}
+
+TEST(InputTest, Virtualized) {
+  std::string content;
+  for (int i = 0; i < 1000; ++i) {
+    content += "line " + std::to_string(i) + "\n";
+  }
+  int cursor_position = content.find("line 500");
+  Component input = Input({
+      .content = &content,
+      .cursor_position = &cursor_position,
+  });
+  Component virtualized = Input({
+      .content = &content,
+      .virtualized = true,
+      .cursor_position = &cursor_position,
+  });
+
+  // The virtualized input displays the same thing.
+  auto screen = Screen::Create(Dimension::Fixed(10), Dimension::Fixed(3));
+  auto screen_virtualized =
+      Screen::Create(Dimension::Fixed(10), Dimension::Fixed(3));
+  Render(screen, input->Render());
+  Render(screen_virtualized, virtualized->Render());
+  EXPECT_EQ(screen_virtualized.ToString(), screen.ToString());
+  EXPECT_EQ(screen_virtualized.cursor().x, screen.cursor().x);
+  EXPECT_EQ(screen_virtualized.cursor().y, screen.cursor().y);
+  EXPECT_EQ(screen.PixelAt(5, 1).character, "5");
+
+  // Click on the line above the cursor.
+  Mouse mouse;
+  mouse.button = Mouse::Button::Left;
+  mouse.motion = Mouse::Motion::Pressed;
+  mouse.x = 2;
+  mouse.y = 0;
+  EXPECT_TRUE(virtualized->OnEvent(Event::Mouse("", mouse)));
+  EXPECT_EQ(cursor_position, (int)content.find("line 499") + 2);
+}
+
+TEST(InputTest, ReuseLines) {
+  std::string content;
+  for (int i = 0; i < 100; ++i) {
+    content += "line " + std::to_string(i) + "\n";
+  }
+  int cursor_position = 0;
+  Component input = Input({
+      .content = &content,
+      .cursor_position = &cursor_position,
+  });
+  auto screen = Screen::Create(Dimension::Fixed(10), Dimension::Fixed(3));
+  Render(screen, input->Render());
+
+  // Only the line holding the cursor is built again.
+  const size_t before = NodesConstructed();
+  Render(screen, input->Render());
+  EXPECT_LT(NodesConstructed() - before, size_t(50));
+
+  // The lines changed are built again.
+  content.replace(content.find("line 1"), 6, "edited");
+  Render(screen, input->Render());
+  EXPECT_EQ(screen.at(0, 1), "e");
+  EXPECT_EQ(screen.at(5, 1), "d");
+  EXPECT_EQ(screen.at(5, 2), "2");
+}
+
+TEST(InputTest, Keymap) {
+  std::string content = "abc";
+  int cursor_position = 3;
+  InputOption option;
+  option.content = &content;
+  option.cursor_position = &cursor_position;
+  // Emacs-like Ctrl+B, and Ctrl+H as backspace.
+  option.keymap.Bind(Event::Special({2}), InputAction::MoveLeft);
+  option.keymap.Bind(Event::Special({8}), InputAction::DeleteBackward);
+  option.keymap.Unbind(Event::Home);
+  Component input = Input(option);
+
+  EXPECT_TRUE(input->OnEvent(Event::Special({2})));
+  EXPECT_EQ(cursor_position, 2);
+  EXPECT_TRUE(input->OnEvent(Event::Special({8})));
+  EXPECT_EQ(content, "ac");
+  EXPECT_EQ(cursor_position, 1);
+
+  // The key unbound isn't handled anymore.
+  EXPECT_FALSE(input->OnEvent(Event::Home));
+  EXPECT_EQ(cursor_position, 1);
+
+  // A character bound to an action isn't inserted.
+  option.keymap.Bind(Event::Character('q'), InputAction::MoveEnd);
+  input = Input(option);
+  EXPECT_TRUE(input->OnEvent(Event::Character('q')));
+  EXPECT_EQ(content, "ac");
+  EXPECT_EQ(cursor_position, 2);
+}
+
 }  // namespace ftxui
@@ -0,0 +1,54 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/lazy.hpp"
+
+#include <utility>  // for move
+
+#include "ftxui/component/animation.hpp"  // for Clock
+#include "ftxui/component/event.hpp"      // for Event
+#include "ftxui/dom/elements.hpp"         // for Element
+
+namespace ftxui {
+
+LazyBase::LazyBase(ComponentFactory factory, LazyOption option)
+    : factory_(std::move(factory)), option_(std::move(option)) {}
+
+void LazyBase::Show() {
+  hidden_since_.reset();
+  if (!Built()) {
+    Add(factory_());
+  }
+}
+
+void LazyBase::Hide() {
+  if (!Built() || !option_.release_after) {
+    return;
+  }
+  const animation::TimePoint now = animation::Clock::now();
+  if (!hidden_since_) {
+    hidden_since_ = now;
+  }
+  if (now - *hidden_since_ >= *option_.release_after) {
+    DetachAllChildren();
+    hidden_since_.reset();
+  }
+}
+
+Element LazyBase::Render() {
+  Show();
+  return ComponentBase::Render();
+}
+
+bool LazyBase::OnEvent(Event event) {
+  Show();
+  return ComponentBase::OnEvent(std::move(event));
+}
+
+bool LazyBase::Focusable() const {
+  // Asked whether it can take the focus, the component is about to be shown.
+  const_cast<LazyBase*>(this)->Show();  // NOLINT
+  return ComponentBase::Focusable();
+}
+
+}  // namespace ftxui
@@ -0,0 +1,41 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_LAZY_HPP
+#define FTXUI_COMPONENT_LAZY_HPP
+
+#include <optional>  // for optional
+
+#include "ftxui/component/animation.hpp"       // for TimePoint
+#include "ftxui/component/component.hpp"       // for ComponentFactory
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for LazyOption
+#include "ftxui/dom/elements.hpp"                 // for Element
+
+namespace ftxui {
+
+// Holds the component built by |factory|, as its only child. It is built the
+// first time it is rendered, focused or sent an event. The parent calls Hide()
+// while it isn't shown, releasing it after |option.release_after|.
+class LazyBase : public ComponentBase {
+ public:
+  LazyBase(ComponentFactory factory, LazyOption option);
+
+  void Show();
+  void Hide();
+  bool Built() const { return ChildCount() != 0; }
+
+ private:
+  Element Render() override;
+  bool OnEvent(Event event) override;
+  bool Focusable() const override;
+  int EventCategories() const override { return 0; }
+
+  ComponentFactory factory_;
+  LazyOption option_;
+  std::optional<animation::TimePoint> hidden_since_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_LAZY_HPP */
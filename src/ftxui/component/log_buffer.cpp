@@ -0,0 +1,80 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/log_buffer.hpp"
+
+#include <algorithm>  // for max
+#include <mutex>      // for lock_guard
+#include <string>     // for string
+#include <utility>    // for move
+
+#include "ftxui/component/event.hpp"               // for Event, Event::Custom
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+/// @brief A log keeping the last |capacity| lines. The screen is not redrawn
+/// when lines are appended.
+LogBuffer::LogBuffer(size_t capacity) : capacity_(std::max<size_t>(1, capacity)) {}
+
+/// @brief A log keeping the last |capacity| lines. Appending lines redraws
+/// |screen|, at most once per frame.
+LogBuffer::LogBuffer(ScreenInteractive& screen, size_t capacity)
+    : screen_(&screen), capacity_(std::max<size_t>(1, capacity)) {}
+
+void LogBuffer::Append(std::string line) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    // The lines not published yet are bounded by the capacity as well.
+    if (pending_.size() == capacity_) {
+      pending_.pop_front();
+    }
+    pending_.push_back(std::move(line));
+    ++pending_appended_;
+    has_pending_ = true;
+    if (scheduled_ || !screen_) {
+      return;
+    }
+    scheduled_ = true;
+  }
+  screen_->PostEvent(Event::Custom);
+}
+
+size_t LogBuffer::size() {
+  Publish();
+  return ring_.size();
+}
+
+const std::string& LogBuffer::operator[](size_t index) {
+  Publish();
+  return ring_[(start_ + index) % ring_.size()];
+}
+
+size_t LogBuffer::appended() {
+  Publish();
+  return appended_;
+}
+
+// Move the pending lines into the ring buffer.
+void LogBuffer::Publish() {
+  if (!has_pending_) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (std::string& line : pending_) {
+    if (ring_.size() < capacity_) {
+      ring_.push_back(std::move(line));
+      continue;
+    }
+    // Replace the oldest line.
+    ring_[start_] = std::move(line);
+    start_ = (start_ + 1) % capacity_;
+  }
+  pending_.clear();
+  appended_ += pending_appended_;
+  pending_appended_ = 0;
+  has_pending_ = false;
+  scheduled_ = false;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,185 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>    // for max, min
+#include <cstddef>      // for size_t
+#include <string_view>  // for string_view
+
+#include "ftxui/component/component.hpp"       // for LogView, Make
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
+#include "ftxui/component/log_buffer.hpp"  // for LogBuffer
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
+#include "ftxui/dom/elements.hpp"  // for Element, reflect, vscroll_indicator, yframe
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::SELECTED
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Utf8Glyphs
+
+namespace ftxui {
+
+namespace {
+
+// The lines of the log. Its height is the number of lines kept, but only the
+// lines inside the stencil are drawn.
+class LogLines : public Node {
+ public:
+  LogLines(LogBuffer* log, Box selected_box)
+      : log_(log), size_(log->size()), selected_box_(selected_box) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 0;
+    requirement_.min_y = int(size_);
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.selection = Requirement::SELECTED;
+    requirement_.selected_box = selected_box_;
+  }
+
+  void Render(Screen& screen) override {
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    for (int y = y_min; y <= y_max; ++y) {
+      const size_t line = size_t(y - box_.y_min);
+      if (line >= size_) {
+        return;
+      }
+      int x = box_.x_min;
+      for (const std::string_view cell : Utf8Glyphs((*log_)[line])) {
+        if (x > box_.x_max) {
+          break;
+        }
+        if (cell == "\n") {
+          continue;
+        }
+        screen.PixelAt(x++, y).character = cell;
+      }
+    }
+  }
+
+ private:
+  LogBuffer* log_;
+  size_t size_;
+  Box selected_box_;
+};
+
+class LogViewBase : public ComponentBase {
+ public:
+  explicit LogViewBase(LogBuffer* log) : log_(log) {}
+
+ private:
+  Element Render() override {
+    Update();
+    const int page = Page();
+    const Box selected_box = {0, 0, top_, top_ + page - 1};
+    return MakeNode<LogLines>(log_, selected_box) | vscroll_indicator |
+           yframe | reflect(box_);
+  }
+
+  bool OnEvent(Event event) override {
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+    if (!Focused()) {
+      return false;
+    }
+    const int old_top = top_;
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      Scroll(-1);
+    }
+    if (event == Event::ArrowDown || event == Event::Character('j')) {
+      Scroll(1);
+    }
+    if (event == Event::PageUp) {
+      Scroll(-std::max(1, Page() - 1));
+    }
+    if (event == Event::PageDown) {
+      Scroll(std::max(1, Page() - 1));
+    }
+    if (event == Event::Home) {
+      Scroll(-top_);
+    }
+    if (event == Event::End) {
+      follow_ = true;
+      Update();
+    }
+    return top_ != old_top;
+  }
+
+  bool OnMouseEvent(Event event) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+    const int old_top = top_;
+    if (event.mouse().button == Mouse::WheelUp) {
+      Scroll(-3);
+    }
+    if (event.mouse().button == Mouse::WheelDown) {
+      Scroll(3);
+    }
+    return top_ != old_top;
+  }
+
+  // Move the view by |delta| lines. Reaching the end follows the new lines.
+  void Scroll(int delta) {
+    Update();
+    top_ = std::max(0, std::min(top_ + delta, MaxTop()));
+    follow_ = top_ == MaxTop();
+    first_ = log_->appended() - log_->size() + size_t(top_);
+  }
+
+  // Follow the new lines, or keep showing the same ones while they are kept.
+  void Update() {
+    if (follow_) {
+      top_ = MaxTop();
+    } else {
+      const size_t dropped = log_->appended() - log_->size();
+      top_ = int(std::max(first_, dropped) - dropped);
+      top_ = std::min(top_, MaxTop());
+    }
+    first_ = log_->appended() - log_->size() + size_t(top_);
+  }
+
+  int Page() const { return std::max(1, box_.y_max - box_.y_min + 1); }
+  int MaxTop() const { return std::max(0, int(log_->size()) - Page()); }
+
+  bool Focusable() const override { return true; }
+
+  LogBuffer* log_;
+  Box box_;
+  int top_ = 0;
+  size_t first_ = 0;  // The index of the first line shown, since the creation.
+  bool follow_ = true;
+};
+
+}  // namespace
+
+/// @brief A live tail of a LogBuffer. Only the visible lines are drawn.
+///
+/// The view follows the new lines, until it is scrolled up with the arrow
+/// keys, `j`/`k`, PageUp/PageDown, Home or the mouse wheel. It follows them
+/// again when scrolled to the end, or with End.
+/// @param log The lines to display. It must outlive the component.
+/// @ingroup component
+/// @see LogBuffer
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// LogBuffer log(screen, 10000);
+/// std::thread reader([&] {
+///   std::string line;
+///   while (std::getline(process_output, line)) {
+///     log.Append(line);
+///   }
+/// });
+/// screen.Loop(LogView(&log));
+/// ```
+Component LogView(LogBuffer* log) {
+  return Make<LogViewBase>(log);
+}
+
+}  // namespace ftxui
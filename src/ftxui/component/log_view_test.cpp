@@ -0,0 +1,139 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <thread>  // for thread
+
+#include "ftxui/component/component.hpp"       // for LogView, Renderer
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowUp, Event::End
+#include "ftxui/component/log_buffer.hpp"          // for LogBuffer
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+#include "ftxui/dom/node.hpp"                      // for Render
+#include "ftxui/screen/screen.hpp"                 // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// The characters drawn by |component|, without their style.
+std::string Draw(Component component, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, component->Render());
+  std::string out;
+  for (int y = 0; y < height; ++y) {
+    if (y) {
+      out += "\n";
+    }
+    for (int x = 0; x < width; ++x) {
+      out += screen.PixelAt(x, y).character;
+    }
+  }
+  return out;
+}
+
+void Append(LogBuffer& log, int begin, int end) {
+  for (int i = begin; i < end; ++i) {
+    log.Append("line " + std::to_string(i));
+  }
+}
+
+}  // namespace
+
+TEST(LogViewTest, RingBuffer) {
+  LogBuffer log(3);
+  EXPECT_EQ(log.size(), 0u);
+  Append(log, 0, 5);
+  EXPECT_EQ(log.size(), 3u);
+  EXPECT_EQ(log.appended(), 5u);
+  EXPECT_EQ(log[0], "line 2");
+  EXPECT_EQ(log[2], "line 4");
+
+  Append(log, 5, 7);
+  EXPECT_EQ(log[0], "line 4");
+  EXPECT_EQ(log[2], "line 6");
+  EXPECT_EQ(log.appended(), 7u);
+}
+
+TEST(LogViewTest, Follow) {
+  LogBuffer log(100);
+  auto view = LogView(&log);
+  Append(log, 0, 2);
+  EXPECT_EQ(Draw(view, 8, 3),
+            "line 0  \n"
+            "line 1  \n"
+            "        ");
+
+  Append(log, 2, 10);
+  EXPECT_EQ(Draw(view, 8, 3),
+            "line 7  \n"
+            "line 8  \n"
+            "line 9 ┃");
+}
+
+TEST(LogViewTest, ScrollUp) {
+  LogBuffer log(10);
+  auto view = LogView(&log);
+  Append(log, 0, 10);
+  Draw(view, 8, 3);
+
+  // Scrolling up stops following the new lines.
+  EXPECT_TRUE(view->OnEvent(Event::ArrowUp));
+  EXPECT_EQ(Draw(view, 8, 3),
+            "line 6  \n"
+            "line 7 ╻\n"
+            "line 8 ╹");
+  Append(log, 10, 12);
+  EXPECT_EQ(Draw(view, 8, 3),
+            "line 6  \n"
+            "line 7 ┃\n"
+            "line 8  ");
+
+  // The lines shown are dropped: the view shows the oldest ones.
+  Append(log, 12, 30);
+  EXPECT_EQ(Draw(view, 8, 3),
+            "line 20┃\n"
+            "line 21 \n"
+            "line 22 ");
+
+  // End follows the new lines again.
+  EXPECT_TRUE(view->OnEvent(Event::End));
+  Append(log, 30, 31);
+  EXPECT_EQ(Draw(view, 8, 3),
+            "line 28 \n"
+            "line 29 \n"
+            "line 30┃");
+}
+
+TEST(LogViewTest, BatchedRedraws) {
+  auto screen = ScreenInteractive::FitComponent();
+  LogBuffer log(screen, 10);
+  const int lines = 10000;
+
+  int frames = 0;
+  std::thread worker;
+  auto view = LogView(&log);
+  auto component = Renderer(view, [&] {
+    frames++;
+    if (!worker.joinable()) {
+      worker = std::thread([&] { Append(log, 0, lines); });
+    }
+    if (log.appended() == lines) {
+      screen.Exit();
+    }
+    return view->Render();
+  });
+
+  screen.Loop(component);
+  worker.join();
+
+  EXPECT_EQ(log.appended(), size_t(lines));
+  EXPECT_EQ(log[9], "line 9999");
+  EXPECT_LT(frames, lines);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -40,6 +40,29 @@ void Loop::RunOnce() {
   screen_->RunOnce(component_);
 }
 
+/// @brief Same as `Loop::RunOnce()`, but the tasks are handled until
+/// |deadline| is reached. The remaining ones are kept, and handled by the next
+/// run. The frame is drawn either way. This bounds the time spent by an
+/// application calling the loop from its own tick.
+/// @param deadline The time after which no more tasks are handled. At least
+/// one pending task is handled.
+/// @note The time is measured on the clock of the screen. A Headless() screen
+/// only advances it with `ScreenInteractive::HeadlessAdvanceTime()`.
+///
+/// ### Example
+///
+/// ```cpp
+/// while (!loop.HasQuitted()) {
+///   const auto tick = animation::Clock::now();
+///   UpdateGame();
+///   loop.RunOnce(tick + std::chrono::milliseconds(4));
+///   WaitForNextTick();
+/// }
+/// ```
+void Loop::RunOnce(animation::TimePoint deadline) {
+  screen_->RunOnce(component_, deadline);
+}
+
 /// @brief Wait for at least one event to be handled and execute
 /// `Loop::RunOnce()`.
 void Loop::RunOnceBlocking() {
@@ -54,4 +77,27 @@ void Loop::Run() {
   }
 }
 
+/// @brief The file descriptor receiving the terminal input. The loop must run
+/// once when it becomes readable.
+/// @see ScreenInteractive::ExternalEventLoop
+/// @return -1 when the input isn't read by an external event loop.
+int Loop::InputFileDescriptor() const {
+  return screen_->InputFileDescriptor();
+}
+
+/// @brief A file descriptor becoming readable when tasks are posted to the
+/// loop, or when a signal is received. The loop must run once then.
+/// @see ScreenInteractive::ExternalEventLoop
+/// @return -1 when the input isn't read by an external event loop.
+int Loop::WakeUpFileDescriptor() const {
+  return screen_->WakeUpFileDescriptor();
+}
+
+/// @brief The time at which the loop must run once, at the latest. This is
+/// used for animations and the escape sequences timeouts.
+/// @return The maximum TimePoint when there is none.
+animation::TimePoint Loop::NextDeadline() const {
+  return screen_->NextDeadline();
+}
+
 }  // namespace ftxui
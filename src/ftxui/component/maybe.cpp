@@ -31,6 +31,7 @@ Component Maybe(Component child, std::function<bool()> show) {
     bool Focusable() const override {
       return show_() && ComponentBase::Focusable();
     }
+    int EventCategories() const override { return 0; }
     bool OnEvent(Event event) override {
       return show_() && ComponentBase::OnEvent(event);
     }
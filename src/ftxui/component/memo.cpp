@@ -0,0 +1,133 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <utility>     // for move
+
+#include "ftxui/component/component.hpp"       // for ComponentDecorator, Memo, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/dom/elements.hpp"              // for Element, retained
+
+namespace ftxui {
+
+namespace {
+
+// Reuse the Element rendered by the child, until it is invalidated. |key| is
+// optional.
+class MemoImpl : public ComponentBase {
+ public:
+  explicit MemoImpl(std::function<size_t()> key) : key_(std::move(key)) {}
+
+ private:
+  Element Render() override {
+    const size_t key = key_ ? key_() : 0;
+    const bool focused = Focused();
+    if (!element_ || Invalidated() || key != previous_key_ ||
+        focused != previous_focused_) {
+      element_ = retained(ComponentBase::Render());
+      previous_key_ = key;
+      previous_focused_ = focused;
+      Validate();
+    }
+    return element_;
+  }
+
+  // The events reaching the child might change what it displays. While
+  // another component holds the mouse, the mouse events only change the child
+  // when it handles them, like a drag of the component holding it.
+  bool OnEvent(Event event) override {
+    if (event.is_mouse() && !CaptureMouse(event)) {
+      const bool handled = ComponentBase::OnEvent(std::move(event));
+      if (handled) {
+        Invalidate();
+      }
+      return handled;
+    }
+    Invalidate();
+    return ComponentBase::OnEvent(std::move(event));
+  }
+  int EventCategories() const override { return 0; }
+
+  std::function<size_t()> key_;
+  Element element_;
+  size_t previous_key_ = 0;
+  bool previous_focused_ = false;
+};
+
+}  // namespace
+
+/// @brief Decorate a component |child|. The Element it renders is reused,
+/// until Invalidate() is called on |child| or one of its descendants. The
+/// events received by |child| and the focus changes invalidate it too. When it
+/// is drawn at the same place, its pixels are reused too.
+/// @param child the component to decorate.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto table = Renderer([&] { return BuildHugeTable(data); });
+/// auto memo = Memo(table);
+/// // Later, from the loop thread:
+/// table->Invalidate();
+/// ```
+Component Memo(Component child) {
+  return Memo(std::move(child), nullptr);
+}
+
+/// @brief Decorate a component |child|. The Element it renders is reused, as
+/// long as |key| returns the same value, and it isn't invalidated. See
+/// Memo(child).
+/// @param child the component to decorate.
+/// @param key a function returning a value identifying what |child| displays.
+/// For instance a version number incremented on every change, or a hash of
+/// the state.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// int version = 0;
+/// auto table = Renderer([&] { return BuildHugeTable(data); });
+/// auto memo = Memo(table, [&] { return version; });
+/// ```
+Component Memo(Component child, std::function<size_t()> key) {
+  auto memo = Make<MemoImpl>(std::move(key));
+  memo->Add(std::move(child));
+  return memo;
+}
+
+/// @brief Decorate a component. The Element it renders is reused, until it is
+/// invalidated. See Memo(child).
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto component = Renderer([&] { return BuildHugeTable(data); }) | Memo();
+/// ```
+ComponentDecorator Memo() {
+  return [](Component child) { return Memo(std::move(child)); };
+}
+
+/// @brief Decorate a component. The Element it renders is reused, as long as
+/// |key| returns the same value and the focus didn't change.
+/// @param key a function returning a value identifying what the decorated
+/// component displays.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto component = Renderer([&] { return BuildHugeTable(data); })
+///                | Memo([&] { return version; });
+/// ```
+ComponentDecorator Memo(std::function<size_t()> key) {
+  return [key = std::move(key)](Component child) mutable {
+    return Memo(std::move(child), std::move(key));
+  };
+}
+
+}  // namespace ftxui
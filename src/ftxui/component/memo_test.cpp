@@ -0,0 +1,120 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/component/component.hpp"       // for Memo, Renderer, CatchEvent
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/dom/elements.hpp"              // for text, Element
+#include "ftxui/dom/node.hpp"                  // for Render
+#include "ftxui/screen/screen.hpp"             // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(MemoTest, ReuseElement) {
+  int render_count = 0;
+  int value = 0;
+  size_t version = 0;
+  auto component = Renderer([&] {
+                     render_count++;
+                     return text(std::to_string(value));
+                   }) |
+                   Memo([&] { return version; });
+
+  Element first = component->Render();
+  EXPECT_EQ(render_count, 1);
+
+  // The key didn't change, the previous element is reused.
+  value = 1;
+  EXPECT_EQ(component->Render(), first);
+  EXPECT_EQ(render_count, 1);
+
+  // Rendering the same element over multiple frames is supported.
+  for (int i = 0; i < 2; ++i) {
+    Screen screen(1, 1);
+    Render(screen, component->Render());
+    EXPECT_EQ(screen.ToString(), "0");
+  }
+
+  version++;
+  Screen screen(1, 1);
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "1");
+  EXPECT_EQ(render_count, 2);
+}
+
+TEST(MemoTest, FocusChange) {
+  int render_count = 0;
+  auto child = Renderer([&](bool focused) {
+    render_count++;
+    return text(focused ? "focused" : "unfocused");
+  });
+  auto memo = Memo(child, [] { return 0; });
+  auto other = Renderer([](bool) { return text("other"); });
+  auto container = Container::Vertical({memo, other});
+
+  container->Render();
+  container->Render();
+  EXPECT_EQ(render_count, 1);
+
+  other->TakeFocus();
+  container->Render();
+  EXPECT_EQ(render_count, 2);
+}
+
+TEST(MemoTest, Invalidate) {
+  int table_count = 0;
+  int clock_count = 0;
+  int time = 0;
+  auto table = Renderer([&] {
+    table_count++;
+    return text("table");
+  });
+  auto clock = Renderer([&] {
+    clock_count++;
+    return text(std::to_string(time));
+  });
+  auto root = Container::Vertical({Memo(table), Memo(clock)});
+
+  root->Render();
+  EXPECT_EQ(table_count, 1);
+  EXPECT_EQ(clock_count, 1);
+
+  // Only the invalidated component is rendered again.
+  time++;
+  clock->Invalidate();
+  root->Render();
+  EXPECT_EQ(table_count, 1);
+  EXPECT_EQ(clock_count, 2);
+
+  root->Render();
+  EXPECT_EQ(table_count, 1);
+  EXPECT_EQ(clock_count, 2);
+}
+
+TEST(MemoTest, InvalidatedByEvent) {
+  int render_count = 0;
+  bool handled = false;
+  auto child = Renderer([&] {
+                 render_count++;
+                 return text(handled ? "handled" : "");
+               }) |
+               CatchEvent([&](Event) { return handled = true; });
+  auto memo = Memo(child);
+
+  memo->Render();
+  memo->Render();
+  EXPECT_EQ(render_count, 1);
+
+  memo->OnEvent(Event::Character('a'));
+  Screen screen(7, 1);
+  Render(screen, memo->Render());
+  EXPECT_EQ(render_count, 2);
+  EXPECT_EQ(screen.ToString(), "handled");
+}
+
+}  // namespace ftxui
+// NOLINTEND
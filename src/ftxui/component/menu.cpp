@@ -7,6 +7,7 @@
 #include <functional>               // for function
 #include <memory>                   // for allocator_traits<>::value_type, swap
 #include <string>                   // for operator+, string
+#include <unordered_map>            // for unordered_map
 #include <utility>                  // for move
 #include <vector>                   // for vector, __alloc_traits<>::value_type
 
@@ -14,11 +15,12 @@
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/component.hpp"  // for Make, Menu, MenuEntry, Toggle
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
+#include "ftxui/component/entry.hpp"  // for Transform, MenuEntryTransform
 #include "ftxui/component/component_options.hpp"  // for MenuOption, MenuEntryOption, UnderlineOption, AnimatedColorOption, AnimatedColorsOption, EntryState
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return, Event::Tab, Event::TabReverse
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Released, Mouse::WheelDown, Mouse::WheelUp, Mouse::None
 #include "ftxui/component/screen_interactive.hpp"  // for Component
-#include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, Decorator, nothing, Elements, bgcolor, color, hbox, separatorHSelector, separatorVSelector, vbox, xflex, yflex, text, bold, focus, inverted, select
+#include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, Decorator, nothing, Elements, bgcolor, color, hbox, separatorHSelector, separatorVSelector, vbox, virtualList, xflex, yflex, text, bold, focus, inverted, select
 #include "ftxui/screen/box.hpp"    // for Box
 #include "ftxui/screen/color.hpp"  // for Color
 #include "ftxui/screen/util.hpp"   // for clamp
@@ -28,18 +30,6 @@ namespace ftxui {
 
 namespace {
 
-Element DefaultOptionTransform(const EntryState& state) {
-  std::string label = (state.active ? "> " : "  ") + state.label;  // NOLINT
-  Element e = text(std::move(label));
-  if (state.focused) {
-    e = e | inverted;
-  }
-  if (state.active) {
-    e = e | bold;
-  }
-  return e;
-}
-
 bool IsInverted(Direction direction) {
   switch (direction) {
     case Direction::Up:
@@ -97,13 +87,17 @@ class MenuBase : public ComponentBase, public MenuOption {
   }
 
   void OnAnimation(animation::Params& params) override {
+    bool running = animator_first_.running() || animator_second_.running();
     animator_first_.OnAnimation(params);
     animator_second_.OnAnimation(params);
-    for (auto& animator : animator_background_) {
-      animator.OnAnimation(params);
+    for (auto& it : animations_) {
+      running |= it.second.animator_background.running() ||
+                 it.second.animator_foreground.running();
+      it.second.animator_background.OnAnimation(params);
+      it.second.animator_foreground.OnAnimation(params);
     }
-    for (auto& animator : animator_foreground_) {
-      animator.OnAnimation(params);
+    if (running) {
+      Invalidate();
     }
   }
 
@@ -111,8 +105,12 @@ class MenuBase : public ComponentBase, public MenuOption {
     Clamp();
     UpdateAnimationTarget();
 
-    Elements elements;
     const bool is_menu_focused = Focused();
+    if (virtualized && !IsHorizontal()) {
+      return RenderVirtualized(is_menu_focused);
+    }
+
+    Elements elements;
     if (elements_prefix) {
       elements.push_back(elements_prefix());
     }
@@ -121,25 +119,7 @@ class MenuBase : public ComponentBase, public MenuOption {
       if (i != 0 && elements_infix) {
         elements.push_back(elements_infix());
       }
-      const bool is_focused = (focused_entry() == i) && is_menu_focused;
-      const bool is_selected = (selected() == i);
-
-      const EntryState state = {
-          entries[i],
-          false,
-          is_selected,
-          is_focused,
-      };
-
-      auto focus_management =
-          is_menu_focused && (selected_focus_ == i) ? focus : nothing;
-
-      const Element element =
-          (entries_option.transform ? entries_option.transform
-                                    : DefaultOptionTransform)  //
-          (state);
-      elements.push_back(element | AnimatedColorStyle(i) | reflect(boxes_[i]) |
-                         focus_management);
+      elements.push_back(RenderEntry(i, is_menu_focused));
     }
     if (elements_postfix) {
       elements.push_back(elements_postfix());
@@ -151,7 +131,72 @@ class MenuBase : public ComponentBase, public MenuOption {
 
     const Element bar =
         IsHorizontal() ? hbox(std::move(elements)) : vbox(std::move(elements));
+    return Decorate(bar);
+  }
+
+  // Only the entries visible on screen are built. Every entry, and every
+  // infix, is one cell tall.
+  Element RenderVirtualized(bool is_menu_focused) {
+    // The boxes of the entries that might not be displayed anymore:
+    for (const int i : rendered_) {
+      if (i < size()) {
+        boxes_[i] = Box();
+      }
+    }
+    rendered_.clear();
+
+    const int step = elements_infix ? 2 : 1;
+    const int rows = size() == 0 ? 0 : (size() - 1) * step + 1;
+    const bool inverted = IsInverted(direction);
+    auto row = [this, is_menu_focused, step, rows, inverted](int index) {
+      if (inverted) {
+        index = rows - 1 - index;
+      }
+      if (index % step) {
+        return elements_infix();
+      }
+      const int i = index / step;
+      rendered_.push_back(i);
+      return RenderEntry(i, is_menu_focused);
+    };
+    const int selected_row = inverted ? rows - 1 - selected_focus_ * step
+                                      : selected_focus_ * step;
+
+    Elements elements;
+    if (elements_prefix) {
+      elements.push_back(elements_prefix());
+    }
+    elements.push_back(virtualList(rows, std::move(row), selected_row));
+    if (elements_postfix) {
+      elements.push_back(elements_postfix());
+    }
+    if (inverted) {
+      std::reverse(elements.begin(), elements.end());
+    }
+    return Decorate(vbox(std::move(elements)));
+  }
+
+  Element RenderEntry(int i, bool is_menu_focused) {
+    const bool is_focused = (focused_entry() == i) && is_menu_focused;
+    const bool is_selected = (selected() == i);
+
+    const EntryState state = {
+        entries[i],
+        false,
+        is_selected,
+        is_focused,
+    };
+
+    auto focus_management =
+        is_menu_focused && (selected_focus_ == i) ? focus : nothing;
 
+    const Element element =
+        Transform(entries_option.transform, MenuEntryTransform, state);
+    return element | AnimatedColorStyle(i) | reflect(boxes_[i]) |
+           focus_management;
+  }
+
+  Element Decorate(Element bar) {
     if (!underline.enabled) {
       return bar | reflect(box_);
     }
@@ -236,7 +281,6 @@ class MenuBase : public ComponentBase, public MenuOption {
     }
   }
 
-  // NOLINTNEXTLINE(readability-function-cognitive-complexity)
   bool OnEvent(Event event) override {
     Clamp();
     if (!CaptureMouse(event)) {
@@ -247,39 +291,14 @@ class MenuBase : public ComponentBase, public MenuOption {
       return OnMouseEvent(event);
     }
 
-    if (Focused()) {
-      const int old_selected = selected();
-      if (event == Event::ArrowUp || event == Event::Character('k')) {
-        OnUp();
-      }
-      if (event == Event::ArrowDown || event == Event::Character('j')) {
-        OnDown();
-      }
-      if (event == Event::ArrowLeft || event == Event::Character('h')) {
-        OnLeft();
-      }
-      if (event == Event::ArrowRight || event == Event::Character('l')) {
-        OnRight();
-      }
-      if (event == Event::PageUp) {
-        selected() -= box_.y_max - box_.y_min;
-      }
-      if (event == Event::PageDown) {
-        selected() += box_.y_max - box_.y_min;
-      }
-      if (event == Event::Home) {
-        selected() = 0;
-      }
-      if (event == Event::End) {
-        selected() = size() - 1;
-      }
-      if (event == Event::Tab && size()) {
-        selected() = (selected() + 1) % size();
-      }
-      if (event == Event::TabReverse && size()) {
-        selected() = (selected() + size() - 1) % size();
-      }
+    const MenuAction* action = keymap.Find(event);
+    if (!action) {
+      return false;
+    }
 
+    if (Focused() && *action != MenuAction::Enter) {
+      const int old_selected = selected();
+      OnAction(*action);
       selected() = util::clamp(selected(), 0, size() - 1);
 
       if (selected() != old_selected) {
@@ -290,7 +309,7 @@ class MenuBase : public ComponentBase, public MenuOption {
       }
     }
 
-    if (event == Event::Return) {
+    if (*action == MenuAction::Enter) {
       OnEnter();
       return true;
     }
@@ -298,6 +317,47 @@ class MenuBase : public ComponentBase, public MenuOption {
     return false;
   }
 
+  void OnAction(MenuAction action) {
+    switch (action) {
+      case MenuAction::Up:
+        OnUp();
+        break;
+      case MenuAction::Down:
+        OnDown();
+        break;
+      case MenuAction::Left:
+        OnLeft();
+        break;
+      case MenuAction::Right:
+        OnRight();
+        break;
+      case MenuAction::PageUp:
+        selected() -= box_.y_max - box_.y_min;
+        break;
+      case MenuAction::PageDown:
+        selected() += box_.y_max - box_.y_min;
+        break;
+      case MenuAction::First:
+        selected() = 0;
+        break;
+      case MenuAction::Last:
+        selected() = size() - 1;
+        break;
+      case MenuAction::Next:
+        if (size()) {
+          selected() = (selected() + 1) % size();
+        }
+        break;
+      case MenuAction::Previous:
+        if (size()) {
+          selected() = (selected() + size() - 1) % size();
+        }
+        break;
+      case MenuAction::Enter:
+        break;
+    }
+  }
+
   bool OnMouseEvent(Event event) {
     if (event.mouse().button == Mouse::WheelDown ||
         event.mouse().button == Mouse::WheelUp) {
@@ -311,27 +371,44 @@ class MenuBase : public ComponentBase, public MenuOption {
     if (!CaptureMouse(event)) {
       return false;
     }
-    for (int i = 0; i < size(); ++i) {
-      if (!boxes_[i].Contain(event.mouse().x, event.mouse().y)) {
-        continue;
-      }
+    const int i = EntryAt(event.mouse().x, event.mouse().y);
+    if (i == -1) {
+      return false;
+    }
 
-      TakeFocus();
-      focused_entry() = i;
+    TakeFocus();
+    focused_entry() = i;
 
-      if (event.mouse().button == Mouse::Left &&
-          event.mouse().motion == Mouse::Pressed) {
-        if (selected() != i) {
-          selected() = i;
-          selected_previous_ = selected();
-          OnChange();
-        }
-        return true;
+    if (event.mouse().button == Mouse::Left &&
+        event.mouse().motion == Mouse::Pressed) {
+      if (selected() != i) {
+        selected() = i;
+        selected_previous_ = selected();
+        OnChange();
       }
+      return true;
     }
     return false;
   }
 
+  // Return the entry displayed at (x,y), -1 if none.
+  int EntryAt(int x, int y) {
+    if (virtualized && !IsHorizontal()) {
+      for (const int i : rendered_) {
+        if (i < size() && boxes_[i].Contain(x, y)) {
+          return i;
+        }
+      }
+      return -1;
+    }
+    for (int i = 0; i < size(); ++i) {
+      if (boxes_[i].Contain(x, y)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
   bool OnMouseWheel(Event event) {
     if (!box_.Contain(event.mouse().x, event.mouse().y)) {
       return false;
@@ -360,57 +437,74 @@ class MenuBase : public ComponentBase, public MenuOption {
   }
 
   void UpdateColorTarget() {
-    if (size() != int(animation_background_.size())) {
-      animation_background_.resize(size());
-      animation_foreground_.resize(size());
-      animator_background_.clear();
-      animator_foreground_.clear();
-
-      const int len = size();
-      animator_background_.reserve(len);
-      animator_foreground_.reserve(len);
-      for (int i = 0; i < len; ++i) {
-        animation_background_[i] = 0.F;
-        animation_foreground_[i] = 0.F;
-        animator_background_.emplace_back(&animation_background_[i], 0.F,
-                                          std::chrono::milliseconds(0),
-                                          animation::easing::Linear);
-        animator_foreground_.emplace_back(&animation_foreground_[i], 0.F,
-                                          std::chrono::milliseconds(0),
-                                          animation::easing::Linear);
+    // The animation state is only kept for the entries highlighted, or
+    // animating back to their default color.
+    for (auto it = animations_.begin(); it != animations_.end();) {
+      const EntryAnimation& animation = it->second;
+      const bool idle = animation.target == 0.F &&
+                        animation.background == 0.F &&
+                        animation.foreground == 0.F;
+      if (it->first >= size() || (ColorTarget(it->first) == 0.F && idle)) {
+        it = animations_.erase(it);
+      } else {
+        ++it;
       }
     }
+    if (size() != 0) {
+      animations_.try_emplace(selected());
+      animations_.try_emplace(focused_entry());
+    }
 
-    const bool is_menu_focused = Focused();
-    for (int i = 0; i < size(); ++i) {
-      const bool is_focused = (focused_entry() == i) && is_menu_focused;
-      const bool is_selected = (selected() == i);
-      float target = is_selected ? 1.F : is_focused ? 0.5F : 0.F;  // NOLINT
-      if (animator_background_[i].to() != target) {
-        animator_background_[i] = animation::Animator(
-            &animation_background_[i], target,
-            entries_option.animated_colors.background.duration,
-            entries_option.animated_colors.background.function);
-        animator_foreground_[i] = animation::Animator(
-            &animation_foreground_[i], target,
-            entries_option.animated_colors.foreground.duration,
-            entries_option.animated_colors.foreground.function);
+    for (auto& it : animations_) {
+      const float target = ColorTarget(it.first);
+      EntryAnimation& animation = it.second;
+      if (animation.target == target) {
+        continue;
+      }
+      // The disabled colors jump to their target, without requesting frames.
+      animation.target = target;
+      const auto& colors = entries_option.animated_colors;
+      if (colors.background.enabled) {
+        animation.animator_background = animation::Animator(
+            &animation.background, target, colors.background.duration,
+            colors.background.function);
+      } else {
+        animation.background = target;
+      }
+      if (colors.foreground.enabled) {
+        animation.animator_foreground = animation::Animator(
+            &animation.foreground, target, colors.foreground.duration,
+            colors.foreground.function);
+      } else {
+        animation.foreground = target;
       }
     }
   }
 
+  float ColorTarget(int i) {
+    const bool is_focused = (focused_entry() == i) && Focused();
+    const bool is_selected = (selected() == i);
+    return is_selected ? 1.F : is_focused ? 0.5F : 0.F;  // NOLINT
+  }
+
   Decorator AnimatedColorStyle(int i) {
+    const auto it = animations_.find(i);
+    const float background =
+        it == animations_.end() ? 0.F : it->second.background;
+    const float foreground =
+        it == animations_.end() ? 0.F : it->second.foreground;
+
     Decorator style = nothing;
     if (entries_option.animated_colors.foreground.enabled) {
       style = style | color(Color::Interpolate(
-                          animation_foreground_[i],
+                          foreground,
                           entries_option.animated_colors.foreground.inactive,
                           entries_option.animated_colors.foreground.active));
     }
 
     if (entries_option.animated_colors.background.enabled) {
       style = style | bgcolor(Color::Interpolate(
-                          animation_background_[i],
+                          background,
                           entries_option.animated_colors.background.inactive,
                           entries_option.animated_colors.background.active));
     }
@@ -447,6 +541,23 @@ class MenuBase : public ComponentBase, public MenuOption {
   }
 
   bool Focusable() const final { return entries.size(); }
+  int EventCategories() const final {
+    return KeyboardEvents | MouseButtonEvents | MouseMotionEvents;
+  }
+
+  // The boxes and the animations of the entries. The entries themselves are
+  // owned by the caller.
+  size_t MemoryUsage() const override {
+    size_t bytes = ComponentBase::MemoryUsage();
+    bytes += sizeof(MenuBase) - sizeof(ComponentBase);
+    bytes += boxes_.capacity() * sizeof(Box);
+    bytes += animations_.bucket_count() * sizeof(void*);
+    bytes += animations_.size() *
+             (sizeof(decltype(animations_)::value_type) + sizeof(void*));
+    bytes += rendered_.capacity() * sizeof(int);
+    return bytes;
+  }
+
   int size() const { return int(entries.size()); }
   float FirstTarget() {
     if (boxes_.empty()) {
@@ -478,10 +589,25 @@ class MenuBase : public ComponentBase, public MenuOption {
   float second_ = 0.F;
   animation::Animator animator_first_ = animation::Animator(&first_, 0.F);
   animation::Animator animator_second_ = animation::Animator(&second_, 0.F);
-  std::vector<animation::Animator> animator_background_;
-  std::vector<animation::Animator> animator_foreground_;
-  std::vector<float> animation_background_;
-  std::vector<float> animation_foreground_;
+  struct EntryAnimation {
+    EntryAnimation() = default;
+    EntryAnimation(const EntryAnimation&) = delete;
+    EntryAnimation(EntryAnimation&&) = delete;
+    EntryAnimation& operator=(const EntryAnimation&) = delete;
+    EntryAnimation& operator=(EntryAnimation&&) = delete;
+
+    float target = 0.F;
+    float background = 0.F;
+    float foreground = 0.F;
+    animation::Animator animator_background =
+        animation::Animator(&background, 0.F, std::chrono::milliseconds(0));
+    animation::Animator animator_foreground =
+        animation::Animator(&foreground, 0.F, std::chrono::milliseconds(0));
+  };
+  std::unordered_map<int, EntryAnimation> animations_;
+
+  // The entries built by the last virtualized Render.
+  std::vector<int> rendered_;
 };
 
 /// @brief A list of text. The focused element is selected.
@@ -632,9 +758,7 @@ Component MenuEntry(MenuEntryOption option) {
           focused,
       };
 
-      const Element element =
-          (transform ? transform : DefaultOptionTransform)  //
-          (state);
+      const Element element = Transform(transform, MenuEntryTransform, state);
 
       auto focus_management = focused ? select : nothing;
       return element | AnimatedColorStyle() | focus_management | reflect(box_);
@@ -643,15 +767,27 @@ Component MenuEntry(MenuEntryOption option) {
     void UpdateAnimationTarget() {
       const bool focused = Focused();
       float target = focused ? 1.F : hovered_ ? 0.5F : 0.F;  // NOLINT
-      if (target == animator_background_.to()) {
+      if (target == animation_target_) {
         return;
       }
-      animator_background_ = animation::Animator(
-          &animation_background_, target, animated_colors.background.duration,
-          animated_colors.background.function);
-      animator_foreground_ = animation::Animator(
-          &animation_foreground_, target, animated_colors.foreground.duration,
-          animated_colors.foreground.function);
+      // The disabled colors jump to their target, without requesting frames.
+      animation_target_ = target;
+      if (animated_colors.background.enabled) {
+        animator_background_ = animation::Animator(
+            &animation_background_, target,
+            animated_colors.background.duration,
+            animated_colors.background.function);
+      } else {
+        animation_background_ = target;
+      }
+      if (animated_colors.foreground.enabled) {
+        animator_foreground_ = animation::Animator(
+            &animation_foreground_, target,
+            animated_colors.foreground.duration,
+            animated_colors.foreground.function);
+      } else {
+        animation_foreground_ = target;
+      }
     }
 
     Decorator AnimatedColorStyle() {
@@ -673,6 +809,9 @@ Component MenuEntry(MenuEntryOption option) {
     }
 
     bool Focusable() const override { return true; }
+    int EventCategories() const override {
+      return MouseButtonEvents | MouseMotionEvents;
+    }
     bool OnEvent(Event event) override {
       if (!event.is_mouse()) {
         return false;
@@ -694,6 +833,9 @@ Component MenuEntry(MenuEntryOption option) {
     }
 
     void OnAnimation(animation::Params& params) override {
+      if (animator_background_.running() || animator_foreground_.running()) {
+        Invalidate();
+      }
       animator_background_.OnAnimation(params);
       animator_foreground_.OnAnimation(params);
     }
@@ -702,6 +844,7 @@ Component MenuEntry(MenuEntryOption option) {
     Box box_;
     bool hovered_ = false;
 
+    float animation_target_ = 0.F;
     float animation_background_ = 0.F;
     float animation_foreground_ = 0.F;
     animation::Animator animator_background_ =
@@ -6,6 +6,7 @@
 #include <ftxui/dom/direction.hpp>  // for Direction, Direction::Down, Direction::Left, Direction::Right, Direction::Up
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator
 #include <string>  // for string, basic_string
+#include <string_view>  // for string_view
 #include <vector>  // for vector
 
 #include "ftxui/component/animation.hpp"          // for Duration, Params
@@ -13,9 +14,11 @@
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for MenuOption
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"     // for text, yframe, operator|
 #include "ftxui/dom/node.hpp"         // for Render
 #include "ftxui/screen/screen.hpp"    // for Screen
-#include "ftxui/util/ref.hpp"         // for Ref
+#include "ftxui/util/ref.hpp"  // for Ref, ConstStringListRef
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -152,6 +155,7 @@ TEST(MenuTest, DirectionsLeft) {
   EXPECT_EQ(selected, 2);
 }
 
+#if !defined(FTXUI_NO_ANIMATIONS)
 TEST(MenuTest, AnimationsHorizontal) {
   int selected = 0;
   std::vector<std::string> entries = {"1", "2", "3"};
@@ -227,6 +231,119 @@ TEST(MenuTest, AnimationsVertical) {
         "    ");
   }
 }
+#endif
+
+TEST(MenuTest, Virtualized) {
+  int selected = 50000;
+  std::vector<std::string> entries;
+  for (int i = 0; i < 100000; ++i) {
+    entries.push_back(std::to_string(i));
+  }
+  MenuOption option;
+  option.virtualized = true;
+  auto menu = Menu(&entries, &selected, option);
+  Screen screen(7, 3);
+  Render(screen, menu->Render() | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "  49999\r\n"
+            "\x1B[1m> 50000\x1B[22m\r\n"
+            "  50001");
+}
+
+TEST(MenuTest, VirtualizedCallbacks) {
+  // The entries are read from the application's storage, without copying
+  // them into strings beforehand.
+  struct Process {
+    int pid;
+    std::string name;
+  };
+  std::vector<Process> processes;
+  for (int i = 0; i < 100000; ++i) {
+    processes.push_back({i, "p" + std::to_string(i)});
+  }
+  int reads = 0;
+  ConstStringListRef entries(
+      [&] { return processes.size(); },
+      [&](size_t i) -> std::string_view {
+        reads++;
+        return processes[i].name;
+      });
+
+  int selected = 50000;
+  MenuOption option;
+  option.virtualized = true;
+  auto menu = Menu(entries, &selected, option);
+  Screen screen(8, 3);
+  Render(screen, menu->Render() | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "  p49999\r\n"
+            "\x1B[1m> p50000\x1B[22m\r\n"
+            "  p50001");
+  EXPECT_LT(reads, 10);
+}
+
+TEST(MenuTest, VirtualizedSameAsDefault) {
+  std::vector<std::string> entries = {"1", "2", "3"};
+  for (const Direction direction : {Direction::Down, Direction::Up}) {
+    int selected = 1;
+    MenuOption option = MenuOption::Vertical();
+    option.direction = direction;
+    option.elements_infix = [] { return text("-"); };
+    auto menu = Menu(&entries, &selected, option);
+    option.virtualized = true;
+    auto virtualized = Menu(&entries, &selected, option);
+
+    Screen expected(4, 6);
+    Render(expected, menu->Render());
+    Screen screen(4, 6);
+    Render(screen, virtualized->Render());
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+}
+
+TEST(MenuTest, VirtualizedMouse) {
+  int selected = 0;
+  std::vector<std::string> entries;
+  for (int i = 0; i < 100; ++i) {
+    entries.push_back(std::to_string(i));
+  }
+  MenuOption option;
+  option.virtualized = true;
+  auto menu = Menu(&entries, &selected, option);
+  Screen screen(4, 3);
+  Render(screen, menu->Render() | yframe);
+
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.shift = false;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.x = 1;
+  mouse.y = 2;
+  EXPECT_TRUE(menu->OnEvent(Event::Mouse("", mouse)));
+  EXPECT_EQ(selected, 2);
+}
+
+TEST(MenuTest, Keymap) {
+  std::vector<std::string> entries = {"1", "2", "3"};
+  int selected = 0;
+  MenuOption option;
+  option.keymap.Unbind(Event::Character('j'));
+  option.keymap.Bind(Event::Character('n'), MenuAction::Down);
+  auto menu = Menu(&entries, &selected, option);
+
+  // The key unbound isn't handled anymore.
+  EXPECT_FALSE(menu->OnEvent(Event::Character('j')));
+  EXPECT_EQ(selected, 0);
+
+  EXPECT_TRUE(menu->OnEvent(Event::Character('n')));
+  EXPECT_EQ(selected, 1);
+  EXPECT_TRUE(menu->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(selected, 2);
+  EXPECT_TRUE(menu->OnEvent(Event::Home));
+  EXPECT_EQ(selected, 0);
+}
 
 }  // namespace ftxui
 // NOLINTEND
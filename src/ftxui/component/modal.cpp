@@ -2,12 +2,15 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <ftxui/component/event.hpp>  // for Event
-#include <ftxui/dom/elements.hpp>  // for operator|, Element, center, clear_under, dbox
+#include <ftxui/dom/elements.hpp>  // for operator|, Element, center, clear_under, dbox, cached, dim
+#include <cstddef>                 // for size_t
+#include <functional>              // for hash
 #include <memory>                  // for __shared_ptr_access, shared_ptr
 #include <utility>                 // for move
 
 #include "ftxui/component/component.hpp"  // for Make, Tab, ComponentDecorator, Modal
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/component_options.hpp"  // for ModalOption
 
 namespace ftxui {
 
@@ -15,29 +18,55 @@ namespace ftxui {
 // top of the other when |show_modal| is true.
 /// @ingroup component
 // NOLINTNEXTLINE
-Component Modal(Component main, Component modal, const bool* show_modal) {
+Component Modal(Component main,
+                Component modal,
+                const bool* show_modal,
+                ModalOption option) {
   class Impl : public ComponentBase {
    public:
-    explicit Impl(Component main, Component modal, const bool* show_modal)
+    explicit Impl(Component main,
+                  Component modal,
+                  const bool* show_modal,
+                  ModalOption option)
         : main_(std::move(main)),
           modal_(std::move(modal)),
-          show_modal_(show_modal) {
+          show_modal_(show_modal),
+          option_(option) {
       Add(Container::Tab({main_, modal_}, &selector_));
     }
 
    private:
     Element Render() override {
       selector_ = *show_modal_;
-      auto document = main_->Render();
-      if (*show_modal_) {
-        document = dbox({
-            document,
-            modal_->Render() | clear_under | center,
-        });
+      if (!*show_modal_) {
+        background_ = nullptr;
+        return main_->Render();
       }
-      return document;
+      return dbox({
+          RenderBackground(),
+          modal_->Render() | clear_under | center,
+      });
     }
 
+    // The main component, below the modal. With a snapshot, it is rendered
+    // when the modal is shown, and its pixels are copied afterward.
+    Element RenderBackground() {
+      if (option_.snapshot && background_) {
+        return background_ | cached(snapshot_key_);
+      }
+      Element document = main_->Render();
+      if (option_.dim) {
+        document |= dim;
+      }
+      if (!option_.snapshot) {
+        return document;
+      }
+      background_ = document;
+      snapshot_key_ = std::hash<const Impl*>()(this) * 31 + ++snapshots_;
+      return background_ | cached(snapshot_key_);
+    }
+
+    int EventCategories() const override { return 0; }
     bool OnEvent(Event event) override {
       selector_ = *show_modal_;
       return ComponentBase::OnEvent(event);
@@ -46,18 +75,24 @@ Component Modal(Component main, Component modal, const bool* show_modal) {
     Component main_;
     Component modal_;
     const bool* show_modal_;
+    const ModalOption option_;
     int selector_ = *show_modal_;
+    Element background_;
+    size_t snapshot_key_ = 0;
+    size_t snapshots_ = 0;
   };
-  return Make<Impl>(main, modal, show_modal);
+  return Make<Impl>(main, modal, show_modal, option);
 }
 
 // Decorate a component. Add a |modal| window on top of it. It is shown one on
 // the top of the other when |show_modal| is true.
 /// @ingroup component
 // NOLINTNEXTLINE
-ComponentDecorator Modal(Component modal, const bool* show_modal) {
-  return [modal, show_modal](Component main) {
-    return Modal(std::move(main), modal, show_modal);
+ComponentDecorator Modal(Component modal,
+                         const bool* show_modal,
+                         ModalOption option) {
+  return [modal, show_modal, option](Component main) {
+    return Modal(std::move(main), modal, show_modal, option);
   };
 }
 
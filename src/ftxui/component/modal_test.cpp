@@ -7,6 +7,7 @@
 
 #include "ftxui/component/component.hpp"       // for Renderer, Modal
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for ModalOption
 #include "ftxui/dom/node.hpp"                  // for Render
 #include "ftxui/screen/screen.hpp"             // for Screen
 
@@ -42,5 +43,51 @@ TEST(ModalTest, Basic) {
             "╰────────╯");
 }
 
+TEST(ModalTest, Snapshot) {
+  int renders = 0;
+  auto main = Renderer([&] {
+    renders++;
+    return text("main") | border;
+  });
+  auto modal = Renderer([] { return text("modal") | border; });
+  bool show_modal = false;
+  auto component = Modal(main, modal, &show_modal, {.snapshot = true});
+
+  Screen expected(10, 7);
+  Render(expected, Modal(main, modal, &show_modal)->Render());
+  show_modal = true;
+  Render(expected, Modal(main, modal, &show_modal)->Render());
+
+  // The main component is rendered once, when the modal is shown.
+  renders = 0;
+  for (int i = 0; i < 3; ++i) {
+    Screen screen(10, 7);
+    Render(screen, component->Render());
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+  EXPECT_EQ(renders, 1);
+
+  // And rendered every frame again, once it is hidden.
+  show_modal = false;
+  Screen screen(10, 7);
+  Render(screen, component->Render());
+  Render(screen, component->Render());
+  EXPECT_EQ(renders, 3);
+}
+
+TEST(ModalTest, Dim) {
+  auto main = Renderer([] { return text("main"); });
+  auto modal = Renderer([] { return text("modal"); });
+  bool show_modal = true;
+  for (const bool snapshot : {false, true}) {
+    auto component =
+        Modal(main, modal, &show_modal, {.snapshot = snapshot, .dim = true});
+    Screen screen(5, 3);
+    Render(screen, component->Render());
+    EXPECT_TRUE(screen.PixelAt(0, 0).dim);
+    EXPECT_FALSE(screen.PixelAt(0, 1).dim);
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -0,0 +1,224 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+//
+// Unlike the other fuzzers, this one hunts for the inputs making the rendering
+// slow, not for crashes. It builds a random DOM tree, and a random stream of
+// events for some components, and aborts when:
+// - The layout of a frame doesn't converge within the iterations allowed by
+//   Render(Screen&, Node*).
+// - A frame takes more time than a budget proportional to its number of nodes.
+//   This catches the super-linear layouts.
+//
+// The budget per node is read from the FTXUI_FUZZER_BUDGET_US environment
+// variable, in microseconds. The default one is generous, to leave room for
+// the sanitizers.
+#include <chrono>   // for microseconds, steady_clock
+#include <cstdio>   // for fprintf, stderr
+#include <cstdlib>  // for abort, getenv, atoi
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ftxui/component/component.hpp"  // for Input, Menu, Renderer, Container
+#include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/elements.hpp"  // for text, hbox, vbox, flexbox, gridbox
+#include "ftxui/dom/node.hpp"      // for Render, RenderStats, NodesConstructed
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+using namespace ftxui;
+namespace {
+
+// The iterations allowed by Render(Screen&, Node*).
+constexpr int kMaxLayoutIterations = 20;
+
+// The nodes generated at most, so that a single input stays fast.
+constexpr int kMaxNodes = 2000;
+
+// Every frame is given this much time, on top of its budget per node.
+constexpr auto kFrameBudget = std::chrono::milliseconds(5);
+
+std::chrono::microseconds BudgetPerNode() {
+  static const std::chrono::microseconds budget = [] {
+    const char* value = std::getenv("FTXUI_FUZZER_BUDGET_US");
+    const int us = value ? std::atoi(value) : 0;
+    return std::chrono::microseconds(us > 0 ? us : 50);
+  }();
+  return budget;
+}
+
+int GeneratorInt(const char*& data, size_t& size) {
+  if (size == 0) {
+    return 0;
+  }
+  auto out = int(static_cast<unsigned char>(data[0]));
+  data++;
+  size--;
+  return out;
+}
+
+std::string GeneratorString(const char*& data, size_t& size) {
+  const int length = GeneratorInt(data, size) % 32;
+  std::string out;
+  for (int i = 0; i < length; ++i) {
+    // Some words, separated by spaces, for the paragraphs to wrap.
+    const int c = GeneratorInt(data, size) % 27;
+    out += c == 26 ? ' ' : char('a' + c);
+  }
+  return out;
+}
+
+FlexboxConfig GeneratorFlexboxConfig(const char*& data, size_t& size) {
+  FlexboxConfig config;
+  config.Set(FlexboxConfig::Direction(GeneratorInt(data, size) % 4));
+  config.Set(FlexboxConfig::Wrap(GeneratorInt(data, size) % 3));
+  config.Set(FlexboxConfig::JustifyContent(GeneratorInt(data, size) % 7));
+  config.Set(FlexboxConfig::AlignItems(GeneratorInt(data, size) % 4));
+  config.Set(FlexboxConfig::AlignContent(GeneratorInt(data, size) % 7));
+  config.SetGap(GeneratorInt(data, size) % 4, GeneratorInt(data, size) % 4);
+  return config;
+}
+
+Element GeneratorElement(const char*& data,
+                         size_t& size,
+                         int depth,
+                         int& nodes);
+
+Elements GeneratorElements(const char*& data,
+                           size_t& size,
+                           int depth,
+                           int& nodes) {
+  Elements out;
+  const int count = GeneratorInt(data, size) % 16;
+  for (int i = 0; i < count && nodes < kMaxNodes; ++i) {
+    out.push_back(GeneratorElement(data, size, depth, nodes));
+  }
+  return out;
+}
+
+Element GeneratorElement(const char*& data,
+                         size_t& size,
+                         int depth,
+                         int& nodes) {
+  nodes++;
+  depth--;
+  const int value = GeneratorInt(data, size);
+  if (depth <= 0 || size == 0 || nodes >= kMaxNodes) {
+    return text(GeneratorString(data, size));
+  }
+
+  constexpr int value_max = 16;
+  switch (value % value_max) {
+    case 0:
+      return text(GeneratorString(data, size));
+    case 1:
+      return paragraph(GeneratorString(data, size));
+    case 2:
+      return hbox(GeneratorElements(data, size, depth, nodes));
+    case 3:
+      return vbox(GeneratorElements(data, size, depth, nodes));
+    case 4:
+      return dbox(GeneratorElements(data, size, depth, nodes));
+    case 5:
+      return flexbox(GeneratorElements(data, size, depth, nodes),
+                     GeneratorFlexboxConfig(data, size));
+    case 6: {
+      std::vector<Elements> lines;
+      const int count = GeneratorInt(data, size) % 8;
+      for (int i = 0; i < count && nodes < kMaxNodes; ++i) {
+        lines.push_back(GeneratorElements(data, size, depth, nodes));
+      }
+      return gridbox(std::move(lines));
+    }
+    case 7:
+      return border(GeneratorElement(data, size, depth, nodes));
+    case 8:
+      return flex(GeneratorElement(data, size, depth, nodes));
+    case 9:
+      return frame(GeneratorElement(data, size, depth, nodes));
+    case 10:
+      return GeneratorElement(data, size, depth, nodes) |
+             ftxui::size(WidthOrHeight(GeneratorInt(data, size) % 2),
+                         Constraint(GeneratorInt(data, size) % 3),
+                         GeneratorInt(data, size) % 64);
+    case 11:
+      return filler();
+    case 12:
+      return separator();
+    case 13:
+      return gauge(float(GeneratorInt(data, size)) / 255.F);
+    case 14:
+      return hflow(GeneratorElements(data, size, depth, nodes));
+    case 15:
+      return vflow(GeneratorElements(data, size, depth, nodes));
+    default:
+      return text("unreachable");
+  }
+}
+
+// Render |element| on |screen|, and abort when it took too long.
+void Check(Screen& screen, const Element& element, size_t nodes) {
+  RenderStats stats;
+  Render(screen, element.get(), &stats);
+
+  if (stats.layout_iterations >= kMaxLayoutIterations) {
+    std::fprintf(stderr, "The layout didn't converge in %d iterations.\n",
+                 stats.layout_iterations);
+    std::abort();
+  }
+
+  const auto budget = kFrameBudget + BudgetPerNode() * nodes;
+  const auto spent = stats.layout + stats.draw + stats.shader;
+  if (spent > budget) {
+    std::fprintf(
+        stderr, "A frame of %zu nodes took %lldus (%d iterations).\n", nodes,
+        static_cast<long long>(
+            std::chrono::duration_cast<std::chrono::microseconds>(spent)
+                .count()),
+        stats.layout_iterations);
+    std::abort();
+  }
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const char* data, size_t size) {
+  const int width = 1 + GeneratorInt(data, size) % 200;
+  const int height = 1 + GeneratorInt(data, size) % 100;
+  auto screen =
+      Screen::Create(Dimension::Fixed(width), Dimension::Fixed(height));
+
+  // A random DOM tree.
+  int generated = 0;
+  size_t constructed = NodesConstructed();
+  auto element = GeneratorElement(data, size, 12, generated);
+  Check(screen, element, NodesConstructed() - constructed);
+
+  // A random stream of events, over components rendering the tree.
+  std::string content;
+  std::vector<std::string> entries = {"entry_1", "entry_2", "entry_3"};
+  int selected = 0;
+  auto component = Container::Vertical({
+      Input(&content),
+      Menu(&entries, &selected),
+      Renderer([&] { return element; }),
+  });
+
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    for (size_t i = 0; i < size; ++i) {
+      parser.Add(data[i]);
+    }
+  }
+
+  Task event;
+  while (event_receiver->Receive(&event)) {
+    component->OnEvent(std::get<Event>(event));
+    constructed = NodesConstructed();
+    auto document = component->Render();
+    const size_t nodes = NodesConstructed() - constructed + size_t(generated);
+    screen.Clear();
+    Check(screen, document, nodes);
+  }
+  return 0;  // Non-zero return values are reserved for future use.
+}
@@ -0,0 +1,74 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <string>   // for string
+#include <utility>  // for move
+
+#include "ftxui/component/component.hpp"  // for ComponentDecorator, ProfileComponent, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/component_profiler.hpp"  // for ComponentProfiler
+#include "ftxui/component/event.hpp"               // for Event
+#include "ftxui/dom/elements.hpp"                  // for Element
+
+namespace ftxui {
+
+/// @brief Decorate a component |child|. The time spent in its Render() and
+/// OnEvent() is attributed to |name| by the current ComponentProfiler.
+/// @param child the component to decorate.
+/// @param name the name of the component in the reports.
+/// @ingroup component
+/// @see ComponentProfiler, ScreenInteractive::UseComponentProfiler
+///
+/// ### Example
+///
+/// ```cpp
+/// ComponentProfiler profiler;
+/// screen.UseComponentProfiler(&profiler);
+/// auto sidebar = ProfileComponent(Sidebar(), "sidebar");
+/// auto editor = ProfileComponent(Editor(), "editor");
+/// screen.Loop(Container::Horizontal({sidebar, editor}));
+/// std::cerr << profiler.FoldedStacks();
+/// ```
+Component ProfileComponent(Component child, std::string name) {
+  class Impl : public ComponentBase {
+   public:
+    explicit Impl(std::string name) : name_(std::move(name)) {}
+
+   private:
+    Element Render() override {
+      const ComponentProfiler::Timer timer(ComponentProfiler::Phase::Render,
+                                           name_);
+      return ComponentBase::Render();
+    }
+    bool OnEvent(Event event) override {
+      const ComponentProfiler::Timer timer(ComponentProfiler::Phase::Event,
+                                           name_);
+      return ComponentBase::OnEvent(std::move(event));
+    }
+    int EventCategories() const override { return 0; }
+
+    std::string name_;
+  };
+
+  auto impl = Make<Impl>(std::move(name));
+  impl->Add(std::move(child));
+  return impl;
+}
+
+/// @brief Decorate a component. The time spent in its Render() and OnEvent()
+/// is attributed to |name| by the current ComponentProfiler.
+/// @param name the name of the component in the reports.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto sidebar = Sidebar() | ProfileComponent("sidebar");
+/// ```
+ComponentDecorator ProfileComponent(std::string name) {
+  return [name = std::move(name)](Component child) {
+    return ProfileComponent(std::move(child), name);
+  };
+}
+
+}  // namespace ftxui
@@ -0,0 +1,68 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <string>   // for string
+#include <utility>  // for move
+
+#include "ftxui/component/component.hpp"  // for ComponentDecorator, ProfileNodes, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/dom/elements.hpp"              // for Element
+#include "ftxui/dom/node_profiler.hpp"         // for NodeProfiler
+
+namespace ftxui {
+
+/// @brief Decorate a component |child|. The Nodes created by its Render() are
+/// attributed to |name| by the current NodeProfiler. The Nodes created by a
+/// nested ProfileNodes are attributed to the nested one only.
+/// @param child the component to decorate.
+/// @param name the label of the Nodes.
+/// @ingroup component
+/// @see NodeProfiler, ScreenInteractive::UseNodeProfiler
+///
+/// ### Example
+///
+/// ```cpp
+/// NodeProfiler profiler;
+/// screen.UseNodeProfiler(&profiler);
+/// auto sidebar = ProfileNodes(Sidebar(), "sidebar");
+/// auto editor = ProfileNodes(Editor(), "editor");
+/// screen.Loop(Container::Horizontal({sidebar, editor}));
+/// std::cerr << profiler.ToString();
+/// ```
+Component ProfileNodes(Component child, std::string name) {
+  class Impl : public ComponentBase {
+   public:
+    explicit Impl(std::string name) : name_(std::move(name)) {}
+
+   private:
+    Element Render() override {
+      const NodeProfiler::Label label(name_);
+      return ComponentBase::Render();
+    }
+    int EventCategories() const override { return 0; }
+
+    std::string name_;
+  };
+
+  auto impl = Make<Impl>(std::move(name));
+  impl->Add(std::move(child));
+  return impl;
+}
+
+/// @brief Decorate a component. The Nodes created by its Render() are
+/// attributed to |name| by the current NodeProfiler.
+/// @param name the label of the Nodes.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto sidebar = Sidebar() | ProfileNodes("sidebar");
+/// ```
+ComponentDecorator ProfileNodes(std::string name) {
+  return [name = std::move(name)](Component child) {
+    return ProfileNodes(std::move(child), name);
+  };
+}
+
+}  // namespace ftxui
@@ -10,10 +10,11 @@
 #include "ftxui/component/component.hpp"          // for Make, Radiobox
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for RadioboxOption, EntryState
+#include "ftxui/component/entry.hpp"  // for Transform, RadioboxTransform
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return, Event::Tab, Event::TabReverse
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp, Mouse::Left, Mouse::Released
 #include "ftxui/component/screen_interactive.hpp"  // for Component
-#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, vbox, Elements, focus, nothing, select
+#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, vbox, Elements, focus, nothing, select, virtualList
 #include "ftxui/screen/box.hpp"   // for Box
 #include "ftxui/screen/util.hpp"  // for clamp
 #include "ftxui/util/ref.hpp"     // for Ref, ConstStringListRef
@@ -31,29 +32,51 @@ class RadioboxBase : public ComponentBase, public RadioboxOption {
  private:
   Element Render() override {
     Clamp();
-    Elements elements;
     const bool is_menu_focused = Focused();
+    if (virtualized) {
+      return RenderVirtualized(is_menu_focused);
+    }
+    Elements elements;
     elements.reserve(size());
     for (int i = 0; i < size(); ++i) {
-      const bool is_focused = (focused_entry() == i) && is_menu_focused;
-      const bool is_selected = (hovered_ == i);
-      auto focus_management = !is_selected      ? nothing
-                              : is_menu_focused ? focus
-                                                : select;
-      auto state = EntryState{
-          entries[i],
-          selected() == i,
-          is_selected,
-          is_focused,
-      };
-      auto element =
-          (transform ? transform : RadioboxOption::Simple().transform)(state);
-
-      elements.push_back(element | focus_management | reflect(boxes_[i]));
+      elements.push_back(RenderEntry(i, is_menu_focused));
     }
     return vbox(std::move(elements)) | reflect(box_);
   }
 
+  // Only the entries visible on screen are built.
+  Element RenderVirtualized(bool is_menu_focused) {
+    // The boxes of the entries that might not be displayed anymore:
+    for (const int i : rendered_) {
+      if (i < size()) {
+        boxes_[i] = Box();
+      }
+    }
+    rendered_.clear();
+
+    auto row = [this, is_menu_focused](int i) {
+      rendered_.push_back(i);
+      return RenderEntry(i, is_menu_focused);
+    };
+    return virtualList(size(), std::move(row), hovered_) | reflect(box_);
+  }
+
+  Element RenderEntry(int i, bool is_menu_focused) {
+    const bool is_focused = (focused_entry() == i) && is_menu_focused;
+    const bool is_selected = (hovered_ == i);
+    auto focus_management = !is_selected      ? nothing
+                            : is_menu_focused ? focus
+                                              : select;
+    auto state = EntryState{
+        entries[i],
+        selected() == i,
+        is_selected,
+        is_focused,
+    };
+    auto element = Transform(transform, RadioboxTransform, state);
+    return element | focus_management | reflect(boxes_[i]);
+  }
+
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
   bool OnEvent(Event event) override {
     Clamp();
@@ -116,24 +139,41 @@ class RadioboxBase : public ComponentBase, public RadioboxOption {
       return OnMouseWheel(event);
     }
 
-    for (int i = 0; i < size(); ++i) {
-      if (!boxes_[i].Contain(event.mouse().x, event.mouse().y)) {
-        continue;
+    const int i = EntryAt(event.mouse().x, event.mouse().y);
+    if (i == -1) {
+      return false;
+    }
+
+    TakeFocus();
+    focused_entry() = i;
+    if (event.mouse().button == Mouse::Left &&
+        event.mouse().motion == Mouse::Pressed) {
+      if (selected() != i) {
+        selected() = i;
+        on_change();
       }
 
-      TakeFocus();
-      focused_entry() = i;
-      if (event.mouse().button == Mouse::Left &&
-          event.mouse().motion == Mouse::Pressed) {
-        if (selected() != i) {
-          selected() = i;
-          on_change();
-        }
+      return true;
+    }
+    return false;
+  }
 
-        return true;
+  // Return the entry displayed at (x,y), -1 if none.
+  int EntryAt(int x, int y) {
+    if (virtualized) {
+      for (const int i : rendered_) {
+        if (i < size() && boxes_[i].Contain(x, y)) {
+          return i;
+        }
       }
+      return -1;
     }
-    return false;
+    for (int i = 0; i < size(); ++i) {
+      if (boxes_[i].Contain(x, y)) {
+        return i;
+      }
+    }
+    return -1;
   }
 
   bool OnMouseWheel(Event event) {
@@ -167,11 +207,17 @@ class RadioboxBase : public ComponentBase, public RadioboxOption {
   }
 
   bool Focusable() const final { return entries.size(); }
+  int EventCategories() const final {
+    return KeyboardEvents | MouseButtonEvents | MouseMotionEvents;
+  }
   int size() const { return int(entries.size()); }
 
   int hovered_ = selected();
   std::vector<Box> boxes_;
   Box box_;
+
+  // The entries built by the last virtualized Render.
+  std::vector<int> rendered_;
 };
 
 }  // namespace
@@ -4,6 +4,7 @@
 #include <string>   // for string
 #include <thread>   // for thread
 #include <utility>  // for move
+#include <vector>   // for vector
 
 #include "ftxui/component/receiver.hpp"
 #include "gtest/gtest.h"  // for AssertionResult, Message, Test, TestPartResult, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, TEST
@@ -78,5 +79,131 @@ TEST(Receiver, BasicWithThread) {
   t23.join();
 }
 
+TEST(Receiver, ReceiveAll) {
+  auto receiver = MakeReceiver<std::string>();
+  auto sender = receiver->MakeSender();
+
+  std::vector<std::string> out = {"prefix"};
+  EXPECT_FALSE(receiver->ReceiveAll(&out));
+
+  sender->Send("a");
+  sender->Send("b");
+  EXPECT_TRUE(receiver->HasPending());
+  EXPECT_TRUE(receiver->ReceiveAll(&out));
+  EXPECT_EQ(out, std::vector<std::string>({"prefix", "a", "b"}));
+  EXPECT_FALSE(receiver->HasPending());
+  EXPECT_FALSE(receiver->HasQuitted());
+
+  sender.reset();
+  EXPECT_TRUE(receiver->HasQuitted());
+}
+
+TEST(Receiver, NotDefaultConstructible) {
+  struct Value {
+    explicit Value(int v) : value(v) {}
+    int value;
+  };
+  auto receiver = MakeReceiver<Value>();
+  auto sender = receiver->MakeSender();
+  sender->Send(Value(1));
+  sender->Send(Value(2));
+  sender->Send(Value(3));
+
+  Value value(0);
+  EXPECT_TRUE(receiver->Receive(&value));
+  EXPECT_EQ(value.value, 1);
+  EXPECT_TRUE(receiver->ReceiveNonBlocking(&value));
+  EXPECT_EQ(value.value, 2);
+  std::vector<Value> out;
+  EXPECT_TRUE(receiver->ReceiveAll(&out));
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].value, 3);
+}
+
+TEST(Receiver, ManySenders) {
+  const int senders = 4;
+  const int values = 10000;
+  auto receiver = MakeReceiver<int>();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < senders; ++i) {
+    threads.emplace_back(
+        [i](Sender<int> sender) {
+          for (int j = 0; j < values; ++j) {
+            sender->Send(i * values + j);
+          }
+        },
+        receiver->MakeSender());
+  }
+
+  // The values of every sender are received in order.
+  std::vector<int> next(senders, 0);
+  int value = 0;
+  int received = 0;
+  while (receiver->Receive(&value)) {
+    const int sender = value / values;
+    EXPECT_EQ(value % values, next[sender]++);
+    received++;
+  }
+  EXPECT_EQ(received, senders * values);
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(Receiver, DropOldest) {
+  auto receiver = MakeReceiver<int>(3, ReceiverOverflow::DropOldest);
+  auto sender = receiver->MakeSender();
+  for (int i = 0; i < 5; ++i) {
+    sender->Send(i);
+  }
+  EXPECT_EQ(receiver->size(), 3u);
+  EXPECT_EQ(receiver->peak_size(), 3u);
+  EXPECT_EQ(receiver->dropped(), 2u);
+
+  std::vector<int> values;
+  EXPECT_TRUE(receiver->ReceiveAll(&values));
+  EXPECT_EQ(values, (std::vector<int>{2, 3, 4}));
+  EXPECT_EQ(receiver->size(), 0u);
+}
+
+TEST(Receiver, DropNewest) {
+  auto receiver = MakeReceiver<int>(3, ReceiverOverflow::DropNewest);
+  auto sender = receiver->MakeSender();
+  for (int i = 0; i < 5; ++i) {
+    sender->Send(i);
+  }
+  EXPECT_EQ(receiver->dropped(), 2u);
+
+  std::vector<int> values;
+  EXPECT_TRUE(receiver->ReceiveAll(&values));
+  EXPECT_EQ(values, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(Receiver, Block) {
+  const int values = 10000;
+  auto receiver = MakeReceiver<int>(4, ReceiverOverflow::Block);
+  std::thread producer(
+      [](Sender<int> sender) {
+        for (int i = 0; i < values; ++i) {
+          sender->Send(i);
+        }
+      },
+      receiver->MakeSender());
+
+  // The producer waits for the receiver: nothing is dropped, and the queue
+  // never holds more than its capacity.
+  int value = 0;
+  int received = 0;
+  while (receiver->Receive(&value)) {
+    EXPECT_EQ(value, received++);
+  }
+  producer.join();
+  EXPECT_EQ(received, values);
+  EXPECT_EQ(receiver->dropped(), 0u);
+  EXPECT_LE(receiver->peak_size(), 4u);
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -0,0 +1,226 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
+#include <deque>      // for deque
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/component/component.hpp"       // for Recycler, Make
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/component_options.hpp"  // for RecyclerOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
+#include "ftxui/dom/elements.hpp"  // for Element, Elements, reflect, vbox, yflex, yframe
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/terminal.hpp"  // for Size, Dimensions
+
+namespace ftxui {
+
+namespace {
+
+// The rows are a pool of components, as many as the rows visible at once. The
+// row |i| is drawn by the component |i % pool size|, so scrolling by one row
+// binds a single component to another row, and the selected one keeps its
+// state.
+class RecyclerBase : public ComponentBase, public RecyclerOption {
+ public:
+  explicit RecyclerBase(RecyclerOption option)
+      : RecyclerOption(std::move(option)) {}
+
+ private:
+  Element Render() override {
+    Update();
+    Elements rows;
+    for (int i = top_; i < top_ + Visible(); ++i) {
+      const size_t slot = Slot(i);
+      rows.push_back(children_[slot]->Render() | reflect(boxes_[slot]));
+    }
+    // The rows overflowing the box, before it is known, are clipped.
+    return vbox(std::move(rows)) | yframe | yflex | reflect(box_);
+  }
+
+  bool OnEvent(Event event) override {
+    Update();
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+    if (!Focused()) {
+      return false;
+    }
+
+    const Component active_child = ActiveChild();
+    if (active_child && active_child->Subscribes(event) &&
+        active_child->OnEvent(event)) {
+      return true;
+    }
+
+    const int old_selected = selected();
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      Select(selected() - 1);
+    }
+    if (event == Event::ArrowDown || event == Event::Character('j')) {
+      Select(selected() + 1);
+    }
+    if (event == Event::PageUp) {
+      Select(selected() - Page());
+    }
+    if (event == Event::PageDown) {
+      Select(selected() + Page());
+    }
+    if (event == Event::Home) {
+      Select(0);
+    }
+    if (event == Event::End) {
+      Select(Size() - 1);
+    }
+    return selected() != old_selected;
+  }
+
+  // The visible rows receive the mouse events, for them to notice the pointer
+  // leaving. The wheel moves the selection.
+  bool OnMouseEvent(Event event) {
+    for (int i = top_; i < top_ + Visible(); ++i) {
+      const Component& child = children_[Slot(i)];
+      if (child->Subscribes(event) && child->OnEvent(event)) {
+        return true;
+      }
+    }
+
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+    const int old_selected = selected();
+    if (event.mouse().button == Mouse::WheelUp) {
+      Select(selected() - 1);
+    }
+    if (event.mouse().button == Mouse::WheelDown) {
+      Select(selected() + 1);
+    }
+    return selected() != old_selected;
+  }
+
+  // The keyboard navigation and the mouse wheel.
+  int EventCategories() const override {
+    return KeyboardEvents | MouseButtonEvents;
+  }
+
+  Component ActiveChild() override {
+    if (children_.empty() || Size() == 0) {
+      return nullptr;
+    }
+    return children_[Slot(selected())];
+  }
+
+  void SetActiveChild(ComponentBase* child) override {
+    for (size_t i = 0; i < children_.size(); ++i) {
+      if (children_[i].get() == child) {
+        Select(indices_[i]);
+        return;
+      }
+    }
+  }
+
+  bool Focusable() const override { return Size() > 0; }
+
+  void Select(int index) {
+    selected() = index;
+    Update();
+  }
+
+  // Grow the pool to the rows visible at once, scroll to the selected row, and
+  // bind the components to the visible rows.
+  void Update() {
+    const int rows = Size();
+    selected() = std::max(0, std::min(rows - 1, selected()));
+
+    // The rows are assumed to be as tall as the tallest one drawn.
+    for (const Box& box : boxes_) {
+      row_height_ = std::max(row_height_, box.y_max - box.y_min + 1);
+    }
+
+    const int page = Page();
+    while (int(children_.size()) < std::min(rows, page)) {
+      indices_.push_back(-1);
+      boxes_.push_back({0, -1, 0, -1});
+      Add(row(&indices_.back()));
+    }
+
+    top_ = std::min(top_, selected());
+    top_ = std::max(top_, selected() - page + 1);
+    top_ = std::max(0, std::min(top_, rows - page));
+
+    bool rebound = false;
+    for (int i = top_; i < top_ + Visible(); ++i) {
+      int& index = indices_[Slot(i)];
+      rebound |= index != i;
+      index = i;
+    }
+    if (rebound) {
+      Invalidate();
+    }
+  }
+
+  // The number of rows fitting in the box. Before the first frame, the box is
+  // unknown, and the height of the terminal is used.
+  int Page() const {
+    const int height = box_.y_max - box_.y_min + 1;
+    if (height <= 0) {
+      return std::max(1, Terminal::Size().dimy);
+    }
+    return std::max(1, (height + row_height_ - 1) / row_height_);
+  }
+
+  int Size() const { return std::max(0, size()); }
+  int Visible() const {
+    return std::min({Size() - top_, Page(), int(children_.size())});
+  }
+  size_t Slot(int index) const { return size_t(index) % children_.size(); }
+
+  // The row bound to every component of the pool. A deque, so that the
+  // pointers given to the rows stay valid as it grows.
+  std::deque<int> indices_;
+  std::vector<Box> boxes_;
+  Box box_ = {0, -1, 0, -1};
+  int row_height_ = 1;
+  int top_ = 0;
+};
+
+}  // namespace
+
+namespace Container {
+
+/// @brief A vertical list of rows of components, built only for the rows
+/// visible at once. The rows are reused while scrolling, by binding them to
+/// other indices, so that the memory and the cost of the events don't depend
+/// on the number of rows.
+///
+/// The rows are navigated using the up/down arrow keys, 'j'/'k' keys,
+/// PageUp/PageDown, Home/End or the mouse wheel. The list takes the height it
+/// is given. Every row is expected to have the same height.
+/// @param option The number of rows, and how to build them.
+/// @ingroup component
+/// @see RecyclerOption
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<File> files = ListFiles();
+/// auto list = Container::Recycler({
+///     .size = int(files.size()),
+///     .row = [&](const int* index) {
+///       return Container::Horizontal({
+///           Button("Open", [&files, index] { Open(files[*index]); }),
+///           Renderer([&files, index] { return text(files[*index].name); }),
+///       });
+///     },
+/// });
+/// ```
+Component Recycler(RecyclerOption option) {
+  return Make<RecyclerBase>(std::move(option));
+}
+
+}  // namespace Container
+
+}  // namespace ftxui
@@ -0,0 +1,121 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/component/component.hpp"  // for Recycler, Renderer
+#include "ftxui/component/component_options.hpp"  // for RecyclerOption
+#include "ftxui/component/event.hpp"              // for Event
+#include "ftxui/dom/elements.hpp"                 // for text
+#include "ftxui/dom/node.hpp"                     // for Render
+#include "ftxui/screen/screen.hpp"                // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Component RecyclerCountingRows(int size, int* selected, int* built) {
+  return Container::Recycler({
+      .size = size,
+      .row =
+          [built](const int* index) {
+            ++*built;
+            return Renderer([index](bool focused) {
+              return text((focused ? ">" : " ") + std::to_string(*index));
+            });
+          },
+      .selected = selected,
+  });
+}
+
+std::string RenderToString(Component component) {
+  Screen screen(6, 3);
+  Render(screen, component->Render());
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(RecyclerTest, OnlyVisibleRowsAreBuilt) {
+  int selected = 0;
+  int built = 0;
+  auto recycler = RecyclerCountingRows(100000, &selected, &built);
+  RenderToString(recycler);
+  EXPECT_EQ(RenderToString(recycler),
+            ">0    \r\n"
+            " 1    \r\n"
+            " 2    ");
+  const int pool = built;
+  EXPECT_LT(pool, 1000);
+
+  EXPECT_TRUE(recycler->OnEvent(Event::End));
+  EXPECT_EQ(selected, 99999);
+  EXPECT_EQ(RenderToString(recycler),
+            " 99997\r\n"
+            " 99998\r\n"
+            ">99999");
+  EXPECT_EQ(built, pool);
+}
+
+TEST(RecyclerTest, SelectionScrolls) {
+  int selected = 0;
+  int built = 0;
+  auto recycler = RecyclerCountingRows(10, &selected, &built);
+  RenderToString(recycler);
+  RenderToString(recycler);
+
+  EXPECT_TRUE(recycler->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(recycler->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(recycler->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(selected, 3);
+  EXPECT_EQ(RenderToString(recycler),
+            " 1    \r\n"
+            " 2    \r\n"
+            ">3    ");
+
+  EXPECT_TRUE(recycler->OnEvent(Event::PageUp));
+  EXPECT_EQ(selected, 0);
+  EXPECT_FALSE(recycler->OnEvent(Event::ArrowUp));
+  EXPECT_EQ(RenderToString(recycler),
+            ">0    \r\n"
+            " 1    \r\n"
+            " 2    ");
+}
+
+TEST(RecyclerTest, FocusFollowsTheRow) {
+  int selected = 0;
+  int built = 0;
+  auto recycler = RecyclerCountingRows(10, &selected, &built);
+  RenderToString(recycler);
+  RenderToString(recycler);
+
+  // The focus is given to a row through its component.
+  recycler->ChildAt(2)->TakeFocus();
+  EXPECT_EQ(selected, 2);
+
+  // The selected row stays focused, while the others are rebound.
+  EXPECT_TRUE(recycler->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(recycler->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(selected, 4);
+  EXPECT_EQ(RenderToString(recycler),
+            " 2    \r\n"
+            " 3    \r\n"
+            ">4    ");
+  EXPECT_EQ(recycler->ActiveChild(), recycler->ChildAt(4 % built));
+}
+
+TEST(RecyclerTest, Empty) {
+  int selected = 3;
+  int built = 0;
+  auto recycler = RecyclerCountingRows(0, &selected, &built);
+  EXPECT_FALSE(recycler->Focusable());
+  EXPECT_EQ(recycler->ActiveChild(), nullptr);
+  RenderToString(recycler);
+  EXPECT_EQ(built, 0);
+  EXPECT_EQ(selected, 0);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,129 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <utility>  // for move
+
+#include "ftxui/component/animation.hpp"  // for RequestAnimationFrame
+#include "ftxui/component/component.hpp"  // for ComponentDecorator, RenderWhenVisible, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/dom/elements.hpp"              // for Element
+#include "ftxui/dom/node.hpp"                  // for Node
+#include "ftxui/dom/node_arena.hpp"            // for MakeNode
+#include "ftxui/dom/requirement.hpp"           // for Requirement
+#include "ftxui/screen/box.hpp"                // for Box
+#include "ftxui/screen/screen.hpp"             // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// What the last frame told about an element.
+struct Visibility {
+  Requirement requirement;
+  bool measured = false;
+  bool visible = true;
+};
+
+// Record the requirement of |child|, and whether it was drawn inside the
+// stencil. Without |child|, it is a placeholder taking the recorded
+// requirement.
+class VisibilityNode : public Node {
+ public:
+  VisibilityNode(Elements children, Visibility* visibility)
+      : Node(std::move(children)), visibility_(visibility) {}
+
+  void ComputeRequirement() final {
+    if (children_.empty()) {
+      requirement_ = visibility_->requirement;
+      return;
+    }
+    Node::ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+    visibility_->requirement = requirement_;
+    visibility_->measured = true;
+  }
+
+  void SetBox(Box box) final {
+    // Until drawn. It may be culled by its parent.
+    visibility_->visible = false;
+    Node::SetBox(box);
+    if (!children_.empty()) {
+      children_[0]->UpdateBox(box);
+    }
+  }
+
+  void Render(Screen& screen) final {
+    const Box visible = Box::Intersection(box_, screen.stencil);
+    visibility_->visible =
+        visible.x_min <= visible.x_max && visible.y_min <= visible.y_max;
+    if (!children_.empty()) {
+      Node::Render(screen);
+      return;
+    }
+    // The placeholder came into view. Draw the real element on the next frame.
+    if (visibility_->visible) {
+      animation::RequestAnimationFrame();
+    }
+  }
+
+ private:
+  Visibility* visibility_;
+};
+
+}  // namespace
+
+/// @brief Decorate a component |child|. It is only rendered when it was
+/// visible on the previous frame. Otherwise, for instance when it was scrolled
+/// out of a `frame`, it is replaced by an empty element of the same size,
+/// without calling |child|'s Render().
+///
+/// The component is always rendered while it contains the focus. When a
+/// placeholder comes into view, a new frame is requested to draw |child|.
+/// @param child the component to decorate.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// Components rows;
+/// for (auto& item : items) {
+///   rows.push_back(RenderWhenVisible(ItemComponent(item)));
+/// }
+/// auto list = Renderer(Container::Vertical(rows), [&] {
+///   return vbox(...) | vscroll_indicator | frame;
+/// });
+/// ```
+Component RenderWhenVisible(Component child) {
+  class Impl : public ComponentBase {
+   private:
+    Element Render() override {
+      if (visibility_.measured && !visibility_.visible && !Focused()) {
+        return MakeNode<VisibilityNode>(Elements(), &visibility_);
+      }
+      return MakeNode<VisibilityNode>(
+          Elements{ComponentBase::Render()}, &visibility_);
+    }
+    int EventCategories() const override { return 0; }
+
+    Visibility visibility_;
+  };
+
+  auto impl = Make<Impl>();
+  impl->Add(std::move(child));
+  return impl;
+}
+
+/// @brief Decorate a component. It is only rendered when it was visible on the
+/// previous frame.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto row = ItemComponent(item) | RenderWhenVisible();
+/// ```
+ComponentDecorator RenderWhenVisible() {
+  return [](Component child) { return RenderWhenVisible(std::move(child)); };
+}
+
+}  // namespace ftxui
@@ -0,0 +1,69 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/component/component.hpp"  // for RenderWhenVisible, Renderer, Vertical
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/dom/elements.hpp"              // for text, frame, Element
+#include "ftxui/dom/node.hpp"                  // for Render
+#include "ftxui/screen/screen.hpp"             // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Component Rows(int* render_count) {
+  auto container = Container::Vertical({});
+  for (int i = 0; i < 10; ++i) {
+    container->Add(Renderer([i, render_count] {
+                     (*render_count)++;
+                     return text(std::to_string(i));
+                   }) |
+                   RenderWhenVisible());
+  }
+  return container;
+}
+
+}  // namespace
+
+TEST(RenderWhenVisibleTest, CullHiddenRows) {
+  int render_count = 0;
+  auto rows = Rows(&render_count);
+
+  Screen screen(1, 3);
+  Render(screen, rows->Render() | frame);
+  EXPECT_EQ(render_count, 10);
+  EXPECT_EQ(screen.ToString(), "0\r\n1\r\n2");
+
+  // The rows outside of the frame are replaced by placeholders.
+  render_count = 0;
+  Render(screen, rows->Render() | frame);
+  EXPECT_EQ(render_count, 3);
+  EXPECT_EQ(screen.ToString(), "0\r\n1\r\n2");
+}
+
+TEST(RenderWhenVisibleTest, PlaceholderComingIntoView) {
+  int render_count = 0;
+  auto rows = Rows(&render_count);
+
+  Screen small(1, 3);
+  Render(small, rows->Render() | frame);
+
+  // The placeholders keep the size of the rows they replace. They become
+  // visible, and are drawn by the next frame.
+  Screen large(1, 10);
+  Render(large, rows->Render() | frame);
+  EXPECT_EQ(large.ToString(), "0\r\n1\r\n2\r\n \r\n \r\n \r\n \r\n \r\n \r\n ");
+
+  render_count = 0;
+  large.Clear();
+  Render(large, rows->Render() | frame);
+  EXPECT_EQ(render_count, 10);
+  EXPECT_EQ(large.ToString(), "0\r\n1\r\n2\r\n3\r\n4\r\n5\r\n6\r\n7\r\n8\r\n9");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -34,6 +34,7 @@ Component Renderer(std::function<Element()> render) {
     explicit Impl(std::function<Element()> render)
         : render_(std::move(render)) {}
     Element Render() override { return render_(); }
+    int EventCategories() const override { return 0; }
     std::function<Element()> render_;
   };
 
@@ -92,6 +93,9 @@ Component Renderer(std::function<Element(bool)> render) {
    private:
     Element Render() override { return render_(Focused()) | reflect(box_); }
     bool Focusable() const override { return true; }
+    int EventCategories() const override {
+      return MouseButtonEvents | MouseMotionEvents;
+    }
     bool OnEvent(Event event) override {
       if (event.is_mouse() && box_.Contain(event.mouse().x, event.mouse().y)) {
         if (!CaptureMouse(event)) {
@@ -8,6 +8,7 @@
 #include <memory>   // for __shared_ptr_access, shared_ptr, allocator
 #include <utility>  // for move
 
+#include "ftxui/component/animation.hpp"       // for Params
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/component.hpp"  // for Horizontal, Make, ResizableSplit, ResizableSplitBottom, ResizableSplitLeft, ResizableSplitRight, ResizableSplitTop
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
@@ -29,13 +30,24 @@ class ResizableSplitBase : public ComponentBase {
     }));
   }
 
+  int EventCategories() const final {
+    return MouseButtonEvents | MouseMotionEvents;
+  }
+
   bool OnEvent(Event event) final {
     if (event.is_mouse()) {
       return OnMouseEvent(std::move(event));
     }
+    // The panes might display something else.
+    Invalidate();
     return ComponentBase::OnEvent(std::move(event));
   }
 
+  void OnAnimation(animation::Params& params) final {
+    Invalidate();
+    ComponentBase::OnAnimation(params);
+  }
+
   bool OnMouseEvent(Event event) {
     if (captured_mouse_ && event.mouse().motion == Mouse::Released) {
       captured_mouse_.reset();
@@ -74,6 +86,7 @@ class ResizableSplitBase : public ComponentBase {
   }
 
   Element Render() final {
+    RenderPanes();
     switch (options_->direction()) {
       case Direction::Left:
         return RenderLeft();
@@ -88,42 +101,51 @@ class ResizableSplitBase : public ComponentBase {
     return text("unreacheable");
   }
 
+  // While the separator is dragged, the panes reuse the Element they rendered
+  // before. Only their layout is done again, with the new size.
+  // They are rendered again when Invalidate() is called on them, or when an
+  // event or an animation frame reaches them.
+  void RenderPanes() {
+    if (captured_mouse_ && main_element_ && !Invalidated()) {
+      return;
+    }
+    main_element_ = options_->main->Render();
+    back_element_ = options_->back->Render();
+    Validate();
+  }
+
   Element RenderLeft() {
     return hbox({
-               options_->main->Render() |
-                   size(WIDTH, EQUAL, options_->main_size()),
+               main_element_ | size(WIDTH, EQUAL, options_->main_size()),
                options_->separator_func() | reflect(separator_box_),
-               options_->back->Render() | xflex,
+               back_element_ | xflex,
            }) |
            reflect(box_);
   }
 
   Element RenderRight() {
     return hbox({
-               options_->back->Render() | xflex,
+               back_element_ | xflex,
                options_->separator_func() | reflect(separator_box_),
-               options_->main->Render() |
-                   size(WIDTH, EQUAL, options_->main_size()),
+               main_element_ | size(WIDTH, EQUAL, options_->main_size()),
            }) |
            reflect(box_);
   }
 
   Element RenderTop() {
     return vbox({
-               options_->main->Render() |
-                   size(HEIGHT, EQUAL, options_->main_size()),
+               main_element_ | size(HEIGHT, EQUAL, options_->main_size()),
                options_->separator_func() | reflect(separator_box_),
-               options_->back->Render() | yflex,
+               back_element_ | yflex,
            }) |
            reflect(box_);
   }
 
   Element RenderBottom() {
     return vbox({
-               options_->back->Render() | yflex,
+               back_element_ | yflex,
                options_->separator_func() | reflect(separator_box_),
-               options_->main->Render() |
-                   size(HEIGHT, EQUAL, options_->main_size()),
+               main_element_ | size(HEIGHT, EQUAL, options_->main_size()),
            }) |
            reflect(box_);
   }
@@ -133,6 +155,8 @@ class ResizableSplitBase : public ComponentBase {
   CapturedMouse captured_mouse_;
   Box separator_box_;
   Box box_;
+  Element main_element_;
+  Element back_element_;
 };
 
 }  // namespace
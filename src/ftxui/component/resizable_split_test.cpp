@@ -207,5 +207,38 @@ TEST(ResizableSplit, BasicBottomWithCustomSeparator) {
   EXPECT_EQ(position, 2);
 }
 
+TEST(ResizableSplit, DragReusesPanes) {
+  int renders = 0;
+  auto pane = [&] {
+    return Renderer([&] {
+      renders++;
+      return text("pane");
+    });
+  };
+  int position = 3;
+  auto component = ResizableSplitLeft(pane(), pane(), &position);
+  auto screen = Screen(20, 1);
+  Render(screen, component->Render());
+  EXPECT_EQ(renders, 2);
+
+  // While dragging, the panes are only laid out again.
+  EXPECT_TRUE(component->OnEvent(MousePressed(3, 0)));
+  Render(screen, component->Render());
+  EXPECT_EQ(renders, 2);
+  EXPECT_TRUE(component->OnEvent(MousePressed(10, 0)));
+  Render(screen, component->Render());
+  EXPECT_EQ(renders, 2);
+  EXPECT_EQ(screen.PixelAt(11, 0).character, "p");
+
+  // Another event reaching the panes renders them again.
+  component->OnEvent(Event::Character('a'));
+  Render(screen, component->Render());
+  EXPECT_EQ(renders, 4);
+
+  EXPECT_TRUE(component->OnEvent(MouseReleased(10, 0)));
+  Render(screen, component->Render());
+  EXPECT_EQ(renders, 6);
+}
+
 }  // namespace ftxui
 // NOLINTEND
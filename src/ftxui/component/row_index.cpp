@@ -0,0 +1,191 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/row_index.hpp"
+
+#include <algorithm>  // for sort, remove_if
+#include <cstddef>    // for size_t
+#include <mutex>      // for lock_guard, unique_lock
+#include <utility>    // for move, swap
+#include <vector>     // for vector
+
+#include "ftxui/component/event.hpp"               // for Event, Event::Custom
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+/// @brief An index of |rows| rows, computed on the calling thread.
+RowIndex::RowIndex(size_t rows) : rows_(rows) {
+  Apply({Job::Full, rows_, nullptr, nullptr}, order_, nullptr);
+}
+
+/// @brief An index of |rows| rows, computed on a background thread. The
+/// |screen| is redrawn when a new index is computed. With
+/// FTXUI_ENABLE_THREADS=OFF, it is computed on the calling thread.
+RowIndex::RowIndex(ScreenInteractive& screen, size_t rows)
+    : screen_(&screen), rows_(rows) {
+  Apply({Job::Full, rows_, nullptr, nullptr}, order_, nullptr);
+  computed_ = order_;
+#if !defined(FTXUI_NO_THREADS)
+  thread_ = std::thread([this] { Run(); });
+#endif
+}
+
+RowIndex::~RowIndex() {
+  if (!thread_.joinable()) {
+    return;
+  }
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    cancel_ = true;
+  }
+  condition_.notify_one();
+  thread_.join();
+}
+
+/// @brief Set the number of rows of the data source. Every row is filtered and
+/// sorted again.
+void RowIndex::SetRows(size_t rows) {
+  rows_ = rows;
+  Submit({Job::Full, rows_, filter_, less_});
+}
+
+/// @brief Keep the rows for which |filter| returns true. Every row is filtered
+/// again. A null |filter| keeps every row.
+void RowIndex::SetFilter(Filter filter) {
+  filter_ = std::move(filter);
+  Submit({Job::Full, rows_, filter_, less_});
+}
+
+/// @brief Keep the rows for which |filter| returns true. As opposed to
+/// SetFilter(), only the rows currently kept are filtered: |filter| must reject
+/// every row the previous filter rejected. For instance, when the searched
+/// text gets longer.
+void RowIndex::NarrowFilter(Filter filter) {
+  filter_ = std::move(filter);
+  Submit({Job::Narrow, rows_, filter_, less_});
+}
+
+/// @brief Sort the rows with |less|. The rows comparing equal keep the order
+/// of the data source. A null |less| restores the order of the data source.
+void RowIndex::SetSort(Less less) {
+  less_ = std::move(less);
+  Submit({Job::Sort, rows_, filter_, less_});
+}
+
+/// @brief The number of rows kept.
+size_t RowIndex::size() {
+  Publish();
+  return order_.size();
+}
+
+/// @brief The row of the data source displayed at |position|.
+size_t RowIndex::operator[](size_t position) {
+  Publish();
+  return order_[position];
+}
+
+void RowIndex::Submit(Job job) {
+  if (!thread_.joinable()) {
+    Apply(job, order_, nullptr);
+    return;
+  }
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    // The jobs before a full one are useless. The running one is cancelled.
+    if (job.kind == Job::Full) {
+      jobs_pending_ -= int(jobs_.size());
+      jobs_.clear();
+      cancel_ = true;
+    }
+    jobs_.push_back(std::move(job));
+    ++jobs_pending_;
+  }
+  condition_.notify_one();
+}
+
+// static
+void RowIndex::Apply(const Job& job,
+                     std::vector<size_t>& order,
+                     const std::atomic<bool>* cancel) {
+  switch (job.kind) {
+    case Job::Full:
+      order.clear();
+      for (size_t row = 0; row < job.rows; ++row) {
+        // Stop early when the result is not needed anymore.
+        if (cancel && row % 4096 == 0 && *cancel) {  // NOLINT
+          return;
+        }
+        if (!job.filter || job.filter(row)) {
+          order.push_back(row);
+        }
+      }
+      break;
+
+    case Job::Narrow:
+      if (!job.filter) {
+        return;
+      }
+      order.erase(std::remove_if(order.begin(), order.end(),
+                                 [&](size_t row) { return !job.filter(row); }),
+                  order.end());
+      return;
+
+    case Job::Sort:
+      break;
+  }
+
+  if (!job.less) {
+    std::sort(order.begin(), order.end());
+    return;
+  }
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (job.less(a, b)) {
+      return true;
+    }
+    return !job.less(b, a) && a < b;
+  });
+}
+
+// The background thread. It applies the jobs in order, to its own copy of the
+// index, and publishes it once there are no more jobs.
+void RowIndex::Run() {
+  std::vector<size_t> order = computed_;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this] { return stopped_ || !jobs_.empty(); });
+    if (stopped_) {
+      return;
+    }
+    const Job job = std::move(jobs_.front());
+    jobs_.pop_front();
+    cancel_ = false;
+    lock.unlock();
+
+    Apply(job, order, &cancel_);
+
+    lock.lock();
+    --jobs_pending_;
+    if (cancel_ || !jobs_.empty()) {
+      continue;
+    }
+    computed_ = order;
+    has_computed_ = true;
+    lock.unlock();
+    screen_->PostEvent(Event::Custom);
+    lock.lock();
+  }
+}
+
+// Use the index computed by the background thread.
+void RowIndex::Publish() {
+  if (!has_computed_) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  std::swap(order_, computed_);
+  has_computed_ = false;
+}
+
+}  // namespace ftxui
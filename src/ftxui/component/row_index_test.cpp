@@ -0,0 +1,120 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ftxui/component/component.hpp"  // for Menu, Renderer
+#include "ftxui/component/row_index.hpp"  // for RowIndex, IndexedEntries
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+#include "ftxui/dom/node.hpp"                      // for Render
+#include "ftxui/screen/screen.hpp"                 // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+std::vector<size_t> Rows(RowIndex& index) {
+  std::vector<size_t> rows;
+  for (size_t i = 0; i < index.size(); ++i) {
+    rows.push_back(index[i]);
+  }
+  return rows;
+}
+
+}  // namespace
+
+TEST(RowIndexTest, FilterAndSort) {
+  std::vector<int> values = {5, 3, 8, 3, 1, 9, 3};
+  RowIndex index(values.size());
+  EXPECT_EQ(Rows(index), std::vector<size_t>({0, 1, 2, 3, 4, 5, 6}));
+
+  // The equal values keep the order of the data source.
+  index.SetSort([&](size_t a, size_t b) { return values[a] < values[b]; });
+  EXPECT_EQ(Rows(index), std::vector<size_t>({4, 1, 3, 6, 0, 2, 5}));
+
+  index.SetFilter([&](size_t row) { return values[row] >= 3; });
+  EXPECT_EQ(Rows(index), std::vector<size_t>({1, 3, 6, 0, 2, 5}));
+
+  // Only the rows kept are filtered. They stay sorted.
+  index.NarrowFilter([&](size_t row) { return values[row] >= 5; });
+  EXPECT_EQ(Rows(index), std::vector<size_t>({0, 2, 5}));
+
+  index.SetSort([&](size_t a, size_t b) { return values[a] > values[b]; });
+  EXPECT_EQ(Rows(index), std::vector<size_t>({5, 2, 0}));
+
+  values.push_back(7);
+  index.SetRows(values.size());
+  EXPECT_EQ(Rows(index), std::vector<size_t>({5, 2, 7, 0}));
+
+  // The order of the data source.
+  index.SetSort(nullptr);
+  index.SetFilter(nullptr);
+  EXPECT_EQ(Rows(index), std::vector<size_t>({0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST(RowIndexTest, Menu) {
+  std::vector<std::string> entries = {"b", "c", "a"};
+  RowIndex index(entries.size());
+  index.SetSort([&](size_t a, size_t b) { return entries[a] < entries[b]; });
+  IndexedEntries indexed(&entries, &index);
+  int selected = 0;
+  auto menu = Menu(&indexed, &selected);
+
+  Screen screen(4, 3);
+  Render(screen, menu->Render());
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[1m\x1B[7m> a \x1B[22m\x1B[27m\r\n"
+            "\x1B[2m  b \x1B[22m\r\n"
+            "\x1B[2m  c \x1B[22m");
+}
+
+#if !defined(FTXUI_NO_THREADS)
+TEST(RowIndexTest, Background) {
+  const size_t rows = 500000;
+  std::vector<int> values(rows);
+  for (size_t i = 0; i < rows; ++i) {
+    values[i] = int((i * 7919) % 1000);
+  }
+
+  auto screen = ScreenInteractive::FitComponent();
+  RowIndex index(screen, rows);
+  int step = 0;
+  auto component = Renderer([&] {
+    if (index.computing()) {
+      return text("computing");
+    }
+    switch (step++) {
+      case 0:
+        index.SetSort([&](size_t a, size_t b) { return values[a] < values[b]; });
+        break;
+      case 1:
+        // Requests superseding each other. Only the last one is displayed.
+        index.SetFilter([&](size_t row) { return values[row] < 500; });
+        index.SetFilter([&](size_t row) { return values[row] < 10; });
+        index.NarrowFilter([&](size_t row) { return values[row] < 2; });
+        break;
+      default:
+        screen.Exit();
+        break;
+    }
+    return text("done");
+  });
+  screen.Loop(component);
+
+  ASSERT_EQ(index.size(), rows / 500);
+  for (size_t i = 0; i < index.size(); ++i) {
+    EXPECT_LT(values[index[i]], 2);
+    if (i > 0) {
+      EXPECT_LE(values[index[i - 1]], values[index[i]]);
+    }
+  }
+}
+#endif
+
+}  // namespace ftxui
+// NOLINTEND
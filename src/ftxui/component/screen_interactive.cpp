@@ -1,35 +1,51 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <algorithm>  // for copy, max, min
+#include <algorithm>  // for copy, max, min, is_sorted, stable_sort, nth_element
 #include <array>      // for array
 #include <chrono>  // for operator-, milliseconds, operator>=, duration, common_type<>::type, time_point
 #include <csignal>  // for signal, SIGTSTP, SIGABRT, SIGWINCH, raise, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM, __sighandler_t, size_t
+#include <cerrno>   // for errno, EINTR, EAGAIN
+#include <condition_variable>  // for condition_variable
+#include <cstddef>  // for ptrdiff_t
+#include <deque>    // for deque
 #include <cstdio>   // for fileno, stdin
-#include <ftxui/component/task.hpp>  // for Task, Closure, AnimationTask
+#include <ftxui/component/task.hpp>  // for Task, Closure, AnimationTask, LatestClosure, TargetedEvent, BackgroundClosure
 #include <ftxui/screen/screen.hpp>  // for Pixel, Screen::Cursor, Screen, Screen::Cursor::Hidden
 #include <functional>        // for function
 #include <initializer_list>  // for initializer_list
 #include <iostream>  // for cout, ostream, operator<<, basic_ostream, endl, flush
+#include <map>       // for map
+#include <memory>    // for make_shared
+#include <mutex>     // for mutex, lock_guard, unique_lock
 #include <stack>     // for stack
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
 #include <thread>    // for thread, sleep_for
 #include <tuple>     // for _Swallow_assign, ignore
 #include <type_traits>  // for decay_t
-#include <utility>      // for move, swap
+#include <unordered_set>  // for unordered_set
+#include <utility>      // for exchange, move, swap
 #include <variant>      // for visit, variant
 #include <vector>       // for vector
 
 #include "ftxui/component/animation.hpp"  // for TimePoint, Clock, Duration, Params, RequestAnimationFrame
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse, CapturedMouseInterface
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_profiler.hpp"  // for ComponentProfiler
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/loop.hpp"            // for Loop
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, Sender, MakeReceiver, SenderImpl, Receiver
 #include "ftxui/component/screen_interactive.hpp"
+#include "ftxui/component/session_recording.hpp"  // for SessionRecording
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
-#include "ftxui/dom/node.hpp"                         // for Node, Render
+#include "ftxui/dom/elements.hpp"  // for Element, Dimension::Fit
+#include "ftxui/dom/node.hpp"  // for Node, Render, RenderStats, NodesConstructed
+#include "ftxui/dom/node_arena.hpp"                   // for NodeArena
+#include "ftxui/dom/node_profiler.hpp"                // for NodeProfiler
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
 #include "ftxui/screen/terminal.hpp"                  // for Dimensions, Size
+#include "ftxui/screen/trace.hpp"                     // for FTXUI_TRACE
 
 #if defined(_WIN32)
 #define DEFINE_CONSOLEV2_PROPERTIES
@@ -42,6 +58,8 @@
 #error Must be compiled in UNICODE mode
 #endif
 #else
+#include <fcntl.h>       // for fcntl, F_GETFL, F_SETFL, O_NONBLOCK
+#include <sys/ioctl.h>   // for ioctl, TIOCOUTQ
 #include <sys/select.h>  // for select, FD_ISSET, FD_SET, FD_ZERO, fd_set, timeval
 #include <termios.h>  // for tcsetattr, termios, tcgetattr, TCSANOW, cc_t, ECHO, ICANON, VMIN, VTIME
 #include <unistd.h>  // for STDIN_FILENO, read
@@ -56,10 +74,12 @@ namespace ftxui {
 
 namespace animation {
 void RequestAnimationFrame() {
+#if !defined(FTXUI_NO_ANIMATIONS)
   auto* screen = ScreenInteractive::Active();
   if (screen) {
     screen->RequestAnimationFrame();
   }
+#endif
 }
 }  // namespace animation
 
@@ -67,55 +87,256 @@ namespace {
 
 ScreenInteractive* g_active_screen = nullptr;  // NOLINT
 
-void Flush() {
+// Everything written to the terminal is accumulated here, and written at once
+// by Flush(). This bypasses iostreams, and issues a single write per frame.
+std::string g_output_buffer;  // NOLINT
+
+// Where the output goes instead of the terminal, for a Headless() screen.
+std::string* g_output_capture = nullptr;  // NOLINT
+
+// Where the input and the frames are recorded. See RecordSession().
+SessionRecording* g_session_recording = nullptr;  // NOLINT
+
+// Give the |input| read from the terminal to the |parser|.
+void ParseInput(TerminalInputParser* parser, std::string_view input) {
+  if (g_session_recording) {
+    g_session_recording->RecordInput(input);
+  }
+  parser->Add(input);
+}
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+void WriteAll(int fd, std::string_view data) {
+  while (!data.empty()) {
+    const ssize_t written = write(fd, data.data(), data.size());
+    if (written >= 0) {
+      data.remove_prefix(size_t(written));
+      continue;
+    }
+    if (errno == EINTR) {
+      continue;
+    }
+    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+      return;
+    }
+    // The output is non blocking. Wait for it to become writable.
+    fd_set fds;
+    FD_ZERO(&fds);                                    // NOLINT
+    FD_SET(fd, &fds);                                 // NOLINT
+    select(fd + 1, nullptr, &fds, nullptr, nullptr);  // NOLINT
+  }
+}
+#elif defined(_WIN32)
+// Write to the console handle directly, bypassing the text mode translations
+// of the C runtime: a frame is written at once. The console decodes the UTF-8
+// itself, its output code page being CP_UTF8. See Screen::Screen().
+void WriteAll(std::string_view data) {
+  const HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+  while (!data.empty()) {
+    const DWORD size = DWORD(std::min<size_t>(data.size(), MAXDWORD));
+    DWORD written = 0;
+    if (!WriteFile(output, data.data(), size, &written, nullptr) ||
+        written == 0) {
+      return;
+    }
+    data.remove_prefix(size_t(written));
+  }
+}
+#endif
+
+void Flush(std::string& buffer) {
+  if (g_output_capture) {
+    *g_output_capture += buffer;
+    buffer.clear();
+    return;
+  }
+#if defined(__EMSCRIPTEN__)
   // Emscripten doesn't implement flush. We interpret zero as flush.
-  std::cout << '\0' << std::flush;
+  std::cout << buffer << '\0' << std::flush;
+#elif defined(_WIN32)
+  // What the application wrote to std::cout must be displayed first.
+  std::cout << std::flush;
+  WriteAll(buffer);
+#else
+  // What the application wrote to std::cout must be displayed first.
+  std::cout << std::flush;
+  WriteAll(STDOUT_FILENO, buffer);
+#endif
+  buffer.clear();
+}
+
+void Flush() {
+  Flush(g_output_buffer);
+}
+
+// How often the terminal output is checked again, while it is busy.
+const auto output_poll_interval = std::chrono::milliseconds(5);
+
+// Whether the terminal hasn't consumed everything written to it yet. This
+// happens when it is slower than the application, for instance over SSH.
+bool OutputBusy() {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  return false;
+#else
+#if defined(TIOCOUTQ)
+  // The characters not transmitted yet by the terminal driver.
+  int queued = 0;
+  if (ioctl(STDOUT_FILENO, TIOCOUTQ, &queued) == 0 && queued > 0) {  // NOLINT
+    return true;
+  }
+#endif
+  // Pseudo terminals don't report their queue. Instead, they stop being
+  // writable once the terminal emulator, or sshd, is too far behind.
+  fd_set fds;
+  FD_ZERO(&fds);                // NOLINT
+  FD_SET(STDOUT_FILENO, &fds);  // NOLINT
+  timeval timeout = {0, 0};
+  return select(STDOUT_FILENO + 1, nullptr, &fds, nullptr, &timeout) == 0;
+#endif
 }
 
 constexpr int timeout_milliseconds = 20;
 [[maybe_unused]] constexpr int timeout_microseconds =
     timeout_milliseconds * 1000;
+
+// The input is read for the whole terminal session, by the EventListener or by
+// the loop thread. The events are forwarded to the active screen, so that the
+// nested screens reuse the same reader.
+Receiver<Task> g_input_receiver;                    // NOLINT
+std::mutex g_input_mutex;                           // NOLINT
+const ScreenInteractive* g_input_screen = nullptr;  // NOLINT
+Sender<Task> g_input_target;                        // NOLINT
+std::atomic<bool> g_input_quit = false;             // NOLINT
+std::thread g_event_listener;                       // NOLINT
+
+// Send the events read to the active screen. They are kept until there is one.
+void ForwardInput() {
+  const std::lock_guard<std::mutex> lock(g_input_mutex);
+  if (!g_input_receiver || !g_input_target) {
+    return;
+  }
+  Task task;
+  while (g_input_receiver->ReceiveNonBlocking(&task)) {
+    g_input_target->Send(std::move(task));
+  }
+}
+
+// Send the events read to |screen|, or to nobody when |target| is null.
+void SetInputTarget(const ScreenInteractive* screen, Sender<Task> target) {
+  {
+    const std::lock_guard<std::mutex> lock(g_input_mutex);
+    g_input_screen = screen;
+    std::swap(g_input_target, target);
+  }
+  ForwardInput();
+}
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+// The input can't be read from an external event loop.
+constexpr int input_file_descriptor = -1;
+int WakeUpFileDescriptor() {
+  return -1;
+}
+#if defined(_WIN32)
+// An event to wake up the EventListener. It is set when the loop exits, and
+// when a signal is received. Like the pipe of the other platforms, it is never
+// closed.
+HANDLE g_wake_up_event = nullptr;  // NOLINT
+
+void OpenWakeUpPipe() {
+  if (!g_wake_up_event) {
+    g_wake_up_event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+  }
+}
+
+void WakeUp() {
+  if (g_wake_up_event) {
+    SetEvent(g_wake_up_event);
+  }
+}
+#else
+// The EventListener polls the quit flag.
+void OpenWakeUpPipe() {}
+void WakeUp() {}
+#endif
+bool WaitForInput(long /*usec_timeout*/, bool* /*woken_up*/) {
+  return false;
+}
+bool ReadInput(TerminalInputParser* /*parser*/) {
+  return false;
+}
+#endif
+
 #if defined(_WIN32)
 
 void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
   auto console = GetStdHandle(STD_INPUT_HANDLE);
   auto parser = TerminalInputParser(out->Clone());
+  const std::array<HANDLE, 2> handles = {console, g_wake_up_event};
+  const DWORD handle_count = g_wake_up_event ? 2 : 1;
+
+  // Reused from one read to the next.
+  std::vector<INPUT_RECORD> records;
+  std::wstring typed;
+
+  // The characters are converted at once, so that the surrogate pairs aren't
+  // split.
+  auto flush_typed = [&] {
+    if (!typed.empty()) {
+      ParseInput(&parser, to_string(typed));
+      typed.clear();
+    }
+  };
+
   while (!*quit) {
-    // Throttle ReadConsoleInput by waiting 250ms, this wait function will
-    // return if there is input in the console.
-    auto wait_result = WaitForSingleObject(console, timeout_milliseconds);
+    ForwardInput();
+    // Wait for the input, or to be woken up. The timeout is only needed to
+    // complete a pending escape sequence, or to poll the quit flag without a
+    // wake-up event.
+    const DWORD timeout = parser.HasPending() || handle_count == 1
+                              ? DWORD(timeout_milliseconds)
+                              : INFINITE;
+    const DWORD wait_result =
+        WaitForMultipleObjects(handle_count, handles.data(), FALSE, timeout);
     if (wait_result == WAIT_TIMEOUT) {
       parser.Timeout(timeout_milliseconds);
       continue;
     }
 
+    // A signal might have been received. The main loop handles it.
+    if (wait_result == WAIT_OBJECT_0 + 1) {
+      if (!*quit) {
+        out->Send(Closure([] {}));
+      }
+      continue;
+    }
+
     DWORD number_of_events = 0;
     if (!GetNumberOfConsoleInputEvents(console, &number_of_events))
       continue;
     if (number_of_events <= 0)
       continue;
 
-    std::vector<INPUT_RECORD> records{number_of_events};
+    if (records.size() < number_of_events) {
+      records.resize(number_of_events);
+    }
     DWORD number_of_events_read = 0;
-    ReadConsoleInput(console, records.data(), (DWORD)records.size(),
+    ReadConsoleInput(console, records.data(), number_of_events,
                      &number_of_events_read);
-    records.resize(number_of_events_read);
 
-    for (const auto& r : records) {
+    for (DWORD i = 0; i < number_of_events_read; ++i) {
+      const INPUT_RECORD& r = records[i];
       switch (r.EventType) {
         case KEY_EVENT: {
-          auto key_event = r.Event.KeyEvent;
+          const auto& key_event = r.Event.KeyEvent;
           // ignore UP key events
           if (key_event.bKeyDown == FALSE)
             continue;
-          std::wstring wstring;
-          wstring += key_event.uChar.UnicodeChar;
-          for (auto it : to_string(wstring)) {
-            parser.Add(it);
-          }
+          typed += key_event.uChar.UnicodeChar;
         } break;
         case WINDOW_BUFFER_SIZE_EVENT:
-          out->Send(Event::Special({0}));
+          // The characters typed before are handled first.
+          flush_typed();
+          out->Send(Event::Resize);
           break;
         case MENU_EVENT:
         case FOCUS_EVENT:
@@ -124,6 +345,7 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
           break;
       }
     }
+    flush_typed();
   }
 }
 
@@ -137,14 +359,18 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
 
   char c;
   while (!*quit) {
+    ForwardInput();
     while (read(STDIN_FILENO, &c, 1), c)
-      parser.Add(c);
+      ParseInput(&parser, std::string_view(&c, 1));
 
     emscripten_sleep(1);
     parser.Timeout(1);
   }
 }
 
+// The cells of the active screen, read by JavaScript. See ExportCells().
+const CellBuffer* g_exported_cells = nullptr;  // NOLINT
+
 extern "C" {
 EMSCRIPTEN_KEEPALIVE
 void ftxui_on_resize(int columns, int rows) {
@@ -154,39 +380,182 @@ void ftxui_on_resize(int columns, int rows) {
   });
   std::raise(SIGWINCH);
 }
+
+EMSCRIPTEN_KEEPALIVE
+const uint32_t* ftxui_cells() {
+  return g_exported_cells ? g_exported_cells->cells() : nullptr;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int ftxui_cells_dimx() {
+  return g_exported_cells ? g_exported_cells->dimx() : 0;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int ftxui_cells_dimy() {
+  return g_exported_cells ? g_exported_cells->dimy() : 0;
+}
+
+EMSCRIPTEN_KEEPALIVE
+uint32_t ftxui_cells_frame() {
+  return g_exported_cells ? g_exported_cells->frame() : 0;
+}
+
+EMSCRIPTEN_KEEPALIVE
+const uint32_t* ftxui_cells_row_frames() {
+  return g_exported_cells ? g_exported_cells->row_frames() : nullptr;
+}
+
+EMSCRIPTEN_KEEPALIVE
+const int32_t* ftxui_cells_cursor() {
+  return g_exported_cells ? g_exported_cells->cursor() : nullptr;
+}
+
+EMSCRIPTEN_KEEPALIVE
+const char* ftxui_cells_grapheme(uint32_t id) {
+  return g_exported_cells ? g_exported_cells->Grapheme(id).c_str() : "";
+}
 }
 
 #else  // POSIX (Linux & Mac)
 
-int CheckStdinReady(int usec_timeout) {
-  timeval tv = {0, usec_timeout};
+constexpr int input_file_descriptor = STDIN_FILENO;
+
+// A pipe to wake up the thread waiting for the input: the EventListener, or
+// the external event loop. It is written to when the loop exits, when a signal
+// is received, and when a task is posted to an external event loop.
+std::array<int, 2> g_wake_up_pipe = {-1, -1};  // NOLINT
+
+int WakeUpFileDescriptor() {
+  return g_wake_up_pipe[0];
+}
+
+// The pipe is never closed, so that its file descriptor remains the same for
+// the external event loops.
+void OpenWakeUpPipe() {
+  if (g_wake_up_pipe[0] >= 0) {
+    return;
+  }
+  if (pipe(g_wake_up_pipe.data()) != 0) {
+    g_wake_up_pipe = {-1, -1};
+    return;
+  }
+  for (const int fd : g_wake_up_pipe) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);  // NOLINT
+  }
+}
+
+// Async signal safe function
+void WakeUp() {
+  if (g_wake_up_pipe[1] >= 0) {
+    const char c = 0;
+    std::ignore = write(g_wake_up_pipe[1], &c, 1);
+  }
+}
+
+// Wait for stdin to be ready, or to be woken up. Give up after |usec_timeout|,
+// unless it is negative. Return whether stdin is ready.
+bool WaitForInput(long usec_timeout, bool* woken_up) {
+  const int wake_up_fd = g_wake_up_pipe[0];
+  // Without a way of being woken up, the quit flag needs to be polled.
+  if (wake_up_fd < 0 && usec_timeout < 0) {
+    usec_timeout = timeout_microseconds;
+  }
+  const long usec_per_second = 1000000;
+  timeval tv = {usec_timeout / usec_per_second, usec_timeout % usec_per_second};
   fd_set fds;
-  FD_ZERO(&fds);                                          // NOLINT
-  FD_SET(STDIN_FILENO, &fds);                             // NOLINT
-  select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv);  // NOLINT
-  return FD_ISSET(STDIN_FILENO, &fds);                    // NOLINT
+  FD_ZERO(&fds);               // NOLINT
+  FD_SET(STDIN_FILENO, &fds);  // NOLINT
+  if (wake_up_fd >= 0) {
+    FD_SET(wake_up_fd, &fds);  // NOLINT
+  }
+  const int nfds = std::max(STDIN_FILENO, wake_up_fd) + 1;
+  if (select(nfds, &fds, nullptr, nullptr,
+             usec_timeout < 0 ? nullptr : &tv) <= 0) {
+    return false;
+  }
+
+  *woken_up = wake_up_fd >= 0 && FD_ISSET(wake_up_fd, &fds);  // NOLINT
+  if (*woken_up) {
+    std::array<char, 64> buffer;  // NOLINT
+    while (read(wake_up_fd, buffer.data(), buffer.size()) > 0) {
+    }
+  }
+  return FD_ISSET(STDIN_FILENO, &fds);  // NOLINT
+}
+
+// Return whether some input was read. This is false at the end of the input.
+bool ReadInput(TerminalInputParser* parser) {
+  const size_t buffer_size = 4096;
+  std::array<char, buffer_size> buffer;                              // NOLINT
+  const ssize_t l = read(STDIN_FILENO, buffer.data(), buffer_size);  // NOLINT
+  if (l <= 0) {
+    return false;
+  }
+  ParseInput(parser, std::string_view(buffer.data(), size_t(l)));
+  return true;
 }
 
 // Read char from the terminal.
 void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
-  auto parser = TerminalInputParser(std::move(out));
+  auto parser = TerminalInputParser(out->Clone());
 
   while (!*quit) {
-    if (!CheckStdinReady(timeout_microseconds)) {
-      parser.Timeout(timeout_milliseconds);
-      continue;
+    ForwardInput();
+    // The timeout is only needed to complete a pending escape sequence.
+    const long usec_timeout = parser.HasPending() ? timeout_microseconds : -1;
+    bool woken_up = false;
+    const bool ready = WaitForInput(usec_timeout, &woken_up);
+
+    // A signal might have been received. The main loop handles it.
+    if (woken_up && !*quit) {
+      out->Send(Closure([] {}));
     }
 
-    const size_t buffer_size = 100;
-    std::array<char, buffer_size> buffer;                        // NOLINT;
-    size_t l = read(fileno(stdin), buffer.data(), buffer_size);  // NOLINT
-    for (size_t i = 0; i < l; ++i) {
-      parser.Add(buffer[i]);  // NOLINT
+    if (ready) {
+      ReadInput(&parser);
+    } else if (!woken_up) {
+      parser.Timeout(timeout_milliseconds);
     }
   }
 }
 #endif
 
+// The input parser, when the input is read by the main loop. See
+// ScreenInteractive::ExternalEventLoop() and ScreenInteractive::Headless().
+std::unique_ptr<TerminalInputParser> g_input_parser;  // NOLINT
+animation::TimePoint g_input_parser_time;            // NOLINT
+
+// Read the input available, without blocking. Complete the pending escape
+// sequence after a timeout. The |injected_input|, if any, is read instead of
+// the terminal.
+void ReadInputFromMainLoop(animation::TimePoint now,
+                           std::string* injected_input) {
+  if (injected_input) {
+    if (g_input_parser && !injected_input->empty()) {
+      ParseInput(g_input_parser.get(), *injected_input);
+      injected_input->clear();
+      g_input_parser_time = now;
+    }
+  } else {
+    bool woken_up = false;
+    while (g_input_parser && WaitForInput(0, &woken_up) &&
+           ReadInput(g_input_parser.get())) {
+      g_input_parser_time = now;
+    }
+  }
+
+  if (g_input_parser && g_input_parser->HasPending()) {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now - g_input_parser_time);
+    if (elapsed.count() >= timeout_milliseconds) {
+      g_input_parser->Timeout(int(elapsed.count()));
+      g_input_parser_time = now;
+    }
+  }
+  ForwardInput();
+}
+
 std::stack<Closure> on_exit_functions;  // NOLINT
 void OnExit() {
   while (!on_exit_functions.empty()) {
@@ -226,6 +595,9 @@ void RecordSignal(int signal) {
     default:
       break;
   }
+
+  // The main loop might be waiting for the input.
+  WakeUp();
 }
 
 void ExecuteSignalHandlers() {
@@ -240,8 +612,9 @@ void ExecuteSignalHandlers() {
     ScreenInteractive::Private::Signal(*g_active_screen, SIGTSTP);
   }
 
-  int signal_resize_count = g_signal_resize_count.exchange(0);
-  while (signal_resize_count--) {
+  // A burst of resizes is a single one: the size is queried once, and the
+  // frame drawn once.
+  if (g_signal_resize_count.exchange(0) > 0) {
     ScreenInteractive::Private::Signal(*g_active_screen, SIGWINCH);
   }
 #endif
@@ -254,16 +627,17 @@ void InstallSignalHandler(int sig) {
 }
 
 // CSI: Control Sequence Introducer
-const std::string CSI = "\x1b[";  // NOLINT
-                                  //
-// DCS: Device Control String
-const std::string DCS = "\x1bP";  // NOLINT
-// ST: String Terminator
-const std::string ST = "\x1b\\";  // NOLINT
+constexpr std::string_view CSI = "\x1b[";
+
+// DCS: Device Control String, terminated by ST: String Terminator.
+constexpr std::string_view DCS = "\x1bP";
+constexpr std::string_view ST = "\x1b\\";
 
 // DECRQSS: Request Status String
 // DECSCUSR: Set Cursor Style
-const std::string DECRQSS_DECSCUSR = DCS + "$q q" + ST;  // NOLINT
+// It is "$q q", between a DCS (Device Control String) and a ST (String
+// Terminator).
+constexpr std::string_view DECRQSS_DECSCUSR = "\x1bP$q q\x1b\\";
 
 // DEC: Digital Equipment Corporation
 enum class DECMode {
@@ -282,6 +656,8 @@ enum class DECMode {
   kMouseUrxvtMode = 1015,
   kMouseSgrPixelsMode = 1016,
   kAlternateScreen = 1049,
+  kBracketedPaste = 2004,
+  kSynchronizedOutput = 2026,
 };
 
 // Device Status Report (DSR) {
@@ -304,17 +680,179 @@ std::string Serialize(const std::vector<DECMode>& parameters) {
 
 // DEC Private Mode Set (DECSET)
 std::string Set(const std::vector<DECMode>& parameters) {
-  return CSI + "?" + Serialize(parameters) + "h";
+  return std::string(CSI) + "?" + Serialize(parameters) + "h";
 }
 
 // DEC Private Mode Reset (DECRST)
 std::string Reset(const std::vector<DECMode>& parameters) {
-  return CSI + "?" + Serialize(parameters) + "l";
+  return std::string(CSI) + "?" + Serialize(parameters) + "l";
 }
 
 // Device Status Report (DSR)
 std::string DeviceStatusReport(DSRMode ps) {
-  return CSI + std::to_string(int(ps)) + "n";
+  return std::string(CSI) + std::to_string(int(ps)) + "n";
+}
+
+// DEC Private Mode Request (DECRQM). The terminal answers with a DECRPM.
+std::string RequestMode(DECMode mode) {
+  return std::string(CSI) + "?" + std::to_string(int(mode)) + "$p";
+}
+
+// Whether the terminal session is started. It is shared by the nested screens,
+// and ends with the outermost one.
+bool g_session_started = false;  // NOLINT
+
+// The style of the cursor to restore at the end of the session.
+int g_cursor_reset_shape = 1;  // NOLINT
+
+// The DEC modes switched during the session, with their current value. The
+// other ones are left as they were found.
+std::map<DECMode, bool> g_modes;  // NOLINT
+
+// Switch |mode|. Return nothing when it already has this value.
+std::string SwitchMode(DECMode mode, bool enabled) {
+  const auto it = g_modes.find(mode);
+  if (it == g_modes.end()) {
+    g_modes.emplace(mode, enabled);
+  } else if (it->second == enabled) {
+    return "";
+  } else {
+    // Back to the value it was found with.
+    g_modes.erase(it);
+  }
+  return enabled ? Set({mode}) : Reset({mode});
+}
+
+// The capabilities asked with XTGETTCAP, by their terminfo names.
+// - RGB, Tc: the true colors.
+// - rep: REP, repeating the previous character.
+// - ech: ECH, erasing characters.
+// - csr: DECSTBM, setting a scrolling region.
+const std::array<std::string_view, 5> kProbedCapabilities = {
+    "RGB", "Tc", "rep", "ech", "csr",
+};
+
+// What the terminal answered to ProbeTerminal(). It is probed once, for the
+// whole process.
+struct TerminalProbe {
+  bool started = false;
+  // The support guessed from the environment, before the answers.
+  Terminal::Color color = Terminal::Color::Palette16;
+  Terminal::Compression compression = Terminal::Compression::None;
+  std::map<std::string, bool, std::less<>> capabilities;
+  std::string version;  // XTVERSION, for instance "XTerm(388)".
+};
+TerminalProbe g_terminal_probe;  // NOLINT
+
+std::string Hex(std::string_view text) {
+  const char* digits = "0123456789ABCDEF";
+  std::string out;
+  for (const char c : text) {
+    out += digits[(unsigned char)c >> 4];   // NOLINT
+    out += digits[(unsigned char)c & 15];  // NOLINT
+  }
+  return out;
+}
+
+std::string Unhex(std::string_view hex) {
+  auto digit = [](char c) {
+    return c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;  // NOLINT
+  };
+  std::string out;
+  for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+    out += char(digit(hex[i]) * 16 + digit(hex[i + 1]));  // NOLINT
+  }
+  return out;
+}
+
+// Ask the terminal its name (XTVERSION) and its capabilities (XTGETTCAP),
+// one by one, since a terminal stops at the first one it doesn't know.
+std::string TerminalProbeRequest() {
+  std::string out = std::string(CSI) + ">0q";
+  for (const std::string_view name : kProbedCapabilities) {
+    out += std::string(DCS) + "+q" + Hex(name) + std::string(ST);
+  }
+  return out;
+}
+
+// Update the Terminal support from the answers received so far. A capability
+// without an answer keeps the support guessed from the environment.
+void ApplyTerminalProbe() {
+  const TerminalProbe& probe = g_terminal_probe;
+  auto answer = [&](std::string_view name) -> int {
+    const auto it = probe.capabilities.find(name);
+    return it == probe.capabilities.end() ? -1 : int(it->second);
+  };
+
+  // The terminals known to implement REP, as in the environment heuristics.
+  // XTVERSION is answered even over SSH, where the environment isn't
+  // forwarded.
+  const bool known_repeat =
+      probe.version.find("XTerm") != std::string::npos ||
+      probe.version.find("kitty") != std::string::npos ||
+      probe.version.find("WezTerm") != std::string::npos ||
+      probe.version.find("foot") != std::string::npos;
+
+  if (answer("RGB") == 1 || answer("Tc") == 1) {
+    Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  } else {
+    Terminal::SetColorSupport(probe.color);
+  }
+
+  Terminal::Compression compression = probe.compression;
+  if (answer("ech") == 1) {
+    compression = std::max(compression, Terminal::Compression::Erase);
+  }
+  if (answer("rep") == 1 || (answer("rep") == -1 && known_repeat)) {
+    compression = Terminal::Compression::Repeat;
+  }
+  if (answer("rep") == 0) {
+    compression = std::min(compression, Terminal::Compression::Erase);
+  }
+  if (answer("ech") == 0) {
+    compression = Terminal::Compression::None;
+  }
+  Terminal::SetCompressionSupport(compression);
+
+  Terminal::SetScrollRegionSupport(answer("csr") != 0);
+}
+
+// Record the answer |report| to TerminalProbeRequest().
+void HandleTerminalReport(std::string_view report) {
+  // Remove the ESC P prefix and the ST suffix.
+  report = report.substr(2, report.size() - 4);
+  if (report.substr(0, 2) == ">|") {
+    g_terminal_probe.version = std::string(report.substr(2));
+  } else {
+    // 1+r name[=value] when known, 0+r [name] otherwise.
+    const bool known = report[0] == '1';
+    report.remove_prefix(3);
+    const std::string name = Unhex(report.substr(0, report.find('=')));
+    if (name.empty()) {
+      return;
+    }
+    g_terminal_probe.capabilities[name] = known;
+  }
+  ApplyTerminalProbe();
+}
+
+// Switch from the modes of the previous screen to |modes|. Only the ones
+// differing are written. The ones not in |modes| are restored.
+std::string SwitchModes(const std::map<DECMode, bool>& modes) {
+  std::vector<DECMode> restored;
+  for (const auto& [mode, enabled] : g_modes) {
+    if (modes.count(mode) == 0) {
+      restored.push_back(mode);
+    }
+  }
+  std::string out;
+  for (auto it = restored.rbegin(); it != restored.rend(); ++it) {
+    out += SwitchMode(*it, !g_modes[*it]);
+  }
+  for (const auto& [mode, enabled] : modes) {
+    out += SwitchMode(mode, enabled);
+  }
+  return out;
 }
 
 class CapturedMouseImpl : public CapturedMouseInterface {
@@ -331,25 +869,431 @@ class CapturedMouseImpl : public CapturedMouseInterface {
   std::function<void(void)> callback_;
 };
 
-void AnimationListener(std::atomic<bool>* quit, Sender<Task> out) {
-  // Animation at around 60fps.
-  const auto time_delta = std::chrono::milliseconds(15);
-  while (!*quit) {
-    out->Send(AnimationTask());
-    std::this_thread::sleep_for(time_delta);
+// Animation at around 60fps.
+const auto animation_interval = std::chrono::milliseconds(15);
+
+// Whether |event| is a mouse motion, superseded by the |next| one.
+bool IsSupersededMotion(Event& event, Event& next) {
+  if (!event.is_mouse() || !next.is_mouse()) {
+    return false;
+  }
+  const Mouse& a = event.mouse();
+  const Mouse& b = next.mouse();
+  return a.motion == Mouse::Moved && b.motion == Mouse::Moved &&
+         a.button == b.button && a.shift == b.shift && a.meta == b.meta &&
+         a.control == b.control;
+}
+
+// Remove from |tasks| the ones superseded by a later one:
+// - A mouse motion event, when the next event is another one with the same
+//   buttons.
+// - An AnimationTask, followed by another one.
+// - A LatestClosure, followed by another one with the same key.
+// With |motions_only|, only the mouse motions are removed.
+void Coalesce(std::vector<Task>* tasks, bool motions_only = false) {
+  std::vector<bool> superseded(tasks->size(), false);
+  std::unordered_set<int> keys;
+  bool animation = false;
+  Event* next_event = nullptr;
+  for (size_t i = tasks->size(); i-- > 0;) {
+    Task& task = (*tasks)[i];
+    if (auto* event = std::get_if<Event>(&task)) {
+      superseded[i] = next_event && IsSupersededMotion(*event, *next_event);
+      next_event = event;
+    } else if (motions_only) {
+      continue;
+    } else if (std::holds_alternative<AnimationTask>(task)) {
+      superseded[i] = animation;
+      animation = true;
+    } else if (auto* closure = std::get_if<LatestClosure>(&task)) {
+      superseded[i] = !keys.insert(closure->key).second;
+    }
+  }
+
+  size_t size = 0;
+  for (size_t i = 0; i < tasks->size(); ++i) {
+    if (!superseded[i]) {
+      (*tasks)[size++] = std::move((*tasks)[i]);
+    }
+  }
+  tasks->resize(size);
+}
+
+// The lane of |task|. The lower ones are handled first: the input, then the
+// closures, the animation frames, and the background closures.
+int Lane(const Task& task) {
+  if (std::holds_alternative<Event>(task) ||
+      std::holds_alternative<TargetedEvent>(task)) {
+    return 0;
+  }
+  if (std::holds_alternative<AnimationTask>(task)) {
+    return 2;
+  }
+  if (std::holds_alternative<BackgroundClosure>(task)) {
+    return 3;
+  }
+  return 1;
+}
+
+// Order |tasks| by lane. The tasks of the same lane keep their order.
+void SortByLane(std::vector<Task>* tasks) {
+  auto by_lane = [](const Task& a, const Task& b) { return Lane(a) < Lane(b); };
+  if (!std::is_sorted(tasks->begin(), tasks->end(), by_lane)) {
+    std::stable_sort(tasks->begin(), tasks->end(), by_lane);
+  }
+}
+
+// Compute the sequences moving the cursor from the bottom right corner of
+// |screen| to its cursor, and back. This is useful for users using tools to
+// insert CJK characters.
+void CursorSequences(const Screen& screen,
+                     int terminal_dimx,
+                     std::string* set_cursor_position,
+                     std::string* reset_cursor_position) {
+  const Screen::Cursor cursor = screen.cursor();
+  const int dx =
+      screen.dimx() - 1 - cursor.x + int(screen.dimx() != terminal_dimx);
+  const int dy = screen.dimy() - 1 - cursor.y;
+
+  set_cursor_position->clear();
+  reset_cursor_position->clear();
+
+  if (dy != 0) {
+    *set_cursor_position += "\x1B[" + std::to_string(dy) + "A";
+    *reset_cursor_position += "\x1B[" + std::to_string(dy) + "B";
+  }
+
+  if (dx != 0) {
+    *set_cursor_position += "\x1B[" + std::to_string(dx) + "D";
+    *reset_cursor_position += "\x1B[" + std::to_string(dx) + "C";
+  }
+
+  if (cursor.shape == Screen::Cursor::Hidden) {
+    *set_cursor_position += "\033[?25l";
+  } else {
+    *set_cursor_position += "\033[?25h";
+    *set_cursor_position += "\033[" + std::to_string(int(cursor.shape)) + " q";
+  }
+}
+
+// Append the |elements| printed over |dimx| columns, each followed by a new
+// line.
+void SerializeCommitted(std::vector<Element>& elements,
+                        int dimx,
+                        std::string& output) {
+  for (Element& element : elements) {
+    auto screen =
+        Screen::Create(Dimension::Fixed(dimx), Dimension::Fit(element));
+    Render(screen, element);
+    screen.ToString(output, Terminal::ColorSupport(),
+                    Terminal::CompressionSupport());
+    output += "\r\n";
   }
 }
 
+// The |percent| percentile of |durations|, reordered. Zero when empty.
+animation::Duration Percentile(std::vector<animation::Duration>* durations,
+                               size_t percent) {
+  if (durations->empty()) {
+    return {};
+  }
+  const size_t index =
+      std::min(durations->size() * percent / 100, durations->size() - 1);
+  std::nth_element(durations->begin(),
+                   durations->begin() + std::ptrdiff_t(index),
+                   durations->end());
+  return (*durations)[index];
+}
+
 }  // namespace
 
+// Serializes the frames and writes them to the terminal, on its own thread,
+// while the next ones are rendered. A frame submitted before the previous one
+// was picked up replaces it.
+class ScreenInteractive::OutputThread {
+ public:
+  // |dimx|, |dimy| are the dimensions of the drawing currently displayed.
+  // When |drop_stale_frames|, a frame is only written once the terminal has
+  // consumed the previous one. With |scroll|, the rows shifted are scrolled,
+  // see Screen::ToStringDiff.
+  OutputThread(int dimx,
+               int dimy,
+               std::string reset_cursor_position,
+               bool drop_stale_frames,
+               bool scroll)
+      : drop_stale_frames_(drop_stale_frames),
+        scroll_(scroll),
+        printed_(dimx, dimy),
+        reset_cursor_position_(std::move(reset_cursor_position)) {
+    thread_ = std::thread([this] { Run(); });
+  }
+
+  ~OutputThread() { Stop(); }
+
+  OutputThread(const OutputThread&) = delete;
+  OutputThread& operator=(const OutputThread&) = delete;
+
+  // Hand |frame| over to be written. In exchange, |frame| receives a screen of
+  // the same dimensions, with unspecified content.
+  void Submit(Screen* frame,
+              bool clear,
+              bool request_cursor_position,
+              int terminal_dimx,
+              bool synchronized,
+              std::string modes,
+              std::string committed) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (pending_.dimx() != frame->dimx() ||
+          pending_.dimy() != frame->dimy()) {
+        pending_.Resize(frame->dimx(), frame->dimy());
+      }
+      std::swap(*frame, pending_);
+      // The requests of a replaced frame are carried over.
+      pending_clear_ = clear || (has_pending_ && pending_clear_);
+      pending_request_cursor_position_ =
+          request_cursor_position ||
+          (has_pending_ && pending_request_cursor_position_);
+      pending_terminal_dimx_ = terminal_dimx;
+      pending_synchronized_ = synchronized;
+      // The modes of a replaced frame are carried over, in order.
+      if (!has_pending_) {
+        pending_modes_.clear();
+      }
+      pending_modes_ += modes;
+      // The committed output of a replaced frame is carried over, in order.
+      if (!has_pending_) {
+        pending_committed_.clear();
+      }
+      pending_committed_ += committed;
+      if (has_pending_) {
+        ++dropped_;
+      }
+      has_pending_ = true;
+    }
+    condition_.notify_one();
+  }
+
+  // Add the frames dropped, the stalls and the bytes written since the
+  // previous call to |metrics|.
+  void TakeMetrics(FrameMetrics* metrics) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    metrics->frames_skipped += std::exchange(dropped_, 0);
+    metrics->write_stalls += std::exchange(stalls_, 0);
+    metrics->bytes += std::exchange(bytes_, 0);
+  }
+
+  // Write the pending frame, and stop the thread. Return the sequence moving
+  // the cursor back to the bottom right corner of the drawing.
+  std::string Stop() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    condition_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    return std::move(reset_cursor_position_);
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_.wait(lock, [this] { return has_pending_ || stopped_; });
+      if (!has_pending_) {
+        return;
+      }
+      // Meanwhile, the newer frames replace the pending one.
+      if (drop_stale_frames_ && !stopped_ && OutputBusy()) {
+        ++stalls_;
+        while (!stopped_ && OutputBusy()) {
+          condition_.wait_for(lock, output_poll_interval);
+        }
+      }
+      std::swap(frame_, pending_);
+      has_pending_ = false;
+      const bool clear = pending_clear_;
+      const bool request_cursor_position = pending_request_cursor_position_;
+      const int terminal_dimx = pending_terminal_dimx_;
+      const bool synchronized = pending_synchronized_;
+      std::swap(modes_, pending_modes_);
+      std::swap(committed_, pending_committed_);
+      lock.unlock();
+      const size_t bytes =
+          Write(clear, request_cursor_position, terminal_dimx, synchronized);
+      lock.lock();
+      bytes_ += bytes;
+    }
+  }
+
+  // Return the number of bytes written.
+  size_t Write(bool clear,
+               bool request_cursor_position,
+               int terminal_dimx,
+               bool synchronized) {
+    FTXUI_TRACE("Output");
+    output_ += modes_;
+    if (synchronized) {
+      output_ += Set({DECMode::kSynchronizedOutput});
+    }
+    output_ += reset_cursor_position_;
+    output_ += printed_.ResetPosition(clear);
+    // The committed output takes the place of the frame, printed below it.
+    output_ += committed_;
+    if (request_cursor_position) {
+      output_ += DeviceStatusReport(DSRMode::kCursor);
+    }
+    if (printed_valid_ && committed_.empty() &&
+        printed_.dimx() == frame_.dimx() && printed_.dimy() == frame_.dimy()) {
+      frame_.ToStringDiff(printed_, output_, Terminal::ColorSupport(),
+                          scroll_ && Terminal::ScrollRegionSupport(),
+                          Terminal::CompressionSupport());
+    } else {
+      frame_.ToString(output_, Terminal::ColorSupport(),
+                      Terminal::CompressionSupport());
+    }
+    CursorSequences(frame_, terminal_dimx, &set_cursor_position_,
+                    &reset_cursor_position_);
+    output_ += set_cursor_position_;
+    if (synchronized) {
+      output_ += Reset({DECMode::kSynchronizedOutput});
+    }
+    const size_t bytes = output_.size();
+    Flush(output_);
+
+    std::swap(printed_, frame_);
+    printed_valid_ = true;
+    return bytes;
+  }
+
+  const bool drop_stale_frames_;
+  const bool scroll_;
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  // Guarded by |mutex_|:
+  Screen pending_ = Screen(0, 0);
+  bool has_pending_ = false;
+  bool pending_clear_ = false;
+  bool pending_request_cursor_position_ = false;
+  int pending_terminal_dimx_ = 0;
+  bool pending_synchronized_ = false;
+  std::string pending_modes_;
+  std::string pending_committed_;
+  bool stopped_ = false;
+  size_t dropped_ = 0;  // The pending frames replaced by newer ones.
+  size_t stalls_ = 0;   // The frames waiting for the terminal.
+  size_t bytes_ = 0;    // Written.
+
+  // Owned by the thread:
+  Screen frame_ = Screen(0, 0);
+  Screen printed_;
+  bool printed_valid_ = false;
+  std::string modes_;      // The modes to set before the frame.
+  std::string committed_;  // The output printed once, above the frame.
+  std::string output_;
+  std::string set_cursor_position_;
+  std::string reset_cursor_position_;
+};
+
+// Runs the work of Async() on background threads, started on demand, up to
+// |max_threads|. The continuations are handed to |post|.
+class ScreenInteractive::Executor {
+ public:
+  Executor(int max_threads, std::function<void(Closure)> post)
+      : post_(std::move(post)), max_threads_(max_threads) {}
+
+  // The work not started yet is dropped. The one running is waited for.
+  ~Executor() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+      queue_.clear();
+    }
+    condition_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  Executor(const Executor&) = delete;
+  Executor& operator=(const Executor&) = delete;
+
+  void SetMaxThreads(int max_threads) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    max_threads_ = max_threads;
+  }
+
+  void Run(Closure work, Closure on_done) {
+#if defined(__EMSCRIPTEN__) || defined(FTXUI_NO_THREADS)
+    work();
+    if (on_done) {
+      post_(std::move(on_done));
+    }
+#else
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back({std::move(work), std::move(on_done)});
+      // A thread is started when the idle ones can't take the work.
+      if (int(queue_.size()) > idle_ && int(threads_.size()) < max_threads_) {
+        idle_++;
+        threads_.emplace_back([this] { Loop(); });
+      }
+    }
+    condition_.notify_one();
+#endif
+  }
+
+ private:
+  void Loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_.wait(lock, [&] { return quit_ || !queue_.empty(); });
+      if (quit_) {
+        return;
+      }
+      auto [work, on_done] = std::move(queue_.front());
+      queue_.pop_front();
+      idle_--;
+      lock.unlock();
+      work();
+      if (on_done) {
+        post_(std::move(on_done));
+      }
+      lock.lock();
+      idle_++;
+    }
+  }
+
+  std::function<void(Closure)> post_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  // Guarded by |mutex_|:
+  int max_threads_ = 1;
+  int idle_ = 0;
+  std::deque<std::pair<Closure, Closure>> queue_;
+  bool quit_ = false;
+};
+
 ScreenInteractive::ScreenInteractive(int dimx,
                                      int dimy,
                                      Dimension dimension,
-                                     bool use_alternative_screen)
+                                     bool use_alternative_screen,
+                                     bool headless)
     : Screen(dimx, dimy),
       dimension_(dimension),
-      use_alternative_screen_(use_alternative_screen) {
+      use_alternative_screen_(use_alternative_screen),
+      headless_(headless) {
   task_receiver_ = MakeReceiver<Task>();
+  background_threads_ = std::max(int(std::thread::hardware_concurrency()), 1);
+#if defined(FTXUI_NO_MOUSE)
+  track_mouse_ = false;
+#endif
 }
 
 // static
@@ -418,13 +1362,72 @@ ScreenInteractive ScreenInteractive::FitComponent() {
   };
 }
 
+/// @ingroup component
+/// @brief Create a ScreenInteractive of a fixed size, not attached to the
+/// terminal. This is meant for tests and benchmarks driving the loop
+/// deterministically:
+/// - The terminal is left untouched. No signal handler is installed.
+/// - The input is given by `HeadlessInput()`, as the terminal would send it.
+/// - The output is captured, and returned by `HeadlessOutput()`.
+/// - The time only passes with `HeadlessAdvanceTime()`. The blocking loop
+///   doesn't wait for the deadlines, it jumps to them.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Headless(80, 24);
+/// Loop loop(&screen, component);
+/// screen.HeadlessInput("\x1B[B");  // Arrow down.
+/// loop.RunOnce();
+/// std::string frame = screen.HeadlessOutput();
+/// ```
+// static
+ScreenInteractive ScreenInteractive::Headless(int dimx, int dimy) {
+  return {
+      dimx,
+      dimy,
+      Dimension::Fixed,
+      false,
+      true,
+  };
+}
+
+/// @ingroup component
+/// @brief Append bytes to the input of a Headless() screen, as if the terminal
+/// sent them. They are parsed by the next run of the loop. This must be called
+/// from the thread running the loop.
+/// @param input The bytes, including the escape sequences.
+void ScreenInteractive::HeadlessInput(std::string_view input) {
+  headless_input_ += input;
+}
+
+/// @ingroup component
+/// @brief Return, and forget, what a Headless() screen wrote to the terminal
+/// since the previous call. This must be called from the thread running the
+/// loop.
+std::string ScreenInteractive::HeadlessOutput() {
+  std::string output;
+  std::swap(output, headless_output_);
+  return output;
+}
+
+/// @ingroup component
+/// @brief Advance the clock of a Headless() screen. It drives the animations,
+/// the frame rate limit, and the completion of the escape sequences.
+/// @param duration The time elapsed.
+void ScreenInteractive::HeadlessAdvanceTime(animation::Duration duration) {
+  headless_time_ +=
+      std::chrono::duration_cast<animation::Clock::duration>(duration);
+}
+
 /// @ingroup component
 /// @brief Set whether mouse is tracked and events reported.
 /// called outside of the main loop. E.g `ScreenInteractive::Loop(...)`.
 /// @param enable Whether to enable mouse event tracking.
 /// @note This muse be called outside of the main loop. E.g. before calling
 /// `ScreenInteractive::Loop`.
-/// @note Mouse tracking is enabled by default.
+/// @note Mouse tracking is enabled by default. It is never enabled when FTXUI is
+/// built with `FTXUI_ENABLE_MOUSE=OFF`.
 /// @note Mouse tracking is only supported on terminals that supports it.
 ///
 /// ### Example
@@ -435,12 +1438,426 @@ ScreenInteractive ScreenInteractive::FitComponent() {
 /// screen.Loop(component);
 /// ```
 void ScreenInteractive::TrackMouse(bool enable) {
+#if defined(FTXUI_NO_MOUSE)
+  std::ignore = enable;
+#else
   track_mouse_ = enable;
+#endif
+}
+
+/// @ingroup component
+/// @brief Set whether the mouse motions are throttled. When enabled:
+/// - The terminal only reports the motions while a button is pressed, or while
+///   a component holds `CaptureMouse()`. Hovering the screen doesn't produce
+///   any event otherwise.
+/// - The frames following a motion are limited by `LimitFrameRate()`, like the
+///   ones following an `Event::Custom`. The other mouse events are still drawn
+///   immediately.
+///
+/// This avoids redrawing the screen hundreds of times per second, while the
+/// mouse sweeps across a large terminal. The components relying on hovering,
+/// like the highlight of a `Button`, are only updated on clicks and drags.
+/// @param enable Whether to throttle the mouse motions.
+/// @note This must be called outside of the main loop.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.ThrottleMouseMotion();
+/// screen.LimitFrameRate(30);
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::ThrottleMouseMotion(bool enable) {
+  throttle_mouse_motion_ = enable;
+}
+
+/// @ingroup component
+/// @brief Set whether the Elements of each frame are allocated from an arena.
+/// The memory is reused from one frame to the next, instead of allocating and
+/// freeing every Node individually.
+/// @param enable Whether to use an arena.
+/// @note Elements kept across frames, for instance by `Memo`, remain valid.
+/// The memory they use is released once they are destroyed.
+/// @see NodeArena
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.UseNodeArena();
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::UseNodeArena(bool enable) {
+  use_node_arena_ = enable;
+}
+
+/// @ingroup component
+/// @brief Record the Nodes created by each frame into |profiler|. Every frame
+/// is a NodeProfiler::Scope. nullptr stops the profiling.
+/// @param profiler The profiler. It must outlive the loop.
+/// @see NodeProfiler, ProfileNodes
+///
+/// ### Example
+///
+/// ```cpp
+/// NodeProfiler profiler;
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.UseNodeProfiler(&profiler);
+/// screen.Loop(component);
+/// std::cerr << profiler.ToString();
+/// ```
+void ScreenInteractive::UseNodeProfiler(NodeProfiler* profiler) {
+  node_profiler_ = profiler;
+}
+
+/// @ingroup component
+/// @brief Record the time spent in the Render() and OnEvent() of the
+/// components decorated by ProfileComponent into |profiler|. nullptr stops the
+/// profiling.
+/// @param profiler The profiler. It must outlive the loop.
+/// @see ComponentProfiler, ProfileComponent
+///
+/// ### Example
+///
+/// ```cpp
+/// ComponentProfiler profiler;
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.UseComponentProfiler(&profiler);
+/// screen.Loop(component | ProfileComponent("root"));
+/// std::cerr << profiler.FoldedStacks();
+/// ```
+void ScreenInteractive::UseComponentProfiler(ComponentProfiler* profiler) {
+  component_profiler_ = profiler;
+}
+
+/// @ingroup component
+/// @brief Record the raw input read from the terminal and the size of the
+/// frames written, with their time, into |recording|. The cost is an append to
+/// a buffer per read and per frame. The recording can be replayed into a
+/// Headless() screen, to reproduce a session as a deterministic benchmark.
+/// @param recording The recording. It must outlive the loop. nullptr disables
+/// the recording.
+/// @see SessionRecording
+///
+/// ### Example
+///
+/// ```cpp
+/// SessionRecording recording;
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.RecordSession(&recording);
+/// screen.Loop(component);
+/// std::ofstream("session.ftxr", std::ios::binary) << recording.Data();
+/// ```
+void ScreenInteractive::RecordSession(SessionRecording* recording) {
+  session_recording_ = recording;
+}
+
+/// @ingroup component
+/// @brief Set whether the pending tasks are coalesced before being handled.
+/// When enabled, the tasks superseded by a later one received at the same time
+/// are dropped:
+/// - A mouse motion event, when the next event is another one with the same
+///   buttons and modifiers. Only the latest position is dispatched.
+/// - An animation frame, followed by another one.
+/// - A `LatestClosure`, followed by another one with the same key.
+///
+/// This avoids falling behind when events arrive faster than they are handled.
+/// @param enable Whether to coalesce tasks.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.CoalesceTasks();
+/// std::thread worker([&] {
+///   for (int i = 0; i < 1000; ++i) {
+///     screen.Post(LatestClosure{0, [&, i] { progress = i; }});
+///   }
+/// });
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::CoalesceTasks(bool enable) {
+  coalesce_tasks_ = enable;
+}
+
+/// @ingroup component
+/// @brief Limit the number of frames drawn per second.
+/// The updates received in between two frames are drawn together, by the next
+/// one. Frames following an input event are drawn immediately, to keep the
+/// latency low. The drags of a component holding `CaptureMouse()` are the
+/// exception: they are drawn at the frame rate, and only the latest position
+/// received is dispatched.
+/// @param max_frame_rate The maximum number of frames per second. Zero, the
+/// default, means no limit.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.LimitFrameRate(30);
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::LimitFrameRate(float max_frame_rate) {
+  min_frame_interval_ = max_frame_rate > 0.F
+                            ? animation::Duration(1.F / max_frame_rate)
+                            : animation::Duration(0);
+}
+
+/// @ingroup component
+/// @brief Let an external event loop wait for the input, instead of a
+/// dedicated thread. This is meant for applications already running an event
+/// loop, for instance with epoll. The screen is driven using `Loop`:
+/// - `Loop::InputFileDescriptor()` and `Loop::WakeUpFileDescriptor()` are the
+///   file descriptors to wait for, until they become readable.
+/// - `Loop::NextDeadline()` is the time to wait until, at most.
+/// - `Loop::RunOnce()` must be called afterward. It reads the input available,
+///   and handles the pending tasks.
+///
+/// This is only supported on Linux and Mac. It is ignored elsewhere, and the
+/// file descriptors are -1.
+/// @param enable Whether the input is read by an external event loop.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.ExternalEventLoop();
+/// Loop loop(&screen, component);
+/// while (!loop.HasQuitted()) {
+///   // Wait for loop.InputFileDescriptor(), loop.WakeUpFileDescriptor() and
+///   // the application's own file descriptors, until loop.NextDeadline().
+///   loop.RunOnce();
+/// }
+/// ```
+void ScreenInteractive::ExternalEventLoop(bool enable) {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  std::ignore = enable;
+#else
+  external_event_loop_ = enable;
+#endif
+}
+
+/// @ingroup component
+/// @brief Read the terminal input from the thread running the loop, instead of
+/// a dedicated thread. The loop waits for the input and for the posted tasks
+/// at once. No thread is started when the loop starts, nor joined when it
+/// exits, which makes the startup and the teardown of short lived prompts
+/// faster.
+///
+/// This is only supported on Linux and Mac. It is ignored elsewhere.
+/// @param enable Whether to read the input from the loop thread.
+/// @see ExternalEventLoop
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::TerminalOutput();
+/// screen.ReadInputOnLoopThread();
+/// screen.Loop(prompt);
+/// ```
+void ScreenInteractive::ReadInputOnLoopThread(bool enable) {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  std::ignore = enable;
+#else
+  read_input_on_loop_thread_ = enable;
+#endif
+}
+
+/// @ingroup component
+/// @brief Skip the frames while the terminal hasn't consumed the previous one,
+/// and draw the latest state once it did. Without this, when the terminal is
+/// slower than the application, for instance over SSH, the frames queue up
+/// and the latency between an input and its display grows.
+///
+/// This is only supported on Linux and Mac, where the output queue is known.
+/// It has no effect elsewhere.
+/// @param enable Whether the frames are dropped while the output is busy.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.DropStaleFrames();
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::DropStaleFrames(bool enable) {
+  drop_stale_frames_ = enable;
+}
+
+/// @ingroup component
+/// @brief Ask the terminal what it supports, instead of only guessing it from
+/// the environment variables. This matters over SSH, where they aren't
+/// forwarded.
+///
+/// When the loop starts, the terminal is asked its name (XTVERSION) and its
+/// capabilities (XTGETTCAP): the true colors, REP, ECH and the scrolling
+/// regions. The loop doesn't wait for the answers. They update
+/// `Terminal::ColorSupport()`, `Terminal::CompressionSupport()` and
+/// `Terminal::ScrollRegionSupport()` as they arrive, so that the cheapest
+/// sequences supported are used. A terminal not answering keeps the support
+/// guessed. The terminal is only asked once per process.
+/// @param enable Whether the terminal is asked.
+void ScreenInteractive::ProbeTerminal(bool enable) {
+  probe_terminal_ = enable;
+}
+
+/// @ingroup component
+/// @brief Serialize and write the frames to the terminal on a dedicated
+/// thread. The next frame is rendered meanwhile, so that a slow terminal
+/// doesn't delay the handling of the events. When the terminal can't keep up,
+/// the frames rendered while the previous one is still being written are
+/// dropped, except for the latest.
+/// It is ignored when FTXUI is built with `FTXUI_ENABLE_THREADS=OFF`.
+/// @param enable Whether the frames are written by a dedicated thread.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.ThreadedOutput();
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::ThreadedOutput(bool enable) {
+#if defined(FTXUI_NO_THREADS)
+  std::ignore = enable;
+#else
+  threaded_output_ = enable;
+#endif
+}
+
+/// @ingroup component
+/// @brief Measure where the time goes while drawing each frame. The
+/// statistics of the last frame are returned by `LastFrameStats()`.
+///
+/// With `ThreadedOutput()`, the serialization and the write happen on another
+/// thread. They aren't measured.
+/// @param enable Whether the frames are measured.
+void ScreenInteractive::CollectFrameStats(bool enable) {
+  collect_frame_stats_ = enable;
+}
+
+/// @ingroup component
+/// @brief Measure every frame, and call |on_frame| with its statistics right
+/// after it is drawn. See `CollectFrameStats()`.
+/// @param on_frame Called with the statistics of every frame.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// std::vector<float> frame_times;
+/// screen.OnFrameStats([&](const FrameStats& stats) {
+///   frame_times.push_back(stats.total.count());
+/// });
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::OnFrameStats(
+    std::function<void(const FrameStats&)> on_frame) {
+  collect_frame_stats_ = true;
+  on_frame_stats_ = std::move(on_frame);
+}
+
+/// @ingroup component
+/// @brief Aggregate counters about the frames, the tasks and the output, and
+/// call |on_metrics| with them every |period|, to forward them to a
+/// monitoring system. The counters are reset after each call.
+///
+/// The frames are measured, as with `CollectFrameStats()`. The callback runs
+/// on the thread running the loop, even while it is idle.
+/// @param period The time between two calls.
+/// @param on_metrics Called with the counters of the period elapsed.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.ExportMetrics(std::chrono::seconds(10),
+///                      [&](const FrameMetrics& metrics) {
+///                        monitoring.Gauge("p99", metrics.frame_time_p99);
+///                        monitoring.Count("bytes", metrics.bytes);
+///                      });
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::ExportMetrics(
+    animation::Duration period,
+    std::function<void(const FrameMetrics&)> on_metrics) {
+  collect_frame_stats_ = true;
+  metrics_period_ = period;
+  on_metrics_ = std::move(on_metrics);
+  metrics_start_ = Now();
+  metrics_ = FrameMetrics();
+  frame_times_.clear();
+}
+
+/// @ingroup component
+/// @brief The statistics of the last frame drawn. See `CollectFrameStats()`.
+const FrameStats& ScreenInteractive::LastFrameStats() const {
+  return frame_stats_;
+}
+
+/// @ingroup component
+/// @brief Copy the frames into a CellBuffer, instead of writing them to the
+/// terminal as escape sequences. A renderer draws the cells directly.
+///
+/// With WebAssembly, the cells of the active screen are read by JavaScript
+/// from the module's memory, through these exported functions:
+/// - `ftxui_cells()`, `ftxui_cells_dimx()` and `ftxui_cells_dimy()`.
+/// - `ftxui_cells_frame()` and `ftxui_cells_row_frames()`: the rows changed
+///   since the last frame drawn.
+/// - `ftxui_cells_cursor()`, and `ftxui_cells_grapheme(id)`.
+///
+/// They are read without a lock: a row read while it is being written is
+/// marked as changed again, and is drawn again next time.
+/// The input is still read from the terminal: the renderer sends the keys and
+/// the mouse events as escape sequences.
+/// @param enable Whether the frames are exported as cells.
+/// @see CellBuffer
+///
+/// ### Example
+///
+/// ```js
+/// const frame = Module._ftxui_cells_frame();
+/// if (frame != last_frame) {
+///   const dimx = Module._ftxui_cells_dimx();
+///   const cells = Module._ftxui_cells() / 4;
+///   const rows = Module._ftxui_cells_row_frames() / 4;
+///   for (let y = 0; y < Module._ftxui_cells_dimy(); ++y) {
+///     if (Module.HEAPU32[rows + y] > last_frame) {
+///       DrawRow(Module.HEAPU32.subarray(cells + y * dimx * 4,
+///                                       cells + (y + 1) * dimx * 4));
+///     }
+///   }
+///   last_frame = frame;
+/// }
+/// ```
+void ScreenInteractive::ExportCells(bool enable) {
+  export_cells_ = enable;
+}
+
+/// @ingroup component
+/// @brief The cells of the last frame drawn. See `ExportCells()`.
+const CellBuffer& ScreenInteractive::ExportedCells() const {
+  return exported_cells_;
 }
 
 /// @brief Add a task to the main loop.
-/// It will be executed later, after every other scheduled tasks.
+/// It will be executed later. The pending tasks are handled by lanes: first
+/// the events, then the closures, the animation frames, and last the
+/// `BackgroundClosure`. Within a lane, they are handled in the order they were
+/// posted. Together with `Loop::RunOnce(deadline)`, this keeps the input
+/// responsive while a lot of background work is posted.
 /// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// std::thread refresh([&] {
+///   for (Row& row : FetchRows()) {
+///     screen.Post(BackgroundClosure{[&, row] { table.Insert(row); }});
+///   }
+/// });
+/// ```
 void ScreenInteractive::Post(Task task) {
   // Task/Events sent toward inactive screen or screen waiting to become
   // inactive are dropped.
@@ -449,6 +1866,9 @@ void ScreenInteractive::Post(Task task) {
   }
 
   task_sender_->Send(std::move(task));
+  if (InputOnLoopThread()) {
+    WakeUp();
+  }
 }
 
 /// @brief Add an event to the main loop.
@@ -458,18 +1878,152 @@ void ScreenInteractive::PostEvent(Event event) {
   Post(event);
 }
 
+/// @brief Add an event to the main loop, delivered to |target| only.
+/// Contrary to PostEvent(event), it doesn't travel through the whole component
+/// tree. |target| is invalidated, see ComponentBase::Invalidate(). The event is
+/// dropped if |target| is destroyed before it is handled.
+/// @param target The component receiving the event.
+/// @param event The event.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto bar = Renderer([&] { return gauge(progress); }) |
+///            CatchEvent([&](Event event) { ... });
+/// // From the backend thread:
+/// screen.PostEvent(bar, Event::Special("progress"));
+/// ```
+void ScreenInteractive::PostEvent(const Component& target, Event event) {
+  Post(TargetedEvent{target, std::move(event)});
+}
+
 /// @brief Add a task to draw the screen one more time, until all the animations
 /// are done.
+/// @brief Print |element| once, above the frame, and never draw it again. It
+/// goes to the scrollback of the terminal, like the lines of a log, while only
+/// the frame below is drawn again. The cost of a frame doesn't depend on how
+/// much was committed before.
+///
+/// The element is printed with the next frame, over the width of the
+/// terminal. It is dropped when using the alternate screen, or ExportCells().
+/// Call it from the loop thread, or through Post().
+///
+/// ### Example
+///
+/// ```cpp
+/// screen.Post([&, line] { screen.Commit(text(line)); });
+/// ```
+void ScreenInteractive::Commit(Element element) {
+  committed_.push_back(std::move(element));
+  frame_valid_ = false;
+}
+
+/// @brief Ask the terminal where the frame is displayed again, with the next
+/// frame. Call it after writing to the terminal outside of the screen, which
+/// may have moved the frame. The mouse events are reported relative to it.
+/// Resizes and WithRestoredIO() already do it.
+void ScreenInteractive::RequestCursorPosition() {
+  cursor_position_stale_ = true;
+}
+
+/// @brief Run |closure| once on the loop thread, after |delay|.
+/// The timers share the wait of the main loop: they cost no thread, and the
+/// frame is drawn again after them.
+/// Call it from the loop thread, or through Post().
+/// @return An id for ClearTimer().
+int ScreenInteractive::SetTimeout(Closure closure, animation::Duration delay) {
+  const int id = ++next_timer_id_;
+  timers_.emplace(
+      Now() + std::chrono::duration_cast<animation::Clock::duration>(delay),
+      Timer{id, animation::Duration(0), std::move(closure)});
+  return id;
+}
+
+/// @brief Run |closure| on the loop thread every |period|, until ClearTimer().
+/// The periods missed while the loop was busy are skipped, not run in a burst.
+/// Call it from the loop thread, or through Post().
+///
+/// ### Example
+///
+/// ```cpp
+/// screen.SetInterval([&] { shift++; }, std::chrono::milliseconds(50));
+/// ```
+/// @return An id for ClearTimer().
+int ScreenInteractive::SetInterval(Closure closure,
+                                   animation::Duration period) {
+  const int id = ++next_timer_id_;
+  timers_.emplace(
+      Now() + std::chrono::duration_cast<animation::Clock::duration>(period),
+      Timer{id, period, std::move(closure)});
+  return id;
+}
+
+/// @brief Cancel a timer returned by SetTimeout() or SetInterval().
+void ScreenInteractive::ClearTimer(int id) {
+  for (auto it = timers_.begin(); it != timers_.end(); ++it) {
+    if (it->second.id == id) {
+      timers_.erase(it);
+      return;
+    }
+  }
+}
+
+/// @brief Run |work| on a background thread, then |on_done| on the loop
+/// thread, through the task queue. The threads are owned by the screen,
+/// started on demand, up to BackgroundThreads(). Like Post(), the
+/// continuations finishing while the loop isn't running are dropped.
+/// Destroying the screen drops the work not started yet, and waits for the one
+/// running.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto result = std::make_shared<std::vector<std::string>>();
+/// screen.Async([result] { *result = Query(); },
+///              [&, result] { rows = std::move(*result); });
+/// ```
+void ScreenInteractive::Async(Closure work, Closure on_done) {
+  // The continuations are posted like the tasks of any other thread: holding
+  // a sender of our own would keep the loop from exiting.
+  if (!executor_) {
+    executor_ = std::make_shared<Executor>(
+        background_threads_, [this](Closure closure) { Post(closure); });
+  }
+  executor_->Run(std::move(work), std::move(on_done));
+}
+
+/// @brief Set the maximum number of threads running the work of Async().
+/// It defaults to the number of cores.
+/// @param count The number of threads, at least 1.
+void ScreenInteractive::BackgroundThreads(int count) {
+  background_threads_ = std::max(count, 1);
+  if (executor_) {
+    executor_->SetMaxThreads(background_threads_);
+  }
+}
+
+/// @brief Run |closure| on the loop thread, right after the next frame is
+/// drawn. The frame is requested. Call it from the loop thread, or through
+/// Post().
+void ScreenInteractive::AfterNextFrame(Closure closure) {
+  after_next_frame_.push_back(std::move(closure));
+  frame_valid_ = false;
+}
+
 void ScreenInteractive::RequestAnimationFrame() {
   if (animation_requested_) {
     return;
   }
   animation_requested_ = true;
-  auto now = animation::Clock::now();
+  auto now = Now();
   const auto time_histeresis = std::chrono::milliseconds(33);
   if (now - previous_animation_time_ >= time_histeresis) {
     previous_animation_time_ = now;
   }
+  // The animation frame is delivered by the main loop, once the deadline is
+  // reached.
+  animation_deadline_ = previous_animation_time_ + animation_interval;
 }
 
 /// @brief Try to get the unique lock about behing able to capture the mouse.
@@ -501,24 +2055,25 @@ bool ScreenInteractive::HasQuitted() {
 
 // private
 void ScreenInteractive::PreMain() {
-  // Suspend previously active screen:
+  // Suspend previously active screen. The terminal session is kept, and
+  // reused by this one.
   if (g_active_screen) {
     std::swap(suspended_screen_, g_active_screen);
     // Reset cursor position to the top of the screen and clear the screen.
     suspended_screen_->ResetCursorPosition();
-    std::cout << suspended_screen_->ResetPosition(/*clear=*/true);
-    suspended_screen_->dimx_ = 0;
-    suspended_screen_->dimy_ = 0;
-
-    // Reset dimensions to force drawing the screen again next time:
-    suspended_screen_->Uninstall();
+    g_output_buffer += suspended_screen_->ResetPosition(/*clear=*/true);
+    // Reset dimensions to force drawing the screen again next time. The
+    // memory of its frames is given back meanwhile.
+    suspended_screen_->ReleaseFrames();
+    suspended_screen_->Deactivate();
+    Flush();
   }
 
   // This screen is now active:
   g_active_screen = this;
   g_active_screen->Install();
 
-  previous_animation_time_ = animation::Clock::now();
+  previous_animation_time_ = Now();
 }
 
 // private
@@ -531,21 +2086,26 @@ void ScreenInteractive::PostMain() {
   // Restore suspended screen.
   if (suspended_screen_) {
     // Clear screen, and put the cursor at the beginning of the drawing.
-    std::cout << ResetPosition(/*clear=*/true);
-    dimx_ = 0;
-    dimy_ = 0;
-    Uninstall();
+    g_output_buffer += ResetPosition(/*clear=*/true);
+    ReleaseFrames();
+    Deactivate();
+    Flush();
     std::swap(g_active_screen, suspended_screen_);
     g_active_screen->Install();
   } else {
     Uninstall();
 
-    std::cout << '\r';
+    g_output_buffer += '\r';
     // On final exit, keep the current drawing and reset cursor position one
     // line after it.
     if (!use_alternative_screen_) {
-      std::cout << std::endl;
+      g_output_buffer += '\n';
+      // The elements committed after the last frame follow it.
+      SerializeCommitted(committed_, TerminalSize().dimx, g_output_buffer);
     }
+    committed_.clear();
+    Flush();
+    g_output_capture = nullptr;
   }
 }
 
@@ -568,24 +2128,135 @@ ScreenInteractive* ScreenInteractive::Active() {
 
 // private
 void ScreenInteractive::Install() {
+  g_output_capture = headless_ ? &headless_output_ : nullptr;
+  g_session_recording = session_recording_;
   frame_valid_ = false;
+  previous_frame_valid_ = false;
+  // The frame is printed again wherever the cursor was left, for instance by
+  // the output written while the terminal was restored.
+  cursor_position_stale_ = true;
+  // The terminal might have been resized while this screen was inactive.
+  terminal_size_valid_ = false;
+
+  // The nested screens reuse the session of the outermost one.
+  if (!g_session_started) {
+    InstallSession();
+  }
+
+  // Ask whether the terminal supports synchronized output. Until it answers,
+  // the frames are written without it.
+  synchronized_output_ = false;
+  g_output_buffer += RequestMode(DECMode::kSynchronizedOutput);
+
+  // Ask the terminal what it supports, once for the whole process. Meanwhile,
+  // the support guessed from the environment is used.
+  if (probe_terminal_ && !g_terminal_probe.started) {
+    g_terminal_probe.started = true;
+    g_terminal_probe.color = Terminal::ColorSupport();
+    g_terminal_probe.compression = Terminal::CompressionSupport();
+    g_output_buffer += TerminalProbeRequest();
+  }
+
+  std::map<DECMode, bool> modes = {
+      {DECMode::kLineWrap, false},
+      // Receive the pasted text as a single Event.
+      {DECMode::kBracketedPaste, true},
+  };
+  if (use_alternative_screen_) {
+    modes[DECMode::kAlternateScreen] = true;
+  }
+  if (track_mouse_) {
+    modes[DECMode::kMouseVt200] = true;
+    modes[throttle_mouse_motion_ ? DECMode::kMouseBtnEventMouse
+                                 : DECMode::kMouseAnyEvent] = true;
+    modes[DECMode::kMouseUrxvtMode] = true;
+    modes[DECMode::kMouseSgrExtMode] = true;
+  }
+  any_motion_reported_ = !throttle_mouse_motion_;
+  // Only the modes differing from the previous screen's are written, so that
+  // opening a nested screen doesn't flap the terminal modes.
+  g_output_buffer += SwitchModes(modes);
+
+  // After installing the new configuration, flush it to the terminal to
+  // ensure it is fully applied:
+  Flush();
+
+  task_sender_ = task_receiver_->MakeSender();
+  SetInputTarget(this, task_receiver_->MakeSender());
+
+#if defined(__EMSCRIPTEN__)
+  if (export_cells_) {
+    g_exported_cells = &exported_cells_;
+  }
+#endif
+
+  if (threaded_output_ && !headless_ && !export_cells_) {
+    output_thread_ = std::make_shared<OutputThread>(
+        dimx_, dimy_, std::move(reset_cursor_position), drop_stale_frames_,
+        /*scroll=*/dimension_ == Dimension::Fullscreen);
+    reset_cursor_position.clear();
+  }
+}
+
+// private
+// Start the terminal session: configure the terminal, and start reading the
+// input. Everything is restored by OnExit().
+void ScreenInteractive::InstallSession() {
+  g_session_started = true;
+  on_exit_functions.push([] { g_session_started = false; });
 
   // After uninstalling the new configuration, flush it to the terminal to
   // ensure it is fully applied:
   on_exit_functions.push([] { Flush(); });
 
-  on_exit_functions.push([this] { ExitLoopClosure()(); });
+  on_exit_functions.push([] {
+    if (g_active_screen) {
+      g_active_screen->ExitLoopClosure()();
+    }
+  });
 
   // Request the terminal to report the current cursor shape. We will restore it
   // on exit.
-  std::cout << DECRQSS_DECSCUSR;
-  on_exit_functions.push([=] {
-    std::cout << "\033[?25h";  // Enable cursor.
-    std::cout << "\033[" + std::to_string(cursor_reset_shape_) + " q";
+  g_output_buffer += DECRQSS_DECSCUSR;
+  on_exit_functions.push([] {
+    g_output_buffer += "\033[?25h";  // Enable cursor.
+    g_output_buffer += "\033[" + std::to_string(g_cursor_reset_shape) + " q";
+  });
+
+  // A headless screen leaves the terminal and the signal handlers alone.
+  if (!headless_) {
+    InstallTerminal();
+  }
+
+  on_exit_functions.push([] { g_output_buffer += SwitchModes({}); });
+
+  g_input_receiver = MakeReceiver<Task>();
+  g_input_quit = false;
+  OpenWakeUpPipe();
+  if (InputOnLoopThread() || headless_) {
+    g_input_parser =
+        std::make_unique<TerminalInputParser>(g_input_receiver->MakeSender());
+    g_input_parser_time = Now();
+  } else {
+    g_event_listener = std::thread(&EventListener, &g_input_quit,
+                                   g_input_receiver->MakeSender());
+  }
+  on_exit_functions.push([] {
+    g_input_quit = true;
+    WakeUp();
+    if (g_event_listener.joinable()) {
+      g_event_listener.join();
+    }
+    g_input_parser.reset();
+    SetInputTarget(nullptr, nullptr);
+    g_input_receiver.reset();
   });
+}
 
-  // Install signal handlers to restore the terminal state on exit. The default
-  // signal handlers are restored on exit.
+// private
+// Install signal handlers to restore the terminal state on exit. The default
+// signal handlers are restored on exit.
+void ScreenInteractive::InstallTerminal() {
   for (const int signal : {SIGTERM, SIGSEGV, SIGINT, SIGILL, SIGABRT, SIGFPE}) {
     InstallSignalHandler(signal);
   }
@@ -639,54 +2310,54 @@ void ScreenInteractive::Install() {
   // on_exit_functions.push([=] { fcntl(STDIN_FILENO, F_GETFL, oldf); });
 
   tcsetattr(STDIN_FILENO, TCSANOW, &terminal);
-
 #endif
+}
 
-  auto enable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Set(parameters);
-    on_exit_functions.push([=] { std::cout << Reset(parameters); });
-  };
-
-  auto disable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Reset(parameters);
-    on_exit_functions.push([=] { std::cout << Set(parameters); });
-  };
-
-  if (use_alternative_screen_) {
-    enable({
-        DECMode::kAlternateScreen,
-    });
+// private
+void ScreenInteractive::StopOutputThread() {
+  if (!output_thread_) {
+    return;
   }
+  reset_cursor_position = output_thread_->Stop();
+  output_thread_->TakeMetrics(&metrics_);
+  output_thread_.reset();
+}
 
-  disable({
-      // DECMode::kCursor,
-      DECMode::kLineWrap,
-  });
-
-  if (track_mouse_) {
-    enable({DECMode::kMouseVt200});
-    enable({DECMode::kMouseAnyEvent});
-    enable({DECMode::kMouseUrxvtMode});
-    enable({DECMode::kMouseSgrExtMode});
+// private
+// Return the sequence switching the motions reported by the terminal, when the
+// mouse was captured or released since the previous frame.
+std::string ScreenInteractive::UpdateMouseMotionMode() {
+  if (!track_mouse_ || !throttle_mouse_motion_ ||
+      mouse_captured == any_motion_reported_) {
+    return "";
   }
+  any_motion_reported_ = mouse_captured;
+  // Some terminals keep the tracking modes as independent flags, others as a
+  // single mode: reset the current one before setting the other.
+  if (any_motion_reported_) {
+    return SwitchMode(DECMode::kMouseAnyEvent, true);
+  }
+  return SwitchMode(DECMode::kMouseAnyEvent, false) +
+         Set({DECMode::kMouseBtnEventMouse});
+}
 
-  // After installing the new configuration, flush it to the terminal to
-  // ensure it is fully applied:
-  Flush();
-
-  quit_ = false;
-  task_sender_ = task_receiver_->MakeSender();
-  event_listener_ =
-      std::thread(&EventListener, &quit_, task_receiver_->MakeSender());
-  animation_listener_ =
-      std::thread(&AnimationListener, &quit_, task_receiver_->MakeSender());
+// private
+// Stop the threads of this screen, and stop receiving the input. The terminal
+// session is left to the next active screen.
+void ScreenInteractive::Deactivate() {
+  StopOutputThread();
+  ExitNow();
+#if defined(__EMSCRIPTEN__)
+  if (g_exported_cells == &exported_cells_) {
+    g_exported_cells = nullptr;
+  }
+#endif
 }
 
 // private
+// Restore the terminal, ending the session.
 void ScreenInteractive::Uninstall() {
-  ExitNow();
-  event_listener_.join();
-  animation_listener_.join();
+  Deactivate();
   OnExit();
 }
 
@@ -694,25 +2365,212 @@ void ScreenInteractive::Uninstall() {
 // NOLINTNEXTLINE
 void ScreenInteractive::RunOnceBlocking(Component component) {
   ExecuteSignalHandlers();
+  const animation::TimePoint deadline = NextDeadline();
+
+  // Nothing is waited for, but the tasks posted by other threads. The clock
+  // jumps to the deadline instead.
+  if (headless_) {
+    if (headless_input_.empty() && !task_receiver_->HasPending()) {
+      if (deadline != animation::TimePoint::max()) {
+        headless_time_ = std::max(headless_time_, deadline);
+      } else {
+        Task task;
+        if (task_receiver_->Receive(&task)) {
+          tasks_.push_back(std::move(task));
+        }
+      }
+    }
+    RunOnce(component);
+    return;
+  }
+
+  // Wait for the input, or for a task to be posted, until the deadline.
+  if (InputOnLoopThread()) {
+    if (!task_receiver_->HasPending()) {
+      long usec_timeout = -1;
+      if (deadline != animation::TimePoint::max()) {
+        usec_timeout = long(std::max(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                deadline - Now())
+                .count(),
+            std::chrono::microseconds::rep(0)));
+      }
+      bool woken_up = false;
+      std::ignore = WaitForInput(usec_timeout, &woken_up);
+    }
+    RunOnce(component);
+    return;
+  }
+
   Task task;
-  if (task_receiver_->Receive(&task)) {
-    HandleTask(component, task);
+  const bool received = deadline != animation::TimePoint::max()
+                            ? task_receiver_->ReceiveUntil(&task, deadline)
+                            : task_receiver_->Receive(&task);
+  if (received) {
+    tasks_.push_back(std::move(task));
   }
   RunOnce(component);
 }
 
 // private
-void ScreenInteractive::RunOnce(Component component) {
-  Task task;
-  while (task_receiver_->ReceiveNonBlocking(&task)) {
-    HandleTask(component, task);
-    ExecuteSignalHandlers();
+void ScreenInteractive::RunOnce(Component component,
+                                animation::TimePoint deadline) {
+  // Drain the pending tasks by batches, until none are left, since handling
+  // them may post new ones. The buffer is taken out of |tasks_|, in case a
+  // task runs this screen's loop again. It may already hold the task
+  // RunOnceBlocking waited for, or the ones left by the previous deadline.
+  const ComponentProfiler::Scope profiler_scope(
+      component_profiler_ ? component_profiler_ : ComponentProfiler::Current());
+  if (InputOnLoopThread() || headless_) {
+    ReadInputFromMainLoop(Now(), headless_ ? &headless_input_ : nullptr);
+  }
+  // The signals received while waiting woke the loop up. They are handled in
+  // this run, even without any task.
+  ExecuteSignalHandlers();
+  std::vector<Task> tasks = std::move(tasks_);
+  if (animation_requested_ && Now() >= animation_deadline_) {
+    tasks.emplace_back(AnimationTask());
+  }
+  RunTimers(&tasks);
+  task_receiver_->ReceiveAll(&tasks);
+  while (!tasks.empty()) {
+    const size_t pending = tasks.size();
+    if (coalesce_tasks_) {
+      Coalesce(&tasks);
+    } else if (mouse_captured) {
+      // A drag only needs the latest position.
+      Coalesce(&tasks, /*motions_only=*/true);
+    }
+    if (on_metrics_) {
+      metrics_.task_queue_high_water =
+          std::max(metrics_.task_queue_high_water, pending);
+      metrics_.tasks_coalesced += pending - tasks.size();
+    }
+    SortByLane(&tasks);
+    size_t handled = 0;
+    while (handled < tasks.size()) {
+      HandleTask(component, tasks[handled++]);
+      ExecuteSignalHandlers();
+      if (deadline != animation::TimePoint::max() && Now() >= deadline) {
+        break;
+      }
+    }
+    tasks_handled_ += handled;
+    metrics_.tasks += handled;
+    tasks.erase(tasks.begin(), tasks.begin() + std::ptrdiff_t(handled));
+    // Past the deadline, the remaining tasks are kept for the next run.
+    if (!tasks.empty()) {
+      break;
+    }
+    task_receiver_->ReceiveAll(&tasks);
+  }
+  tasks_ = std::move(tasks);
+  const bool backlogged = !frame_valid_ && OutputBacklogged();
+  if (FrameDeferred() || backlogged) {
+    if (!frame_held_) {
+      frame_held_ = true;
+      ++metrics_.frames_skipped;
+      metrics_.write_stalls += backlogged ? 1 : 0;
+    }
+    ReportMetrics();
+    return;
   }
+  input_handled_ = false;
   Draw(std::move(component));
+  for (auto& closure : std::exchange(after_next_frame_, {})) {
+    closure();
+  }
+  ReportMetrics();
+}
+
+// private
+// The time at which the main loop must run again, even without receiving any
+// task. This is the maximum TimePoint when there is none.
+animation::TimePoint ScreenInteractive::NextDeadline() const {
+  // The tasks left over by a deadline are handled without waiting.
+  if (!tasks_.empty()) {
+    return Now();
+  }
+  const bool deferred = FrameDeferred();
+  const bool backlogged = !frame_valid_ && OutputBacklogged();
+  // An invalidated frame is drawn without waiting, unless it is deferred.
+  if (!frame_valid_ && !deferred && !backlogged) {
+    return Now();
+  }
+  animation::TimePoint deadline = animation::TimePoint::max();
+  if (animation_requested_) {
+    deadline = animation_deadline_;
+  }
+  if (!timers_.empty()) {
+    deadline = std::min(deadline, timers_.begin()->first);
+  }
+  // A pending escape sequence is completed after a timeout.
+  if ((InputOnLoopThread() || headless_) && g_input_parser &&
+      g_input_parser->HasPending()) {
+    deadline = std::min(deadline, g_input_parser_time + std::chrono::milliseconds(
+                                                            timeout_milliseconds));
+  }
+  // A deferred frame must be drawn at the latest when its deadline is reached.
+  if (deferred) {
+    deadline = std::min(
+        deadline, previous_frame_time_ +
+                      std::chrono::duration_cast<animation::Clock::duration>(
+                          min_frame_interval_));
+  }
+  // A frame waiting for the terminal checks it again periodically.
+  if (backlogged) {
+    deadline =
+        std::min(deadline, Now() + output_poll_interval);
+  }
+  // The metrics are exported at the end of their period, even while idle.
+  if (on_metrics_) {
+    deadline = std::min(
+        deadline, metrics_start_ +
+                      std::chrono::duration_cast<animation::Clock::duration>(
+                          metrics_period_));
+  }
+  return deadline;
+}
+
+// private
+// Queue the closures of the timers due, and schedule the intervals again.
+void ScreenInteractive::RunTimers(std::vector<Task>* tasks) {
+  const animation::TimePoint now = Now();
+  while (!timers_.empty() && timers_.begin()->first <= now) {
+    auto node = timers_.extract(timers_.begin());
+    tasks->emplace_back(node.mapped().closure);
+    frame_valid_ = false;
+    if (node.mapped().period <= animation::Duration(0)) {
+      continue;
+    }
+    // Past the loop's delay, the intervals restart from now. The deadline
+    // stays ahead of |now|, so it isn't extracted again.
+    const auto period = std::chrono::duration_cast<animation::Clock::duration>(
+        node.mapped().period);
+    node.key() = std::max(node.key() + period, now + period);
+    timers_.insert(std::move(node));
+  }
+}
+
+// private
+// Whether the next frame is invalidated, and waits for the frame interval to
+// elapse.
+bool ScreenInteractive::FrameDeferred() const {
+  return !frame_valid_ && !input_handled_ &&
+         min_frame_interval_ > animation::Duration(0) &&
+         Now() - previous_frame_time_ < min_frame_interval_;
+}
+
+// private
+// Whether the frames must wait for the terminal to consume the previous ones.
+// The output thread, if any, waits by itself.
+bool ScreenInteractive::OutputBacklogged() const {
+  return drop_stale_frames_ && !output_thread_ && !headless_ && OutputBusy();
 }
 
 // private
 void ScreenInteractive::HandleTask(Component component, Task& task) {
+  FTXUI_TRACE("HandleTask");
   std::visit(
       [&](auto&& arg) {
         using T = std::decay_t<decltype(arg)>;
@@ -727,7 +2585,21 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
       }
 
       if (arg.is_cursor_shape()) {
-        cursor_reset_shape_= arg.cursor_shape();
+        g_cursor_reset_shape = arg.cursor_shape();
+        return;
+      }
+
+      if (arg.is_mode_report()) {
+        // 1: set, 2: reset. The other values mean it is unsupported.
+        if (arg.reported_mode() == int(DECMode::kSynchronizedOutput)) {
+          synchronized_output_ = arg.reported_mode_value() == 1 ||
+                                 arg.reported_mode_value() == 2;
+        }
+        return;
+      }
+
+      if (arg.is_terminal_report()) {
+        HandleTerminalReport(arg.input());
         return;
       }
 
@@ -736,9 +2608,22 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
         arg.mouse().y -= cursor_y_;
       }
 
+      if (arg == Event::Resize) {
+        terminal_size_valid_ = false;
+      }
+
       arg.screen_ = this;
-      component->OnEvent(arg);
+      if (component->Subscribes(arg)) {
+        FTXUI_TRACE("OnEvent");
+        component->OnEvent(arg);
+      }
       frame_valid_ = false;
+      // The motions, and the drags of the component holding the mouse, are
+      // drawn at the frame rate.
+      const bool throttled = (throttle_mouse_motion_ || mouse_captured) &&
+                             arg.is_mouse() &&
+                             arg.mouse().motion == Mouse::Moved;
+      input_handled_ |= !throttled && (arg.is_mouse() || arg != Event::Custom);
       return;
     }
 
@@ -748,6 +2633,30 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
       return;
     }
 
+    if constexpr (std::is_same_v<T, LatestClosure>) {
+      arg.closure();
+      return;
+    }
+
+    if constexpr (std::is_same_v<T, BackgroundClosure>) {
+      arg.closure();
+      return;
+    }
+
+    if constexpr (std::is_same_v<T, TargetedEvent>) {
+      const Component target = arg.target.lock();
+      if (!target) {
+        return;
+      }
+      arg.event.screen_ = this;
+      FTXUI_TRACE("OnEvent");
+      target->OnEvent(arg.event);
+      target->Invalidate();
+      frame_valid_ = false;
+      input_handled_ |= arg.event.is_mouse() || arg.event != Event::Custom;
+      return;
+    }
+
     // Handle Animation
     if constexpr (std::is_same_v<T, AnimationTask>) {
       if (!animation_requested_) {
@@ -755,11 +2664,12 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
       }
 
       animation_requested_ = false;
-      const animation::TimePoint now = animation::Clock::now();
+      const animation::TimePoint now = Now();
       const animation::Duration delta = now - previous_animation_time_;
       previous_animation_time_ = now;
 
       animation::Params params(delta);
+      FTXUI_TRACE("OnAnimation");
       component->OnAnimation(params);
       frame_valid_ = false;
       return;
@@ -769,17 +2679,60 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
   // clang-format on
 }
 
+// private
+// The terminal size is only queried again after it was resized.
+Dimensions ScreenInteractive::TerminalSize() {
+  if (headless_) {
+    return {dimx_, dimy_};
+  }
+  if (!terminal_size_valid_) {
+    terminal_size_ = Terminal::Size();
+    terminal_size_valid_ = true;
+  }
+  return terminal_size_;
+}
+
 // private
 // NOLINTNEXTLINE
 void ScreenInteractive::Draw(Component component) {
   if (frame_valid_) {
     return;
   }
-  auto document = component->Render();
+  FTXUI_TRACE("Draw");
+  // The frame statistics measure the real time, even for a Headless() screen.
+  using Clock = animation::Clock;
+  FrameStats* stats = collect_frame_stats_ ? &frame_stats_ : nullptr;
+  Clock::time_point time = stats ? Clock::now() : Clock::time_point();
+  const size_t nodes = NodesConstructed();
+  // Return the time elapsed since the previous call.
+  auto lap = [&] {
+    const Clock::time_point now = Clock::now();
+    const animation::Duration elapsed = now - time;
+    time = now;
+    return elapsed;
+  };
+
+  const NodeArena::Scope arena_scope(use_node_arena_ ? &node_arena_ : nullptr);
+  const NodeProfiler::Scope profiler_scope(
+      node_profiler_ ? node_profiler_ : NodeProfiler::Current());
+  Element document;
+  {
+    FTXUI_TRACE("Render");
+    document = component->Render();
+  }
+  if (stats) {
+    *stats = FrameStats();
+    stats->tasks = tasks_handled_;
+    stats->render = lap();
+    stats->nodes = NodesConstructed() - nodes;
+  }
   int dimx = 0;
   int dimy = 0;
-  auto terminal = Terminal::Size();
+  const Dimensions terminal = TerminalSize();
   document->ComputeRequirement();
+  if (stats) {
+    stats->layout = lap();
+  }
   switch (dimension_) {
     case Dimension::Fixed:
       dimx = dimx_;
@@ -800,81 +2753,182 @@ void ScreenInteractive::Draw(Component component) {
   }
 
   const bool resized = (dimx != dimx_) || (dimy != dimy_);
-  ResetCursorPosition();
-  std::cout << ResetPosition(/*clear=*/resized);
+
+  // The elements committed since the previous frame are printed once, where
+  // the frame was. The frame is printed again below them.
+  std::string committed;
+  if (!committed_.empty()) {
+    if (!use_alternative_screen_ && !export_cells_) {
+      SerializeCommitted(committed_, terminal.dimx, committed);
+      cursor_position_stale_ = true;
+    }
+    committed_.clear();
+  }
+  const bool clear = resized || !committed.empty();
+
+  std::string mouse_mode = UpdateMouseMotionMode();
+  if (!output_thread_ && !export_cells_) {
+    g_output_buffer += mouse_mode;
+    // With synchronized output, the terminal displays the frame at once, once
+    // it is complete.
+    if (synchronized_output_) {
+      g_output_buffer += Set({DECMode::kSynchronizedOutput});
+    }
+    ResetCursorPosition();
+    g_output_buffer += ResetPosition(clear);
+    g_output_buffer += committed;
+  }
 
   // Resize the screen if needed.
   if (resized) {
-    dimx_ = dimx;
-    dimy_ = dimy;
-    pixels_ = std::vector<std::vector<Pixel>>(dimy, std::vector<Pixel>(dimx));
+    Resize(dimx, dimy);
     cursor_.x = dimx_ - 1;
     cursor_.y = dimy_ - 1;
   }
 
-  // Periodically request the terminal emulator the frame position relative to
-  // the screen. This is useful for converting mouse position reported in
-  // screen's coordinates to frame's coordinates.
-#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
-  // Microsoft's terminal suffers from a [bug]. When reporting the cursor
-  // position, several output sequences are mixed together into garbage.
-  // This causes FTXUI user to see some "1;1;R" sequences into the Input
-  // component. See [issue]. Solution is to request cursor position less
-  // often. [bug]: https://github.com/microsoft/terminal/pull/7583 [issue]:
-  // https://github.com/ArthurSonzogni/FTXUI/issues/136
-  static int i = -3;
-  ++i;
-  if (!use_alternative_screen_ && (i % 150 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
-  }
-#else
-  static int i = -3;
-  ++i;
-  if (!use_alternative_screen_ &&
-      (previous_frame_resized_ || i % 40 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
-  }
-#endif
+  // Request the terminal emulator the frame position relative to the screen.
+  // This is useful for converting mouse position reported in screen's
+  // coordinates to frame's coordinates. It only changes when something else
+  // moved the frame: a resize reflowing the terminal, or some output written
+  // around it. So it is only requested then, instead of periodically.
+  //
+  // This also spares Microsoft's terminal, suffering from a [bug]. When
+  // reporting the cursor position, several output sequences are mixed
+  // together into garbage. This causes FTXUI user to see some "1;1;R"
+  // sequences into the Input component. See [issue].
+  // [bug]: https://github.com/microsoft/terminal/pull/7583
+  // [issue]: https://github.com/ArthurSonzogni/FTXUI/issues/136
+  const bool request_cursor_position =
+      !use_alternative_screen_ &&
+      (cursor_position_stale_ || previous_frame_resized_);
+  cursor_position_stale_ = false;
   previous_frame_resized_ = resized;
 
-  Render(*this, document);
-
-  // Set cursor position for user using tools to insert CJK characters.
-  {
-    const int dx = dimx_ - 1 - cursor_.x + int(dimx_ != terminal.dimx);
-    const int dy = dimy_ - 1 - cursor_.y;
-
-    set_cursor_position.clear();
-    reset_cursor_position.clear();
+  RenderStats render_stats;
+  Render(*this, document.get(), stats ? &render_stats : nullptr);
+  if (stats) {
+    lap();
+    stats->layout += render_stats.layout;
+    stats->layout_iterations = render_stats.layout_iterations;
+    stats->draw = render_stats.draw;
+    stats->shader = render_stats.shader;
+  }
 
-    if (dy != 0) {
-      set_cursor_position += "\x1B[" + std::to_string(dy) + "A";
-      reset_cursor_position += "\x1B[" + std::to_string(dy) + "B";
+  const Cursor cursor = cursor_;
+  if (export_cells_) {
+    FTXUI_TRACE("Output");
+    g_output_buffer += mouse_mode;
+    exported_cells_.Update(*this);
+    if (stats) {
+      stats->serialize = lap();
     }
-
-    if (dx != 0) {
-      set_cursor_position += "\x1B[" + std::to_string(dx) + "D";
-      reset_cursor_position += "\x1B[" + std::to_string(dx) + "C";
+    Flush();
+  } else if (output_thread_) {
+    // The frame is written by the output thread. Draw the next one into the
+    // buffer it gives back.
+    output_thread_->Submit(this, clear, request_cursor_position,
+                           terminal.dimx, synchronized_output_,
+                           std::move(mouse_mode), std::move(committed));
+  } else {
+    FTXUI_TRACE("Output");
+    if (request_cursor_position) {
+      g_output_buffer += DeviceStatusReport(DSRMode::kCursor);
     }
-
-    if (cursor_.shape == Cursor::Hidden) {
-      set_cursor_position += "\033[?25l";
+    if (previous_frame_valid_ && !clear) {
+      // A fullscreen frame starts at the top left corner of the terminal: the
+      // rows shifted can be scrolled.
+      ToStringDiff(previous_frame_, g_output_buffer, Terminal::ColorSupport(),
+                   /*scroll=*/dimension_ == Dimension::Fullscreen &&
+                       Terminal::ScrollRegionSupport(),
+                   Terminal::CompressionSupport());
     } else {
-      set_cursor_position += "\033[?25h";
-      set_cursor_position +=
-          "\033[" + std::to_string(int(cursor_.shape)) + " q";
+      ToString(g_output_buffer, Terminal::ColorSupport(),
+               Terminal::CompressionSupport());
+    }
+    CursorSequences(*this, terminal.dimx, &set_cursor_position,
+                    &reset_cursor_position);
+    g_output_buffer += set_cursor_position;
+    if (synchronized_output_) {
+      g_output_buffer += Reset({DECMode::kSynchronizedOutput});
+    }
+    if (stats) {
+      stats->serialize = lap();
+      stats->bytes = g_output_buffer.size();
+    }
+    metrics_.bytes += g_output_buffer.size();
+    if (session_recording_) {
+      session_recording_->RecordFrame(dimx_, dimy_, g_output_buffer.size());
+    }
+    Flush();
+    if (stats) {
+      stats->write = lap();
+    }
+
+    // Keep the printed frame for the next diff, and reuse the buffer of the
+    // previous one to draw the next frame.
+    if (previous_frame_.dimx() != dimx_ || previous_frame_.dimy() != dimy_) {
+      previous_frame_.Resize(dimx_, dimy_);
     }
+    std::swap<Screen>(*this, previous_frame_);
+    previous_frame_valid_ = true;
   }
+  cursor_ = cursor;
 
-  std::cout << ToString() << set_cursor_position;
-  Flush();
   Clear();
   frame_valid_ = true;
+  previous_frame_time_ = Now();
+  tasks_handled_ = 0;
+  frame_held_ = false;
+  ++metrics_.frames_rendered;
+
+  if (stats) {
+    stats->total = stats->render + stats->layout + stats->draw +
+                   stats->shader + stats->serialize + stats->write;
+    if (on_metrics_) {
+      frame_times_.push_back(stats->total);
+    }
+    if (on_frame_stats_) {
+      on_frame_stats_(*stats);
+    }
+  }
+}
+
+// private
+// Call the ExportMetrics() callback at the end of its period, and start the
+// next one.
+void ScreenInteractive::ReportMetrics() {
+  const animation::TimePoint now = Now();
+  if (!on_metrics_ || now - metrics_start_ < metrics_period_) {
+    return;
+  }
+  if (output_thread_) {
+    output_thread_->TakeMetrics(&metrics_);
+  }
+  metrics_.period = now - metrics_start_;
+  metrics_.frame_time_p50 = Percentile(&frame_times_, 50);
+  metrics_.frame_time_p99 = Percentile(&frame_times_, 99);
+  const FrameMetrics metrics = std::exchange(metrics_, FrameMetrics());
+  frame_times_.clear();
+  metrics_start_ = now;
+  on_metrics_(metrics);
+}
+
+// private
+// Resize the frames to 0x0 and give their memory back. This forces drawing
+// the screen again next time.
+void ScreenInteractive::ReleaseFrames() {
+  Resize(0, 0);
+  ShrinkToFit();
+  previous_frame_.Resize(0, 0);
+  previous_frame_.ShrinkToFit();
+  previous_frame_valid_ = false;
 }
 
 // private
 void ScreenInteractive::ResetCursorPosition() {
-  std::cout << reset_cursor_position;
+  // The output thread must be done, before writing anything else.
+  StopOutputThread();
+  g_output_buffer += reset_cursor_position;
   reset_cursor_position = "";
 }
 
@@ -892,8 +2946,46 @@ void ScreenInteractive::Exit() {
 
 // private:
 void ScreenInteractive::ExitNow() {
-  quit_ = true;
   task_sender_.reset();
+  {
+    const std::lock_guard<std::mutex> lock(g_input_mutex);
+    if (g_input_screen == this) {
+      g_input_screen = nullptr;
+      g_input_target.reset();
+    }
+  }
+  // The loop might be waiting for the input.
+  WakeUp();
+}
+
+// private
+// The time, as seen by the loop. A Headless() screen has its own clock.
+animation::TimePoint ScreenInteractive::Now() const {
+  return headless_ ? headless_time_ : animation::Clock::now();
+}
+
+// private
+// Whether the input is read by the thread running the loop, instead of the
+// EventListener thread. A nested screen reads it the same way as the screen it
+// suspended, since the session is shared.
+bool ScreenInteractive::InputOnLoopThread() const {
+#if defined(FTXUI_NO_THREADS)
+  return true;
+#endif
+  if (suspended_screen_) {
+    return suspended_screen_->InputOnLoopThread();
+  }
+  return external_event_loop_ || read_input_on_loop_thread_;
+}
+
+// private
+int ScreenInteractive::InputFileDescriptor() const {
+  return external_event_loop_ ? input_file_descriptor : -1;
+}
+
+// private
+int ScreenInteractive::WakeUpFileDescriptor() const {
+  return external_event_loop_ ? ftxui::WakeUpFileDescriptor() : -1;
 }
 
 // private:
@@ -908,7 +3000,8 @@ void ScreenInteractive::Signal(int signal) {
   if (signal == SIGTSTP) {
     Post([&] {
       ResetCursorPosition();
-      std::cout << ResetPosition(/*clear*/ true);  // Cursor to the beginning
+      // Cursor to the beginning
+      g_output_buffer += ResetPosition(/*clear*/ true);
       Uninstall();
       dimx_ = 0;
       dimy_ = 0;
@@ -920,7 +3013,7 @@ void ScreenInteractive::Signal(int signal) {
   }
 
   if (signal == SIGWINCH) {
-    Post(Event::Special({0}));
+    Post(Event::Resize);
     return;
   }
 #endif
@@ -4,11 +4,35 @@
 #include <gtest/gtest.h>  // for Test, TestInfo (ptr only), TEST, EXPECT_EQ, Message, TestPartResult
 #include <csignal>  // for raise, SIGABRT, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM
 #include <ftxui/component/event.hpp>  // for Event, Event::Custom
+#include <chrono>                     // for milliseconds, steady_clock, duration_cast
+#include <functional>                 // for function
+#include <thread>                     // for thread, sleep_for
+#include <string>                     // for to_string
 #include <tuple>                      // for _Swallow_assign, ignore
+#include <vector>                     // for vector
 
-#include "ftxui/component/component.hpp"  // for Renderer
+#if !defined(_WIN32)
+#include <fcntl.h>      // for open, O_RDWR, O_NOCTTY, O_NONBLOCK
+#include <poll.h>       // for poll, pollfd, POLLIN
+#include <sys/ioctl.h>  // for ioctl, winsize, TIOCSWINSZ
+#include <unistd.h>     // for dup, dup2, close, lseek, read, STDOUT_FILENO
+#include <atomic>       // for atomic
+#include <cstdio>       // for tmpfile, fileno, fclose
+#include <cstdlib>      // for posix_openpt, grantpt, unlockpt, ptsname
+#include <mutex>        // for mutex, lock_guard
+#endif
+
+#include "ftxui/component/animation.hpp"  // for RequestAnimationFrame, Params
+#include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
+#include "ftxui/component/component.hpp"  // for Renderer, CatchEvent, Vertical
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/loop.hpp"            // for Loop
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Moved, Mouse::Pressed, Mouse::Released
+#include "ftxui/component/task.hpp"       // for LatestClosure, BackgroundClosure
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/dom/elements.hpp"  // for text, Element
+#include "ftxui/dom/node_profiler.hpp"  // for NodeProfiler
+#include "ftxui/screen/terminal.hpp"  // for SetFallbackSize, Size
 
 namespace ftxui {
 
@@ -64,4 +88,1078 @@ TEST(ScreenInteractive, PostTaskToNonActive) {
   screen.Post([] {});
 }
 
+TEST(ScreenInteractive, CoalesceTasks) {
+  for (const bool coalesce : {false, true}) {
+    auto screen = ScreenInteractive::FitComponent();
+    screen.CoalesceTasks(coalesce);
+
+    int moves = 0;
+    int clicks = 0;
+    int latest = 0;
+    int closures = 0;
+    bool posted = false;
+    auto component = Renderer([&] {
+      // Every task is posted at once, so they are received together.
+      if (!posted) {
+        posted = true;
+        for (int i = 0; i < 3; ++i) {
+          Mouse mouse;
+          mouse.motion = Mouse::Moved;
+          mouse.x = i;
+          screen.PostEvent(Event::Mouse("", mouse));
+        }
+        Mouse click;
+        screen.PostEvent(Event::Mouse("", click));
+        for (int i = 0; i < 3; ++i) {
+          screen.Post(LatestClosure{1, [&, i] { latest = i; closures++; }});
+          screen.Post([&] { closures++; });
+        }
+        screen.Post(screen.ExitLoopClosure());
+      }
+      return text("");
+    });
+    component |= CatchEvent([&](Event event) {
+      if (event.is_mouse()) {
+        (event.mouse().motion == Mouse::Moved ? moves : clicks)++;
+      }
+      return false;
+    });
+
+    screen.Loop(component);
+
+    EXPECT_EQ(moves, coalesce ? 1 : 3);
+    EXPECT_EQ(clicks, 1);
+    EXPECT_EQ(latest, 2);
+    EXPECT_EQ(closures, coalesce ? 4 : 6);
+  }
+}
+
+TEST(ScreenInteractive, PostEventToTarget) {
+  auto screen = ScreenInteractive::FitComponent();
+
+  int target_events = 0;
+  int other_events = 0;
+  auto target = Renderer([] { return text(""); }) | CatchEvent([&](Event) {
+                  target_events++;
+                  return true;
+                });
+  auto other = Renderer([] { return text(""); }) | CatchEvent([&](Event) {
+                 other_events++;
+                 return false;
+               });
+  auto destroyed = Renderer([] { return text(""); });
+
+  bool posted = false;
+  auto component = Renderer(Container::Vertical({other, target}), [&] {
+    if (!posted) {
+      posted = true;
+      screen.PostEvent(target, Event::Custom);
+      screen.PostEvent(target, Event::Custom);
+      // Dropped, as the target is destroyed before the event is handled.
+      screen.PostEvent(destroyed, Event::Custom);
+      destroyed.reset();
+      screen.Post(screen.ExitLoopClosure());
+    }
+    return text("");
+  });
+
+  screen.Loop(component);
+
+  EXPECT_EQ(target_events, 2);
+  EXPECT_EQ(other_events, 0);
+}
+
+TEST(ScreenInteractive, LimitFrameRate) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.LimitFrameRate(20);
+
+  // Invalidate the frame every millisecond, for 200ms. This starts from the
+  // first frame, once the loop can receive events.
+  auto start = std::chrono::steady_clock::now();
+  std::thread updates;
+  auto update = [&] {
+    for (int i = 0; i < 200; ++i) {
+      screen.PostEvent(Event::Custom);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    screen.Post(screen.ExitLoopClosure());
+  };
+
+  int frames = 0;
+  auto component = Renderer([&] {
+    if (frames++ == 0) {
+      start = std::chrono::steady_clock::now();
+      updates = std::thread(update);
+    }
+    return text("");
+  });
+
+  screen.Loop(component);
+  updates.join();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  // At most one frame every 50ms, plus the first one. The sleeps last longer
+  // on a loaded machine.
+  EXPECT_GE(frames, 2);
+  EXPECT_LE(frames, int(elapsed.count() / 50) + 2);
+}
+
+#if !defined(FTXUI_NO_ANIMATIONS)
+TEST(ScreenInteractive, AnimationFrames) {
+  auto screen = ScreenInteractive::FitComponent();
+
+  // Request animation frames, until 10 of them were delivered. Nothing else
+  // wakes up the loop.
+  class Animated : public ComponentBase {
+   public:
+    explicit Animated(ScreenInteractive* screen) : screen_(screen) {}
+    Element Render() override {
+      if (animations < 10) {
+        animation::RequestAnimationFrame();
+      } else {
+        screen_->ExitLoopClosure()();
+      }
+      return text("");
+    }
+    void OnAnimation(animation::Params& /*params*/) override { animations++; }
+    int animations = 0;
+
+   private:
+    ScreenInteractive* screen_;
+  };
+
+  auto component = std::make_shared<Animated>(&screen);
+  const auto start = std::chrono::steady_clock::now();
+  screen.Loop(component);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(component->animations, 10);
+  // The frames are delivered around 15ms apart.
+  EXPECT_GE(elapsed, std::chrono::milliseconds(100));
+}
+#endif
+
+TEST(ScreenInteractive, TerminalSizeCachedUntilResize) {
+  Terminal::SetFallbackSize({20, 10});
+  if (Terminal::Size().dimx != 20) {
+    Terminal::SetFallbackSize({80, 24});
+    GTEST_SKIP() << "The terminal size is known.";
+  }
+
+  auto screen = ScreenInteractive::TerminalOutput();
+  std::vector<int> widths;
+  auto component = Renderer([&] {
+    widths.push_back(screen.dimx());
+    switch (widths.size()) {
+      case 1:
+        screen.PostEvent(Event::Custom);
+        break;
+      case 2:
+        Terminal::SetFallbackSize({30, 5});
+        screen.PostEvent(Event::Custom);
+        break;
+      case 3:
+        screen.PostEvent(Event::Resize);
+        break;
+      case 4:
+        screen.PostEvent(Event::Custom);
+        break;
+      default:
+        screen.ExitLoopClosure()();
+        break;
+    }
+    return text("");
+  });
+  screen.Loop(component);
+  Terminal::SetFallbackSize({80, 24});
+
+  // Each frame sees the width of the previous one. The new size is only used
+  // after Event::Resize.
+  EXPECT_EQ(widths, std::vector<int>({0, 20, 20, 20, 30}));
+}
+
+#if !defined(_WIN32)
+TEST(ScreenInteractive, ExternalEventLoop) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.ExternalEventLoop();
+
+  int counter = 0;
+  auto component = Renderer([&] { return text(std::to_string(counter)); });
+  Loop loop(&screen, component);
+  ASSERT_GE(loop.WakeUpFileDescriptor(), 0);
+  EXPECT_EQ(loop.InputFileDescriptor(), 0);
+
+  // Nothing to do once the first frame is drawn.
+  loop.RunOnce();
+  EXPECT_EQ(loop.NextDeadline(), animation::TimePoint::max());
+
+  std::thread poster([&] {
+    screen.Post([&] { counter++; });
+    screen.Post(screen.ExitLoopClosure());
+  });
+  while (!loop.HasQuitted()) {
+    pollfd fd = {loop.WakeUpFileDescriptor(), POLLIN, 0};
+    std::ignore = poll(&fd, 1, -1);
+    loop.RunOnce();
+  }
+  poster.join();
+  EXPECT_EQ(counter, 1);
+}
+
+TEST(ScreenInteractive, ExternalEventLoopResize) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.ExternalEventLoop();
+
+  int renders = 0;
+  int resizes = 0;
+  auto component = Renderer([&] {
+    renders++;
+    return text("");
+  });
+  component |= CatchEvent([&](Event event) {
+    resizes += event == Event::Resize;
+    return false;
+  });
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+
+  // The resizes wake the loop up, and are handled right away, at once.
+  std::ignore = std::raise(SIGWINCH);
+  std::ignore = std::raise(SIGWINCH);
+  pollfd fd = {loop.WakeUpFileDescriptor(), POLLIN, 0};
+  EXPECT_EQ(poll(&fd, 1, 0), 1);
+  loop.RunOnce();
+  EXPECT_EQ(resizes, 1);
+  EXPECT_EQ(renders, 2);
+}
+
+TEST(ScreenInteractive, ReadInputOnLoopThread) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.ReadInputOnLoopThread();
+
+  int counter = 0;
+  auto component = Renderer([&] { return text(std::to_string(counter)); });
+  std::thread poster;
+  {
+    Loop loop(&screen, component);
+    // Only an external event loop uses the file descriptors.
+    EXPECT_EQ(loop.InputFileDescriptor(), -1);
+    EXPECT_EQ(loop.WakeUpFileDescriptor(), -1);
+
+    // The loop waits for the tasks posted by other threads.
+    poster = std::thread([&] {
+      screen.Post([&] { counter++; });
+      screen.Post(screen.ExitLoopClosure());
+    });
+    loop.Run();
+  }
+  poster.join();
+  EXPECT_EQ(counter, 1);
+}
+
+namespace {
+// Return what |fn| writes to the terminal.
+std::string CaptureOutput(const std::function<void()>& fn) {
+  FILE* file = tmpfile();
+  EXPECT_NE(file, nullptr);
+  const int stdout_copy = dup(STDOUT_FILENO);
+  dup2(fileno(file), STDOUT_FILENO);
+
+  fn();
+
+  dup2(stdout_copy, STDOUT_FILENO);
+  close(stdout_copy);
+  std::string output;
+  lseek(fileno(file), 0, SEEK_SET);
+  char buffer[4096];
+  ssize_t size = 0;
+  while ((size = read(fileno(file), buffer, sizeof(buffer))) > 0) {
+    output.append(buffer, size_t(size));
+  }
+  fclose(file);
+  return output;
+}
+}  // namespace
+
+TEST(ScreenInteractive, ThreadedOutput) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.ThreadedOutput();
+  int frame = 0;
+  auto component = Renderer([&] {
+    frame++;
+    if (frame < 50) {
+      screen.PostEvent(Event::Custom);
+      return text("frame " + std::to_string(frame));
+    }
+    screen.ExitLoopClosure()();
+    return text("last frame");
+  });
+  const std::string output = CaptureOutput([&] { screen.Loop(component); });
+
+  // Intermediate frames might be dropped, but the last one is always written
+  // before the loop returns.
+  EXPECT_EQ(frame, 50);
+  EXPECT_NE(output.find("last frame"), std::string::npos);
+}
+
+TEST(ScreenInteractive, SynchronizedOutput) {
+  const std::string begin = "\x1B[?2026h";
+  const std::string end = "\x1B[?2026l";
+  for (const int value : {0, 2}) {
+    auto screen = ScreenInteractive::FitComponent();
+    int frame = 0;
+    auto component = Renderer([&] {
+      frame++;
+      if (frame == 1) {
+        // The terminal answers the request sent on startup.
+        screen.PostEvent(Event::ModeReport("", 2026, value));
+        screen.PostEvent(Event::Custom);
+        return text("first");
+      }
+      screen.ExitLoopClosure()();
+      return text("second frame");
+    });
+    const std::string output = CaptureOutput([&] { screen.Loop(component); });
+
+    EXPECT_NE(output.find("\x1B[?2026$p"), std::string::npos);
+    if (value == 0) {
+      // Unsupported.
+      EXPECT_EQ(output.find(begin), std::string::npos);
+      continue;
+    }
+    // Only the second frame is wrapped.
+    const size_t first = output.find("first");
+    const size_t second = output.find("second frame");
+    ASSERT_NE(second, std::string::npos);
+    EXPECT_LT(first, output.find(begin));
+    EXPECT_LT(output.find(begin), second);
+    EXPECT_LT(second, output.find(end));
+  }
+}
+
+TEST(ScreenInteractive, DropStaleFrames) {
+  // Write to a pseudo terminal, whose output is read by |reader| unless
+  // |paused|.
+  const int master = posix_openpt(O_RDWR | O_NOCTTY);
+  ASSERT_GE(master, 0);
+  ASSERT_EQ(grantpt(master), 0);
+  ASSERT_EQ(unlockpt(master), 0);
+  const int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+  ASSERT_GE(slave, 0);
+  winsize size = {24, 80, 0, 0};
+  ioctl(slave, TIOCSWINSZ, &size);
+  const int stdout_copy = dup(STDOUT_FILENO);
+  dup2(slave, STDOUT_FILENO);
+
+  std::mutex reading;
+  std::atomic<bool> paused = false;
+  std::atomic<bool> done = false;
+  std::thread reader([&] {
+    char buffer[4096];
+    while (!done) {
+      pollfd fd = {master, POLLIN, 0};
+      if (poll(&fd, 1, 1) <= 0) {
+        continue;
+      }
+      const std::lock_guard<std::mutex> lock(reading);
+      if (!paused) {
+        std::ignore = read(master, buffer, sizeof(buffer));
+      }
+    }
+  });
+
+  auto screen = ScreenInteractive::FitComponent();
+  screen.DropStaleFrames();
+  std::atomic<int> frames = 0;
+  std::atomic<int> events = 0;
+  auto component = Renderer([&] {
+    frames++;
+    return text(std::to_string(events));
+  });
+  component |= CatchEvent([&](const Event&) {
+    events++;
+    return true;
+  });
+
+  int frames_while_paused = 0;
+  std::thread controller([&] {
+    while (frames == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Simulate a terminal falling behind, by filling its buffer.
+    {
+      const std::lock_guard<std::mutex> lock(reading);
+      paused = true;
+    }
+    const int filler = open(ptsname(master), O_WRONLY | O_NOCTTY | O_NONBLOCK);
+    const std::string data(1024, ' ');
+    // The kernel moves the data between its buffers asynchronously. Fill them
+    // until they stabilize.
+    for (int i = 0; i < 3; ++i) {
+      while (write(filler, data.data(), data.size()) > 0) {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    close(filler);
+
+    const int frames_before = frames;
+    for (int i = 0; i < 10; ++i) {
+      screen.PostEvent(Event::Custom);
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    frames_while_paused = frames - frames_before;
+
+    // Once the terminal catches up, the latest state is drawn.
+    paused = false;
+    while (events < 10 || frames == frames_before) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    screen.Post(screen.ExitLoopClosure());
+  });
+  screen.Loop(component);
+  controller.join();
+
+  dup2(stdout_copy, STDOUT_FILENO);
+  close(stdout_copy);
+  done = true;
+  reader.join();
+  close(slave);
+  close(master);
+
+  EXPECT_EQ(events, 10);
+  EXPECT_EQ(frames_while_paused, 0);
+}
+#endif
+
+TEST(ScreenInteractive, HeadlessInputOutput) {
+  std::string typed;
+  auto component = Renderer([&] { return text("[" + typed + "]"); });
+  component |= CatchEvent([&](Event event) {
+    if (event.is_character()) {
+      typed += event.character();
+    }
+    return false;
+  });
+
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_NE(screen.HeadlessOutput().find("[]"), std::string::npos);
+
+  screen.HeadlessInput("ab");
+  loop.RunOnce();
+  EXPECT_EQ(typed, "ab");
+  EXPECT_NE(screen.HeadlessOutput().find("ab]"), std::string::npos);
+
+  // Nothing changed. Nothing is written.
+  loop.RunOnce();
+  EXPECT_EQ(screen.HeadlessOutput(), "");
+}
+
+TEST(ScreenInteractive, HeadlessEscapeTimeout) {
+  int escapes = 0;
+  auto component = CatchEvent(Renderer([] { return text(""); }),
+                              [&](Event event) {
+                                escapes += event == Event::Escape;
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::Headless(1, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  // A lone escape might start a sequence. It is only complete after a timeout,
+  // on the clock of the screen.
+  screen.HeadlessInput("\x1B");
+  loop.RunOnce();
+  EXPECT_EQ(escapes, 0);
+  screen.HeadlessAdvanceTime(std::chrono::milliseconds(10));
+  loop.RunOnce();
+  EXPECT_EQ(escapes, 0);
+  screen.HeadlessAdvanceTime(std::chrono::milliseconds(50));
+  loop.RunOnce();
+  EXPECT_EQ(escapes, 1);
+}
+
+#if !defined(FTXUI_NO_ANIMATIONS)
+TEST(ScreenInteractive, HeadlessAnimation) {
+  auto screen = ScreenInteractive::Headless(1, 1);
+
+  // A one minute long animation. The clock jumps from one frame to the next.
+  class Animated : public ComponentBase {
+   public:
+    explicit Animated(ScreenInteractive* screen) : screen_(screen) {}
+    Element Render() override {
+      if (frames == 0) {
+        animation::RequestAnimationFrame();
+      }
+      return text("");
+    }
+    void OnAnimation(animation::Params& params) override {
+      animator_.OnAnimation(params);
+      ++frames;
+      if (value == 1.F) {
+        screen_->Exit();
+      }
+    }
+    float value = 0.F;
+    int frames = 0;
+
+   private:
+    ScreenInteractive* screen_;
+    animation::Animator animator_ =
+        animation::Animator(&value, 1.F, std::chrono::minutes(1));
+  };
+  auto animated = std::make_shared<Animated>(&screen);
+  screen.Loop(animated);
+  EXPECT_EQ(animated->value, 1.F);
+  EXPECT_GT(animated->frames, 1000);
+}
+#endif
+
+TEST(ScreenInteractive, FrameStats) {
+  std::string typed;
+  auto component = Renderer([&] {
+    return vbox({text("typed:"), paragraph(typed)}) | border;
+  });
+  component |= CatchEvent([&](Event event) {
+    typed += event.is_character() ? event.character() : "";
+    return false;
+  });
+
+  int frames = 0;
+  auto screen = ScreenInteractive::Headless(20, 5);
+  screen.OnFrameStats([&](const FrameStats&) { ++frames; });
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+
+  screen.HeadlessOutput();
+  screen.HeadlessInput("abc");
+  loop.RunOnce();
+  EXPECT_EQ(frames, 2);
+
+  const FrameStats& stats = screen.LastFrameStats();
+  EXPECT_EQ(stats.nodes, 4u);  // border, vbox, text and paragraph.
+  EXPECT_GE(stats.layout_iterations, 1);
+  EXPECT_EQ(stats.tasks, 3u);  // One event per character.
+  EXPECT_EQ(stats.bytes, screen.HeadlessOutput().size());
+  EXPECT_GT(stats.bytes, 0u);
+  EXPECT_GE(stats.total, stats.render + stats.layout);
+}
+
+TEST(ScreenInteractive, ProbeTerminal) {
+  const auto color = Terminal::ColorSupport();
+  const auto compression = Terminal::CompressionSupport();
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  Terminal::SetCompressionSupport(Terminal::Compression::Erase);
+
+  auto screen = ScreenInteractive::Headless(5, 1);
+  screen.ProbeTerminal();
+  Loop loop(&screen, Renderer([] { return text("a"); }));
+  loop.RunOnce();
+
+  // The name, then every capability, one by one.
+  const std::string output = screen.HeadlessOutput();
+  EXPECT_NE(output.find("\x1B[>0q"), std::string::npos);
+  EXPECT_NE(output.find("\x1BP+q524742\x1B\\"), std::string::npos);  // RGB
+  EXPECT_NE(output.find("\x1BP+q637372\x1B\\"), std::string::npos);  // csr
+
+  screen.HeadlessInput(
+      "\x1BP>|XTerm(388)\x1B\\"  // REP is known, from the name.
+      "\x1BP1+r524742=38\x1B\\"  // RGB
+      "\x1BP0+r637372\x1B\\");   // No csr.
+  loop.RunOnce();
+  EXPECT_EQ(Terminal::ColorSupport(), Terminal::Color::TrueColor);
+  EXPECT_EQ(Terminal::CompressionSupport(), Terminal::Compression::Repeat);
+  EXPECT_FALSE(Terminal::ScrollRegionSupport());
+
+  // A capability denied takes precedence.
+  screen.HeadlessInput("\x1BP0+r726570\x1B\\");  // No rep.
+  loop.RunOnce();
+  EXPECT_EQ(Terminal::CompressionSupport(), Terminal::Compression::Erase);
+
+  Terminal::SetColorSupport(color);
+  Terminal::SetCompressionSupport(compression);
+  Terminal::SetScrollRegionSupport(true);
+}
+
+TEST(ScreenInteractive, ExportMetrics) {
+  int latest = 0;
+  auto component = Renderer([&] { return text(std::to_string(latest)); });
+
+  std::vector<FrameMetrics> exported;
+  auto screen = ScreenInteractive::Headless(5, 1);
+  screen.CoalesceTasks();
+  screen.LimitFrameRate(10);
+  // The first frame isn't held back.
+  screen.HeadlessAdvanceTime(std::chrono::seconds(1));
+  screen.ExportMetrics(std::chrono::seconds(1),
+                       [&](const FrameMetrics& m) { exported.push_back(m); });
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  // Three closures, two of them superseded, and an event. The frame is held
+  // back by the frame rate.
+  for (int i = 1; i <= 3; ++i) {
+    screen.Post(LatestClosure{1, [&, i] { latest = i; }});
+  }
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(latest, 3);
+  EXPECT_TRUE(exported.empty());
+
+  // The period ends. The held frame is drawn, and the metrics exported.
+  screen.HeadlessAdvanceTime(std::chrono::seconds(1));
+  loop.RunOnce();
+  ASSERT_EQ(exported.size(), 1u);
+  const FrameMetrics& metrics = exported[0];
+  EXPECT_EQ(metrics.period, std::chrono::seconds(1));
+  EXPECT_EQ(metrics.frames_rendered, 2u);
+  EXPECT_EQ(metrics.frames_skipped, 1u);
+  EXPECT_EQ(metrics.write_stalls, 0u);
+  EXPECT_EQ(metrics.tasks, 2u);
+  EXPECT_EQ(metrics.tasks_coalesced, 2u);
+  EXPECT_EQ(metrics.task_queue_high_water, 4u);
+  // The frames, without the sequences setting up the terminal.
+  EXPECT_GT(metrics.bytes, 0u);
+  EXPECT_LT(metrics.bytes, screen.HeadlessOutput().size());
+  EXPECT_GE(metrics.frame_time_p99, metrics.frame_time_p50);
+
+  // The counters start again from zero.
+  screen.HeadlessAdvanceTime(std::chrono::seconds(1));
+  loop.RunOnce();
+  ASSERT_EQ(exported.size(), 2u);
+  EXPECT_EQ(exported[1].frames_rendered, 0u);
+  EXPECT_EQ(exported[1].tasks, 0u);
+}
+
+TEST(ScreenInteractive, NodeProfiler) {
+  auto sidebar = Renderer([] { return vbox({text("a"), text("b")}); }) |
+                 ProfileNodes("sidebar");
+  auto editor = Renderer([] { return text("c"); }) | ProfileNodes("editor");
+  auto component =
+      Renderer(Container::Horizontal({sidebar, editor}),
+               [&] { return hbox({sidebar->Render(), editor->Render()}); });
+
+  NodeProfiler profiler;
+  auto screen = ScreenInteractive::Headless(10, 2);
+  screen.UseNodeProfiler(&profiler);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  EXPECT_EQ(profiler.frames(), 1);
+  EXPECT_EQ(profiler.total().nodes, 5u);
+  const auto by_label = profiler.ByLabel();
+  ASSERT_EQ(by_label.size(), 3u);
+  EXPECT_EQ(by_label[0].name, "sidebar");
+  EXPECT_EQ(by_label[0].count.nodes, 3u);  // vbox and two texts.
+  EXPECT_EQ(by_label[1].count.nodes, 1u);
+  EXPECT_EQ(by_label[2].count.nodes, 1u);
+}
+
+#if !defined(FTXUI_NO_MOUSE)
+TEST(ScreenInteractive, ThrottleMouseMotionModes) {
+  CapturedMouse captured;
+  auto component = CatchEvent(Renderer([] { return text(""); }),
+                              [&](Event event) {
+                                if (!event.is_mouse()) {
+                                  return false;
+                                }
+                                if (event.mouse().motion == Mouse::Pressed) {
+                                  captured = event.screen_->CaptureMouse();
+                                }
+                                if (event.mouse().motion == Mouse::Released) {
+                                  captured.reset();
+                                }
+                                return true;
+                              });
+
+  auto screen = ScreenInteractive::Headless(1, 1);
+  screen.ThrottleMouseMotion();
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  std::string output = screen.HeadlessOutput();
+  EXPECT_NE(output.find("\x1B[?1002h"), std::string::npos);
+  EXPECT_EQ(output.find("\x1B[?1003h"), std::string::npos);
+
+  // The motions are reported while the mouse is captured.
+  screen.HeadlessInput("\x1B[<0;1;1M");
+  loop.RunOnce();
+  EXPECT_NE(screen.HeadlessOutput().find("\x1B[?1003h"), std::string::npos);
+
+  screen.HeadlessInput("\x1B[<0;1;1m");
+  loop.RunOnce();
+  EXPECT_NE(screen.HeadlessOutput().find("\x1B[?1003l\x1B[?1002h"),
+            std::string::npos);
+}
+#endif
+
+TEST(ScreenInteractive, ThrottleMouseMotionFrameRate) {
+  int frames = 0;
+  auto component = Renderer([&] {
+    frames++;
+    return text("");
+  });
+
+  auto screen = ScreenInteractive::Headless(1, 1);
+  screen.ThrottleMouseMotion();
+  screen.LimitFrameRate(10);
+  screen.HeadlessAdvanceTime(std::chrono::seconds(1));
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+
+  // A motion waits for the frame interval.
+  screen.HeadlessInput("\x1B[<35;1;1M");
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+  screen.HeadlessAdvanceTime(std::chrono::milliseconds(100));
+  loop.RunOnce();
+  EXPECT_EQ(frames, 2);
+
+  // A click is drawn immediately.
+  screen.HeadlessInput("\x1B[<0;1;1M");
+  loop.RunOnce();
+  EXPECT_EQ(frames, 3);
+}
+
+TEST(ScreenInteractive, CapturedMouseDrag) {
+  int sibling_frames = 0;
+  auto sibling = Memo(Renderer([&] {
+    sibling_frames++;
+    return text("sibling");
+  }));
+  int value = 0;
+  auto slider = Slider<int>({.value = &value, .min = 0, .max = 100});
+  int motions = 0;
+  auto counted = CatchEvent(slider, [&](Event event) {
+    motions += event.is_mouse() && event.mouse().motion == Mouse::Moved;
+    return false;
+  });
+  auto component = Container::Vertical({sibling, counted});
+
+  auto screen = ScreenInteractive::Headless(21, 2);
+  screen.LimitFrameRate(10);
+  screen.HeadlessAdvanceTime(std::chrono::seconds(1));
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(sibling_frames, 1);
+
+  // Grab the slider.
+  screen.HeadlessInput("\x1B[<0;1;2M");
+  loop.RunOnce();
+  screen.HeadlessOutput();
+
+  // Only the latest position is dispatched, and drawn at the frame rate.
+  screen.HeadlessInput("\x1B[<32;6;2M\x1B[<32;11;2M");
+  loop.RunOnce();
+  EXPECT_EQ(motions, 1);
+  EXPECT_EQ(value, 50);
+  EXPECT_EQ(screen.HeadlessOutput(), "");
+  screen.HeadlessAdvanceTime(std::chrono::milliseconds(100));
+  loop.RunOnce();
+  EXPECT_NE(screen.HeadlessOutput(), "");
+
+  // The sibling isn't rendered again.
+  EXPECT_EQ(sibling_frames, 1);
+
+  screen.HeadlessInput("\x1B[<0;11;2m");
+  loop.RunOnce();
+  EXPECT_EQ(sibling_frames, 1);
+}
+
+TEST(ScreenInteractive, RunOnceDeadline) {
+  auto screen = ScreenInteractive::Headless(1, 1);
+
+  // Every event takes 10ms to handle.
+  int frames = 0;
+  int handled = 0;
+  auto component = CatchEvent(Renderer([&] {
+                                frames++;
+                                return text("");
+                              }),
+                              [&](Event event) {
+                                if (event == Event::Custom) {
+                                  screen.HeadlessAdvanceTime(
+                                      std::chrono::milliseconds(10));
+                                  handled++;
+                                }
+                                return false;
+                              });
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+
+  for (int i = 0; i < 5; ++i) {
+    screen.PostEvent(Event::Custom);
+  }
+  // The clock of a Headless() screen starts at zero.
+  const animation::TimePoint start;
+  loop.RunOnce(start + std::chrono::milliseconds(15));
+  EXPECT_EQ(handled, 2);
+  EXPECT_EQ(frames, 2);
+
+  // The remaining events are handled next, without waiting.
+  EXPECT_EQ(loop.NextDeadline(), start + std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_EQ(handled, 5);
+  EXPECT_EQ(frames, 3);
+}
+
+TEST(ScreenInteractive, TaskLanes) {
+  std::string order;
+  auto component = CatchEvent(Renderer([] { return text(""); }),
+                              [&](Event event) {
+                                if (event.is_character()) {
+                                  order += event.character();
+                                }
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::Headless(1, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  screen.Post(BackgroundClosure{[&] { order += "1"; }});
+  screen.Post(BackgroundClosure{[&] { order += "2"; }});
+  screen.Post([&] { order += "3"; });
+  screen.PostEvent(Event::Character('a'));
+  screen.HeadlessInput("b");
+  loop.RunOnce();
+  EXPECT_EQ(order, "ab312");
+}
+
+#if !defined(FTXUI_NO_MOUSE)
+TEST(ScreenInteractive, NestedScreenSharesSession) {
+  std::string typed;
+  auto component = Renderer([] { return text("x"); });
+  component |= CatchEvent([&](Event event) {
+    if (event.is_character()) {
+      typed += event.character();
+    }
+    return false;
+  });
+
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  std::string output = screen.HeadlessOutput();
+  EXPECT_NE(output.find("\x1B[?2004h"), std::string::npos);
+  EXPECT_NE(output.find("\x1B[?1000h"), std::string::npos);
+
+  {
+    auto nested = ScreenInteractive::Headless(10, 1);
+    nested.TrackMouse(false);
+    Loop nested_loop(&nested, component);
+    nested_loop.RunOnce();
+
+    // Only the modes differing from the suspended screen's are switched.
+    output = nested.HeadlessOutput();
+    EXPECT_EQ(output.find("\x1B[?2004"), std::string::npos);
+    EXPECT_EQ(output.find("\x1B[?7"), std::string::npos);
+    EXPECT_NE(output.find("\x1B[?1000l"), std::string::npos);
+
+    // The input goes to the active screen.
+    nested.HeadlessInput("a");
+    nested_loop.RunOnce();
+    EXPECT_EQ(typed, "a");
+  }
+
+  loop.RunOnce();
+  output = screen.HeadlessOutput();
+  EXPECT_EQ(output.find("\x1B[?2004"), std::string::npos);
+  EXPECT_NE(output.find("\x1B[?1000h"), std::string::npos);
+
+  screen.HeadlessInput("b");
+  loop.RunOnce();
+  EXPECT_EQ(typed, "ab");
+}
+#endif
+
+TEST(ScreenInteractive, ExportCells) {
+  std::string label = "ab";
+  auto component = Renderer([&] { return text(label); });
+  auto screen = ScreenInteractive::Headless(3, 1);
+  screen.ExportCells();
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  // The frame isn't written to the terminal.
+  EXPECT_EQ(screen.HeadlessOutput().find("ab"), std::string::npos);
+  const CellBuffer& cells = screen.ExportedCells();
+  EXPECT_EQ(cells.dimx(), 3);
+  EXPECT_EQ(cells.cells()[0], uint32_t('a'));
+  EXPECT_EQ(cells.cells()[CellBuffer::kWordsPerCell], uint32_t('b'));
+  EXPECT_EQ(cells.frame(), 1u);
+
+  label = "ac";
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(cells.cells()[CellBuffer::kWordsPerCell], uint32_t('c'));
+  EXPECT_EQ(cells.frame(), 2u);
+}
+
+TEST(ScreenInteractive, CursorPositionRequests) {
+  auto component = Renderer([] { return text("a"); });
+  auto screen = ScreenInteractive::Headless(3, 1);
+  Loop loop(&screen, component);
+  const auto requested = [&] {
+    return screen.HeadlessOutput().find("\x1B[6n") != std::string::npos;
+  };
+
+  // Requested once, with the first frame.
+  loop.RunOnce();
+  EXPECT_TRUE(requested());
+
+  // Not again while nothing moved the frame.
+  for (int i = 0; i < 50; ++i) {
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+    EXPECT_FALSE(requested());
+  }
+
+  screen.RequestCursorPosition();
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_TRUE(requested());
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_FALSE(requested());
+}
+
+TEST(ScreenInteractive, Commit) {
+  int renders = 0;
+  auto component = Renderer([&] {
+    renders++;
+    return text("status");
+  });
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.HeadlessOutput();
+
+  // The committed lines are printed once, above the frame printed again.
+  screen.Post([&] {
+    screen.Commit(text("line 1"));
+    screen.Commit(text("line 2"));
+  });
+  loop.RunOnce();
+  const std::string output = screen.HeadlessOutput();
+  const size_t line_1 = output.find("line 1");
+  const size_t line_2 = output.find("line 2");
+  const size_t status = output.find("status");
+  ASSERT_NE(line_1, std::string::npos);
+  ASSERT_NE(line_2, std::string::npos);
+  ASSERT_NE(status, std::string::npos);
+  EXPECT_LT(line_1, line_2);
+  EXPECT_LT(line_2, status);
+
+  // They are never drawn again.
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(screen.HeadlessOutput().find("line"), std::string::npos);
+  EXPECT_EQ(renders, 3);
+}
+
+TEST(ScreenInteractive, Timers) {
+  int renders = 0;
+  auto component = Renderer([&] {
+    renders++;
+    return text("");
+  });
+  auto screen = ScreenInteractive::Headless(1, 1);
+  int timeouts = 0;
+  int ticks = 0;
+  screen.SetTimeout([&] { timeouts++; }, std::chrono::milliseconds(100));
+  const int cancelled =
+      screen.SetTimeout([&] { timeouts += 10; }, std::chrono::milliseconds(50));
+  const int interval =
+      screen.SetInterval([&] { ticks++; }, std::chrono::milliseconds(30));
+  screen.ClearTimer(cancelled);
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+  EXPECT_EQ(ticks, 0);
+
+  // The timers due redraw the frame.
+  screen.HeadlessAdvanceTime(std::chrono::milliseconds(40));
+  loop.RunOnce();
+  EXPECT_EQ(ticks, 1);
+  EXPECT_EQ(renders, 2);
+
+  // The periods missed aren't run in a burst.
+  screen.HeadlessAdvanceTime(std::chrono::milliseconds(100));
+  loop.RunOnce();
+  EXPECT_EQ(ticks, 2);
+  EXPECT_EQ(timeouts, 1);
+  EXPECT_EQ(renders, 3);
+
+  screen.HeadlessAdvanceTime(std::chrono::milliseconds(30));
+  loop.RunOnce();
+  EXPECT_EQ(ticks, 3);
+  screen.ClearTimer(interval);
+  screen.HeadlessAdvanceTime(std::chrono::seconds(1));
+  loop.RunOnce();
+  EXPECT_EQ(ticks, 3);
+  EXPECT_EQ(timeouts, 1);
+  EXPECT_EQ(renders, 4);
+}
+
+TEST(ScreenInteractive, TimersWakeUpTheLoop) {
+  auto screen = ScreenInteractive::Headless(1, 1);
+  int ticks = 0;
+  screen.SetInterval(
+      [&] {
+        if (++ticks == 5) {
+          screen.Exit();
+        }
+      },
+      std::chrono::seconds(1));
+  // The loop waits for the timers alone. The clock jumps to them.
+  screen.Loop(Renderer([] { return text(""); }));
+  EXPECT_EQ(ticks, 5);
+}
+
+#if !defined(FTXUI_NO_THREADS)
+TEST(ScreenInteractive, Async) {
+  auto screen = ScreenInteractive::Headless(1, 1);
+  screen.BackgroundThreads(2);
+  const auto loop_thread = std::this_thread::get_id();
+  const int jobs = 20;
+  std::atomic<int> worked = 0;
+  int done = 0;
+  bool on_loop_thread = true;
+  // The work is started from the loop, where its continuations are received.
+  bool started = false;
+  auto component = Renderer([&] {
+    for (int i = 0; !started && i < jobs; ++i) {
+      screen.Async(
+          [&] {
+            EXPECT_NE(std::this_thread::get_id(), loop_thread);
+            worked++;
+          },
+          [&] {
+            on_loop_thread &= std::this_thread::get_id() == loop_thread;
+            if (++done == jobs) {
+              screen.Exit();
+            }
+          });
+    }
+    started = true;
+    return text("");
+  });
+  screen.Loop(component);
+  EXPECT_EQ(worked, jobs);
+  EXPECT_EQ(done, jobs);
+  EXPECT_TRUE(on_loop_thread);
+}
+#endif
+
 }  // namespace ftxui
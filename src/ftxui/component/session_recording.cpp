@@ -0,0 +1,172 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/session_recording.hpp"
+
+#include <chrono>       // for microseconds, duration_cast
+#include <cstdint>      // for uint8_t, uint64_t
+#include <mutex>        // for lock_guard
+#include <optional>     // for optional, nullopt
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/component/animation.hpp"  // for Clock, Duration, TimePoint
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+namespace {
+
+constexpr std::string_view kMagic = "FTXR";
+constexpr char kVersion = 1;
+
+void AppendVarint(std::string* out, uint64_t value) {
+  while (value >= 0x80) {                            // NOLINT
+    out->push_back(char((value & 0x7F) | 0x80));     // NOLINT
+    value >>= 7;                                     // NOLINT
+  }
+  out->push_back(char(value));
+}
+
+// Consume a varint from the front of |data|.
+std::optional<uint64_t> EatVarint(std::string_view* data) {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {  // NOLINT
+    if (data->empty()) {
+      return std::nullopt;
+    }
+    const auto byte = uint8_t(data->front());
+    data->remove_prefix(1);
+    value |= uint64_t(byte & 0x7F) << shift;  // NOLINT
+    if ((byte & 0x80) == 0) {                 // NOLINT
+      return value;
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+SessionRecording::SessionRecording() {
+  data_ += kMagic;
+  data_ += kVersion;
+}
+
+SessionRecording::SessionRecording(std::string data) : data_(std::move(data)) {}
+
+/// @brief Record the |input| read from the terminal.
+void SessionRecording::RecordInput(std::string_view input) {
+  const animation::TimePoint now = animation::Clock::now();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  Append(Record::Type::Input, now);
+  AppendVarint(&data_, input.size());
+  data_ += input;
+}
+
+/// @brief Record a frame of |dimx|x|dimy| cells, written as |bytes| bytes.
+void SessionRecording::RecordFrame(int dimx, int dimy, size_t bytes) {
+  const animation::TimePoint now = animation::Clock::now();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  Append(Record::Type::Frame, now);
+  AppendVarint(&data_, uint64_t(dimx));
+  AppendVarint(&data_, uint64_t(dimy));
+  AppendVarint(&data_, bytes);
+}
+
+void SessionRecording::Append(Record::Type type, animation::TimePoint now) {
+  const animation::TimePoint previous = previous_.value_or(now);
+  previous_ = now;
+  const auto delta =
+      std::chrono::duration_cast<std::chrono::microseconds>(now - previous);
+  data_ += char(type);
+  AppendVarint(&data_, uint64_t(delta.count()));
+}
+
+/// @brief The encoded log, to be saved and given back to the constructor.
+std::string SessionRecording::Data() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return data_;
+}
+
+/// @brief The decoded log. Nothing when it is malformed.
+std::optional<std::vector<SessionRecording::Record>>
+SessionRecording::Records() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  std::string_view data = data_;
+  if (data.substr(0, kMagic.size()) != kMagic ||
+      data.size() < kMagic.size() + 1 || data[kMagic.size()] != kVersion) {
+    return std::nullopt;
+  }
+  data.remove_prefix(kMagic.size() + 1);
+
+  std::vector<Record> records;
+  animation::Duration time{};
+  while (!data.empty()) {
+    Record record;
+    record.type = Record::Type(data.front());
+    data.remove_prefix(1);
+    const auto delta = EatVarint(&data);
+    if (!delta) {
+      return std::nullopt;
+    }
+    time += std::chrono::microseconds(*delta);
+    record.time = time;
+
+    switch (record.type) {
+      case Record::Type::Input: {
+        const auto size = EatVarint(&data);
+        if (!size || *size > data.size()) {
+          return std::nullopt;
+        }
+        record.input = std::string(data.substr(0, *size));
+        data.remove_prefix(*size);
+        break;
+      }
+      case Record::Type::Frame: {
+        const auto dimx = EatVarint(&data);
+        const auto dimy = EatVarint(&data);
+        const auto bytes = EatVarint(&data);
+        if (!dimx || !dimy || !bytes) {
+          return std::nullopt;
+        }
+        record.dimx = int(*dimx);
+        record.dimy = int(*dimy);
+        record.bytes = size_t(*bytes);
+        break;
+      }
+      default:
+        return std::nullopt;
+    }
+    records.push_back(std::move(record));
+  }
+  return records;
+}
+
+/// @brief Feed the recorded input into a Headless() screen. Its clock advances
+/// as the time passed while recording, so the escape sequences, animations and
+/// timers behave as they did. The loop runs once after every input.
+/// @param screen The Headless() screen.
+/// @param loop The loop driving |screen|.
+/// @return false when the log is malformed.
+bool SessionRecording::Replay(ScreenInteractive* screen, Loop* loop) const {
+  const auto records = Records();
+  if (!records) {
+    return false;
+  }
+  animation::Duration time{};
+  for (const Record& record : *records) {
+    if (record.type != Record::Type::Input) {
+      continue;
+    }
+    screen->HeadlessAdvanceTime(record.time - time);
+    time = record.time;
+    screen->HeadlessInput(record.input);
+    loop->RunOnce();
+  }
+  return true;
+}
+
+}  // namespace ftxui
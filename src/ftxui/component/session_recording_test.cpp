@@ -0,0 +1,105 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/session_recording.hpp"
+
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/component/component.hpp"  // for CatchEvent, Renderer
+#include "ftxui/component/event.hpp"      // for Event
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Component Typing(std::string* typed) {
+  return Renderer([typed] { return text("[" + *typed + "]"); }) |
+         CatchEvent([typed](Event event) {
+           if (event.is_character()) {
+             *typed += event.character();
+           }
+           return false;
+         });
+}
+
+}  // namespace
+
+TEST(SessionRecording, Encoding) {
+  SessionRecording recording;
+  recording.RecordInput("ab");
+  recording.RecordFrame(80, 24, 1000);
+  recording.RecordInput(std::string(200, 'x'));
+
+  const SessionRecording decoded(recording.Data());
+  const auto records = decoded.Records();
+  ASSERT_TRUE(records);
+  ASSERT_EQ(records->size(), 3u);
+  EXPECT_EQ((*records)[0].type, SessionRecording::Record::Type::Input);
+  EXPECT_EQ((*records)[0].input, "ab");
+  EXPECT_EQ((*records)[1].type, SessionRecording::Record::Type::Frame);
+  EXPECT_EQ((*records)[1].dimx, 80);
+  EXPECT_EQ((*records)[1].dimy, 24);
+  EXPECT_EQ((*records)[1].bytes, 1000u);
+  EXPECT_EQ((*records)[2].input, std::string(200, 'x'));
+  EXPECT_LE((*records)[0].time, (*records)[2].time);
+}
+
+TEST(SessionRecording, Malformed) {
+  EXPECT_FALSE(SessionRecording("").Records());
+  EXPECT_FALSE(SessionRecording("FTXR").Records());
+
+  SessionRecording recording;
+  recording.RecordInput("abc");
+  std::string data = recording.Data();
+  data.pop_back();
+  EXPECT_FALSE(SessionRecording(data).Records());
+}
+
+TEST(SessionRecording, RecordAndReplay) {
+  SessionRecording recording;
+  std::string typed;
+  {
+    auto screen = ScreenInteractive::Headless(10, 1);
+    screen.RecordSession(&recording);
+    Loop loop(&screen, Typing(&typed));
+    loop.RunOnce();
+    screen.HeadlessInput("ab");
+    loop.RunOnce();
+    screen.HeadlessInput("c");
+    loop.RunOnce();
+  }
+  EXPECT_EQ(typed, "abc");
+
+  const auto records = recording.Records();
+  ASSERT_TRUE(records);
+  int inputs = 0;
+  int frames = 0;
+  for (const auto& record : *records) {
+    if (record.type == SessionRecording::Record::Type::Input) {
+      inputs++;
+    } else {
+      frames++;
+      EXPECT_EQ(record.dimx, 10);
+      EXPECT_GT(record.bytes, 0u);
+    }
+  }
+  EXPECT_EQ(inputs, 2);
+  EXPECT_EQ(frames, 3);
+
+  // The same session, replayed.
+  std::string replayed;
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, Typing(&replayed));
+  loop.RunOnce();
+  EXPECT_TRUE(SessionRecording(recording.Data()).Replay(&screen, &loop));
+  EXPECT_EQ(replayed, "abc");
+  EXPECT_NE(screen.HeadlessOutput().find("c]"), std::string::npos);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,61 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <thread>  // for thread
+#include <vector>  // for vector
+
+#include "ftxui/component/component.hpp"           // for Renderer
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/component/shared_state.hpp"        // for SharedState
+#include "ftxui/dom/elements.hpp"                  // for text
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(SharedStateTest, UpdateBeforeLoop) {
+  auto screen = ScreenInteractive::FitComponent();
+  SharedState<std::vector<int>> state(screen, {1});
+  EXPECT_EQ(state.version(), 0u);
+
+  // The screen isn't looping. The update is published when read.
+  state.Update([](std::vector<int>& values) { values.push_back(2); });
+  state.Update([](std::vector<int>& values) { values.push_back(3); });
+  EXPECT_EQ(state.Get(), std::vector<int>({1, 2, 3}));
+  EXPECT_EQ(state.version(), 1u);
+  EXPECT_EQ(state.Get(), std::vector<int>({1, 2, 3}));
+  EXPECT_EQ(state.version(), 1u);
+}
+
+TEST(SharedStateTest, BatchedUpdates) {
+  auto screen = ScreenInteractive::FitComponent();
+  SharedState<int> counter(screen);
+  const int updates = 10000;
+
+  int frames = 0;
+  std::thread worker;
+  auto component = Renderer([&] {
+    frames++;
+    if (!worker.joinable()) {
+      worker = std::thread([&] {
+        for (int i = 0; i < updates; ++i) {
+          counter.Update([](int& value) { value++; });
+        }
+      });
+    }
+    if (counter.Get() == updates) {
+      screen.Exit();
+    }
+    return text("");
+  });
+
+  screen.Loop(component);
+  worker.join();
+
+  EXPECT_EQ(counter.Get(), updates);
+  EXPECT_LE(counter.version(), size_t(frames));
+  EXPECT_LT(frames, updates);
+}
+
+}  // namespace ftxui
+// NOLINTEND
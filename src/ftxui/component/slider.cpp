@@ -131,6 +131,7 @@ class SliderBase : public ComponentBase {
 
     value_() = util::clamp(value_(), min_(), max_());
     if (old_value != value_()) {
+      Invalidate();
       return true;
     }
 
@@ -144,6 +145,7 @@ class SliderBase : public ComponentBase {
         return true;
       }
 
+      const T old_value = value_();
       switch (options_.direction) {
         case Direction::Right: {
           value_() = min_() + (event.mouse().x - gauge_box_.x_min) *
@@ -171,6 +173,11 @@ class SliderBase : public ComponentBase {
         }
       }
       value_() = std::max(min_(), std::min(max_(), value_()));
+      // Only the slider, and its ancestors, are rendered again. The siblings
+      // decorated by Memo() reuse what they rendered.
+      if (old_value != value_()) {
+        Invalidate();
+      }
       return true;
     }
 
@@ -196,6 +203,9 @@ class SliderBase : public ComponentBase {
   }
 
   bool Focusable() const final { return true; }
+  int EventCategories() const final {
+    return KeyboardEvents | MouseButtonEvents | MouseMotionEvents;
+  }
 
  private:
   Ref<T> value_;
@@ -216,6 +226,10 @@ class SliderWithLabel : public ComponentBase {
   }
 
  private:
+  int EventCategories() const final {
+    return MouseButtonEvents | MouseMotionEvents;
+  }
+
   bool OnEvent(Event event) final {
     if (ComponentBase::OnEvent(event)) {
       return true;
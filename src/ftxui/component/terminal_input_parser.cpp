@@ -6,17 +6,45 @@
 #include <cstdint>                    // for uint32_t
 #include <ftxui/component/mouse.hpp>  // for Mouse, Mouse::Button, Mouse::Motion
 #include <ftxui/component/receiver.hpp>  // for SenderImpl, Sender
-#include <map>
-#include <memory>   // for unique_ptr, allocator
-#include <utility>  // for move
+#include <memory>       // for unique_ptr, allocator
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
 
 #include "ftxui/component/event.hpp"  // for Event
 #include "ftxui/component/task.hpp"   // for Task
 
 namespace ftxui {
 
+namespace {
+// Bracketed paste mode.
+const std::string_view paste_begin = "\x1B[200~";
+const std::string_view paste_end = "\x1B[201~";
+
+// The pasted text, without the brackets, and with `\n` as new lines.
+std::string PastedText(std::string_view sequence) {
+  sequence.remove_prefix(paste_begin.size());
+  sequence.remove_suffix(paste_end.size());
+  std::string text;
+  text.reserve(sequence.size());
+  for (size_t i = 0; i < sequence.size(); ++i) {
+    if (sequence[i] != '\r') {
+      text += sequence[i];
+    } else if (i + 1 >= sequence.size() || sequence[i + 1] != '\n') {
+      text += '\n';
+    }
+  }
+  return text;
+}
+}  // namespace
+
+struct Uniformize {
+  std::string_view from;
+  std::string_view to;
+};
+
 // NOLINTNEXTLINE
-const std::map<std::string, std::string> g_uniformize = {
+constexpr Uniformize g_uniformize[] = {
     // Microsoft's terminal uses a different new line character for the return
     // key. This also happens with linux with the `bind` command:
     // See https://github.com/ArthurSonzogni/FTXUI/issues/337
@@ -24,7 +52,7 @@ const std::map<std::string, std::string> g_uniformize = {
     {"\r", "\n"},
 
     // See: https://github.com/ArthurSonzogni/FTXUI/issues/508
-    {std::string({8}), std::string({127})},
+    {"\x08", "\x7F"},
 
     // See: https://github.com/ArthurSonzogni/FTXUI/issues/626
     //
@@ -100,66 +128,114 @@ void TerminalInputParser::Timeout(int time) {
     return;
   }
   timeout_ = 0;
+  // A pasted text is only complete once its end is received.
+  if (std::string_view(pending_).substr(0, paste_begin.size()) ==
+      paste_begin) {
+    return;
+  }
   if (!pending_.empty()) {
+    // The whole pending input forms the sequence.
+    position_ = static_cast<int>(pending_.size()) - 1;
     Send(SPECIAL);
+    pending_.clear();
   }
 }
 
 void TerminalInputParser::Add(char c) {
-  pending_ += c;
+  Add(std::string_view(&c, 1));
+}
+
+// The sequences are parsed one after the other, starting from |begin_|. A
+// sequence is always complete once its last character is added, so this is
+// equivalent to adding the characters one by one, without parsing the
+// pending input again after each of them.
+void TerminalInputParser::Add(std::string_view input) {
+  pending_ += input;
   timeout_ = 0;
-  position_ = -1;
-  Send(Parse());
+  begin_ = 0;
+  while (begin_ < pending_.size()) {
+    position_ = -1;
+    const Output output = Parse();
+    if (output.type == UNCOMPLETED) {
+      break;
+    }
+    Send(output);
+  }
+  pending_.erase(0, begin_);
+  begin_ = 0;
 }
 
 unsigned char TerminalInputParser::Current() {
-  return pending_[position_];
+  return pending_[begin_ + size_t(position_)];
 }
 
 bool TerminalInputParser::Eat() {
   position_++;
-  return position_ < static_cast<int>(pending_.size());
+  return begin_ + size_t(position_) < pending_.size();
+}
+
+// The sequence parsed, from |begin_| to |position_|.
+std::string_view TerminalInputParser::Sequence() const {
+  return std::string_view(pending_).substr(begin_, size_t(position_) + 1);
 }
 
+// Send the event corresponding to the sequence parsed, and move past it.
 void TerminalInputParser::Send(TerminalInputParser::Output output) {
+  const std::string_view view = Sequence();
+  begin_ += view.size();
+  if (output.type == UNCOMPLETED || output.type == DROP) {
+    return;
+  }
+  // The sequences of the keys and the mouse reports fit in the small string
+  // buffer: no allocation.
+  std::string sequence(view);
+
   switch (output.type) {
     case UNCOMPLETED:
-      return;
-
     case DROP:
-      pending_.clear();
       return;
 
     case CHARACTER:
-      out_->Send(Event::Character(std::move(pending_)));
-      pending_.clear();
+      out_->Send(Event::Character(std::move(sequence)));
       return;
 
     case SPECIAL: {
-      auto it = g_uniformize.find(pending_);
-      if (it != g_uniformize.end()) {
-        pending_ = it->second;
+      for (const Uniformize& uniformize : g_uniformize) {
+        if (sequence == uniformize.from) {
+          sequence = uniformize.to;
+          break;
+        }
       }
-      out_->Send(Event::Special(std::move(pending_)));
-      pending_.clear();
+      out_->Send(Event::Special(std::move(sequence)));
     }
       return;
 
     case MOUSE:
-      out_->Send(Event::Mouse(std::move(pending_), output.mouse));  // NOLINT
-      pending_.clear();
+      out_->Send(Event::Mouse(std::move(sequence), output.mouse));  // NOLINT
+      return;
+
+    case PASTE:
+      out_->Send(Event::Paste(PastedText(sequence)));
       return;
 
     case CURSOR_POSITION:
-      out_->Send(Event::CursorPosition(std::move(pending_),  // NOLINT
+      out_->Send(Event::CursorPosition(std::move(sequence),  // NOLINT
                                        output.cursor.x,      // NOLINT
                                        output.cursor.y));    // NOLINT
-      pending_.clear();
       return;
 
     case CURSOR_SHAPE:
-      out_->Send(Event::CursorShape(std::move(pending_), output.cursor_shape));
-      pending_.clear();
+      out_->Send(Event::CursorShape(std::move(sequence), output.cursor_shape));
+      return;
+
+    case MODE_REPORT:
+      out_->Send(Event::ModeReport(std::move(sequence),
+                                   output.mode_report.mode,     // NOLINT
+                                   output.mode_report.value));  // NOLINT
+      return;
+
+    case TERMINAL_REPORT:
+      out_->Send(Event::TerminalReport(std::move(sequence)));
       return;
   }
   // NOT_REACHED().
@@ -311,16 +387,24 @@ TerminalInputParser::Output TerminalInputParser::ParseDCS() {
       continue;
     }
 
-    if (pending_.size() == 10 &&  //
-        pending_[2] == '1' &&     //
-        pending_[3] == '$' &&     //
-        pending_[4] == 'r' &&     //
+    const std::string_view sequence = Sequence();
+    if (sequence.size() == 10 &&  //
+        sequence[2] == '1' &&     //
+        sequence[3] == '$' &&     //
+        sequence[4] == 'r' &&     //
         true) {
       Output output(CURSOR_SHAPE);
-      output.cursor_shape = pending_[5] - '0';
+      output.cursor_shape = sequence[5] - '0';
       return output;
     }
 
+    // XTGETTCAP: ESC P 1 + r ... or ESC P 0 + r ...
+    // XTVERSION: ESC P > | ...
+    const std::string_view prefix = sequence.substr(2, 3);
+    if (prefix == "1+r" || prefix == "0+r" || prefix.substr(0, 2) == ">|") {
+      return TERMINAL_REPORT;
+    }
+
     return SPECIAL;
   }
 }
@@ -328,7 +412,7 @@ TerminalInputParser::Output TerminalInputParser::ParseDCS() {
 TerminalInputParser::Output TerminalInputParser::ParseCSI() {
   bool altered = false;
   int argument = 0;
-  std::vector<int> arguments;
+  Arguments arguments;
   while (true) {
     if (!Eat()) {
       return UNCOMPLETED;
@@ -346,7 +430,7 @@ TerminalInputParser::Output TerminalInputParser::ParseCSI() {
     }
 
     if (Current() == ';') {
-      arguments.push_back(argument);
+      arguments.Add(argument);
       argument = 0;
       continue;
     }
@@ -358,16 +442,23 @@ TerminalInputParser::Output TerminalInputParser::ParseCSI() {
         Current() != '<' &&
         // To handle F1-F4, we exclude '['.
         Current() != '[') {
-      arguments.push_back(argument);
+      arguments.Add(argument);
       argument = 0;  // NOLINT
 
       switch (Current()) {
         case 'M':
-          return ParseMouse(altered, true, std::move(arguments));
+          return ParseMouse(altered, true, arguments);
         case 'm':
-          return ParseMouse(altered, false, std::move(arguments));
+          return ParseMouse(altered, false, arguments);
         case 'R':
-          return ParseCursorPosition(std::move(arguments));
+          return ParseCursorPosition(arguments);
+        case 'y':
+          return ParseModeReport(arguments);
+        case '~':
+          if (arguments.size == 1 && arguments[0] == 200) {  // NOLINT
+            return ParsePaste();
+          }
+          return SPECIAL;
         default:
           return SPECIAL;
       }
@@ -399,11 +490,22 @@ TerminalInputParser::Output TerminalInputParser::ParseOSC() {
   }
 }
 
+// ESC [ 200 ~ ... ESC [ 201 ~
+TerminalInputParser::Output TerminalInputParser::ParsePaste() {
+  const size_t end = std::string_view(pending_).find(
+      paste_end, begin_ + size_t(position_) + 1);
+  if (end == std::string_view::npos) {
+    return UNCOMPLETED;
+  }
+  position_ = int(end + paste_end.size() - begin_) - 1;
+  return PASTE;
+}
+
 TerminalInputParser::Output TerminalInputParser::ParseMouse(  // NOLINT
     bool altered,
     bool pressed,
-    std::vector<int> arguments) {
-  if (arguments.size() != 3) {
+    const Arguments& arguments) {
+  if (arguments.size != 3) {
     return SPECIAL;
   }
 
@@ -445,8 +547,8 @@ TerminalInputParser::Output TerminalInputParser::ParseMouse(  // NOLINT
 
 // NOLINTNEXTLINE
 TerminalInputParser::Output TerminalInputParser::ParseCursorPosition(
-    std::vector<int> arguments) {
-  if (arguments.size() != 2) {
+    const Arguments& arguments) {
+  if (arguments.size != 2) {
     return SPECIAL;
   }
   Output output(CURSOR_POSITION);
@@ -455,4 +557,19 @@ TerminalInputParser::Output TerminalInputParser::ParseCursorPosition(
   return output;
 }
 
+// DECRPM: ESC [ ? mode ; value $ y
+// NOLINTNEXTLINE
+TerminalInputParser::Output TerminalInputParser::ParseModeReport(
+    const Arguments& arguments) {
+  const std::string_view sequence = Sequence();
+  if (arguments.size != 2 || sequence[2] != '?' ||
+      sequence[sequence.size() - 2] != '$') {
+    return SPECIAL;
+  }
+  Output output(MODE_REPORT);
+  output.mode_report.mode = arguments[0];   // NOLINT
+  output.mode_report.value = arguments[1];  // NOLINT
+  return output;
+}
+
 }  // namespace ftxui
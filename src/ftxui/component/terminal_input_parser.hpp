@@ -4,9 +4,11 @@
 #ifndef FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 #define FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 
-#include <memory>  // for unique_ptr
-#include <string>  // for string
-#include <vector>  // for vector
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <memory>       // for unique_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
 
 #include "ftxui/component/event.hpp"     // for Event (ptr only)
 #include "ftxui/component/mouse.hpp"     // for Mouse
@@ -22,18 +24,26 @@ class TerminalInputParser {
   TerminalInputParser(Sender<Task> out);
   void Timeout(int time);
   void Add(char c);
+  void Add(std::string_view input);
+
+  // Whether an incomplete sequence waits for more characters, or a timeout.
+  bool HasPending() const { return !pending_.empty(); }
 
  private:
   unsigned char Current();
   bool Eat();
+  std::string_view Sequence() const;
 
   enum Type {
     UNCOMPLETED,
     DROP,
     CHARACTER,
     MOUSE,
+    PASTE,
     CURSOR_POSITION,
     CURSOR_SHAPE,
+    MODE_REPORT,
+    TERMINAL_REPORT,
     SPECIAL,
   };
 
@@ -42,12 +52,34 @@ class TerminalInputParser {
     int y;
   };
 
+  struct ModeReport {
+    int mode;
+    int value;
+  };
+
+  // The numeric parameters of a CSI sequence, stored inline, since every mouse
+  // motion sends one. Past the capacity, they are counted, but not stored.
+  struct Arguments {
+    static constexpr size_t kCapacity = 8;
+    std::array<int, kCapacity> values = {};
+    size_t size = 0;
+
+    void Add(int value) {
+      if (size < kCapacity) {
+        values[size] = value;  // NOLINT
+      }
+      ++size;
+    }
+    int operator[](size_t i) const { return values[i]; }  // NOLINT
+  };
+
   struct Output {
     Type type;
     union {
       Mouse mouse;
       CursorPosition cursor;
       int cursor_shape;
+      ModeReport mode_report;
     };
 
     Output(Type t) : type(t) {}
@@ -60,13 +92,18 @@ class TerminalInputParser {
   Output ParseDCS();
   Output ParseCSI();
   Output ParseOSC();
-  Output ParseMouse(bool altered, bool pressed, std::vector<int> arguments);
-  Output ParseCursorPosition(std::vector<int> arguments);
+  Output ParsePaste();
+  Output ParseMouse(bool altered, bool pressed, const Arguments& arguments);
+  Output ParseCursorPosition(const Arguments& arguments);
+  Output ParseModeReport(const Arguments& arguments);
 
   Sender<Task> out_;
+  // The input not sent yet. The sequence being parsed starts at |begin_|, and
+  // |position_| is relative to it.
+  std::string pending_;
+  size_t begin_ = 0;
   int position_ = -1;
   int timeout_ = 0;
-  std::string pending_;
 };
 
 }  // namespace ftxui
@@ -5,7 +5,10 @@
 #include <ftxui/component/task.hpp>   // for Task
 #include <initializer_list>           // for initializer_list
 #include <memory>                     // for allocator, unique_ptr
+#include <string>                     // for string
+#include <string_view>                // for string_view
 #include <variant>                    // for get
+#include <vector>                     // for vector
 
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Backspace, Event::End, Event::Home, Event::Custom, Event::Delete, Event::F1, Event::F10, Event::F11, Event::F12, Event::F2, Event::F3, Event::F4, Event::F5, Event::F6, Event::F7, Event::F8, Event::F9, Event::PageDown, Event::PageUp, Event::Tab, Event::TabReverse, Event::Escape
 #include "ftxui/component/receiver.hpp"  // for MakeReceiver, ReceiverImpl
@@ -494,5 +497,131 @@ TEST(Event, DeviceControlString) {
   EXPECT_FALSE(event_receiver->Receive(&received));
 }
 
+TEST(Event, ModeReport) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.Add("\x1B[?2026;2$y");
+    parser.Add("\x1B[?1049;0$y");
+    parser.Add("\x1B[2026;2y");
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_mode_report());
+  EXPECT_EQ(2026, std::get<Event>(received).reported_mode());
+  EXPECT_EQ(2, std::get<Event>(received).reported_mode_value());
+
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_mode_report());
+  EXPECT_EQ(1049, std::get<Event>(received).reported_mode());
+  EXPECT_EQ(0, std::get<Event>(received).reported_mode_value());
+
+  // Not a DECRPM.
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_FALSE(std::get<Event>(received).is_mode_report());
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+TEST(Event, TerminalReport) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.Add("\x1BP>|XTerm(388)\x1B\\");
+    parser.Add("\x1BP1+r726570=1B5B2564\x1B\\");
+    parser.Add("\x1BP0+r637372\x1B\\");
+    parser.Add("\x1BPabc\x1B\\");
+  }
+
+  Task received;
+  for (const char* report : {
+           "\x1BP>|XTerm(388)\x1B\\",
+           "\x1BP1+r726570=1B5B2564\x1B\\",
+           "\x1BP0+r637372\x1B\\",
+       }) {
+    EXPECT_TRUE(event_receiver->Receive(&received));
+    EXPECT_TRUE(std::get<Event>(received).is_terminal_report());
+    EXPECT_EQ(std::get<Event>(received).input(), report);
+  }
+
+  // Not an answer to XTVERSION or XTGETTCAP.
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_FALSE(std::get<Event>(received).is_terminal_report());
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+TEST(Event, Equality) {
+  EXPECT_EQ(Event::Character('a'), Event::Character("a"));
+  EXPECT_NE(Event::Character('a'), Event::Character('b'));
+  EXPECT_NE(Event::Character('a'), Event::Character("aa"));
+  EXPECT_NE(Event::Special({0}), Event::Special(""));
+  EXPECT_EQ(Event::Special("\x1B[1;5D"), Event::ArrowLeftCtrl);
+  EXPECT_NE(Event::Special("\x1B[1;5D"), Event::ArrowRightCtrl);
+
+  // Inputs sharing the same beginning.
+  EXPECT_EQ(Event::Special("abcdefghij"), Event::Special("abcdefghij"));
+  EXPECT_NE(Event::Special("abcdefghij"), Event::Special("abcdefghik"));
+  EXPECT_NE(Event::Special("abcdefgh"), Event::Special("abcdefghi"));
+  EXPECT_NE(Event::Special("abcdefg"), Event::Special("abcdefgh"));
+}
+
+TEST(Event, BracketedPaste) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.Add("a\x1B[200~b\r\nc\x1B[A");
+    // The pasted text doesn't time out.
+    parser.Timeout(50);
+    parser.Add("\rd\x1B[201~e");
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('a'));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_paste());
+  EXPECT_EQ(std::get<Event>(received).paste(), "b\nc\x1B[A\nd");
+  EXPECT_EQ(std::get<Event>(received), Event::Paste("b\nc\x1B[A\nd"));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('e'));
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+// Adding the input at once, or in several parts, must produce the same events
+// as adding it character by character.
+TEST(Event, AddString) {
+  const std::string input =
+      "a\x1B[A\xE2\x82\xAC\x1B[<0;1;2M\x1B[3~\x1BP1$r1 q\x1B\\b\r\x1B[";
+
+  auto events = [](auto add) {
+    auto event_receiver = MakeReceiver<Task>();
+    {
+      auto parser = TerminalInputParser(event_receiver->MakeSender());
+      add(parser);
+      parser.Timeout(50);
+    }
+    std::vector<std::string> output;
+    Task received;
+    while (event_receiver->Receive(&received)) {
+      output.push_back(std::get<Event>(received).input());
+    }
+    return output;
+  };
+
+  const auto expected = events([&](TerminalInputParser& parser) {
+    for (char c : input) {
+      parser.Add(c);
+    }
+  });
+  EXPECT_EQ(expected.size(), 9);
+
+  for (size_t i = 0; i <= input.size(); ++i) {
+    EXPECT_EQ(expected, events([&](TerminalInputParser& parser) {
+      parser.Add(std::string_view(input).substr(0, i));
+      parser.Add(std::string_view(input).substr(i));
+    }));
+  }
+}
+
 }  // namespace ftxui
    // NOLINTEND
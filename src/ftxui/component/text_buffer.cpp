@@ -0,0 +1,244 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/text_buffer.hpp"
+
+#include <algorithm>  // for min, upper_bound
+#include <cstddef>    // for size_t
+#include <iterator>   // for make_move_iterator
+#include <string>     // for string
+#include <utility>    // for move
+#include <vector>     // for vector
+
+namespace ftxui {
+
+namespace {
+
+// The number of lines per block. A block is split when it grows twice as
+// large, and merged with the next one when it shrinks below a quarter.
+constexpr size_t kBlockSize = 256;
+
+std::vector<std::string> SplitLines(const std::string& text) {
+  std::vector<std::string> lines;
+  size_t start = 0;
+  while (true) {
+    const size_t end = text.find('\n', start);
+    if (end == std::string::npos) {
+      lines.push_back(text.substr(start));
+      return lines;
+    }
+    lines.push_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+}
+
+}  // namespace
+
+TextBuffer::TextBuffer() : TextBuffer(std::string()) {}
+
+TextBuffer::TextBuffer(const std::string& text) {
+  blocks_.emplace_back();
+  blocks_[0].lines = SplitLines(text);
+  Split(0);
+  Measure(0);
+  Update(0);
+}
+
+std::string TextBuffer::str() const {
+  std::string out;
+  out.reserve(size_);
+  for (const Block& block : blocks_) {
+    for (const std::string& line : block.lines) {
+      out += line;
+      out += '\n';
+    }
+  }
+  out.pop_back();
+  return out;
+}
+
+const std::string& TextBuffer::Line(size_t line) const {
+  const Block& block = blocks_[BlockOfLine(line)];
+  return block.lines[line - block.first_line];
+}
+
+size_t TextBuffer::LineStart(size_t line) const {
+  const Block& block = blocks_[BlockOfLine(line)];
+  size_t offset = block.first_byte;
+  for (size_t i = block.first_line; i < line; ++i) {
+    offset += block.lines[i - block.first_line].size() + 1;
+  }
+  return offset;
+}
+
+size_t TextBuffer::LineOf(size_t offset) const {
+  size_t block = 0;
+  size_t index = 0;
+  size_t column = 0;
+  Locate(offset, &block, &index, &column);
+  return blocks_[block].first_line + index;
+}
+
+void TextBuffer::Insert(size_t offset, const std::string& text) {
+  if (text.empty()) {
+    return;
+  }
+  size_t b = 0;
+  size_t index = 0;
+  size_t column = 0;
+  Locate(offset, &b, &index, &column);
+  std::vector<std::string>& lines = blocks_[b].lines;
+
+  std::vector<std::string> inserted = SplitLines(text);
+  if (inserted.size() == 1) {
+    lines[index].insert(column, text);
+  } else {
+    std::string& line = lines[index];
+    inserted.back() += line.substr(column);
+    line.resize(column);
+    line += inserted[0];
+    lines.insert(lines.begin() + index + 1,
+                 std::make_move_iterator(inserted.begin() + 1),
+                 std::make_move_iterator(inserted.end()));
+  }
+
+  Measure(b);
+  Split(b);
+  Update(b);
+}
+
+void TextBuffer::Erase(size_t offset, size_t count) {
+  offset = std::min(offset, size_);
+  count = std::min(count, size_ - offset);
+  if (count == 0) {
+    return;
+  }
+
+  size_t b1 = 0;
+  size_t i1 = 0;
+  size_t c1 = 0;
+  size_t b2 = 0;
+  size_t i2 = 0;
+  size_t c2 = 0;
+  Locate(offset, &b1, &i1, &c1);
+  Locate(offset + count, &b2, &i2, &c2);
+
+  // Join the beginning of the first line with the end of the last one.
+  std::string tail = blocks_[b2].lines[i2].substr(c2);
+  std::string& first = blocks_[b1].lines[i1];
+  first.resize(c1);
+  first += tail;
+
+  // Remove the lines in between.
+  std::vector<std::string>& lines = blocks_[b1].lines;
+  if (b1 == b2) {
+    lines.erase(lines.begin() + i1 + 1, lines.begin() + i2 + 1);
+  } else {
+    lines.erase(lines.begin() + i1 + 1, lines.end());
+    std::vector<std::string>& last = blocks_[b2].lines;
+    last.erase(last.begin(), last.begin() + i2 + 1);
+    const size_t end = last.empty() ? b2 + 1 : b2;
+    if (!last.empty()) {
+      Measure(b2);
+    }
+    blocks_.erase(blocks_.begin() + b1 + 1, blocks_.begin() + end);
+  }
+
+  // Avoid accumulating small blocks.
+  if (b1 + 1 < blocks_.size() && lines.size() < kBlockSize / 4) {
+    std::vector<std::string>& next = blocks_[b1 + 1].lines;
+    lines.insert(lines.end(), std::make_move_iterator(next.begin()),
+                 std::make_move_iterator(next.end()));
+    blocks_.erase(blocks_.begin() + b1 + 1);
+  }
+
+  Measure(b1);
+  Split(b1);
+  Update(b1);
+}
+
+size_t TextBuffer::BlockOfLine(size_t line) const {
+  auto it = std::upper_bound(
+      blocks_.begin(), blocks_.end(), line,
+      [](size_t l, const Block& block) { return l < block.first_line; });
+  return it - blocks_.begin() - 1;
+}
+
+void TextBuffer::Locate(size_t offset,
+                        size_t* block,
+                        size_t* index,
+                        size_t* column) const {
+  offset = std::min(offset, size_);
+  auto it = std::upper_bound(
+      blocks_.begin(), blocks_.end(), offset,
+      [](size_t o, const Block& b) { return o < b.first_byte; });
+  *block = it - blocks_.begin() - 1;
+
+  const Block& b = blocks_[*block];
+  size_t start = b.first_byte;
+  for (size_t i = 0; i < b.lines.size(); ++i) {
+    if (offset <= start + b.lines[i].size()) {
+      *index = i;
+      *column = offset - start;
+      return;
+    }
+    start += b.lines[i].size() + 1;
+  }
+  // Not reached: |offset| is at most |size_|.
+  *index = b.lines.size() - 1;
+  *column = b.lines.back().size();
+}
+
+void TextBuffer::Measure(size_t block) {
+  Block& b = blocks_[block];
+  b.bytes = 0;
+  for (const std::string& line : b.lines) {
+    b.bytes += line.size() + 1;
+  }
+}
+
+// Split |block| in blocks of kBlockSize lines, if it grew too large.
+void TextBuffer::Split(size_t block) {
+  std::vector<std::string>& lines = blocks_[block].lines;
+  if (lines.size() <= 2 * kBlockSize) {
+    return;
+  }
+
+  std::vector<Block> added;
+  for (size_t i = kBlockSize; i < lines.size(); i += kBlockSize) {
+    Block b;
+    const size_t end = std::min(i + kBlockSize, lines.size());
+    b.lines.assign(std::make_move_iterator(lines.begin() + i),
+                   std::make_move_iterator(lines.begin() + end));
+    added.push_back(std::move(b));
+  }
+  lines.resize(kBlockSize);
+  Measure(block);
+  blocks_.insert(blocks_.begin() + block + 1,
+                 std::make_move_iterator(added.begin()),
+                 std::make_move_iterator(added.end()));
+  for (size_t i = 0; i < added.size(); ++i) {
+    Measure(block + 1 + i);
+  }
+}
+
+// Recompute where the blocks start, from |block| onward.
+void TextBuffer::Update(size_t block) {
+  size_t first_line = 0;
+  size_t first_byte = 0;
+  if (block > 0) {
+    const Block& previous = blocks_[block - 1];
+    first_line = previous.first_line + previous.lines.size();
+    first_byte = previous.first_byte + previous.bytes;
+  }
+  for (size_t i = block; i < blocks_.size(); ++i) {
+    blocks_[i].first_line = first_line;
+    blocks_[i].first_byte = first_byte;
+    first_line += blocks_[i].lines.size();
+    first_byte += blocks_[i].bytes;
+  }
+  line_count_ = first_line;
+  size_ = first_byte - 1;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,99 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/component/text_buffer.hpp"  // for TextBuffer
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(TextBufferTest, Empty) {
+  TextBuffer buffer;
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_EQ(buffer.LineCount(), 1u);
+  EXPECT_EQ(buffer.Line(0), "");
+  EXPECT_EQ(buffer.str(), "");
+}
+
+TEST(TextBufferTest, Lines) {
+  TextBuffer buffer("abc\n\ndef\n");
+  EXPECT_EQ(buffer.size(), 9u);
+  EXPECT_EQ(buffer.LineCount(), 4u);
+  EXPECT_EQ(buffer.Line(0), "abc");
+  EXPECT_EQ(buffer.Line(1), "");
+  EXPECT_EQ(buffer.Line(2), "def");
+  EXPECT_EQ(buffer.Line(3), "");
+  EXPECT_EQ(buffer.LineStart(2), 5u);
+  EXPECT_EQ(buffer.LineOf(0), 0u);
+  EXPECT_EQ(buffer.LineOf(3), 0u);
+  EXPECT_EQ(buffer.LineOf(4), 1u);
+  EXPECT_EQ(buffer.LineOf(5), 2u);
+  EXPECT_EQ(buffer.LineOf(9), 3u);
+}
+
+TEST(TextBufferTest, Insert) {
+  TextBuffer buffer("abc\ndef");
+  buffer.Insert(1, "X");
+  EXPECT_EQ(buffer.str(), "aXbc\ndef");
+  buffer.Insert(2, "1\n2\n3");
+  EXPECT_EQ(buffer.str(), "aX1\n2\n3bc\ndef");
+  EXPECT_EQ(buffer.LineCount(), 4u);
+  buffer.Insert(buffer.size(), "\n");
+  EXPECT_EQ(buffer.str(), "aX1\n2\n3bc\ndef\n");
+  EXPECT_EQ(buffer.LineCount(), 5u);
+}
+
+TEST(TextBufferTest, Erase) {
+  TextBuffer buffer("abc\ndef\nghi");
+  buffer.Erase(1, 1);
+  EXPECT_EQ(buffer.str(), "ac\ndef\nghi");
+  buffer.Erase(2, 1);
+  EXPECT_EQ(buffer.str(), "acdef\nghi");
+  buffer.Erase(1, 6);
+  EXPECT_EQ(buffer.str(), "ahi");
+  buffer.Erase(0, 100);
+  EXPECT_TRUE(buffer.empty());
+}
+
+// Edits spanning multiple blocks must keep the buffer equal to the same edits
+// applied to a std::string.
+TEST(TextBufferTest, ManyLines) {
+  std::string reference;
+  for (int i = 0; i < 2000; ++i) {
+    reference += "line " + std::to_string(i) + "\n";
+  }
+  TextBuffer buffer(reference);
+  EXPECT_EQ(buffer.str(), reference);
+  EXPECT_EQ(buffer.LineCount(), 2001u);
+
+  auto insert = [&](size_t offset, const std::string& text) {
+    reference.insert(offset, text);
+    buffer.Insert(offset, text);
+  };
+  auto erase = [&](size_t offset, size_t count) {
+    reference.erase(offset, count);
+    buffer.Erase(offset, count);
+  };
+
+  insert(100, "\n\n\n");
+  erase(50, 5000);
+  insert(7000, std::string(1000, '\n'));
+  erase(3000, 9000);
+  insert(0, "x");
+  erase(reference.size() - 20, 20);
+  EXPECT_EQ(buffer.str(), reference);
+  EXPECT_EQ(buffer.size(), reference.size());
+
+  size_t offset = 0;
+  for (size_t line = 0; line < buffer.LineCount(); ++line) {
+    EXPECT_EQ(buffer.LineStart(line), offset);
+    EXPECT_EQ(buffer.LineOf(offset), line);
+    offset += buffer.Line(line).size() + 1;
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -3,10 +3,16 @@
 // the LICENSE file.
 #define NOMINMAX
 #include <algorithm>
+#include <array>  // for array
 #include <ftxui/component/component.hpp>
 #include <ftxui/component/component_base.hpp>
 #include <ftxui/component/screen_interactive.hpp>  // for ScreenInteractive
+#include <memory>  // for shared_ptr, make_shared
+#include <string>  // for string
+#include "ftxui/dom/node.hpp"                      // for Node, Render
+#include "ftxui/dom/node_arena.hpp"                // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"            // for NodeDecorator
+#include "ftxui/screen/screen.hpp"                 // for Screen, Pixel
 
 namespace ftxui {
 
@@ -85,6 +91,49 @@ class ResizeDecorator : public NodeDecorator {
   const bool resize_down_;
 };
 
+// Copy the cells of an offscreen Screen.
+class Composited : public Node {
+ public:
+  explicit Composited(std::shared_ptr<const Screen> offscreen)
+      : offscreen_(std::move(offscreen)) {}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    requirement_.min_x = offscreen_->dimx();
+    requirement_.min_y = offscreen_->dimy();
+  }
+
+  void Render(Screen& screen) override {
+    Box box = Box::Intersection(box_, screen.stencil);
+    box.x_max = std::min(box.x_max, box_.x_min + offscreen_->dimx() - 1);
+    box.y_max = std::min(box.y_max, box_.y_min + offscreen_->dimy() - 1);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Pixel& pixel = screen.PixelAt(x, y);
+        pixel = offscreen_->PixelAt(x - box_.x_min, y - box_.y_min);
+        // The hyperlink ids are only meaningful for the Screen registering
+        // them.
+        if (pixel.hyperlink) {
+          pixel.hyperlink =
+              screen.RegisterHyperlink(offscreen_->Hyperlink(pixel.hyperlink));
+        }
+      }
+    }
+
+    // The cursor placed by the content, if any.
+    Screen::Cursor cursor = offscreen_->cursor();
+    if (cursor.x >= 0 && box_.x_min + cursor.x <= box.x_max &&
+        box_.y_min + cursor.y <= box.y_max) {
+      cursor.x += box_.x_min;
+      cursor.y += box_.y_min;
+      screen.SetCursor(cursor);
+    }
+  }
+
+ private:
+  std::shared_ptr<const Screen> offscreen_;
+};
+
 Element DefaultRenderState(const WindowRenderState& state) {
   Element element = state.inner;
   if (state.active) {
@@ -96,13 +145,13 @@ Element DefaultRenderState(const WindowRenderState& state) {
 
   const Color color = Color::Red;
 
-  element = std::make_shared<ResizeDecorator>(  //
-      element,                                  //
-      state.hover_left,                         //
-      state.hover_right,                        //
-      state.hover_top,                          //
-      state.hover_down,                         //
-      color                                     //
+  element = MakeNode<ResizeDecorator>(  //
+      element,                          //
+      state.hover_left,                 //
+      state.hover_right,                //
+      state.hover_top,                  //
+      state.hover_down,                 //
+      color                             //
   );
 
   return element;
@@ -119,13 +168,11 @@ class WindowImpl : public ComponentBase, public WindowOptions {
 
  private:
   Element Render() final {
-    auto element = ComponentBase::Render();
-
     const bool captureable =
         captured_mouse_ || ScreenInteractive::Active()->CaptureMouse();
 
-    const WindowRenderState state = {
-        element,
+    WindowRenderState state = {
+        nullptr,
         title(),
         Active(),
         drag_,
@@ -136,7 +183,13 @@ class WindowImpl : public ComponentBase, public WindowOptions {
         (resize_down_hover_ || resize_down_) && captureable,
     };
 
-    element = render ? render(state) : DefaultRenderState(state);
+    Element element;
+    if (composited) {
+      element = RenderComposited(state);
+    } else {
+      state.inner = ComponentBase::Render();
+      element = render ? render(state) : DefaultRenderState(state);
+    }
 
     // Position and record the drawn area of the window.
     element |= reflect(box_window_);
@@ -146,8 +199,67 @@ class WindowImpl : public ComponentBase, public WindowOptions {
     return element;
   }
 
+  // Render the window into |offscreen_|, unless it is still up to date: the
+  // window wasn't invalidated, and its state and size didn't change.
+  Element RenderComposited(WindowRenderState& state) {
+    const std::array<bool, 7> flags = {
+        state.active,      state.drag,      state.resize,    state.hover_left,
+        state.hover_right, state.hover_top, state.hover_down,
+    };
+    if (!offscreen_ || Invalidated() || flags != offscreen_flags_ ||
+        state.title != offscreen_title_ || offscreen_->dimx() != width() ||
+        offscreen_->dimy() != height()) {
+      state.inner = ComponentBase::Render();
+      const Element element =
+          render ? render(state) : DefaultRenderState(state);
+      auto offscreen = std::make_shared<Screen>(width(), height());
+      offscreen->SetCursor({-1, -1, Screen::Cursor::Hidden});
+      ftxui::Render(*offscreen, element);
+      offscreen_ = std::move(offscreen);
+      offscreen_flags_ = flags;
+      offscreen_title_ = state.title;
+      Validate();
+    }
+    return MakeNode<Composited>(offscreen_);
+  }
+
+  // Forward |event| to the content. A composited window is laid out in its
+  // own Screen: the mouse coordinates are made relative to the window.
+  bool OnContentEvent(Event event) {
+    if (!composited) {
+      return ComponentBase::OnEvent(event);
+    }
+    bool invalidates = true;
+    if (event.is_mouse()) {
+      const bool hover = box_window_.Contain(event.mouse().x, event.mouse().y);
+      // The content only displays something else when the mouse enters,
+      // moves within or leaves it. While a component holds the mouse, only
+      // when it handles the event.
+      invalidates = (hover || content_hover_) && CaptureMouse(event);
+      content_hover_ = hover;
+      event.mouse().x -= box_window_.x_min;
+      event.mouse().y -= box_window_.y_min;
+    }
+    const bool handled = ComponentBase::OnEvent(event);
+    if (invalidates || handled) {
+      Invalidate();
+    }
+    return handled;
+  }
+
+  void OnAnimation(animation::Params& params) final {
+    if (composited) {
+      Invalidate();
+    }
+    ComponentBase::OnAnimation(params);
+  }
+
+  int EventCategories() const final {
+    return MouseButtonEvents | MouseMotionEvents;
+  }
+
   bool OnEvent(Event event) final {
-    if (ComponentBase::OnEvent(event)) {
+    if (OnContentEvent(event)) {
       return true;
     }
 
@@ -257,6 +369,13 @@ class WindowImpl : public ComponentBase, public WindowOptions {
   Box box_;
   Box box_window_;
 
+  // The window, drawn offscreen when composited, and the state it was drawn
+  // with.
+  std::shared_ptr<const Screen> offscreen_;
+  std::array<bool, 7> offscreen_flags_ = {};
+  std::string offscreen_title_;
+  bool content_hover_ = false;
+
   CapturedMouse captured_mouse_;
   int drag_start_x = 0;
   int drag_start_y = 0;
@@ -281,6 +400,12 @@ class WindowImpl : public ComponentBase, public WindowOptions {
 /// @brief A draggeable / resizeable window. To use multiple of them, they must
 /// be stacked using `Container::Stacked({...})` component;
 ///
+/// With `composited`, the window is drawn into its own offscreen Screen, and
+/// its cells are copied from there. It is only rendered again when its size,
+/// title or decoration changes, or when Invalidate() is called on it or on its
+/// content. The events reaching the content invalidate it, like Memo(). The
+/// mouse coordinates the content receives are relative to the window.
+///
 /// @param option A struct holding every parameters.
 /// @ingroup component
 /// @see Window
@@ -0,0 +1,77 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/component/component.hpp"  // for Window, Renderer, CatchEvent, Stacked
+#include "ftxui/component/component_options.hpp"   // for WindowOptions
+#include "ftxui/component/event.hpp"               // for Event
+#include "ftxui/component/loop.hpp"                // for Loop
+#include "ftxui/component/mouse.hpp"               // for Mouse
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(WindowTest, Composited) {
+  int renders = 0;
+  int mouse_x = -1;
+  int mouse_y = -1;
+  auto content = CatchEvent(Renderer([&] {
+                              renders++;
+                              return text("content");
+                            }),
+                            [&](Event event) {
+                              if (event.is_mouse()) {
+                                mouse_x = event.mouse().x;
+                                mouse_y = event.mouse().y;
+                              }
+                              return false;
+                            });
+  int left = 0;
+  auto component = Container::Stacked({
+      Window({
+          .inner = content,
+          .title = "title",
+          .left = &left,
+          .width = 10,
+          .height = 4,
+          .composited = true,
+      }),
+  });
+
+  auto screen = ScreenInteractive::Headless(20, 4);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+  EXPECT_NE(screen.HeadlessOutput().find("content"), std::string::npos);
+
+  // Drag the window. The content isn't rendered again.
+  screen.HeadlessInput("\x1B[<0;4;2M");
+  loop.RunOnce();
+  const int grabbed = renders;
+  screen.HeadlessInput("\x1B[<32;9;2M");
+  loop.RunOnce();
+  EXPECT_EQ(left, 5);
+  EXPECT_EQ(renders, grabbed);
+  EXPECT_NE(screen.HeadlessOutput().find("content"), std::string::npos);
+  screen.HeadlessInput("\x1B[<0;9;2m");
+  loop.RunOnce();
+
+  // The content receives the mouse relative to the window.
+  screen.HeadlessInput("\x1B[<35;9;3M");
+  loop.RunOnce();
+  EXPECT_EQ(mouse_x, 3);
+  EXPECT_EQ(mouse_y, 2);
+
+  // An event reaching the content renders it again.
+  const int before = renders;
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(renders, before + 1);
+}
+
+}  // namespace ftxui
+// NOLINTEND
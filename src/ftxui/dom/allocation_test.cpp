@@ -0,0 +1,187 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <cstdlib>  // for malloc, free
+#include <new>      // for bad_alloc
+#include <string>   // for string, to_string
+
+#include "ftxui/dom/elements.hpp"    // for text, hbox, vbox, border, Element
+#include "ftxui/dom/node.hpp"        // for Render
+#include "ftxui/dom/node_arena.hpp"  // for NodeArena
+#include "ftxui/screen/color.hpp"    // for Color
+#include "ftxui/screen/screen.hpp"   // for Screen
+#include "ftxui/screen/string.hpp"   // for string_width, Utf8ToGlyphs
+#include "ftxui/screen/terminal.hpp" // for SetColorSupport
+
+// This file is built as its own executable, ftxui-allocation-tests. It
+// replaces the global operator new to count the allocations of the steady
+// state frames, and check them against a budget.
+
+namespace {
+std::atomic<size_t> g_allocations{0};  // NOLINT
+}  // namespace
+
+// The allocations so far. Also used by the other files of this executable.
+size_t AllocationCount() {
+  return g_allocations;
+}
+
+// NOLINTBEGIN
+void* operator new(std::size_t size) {
+  ++g_allocations;
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  ++g_allocations;
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace ftxui {
+
+namespace {
+
+// The number of allocations made by |fn|.
+template <typename Fn>
+size_t Allocations(Fn fn) {
+  const size_t before = g_allocations;
+  fn();
+  return g_allocations - before;
+}
+
+// An 80x24 gallery of styles, colors, borders and wide characters.
+Element Gallery() {
+  Elements lines;
+  for (int i = 0; i < 10; ++i) {
+    lines.push_back(hbox({
+        text("normal "),
+        text("bold ") | bold,
+        text("inverted ") | inverted,
+        text("colored ") | color(Color::Palette256(i + 16)),
+        text("rgb ") | bgcolor(Color::RGB(20 * i, 64, 128)),
+        text("測試 ") | underlined,
+        text("line " + std::to_string(i)),
+    }));
+  }
+  return vbox(std::move(lines)) | border;
+}
+
+class AllocationTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Terminal::SetColorSupport(Terminal::Color::TrueColor);
+    Render(screen_, Gallery());
+    // Reach the steady state: the buffers have grown to their final size.
+    for (int i = 0; i < 2; ++i) {
+      output_.clear();
+      screen_.ToString(output_);
+    }
+  }
+
+  Screen screen_{80, 24};
+  std::string output_;
+};
+
+}  // namespace
+
+TEST_F(AllocationTest, ToString) {
+  EXPECT_EQ(Allocations([&] {
+              output_.clear();
+              screen_.ToString(output_);
+            }),
+            0u);
+}
+
+TEST_F(AllocationTest, ToStringDiff) {
+  const Screen previous = screen_;
+  output_.clear();
+  screen_.ToStringDiff(previous, output_);
+  // A single allocation, for the row of changed cells.
+  EXPECT_LE(Allocations([&] {
+              output_.clear();
+              screen_.ToStringDiff(previous, output_);
+            }),
+            1u);
+}
+
+TEST_F(AllocationTest, ColorPrint) {
+  const Color colors[] = {Color::Red, Color::Palette256(123),
+                          Color::RGB(1, 2, 3)};
+  EXPECT_EQ(Allocations([&] {
+              for (const Color& color : colors) {
+                output_.clear();
+                color.Print(false, output_);
+                color.Print(true, output_);
+              }
+            }),
+            0u);
+}
+
+TEST_F(AllocationTest, StringWidth) {
+  const std::string text = "Hello, 測試, ℏ, and some more text.";
+  int width = 0;
+  EXPECT_EQ(Allocations([&] { width = string_width(text); }), 0u);
+#if !defined(FTXUI_NO_UNICODE_TABLES)
+  EXPECT_EQ(width, 35);
+#endif
+}
+
+TEST_F(AllocationTest, Utf8ToGlyphs) {
+  // A single allocation, for the vector returned.
+  const std::string text = "Hello, 測試, ℏ, and some more text.";
+  EXPECT_LE(Allocations([&] { Utf8ToGlyphs(text); }), 1u);
+}
+
+TEST_F(AllocationTest, RenderUnchangedGallery) {
+  // Every frame builds the Elements again: about 130 Nodes, their strings and
+  // their vectors of children.
+  const size_t allocations = Allocations([&] {
+    screen_.Clear();
+    Render(screen_, Gallery());
+  });
+  EXPECT_LE(allocations, 220u);
+}
+
+TEST_F(AllocationTest, RenderUnchangedGalleryWithArena) {
+  // The Nodes come from the arena. The strings and the vectors of children
+  // are still allocated individually.
+  NodeArena arena;
+  for (int i = 0; i < 2; ++i) {
+    NodeArena::Scope scope(&arena);
+    Render(screen_, Gallery());
+  }
+  const size_t allocations = Allocations([&] {
+    NodeArena::Scope scope(&arena);
+    screen_.Clear();
+    Render(screen_, Gallery());
+  });
+  EXPECT_LE(allocations, 75u);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,11 +1,12 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, automerge
 #include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
 #include "ftxui/screen/screen.hpp"       // for Pixel, Screen
@@ -29,7 +30,7 @@ Element automerge(Element child) {
     }
   };
 
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
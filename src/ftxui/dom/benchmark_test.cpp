@@ -2,11 +2,21 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <benchmark/benchmark.h>
+#include <cmath>  // for sin
 #include <iostream>
+#include <string>   // for string, to_string
+#include <utility>  // for move, swap
+#include <vector>   // for vector
 
+#include "ftxui/dom/canvas.hpp"    // for Canvas
 #include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
-#include "ftxui/dom/node.hpp"      // for Render
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig
+#include "ftxui/dom/linear_gradient.hpp"  // for LinearGradient
+#include "ftxui/dom/node.hpp"            // for Render
+#include "ftxui/dom/table.hpp"           // for Table
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/terminal.hpp"  // for ColorSupport, SetColorSupport
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -83,5 +93,229 @@ BENCHMARK(BenchmarkStyle)
         benchmark::CreateDenseRange(10, 200, 20),  // Screen width.
     });
 
+static void BenchmarkCanvasPolyline(benchmark::State& state) {
+  const int samples = 2000;
+  std::vector<std::vector<Canvas::Point>> series(10);
+  for (int s = 0; s < 10; ++s) {
+    for (int i = 0; i < samples; ++i) {
+      const float y = 100.f + 90.f * std::sin(0.01f * float(i * (s + 1)));
+      series[s].push_back({i * 400 / samples, int(y)});
+    }
+  }
+  while (state.KeepRunning()) {
+    Canvas c(400, 200);
+    for (int s = 0; s < 10; ++s) {
+      c.DrawPointPolyline(series[s], Color::Palette256(s + 1));
+    }
+    benchmark::DoNotOptimize(c);
+  }
+}
+BENCHMARK(BenchmarkCanvasPolyline);
+
+static void BenchmarkFlexbox(benchmark::State& state) {
+  Elements words;
+  for (int i = 0; i < state.range(0); ++i) {
+    words.push_back(text("word" + std::to_string(i)) | border);
+  }
+  FlexboxConfig config;
+  config.Set(FlexboxConfig::JustifyContent::SpaceBetween);
+  config.SetGap(1, 0);
+  for (auto _ : state) {
+    auto document = flexbox(words, config);
+    Screen screen(120, 60);
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkFlexbox)->RangeMultiplier(4)->Range(4, 1024);
+
+static void BenchmarkGridbox(benchmark::State& state) {
+  std::vector<Elements> lines;
+  for (int y = 0; y < state.range(0); ++y) {
+    Elements line;
+    for (int x = 0; x < 8; ++x) {
+      line.push_back(text(std::to_string(x * y)) | border);
+    }
+    lines.push_back(std::move(line));
+  }
+  for (auto _ : state) {
+    auto document = gridbox(lines);
+    Screen screen(80, 3 * int(state.range(0)));
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkGridbox)->RangeMultiplier(4)->Range(4, 256);
+
+static void BenchmarkTable(benchmark::State& state) {
+  std::vector<std::vector<std::string>> rows;
+  for (int y = 0; y < state.range(0); ++y) {
+    rows.push_back({std::to_string(y), "name " + std::to_string(y),
+                    std::to_string(y * 3.14), "status"});
+  }
+  for (auto _ : state) {
+    Table table(rows);
+    table.SelectAll().Border(LIGHT);
+    table.SelectRow(0).Decorate(bold);
+    table.SelectRow(0).SeparatorVertical(LIGHT);
+    table.SelectColumn(0).DecorateCells(align_right);
+    table.SelectRows(1, -1).DecorateCellsAlternateRow(inverted, 2, 0);
+    auto document = table.Render();
+    Screen screen(80, 2 * int(state.range(0)) + 2);
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkTable)->RangeMultiplier(4)->Range(4, 256);
+
+// Scaling -------------------------------------------------------------------
+
+// |depth| boxes nested into each other, alternating hbox and vbox.
+static void BenchmarkScalingNestedBoxes(benchmark::State& state) {
+  for (auto _ : state) {
+    Element element = text("leaf");
+    for (int i = 0; i < state.range(0); ++i) {
+      element = i % 2 ? hbox({text("a"), element}) : vbox({text("b"), element});
+    }
+    Screen screen(80, 24);
+    Render(screen, element);
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BenchmarkScalingNestedBoxes)
+    ->RangeMultiplier(2)
+    ->Range(8, 256)
+    ->Complexity();
+
+// The same document, on screens of increasing size. The complexity is
+// reported relatively to the number of cells.
+static void BenchmarkScalingScreenSize(benchmark::State& state) {
+  const int dimx = int(state.range(0));
+  const int dimy = dimx / 3;
+  Elements words;
+  for (int i = 0; i < 200; ++i) {
+    words.push_back(text("word" + std::to_string(i)) | border);
+  }
+  for (auto _ : state) {
+    auto document = flexbox(words) | color(Color::Red);
+    Screen screen(dimx, dimy);
+    Render(screen, document);
+  }
+  state.SetComplexityN(int64_t(dimx) * dimy);
+}
+BENCHMARK(BenchmarkScalingScreenSize)
+    ->RangeMultiplier(2)
+    ->Range(32, 1024)
+    ->Complexity();
+
+// Bytes on the wire ---------------------------------------------------------
+
+namespace {
+
+// The scenes of the examples, at the frame |step| of an animation.
+Element StyleGallery(int step) {
+  return vbox({
+             hbox({
+                 text("normal"),
+                 text(" bold") | bold,
+                 text(" dim") | dim,
+                 text(" inverted") | inverted,
+                 text(" underlined") | underlined,
+                 text(" blink") | blink,
+                 text(" strikethrough") | strikethrough,
+             }),
+             hbox({
+                 text("color") | color(Color::Blue),
+                 text(" bgcolor") | bgcolor(Color::Blue),
+                 text(" rgb") | color(Color::RGB(255, 128, 64)),
+                 text(" hyperlink") | hyperlink("https://example.com"),
+             }),
+             text("frame " + std::to_string(step)),
+         }) |
+         border;
+}
+
+Element Gradient(int step) {
+  return text("gradient") | center |
+         bgcolor(LinearGradient()
+                     .Angle(float(step % 360))
+                     .Stop(Color::DeepPink1)
+                     .Stop(Color::DeepSkyBlue1));
+}
+
+Element TableScene(int step) {
+  std::vector<std::vector<std::string>> rows = {
+      {"Version", "Marketing name", "Release date", "API level"}};
+  for (int i = 0; i < 10; ++i) {
+    rows.push_back({std::to_string(i), "Release " + std::to_string(i),
+                    std::to_string(2010 + i), std::to_string(10 + i)});
+  }
+  Table table(rows);
+  table.SelectAll().Border(LIGHT);
+  table.SelectRow(0).Decorate(bold);
+  table.SelectRow(0).SeparatorVertical(LIGHT);
+  table.SelectRows(1, -1).DecorateCellsAlternateRow(color(Color::Blue), 3, 0);
+  table.SelectRows(1, -1).DecorateCellsAlternateRow(color(Color::Red), 3, 1);
+  table.SelectRow(1 + step % 10).Decorate(bgcolor(Color::RGB(40, 40, 80)));
+  return table.Render();
+}
+
+Element CanvasScene(int step) {
+  Canvas c(160, 88);
+  for (int x = 0; x < 160; ++x) {
+    const float phase = 0.1f * float(x + step);
+    c.DrawPointLine(x, 44 + int(20.f * std::sin(phase)), x + 1,
+                    44 + int(20.f * std::sin(phase + 0.1f)), Color::Red);
+    c.DrawBlock(x, 44 + int(30.f * std::cos(phase)),
+                true, Color::RGB(uint8_t(x), 128, uint8_t(255 - x)));
+  }
+  return canvas(std::move(c));
+}
+
+}  // namespace
+
+// The bytes written to the terminal per frame of an animated scene, for every
+// color support. Either the full frame, or the difference with the previous
+// one, as ScreenInteractive does.
+static void BenchmarkOutputBytes(benchmark::State& state) {
+  Element (*const scenes[])(int) = {StyleGallery, Gradient, TableScene,
+                                    CanvasScene};
+  const auto scene = scenes[state.range(0)];
+  const auto color_support = Terminal::Color(state.range(1));
+  const bool diff = state.range(2);
+
+  const auto previous_color_support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(color_support);
+  Screen previous(80, 24);
+  Screen screen(80, 24);
+  std::string output;
+  size_t bytes = 0;
+  int step = 0;
+  Render(previous, scene(step++));
+  for (auto _ : state) {
+    screen.Clear();
+    Render(screen, scene(step++));
+    output.clear();
+    if (diff) {
+      screen.ToStringDiff(previous, output);
+    } else {
+      screen.ToString(output);
+    }
+    bytes += output.size();
+    std::swap(previous, screen);
+  }
+  Terminal::SetColorSupport(previous_color_support);
+  state.counters["bytes_per_frame"] =
+      benchmark::Counter(double(bytes), benchmark::Counter::kAvgIterations);
+  state.SetBytesProcessed(int64_t(bytes));
+}
+BENCHMARK(BenchmarkOutputBytes)
+    ->ArgNames({"scene", "colors", "diff"})
+    ->ArgsProduct({
+        // style_gallery, linear_gradient, table, canvas.
+        benchmark::CreateDenseRange(0, 3, 1),
+        // Palette16, Palette256, TrueColor.
+        {Terminal::Color::Palette16, Terminal::Color::Palette256,
+         Terminal::Color::TrueColor},
+        {0, 1},  // Full frame, difference with the previous frame.
+    });
+
 }  // namespace ftxui
 // NOLINTEND
@@ -1,37 +1,20 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, blink
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"   // for Element, blink
+#include "ftxui/dom/style.hpp"      // for Styled
+#include "ftxui/screen/screen.hpp"  // for PixelStyle
 
 namespace ftxui {
 
-namespace {
-class Blink : public NodeDecorator {
- public:
-  using NodeDecorator::NodeDecorator;
-
-  void Render(Screen& screen) override {
-    Node::Render(screen);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).blink = true;
-      }
-    }
-  }
-};
-}  // namespace
-
 /// @brief The text drawn alternates in between visible and hidden.
 /// @ingroup dom
 Element blink(Element child) {
-  return std::make_shared<Blink>(std::move(child));
+  PixelStyle style;
+  style.fields = PixelStyle::kBlink;
+  return Styled(std::move(child), {}, style);
 }
 
 }  // namespace ftxui
@@ -4,14 +4,16 @@
 #include <algorithm>               // for max
 #include <array>                   // for array
 #include <ftxui/screen/color.hpp>  // for Color
-#include <memory>    // for allocator, make_shared, __shared_ptr_access
+#include <memory>    // for shared_ptr, allocator, __shared_ptr_access
 #include <optional>  // for optional, nullopt
-#include <string>    // for basic_string, string
-#include <utility>   // for move
+#include <string>       // for basic_string, string
+#include <string_view>  // for string_view
+#include <utility>      // for move
 #include <vector>    // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for unpack, Element, Decorator, BorderStyle, ROUNDED, borderStyled, Elements, DASHED, DOUBLE, EMPTY, HEAVY, LIGHT, border, borderDashed, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, borderWith, window
-#include "ftxui/dom/node.hpp"      // for Node, Elements
+#include "ftxui/dom/elements.hpp"     // for unpack, Element, Decorator, BorderStyle, ROUNDED, borderStyled, Elements, DASHED, DOUBLE, EMPTY, HEAVY, LIGHT, border, borderDashed, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, borderWith, window
+#include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
@@ -19,10 +21,10 @@
 namespace ftxui {
 
 namespace {
-using Charset = std::array<std::string, 6>;  // NOLINT
-using Charsets = std::array<Charset, 6>;     // NOLINT
+using Charset = std::array<std::string_view, 6>;  // NOLINT
+using Charsets = std::array<Charset, 6>;          // NOLINT
 // NOLINTNEXTLINE
-static Charsets simple_border_charset = {
+constexpr Charsets simple_border_charset = {
     Charset{"┌", "┐", "└", "┘", "─", "│"},  // LIGHT
     Charset{"┏", "┓", "┗", "┛", "╍", "╏"},  // DASHED
     Charset{"┏", "┓", "┗", "┛", "━", "┃"},  // HEAVY
@@ -67,13 +69,13 @@ class Border : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->UpdateBox(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->UpdateBox(box);
   }
 
   void Render(Screen& screen) override {
@@ -158,13 +160,13 @@ class BorderPixel : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->UpdateBox(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->UpdateBox(box);
   }
 
   void Render(Screen& screen) override {
@@ -225,7 +227,7 @@ class BorderPixel : public Node {
 /// └───────────┘
 /// ```
 Element border(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Same as border but with a constant Pixel around the element.
@@ -233,7 +235,7 @@ Element border(Element child) {
 /// @see border
 Decorator borderWith(const Pixel& pixel) {
   return [pixel](Element child) {
-    return std::make_shared<BorderPixel>(unpack(std::move(child)), pixel);
+    return MakeNode<BorderPixel>(unpack(std::move(child)), pixel);
   };
 }
 
@@ -242,7 +244,7 @@ Decorator borderWith(const Pixel& pixel) {
 /// @see border
 Decorator borderStyled(BorderStyle style) {
   return [style](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style);
+    return MakeNode<Border>(unpack(std::move(child)), style);
   };
 }
 
@@ -251,7 +253,7 @@ Decorator borderStyled(BorderStyle style) {
 /// @see border
 Decorator borderStyled(Color foreground_color) {
   return [foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), ROUNDED,
+    return MakeNode<Border>(unpack(std::move(child)), ROUNDED,
                                     foreground_color);
   };
 }
@@ -261,7 +263,7 @@ Decorator borderStyled(Color foreground_color) {
 /// @see border
 Decorator borderStyled(BorderStyle style, Color foreground_color) {
   return [style, foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style,
+    return MakeNode<Border>(unpack(std::move(child)), style,
                                     foreground_color);
   };
 }
@@ -298,7 +300,7 @@ Decorator borderStyled(BorderStyle style, Color foreground_color) {
 /// ┗╍╍╍╍╍╍╍╍╍╍╍╍╍╍┛
 /// ```
 Element borderDashed(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DASHED);
+  return MakeNode<Border>(unpack(std::move(child)), DASHED);
 }
 
 /// @brief Draw a dashed border around the element.
@@ -333,7 +335,7 @@ Element borderDashed(Element child) {
 /// └──────────────┘
 /// ```
 Element borderLight(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), LIGHT);
+  return MakeNode<Border>(unpack(std::move(child)), LIGHT);
 }
 
 /// @brief Draw a heavy border around the element.
@@ -368,7 +370,7 @@ Element borderLight(Element child) {
 /// ┗━━━━━━━━━━━━━━┛
 /// ```
 Element borderHeavy(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), HEAVY);
+  return MakeNode<Border>(unpack(std::move(child)), HEAVY);
 }
 
 /// @brief Draw a double border around the element.
@@ -403,7 +405,7 @@ Element borderHeavy(Element child) {
 /// ╚══════════════╝
 /// ```
 Element borderDouble(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DOUBLE);
+  return MakeNode<Border>(unpack(std::move(child)), DOUBLE);
 }
 
 /// @brief Draw a rounded border around the element.
@@ -438,7 +440,7 @@ Element borderDouble(Element child) {
 /// ╰──────────────╯
 /// ```
 Element borderRounded(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Draw an empty border around the element.
@@ -473,7 +475,7 @@ Element borderRounded(Element child) {
 ///
 /// ```
 Element borderEmpty(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), EMPTY);
+  return MakeNode<Border>(unpack(std::move(child)), EMPTY);
 }
 
 /// @brief Draw window with a title and a border around the element.
@@ -498,7 +500,7 @@ Element borderEmpty(Element child) {
 /// └───────┘
 /// ```
 Element window(Element title, Element content) {
-  return std::make_shared<Border>(unpack(std::move(content), std::move(title)),
+  return MakeNode<Border>(unpack(std::move(content), std::move(title)),
                                   ROUNDED);
 }
 }  // namespace ftxui
@@ -4,6 +4,8 @@
 #include "ftxui/dom/box_helper.hpp"
 
 #include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <vector>     // for vector
 
 namespace ftxui::box_helper {
 
@@ -11,10 +13,19 @@ namespace {
 // Called when the size allowed is greater than the requested size. This
 // distributes the extra spaces toward the flexible elements, in relative
 // proportions.
-void ComputeGrow(std::vector<Element>* elements,
+void ComputeGrow(Element* elements,
+                 size_t size,
                  int extra_space,
                  int flex_grow_sum) {
-  for (Element& element : *elements) {
+  // Nothing grows: every element gets its minimum size.
+  if (flex_grow_sum == 0) {
+    for (size_t i = 0; i < size; ++i) {
+      elements[i].size = elements[i].min_size;
+    }
+    return;
+  }
+  for (size_t i = 0; i < size; ++i) {
+    Element& element = elements[i];
     const int added_space =
         extra_space * element.flex_grow / std::max(flex_grow_sum, 1);
     extra_space -= added_space;
@@ -26,10 +37,12 @@ void ComputeGrow(std::vector<Element>* elements,
 // Called when the size allowed is lower than the requested size, and the
 // shrinkable element can absorbe the (negative) extra_space. This distribute
 // the extra_space toward those.
-void ComputeShrinkEasy(std::vector<Element>* elements,
+void ComputeShrinkEasy(Element* elements,
+                       size_t size,
                        int extra_space,
                        int flex_shrink_sum) {
-  for (Element& element : *elements) {
+  for (size_t i = 0; i < size; ++i) {
+    Element& element = elements[i];
     const int added_space = extra_space * element.min_size *
                             element.flex_shrink / std::max(flex_shrink_sum, 1);
     extra_space -= added_space;
@@ -42,10 +55,12 @@ void ComputeShrinkEasy(std::vector<Element>* elements,
 // shrinkable element can not absorbe the (negative) extra_space. This assign
 // zero to shrinkable elements and distribute the remaining (negative)
 // extra_space toward the other non shrinkable elements.
-void ComputeShrinkHard(std::vector<Element>* elements,
+void ComputeShrinkHard(Element* elements,
+                       size_t count,
                        int extra_space,
                        int size) {
-  for (Element& element : *elements) {
+  for (size_t i = 0; i < count; ++i) {
+    Element& element = elements[i];
     if (element.flex_shrink != 0) {
       element.size = 0;
       continue;
@@ -61,13 +76,14 @@ void ComputeShrinkHard(std::vector<Element>* elements,
 
 }  // namespace
 
-void Compute(std::vector<Element>* elements, int target_size) {
+void Compute(Element* elements, size_t count, int target_size) {
   int size = 0;
   int flex_grow_sum = 0;
   int flex_shrink_sum = 0;
   int flex_shrink_size = 0;
 
-  for (auto& element : *elements) {
+  for (size_t i = 0; i < count; ++i) {
+    const Element& element = elements[i];
     flex_grow_sum += element.flex_grow;
     flex_shrink_sum += element.min_size * element.flex_shrink;
     if (element.flex_shrink != 0) {
@@ -78,14 +94,18 @@ void Compute(std::vector<Element>* elements, int target_size) {
 
   const int extra_space = target_size - size;
   if (extra_space >= 0) {
-    ComputeGrow(elements, extra_space, flex_grow_sum);
+    ComputeGrow(elements, count, extra_space, flex_grow_sum);
   } else if (flex_shrink_size + extra_space >= 0) {
-    ComputeShrinkEasy(elements, extra_space, flex_shrink_sum);
+    ComputeShrinkEasy(elements, count, extra_space, flex_shrink_sum);
 
   } else {
-    ComputeShrinkHard(elements, extra_space + flex_shrink_size,
+    ComputeShrinkHard(elements, count, extra_space + flex_shrink_size,
                       size - flex_shrink_size);
   }
 }
 
+void Compute(std::vector<Element>* elements, int target_size) {
+  Compute(elements->data(), elements->size(), target_size);
+}
+
 }  // namespace ftxui::box_helper
@@ -4,7 +4,9 @@
 #ifndef FTXUI_DOM_BOX_HELPER_HPP
 #define FTXUI_DOM_BOX_HELPER_HPP
 
-#include <vector>
+#include <array>    // for array
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
 
 namespace ftxui {
 namespace box_helper {
@@ -19,8 +21,29 @@ struct Element {
   int size = 0;
 };
 
+void Compute(Element* elements, size_t size, int target_size);
 void Compute(std::vector<Element>* elements, int target_size);
 
+// The elements of a box. The first ones are stored inline, so that small boxes
+// don't allocate on every layout.
+class ElementBuffer {
+ public:
+  explicit ElementBuffer(size_t size) : size_(size) {
+    if (size_ > inline_.size()) {
+      heap_.resize(size_);
+    }
+  }
+
+  Element* data() { return heap_.empty() ? inline_.data() : heap_.data(); }
+  size_t size() const { return size_; }
+  Element& operator[](size_t i) { return data()[i]; }
+
+ private:
+  size_t size_;
+  std::array<Element, 16> inline_;  // NOLINT
+  std::vector<Element> heap_;
+};
+
 }  // namespace box_helper
 }  // namespace ftxui
 
@@ -0,0 +1,204 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <memory>     // for shared_ptr, make_shared
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, cached
+#include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/dom/requirement.hpp"     // for Requirement
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+
+namespace ftxui {
+
+namespace {
+
+// The pixels of the element last drawn for a key, and its requirement.
+struct Raster {
+  size_t key = 0;
+  uint64_t last_used = 0;
+  Requirement requirement;
+  Screen pixels = Screen(0, 0);
+};
+
+// The rasters kept at most by every thread. The least recently used one is
+// dropped first.
+constexpr size_t kMaxRasters = 64;
+
+struct Rasters {
+  std::vector<std::shared_ptr<Raster>> list;
+  uint64_t clock = 0;
+};
+
+Rasters& GetRasters() {
+  thread_local Rasters rasters;
+  return rasters;
+}
+
+std::shared_ptr<Raster> FindRaster(size_t key) {
+  Rasters& rasters = GetRasters();
+  for (const auto& raster : rasters.list) {
+    if (raster->key == key) {
+      raster->last_used = ++rasters.clock;
+      return raster;
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<Raster> InsertRaster(size_t key) {
+  Rasters& rasters = GetRasters();
+  auto raster = std::make_shared<Raster>();
+  raster->key = key;
+  raster->last_used = ++rasters.clock;
+  if (rasters.list.size() < kMaxRasters) {
+    rasters.list.push_back(raster);
+    return raster;
+  }
+  auto* oldest = &rasters.list[0];
+  for (auto& it : rasters.list) {
+    if (it->last_used < (*oldest)->last_used) {
+      oldest = &it;
+    }
+  }
+  *oldest = raster;
+  return raster;
+}
+
+// Draw the child once into an offscreen Screen, and copy its pixels on the
+// following frames, as long as the key and the dimensions are the same. The
+// child is then neither laid out nor drawn.
+class Cached : public NodeDecorator {
+ public:
+  Cached(Element child, size_t key)
+      : NodeDecorator(std::move(child)), key_(key) {}
+
+  void ComputeRequirement() override {
+    if (Hit()) {
+      requirement_ = raster_->requirement;
+      return;
+    }
+    NodeDecorator::ComputeRequirement();
+  }
+
+  void SetBox(Box box) override {
+    if (Hit()) {
+      Node::SetBox(box);
+      if (box.x_max - box.x_min + 1 == raster_->pixels.dimx() &&
+          box.y_max - box.y_min + 1 == raster_->pixels.dimy()) {
+        return;
+      }
+      // The dimensions changed. The child is laid out from now on.
+      miss_ = true;
+      restart_ = true;
+      children_[0]->ComputeRequirement();
+      requirement_ = children_[0]->requirement();
+    }
+    NodeDecorator::SetBox(box);
+  }
+
+  void Check(Status* status) override {
+    if (Hit()) {
+      status->need_iteration |= (status->iteration == 0);
+      return;
+    }
+    Node::Check(status);
+    status->need_iteration |= restart_;
+    restart_ = false;
+  }
+
+  void Render(Screen& screen) override {
+    if (!Hit()) {
+      Draw();
+    }
+    Paint(screen);
+  }
+
+  // Every cell is copied, including the blank ones.
+  Box OpaqueBox() const override { return box_; }
+
+ private:
+  // Whether the pixels drawn previously are used, instead of the child.
+  bool Hit() {
+    if (!looked_up_) {
+      looked_up_ = true;
+      raster_ = FindRaster(key_);
+    }
+    return raster_ && !miss_;
+  }
+
+  void Draw() {
+    if (!raster_) {
+      raster_ = InsertRaster(key_);
+    }
+    const int dimx = box_.x_max - box_.x_min + 1;
+    const int dimy = box_.y_max - box_.y_min + 1;
+    raster_->requirement = requirement_;
+    raster_->pixels = Screen(std::max(dimx, 0), std::max(dimy, 0));
+
+    // Draw the child at the origin of the offscreen Screen, then put it back.
+    children_[0]->SetBox({0, dimx - 1, 0, dimy - 1});
+    children_[0]->Render(raster_->pixels);
+    children_[0]->SetBox(box_);
+    miss_ = false;
+  }
+
+  void Paint(Screen& screen) const {
+    const Screen& pixels = raster_->pixels;
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Pixel pixel = pixels.PixelAt(x - box_.x_min, y - box_.y_min);
+        // The hyperlinks ids are specific to the screen registering them.
+        if (pixel.hyperlink != 0) {
+          pixel.hyperlink =
+              screen.RegisterHyperlink(pixels.Hyperlink(pixel.hyperlink));
+        }
+        screen.PixelAt(x, y) = std::move(pixel);
+      }
+    }
+  }
+
+  const size_t key_;
+  std::shared_ptr<Raster> raster_;
+  bool looked_up_ = false;
+  bool miss_ = false;
+  bool restart_ = false;
+};
+
+}  // namespace
+
+/// @brief Draw the element once, and copy its pixels on the following frames.
+///
+/// The decorated element is drawn into an offscreen Screen. As long as an
+/// element decorated with the same |key| is given a box of the same
+/// dimensions, the pixels are copied from it, and the element is neither laid
+/// out nor drawn. Change the |key| when the element changes.
+///
+/// This is useful for the elements expensive to lay out, but rarely changing,
+/// like a large gridbox, or some ASCII art.
+///
+/// The element is opaque: the cells it leaves blank are drawn blank. The boxes
+/// reflected inside it are not updated when its pixels are copied.
+/// @param key Identifies the content of the element.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element legend = gridbox(rows) | cached(legend_version);
+/// ```
+Decorator cached(size_t key) {
+  return [key](Element child) {
+    return MakeNode<Cached>(std::move(child), key);
+  };
+}
+
+}  // namespace ftxui
@@ -0,0 +1,118 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>   // for make_shared
+#include <string>   // for string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"   // for cached, text, hbox, hyperlink
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+// A text counting how many times it has been rendered and laid out.
+class Counter : public Node {
+ public:
+  Counter(int* count, int* layout_count, std::string text)
+      : count_(count), layout_count_(layout_count), text_(std::move(text)) {}
+  void ComputeRequirement() override {
+    ++*layout_count_;
+    requirement_.min_x = 3;
+    requirement_.min_y = 1;
+  }
+  void Render(Screen& screen) override {
+    ++*count_;
+    for (int i = 0; i < 3; ++i) {
+      screen.PixelAt(box_.x_min + i, box_.y_min).character = text_[i];
+    }
+  }
+
+ private:
+  int* count_;
+  int* layout_count_;
+  std::string text_;
+};
+}  // namespace
+
+TEST(CachedTest, ReusePixels) {
+  int count = 0;
+  int layout_count = 0;
+  auto make = [&](std::string content, size_t key) {
+    return hbox({
+        text("-"),
+        std::make_shared<Counter>(&count, &layout_count, content) |
+            cached(key),
+    });
+  };
+
+  Screen screen(5, 1);
+  Render(screen, make("abc", 100));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(screen.ToString(), "-abc ");
+
+  // A new element, with the same key: its pixels are copied.
+  screen.Clear();
+  layout_count = 0;
+  Render(screen, make("xyz", 100));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(layout_count, 0);
+  EXPECT_EQ(screen.ToString(), "-abc ");
+
+  // A new key.
+  screen.Clear();
+  Render(screen, make("xyz", 101));
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(screen.ToString(), "-xyz ");
+}
+
+TEST(CachedTest, Resized) {
+  int count = 0;
+  int layout_count = 0;
+  auto make = [&](std::string content) {
+    return std::make_shared<Counter>(&count, &layout_count, content) |
+           cached(200);
+  };
+
+  Screen small(3, 1);
+  Render(small, make("abc"));
+  EXPECT_EQ(count, 1);
+
+  // The dimensions changed: the element is laid out and drawn again.
+  Screen large(4, 1);
+  Render(large, make("xyz"));
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(large.ToString(), "xyz ");
+
+  Screen large_again(4, 1);
+  Render(large_again, make("abc"));
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(large_again.ToString(), "xyz ");
+}
+
+#if !defined(FTXUI_NO_HYPERLINKS)
+TEST(CachedTest, Hyperlink) {
+  auto make = [] {
+    return hbox({
+        text("-"),
+        text("abc") | hyperlink("https://example.com") | cached(300),
+    });
+  };
+  Screen screen(4, 1);
+  Render(screen, make());
+
+  // The hyperlink is registered again in the new screen.
+  Screen other(4, 1);
+  other.RegisterHyperlink("https://other.com");
+  Render(other, make());
+  const uint16_t id = other.PixelAt(1, 0).hyperlink;
+  EXPECT_NE(id, 0);
+  EXPECT_EQ(other.Hyperlink(id), "https://example.com");
+}
+#endif
+
+}  // namespace ftxui
+// NOLINTEND
@@ -3,22 +3,26 @@
 // the LICENSE file.
 #include "ftxui/dom/canvas.hpp"
 
-#include <algorithm>               // for max, min
+#include <algorithm>               // for max, min, fill
+#include <array>                   // for array
 #include <cmath>                   // for abs
-#include <cstdint>                 // for uint8_t
+#include <cstdint>                 // for uint8_t, uint32_t
 #include <cstdlib>                 // for abs
 #include <ftxui/screen/color.hpp>  // for Color
-#include <map>                     // for map
-#include <memory>                  // for make_shared
+#include <memory>                  // for shared_ptr
+#include <string>                  // for string
+#include <string_view>             // for string_view
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
 #include "ftxui/dom/elements.hpp"     // for Element, canvas
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"    // for Utf8ToGlyphs
+#include "ftxui/screen/string.hpp"    // for Utf8Glyphs
+#include "ftxui/screen/thread_pool.hpp"  // for Concurrency, Run
 #include "ftxui/util/ref.hpp"         // for ConstRef
 
 namespace ftxui {
@@ -47,38 +51,60 @@ namespace {
 // 11100010 10100000 10100000 // dot6
 // 11100010 10100010 10000000 // dot0-2
 
+// A cell stores the offset of its braille character from U+2800, as a mask of
+// its dots. Its two high bits end up in the second byte, and the six others in
+// the third one. See BrailleGlyphs().
 // NOLINTNEXTLINE
-uint8_t g_map_braille[2][4][2] = {
+constexpr uint8_t g_map_braille[2][4] = {
     {
-        {0b00000000, 0b00000001},  // NOLINT | dot1
-        {0b00000000, 0b00000010},  // NOLINT | dot2
-        {0b00000000, 0b00000100},  // NOLINT | dot3
-        {0b00000001, 0b00000000},  // NOLINT | dot0-1
+        0b00000001,  // NOLINT | dot1
+        0b00000010,  // NOLINT | dot2
+        0b00000100,  // NOLINT | dot3
+        0b01000000,  // NOLINT | dot0-1
     },
     {
-        {0b00000000, 0b00001000},  // NOLINT | dot4
-        {0b00000000, 0b00010000},  // NOLINT | dot5
-        {0b00000000, 0b00100000},  // NOLINT | dot6
-        {0b00000010, 0b00000000},  // NOLINT | dot0-2
+        0b00001000,  // NOLINT | dot4
+        0b00010000,  // NOLINT | dot5
+        0b00100000,  // NOLINT | dot6
+        0b10000000,  // NOLINT | dot0-2
     },
 };
 
+// The braille characters, indexed by their offset from U+2800, built once.
+const std::array<std::string, 256>& BrailleGlyphs() {  // NOLINT
+  static const auto glyphs = [] {
+    std::array<std::string, 256> table;  // NOLINT
+    for (size_t bits = 0; bits < table.size(); ++bits) {
+      table[bits] = "⠀";  // 3 bytes.
+      table[bits][1] |= char(bits >> 6);    // NOLINT
+      table[bits][2] |= char(bits & 0x3F);  // NOLINT
+    }
+    return table;
+  }();
+  return glyphs;
+}
+
 // NOLINTNEXTLINE
-std::vector<std::string> g_map_block = {
+constexpr std::string_view g_map_block[] = {
     " ", "▘", "▖", "▌", "▝", "▀", "▞", "▛",
     "▗", "▚", "▄", "▙", "▐", "▜", "▟", "█",
 };
 
-// NOLINTNEXTLINE
-const std::map<std::string, uint8_t> g_map_block_inversed = {
-    {" ", 0b0000}, {"▘", 0b0001}, {"▖", 0b0010}, {"▌", 0b0011},
-    {"▝", 0b0100}, {"▀", 0b0101}, {"▞", 0b0110}, {"▛", 0b0111},
-    {"▗", 0b1000}, {"▚", 0b1001}, {"▄", 0b1010}, {"▙", 0b1011},
-    {"▐", 0b1100}, {"▜", 0b1101}, {"▟", 0b1110}, {"█", 0b1111},
-};
-
 constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 
+bool SameStyle(const Pixel& a, const Pixel& b) {
+  return a.blink == b.blink && a.bold == b.bold && a.dim == b.dim &&
+         a.inverted == b.inverted && a.underlined == b.underlined &&
+         a.underlined_double == b.underlined_double &&
+         a.strikethrough == b.strikethrough && a.automerge == b.automerge &&
+         a.hyperlink == b.hyperlink && a.character == b.character &&
+         a.background_color == b.background_color &&
+         a.foreground_color == b.foreground_color;
+}
+
+// The number of recent styles looked up before adding a new one.
+constexpr size_t kStyleLookup = 8;
+
 }  // namespace
 
 /// @brief Constructor.
@@ -87,14 +113,30 @@ constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 Canvas::Canvas(int width, int height)
     : width_(width),
       height_(height),
-      storage_(width_ * height_ / 8 /* NOLINT */) {}
+      cells_x_((std::max(width, 0) + 1) / 2),
+      cells_y_((std::max(height, 0) + 3) / 4),
+      cells_(size_t(cells_x_) * size_t(cells_y_)) {}
 
 /// @brief Get the content of a cell.
 /// @param x the x coordinate of the cell.
 /// @param y the y coordinate of the cell.
 Pixel Canvas::GetPixel(int x, int y) const {
-  auto it = storage_.find(XY{x, y});
-  return (it == storage_.end()) ? Pixel() : it->second.content;
+  if (x < 0 || x >= cells_x_ || y < 0 || y >= cells_y_) {
+    return Pixel();
+  }
+  const Cell& cell = cells_[size_t(y) * size_t(cells_x_) + size_t(x)];
+  Pixel pixel = styles_[cell.style];
+  switch (cell.type) {
+    case CellType::kBraille:
+      pixel.character = BrailleGlyphs()[cell.bits];
+      break;
+    case CellType::kBlock:
+      pixel.character = g_map_block[cell.bits];
+      break;
+    case CellType::kText:
+      break;
+  }
+  return pixel;
 }
 
 /// @brief Draw a braille dot.
@@ -102,7 +144,11 @@ Pixel Canvas::GetPixel(int x, int y) const {
 /// @param y the y coordinate of the dot.
 /// @param value whether the dot is filled or not.
 void Canvas::DrawPoint(int x, int y, bool value) {
-  DrawPoint(x, y, value, [](Pixel& /*pixel*/) {});
+  if (value) {
+    DrawPointOn(x, y);
+  } else {
+    DrawPointOff(x, y);
+  }
 }
 
 /// @brief Draw a braille dot.
@@ -135,14 +181,12 @@ void Canvas::DrawPointOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 bytes.
-    cell.type = CellType::kBraille;
+  Cell* cell = CellAt(x, y);
+  if (cell->type != CellType::kBraille) {
+    cell->type = CellType::kBraille;
+    cell->bits = 0;
   }
-
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell->bits |= g_map_braille[x % 2][y % 4];  // NOLINT
 }
 
 /// @brief Erase a braille dot.
@@ -152,14 +196,12 @@ void Canvas::DrawPointOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
+  Cell* cell = CellAt(x, y);
+  if (cell->type != CellType::kBraille) {
+    cell->type = CellType::kBraille;
+    cell->bits = 0;
   }
-
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  cell->bits &= ~g_map_braille[x % 2][y % 4];  // NOLINT
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -170,14 +212,12 @@ void Canvas::DrawPointToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
+  Cell* cell = CellAt(x, y);
+  if (cell->type != CellType::kBraille) {
+    cell->type = CellType::kBraille;
+    cell->bits = 0;
   }
-
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell->bits ^= g_map_braille[x % 2][y % 4];  // NOLINT
 }
 
 /// @brief Draw a line made of braille dots.
@@ -211,6 +251,7 @@ void Canvas::DrawPointLine(int x1,
                            int x2,
                            int y2,
                            const Stylizer& style) {
+  StyleMemo memo;
   const int dx = std::abs(x2 - x1);
   const int dy = std::abs(y2 - y1);
   const int sx = x1 < x2 ? 1 : -1;
@@ -226,7 +267,7 @@ void Canvas::DrawPointLine(int x1,
 
   int error = dx - dy;
   for (int i = 0; i < length; ++i) {
-    DrawPoint(x1, y1, true, style);
+    DrawPoint(x1, y1, true, style, &memo);
     if (2 * error >= -dy) {
       error -= dy;
       x1 += sx;
@@ -236,7 +277,7 @@ void Canvas::DrawPointLine(int x1,
       y1 += sy;
     }
   }
-  DrawPoint(x2, y2, true, style);
+  DrawPoint(x2, y2, true, style, &memo);
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -334,6 +375,7 @@ void Canvas::DrawPointEllipse(int x1,
                               int r1,
                               int r2,
                               const Stylizer& s) {
+  StyleMemo memo;
   int x = -r1;
   int y = 0;
   int e2 = r2;
@@ -342,10 +384,10 @@ void Canvas::DrawPointEllipse(int x1,
   int err = dx + dy;
 
   do {
-    DrawPoint(x1 - x, y1 + y, true, s);
-    DrawPoint(x1 + x, y1 + y, true, s);
-    DrawPoint(x1 + x, y1 - y, true, s);
-    DrawPoint(x1 - x, y1 - y, true, s);
+    DrawPoint(x1 - x, y1 + y, true, s, &memo);
+    DrawPoint(x1 + x, y1 + y, true, s, &memo);
+    DrawPoint(x1 + x, y1 - y, true, s, &memo);
+    DrawPoint(x1 - x, y1 - y, true, s, &memo);
     e2 = 2 * err;
     if (e2 >= dx) {
       x++;
@@ -358,8 +400,8 @@ void Canvas::DrawPointEllipse(int x1,
   } while (x <= 0);
 
   while (y++ < r2) {
-    DrawPoint(x1, y1 + y, true, s);
-    DrawPoint(x1, y1 - y, true, s);
+    DrawPoint(x1, y1 + y, true, s, &memo);
+    DrawPoint(x1, y1 - y, true, s, &memo);
   }
 }
 
@@ -387,6 +429,52 @@ void Canvas::DrawPointEllipseFilled(int x1,
                          [color](Pixel& p) { p.foreground_color = color; });
 }
 
+/// @brief Draw a line made of braille dots, joining consecutive points.
+/// @param points the points, in dots.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points) {
+  DrawPointsOn(points, CellType::kBraille, true, nullptr);
+}
+
+/// @brief Draw a line made of braille dots, joining consecutive points.
+/// @param points the points, in dots.
+/// @param style the style of the line.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points,
+                               const Stylizer& style) {
+  DrawPointsOn(points, CellType::kBraille, true, &style);
+}
+
+/// @brief Draw a line made of braille dots, joining consecutive points.
+/// @param points the points, in dots.
+/// @param color the color of the line.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points,
+                               const Color& color) {
+  const Stylizer style = [color](Pixel& p) { p.foreground_color = color; };
+  DrawPointsOn(points, CellType::kBraille, true, &style);
+}
+
+/// @brief Draw one braille dot per point.
+/// @param points the points, in dots.
+void Canvas::DrawPointScatter(const std::vector<Point>& points) {
+  DrawPointsOn(points, CellType::kBraille, false, nullptr);
+}
+
+/// @brief Draw one braille dot per point.
+/// @param points the points, in dots.
+/// @param style the style of the dots.
+void Canvas::DrawPointScatter(const std::vector<Point>& points,
+                              const Stylizer& style) {
+  DrawPointsOn(points, CellType::kBraille, false, &style);
+}
+
+/// @brief Draw one braille dot per point.
+/// @param points the points, in dots.
+/// @param color the color of the dots.
+void Canvas::DrawPointScatter(const std::vector<Point>& points,
+                              const Color& color) {
+  const Stylizer style = [color](Pixel& p) { p.foreground_color = color; };
+  DrawPointsOn(points, CellType::kBraille, false, &style);
+}
+
 /// @brief Draw a filled ellipse made of braille dots.
 /// @param x1 the x coordinate of the center of the ellipse.
 /// @param y1 the y coordinate of the center of the ellipse.
@@ -398,6 +486,7 @@ void Canvas::DrawPointEllipseFilled(int x1,
                                     int r1,
                                     int r2,
                                     const Stylizer& s) {
+  StyleMemo memo;
   int x = -r1;
   int y = 0;
   int e2 = r2;
@@ -407,8 +496,8 @@ void Canvas::DrawPointEllipseFilled(int x1,
 
   do {
     for (int xx = x1 + x; xx <= x1 - x; ++xx) {
-      DrawPoint(xx, y1 + y, true, s);
-      DrawPoint(xx, y1 - y, true, s);
+      DrawPoint(xx, y1 + y, true, s, &memo);
+      DrawPoint(xx, y1 - y, true, s, &memo);
     }
     e2 = 2 * err;
     if (e2 >= dx) {
@@ -423,7 +512,7 @@ void Canvas::DrawPointEllipseFilled(int x1,
 
   while (y++ < r2) {
     for (int yy = y1 - y; yy <= y1 + y; ++yy) {
-      DrawPoint(x1, yy, true, s);
+      DrawPoint(x1, yy, true, s, &memo);
     }
   }
 }
@@ -433,7 +522,11 @@ void Canvas::DrawPointEllipseFilled(int x1,
 /// @param y the y coordinate of the block.
 /// @param value whether the block is filled or not.
 void Canvas::DrawBlock(int x, int y, bool value) {
-  DrawBlock(x, y, value, [](Pixel& /*pixel*/) {});
+  if (value) {
+    DrawBlockOn(x, y);
+  } else {
+    DrawBlockOff(x, y);
+  }
 }
 
 /// @brief Draw a block.
@@ -466,17 +559,15 @@ void Canvas::DrawBlockOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  y /= 2;
-  Cell& cell = storage_[XY{x / 2, y / 2}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
+  Cell* cell = CellAt(x, y);
+  if (cell->type != CellType::kBlock) {
+    cell->type = CellType::kBlock;
+    cell->bits = 0;
   }
+  y /= 2;
 
   const uint8_t bit = (x % 2) * 2 + y % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value |= 1U << bit;
-  cell.content.character = g_map_block[value];
+  cell->bits |= 1U << bit;
 }
 
 /// @brief Erase a block.
@@ -486,17 +577,15 @@ void Canvas::DrawBlockOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
+  Cell* cell = CellAt(x, y);
+  if (cell->type != CellType::kBlock) {
+    cell->type = CellType::kBlock;
+    cell->bits = 0;
   }
   y /= 2;
 
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value &= ~(1U << bit);
-  cell.content.character = g_map_block[value];
+  cell->bits &= ~(1U << bit);
 }
 
 /// @brief Toggle a block. If it is filled, it will be erased. If it is empty,
@@ -507,17 +596,15 @@ void Canvas::DrawBlockToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
+  Cell* cell = CellAt(x, y);
+  if (cell->type != CellType::kBlock) {
+    cell->type = CellType::kBlock;
+    cell->bits = 0;
   }
   y /= 2;
 
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value ^= 1U << bit;
-  cell.content.character = g_map_block[value];
+  cell->bits ^= 1U << bit;
 }
 
 /// @brief Draw a line made of block characters.
@@ -551,6 +638,7 @@ void Canvas::DrawBlockLine(int x1,
                            int x2,
                            int y2,
                            const Stylizer& style) {
+  StyleMemo memo;
   y1 /= 2;
   y2 /= 2;
 
@@ -569,7 +657,7 @@ void Canvas::DrawBlockLine(int x1,
 
   int error = dx - dy;
   for (int i = 0; i < length; ++i) {
-    DrawBlock(x1, y1 * 2, true, style);
+    DrawBlock(x1, y1 * 2, true, style, &memo);
     if (2 * error >= -dy) {
       error -= dy;
       x1 += sx;
@@ -579,7 +667,7 @@ void Canvas::DrawBlockLine(int x1,
       y1 += sy;
     }
   }
-  DrawBlock(x2, y2 * 2, true, style);
+  DrawBlock(x2, y2 * 2, true, style, &memo);
 }
 
 /// @brief Draw a circle made of block characters.
@@ -677,6 +765,7 @@ void Canvas::DrawBlockEllipse(int x1,
                               int r1,
                               int r2,
                               const Stylizer& s) {
+  StyleMemo memo;
   y1 /= 2;
   r2 /= 2;
   int x = -r1;
@@ -687,10 +776,10 @@ void Canvas::DrawBlockEllipse(int x1,
   int err = dx + dy;
 
   do {
-    DrawBlock(x1 - x, 2 * (y1 + y), true, s);
-    DrawBlock(x1 + x, 2 * (y1 + y), true, s);
-    DrawBlock(x1 + x, 2 * (y1 - y), true, s);
-    DrawBlock(x1 - x, 2 * (y1 - y), true, s);
+    DrawBlock(x1 - x, 2 * (y1 + y), true, s, &memo);
+    DrawBlock(x1 + x, 2 * (y1 + y), true, s, &memo);
+    DrawBlock(x1 + x, 2 * (y1 - y), true, s, &memo);
+    DrawBlock(x1 - x, 2 * (y1 - y), true, s, &memo);
     e2 = 2 * err;
     if (e2 >= dx) {
       x++;
@@ -703,8 +792,8 @@ void Canvas::DrawBlockEllipse(int x1,
   } while (x <= 0);
 
   while (y++ < r2) {
-    DrawBlock(x1, 2 * (y1 + y), true, s);
-    DrawBlock(x1, 2 * (y1 - y), true, s);
+    DrawBlock(x1, 2 * (y1 + y), true, s, &memo);
+    DrawBlock(x1, 2 * (y1 - y), true, s, &memo);
   }
 }
 
@@ -743,6 +832,7 @@ void Canvas::DrawBlockEllipseFilled(int x1,
                                     int r1,
                                     int r2,
                                     const Stylizer& s) {
+  StyleMemo memo;
   y1 /= 2;
   r2 /= 2;
   int x = -r1;
@@ -754,8 +844,8 @@ void Canvas::DrawBlockEllipseFilled(int x1,
 
   do {
     for (int xx = x1 + x; xx <= x1 - x; ++xx) {
-      DrawBlock(xx, 2 * (y1 + y), true, s);
-      DrawBlock(xx, 2 * (y1 - y), true, s);
+      DrawBlock(xx, 2 * (y1 + y), true, s, &memo);
+      DrawBlock(xx, 2 * (y1 - y), true, s, &memo);
     }
     e2 = 2 * err;
     if (e2 >= dx) {
@@ -770,11 +860,34 @@ void Canvas::DrawBlockEllipseFilled(int x1,
 
   while (y++ < r2) {
     for (int yy = y1 + y; yy <= y1 - y; ++yy) {
-      DrawBlock(x1, 2 * yy, true, s);
+      DrawBlock(x1, 2 * yy, true, s, &memo);
     }
   }
 }
 
+/// @brief Draw a line made of block characters, joining consecutive points.
+/// @param points the points. y is considered to be a multiple of 2.
+void Canvas::DrawBlockPolyline(const std::vector<Point>& points) {
+  DrawPointsOn(points, CellType::kBlock, true, nullptr);
+}
+
+/// @brief Draw a line made of block characters, joining consecutive points.
+/// @param points the points. y is considered to be a multiple of 2.
+/// @param style the style of the line.
+void Canvas::DrawBlockPolyline(const std::vector<Point>& points,
+                               const Stylizer& style) {
+  DrawPointsOn(points, CellType::kBlock, true, &style);
+}
+
+/// @brief Draw a line made of block characters, joining consecutive points.
+/// @param points the points. y is considered to be a multiple of 2.
+/// @param color the color of the line.
+void Canvas::DrawBlockPolyline(const std::vector<Point>& points,
+                               const Color& color) {
+  const Stylizer style = [color](Pixel& p) { p.foreground_color = color; };
+  DrawPointsOn(points, CellType::kBlock, true, &style);
+}
+
 /// @brief Draw a piece of text.
 /// @param x the x coordinate of the text.
 /// @param y the y coordinate of the text.
@@ -804,25 +917,420 @@ void Canvas::DrawText(int x,
                       int y,
                       const std::string& value,
                       const Stylizer& style) {
-  for (const auto& it : Utf8ToGlyphs(value)) {
+  for (const std::string_view it : Utf8Glyphs(value)) {
     if (!IsIn(x, y)) {
       x += 2;
       continue;
     }
-    Cell& cell = storage_[XY{x / 2, y / 4}];
-    cell.type = CellType::kText;
-    cell.content.character = it;
-    style(cell.content);
+    Cell* cell = CellAt(x, y);
+    Pixel pixel = styles_[cell->style];
+    pixel.character = it;
+    style(pixel);
+    cell->type = CellType::kText;
+    SetStyle(cell, pixel);
     x += 2;
   }
 }
 
+/// @brief Draw an RGB image. Every cell displays two pixels stacked, as the
+/// foreground and the background colors of "▀". The pixel (i, j) covers the
+/// dots (x + 2 * i, y + 2 * j) to (x + 2 * i + 1, y + 2 * j + 1).
+///
+/// The whole image is converted in one pass, without a Stylizer per pixel.
+/// @param x the x coordinate of the image. A multiple of 2.
+/// @param y the y coordinate of the image. A multiple of 4.
+/// @param rgb the pixels, as 3 bytes each: red, green and blue.
+/// @param width the number of pixels of a row.
+/// @param height the number of rows.
+/// @param stride the number of bytes from a row to the next one.
+void Canvas::DrawImage(int x,
+                       int y,
+                       const uint8_t* rgb,
+                       int width,
+                       int height,
+                       int stride) {
+  auto color = [&](int i, int j) {
+    const uint8_t* p = rgb + size_t(j) * size_t(stride) + size_t(i) * 3;
+    return Color::RGB(p[0], p[1], p[2]);  // NOLINT
+  };
+  for (int j = 0; j < height; j += 2) {
+    const int cell_y = y + 2 * j;
+    if (cell_y < 0 || cell_y >= height_) {
+      continue;
+    }
+    for (int i = 0; i < width; ++i) {
+      const int cell_x = x + 2 * i;
+      if (cell_x < 0 || cell_x >= width_) {
+        continue;
+      }
+      Cell* cell = CellAt(cell_x, cell_y);
+      Pixel pixel = styles_[cell->style];
+      pixel.character = "▀";
+      pixel.foreground_color = color(i, j);
+      // An odd last row leaves the bottom half as it was.
+      if (j + 1 < height) {
+        pixel.background_color = color(i, j + 1);
+      }
+      cell->type = CellType::kText;
+      SetStyle(cell, pixel);
+    }
+  }
+}
+
 /// @brief Modify a pixel at a given location.
 /// @param style a function that modifies the pixel.
 void Canvas::Style(int x, int y, const Stylizer& style) {
-  if (IsIn(x, y)) {
-    style(storage_[XY{x / 2, y / 4}].content);
+  if (!IsIn(x, y)) {
+    return;
+  }
+  Cell* cell = CellAt(x, y);
+  Pixel pixel = styles_[cell->style];
+  style(pixel);
+  SetStyle(cell, pixel);
+}
+
+/// @brief Modify the cells of a rectangle. The cells sharing a style share the
+/// result: the Stylizer runs once per distinct style, instead of once per cell.
+/// @param x the x coordinate of the rectangle.
+/// @param y the y coordinate of the rectangle.
+/// @param width the width of the rectangle.
+/// @param height the height of the rectangle.
+/// @param style a function that modifies the pixels.
+void Canvas::Style(int x,
+                   int y,
+                   int width,
+                   int height,
+                   const Stylizer& style) {
+  const int x_min = std::max(x, 0);
+  const int y_min = std::max(y, 0);
+  const int x_max = std::min(x + width, width_);
+  const int y_max = std::min(y + height, height_);
+  StyleMemo memo;
+  for (int cy = y_min / 4; cy * 4 < y_max; ++cy) {
+    for (int cx = x_min / 2; cx * 2 < x_max; ++cx) {
+      Style(&cells_[size_t(cy) * size_t(cells_x_) + size_t(cx)], style, &memo);
+    }
+  }
+}
+
+/// @brief Erase everything.
+void Canvas::Clear() {
+  std::fill(cells_.begin(), cells_.end(), Cell());
+  styles_.resize(1);
+  ++styles_epoch_;
+}
+
+/// @brief Erase a rectangle. The cells partially covered only lose their dots
+/// or blocks inside the rectangle. The text they contain is erased.
+/// @param x the x coordinate of the rectangle.
+/// @param y the y coordinate of the rectangle.
+/// @param width the width of the rectangle.
+/// @param height the height of the rectangle.
+void Canvas::Clear(int x, int y, int width, int height) {
+  const int x_min = std::max(x, 0);
+  const int y_min = std::max(y, 0);
+  const int x_max = std::min(x + width, width_);
+  const int y_max = std::min(y + height, height_);
+  if (x_min >= x_max || y_min >= y_max) {
+    return;
+  }
+
+  for (int cy = y_min / 4; cy * 4 < y_max; ++cy) {
+    for (int cx = x_min / 2; cx * 2 < x_max; ++cx) {
+      Cell& cell = cells_[size_t(cy) * size_t(cells_x_) + size_t(cx)];
+      const bool covered =
+          cx * 2 >= x_min && std::min(cx * 2 + 2, width_) <= x_max &&
+          cy * 4 >= y_min && std::min(cy * 4 + 4, height_) <= y_max;
+      if (covered || cell.type == CellType::kText) {
+        cell = Cell();
+        continue;
+      }
+      for (int dy = std::max(y_min, cy * 4); dy < std::min(y_max, cy * 4 + 4);
+           ++dy) {
+        for (int dx = std::max(x_min, cx * 2);
+             dx < std::min(x_max, cx * 2 + 2); ++dx) {
+          if (cell.type == CellType::kBraille) {
+            cell.bits &= ~g_map_braille[dx % 2][dy % 4];  // NOLINT
+          } else {
+            cell.bits &= ~(1U << ((dx % 2) * 2 + (dy / 2) % 2));
+          }
+        }
+      }
+    }
+  }
+}
+
+/// @brief Move the content of the canvas. The area uncovered is cleared.
+/// @param dx the horizontal offset. It is rounded to a multiple of 2.
+/// @param dy the vertical offset. It is rounded to a multiple of 4.
+void Canvas::Scroll(int dx, int dy) {
+  const int cx = dx / 2;
+  const int cy = dy / 4;
+  if (cx == 0 && cy == 0) {
+    return;
+  }
+
+  // Walk away from the direction of the move, so that every cell is read
+  // before being overwritten.
+  for (int i = 0; i < cells_y_; ++i) {
+    const int y = cy > 0 ? cells_y_ - 1 - i : i;
+    for (int j = 0; j < cells_x_; ++j) {
+      const int x = cx > 0 ? cells_x_ - 1 - j : j;
+      const int from_x = x - cx;
+      const int from_y = y - cy;
+      Cell& cell = cells_[size_t(y) * size_t(cells_x_) + size_t(x)];
+      if (from_x < 0 || from_x >= cells_x_ || from_y < 0 ||
+          from_y >= cells_y_) {
+        cell = Cell();
+      } else {
+        cell = cells_[size_t(from_y) * size_t(cells_x_) + size_t(from_x)];
+      }
+    }
+  }
+}
+
+// Make |cell| reference |pixel|, reusing an existing style when possible.
+void Canvas::SetStyle(Cell* cell, const Pixel& pixel) {
+  if (SameStyle(styles_[cell->style], pixel)) {
+    return;
+  }
+
+  // Consecutive draws usually share their style.
+  const size_t lookup = std::min(styles_.size(), kStyleLookup);
+  for (size_t i = styles_.size() - lookup; i < styles_.size(); ++i) {
+    if (SameStyle(styles_[i], pixel)) {
+      cell->style = uint32_t(i);
+      return;
+    }
+  }
+  if (SameStyle(styles_[0], pixel)) {
+    cell->style = 0;
+    return;
+  }
+
+  if (styles_.size() > 2 * cells_.size() + kStyleLookup) {
+    CompactStyles();
+  }
+  cell->style = uint32_t(styles_.size());
+  styles_.push_back(pixel);
+}
+
+// Apply |style| to |cell|. Cells sharing the same style share the result, so
+// the Stylizer runs once per distinct style instead of once per cell. A cell
+// already holding the last result is left as is.
+void Canvas::Style(Cell* cell, const Stylizer& style, StyleMemo* memo) {
+  if (memo->epoch != styles_epoch_) {
+    *memo = StyleMemo();
+    memo->epoch = styles_epoch_;
+  }
+  const uint32_t from = cell->style;
+  if (from + 1 == memo->last) {
+    return;
+  }
+  const size_t slot = from % StyleMemo::kSize;
+  if (memo->from[slot] == from + 1) {
+    cell->style = memo->to[slot] - 1;
+    return;
+  }
+
+  Pixel pixel = styles_[from];
+  style(pixel);
+  SetStyle(cell, pixel);
+  if (memo->epoch != styles_epoch_) {
+    // The styles were renumbered by CompactStyles().
+    *memo = StyleMemo();
+    memo->epoch = styles_epoch_;
+  } else {
+    memo->from[slot] = from + 1;
+    memo->to[slot] = cell->style + 1;
+  }
+  memo->last = cell->style + 1;
+}
+
+// Draw a dot of a shape. The dots of a shape share |memo|, so that the
+// Stylizer runs once per distinct style it covers.
+void Canvas::DrawPoint(int x,
+                       int y,
+                       bool value,
+                       const Stylizer& style,
+                       StyleMemo* memo) {
+  if (!IsIn(x, y)) {
+    return;
+  }
+  Style(CellAt(x, y), style, memo);
+  if (value) {
+    DrawPointOn(x, y);
+  } else {
+    DrawPointOff(x, y);
+  }
+}
+
+// Draw a block of a shape. See DrawPoint().
+void Canvas::DrawBlock(int x,
+                       int y,
+                       bool value,
+                       const Stylizer& style,
+                       StyleMemo* memo) {
+  if (!IsIn(x, y)) {
+    return;
+  }
+  Style(CellAt(x, y), style, memo);
+  if (value) {
+    DrawBlockOn(x, y);
+  } else {
+    DrawBlockOff(x, y);
+  }
+}
+
+// Draw the dots, or the blocks, at |points|. When |connected|, consecutive
+// points are joined by lines.
+//
+// Many scattered points are drawn concurrently: every thread draws the points
+// falling into its own band of cell rows, so no cell is shared. The cells
+// touched are styled afterward, once each.
+void Canvas::DrawPointsOn(const std::vector<Point>& points,
+                          CellType type,
+                          bool connected,
+                          const Stylizer* style) {
+  StyleMemo memo;
+  auto restyle = [&](Cell* cell) {
+    if (style && cell->style + 1 != memo.last) {
+      Style(cell, *style, &memo);
+    }
+  };
+
+  // The grid the points are drawn on. Blocks are drawn on a grid of half the
+  // height.
+  const int y_scale = type == CellType::kBlock ? 2 : 1;
+  const int rows = type == CellType::kBlock ? (height_ + 1) / 2 : height_;
+
+  // Set the bits of the dot at (x, y) of the grid. Return its cell.
+  auto plot = [&](int x, int y) {
+    if (type == CellType::kBlock) {
+      Cell* cell = CellAt(x, 2 * y);
+      if (cell->type != CellType::kBlock) {
+        cell->type = CellType::kBlock;
+        cell->bits = 0;
+      }
+      cell->bits |= uint8_t(1U << ((unsigned(x) % 2) * 2 + unsigned(y) % 2));
+      return cell;
+    }
+    Cell* cell = CellAt(x, y);
+    if (cell->type != CellType::kBraille) {
+      cell->type = CellType::kBraille;
+      cell->bits = 0;
+    }
+    cell->bits |= g_map_braille[unsigned(x) % 2][unsigned(y) % 4];  // NOLINT
+    return cell;
+  };
+
+  auto clipped_plot = [&](int x, int y) {
+    if (x >= 0 && x < width_ && y >= 0 && y < rows) {
+      restyle(plot(x, y));
+    }
+  };
+
+  if (!connected) {
+    // Below this, the threads cost more than they save.
+    const size_t min_parallel_points = 1 << 15;
+    const int bands = std::min(thread_pool::Concurrency(), cells_y_);
+    if (points.size() < min_parallel_points || bands <= 1) {
+      for (const Point& point : points) {
+        clipped_plot(point.x, point.y / y_scale);
+      }
+      return;
+    }
+
+    std::vector<uint8_t> touched(style ? cells_.size() : 0);
+    thread_pool::Run(bands, [&](int band) {
+      const int cell_y_min = cells_y_ * band / bands;
+      const int cell_y_max = cells_y_ * (band + 1) / bands;
+      for (const Point& point : points) {
+        const int x = point.x;
+        const int y = point.y / y_scale;
+        const int cell_y = y * y_scale / 4;
+        if (x < 0 || x >= width_ || y < 0 || y >= rows ||
+            cell_y < cell_y_min || cell_y >= cell_y_max) {
+          continue;
+        }
+        Cell* cell = plot(x, y);
+        if (style) {
+          touched[size_t(cell - cells_.data())] = 1;
+        }
+      }
+    });
+    for (size_t i = 0; i < touched.size(); ++i) {
+      if (touched[i]) {
+        restyle(&cells_[i]);
+      }
+    }
+    return;
+  }
+
+  for (size_t i = 1; i < points.size(); ++i) {
+    int x1 = points[i - 1].x;
+    int y1 = points[i - 1].y / y_scale;
+    const int x2 = points[i].x;
+    const int y2 = points[i].y / y_scale;
+
+    // Skip the segments entirely outside of the canvas.
+    if (std::max(x1, x2) < 0 || std::min(x1, x2) >= width_ ||
+        std::max(y1, y2) < 0 || std::min(y1, y2) >= rows) {
+      continue;
+    }
+
+    // Same dots as DrawPointLine(), but the major axis always advances,
+    // leaving a single branch per dot. The last point of the segment is
+    // drawn by the next one.
+    const int dx = std::abs(x2 - x1);
+    const int dy = std::abs(y2 - y1);
+    const int sx = x1 < x2 ? 1 : -1;
+    const int sy = y1 < y2 ? 1 : -1;
+    int error = dx - dy;
+    if (dy >= dx) {
+      for (int j = 0; j < dy; ++j) {
+        clipped_plot(x1, y1);
+        if (2 * error >= -dy) {
+          error -= dy;
+          x1 += sx;
+        }
+        error += dx;
+        y1 += sy;
+      }
+    } else {
+      for (int j = 0; j < dx; ++j) {
+        clipped_plot(x1, y1);
+        error -= dy;
+        x1 += sx;
+        if (2 * error <= dx) {
+          error += dx;
+          y1 += sy;
+        }
+      }
+    }
+  }
+  if (!points.empty()) {
+    clipped_plot(points.back().x, points.back().y / y_scale);
+  }
+}
+
+// Drop the styles no longer referenced by any cell.
+void Canvas::CompactStyles() {
+  constexpr uint32_t kUnused = ~uint32_t(0);
+  std::vector<uint32_t> remap(styles_.size(), kUnused);
+  std::vector<Pixel> styles;
+  remap[0] = 0;
+  styles.push_back(std::move(styles_[0]));
+  for (Cell& cell : cells_) {
+    uint32_t& index = remap[cell.style];
+    if (index == kUnused) {
+      index = uint32_t(styles.size());
+      styles.push_back(std::move(styles_[cell.style]));
+    }
+    cell.style = index;
   }
+  styles_ = std::move(styles);
+  ++styles_epoch_;
 }
 
 namespace {
@@ -833,10 +1341,15 @@ class CanvasNodeBase : public Node {
 
   void Render(Screen& screen) override {
     const Canvas& c = canvas();
-    const int y_max = std::min(c.height() / 4, box_.y_max - box_.y_min + 1);
-    const int x_max = std::min(c.width() / 2, box_.x_max - box_.x_min + 1);
-    for (int y = 0; y < y_max; ++y) {
-      for (int x = 0; x < x_max; ++x) {
+    // Only the cells inside the stencil are converted to characters.
+    const int y_min = std::max(0, screen.stencil.y_min - box_.y_min);
+    const int x_min = std::max(0, screen.stencil.x_min - box_.x_min);
+    const int y_max = std::min({c.height() / 4, box_.y_max - box_.y_min + 1,
+                                screen.stencil.y_max - box_.y_min + 1});
+    const int x_max = std::min({c.width() / 2, box_.x_max - box_.x_min + 1,
+                                screen.stencil.x_max - box_.x_min + 1});
+    for (int y = y_min; y < y_max; ++y) {
+      for (int x = x_min; x < x_max; ++x) {
         screen.PixelAt(box_.x_min + x, box_.y_min + y) = c.GetPixel(x, y);
       }
     }
@@ -859,7 +1372,7 @@ Element canvas(ConstRef<Canvas> canvas) {
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
-  return std::make_shared<Impl>(canvas);
+  return MakeNode<Impl>(canvas);
 }
 
 /// @brief Produce an element drawing a canvas of requested size.
@@ -891,7 +1404,7 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     int height_;
     std::function<void(Canvas&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeNode<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
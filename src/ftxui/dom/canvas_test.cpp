@@ -2,8 +2,11 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>
-#include <cstdint>  // for uint32_t
-#include <string>   // for allocator, string
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <string>     // for allocator, string
+#include <vector>     // for vector
 
 #include "ftxui/dom/canvas.hpp"    // for Canvas
 #include "ftxui/dom/elements.hpp"  // for canvas
@@ -104,5 +107,315 @@ TEST(CanvasTest, GoldText) {
   EXPECT_EQ(Hash(screen.ToString()), 1074960375);
 }
 
+TEST(CanvasTest, GetPixel) {
+  Canvas c(4, 8);
+  c.DrawPointOn(0, 0);
+  c.DrawPointOn(3, 7);
+  c.DrawBlockOn(2, 0);
+  c.DrawText(0, 4, "a", Color::Red);
+  c.Style(2, 4, [](Pixel& p) { p.bold = true; });
+
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⠁");
+  EXPECT_EQ(c.GetPixel(1, 0).character, "▘");
+  EXPECT_EQ(c.GetPixel(0, 1).character, "a");
+  EXPECT_EQ(c.GetPixel(0, 1).foreground_color, Color(Color::Red));
+  EXPECT_EQ(c.GetPixel(1, 1).character, "⢀");
+  EXPECT_TRUE(c.GetPixel(1, 1).bold);
+  EXPECT_EQ(c.GetPixel(2, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(-1, 0).character, " ");
+
+  // Drawing a dot over the text keeps its color.
+  c.DrawPointOn(0, 4);
+  EXPECT_EQ(c.GetPixel(0, 1).character, "⠁");
+  EXPECT_EQ(c.GetPixel(0, 1).foreground_color, Color(Color::Red));
+}
+
+TEST(CanvasTest, BrailleGlyphs) {
+  // The dot of every bit of the offset from U+2800.
+  const int dot_x[8] = {0, 0, 0, 1, 1, 1, 0, 1};
+  const int dot_y[8] = {0, 1, 2, 0, 1, 2, 3, 3};
+  Canvas c(2 * 256, 4);
+  for (int mask = 0; mask < 256; ++mask) {
+    for (int bit = 0; bit < 8; ++bit) {
+      if (mask & (1 << bit)) {
+        c.DrawPointOn(2 * mask + dot_x[bit], dot_y[bit]);
+      }
+    }
+  }
+  // The cell without any dot was never drawn.
+  for (int mask = 1; mask < 256; ++mask) {
+    const std::string expected = {
+        char(0xE2),
+        char(0xA0 | (mask >> 6)),
+        char(0x80 | (mask & 0x3F)),
+    };
+    EXPECT_EQ(c.GetPixel(mask, 0).character, expected) << mask;
+  }
+}
+
+TEST(CanvasTest, DrawImage) {
+  // 2x3 pixels, with a padding byte at the end of every row.
+  const uint8_t rgb[] = {
+      1, 2, 3, 4, 5, 6, 0,  //
+      7, 8, 9, 1, 1, 1, 0,  //
+      2, 2, 2, 3, 3, 3, 0,  //
+  };
+  Canvas c(4, 8);
+  c.DrawImage(0, 0, rgb, 2, 3, 7);
+
+  const Pixel top_left = c.GetPixel(0, 0);
+  EXPECT_EQ(top_left.character, "▀");
+  EXPECT_EQ(top_left.foreground_color, Color::RGB(1, 2, 3));
+  EXPECT_EQ(top_left.background_color, Color::RGB(7, 8, 9));
+  EXPECT_EQ(c.GetPixel(1, 0).foreground_color, Color::RGB(4, 5, 6));
+  EXPECT_EQ(c.GetPixel(1, 0).background_color, Color::RGB(1, 1, 1));
+
+  // The last row is odd: the bottom halves are left as they were.
+  const Pixel bottom_left = c.GetPixel(0, 1);
+  EXPECT_EQ(bottom_left.character, "▀");
+  EXPECT_EQ(bottom_left.foreground_color, Color::RGB(2, 2, 2));
+  EXPECT_EQ(bottom_left.background_color, Color());
+
+  // The pixels outside of the canvas are skipped.
+  c.DrawImage(2, 4, rgb, 2, 3, 7);
+  EXPECT_EQ(c.GetPixel(1, 1).foreground_color, Color::RGB(1, 2, 3));
+}
+
+TEST(CanvasTest, DrawPointScatterParallel) {
+  // Enough points to be drawn on several threads, some outside the canvas.
+  std::vector<Canvas::Point> points;
+  for (size_t i = 0; i < 100000; ++i) {
+    points.push_back({int((i * 7919) % 130) - 5, int((i * 104729) % 90) - 5});
+  }
+  Canvas parallel(120, 80);
+  parallel.DrawPointScatter(points, Color::Red);
+  Canvas unstyled(120, 80);
+  unstyled.DrawPointScatter(points);
+
+  // The same as drawing the points one by one.
+  Canvas sequential(120, 80);
+  Canvas sequential_unstyled(120, 80);
+  for (const Canvas::Point& point : points) {
+    sequential.DrawPoint(point.x, point.y, true, Color::Red);
+    sequential_unstyled.DrawPointOn(point.x, point.y);
+  }
+  for (int y = 0; y < 20; ++y) {
+    for (int x = 0; x < 60; ++x) {
+      EXPECT_EQ(parallel.GetPixel(x, y).character,
+                sequential.GetPixel(x, y).character);
+      EXPECT_EQ(parallel.GetPixel(x, y).foreground_color,
+                sequential.GetPixel(x, y).foreground_color);
+      EXPECT_EQ(unstyled.GetPixel(x, y).character,
+                sequential_unstyled.GetPixel(x, y).character);
+    }
+  }
+}
+
+TEST(CanvasTest, ManyStyles) {
+  Canvas c(20, 20);
+  for (int round = 0; round < 50; ++round) {
+    for (int y = 0; y < 20; ++y) {
+      for (int x = 0; x < 20; ++x) {
+        c.DrawPoint(x, y, true, Color::RGB(round, x / 2, y / 4));
+      }
+    }
+  }
+  for (int y = 0; y < 5; ++y) {
+    for (int x = 0; x < 10; ++x) {
+      const Pixel p = c.GetPixel(x, y);
+      EXPECT_EQ(p.character, "⣿");
+      EXPECT_EQ(p.foreground_color, Color::RGB(49, x, y));
+    }
+  }
+}
+
+namespace {
+std::string Dump(const Canvas& c) {
+  std::string out;
+  for (int y = 0; y < (c.height() + 3) / 4; ++y) {
+    for (int x = 0; x < (c.width() + 1) / 2; ++x) {
+      const Pixel p = c.GetPixel(x, y);
+      out += p.character;
+      out += p.foreground_color.Print(false);
+    }
+    out += "\n";
+  }
+  return out;
+}
+
+std::vector<Canvas::Point> Zigzag() {
+  std::vector<Canvas::Point> points;
+  for (int i = 0; i < 40; ++i) {
+    points.push_back({i * 3, (i * 37) % 40});
+  }
+  return points;
+}
+}  // namespace
+
+TEST(CanvasTest, DrawPointPolyline) {
+  const std::vector<Canvas::Point> points = Zigzag();
+  Canvas expected(100, 40);
+  for (size_t i = 1; i < points.size(); ++i) {
+    expected.DrawPointLine(points[i - 1].x, points[i - 1].y, points[i].x,
+                           points[i].y, Color::Red);
+  }
+  Canvas c(100, 40);
+  c.DrawPointPolyline(points, Color::Red);
+  EXPECT_EQ(Dump(c), Dump(expected));
+}
+
+TEST(CanvasTest, DrawPointPolylineClipped) {
+  Canvas c(10, 8);
+  c.DrawPointPolyline({{-100, -100}, {-50, 100}, {-5, 2}, {4, 2}, {100, 2}});
+  Canvas expected(10, 8);
+  for (int x = 0; x < 10; ++x) {
+    expected.DrawPointOn(x, 2);
+  }
+  EXPECT_EQ(Dump(c), Dump(expected));
+
+  // Nothing to draw.
+  c.DrawPointPolyline({});
+  c.DrawPointPolyline({{-1, -1}});
+  EXPECT_EQ(Dump(c), Dump(expected));
+}
+
+TEST(CanvasTest, DrawPointScatter) {
+  const std::vector<Canvas::Point> points = Zigzag();
+  Canvas expected(100, 40);
+  for (const auto& point : points) {
+    expected.DrawPoint(point.x, point.y, true, Color::Blue);
+  }
+  Canvas c(100, 40);
+  c.DrawPointScatter(points, Color::Blue);
+  EXPECT_EQ(Dump(c), Dump(expected));
+}
+
+TEST(CanvasTest, DrawBlockPolyline) {
+  const std::vector<Canvas::Point> points = Zigzag();
+  Canvas expected(100, 40);
+  for (size_t i = 1; i < points.size(); ++i) {
+    expected.DrawBlockLine(points[i - 1].x, points[i - 1].y, points[i].x,
+                           points[i].y, Color::Green);
+  }
+  Canvas c(100, 40);
+  c.DrawBlockPolyline(points, Color::Green);
+  EXPECT_EQ(Dump(c), Dump(expected));
+}
+
+TEST(CanvasTest, DrawPointPolylineStyleOncePerStyle) {
+  Canvas c(100, 40);
+  int calls = 0;
+  c.DrawPointPolyline(Zigzag(), [&](Pixel& p) {
+    ++calls;
+    p.bold = true;
+  });
+  EXPECT_EQ(calls, 1);
+  EXPECT_TRUE(c.GetPixel(0, 0).bold);
+}
+
+TEST(CanvasTest, DrawShapeStyleOncePerStyle) {
+  Canvas c(100, 40);
+  int calls = 0;
+  auto bold = [&](Pixel& p) {
+    ++calls;
+    p.bold = true;
+  };
+  c.DrawPointLine(0, 0, 99, 39, bold);
+  c.DrawBlockEllipseFilled(50, 10, 20, 8, bold);
+  EXPECT_EQ(calls, 2);
+  EXPECT_TRUE(c.GetPixel(0, 0).bold);
+  EXPECT_TRUE(c.GetPixel(25, 5).bold);
+}
+
+TEST(CanvasTest, StyleRectangle) {
+  Canvas c(20, 20);
+  c.DrawText(0, 0, "ab", Color::Red);
+  int calls = 0;
+  c.Style(2, 0, 20, 8, [&](Pixel& p) {
+    ++calls;
+    p.underlined = true;
+  });
+  // Once for the text, once for the empty cells.
+  EXPECT_EQ(calls, 2);
+  EXPECT_FALSE(c.GetPixel(0, 0).underlined);
+  EXPECT_TRUE(c.GetPixel(1, 0).underlined);
+  EXPECT_TRUE(c.GetPixel(9, 1).underlined);
+  EXPECT_FALSE(c.GetPixel(9, 2).underlined);
+}
+
+TEST(CanvasTest, Clear) {
+  Canvas c(8, 8);
+  c.DrawPointPolyline({{0, 0}, {7, 7}}, Color::Red);
+  c.DrawText(4, 4, "a");
+  c.Clear();
+
+  const Canvas empty(8, 8);
+  EXPECT_EQ(Dump(c), Dump(empty));
+}
+
+TEST(CanvasTest, ClearRegion) {
+  Canvas c(8, 8);
+  for (int y = 0; y < 8; ++y) {
+    for (int x = 0; x < 8; ++x) {
+      c.DrawPoint(x, y, true, Color::Red);
+    }
+  }
+  c.DrawText(6, 4, "a");
+  c.Clear(1, 1, 4, 5);
+
+  Canvas expected(8, 8);
+  for (int y = 0; y < 8; ++y) {
+    for (int x = 0; x < 8; ++x) {
+      if (x < 1 || x >= 5 || y < 1 || y >= 6) {
+        expected.DrawPoint(x, y, true, Color::Red);
+      }
+    }
+  }
+  expected.DrawText(6, 4, "a");
+  EXPECT_EQ(Dump(c), Dump(expected));
+
+  // The text touched by the region is erased.
+  EXPECT_EQ(c.GetPixel(3, 1).character, "a");
+  c.Clear(7, 7, 100, 100);
+  EXPECT_EQ(c.GetPixel(3, 1).character, " ");
+}
+
+TEST(CanvasTest, Scroll) {
+  const std::vector<Canvas::Point> points = Zigzag();
+  Canvas c(100, 40);
+  c.DrawPointPolyline(points, Color::Red);
+  c.DrawText(50, 20, "text");
+  c.Scroll(-10, 4);
+
+  Canvas expected(100, 40);
+  std::vector<Canvas::Point> moved;
+  for (const auto& point : points) {
+    moved.push_back({point.x - 10, point.y + 4});
+  }
+  expected.DrawPointPolyline(moved, Color::Red);
+  expected.DrawText(40, 24, "text");
+  expected.Clear(90, 0, 10, 40);
+  EXPECT_EQ(Dump(c), Dump(expected));
+}
+
+TEST(CanvasTest, ScrollingChart) {
+  // Appending samples to a scrolling canvas draws the same as redrawing the
+  // whole chart.
+  auto sample = [](int i) { return (i * 7) % 16; };
+  Canvas c(20, 16);
+  for (int i = 1; i < 50; ++i) {
+    c.Scroll(-2, 0);
+    c.DrawPointPolyline({{17, sample(i - 1)}, {19, sample(i)}});
+
+    Canvas expected(20, 16);
+    std::vector<Canvas::Point> points;
+    for (int j = std::max(0, i - 10); j <= i; ++j) {
+      points.push_back({19 - 2 * (i - j), sample(j)});
+    }
+    expected.DrawPointPolyline(points);
+    EXPECT_EQ(Dump(c), Dump(expected)) << i;
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
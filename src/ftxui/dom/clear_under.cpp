@@ -1,11 +1,12 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, clear_under
 #include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
 #include "ftxui/screen/screen.hpp"       // for Pixel, Screen
@@ -27,6 +28,8 @@ class ClearUnder : public NodeDecorator {
     }
     Node::Render(screen);
   }
+
+  Box OpaqueBox() const override { return box_; }
 };
 }  // namespace
 
@@ -35,7 +38,7 @@ class ClearUnder : public NodeDecorator {
 /// @see ftxui::dbox
 /// @ingroup dom
 Element clear_under(Element element) {
-  return std::make_shared<ClearUnder>(std::move(element));
+  return MakeNode<ClearUnder>(std::move(element));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,267 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>    // for max, min
+#include <charconv>     // for to_chars
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t
+#include <cstdio>       // for snprintf
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/dom/elements.hpp"     // for Element
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::SELECTED
+#include "ftxui/dom/table.hpp"        // for DataColumn, dataTable
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for string_width, Utf8Glyphs
+
+namespace ftxui {
+
+/// @brief A column of integers.
+/// @param header The text of the first row.
+/// @param values The values. They must outlive the element.
+/// @ingroup dom
+DataColumn::DataColumn(std::string header, const std::vector<int64_t>& values)
+    : header_(std::move(header)), ints_(&values), align_(Right) {}
+
+/// @brief A column of decimal numbers.
+/// @param header The text of the first row.
+/// @param values The values. They must outlive the element.
+/// @param precision The number of digits after the decimal point.
+/// @ingroup dom
+DataColumn::DataColumn(std::string header,
+                       const std::vector<double>& values,
+                       int precision)
+    : header_(std::move(header)),
+      doubles_(&values),
+      precision_(precision),
+      align_(Right) {}
+
+/// @brief A column of texts.
+/// @param header The text of the first row.
+/// @param values The values. They, and the texts they view, must outlive the
+/// element.
+/// @ingroup dom
+DataColumn::DataColumn(std::string header,
+                       const std::vector<std::string_view>& values)
+    : header_(std::move(header)), strings_(&values) {}
+
+/// @brief A column of |size| rows, whose cells are written by |formatter|.
+/// @param header The text of the first row.
+/// @param size The number of rows.
+/// @param formatter Append the text of a row to its output.
+/// @ingroup dom
+DataColumn::DataColumn(std::string header, size_t size, Formatter formatter)
+    : header_(std::move(header)), size_(size), formatter_(std::move(formatter)) {}
+
+/// @brief Set the alignment of the cells, and of the header.
+/// @ingroup dom
+DataColumn& DataColumn::SetAlign(Align align) {
+  align_ = align;
+  return *this;
+}
+
+/// @brief Set the width of the column. A width of 0 or less is computed from
+/// the header, and a sample of up to 64 rows, evenly spread.
+/// @ingroup dom
+DataColumn& DataColumn::SetWidth(int width) {
+  width_ = width;
+  return *this;
+}
+
+/// @brief Replace the default formatting of the values.
+/// @ingroup dom
+DataColumn& DataColumn::SetFormatter(Formatter formatter) {
+  formatter_ = std::move(formatter);
+  return *this;
+}
+
+/// @brief The number of rows of the column.
+/// @ingroup dom
+size_t DataColumn::size() const {
+  if (ints_) {
+    return ints_->size();
+  }
+  if (doubles_) {
+    return doubles_->size();
+  }
+  if (strings_) {
+    return strings_->size();
+  }
+  return size_;
+}
+
+/// @brief Append the text of the cell at |row| to |output|, without
+/// intermediate allocations.
+/// @ingroup dom
+void DataColumn::Format(size_t row, std::string& output) const {
+  if (formatter_) {
+    formatter_(row, output);
+    return;
+  }
+  char buffer[64];  // NOLINT
+  if (ints_) {
+    const auto result =
+        std::to_chars(buffer, buffer + sizeof(buffer), (*ints_)[row]);
+    output.append(buffer, result.ptr);
+    return;
+  }
+  if (doubles_) {
+    const int size = std::snprintf(buffer, sizeof(buffer), "%.*f", precision_,
+                                   (*doubles_)[row]);
+    output.append(buffer, size_t(std::clamp(size, 0, int(sizeof(buffer)) - 1)));
+    return;
+  }
+  if (strings_) {
+    output += (*strings_)[row];
+  }
+}
+
+// The table. The header is drawn on the first row, above a separator. The
+// columns are separated by a vertical line.
+class DataTable : public Node {
+ public:
+  DataTable(std::vector<DataColumn> columns, int selected)
+      : columns_(std::move(columns)), selected_(selected) {
+    for (const DataColumn& column : columns_) {
+      rows_ = std::max(rows_, column.size());
+    }
+    widths_.reserve(columns_.size());
+    for (const DataColumn& column : columns_) {
+      widths_.push_back(Width(column));
+    }
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = std::max(0, int(columns_.size()) - 1);
+    for (const int width : widths_) {
+      requirement_.min_x += width;
+    }
+    requirement_.min_y = 2 + int(rows_);
+    if (selected_ >= 0 && size_t(selected_) < rows_) {
+      requirement_.selection = Requirement::SELECTED;
+      requirement_.selected_box = {0, requirement_.min_x - 1, 2 + selected_,
+                                   2 + selected_};
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min({box_.y_max, screen.stencil.y_max,
+                                box_.y_min + 1 + int(rows_)});
+    for (int y = y_min; y <= y_max; ++y) {
+      const int line = y - box_.y_min;
+      if (line == 1) {
+        RenderSeparator(screen, y);
+        continue;
+      }
+      int x = box_.x_min;
+      for (size_t i = 0; i < columns_.size(); ++i) {
+        if (i != 0) {
+          Draw(screen, x, y, "│");
+          ++x;
+        }
+        const DataColumn& column = columns_[i];
+        cell_.clear();
+        if (line == 0) {
+          cell_ = column.header_;
+        } else if (size_t(line - 2) < column.size()) {
+          column.Format(size_t(line - 2), cell_);
+        }
+        RenderCell(screen, x, y, widths_[i], column.align_);
+        x += widths_[i];
+      }
+    }
+  }
+
+ private:
+  static int Width(const DataColumn& column) {
+    if (column.width_ > 0) {
+      return column.width_;
+    }
+    int width = string_width(column.header_);
+    std::string cell;
+    const size_t rows = column.size();
+    const size_t samples = std::min<size_t>(rows, 64);  // NOLINT
+    for (size_t i = 0; i < samples; ++i) {
+      cell.clear();
+      column.Format(i * rows / samples, cell);
+      width = std::max(width, string_width(cell));
+    }
+    return width;
+  }
+
+  void Draw(Screen& screen, int x, int y, std::string_view character) const {
+    if (x <= box_.x_max) {
+      screen.PixelAt(x, y).character = character;
+    }
+  }
+
+  void RenderSeparator(Screen& screen, int y) const {
+    int x = box_.x_min;
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      if (i != 0) {
+        Draw(screen, x++, y, "┼");
+      }
+      for (int j = 0; j < widths_[i]; ++j) {
+        Draw(screen, x++, y, "─");
+      }
+    }
+  }
+
+  // Draw |cell_| in the |width| cells starting at |x|.
+  void RenderCell(Screen& screen,
+                  int x,
+                  int y,
+                  int width,
+                  DataColumn::Align align) const {
+    const int x_max = std::min(x + width - 1, box_.x_max);
+    const int cell_width = string_width(cell_);
+    if (align == DataColumn::Right) {
+      x += std::max(0, width - cell_width);
+    } else if (align == DataColumn::Center) {
+      x += std::max(0, width - cell_width) / 2;
+    }
+    for (const std::string_view glyph : Utf8Glyphs(cell_)) {
+      if (x > x_max) {
+        return;
+      }
+      screen.PixelAt(x++, y).character = glyph;
+    }
+  }
+
+  std::vector<DataColumn> columns_;
+  std::vector<int> widths_;
+  size_t rows_ = 0;
+  int selected_;
+  std::string cell_;  // Reused by every cell.
+};
+
+/// @brief A table of typed columns, drawn by a single element. The cells are
+/// formatted while they are drawn, only for the rows visible inside a `frame`.
+/// As opposed to `Table`, there is no element, nor string per cell.
+/// @param columns The columns. Their values must outlive the element.
+/// @param selected The index of the row to scroll to, when inside a `frame`.
+/// @see DataColumn
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<std::string_view> names = {"cpu", "memory"};
+/// std::vector<double> values = {12.5, 73.25};
+/// Element document = dataTable({
+///     DataColumn("name", names),
+///     DataColumn("value", values, 1),
+/// }) | yframe;
+/// ```
+Element dataTable(std::vector<DataColumn> columns, int selected) {
+  return MakeNode<DataTable>(std::move(columns), selected);
+}
+
+}  // namespace ftxui
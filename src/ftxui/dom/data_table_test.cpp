@@ -0,0 +1,113 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <cstdint>      // for int64_t
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/dom/elements.hpp"   // for yframe, size, HEIGHT, EQUAL
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/table.hpp"      // for DataColumn, dataTable
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// The characters drawn by |element|, without their style.
+std::string Draw(Element element, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, element);
+  std::string out;
+  for (int y = 0; y < height; ++y) {
+    if (y) {
+      out += "\n";
+    }
+    for (int x = 0; x < width; ++x) {
+      out += screen.PixelAt(x, y).character;
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(DataTableTest, Basic) {
+  std::vector<std::string_view> names = {"cpu", "memory", "disk"};
+  std::vector<int64_t> counts = {1, -20, 300};
+  std::vector<double> values = {12.5, 73.25, 0};
+  auto element = dataTable({
+      DataColumn("name", names),
+      DataColumn("n", counts),
+      DataColumn("value", values, 1),
+  });
+  EXPECT_EQ(Draw(element, 18, 6),
+            "name  │  n│value  \n"
+            "──────┼───┼─────  \n"
+            "cpu   │  1│ 12.5  \n"
+            "memory│-20│ 73.2  \n"
+            "disk  │300│  0.0  \n"
+            "                  ");
+}
+
+TEST(DataTableTest, AlignAndWidth) {
+  std::vector<std::string_view> names = {"a", "bbbbbb"};
+  auto element = dataTable({
+      DataColumn("left", names).SetWidth(4),
+      DataColumn("center", names).SetAlign(DataColumn::Center),
+      DataColumn("right", names).SetAlign(DataColumn::Right),
+  });
+  EXPECT_EQ(Draw(element, 22, 4),
+            "left│center│ right    \n"
+            "────┼──────┼──────    \n"
+            "a   │  a   │     a    \n"
+            "bbbb│bbbbbb│bbbbbb    ");
+}
+
+TEST(DataTableTest, Formatter) {
+  std::vector<int64_t> bytes = {512, 2048};
+  auto element = dataTable({
+      DataColumn("size", bytes).SetFormatter([&](size_t row, std::string& out) {
+        out += std::to_string(bytes[row] / 1024) + "K";
+      }),
+      DataColumn("row", 3,
+                 [](size_t row, std::string& out) {
+                   out += std::to_string(row);
+                 }),
+  });
+  EXPECT_EQ(Draw(element, 8, 5),
+            "size│row\n"
+            "────┼───\n"
+            "  0K│0  \n"
+            "  2K│1  \n"
+            "    │2  ");
+}
+
+TEST(DataTableTest, OnlyVisibleRowsAreFormatted) {
+  const int rows = 100000;
+  int formatted = 0;
+  auto element = dataTable(
+                     {
+                         DataColumn("row", rows,
+                                    [&](size_t row, std::string& out) {
+                                      formatted++;
+                                      out += std::to_string(row);
+                                    }),
+                     },
+                     50000) |
+                 yframe | size(HEIGHT, EQUAL, 3);
+  // The width is measured from a sample of the rows.
+  EXPECT_EQ(formatted, 64);
+  formatted = 0;
+  EXPECT_EQ(Draw(element, 5, 3),
+            "49999\n"
+            "50000\n"
+            "50001");
+  EXPECT_EQ(formatted, 3);
+}
+
+}  // namespace ftxui
+// NOLINTEND
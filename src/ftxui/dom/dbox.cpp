@@ -2,18 +2,52 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>  // for max
-#include <memory>     // for __shared_ptr_access, shared_ptr, make_shared
+#include <cstddef>    // for size_t
+#include <memory>     // for __shared_ptr_access, shared_ptr
 #include <utility>    // for move
 #include <vector>     // for vector
 
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, dbox
 #include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 
 namespace {
+
+bool IsEmpty(Box box) {
+  return box.x_min > box.x_max || box.y_min > box.y_max;
+}
+
+// The part of |visible| left visible by |opaque|. A stencil is a rectangle:
+// when the rest isn't one, |visible| is kept as is.
+Box Occlude(Box visible, Box opaque) {
+  const Box hidden = Box::Intersection(visible, opaque);
+  if (IsEmpty(hidden)) {
+    return visible;
+  }
+  const bool full_x =
+      hidden.x_min == visible.x_min && hidden.x_max == visible.x_max;
+  const bool full_y =
+      hidden.y_min == visible.y_min && hidden.y_max == visible.y_max;
+  if (full_x && full_y) {
+    return {0, -1, 0, -1};
+  }
+  if (full_x && hidden.y_min == visible.y_min) {
+    visible.y_min = hidden.y_max + 1;
+  } else if (full_x && hidden.y_max == visible.y_max) {
+    visible.y_max = hidden.y_min - 1;
+  } else if (full_y && hidden.x_min == visible.x_min) {
+    visible.x_min = hidden.x_max + 1;
+  } else if (full_y && hidden.x_max == visible.x_max) {
+    visible.x_max = hidden.x_min - 1;
+  }
+  return visible;
+}
+
 class DBox : public Node {
  public:
   explicit DBox(Elements children) : Node(std::move(children)) {}
@@ -27,7 +61,7 @@ class DBox : public Node {
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->UpdateRequirement();
       requirement_.min_x =
           std::max(requirement_.min_x, child->requirement().min_x);
       requirement_.min_y =
@@ -44,9 +78,42 @@ class DBox : public Node {
     Node::SetBox(box);
 
     for (auto& child : children_) {
-      child->SetBox(box);
+      child->UpdateBox(box);
+    }
+  }
+
+  // The layers hidden by the opaque ones above them are skipped. The ones
+  // partially hidden are drawn through a smaller stencil.
+  void Render(Screen& screen) override {
+    const Box stencil = screen.stencil;
+    stencils_.resize(children_.size());
+    Box visible = stencil;
+    bool occluded = false;
+    for (size_t i = children_.size(); i-- > 0;) {
+      stencils_[i] = visible;
+      if (i != 0 && !IsEmpty(visible)) {
+        visible = Occlude(visible, children_[i]->OpaqueBox());
+        occluded |= visible != stencil;
+      }
+    }
+
+    if (!occluded) {
+      Node::Render(screen);
+      return;
     }
+
+    for (size_t i = 0; i < children_.size(); ++i) {
+      if (IsEmpty(stencils_[i])) {
+        continue;
+      }
+      screen.stencil = stencils_[i];
+      children_[i]->Render(screen);
+    }
+    screen.stencil = stencil;
   }
+
+ private:
+  std::vector<Box> stencils_;
 };
 }  // namespace
 
@@ -55,7 +122,7 @@ class DBox : public Node {
 /// @return The right aligned element.
 /// @ingroup dom
 Element dbox(Elements children_) {
-  return std::make_shared<DBox>(std::move(children_));
+  return MakeNode<DBox>(std::move(children_));
 }
 
 }  // namespace ftxui
@@ -2,7 +2,9 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>
+#include <memory>  // for make_shared
 #include <string>  // for allocator
+#include <vector>  // for vector
 
 #include "ftxui/dom/elements.hpp"  // for filler, operator|, text, border, dbox, hbox, vbox, Element
 #include "ftxui/dom/node.hpp"       // for Render
@@ -11,6 +13,25 @@
 // NOLINTBEGIN
 namespace ftxui {
 
+namespace {
+// Fill its box with 'x', and record the stencil it was drawn with.
+class Fill : public Node {
+ public:
+  explicit Fill(std::vector<Box>* stencils) : stencils_(stencils) {}
+  void Render(Screen& screen) override {
+    stencils_->push_back(screen.stencil);
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (int x = box_.x_min; x <= box_.x_max; ++x) {
+        screen.PixelAt(x, y).character = "x";
+      }
+    }
+  }
+
+ private:
+  std::vector<Box>* stencils_;
+};
+}  // namespace
+
 TEST(DBoxTest, Basic) {
   auto root = dbox({
       hbox({
@@ -32,5 +53,39 @@ TEST(DBoxTest, Basic) {
             "╰────╯  ");
 }
 
+TEST(DBoxTest, Occluded) {
+  std::vector<Box> stencils;
+  auto bottom = std::make_shared<Fill>(&stencils);
+  Screen screen(3, 2);
+  Render(screen, dbox({bottom, text("top") | clear_under}));
+  EXPECT_TRUE(stencils.empty());
+  EXPECT_EQ(screen.ToString(), "top\r\n   ");
+}
+
+TEST(DBoxTest, PartiallyOccluded) {
+  std::vector<Box> stencils;
+  auto bottom = std::make_shared<Fill>(&stencils);
+  Screen screen(3, 3);
+  Render(screen, dbox({
+                     bottom,
+                     vbox({text("ab") | clear_under, filler()}),
+                 }));
+  ASSERT_EQ(stencils.size(), 1u);
+  EXPECT_EQ(stencils[0], (Box{0, 2, 1, 2}));
+  EXPECT_EQ(screen.ToString(), "ab \r\nxxx\r\nxxx");
+  EXPECT_EQ(screen.stencil, (Box{0, 2, 0, 2}));
+
+  // The rest isn't a rectangle: the stencil is kept.
+  stencils.clear();
+  Screen other(3, 3);
+  Render(other, dbox({
+                    bottom,
+                    text("a") | clear_under | center,
+                }));
+  ASSERT_EQ(stencils.size(), 1u);
+  EXPECT_EQ(stencils[0], (Box{0, 2, 0, 2}));
+  EXPECT_EQ(other.ToString(), "xxx\r\nxax\r\nxxx");
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -1,12 +1,13 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared, __shared_ptr_access
+#include <memory>   // for shared_ptr, __shared_ptr_access
 #include <utility>  // for move
 #include <vector>   // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
-#include "ftxui/dom/node.hpp"      // for Elements, Node
+#include "ftxui/dom/elements.hpp"     // for Element, unpack, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
+#include "ftxui/dom/node.hpp"         // for Elements, Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 
@@ -74,17 +75,18 @@ class Flex : public Node {
     requirement_.min_x = 0;
     requirement_.min_y = 0;
     if (!children_.empty()) {
-      children_[0]->ComputeRequirement();
+      children_[0]->UpdateRequirement();
       requirement_ = children_[0]->requirement();
     }
     f_(requirement_);
   }
 
   void SetBox(Box box) override {
+    Node::SetBox(box);
     if (children_.empty()) {
       return;
     }
-    children_[0]->SetBox(box);
+    children_[0]->UpdateBox(box);
   }
 
   FlexFunction f_;
@@ -96,7 +98,7 @@ class Flex : public Node {
 /// a container.
 /// @ingroup dom
 Element filler() {
-  return std::make_shared<Flex>(function_flex);
+  return MakeNode<Flex>(function_flex);
 }
 
 /// @brief Make a child element to expand proportionnally to the space left in a
@@ -121,61 +123,61 @@ Element filler() {
 /// └────┘└─────────────────────────────────────────────────────────┘└─────┘
 /// ~~~
 Element flex(Element child) {
-  return std::make_shared<Flex>(function_flex, std::move(child));
+  return MakeNode<Flex>(function_flex, std::move(child));
 }
 
 /// @brief Expand/Minimize if possible/needed on the X axis.
 /// @ingroup dom
 Element xflex(Element child) {
-  return std::make_shared<Flex>(function_xflex, std::move(child));
+  return MakeNode<Flex>(function_xflex, std::move(child));
 }
 
 /// @brief Expand/Minimize if possible/needed on the Y axis.
 /// @ingroup dom
 Element yflex(Element child) {
-  return std::make_shared<Flex>(function_yflex, std::move(child));
+  return MakeNode<Flex>(function_yflex, std::move(child));
 }
 
 /// @brief Expand if possible.
 /// @ingroup dom
 Element flex_grow(Element child) {
-  return std::make_shared<Flex>(function_flex_grow, std::move(child));
+  return MakeNode<Flex>(function_flex_grow, std::move(child));
 }
 
 /// @brief Expand if possible on the X axis.
 /// @ingroup dom
 Element xflex_grow(Element child) {
-  return std::make_shared<Flex>(function_xflex_grow, std::move(child));
+  return MakeNode<Flex>(function_xflex_grow, std::move(child));
 }
 
 /// @brief Expand if possible on the Y axis.
 /// @ingroup dom
 Element yflex_grow(Element child) {
-  return std::make_shared<Flex>(function_yflex_grow, std::move(child));
+  return MakeNode<Flex>(function_yflex_grow, std::move(child));
 }
 
 /// @brief Minimize if needed.
 /// @ingroup dom
 Element flex_shrink(Element child) {
-  return std::make_shared<Flex>(function_flex_shrink, std::move(child));
+  return MakeNode<Flex>(function_flex_shrink, std::move(child));
 }
 
 /// @brief Minimize if needed on the X axis.
 /// @ingroup dom
 Element xflex_shrink(Element child) {
-  return std::make_shared<Flex>(function_xflex_shrink, std::move(child));
+  return MakeNode<Flex>(function_xflex_shrink, std::move(child));
 }
 
 /// @brief Minimize if needed on the Y axis.
 /// @ingroup dom
 Element yflex_shrink(Element child) {
-  return std::make_shared<Flex>(function_yflex_shrink, std::move(child));
+  return MakeNode<Flex>(function_yflex_shrink, std::move(child));
 }
 
 /// @brief Make the element not flexible.
 /// @ingroup dom
 Element notflex(Element child) {
-  return std::make_shared<Flex>(function_not_flex, std::move(child));
+  return MakeNode<Flex>(function_not_flex, std::move(child));
 }
 
 }  // namespace ftxui
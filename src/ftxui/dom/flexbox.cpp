@@ -3,14 +3,15 @@
 // the LICENSE file.
 #include <algorithm>  // for min, max
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type, make_shared
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
+#include "ftxui/dom/elements.hpp"        // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
 #include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
 #include "ftxui/dom/node.hpp"            // for Node, Elements, Node::Status
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
 #include "ftxui/dom/requirement.hpp"     // for Requirement
 #include "ftxui/screen/box.hpp"          // for Box
 
@@ -90,7 +91,7 @@ class Flexbox : public Node {
 
   void ComputeRequirement() override {
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->UpdateRequirement();
     }
     flexbox_helper::Global global;
     global.config = config_normalized_;
@@ -171,7 +172,7 @@ class Flexbox : public Node {
       children_box.y_max = box.y_min + b.y + b.dim_y - 1;
 
       const Box intersection = Box::Intersection(children_box, box);
-      child->SetBox(intersection);
+      child->UpdateBox(intersection);
 
       need_iteration_ |= (intersection != children_box);
     }
@@ -179,7 +180,7 @@ class Flexbox : public Node {
 
   void Check(Status* status) override {
     for (auto& child : children_) {
-      child->Check(status);
+      child->UpdateCheck(status);
     }
 
     if (status->iteration == 0) {
@@ -219,7 +220,7 @@ class Flexbox : public Node {
 //  )
 /// ```
 Element flexbox(Elements children, FlexboxConfig config) {
-  return std::make_shared<Flexbox>(std::move(children), config);
+  return MakeNode<Flexbox>(std::move(children), config);
 }
 
 /// @brief A container displaying elements in rows from left to right. When
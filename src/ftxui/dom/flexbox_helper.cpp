@@ -84,15 +84,50 @@ void SymmetryY(Global& g) {
   }
 }
 
+// The blocks of a line. They are contiguous in Global::blocks.
 struct Line {
-  std::vector<Block*> blocks;
+  Block* begin;
+  Block* end;
+  int size() const { return int(end - begin); }
 };
 
-void SetX(Global& global, std::vector<Line> lines) {
-  for (auto& line : lines) {
-    std::vector<box_helper::Element> elements;
-    elements.reserve(line.blocks.size());
-    for (auto* block : line.blocks) {
+// Place the blocks of |line| next to each other, when none of them grows and
+// they fit. This is the common case of wrapped text, which doesn't need
+// box_helper::Compute.
+bool SetXFast(Global& global, const Line& line) {
+  if (global.config.justify_content == FlexboxConfig::JustifyContent::Stretch) {
+    return false;
+  }
+  int size = global.config.gap_x * (line.size() - 1);
+  for (Block* block = line.begin; block != line.end; ++block) {
+    if (block->flex_grow_x != 0) {
+      return false;
+    }
+    size += block->min_size_x;
+  }
+  if (size > global.size_x) {
+    return false;
+  }
+
+  int x = 0;
+  for (Block* block = line.begin; block != line.end; ++block) {
+    block->dim_x = block->min_size_x;
+    block->x = x;
+    x += block->min_size_x + global.config.gap_x;
+  }
+  return true;
+}
+
+void SetX(Global& global, const std::vector<Line>& lines) {
+  std::vector<box_helper::Element> elements;
+  for (const auto& line : lines) {
+    if (SetXFast(global, line)) {
+      continue;
+    }
+
+    elements.clear();
+    elements.reserve(line.size());
+    for (Block* block = line.begin; block != line.end; ++block) {
       box_helper::Element element;
       element.min_size = block->min_size_x;
       element.flex_grow =
@@ -104,14 +139,13 @@ void SetX(Global& global, std::vector<Line> lines) {
       elements.push_back(element);
     }
 
-    box_helper::Compute(
-        &elements,
-        global.size_x - global.config.gap_x * (int(line.blocks.size()) - 1));
+    box_helper::Compute(&elements,
+                        global.size_x - global.config.gap_x * (line.size() - 1));
 
     int x = 0;
-    for (size_t i = 0; i < line.blocks.size(); ++i) {
-      line.blocks[i]->dim_x = elements[i].size;
-      line.blocks[i]->x = x;
+    for (int i = 0; i < line.size(); ++i) {
+      line.begin[i].dim_x = elements[i].size;
+      line.begin[i].x = x;
       x += elements[i].size;
       x += global.config.gap_x;
     }
@@ -119,14 +153,14 @@ void SetX(Global& global, std::vector<Line> lines) {
 }
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-void SetY(Global& g, std::vector<Line> lines) {
+void SetY(Global& g, const std::vector<Line>& lines) {
   std::vector<box_helper::Element> elements;
   elements.reserve(lines.size());
-  for (auto& line : lines) {
+  for (const auto& line : lines) {
     box_helper::Element element;
-    element.flex_shrink = line.blocks.front()->flex_shrink_y;
-    element.flex_grow = line.blocks.front()->flex_grow_y;
-    for (auto* block : line.blocks) {
+    element.flex_shrink = line.begin->flex_shrink_y;
+    element.flex_grow = line.begin->flex_grow_y;
+    for (Block* block = line.begin; block != line.end; ++block) {
       element.min_size = std::max(element.min_size, block->min_size_y);
       element.flex_shrink = std::min(element.flex_shrink, block->flex_shrink_y);
       element.flex_grow = std::min(element.flex_grow, block->flex_grow_y);
@@ -204,7 +238,7 @@ void SetY(Global& g, std::vector<Line> lines) {
   // [Align items]
   for (size_t i = 0; i < lines.size(); ++i) {
     auto& element = elements[i];
-    for (auto* block : lines[i].blocks) {
+    for (Block* block = lines[i].begin; block != lines[i].end; ++block) {
       const bool stretch =
           block->flex_grow_y != 0 ||
           g.config.align_content == FlexboxConfig::AlignContent::Stretch;
@@ -239,9 +273,9 @@ void SetY(Global& g, std::vector<Line> lines) {
   }
 }
 
-void JustifyContent(Global& g, std::vector<Line> lines) {
-  for (auto& line : lines) {
-    Block* last = line.blocks.back();
+void JustifyContent(Global& g, const std::vector<Line>& lines) {
+  for (const auto& line : lines) {
+    Block* last = line.end - 1;
     int remaining_space = g.size_x - last->x - last->dim_x;
     switch (g.config.justify_content) {
       case FlexboxConfig::JustifyContent::FlexStart:
@@ -249,38 +283,38 @@ void JustifyContent(Global& g, std::vector<Line> lines) {
         break;
 
       case FlexboxConfig::JustifyContent::FlexEnd: {
-        for (auto* block : line.blocks) {
+        for (Block* block = line.begin; block != line.end; ++block) {
           block->x += remaining_space;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::Center: {
-        for (auto* block : line.blocks) {
+        for (Block* block = line.begin; block != line.end; ++block) {
           block->x += remaining_space / 2;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceBetween: {
-        for (int i = (int)line.blocks.size() - 1; i >= 1; --i) {
-          line.blocks[i]->x += remaining_space;
+        for (int i = line.size() - 1; i >= 1; --i) {
+          line.begin[i].x += remaining_space;
           remaining_space = remaining_space * (i - 1) / i;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceAround: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (2 * i + 1) / (2 * i + 2);
+        for (int i = line.size() - 1; i >= 0; --i) {
+          line.begin[i].x += remaining_space * (2 * i + 1) / (2 * i + 2);
           remaining_space = remaining_space * (2 * i) / (2 * i + 2);
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceEvenly: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (i + 1) / (i + 2);
+        for (int i = line.size() - 1; i >= 0; --i) {
+          line.begin[i].x += remaining_space * (i + 1) / (i + 2);
           remaining_space = remaining_space * (i + 1) / (i + 2);
         }
         break;
@@ -317,27 +351,27 @@ void Compute3(Global& global) {
   // Step 1: Lay out every elements into rows:
   std::vector<Line> lines;
   {
-    Line line;
+    Block* const blocks = global.blocks.data();
+    Line line = {blocks, blocks};
     int x = 0;
-    line.blocks.reserve(global.blocks.size());
     for (auto& block : global.blocks) {
       // Does it fit the end of the row?
       // No? Then we need to start a new one:
       if (x + block.min_size_x > global.size_x) {
         x = 0;
-        if (!line.blocks.empty()) {
-          lines.push_back(std::move(line));
+        if (line.size() != 0) {
+          lines.push_back(line);
         }
-        line = Line();
+        line = {&block, &block};
       }
 
       block.line = lines.size();
-      block.line_position = line.blocks.size();
-      line.blocks.push_back(&block);
+      block.line_position = line.size();
+      line.end = &block + 1;
       x += block.min_size_x + global.config.gap_x;
     }
-    if (!line.blocks.empty()) {
-      lines.push_back(std::move(line));
+    if (line.size() != 0) {
+      lines.push_back(line);
     }
   }
 
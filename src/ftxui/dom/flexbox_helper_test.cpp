@@ -230,5 +230,42 @@ TEST(FlexboxHelperTest, BasicColumnInversed) {
   EXPECT_EQ(g.blocks[4].dim_y, 5);
 }
 
+TEST(FlexboxHelperTest, MixedFastAndSlowLines) {
+  // The first line fits without growing. The second one contains a growing
+  // block. The third one is a single block too large for the row.
+  flexbox_helper::Block block_4;
+  block_4.min_size_x = 4;
+  block_4.min_size_y = 1;
+  flexbox_helper::Block block_grow = block_4;
+  block_grow.flex_grow_x = 1;
+  flexbox_helper::Block block_12 = block_4;
+  block_12.min_size_x = 12;
+
+  flexbox_helper::Global g;
+  g.blocks = {block_4, block_4, block_grow, block_12};
+  g.size_x = 10;
+  g.size_y = 10;
+  g.config = FlexboxConfig().SetGap(1, 0);
+  flexbox_helper::Compute(g);
+
+  EXPECT_EQ(g.blocks[0].line, 0);
+  EXPECT_EQ(g.blocks[1].line, 0);
+  EXPECT_EQ(g.blocks[2].line, 1);
+  EXPECT_EQ(g.blocks[3].line, 2);
+
+  EXPECT_EQ(g.blocks[0].x, 0);
+  EXPECT_EQ(g.blocks[0].dim_x, 4);
+  EXPECT_EQ(g.blocks[1].x, 5);
+  EXPECT_EQ(g.blocks[1].dim_x, 4);
+  EXPECT_EQ(g.blocks[2].x, 0);
+  EXPECT_EQ(g.blocks[2].dim_x, 10);
+  EXPECT_EQ(g.blocks[3].x, 0);
+  EXPECT_EQ(g.blocks[3].dim_x, 10);
+
+  EXPECT_EQ(g.blocks[0].y, 0);
+  EXPECT_EQ(g.blocks[2].y, 1);
+  EXPECT_EQ(g.blocks[3].y, 2);
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -1,13 +1,14 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Decorator, Element, focusPosition, focusPositionRelative
+#include "ftxui/dom/elements.hpp"        // for Decorator, Element, focusPosition, focusPositionRelative
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::NORMAL, Requirement::Selection
-#include "ftxui/screen/box.hpp"  // for Box
+#include "ftxui/dom/requirement.hpp"     // for Requirement, Requirement::NORMAL, Requirement::Selection
+#include "ftxui/screen/box.hpp"          // for Box
 
 namespace ftxui {
 
@@ -51,7 +52,7 @@ Decorator focusPositionRelative(float x, float y) {
   };
 
   return [x, y](Element child) {
-    return std::make_shared<Impl>(std::move(child), x, y);
+    return MakeNode<Impl>(std::move(child), x, y);
   };
 }
 
@@ -90,7 +91,7 @@ Decorator focusPosition(int x, int y) {
   };
 
   return [x, y](Element child) {
-    return std::make_shared<Impl>(std::move(child), x, y);
+    return MakeNode<Impl>(std::move(child), x, y);
   };
 }
 
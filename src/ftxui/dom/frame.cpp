@@ -2,16 +2,17 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>  // for max, min
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <memory>     // for shared_ptr, __shared_ptr_access
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe
-#include "ftxui/dom/node.hpp"  // for Node, Elements
+#include "ftxui/dom/elements.hpp"     // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::FOCUSED, Requirement::SELECTED
-#include "ftxui/screen/box.hpp"      // for Box
-#include "ftxui/screen/screen.hpp"   // for Screen, Screen::Cursor
-#include "ftxui/util/autoreset.hpp"  // for AutoReset
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen, Screen::Cursor
+#include "ftxui/util/autoreset.hpp"   // for AutoReset
 
 namespace ftxui {
 
@@ -33,7 +34,7 @@ class Select : public Node {
 
   void SetBox(Box box) override {
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->UpdateBox(box);
   }
 };
 
@@ -111,7 +112,7 @@ class Frame : public Node {
       children_box.y_max = box.y_min + internal_dimy - dy;
     }
 
-    children_[0]->SetBox(children_box);
+    children_[0]->UpdateBox(children_box);
   }
 
   void Render(Screen& screen) override {
@@ -148,14 +149,14 @@ class FocusCursor : public Focus {
 /// @param child The element to be selected.
 /// @ingroup dom
 Element select(Element child) {
-  return std::make_shared<Select>(unpack(std::move(child)));
+  return MakeNode<Select>(unpack(std::move(child)));
 }
 
 /// @brief Set the `child` to be the one in focus globally.
 /// @param child The element to be focused.
 /// @ingroup dom
 Element focus(Element child) {
-  return std::make_shared<Focus>(unpack(std::move(child)));
+  return MakeNode<Focus>(unpack(std::move(child)));
 }
 
 /// @brief Allow an element to be displayed inside a 'virtual' area. It size can
@@ -165,7 +166,7 @@ Element focus(Element child) {
 /// @see xframe
 /// @see yframe
 Element frame(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, true);
+  return MakeNode<Frame>(unpack(std::move(child)), true, true);
 }
 
 /// @brief Same as `frame`, but only on the x-axis.
@@ -173,7 +174,7 @@ Element frame(Element child) {
 /// @see xframe
 /// @see yframe
 Element xframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, false);
+  return MakeNode<Frame>(unpack(std::move(child)), true, false);
 }
 
 /// @brief Same as `frame`, but only on the y-axis.
@@ -181,7 +182,7 @@ Element xframe(Element child) {
 /// @see xframe
 /// @see yframe
 Element yframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), false, true);
+  return MakeNode<Frame>(unpack(std::move(child)), false, true);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still block.
@@ -194,7 +195,7 @@ Element yframe(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlock(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Block);
 }
 
@@ -208,7 +209,7 @@ Element focusCursorBlock(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlockBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::BlockBlinking);
 }
 
@@ -222,7 +223,7 @@ Element focusCursorBlockBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBar(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Bar);
 }
 
@@ -236,7 +237,7 @@ Element focusCursorBar(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBarBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::BarBlinking);
 }
 
@@ -250,7 +251,7 @@ Element focusCursorBarBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderline(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Underline);
 }
 
@@ -264,7 +265,7 @@ Element focusCursorUnderline(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderlineBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::UnderlineBlinking);
 }
 
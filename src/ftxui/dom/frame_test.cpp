@@ -0,0 +1,82 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/dom/elements.hpp"    // for text, vbox, hbox, frame, focus, reflect
+#include "ftxui/dom/node.hpp"        // for Node, Render
+#include "ftxui/dom/node_arena.hpp"  // for MakeNode
+#include "ftxui/screen/box.hpp"      // for Box
+#include "ftxui/screen/screen.hpp"   // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A one cell element, counting how many times it is drawn.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : count_(count) {}
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+  void Render(Screen& screen) override {
+    ++*count_;
+    screen.PixelAt(box_.x_min, box_.y_min).character = "x";
+  }
+
+ private:
+  int* count_;
+};
+
+}  // namespace
+
+TEST(FrameTest, CullRowsOutsideOfTheFrame) {
+  int count = 0;
+  Elements rows;
+  for (int i = 0; i < 1000; ++i) {
+    Element row = hbox({MakeNode<Counter>(&count), text(std::to_string(i))});
+    rows.push_back(i == 500 ? row | focus : row);
+  }
+  Screen screen(5, 3);
+  Render(screen, vbox(std::move(rows)) | frame);
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(screen.ToString(),
+            "x499 \r\n"
+            "x500 \r\n"
+            "x501 ");
+}
+
+TEST(FrameTest, CullColumnsOutsideOfTheFrame) {
+  int count = 0;
+  Elements columns;
+  for (int i = 0; i < 100; ++i) {
+    columns.push_back(MakeNode<Counter>(&count));
+  }
+  Screen screen(10, 1);
+  Render(screen, hbox(std::move(columns)) | frame);
+  EXPECT_EQ(count, 10);
+}
+
+TEST(FrameTest, ReflectCulledRow) {
+  Box visible;
+  Box hidden;
+  Element document = vbox({
+                         text("visible") | reflect(visible),
+                         text("a"),
+                         text("b"),
+                         text("hidden") | reflect(hidden),
+                     }) |
+                     frame;
+  Screen screen(10, 2);
+  Render(screen, document);
+  EXPECT_TRUE(visible.Contain(0, 0));
+  EXPECT_FALSE(hidden.Contain(0, 3));
+  EXPECT_FALSE(hidden.Contain(0, 1));
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -2,20 +2,27 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <ftxui/dom/direction.hpp>  // for Direction, Direction::Down, Direction::Left, Direction::Right, Direction::Up
-#include <memory>                   // for allocator, make_shared
+#include <algorithm>                // for max, min
+#include <cstddef>                  // for size_t
+#include <memory>                   // for shared_ptr, allocator
 #include <string>                   // for string
+#include <string_view>              // for string_view
+#include <utility>                  // for move
+#include <vector>                   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
+#include "ftxui/dom/elements.hpp"     // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp, gauges, gaugesDirection
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/screen/string.hpp"    // for string_width, Utf8Glyphs
 
 namespace ftxui {
 
 namespace {
 // NOLINTNEXTLINE
-static const std::string charset_horizontal[11] = {
+constexpr std::string_view charset_horizontal[11] = {
 #if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
     // Microsoft's terminals often use fonts not handling the 8 unicode
     // characters for representing the whole gauge. Fallback with less.
@@ -28,7 +35,7 @@ static const std::string charset_horizontal[11] = {
     "█"};
 
 // NOLINTNEXTLINE
-static const std::string charset_vertical[10] = {
+constexpr std::string_view charset_vertical[10] = {
     "█",
     "▇",
     "▆",
@@ -43,120 +50,242 @@ static const std::string charset_vertical[10] = {
     " ",
 };
 
-class Gauge : public Node {
- public:
-  Gauge(float progress, Direction direction)
-      : progress_(progress), direction_(direction) {
-    // This handle NAN correctly:
-    if (!(progress_ > 0.F)) {
-      progress_ = 0.F;
+// Clamp |progress| into [0,1]. This handle NAN correctly.
+float Clamp(float progress) {
+  if (!(progress > 0.F)) {
+    return 0.F;
+  }
+  if (!(progress < 1.F)) {
+    return 1.F;
+  }
+  return progress;
+}
+
+bool IsHorizontal(Direction direction) {
+  return direction == Direction::Right || direction == Direction::Left;
+}
+
+// Draw a progress bar on the row |y|, from |x_min| to |x_max|.
+void RenderHorizontal(Screen& screen,
+                      int x_min,
+                      int x_max,
+                      int y,
+                      float progress,
+                      bool invert) {
+  // Draw the progress bar horizontally.
+  {
+    if (invert) {
+      progress = 1.F - progress;
     }
-    if (!(progress_ < 1.F)) {
-      progress_ = 1.F;
+    const auto limit = float(x_min) + progress * float(x_max - x_min + 1);
+    const int limit_int = static_cast<int>(limit);
+    int x = x_min;
+    while (x < limit_int) {
+      screen.at(x++, y) = charset_horizontal[9];  // NOLINT
+    }
+    // The partial cell. It doesn't exist when the bar is full.
+    if (x <= x_max) {
+      // NOLINTNEXTLINE
+      screen.at(x++, y) = charset_horizontal[int(9 * (limit - limit_int))];
+    }
+    while (x <= x_max) {
+      screen.at(x++, y) = charset_horizontal[0];
     }
   }
 
-  void ComputeRequirement() override {
-    switch (direction_) {
-      case Direction::Right:
-      case Direction::Left:
-        requirement_.flex_grow_x = 1;
-        requirement_.flex_grow_y = 0;
-        requirement_.flex_shrink_x = 1;
-        requirement_.flex_shrink_y = 0;
-        break;
-      case Direction::Up:
-      case Direction::Down:
-        requirement_.flex_grow_x = 0;
-        requirement_.flex_grow_y = 1;
-        requirement_.flex_shrink_x = 0;
-        requirement_.flex_shrink_y = 1;
-        break;
+  if (invert) {
+    for (int x = x_min; x <= x_max; x++) {
+      screen.PixelAt(x, y).inverted ^= true;
     }
-    requirement_.min_x = 1;
-    requirement_.min_y = 1;
   }
+}
 
-  void Render(Screen& screen) override {
-    switch (direction_) {
-      case Direction::Right:
-        RenderHorizontal(screen, /*invert=*/false);
-        break;
-      case Direction::Up:
-        RenderVertical(screen, /*invert=*/false);
-        break;
-      case Direction::Left:
-        RenderHorizontal(screen, /*invert=*/true);
-        break;
-      case Direction::Down:
-        RenderVertical(screen, /*invert=*/true);
-        break;
+// Draw a progress bar on the column |x|, from |y_min| to |y_max|.
+void RenderVertical(Screen& screen,
+                    int x,
+                    int y_min,
+                    int y_max,
+                    float progress,
+                    bool invert) {
+  // Draw the progress bar vertically:
+  {
+    if (!invert) {
+      progress = 1.F - progress;
+    }
+    const float limit = float(y_min) + progress * float(y_max - y_min + 1);
+    const int limit_int = static_cast<int>(limit);
+    int y = y_min;
+    while (y < limit_int) {
+      screen.at(x, y++) = charset_vertical[8];  // NOLINT
+    }
+    // The partial cell. It doesn't exist when the bar is full.
+    if (y <= y_max) {
+      // NOLINTNEXTLINE
+      screen.at(x, y++) = charset_vertical[int(8 * (limit - limit_int))];
+    }
+    while (y <= y_max) {
+      screen.at(x, y++) = charset_vertical[0];
+    }
+  }
+
+  if (invert) {
+    for (int y = y_min; y <= y_max; y++) {
+      screen.PixelAt(x, y).inverted ^= true;
     }
   }
+}
 
-  void RenderHorizontal(Screen& screen, bool invert) {
-    const int y = box_.y_min;
-    if (y > box_.y_max) {
+// Draw |label| on the row |y|, from |x_min| to |x_max|.
+void RenderLabel(Screen& screen,
+                 const std::string& label,
+                 int x_min,
+                 int x_max,
+                 int y) {
+  int x = x_min;
+  for (const std::string_view cell : Utf8Glyphs(label)) {
+    if (x > x_max) {
       return;
     }
+    screen.PixelAt(x++, y).character = cell;
+  }
+}
+
+void SetFlex(Requirement& requirement, Direction direction) {
+  if (IsHorizontal(direction)) {
+    requirement.flex_grow_x = 1;
+    requirement.flex_grow_y = 0;
+    requirement.flex_shrink_x = 1;
+    requirement.flex_shrink_y = 0;
+  } else {
+    requirement.flex_grow_x = 0;
+    requirement.flex_grow_y = 1;
+    requirement.flex_shrink_x = 0;
+    requirement.flex_shrink_y = 1;
+  }
+}
+
+class Gauge : public Node {
+ public:
+  Gauge(float progress, Direction direction)
+      : progress_(Clamp(progress)), direction_(direction) {}
 
-    // Draw the progress bar horizontally.
-    {
-      const float progress = invert ? 1.F - progress_ : progress_;
-      const auto limit =
-          float(box_.x_min) + progress * float(box_.x_max - box_.x_min + 1);
-      const int limit_int = static_cast<int>(limit);
-      int x = box_.x_min;
-      while (x < limit_int) {
-        screen.at(x++, y) = charset_horizontal[9];  // NOLINT
+  void ComputeRequirement() override {
+    SetFlex(requirement_, direction_);
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const bool invert =
+        direction_ == Direction::Left || direction_ == Direction::Down;
+    if (IsHorizontal(direction_)) {
+      if (box_.y_min <= box_.y_max) {
+        RenderHorizontal(screen, box_.x_min, box_.x_max, box_.y_min,
+                         progress_, invert);
       }
-      // NOLINTNEXTLINE
-      screen.at(x++, y) = charset_horizontal[int(9 * (limit - limit_int))];
-      while (x <= box_.x_max) {
-        screen.at(x++, y) = charset_horizontal[0];
+    } else {
+      if (box_.x_min <= box_.x_max) {
+        RenderVertical(screen, box_.x_min, box_.y_min, box_.y_max, progress_,
+                       invert);
       }
     }
+  }
 
-    if (invert) {
-      for (int x = box_.x_min; x <= box_.x_max; x++) {
-        screen.PixelAt(x, y).inverted ^= true;
-      }
+ private:
+  float progress_;
+  Direction direction_;
+};
+
+// Many progress bars, with their labels, in a single Node. The horizontal bars
+// are drawn one per row, after their labels. The vertical bars are drawn one
+// per column, above their labels.
+class Gauges : public Node {
+ public:
+  Gauges(std::vector<float> progress,
+         std::vector<std::string> labels,
+         Direction direction)
+      : progress_(std::move(progress)),
+        labels_(std::move(labels)),
+        direction_(direction) {
+    for (float& value : progress_) {
+      value = Clamp(value);
+    }
+    labels_.resize(progress_.size());
+    for (const std::string& label : labels_) {
+      label_width_ = std::max(label_width_, string_width(label));
     }
   }
 
-  void RenderVertical(Screen& screen, bool invert) {
-    const int x = box_.x_min;
-    if (x > box_.x_max) {
-      return;
+  void ComputeRequirement() override {
+    SetFlex(requirement_, direction_);
+    const int size = int(progress_.size());
+    if (IsHorizontal(direction_)) {
+      requirement_.min_x = label_width_ ? label_width_ + 2 : 1;
+      requirement_.min_y = size;
+    } else {
+      requirement_.min_x = size ? size * (ColumnWidth() + 1) - 1 : 0;
+      requirement_.min_y = label_width_ ? 2 : 1;
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const bool invert =
+        direction_ == Direction::Left || direction_ == Direction::Down;
+    if (IsHorizontal(direction_)) {
+      RenderRows(screen, invert);
+    } else {
+      RenderColumns(screen, invert);
     }
+  }
 
-    // Draw the progress bar vertically:
-    {
-      const float progress = invert ? progress_ : 1.F - progress_;
-      const float limit =
-          float(box_.y_min) + progress * float(box_.y_max - box_.y_min + 1);
-      const int limit_int = static_cast<int>(limit);
-      int y = box_.y_min;
-      while (y < limit_int) {
-        screen.at(x, y++) = charset_vertical[8];  // NOLINT
+ private:
+  void RenderRows(Screen& screen, bool invert) {
+    const int x_bar = box_.x_min + (label_width_ ? label_width_ + 1 : 0);
+    // Only the rows inside the stencil are drawn.
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    for (int y = y_min; y <= y_max; ++y) {
+      const size_t i = size_t(y - box_.y_min);
+      if (i >= progress_.size()) {
+        return;
       }
-      // NOLINTNEXTLINE
-      screen.at(x, y++) = charset_vertical[int(8 * (limit - limit_int))];
-      while (y <= box_.y_max) {
-        screen.at(x, y++) = charset_vertical[0];
+      RenderLabel(screen, labels_[i], box_.x_min,
+                  std::min(x_bar - 2, box_.x_max), y);
+      if (x_bar <= box_.x_max) {
+        RenderHorizontal(screen, x_bar, box_.x_max, y, progress_[i], invert);
       }
     }
+  }
 
-    if (invert) {
-      for (int y = box_.y_min; y <= box_.y_max; y++) {
-        screen.PixelAt(x, y).inverted ^= true;
+  void RenderColumns(Screen& screen, bool invert) {
+    const int width = ColumnWidth();
+    const int y_bar = label_width_ ? box_.y_max - 1 : box_.y_max;
+    for (size_t i = 0; i < progress_.size(); ++i) {
+      const int x_min = box_.x_min + int(i) * (width + 1);
+      const int x_max = std::min(box_.x_max, x_min + width - 1);
+      if (x_min > std::min(box_.x_max, screen.stencil.x_max)) {
+        return;
+      }
+      if (x_max < screen.stencil.x_min) {
+        continue;
+      }
+      if (box_.y_min <= y_bar) {
+        for (int x = x_min; x <= x_max; ++x) {
+          RenderVertical(screen, x, box_.y_min, y_bar, progress_[i], invert);
+        }
+      }
+      if (label_width_) {
+        RenderLabel(screen, labels_[i], x_min, x_max, box_.y_max);
       }
     }
   }
 
- private:
-  float progress_;
+  int ColumnWidth() const { return std::max(1, label_width_); }
+
+  std::vector<float> progress_;
+  std::vector<std::string> labels_;
   Direction direction_;
+  int label_width_ = 0;
 };
 
 }  // namespace
@@ -167,7 +296,7 @@ class Gauge : public Node {
 //  @param direction Direction of progress bars progression.
 /// @ingroup dom
 Element gaugeDirection(float progress, Direction direction) {
-  return std::make_shared<Gauge>(progress, direction);
+  return MakeNode<Gauge>(progress, direction);
 }
 
 /// @brief Draw a high definition progress bar progressing from left to right.
@@ -294,4 +423,45 @@ Element gauge(float progress) {
   return gaugeRight(progress);
 }
 
+/// @brief Draw many progress bars, with their labels, as a single element.
+/// This is much cheaper than a `vbox` of `gauge`s when there are many of them.
+/// @param progress The proportion of the area to be filled, for every bar.
+/// Belong to [0,1].
+/// @param labels The label of every bar. It can be shorter than |progress|.
+/// @param direction Direction of the progress bars progression. The
+/// horizontal bars are drawn one per row, after their labels. The vertical
+/// bars are drawn one per column, above their labels.
+/// @ingroup dom
+Element gaugesDirection(std::vector<float> progress,
+                        std::vector<std::string> labels,
+                        Direction direction) {
+  return MakeNode<Gauges>(std::move(progress), std::move(labels), direction);
+}
+
+/// @brief Draw many progress bars, progressing from left to right, one per
+/// row, after their labels.
+/// @param progress The proportion of the area to be filled, for every bar.
+/// Belong to [0,1].
+/// @param labels The label of every bar. It can be shorter than |progress|.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ~~~cpp
+/// gauges({0.5F, 1.F}, {"build", "test"}) | border
+/// ~~~
+///
+/// #### Output
+///
+/// ~~~bash
+/// ┌────────────────┐
+/// │build █████     │
+/// │test  ██████████│
+/// └────────────────┘
+/// ~~~
+Element gauges(std::vector<float> progress, std::vector<std::string> labels) {
+  return gaugesDirection(std::move(progress), std::move(labels),
+                         Direction::Right);
+}
+
 }  // namespace ftxui
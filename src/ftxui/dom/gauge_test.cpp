@@ -4,7 +4,7 @@
 #include <gtest/gtest.h>
 #include <memory>  // for allocator
 
-#include "ftxui/dom/elements.hpp"   // for gauge, gaugeUp
+#include "ftxui/dom/elements.hpp"   // for gauge, gaugeUp, gauges, gaugesDirection
 #include "ftxui/dom/node.hpp"       // for Render
 #include "ftxui/screen/screen.hpp"  // for Screen
 
@@ -99,5 +99,70 @@ TEST(GaugeTest, OneVertical) {
       screen.ToString());
 }
 
+TEST(GaugeTest, Gauges) {
+  auto root = gauges({0.5F, 1.F, 0.F}, {"build", "test"});
+  Screen screen(16, 4);
+  Render(screen, root);
+
+  EXPECT_EQ(
+      "build █████     \r\n"
+      "test  ██████████\r\n"
+      "                \r\n"
+      "                ",
+      screen.ToString());
+}
+
+TEST(GaugeTest, GaugesWithoutLabels) {
+  auto root = gauges({1.F, 0.2F});
+  Screen screen(5, 2);
+  Render(screen, root);
+
+  EXPECT_EQ(
+      "█████\r\n"
+      "█    ",
+      screen.ToString());
+}
+
+TEST(GaugeTest, GaugesMatchGauge) {
+  for (Direction direction : {Direction::Left, Direction::Right}) {
+    Screen expected(10, 1);
+    Render(expected, gaugeDirection(0.42F, direction));
+    Screen screen(10, 1);
+    Render(screen, gaugesDirection({0.42F}, {}, direction));
+    EXPECT_EQ(expected.ToString(), screen.ToString());
+  }
+  for (Direction direction : {Direction::Up, Direction::Down}) {
+    Screen expected(1, 10);
+    Render(expected, gaugeDirection(0.42F, direction));
+    Screen screen(1, 10);
+    Render(screen, gaugesDirection({0.42F}, {}, direction));
+    EXPECT_EQ(expected.ToString(), screen.ToString());
+  }
+}
+
+TEST(GaugeTest, GaugesUp) {
+  auto root = gaugesDirection({1.F, 0.5F, 0.F}, {"a", "bb"}, Direction::Up);
+  Screen screen(8, 3);
+  Render(screen, root);
+
+  EXPECT_EQ(
+      "██      \r\n"
+      "██ ██   \r\n"
+      "a  bb   ",
+      screen.ToString());
+}
+
+TEST(GaugeTest, GaugesOnlyDrawTheVisibleRows) {
+  std::vector<float> progress(1000, 1.F);
+  auto root = gauges(progress) | vscroll_indicator | frame;
+  Screen screen(4, 2);
+  Render(screen, root);
+
+  EXPECT_EQ(
+      "███┃\r\n"
+      "███ ",
+      screen.ToString());
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -1,15 +1,20 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <algorithm>   // for max, min
+#include <cmath>       // for lround
 #include <functional>  // for function
-#include <memory>      // for allocator, make_shared
+#include <memory>      // for shared_ptr, allocator
 #include <string>      // for string
+#include <string_view>  // for string_view
 #include <utility>     // for move
 #include <vector>      // for vector
 
 #include "ftxui/dom/elements.hpp"     // for GraphFunction, Element, graph
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/time_series.hpp"  // for TimeSeries
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Screen
 
@@ -17,7 +22,7 @@ namespace ftxui {
 
 namespace {
 // NOLINTNEXTLINE
-static std::string charset[] =
+constexpr std::string_view charset[] =
 #if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
     // Microsoft's terminals often use fonts not handling the 8 unicode
     // characters for representing the whole graph. Fallback with less.
@@ -26,6 +31,13 @@ static std::string charset[] =
     {" ", "▗", "▐", "▖", "▄", "▟", "▌", "▙", "█"};
 #endif
 
+// The quadrants: top-left, bottom-left, top-right, bottom-right.
+// NOLINTNEXTLINE
+constexpr std::string_view quadrants[] = {
+    " ", "▘", "▖", "▌", "▝", "▀", "▞", "▛",
+    "▗", "▚", "▄", "▙", "▐", "▜", "▟", "█",
+};
+
 class Graph : public Node {
  public:
   explicit Graph(GraphFunction graph_function)
@@ -64,12 +76,94 @@ class Graph : public Node {
   GraphFunction graph_function_;
 };
 
+class TimeSeriesGraph : public Node {
+ public:
+  explicit TimeSeriesGraph(std::shared_ptr<const TimeSeries> series)
+      : series_(std::move(series)) {}
+
+  void ComputeRequirement() override {
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+    requirement_.min_x = 3;
+    requirement_.min_y = 3;
+  }
+
+  // Every cell holds 2x2 quadrants. A column of quadrants is filled between
+  // the lowest and the highest samples it represents.
+  void Render(Screen& screen) override {
+    const int width = box_.x_max - box_.x_min + 1;
+    const int rows = (box_.y_max - box_.y_min + 1) * 2;
+    if (width <= 0 || rows <= 0) {
+      return;
+    }
+
+    const float min = series_->min();
+    const float range = series_->max() - min;
+    auto row = [&](float value) {
+      if (range <= 0.f) {
+        return 0;
+      }
+      const long r = std::lround((value - min) / range * float(rows - 1));
+      return int(std::max(0L, std::min(long(rows - 1), r)));
+    };
+
+    // The range of quadrant rows filled in the left and right halves of the
+    // current cell. Empty when low > high.
+    int low[2] = {1, 1};
+    int high[2] = {0, 0};
+    int current = 0;
+
+    auto flush = [&] {
+      const int x = box_.x_min + current;
+      for (int y = box_.y_min; y <= box_.y_max; ++y) {
+        const int bottom = 2 * (box_.y_max - y);
+        const int top = bottom + 1;
+        int bits = 0;
+        bits |= (low[0] <= top && top <= high[0]) ? 1 : 0;
+        bits |= (low[0] <= bottom && bottom <= high[0]) ? 2 : 0;
+        bits |= (low[1] <= top && top <= high[1]) ? 4 : 0;
+        bits |= (low[1] <= bottom && bottom <= high[1]) ? 8 : 0;
+        screen.at(x, y) = quadrants[bits];  // NOLINT
+      }
+      low[0] = low[1] = 1;
+      high[0] = high[1] = 0;
+    };
+
+    series_->ForEachColumn(2 * width, [&](int column, float l, float h) {
+      while (current < column / 2) {
+        flush();
+        ++current;
+      }
+      low[column % 2] = row(l);
+      high[column % 2] = row(h);
+    });
+    while (current < width) {
+      flush();
+      ++current;
+    }
+  }
+
+ private:
+  std::shared_ptr<const TimeSeries> series_;
+};
+
 }  // namespace
 
 /// @brief Draw a graph using a GraphFunction.
 /// @param graph_function the function to be called to get the data.
 Element graph(GraphFunction graph_function) {
-  return std::make_shared<Graph>(std::move(graph_function));
+  return MakeNode<Graph>(std::move(graph_function));
+}
+
+/// @brief Draw the samples of a TimeSeries, the newest on the right. When there
+/// are more samples than columns, each column shows the range of values of the
+/// samples it represents.
+/// @param series the samples. They can be pushed while the graph is rendered.
+/// @ingroup dom
+Element graph(std::shared_ptr<const TimeSeries> series) {
+  return MakeNode<TimeSeriesGraph>(std::move(series));
 }
 
 }  // namespace ftxui
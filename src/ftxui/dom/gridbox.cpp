@@ -3,13 +3,15 @@
 // the LICENSE file.
 #include <algorithm>  // for max, min
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
-#include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
+#include "ftxui/dom/elements.hpp"     // for Elements, Element, gridbox
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/parallel.hpp"     // for RenderChildren
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 
@@ -39,13 +41,6 @@ class GridBox : public Node {
     for (const auto& line : lines_) {
       x_size = std::max(x_size, int(line.size()));
     }
-
-    // Fill in empty cells, in case the user did not used the API correctly:
-    for (auto& line : lines_) {
-      while (line.size() < size_t(x_size)) {
-        line.push_back(filler());
-      }
-    }
   }
 
   void ComputeRequirement() override {
@@ -56,67 +51,80 @@ class GridBox : public Node {
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
 
-    for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->ComputeRequirement();
-      }
-    }
-
-    // Compute the size of each columns/row.
-    std::vector<int> size_x(x_size, 0);
-    std::vector<int> size_y(y_size, 0);
-    for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        size_x[x] = std::max(size_x[x], lines_[y][x]->requirement().min_x);
-        size_y[y] = std::max(size_y[y], lines_[y][x]->requirement().min_y);
-      }
-    }
-
-    requirement_.min_x = Integrate(size_x);
-    requirement_.min_y = Integrate(size_y);
-
-    // Forward the selected/focused child state:
-    requirement_.selection = Requirement::NORMAL;
-    for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        if (requirement_.selection >= lines_[y][x]->requirement().selection) {
-          continue;
-        }
-        requirement_.selection = lines_[y][x]->requirement().selection;
-        requirement_.selected_box = lines_[y][x]->requirement().selected_box;
-        requirement_.selected_box.x_min += size_x[x];
-        requirement_.selected_box.x_max += size_x[x];
-        requirement_.selected_box.y_min += size_y[y];
-        requirement_.selected_box.y_max += size_y[y];
-      }
-    }
-  }
-
-  void SetBox(Box box) override {
-    Node::SetBox(box);
-
+    // Compute the extent of each columns/row, in a single pass over the cells.
+    // They are reused by SetBox.
     box_helper::Element init;
     init.min_size = 0;
     init.flex_grow = 1024;    // NOLINT
     init.flex_shrink = 1024;  // NOLINT
-    std::vector<box_helper::Element> elements_x(x_size, init);
-    std::vector<box_helper::Element> elements_y(y_size, init);
+    elements_x_.assign(x_size, init);
+    elements_y_.assign(y_size, init);
 
+    requirement_.selection = Requirement::NORMAL;
+    int selected_x = 0;
+    int selected_y = 0;
     for (int y = 0; y < y_size; ++y) {
+      const auto& line = lines_[y];
+      auto& e_y = elements_y_[y];
       for (int x = 0; x < x_size; ++x) {
-        const auto& cell = lines_[y][x];
-        const auto& requirement = cell->requirement();
-        auto& e_x = elements_x[x];
-        auto& e_y = elements_y[y];
+        auto& e_x = elements_x_[x];
+
+        // Missing cells, in case the user did not used the API correctly,
+        // behave like a filler().
+        if (x >= int(line.size())) {
+          e_x.flex_grow = std::min(e_x.flex_grow, 1);
+          e_y.flex_grow = std::min(e_y.flex_grow, 1);
+          e_x.flex_shrink = std::min(e_x.flex_shrink, 1);
+          e_y.flex_shrink = std::min(e_y.flex_shrink, 1);
+          continue;
+        }
+
+        line[x]->UpdateRequirement();
+        const Requirement& requirement = line[x]->requirement();
         e_x.min_size = std::max(e_x.min_size, requirement.min_x);
         e_y.min_size = std::max(e_y.min_size, requirement.min_y);
         e_x.flex_grow = std::min(e_x.flex_grow, requirement.flex_grow_x);
         e_y.flex_grow = std::min(e_y.flex_grow, requirement.flex_grow_y);
         e_x.flex_shrink = std::min(e_x.flex_shrink, requirement.flex_shrink_x);
         e_y.flex_shrink = std::min(e_y.flex_shrink, requirement.flex_shrink_y);
+
+        // Forward the selected/focused child state. On ties, the leftmost
+        // column wins, then the topmost row.
+        if (requirement_.selection < requirement.selection ||
+            (requirement_.selection == requirement.selection &&
+             requirement.selection != Requirement::NORMAL && x < selected_x)) {
+          requirement_.selection = requirement.selection;
+          requirement_.selected_box = requirement.selected_box;
+          selected_x = x;
+          selected_y = y;
+        }
       }
     }
 
+    std::vector<int> size_x(x_size);
+    std::vector<int> size_y(y_size);
+    for (int x = 0; x < x_size; ++x) {
+      size_x[x] = elements_x_[x].min_size;
+    }
+    for (int y = 0; y < y_size; ++y) {
+      size_y[y] = elements_y_[y].min_size;
+    }
+    requirement_.min_x = Integrate(size_x);
+    requirement_.min_y = Integrate(size_y);
+
+    if (requirement_.selection != Requirement::NORMAL) {
+      requirement_.selected_box.x_min += size_x[selected_x];
+      requirement_.selected_box.x_max += size_x[selected_x];
+      requirement_.selected_box.y_min += size_y[selected_y];
+      requirement_.selected_box.y_max += size_y[selected_y];
+    }
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    std::vector<box_helper::Element> elements_x = elements_x_;
+    std::vector<box_helper::Element> elements_y = elements_y_;
     const int target_size_x = box.x_max - box.x_min + 1;
     const int target_size_y = box.y_max - box.y_min + 1;
     box_helper::Compute(&elements_x, target_size_x);
@@ -131,26 +139,29 @@ class GridBox : public Node {
 
       Box box_x = box_y;
       int x = box_x.x_min;
-      for (int ix = 0; ix < x_size; ++ix) {
+      auto& line = lines_[iy];
+      for (size_t ix = 0; ix < line.size(); ++ix) {
         box_x.x_min = x;
         x += elements_x[ix].size;
         box_x.x_max = x - 1;
-        lines_[iy][ix]->SetBox(box_x);
+        line[ix]->UpdateBox(box_x);
       }
     }
   }
 
   void Render(Screen& screen) override {
     for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->Render(screen);
-      }
+      RenderChildren(screen, line);
     }
   }
 
   int x_size = 0;
   int y_size = 0;
   std::vector<Elements> lines_;
+
+  // The extent of each column/row, computed by ComputeRequirement.
+  std::vector<box_helper::Element> elements_x_;
+  std::vector<box_helper::Element> elements_y_;
 };
 }  // namespace
    //
@@ -181,7 +192,7 @@ class GridBox : public Node {
 /// ╰──────────╯╰──────╯╰──────────╯
 /// ```
 Element gridbox(std::vector<Elements> lines) {
-  return std::make_shared<GridBox>(std::move(lines));
+  return MakeNode<GridBox>(std::move(lines));
 }
 
 }  // namespace ftxui
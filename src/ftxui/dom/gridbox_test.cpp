@@ -9,7 +9,8 @@
 #include <vector>     // for vector
 
 #include "ftxui/dom/elements.hpp"  // for text, operator|, Element, flex, Elements, flex_grow, flex_shrink, vtext, gridbox, vbox, focus, operator|=, border, frame
-#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::FOCUSED
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 // NOLINTBEGIN
@@ -618,5 +619,16 @@ TEST(GridboxTest, Focus) {
             "╰──╯");
 }
 
+TEST(GridboxTest, FocusLeftmostColumn) {
+  auto root = gridbox({
+      {text("a"), text("b") | focus},
+      {text("c") | focus, text("d")},
+  });
+  root->ComputeRequirement();
+  EXPECT_EQ(root->requirement().selection, Requirement::FOCUSED);
+  EXPECT_EQ(root->requirement().selected_box.x_min, 0);
+  EXPECT_EQ(root->requirement().selected_box.y_min, 1);
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -358,5 +358,19 @@ TEST(HBoxTest, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+TEST(HBoxTest, ManyChildren) {
+  // More children than the elements stored inline by the layout.
+  Elements children;
+  std::string expected;
+  for (int i = 0; i < 20; ++i) {
+    children.push_back(text(std::to_string(i % 10)) | flex_grow);
+    expected += std::to_string(i % 10) + " ";
+  }
+  auto root = hbox(std::move(children));
+  Screen screen(40, 1);
+  Render(screen, root);
+  EXPECT_EQ(expected, screen.ToString());
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -1,15 +1,17 @@
 // Copyright 2023 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <cstdint>  // for uint8_t
-#include <memory>   // for make_shared
+#include <cstdint>  // for uint16_t
+#include <memory>   // for shared_ptr
 #include <string>   // for string
+#include <tuple>    // for ignore
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, Decorator, hyperlink
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Screen, Pixel
+#include "ftxui/screen/screen.hpp"       // for PixelStyle, Screen
 
 namespace ftxui {
 
@@ -20,12 +22,10 @@ class Hyperlink : public NodeDecorator {
       : NodeDecorator(std::move(child)), link_(std::move(link)) {}
 
   void Render(Screen& screen) override {
-    const uint8_t hyperlink_id = screen.RegisterHyperlink(link_);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).hyperlink = hyperlink_id;
-      }
-    }
+    PixelStyle style;
+    style.fields = PixelStyle::kHyperlink;
+    style.hyperlink = screen.RegisterHyperlink(link_);
+    screen.ApplyStyle(box_, style);
     NodeDecorator::Render(screen);
   }
 
@@ -49,7 +49,12 @@ class Hyperlink : public NodeDecorator {
 ///   hyperlink("https://github.com/ArthurSonzogni/FTXUI", "link");
 /// ```
 Element hyperlink(std::string link, Element child) {
-  return std::make_shared<Hyperlink>(std::move(child), std::move(link));
+#if defined(FTXUI_NO_HYPERLINKS)
+  std::ignore = link;
+  return child;
+#else
+  return MakeNode<Hyperlink>(std::move(child), std::move(link));
+#endif
 }
 
 /// @brief Decorate using an hyperlink.
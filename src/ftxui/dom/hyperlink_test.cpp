@@ -2,7 +2,7 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>  // for Test, EXPECT_EQ, Message, TestPartResult, TestInfo (ptr only), TEST
-#include <string>  // for allocator, string
+#include <string>  // for allocator, string, to_string
 
 #include "ftxui/dom/elements.hpp"  // for text, hyperlink, operator|, Element, hbox
 #include "ftxui/dom/node.hpp"      // for Render
@@ -10,6 +10,7 @@
 
 namespace ftxui {
 
+#if !defined(FTXUI_NO_HYPERLINKS)
 TEST(HyperlinkTest, Basic) {
   auto element = hbox({
       text("text 1") | hyperlink("https://a.com"),
@@ -39,4 +40,31 @@ TEST(HyperlinkTest, Basic) {
             "\x1B]8;;\x1B\\");
 }
 
+TEST(HyperlinkTest, Many) {
+  Elements elements;
+  for (int i = 0; i < 1000; ++i) {
+    elements.push_back(text("x") | hyperlink("https://" + std::to_string(i)));
+  }
+  // The same links, again.
+  for (int i = 0; i < 1000; ++i) {
+    elements.push_back(text("x") | hyperlink("https://" + std::to_string(i)));
+  }
+
+  Screen screen(2000, 1);
+  Render(screen, hbox(std::move(elements)));
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(screen.PixelAt(i, 0).hyperlink, i + 1);
+    EXPECT_EQ(screen.PixelAt(i + 1000, 0).hyperlink, i + 1);
+    EXPECT_EQ(screen.Hyperlink(screen.PixelAt(i, 0).hyperlink),
+              "https://" + std::to_string(i));
+  }
+
+  // Clearing the screen forgets the links.
+  screen.Clear();
+  EXPECT_EQ(screen.RegisterHyperlink("https://999"), 1);
+  EXPECT_EQ(screen.RegisterHyperlink(""), 0);
+}
+#endif
+
 }  // namespace ftxui
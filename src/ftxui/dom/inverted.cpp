@@ -1,38 +1,21 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, inverted
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"   // for Element, inverted
+#include "ftxui/dom/style.hpp"      // for Styled
+#include "ftxui/screen/screen.hpp"  // for PixelStyle
 
 namespace ftxui {
 
-namespace {
-class Inverted : public NodeDecorator {
- public:
-  using NodeDecorator::NodeDecorator;
-
-  void Render(Screen& screen) override {
-    Node::Render(screen);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).inverted ^= true;
-      }
-    }
-  }
-};
-}  // namespace
-
 /// @brief Add a filter that will invert the foreground and the background
 /// colors.
 /// @ingroup dom
 Element inverted(Element child) {
-  return std::make_shared<Inverted>(std::move(child));
+  PixelStyle style;
+  style.invert = true;
+  return Styled(std::move(child), {}, style);
 }
 
 }  // namespace ftxui
@@ -0,0 +1,23 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_LAYOUT_CACHE_HPP
+#define FTXUI_DOM_LAYOUT_CACHE_HPP
+
+#include "ftxui/dom/node.hpp"    // for Element, Node
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui {
+
+// Remember that the layout of |element| converged in |box|. Used by
+// Dimension::Fit, so that the Render() following it does not lay the element
+// out a second time.
+void KeepLayout(const Element& element, Box box);
+
+// Whether |node| was the last element kept by KeepLayout(), in |box|. The
+// layout is used at most once, by the calling thread.
+bool TakeLayout(const Node* node, Box box);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_LAYOUT_CACHE_HPP
@@ -0,0 +1,88 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+
+#include "ftxui/dom/elements.hpp"  // for text, border, paragraph, vbox, Element
+#include "ftxui/dom/node.hpp"      // for Node, Render, RenderStats
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/terminal.hpp"  // for Dimensions, Fit
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A 3x1 element counting its layout passes.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : count_(count) {}
+  void ComputeRequirement() override {
+    ++*count_;
+    requirement_.min_x = 3;
+    requirement_.min_y = 1;
+  }
+
+ private:
+  int* count_;
+};
+
+}  // namespace
+
+TEST(LayoutCacheTest, FitThenRender) {
+  int count = 0;
+  Element document = vbox({text("title"), std::make_shared<Counter>(&count)});
+  auto screen = Screen::Create(Dimension::Fit(document));
+  EXPECT_EQ(screen.dimx(), 5);
+  EXPECT_EQ(screen.dimy(), 2);
+  EXPECT_EQ(count, 1);
+
+  RenderStats stats;
+  Render(screen, document.get(), &stats);
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(stats.layout_iterations, 0);
+  EXPECT_EQ(screen.ToString(), "title\r\n     ");
+
+  // The layout is reused only once.
+  Render(screen, document.get(), &stats);
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(stats.layout_iterations, 1);
+}
+
+TEST(LayoutCacheTest, OtherBox) {
+  int count = 0;
+  Element document = std::make_shared<Counter>(&count) | border;
+  Dimension::Fit(document);
+  EXPECT_EQ(count, 1);
+
+  auto screen = Screen::Create(Dimension::Fixed(10), Dimension::Fixed(3));
+  RenderStats stats;
+  Render(screen, document.get(), &stats);
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(stats.layout_iterations, 1);
+}
+
+TEST(LayoutCacheTest, OtherElement) {
+  int count = 0;
+  Element fitted = std::make_shared<Counter>(&count);
+  Element rendered = std::make_shared<Counter>(&count);
+  auto screen = Screen::Create(Dimension::Fit(fitted));
+  Render(screen, rendered);
+  EXPECT_EQ(count, 2);
+}
+
+TEST(LayoutCacheTest, Paragraph) {
+  // Elements needing several layout iterations are drawn the same.
+  Element document = paragraph("a b c d e f") | border;
+  auto screen = Screen::Create(Dimension::Fit(document));
+  Render(screen, document);
+
+  Element other = paragraph("a b c d e f") | border;
+  Screen expected(screen.dimx(), screen.dimy());
+  Render(expected, other);
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,96 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, lazy
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/autoreset.hpp"   // for AutoReset
+
+namespace ftxui {
+
+namespace {
+
+class Lazy : public Node {
+ public:
+  Lazy(Requirement hint, std::function<Element()> build)
+      : hint_(hint), build_(std::move(build)) {}
+
+  void ComputeRequirement() override { requirement_ = hint_; }
+
+  // The element is only built here, once the visible area is known.
+  void Render(Screen& screen) override {
+    const Box visible = Box::Intersection(box_, screen.stencil);
+    if (visible.x_min > visible.x_max || visible.y_min > visible.y_max) {
+      return;
+    }
+
+    if (!child_) {
+      child_ = build_();
+      laid_out_ = false;
+    }
+    if (!laid_out_ || child_->box() != box_) {
+      Layout(child_.get(), box_);
+      laid_out_ = true;
+    }
+
+    const AutoReset<Box> stencil(&screen.stencil, visible);
+    child_->Render(screen);
+  }
+
+ private:
+  static void Layout(Node* node, Box box) {
+    Status status;
+    node->Check(&status);
+    const int max_iterations = 20;
+    while (status.need_iteration && status.iteration < max_iterations) {
+      node->ComputeRequirement();
+      node->SetBox(box);
+      status.need_iteration = false;
+      status.iteration++;
+      node->Check(&status);
+    }
+  }
+
+  const Requirement hint_;
+  const std::function<Element()> build_;
+  Element child_;
+  bool laid_out_ = false;
+};
+
+}  // namespace
+
+/// @brief An element built on demand, only once it is visible on the screen.
+/// Until then, it requires the size of |hint|. This is useful for the
+/// sections of a long page inside a `frame`: the ones scrolled out cost
+/// nothing to build.
+///
+/// The element is laid out in the box given by its parent, sized after
+/// |hint|. It is built at most once.
+/// @param hint The requirement of the element, before it is built.
+/// @param build A function building the element.
+/// @see frame
+/// @see virtualList
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Requirement hint;
+/// hint.min_y = 10;
+/// Element document = vbox({
+///     lazy(hint, [] { return BuildChapter(1); }),
+///     lazy(hint, [] { return BuildChapter(2); }),
+/// }) | yframe;
+/// ```
+Element lazy(Requirement hint, std::function<Element()> build) {
+  return MakeNode<Lazy>(hint, std::move(build));
+}
+
+}  // namespace ftxui
@@ -0,0 +1,64 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for allocator, to_string
+
+#include "ftxui/dom/elements.hpp"  // for lazy, text, vbox, yframe, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(LazyTest, OnlyVisibleElementsAreBuilt) {
+  int built = 0;
+  Requirement hint;
+  hint.min_y = 2;
+  Elements sections;
+  for (int i = 0; i < 10; ++i) {
+    sections.push_back(lazy(hint, [&, i] {
+      built++;
+      return vbox({
+          text("a" + std::to_string(i)),
+          text("b" + std::to_string(i)),
+      });
+    }));
+  }
+  auto element = vbox(std::move(sections)) | yframe;
+
+  Screen screen(2, 3);
+  Render(screen, element);
+  EXPECT_EQ(built, 2);
+  EXPECT_EQ(screen.ToString(),
+            "a0\r\n"
+            "b0\r\n"
+            "a1");
+
+  // Drawing it again doesn't build the sections again.
+  Render(screen, element);
+  EXPECT_EQ(built, 2);
+}
+
+TEST(LazyTest, HintedSize) {
+  int built = 0;
+  Requirement hint;
+  hint.min_x = 3;
+  hint.min_y = 1;
+  auto element = hbox({
+      lazy(hint,
+           [&] {
+             built++;
+             return text("abcdef");
+           }),
+      text("|"),
+  });
+  Screen screen(5, 1);
+  Render(screen, element);
+  EXPECT_EQ(built, 1);
+  EXPECT_EQ(screen.ToString(), "abc| ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
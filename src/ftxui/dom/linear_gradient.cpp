@@ -2,19 +2,20 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>                      // for max, min, sort, copy
-#include <cmath>                          // for fmod, cos, sin
+#include <cmath>                          // for fmod, cos, sin, lround
 #include <cstddef>                        // for size_t
 #include <ftxui/dom/linear_gradient.hpp>  // for LinearGradient::Stop, LinearGradient
-#include <memory>    // for allocator_traits<>::value_type, make_shared
+#include <memory>    // for shared_ptr, allocator_traits<>::value_type
 #include <optional>  // for optional, operator!=, operator<
 #include <utility>   // for move
 #include <vector>    // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/color.hpp"   // for Color, Color::Default, Color::Blue
-#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
+#include "ftxui/screen/color.hpp"        // for Color, Color::Default, Color::Blue
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
 
 namespace ftxui {
 namespace {
@@ -93,30 +94,37 @@ LinearGradientNormalized Normalize(LinearGradient gradient) {
   return normalized;
 }
 
-Color Interpolate(const LinearGradientNormalized& gradient, float t) {
-  // Find the right color in the gradient's stops.
-  size_t i = 1;
-  while (true) {
-    if (i > gradient.positions.size()) {
-      const float half = 0.5F;
-      return Color::Interpolate(half, gradient.colors.back(),
-                                gradient.colors.back());
-    }
-    if (t <= gradient.positions[i]) {
-      break;
+// Fill |ramp| with the gradient, sampled evenly from 0 to 1. The samples in
+// between two stops are interpolated at once.
+void Sample(const LinearGradientNormalized& gradient,
+            std::vector<Color>& ramp) {
+  const size_t size = ramp.size();
+  std::vector<float> t(size);
+  size_t begin = 0;
+  for (size_t i = 1; i < gradient.positions.size() && begin < size; ++i) {
+    const float t0 = gradient.positions[i - 1];
+    const float t1 = gradient.positions[i - 0];
+    size_t end = begin;
+    for (; end < size; ++end) {
+      const float position = float(end) / float(size - 1);
+      if (position > t1) {
+        break;
+      }
+      t[end] = (position - t0) / (t1 - t0);
     }
-    ++i;
+    Color::Interpolate(t.data() + begin, end - begin,  //
+                       gradient.colors[i - 1],         //
+                       gradient.colors[i - 0],         //
+                       ramp.data() + begin);
+    begin = end;
   }
 
-  const float t0 = gradient.positions[i - 1];
-  const float t1 = gradient.positions[i - 0];
-  const float tt = (t - t0) / (t1 - t0);
-
-  const Color& c0 = gradient.colors[i - 1];
-  const Color& c1 = gradient.colors[i - 0];
-  const Color& cc = Color::Interpolate(tt, c0, c1);
-
-  return cc;
+  // Past the last stop:
+  for (; begin < size; ++begin) {
+    const float half = 0.5F;
+    ramp[begin] = Color::Interpolate(half, gradient.colors.back(),
+                                     gradient.colors.back());
+  }
 }
 
 class LinearGradientColor : public NodeDecorator {
@@ -144,23 +152,32 @@ class LinearGradientColor : public NodeDecorator {
 
     // Renormalize the projection to [0, 1] using the extent and projective
     // geometry.
-    const float dX = dx / (max - min);
-    const float dY = dy / (max - min);
-    const float dZ = -min / (max - min);
-
-    // Project every pixel to get the color.
-    if (background_color_) {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          const float t = float(x) * dX + float(y) * dY + dZ;
-          screen.PixelAt(x, y).background_color = Interpolate(gradient_, t);
-        }
-      }
-    } else {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          const float t = float(x) * dX + float(y) * dY + dZ;
-          screen.PixelAt(x, y).foreground_color = Interpolate(gradient_, t);
+    // A single cell along the gradient gets its last color.
+    const float range = max - min;
+    const float dX = range > 0.F ? dx / range : 0.F;
+    const float dY = range > 0.F ? dy / range : 0.F;
+    const float dZ = range > 0.F ? -min / range : 1.F;
+
+    // Interpolating a color is costly. Sample the gradient once per box, four
+    // times per cell along its extent, and pick the closest sample per cell.
+    const int extent = (box_.x_max - box_.x_min) + (box_.y_max - box_.y_min);
+    const int size = 1 + 4 * std::max(1, extent);
+    std::vector<Color> ramp(size);
+    Sample(gradient_, ramp);
+
+    // Project every pixel to get the color. The projection is incremented
+    // along the row.
+    const float scale = float(size - 1);
+    const float step = dX * scale;
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      float t = (float(box_.x_min) * dX + float(y) * dY + dZ) * scale;
+      for (int x = box_.x_min; x <= box_.x_max; ++x, t += step) {
+        const int index = std::max(0, std::min(size - 1, int(std::lround(t))));
+        Pixel& pixel = screen.PixelAt(x, y);
+        if (background_color_) {
+          pixel.background_color = ramp[index];
+        } else {
+          pixel.foreground_color = ramp[index];
         }
       }
     }
@@ -245,7 +262,7 @@ LinearGradient& LinearGradient::Stop(Color c) {
 /// color(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element color(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
+  return MakeNode<LinearGradientColor>(std::move(child), gradient,
                                                /*background_color*/ false);
 }
 
@@ -261,7 +278,7 @@ Element color(const LinearGradient& gradient, Element child) {
 /// bgcolor(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element bgcolor(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
+  return MakeNode<LinearGradientColor>(std::move(child), gradient,
                                                /*background_color*/ true);
 }
 
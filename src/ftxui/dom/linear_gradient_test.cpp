@@ -5,7 +5,7 @@
 #include <ftxui/dom/linear_gradient.hpp>  // for LinearGradient::Stop, LinearGradient
 #include <memory>                         // for allocator_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for operator|, text, bgcolor, color, Element
+#include "ftxui/dom/elements.hpp"  // for operator|, text, bgcolor, color, Element, flex, size
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/screen/color.hpp"   // for Color, Color::RedLight, Color::Red
 #include "ftxui/screen/screen.hpp"  // for Screen, Pixel
@@ -87,5 +87,41 @@ TEST(ColorTest, GradientBackground) {
   EXPECT_EQ(screen.PixelAt(4, 0).background_color, gradient_end);
 }
 
+TEST(ColorTest, GradientEveryCell) {
+  auto element = text("") | size(WIDTH, EQUAL, 5) |
+                 bgcolor(LinearGradient(Color::RedLight, Color::Blue));
+  Screen screen(5, 3);
+  Render(screen, element);
+
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 5; ++x) {
+      EXPECT_EQ(screen.PixelAt(x, y).background_color,
+                Color::Interpolate(float(x) / 4.F, Color::RedLight,
+                                   Color::Blue));
+    }
+  }
+}
+
+TEST(ColorTest, GradientDiagonal) {
+  auto element = text("") | flex |
+                 bgcolor(LinearGradient(45, Color::RedLight, Color::Blue));
+  Screen screen(80, 24);
+  Render(screen, element);
+
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color,
+            Color::Interpolate(0, Color::RedLight, Color::Blue));
+  EXPECT_EQ(screen.PixelAt(79, 23).background_color,
+            Color::Interpolate(1, Color::RedLight, Color::Blue));
+}
+
+TEST(ColorTest, GradientSingleCell) {
+  auto element =
+      text("a") | bgcolor(LinearGradient(Color::RedLight, Color::Blue));
+  Screen screen(1, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color,
+            Color::Interpolate(1, Color::RedLight, Color::Blue));
+}
+
 }  // namespace ftxui
 // NOLINTEND
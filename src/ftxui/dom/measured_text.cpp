@@ -0,0 +1,52 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/measured_text.hpp"
+
+#include <memory>         // for shared_ptr, make_shared
+#include <mutex>          // for mutex, lock_guard
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+
+#include "ftxui/screen/string.hpp"  // for string_width, Utf8Glyphs
+
+namespace ftxui {
+
+MeasuredText::MeasuredText(std::string text)
+    : text_(std::move(text)), width_(string_width(text_)) {
+  for (const std::string_view glyph : Utf8Glyphs(text_)) {
+    glyphs_.push_back(glyph);
+  }
+}
+
+/// @brief Measure |text|.
+std::shared_ptr<const MeasuredText> MeasuredText::Make(std::string text) {
+  return std::make_shared<const MeasuredText>(std::move(text));
+}
+
+/// @brief Return the MeasuredText of |text|. It is measured only the first
+/// time, and kept until the end of the program.
+std::shared_ptr<const MeasuredText> MeasuredText::Intern(
+    std::string_view text) {
+  static std::mutex mutex;
+  static auto* table =
+      new std::unordered_map<std::string,
+                             std::shared_ptr<const MeasuredText>>();  // NOLINT
+
+  const std::lock_guard<std::mutex> lock(mutex);
+  auto& entry = (*table)[std::string(text)];
+  if (!entry) {
+    entry = Make(std::string(text));
+  }
+  return entry;
+}
+
+/// @brief Intern |text|. It is measured only the first time.
+InternedString::InternedString(std::string_view text)
+    // The MeasuredText is kept by the table of Intern() until the end of the
+    // program.
+    : text_(MeasuredText::Intern(text).get()) {}
+
+}  // namespace ftxui
@@ -1,23 +1,60 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <algorithm>             // for max, min
+#include <chrono>                // for steady_clock
+#include <cstddef>               // for size_t
 #include <ftxui/screen/box.hpp>  // for Box
+#include <functional>            // for function
+#include <memory>                // for weak_ptr
+#include <string_view>           // for string_view
 #include <utility>               // for move
 
+#include "ftxui/dom/layout_cache.hpp"  // for KeepLayout, TakeLayout
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/parallel.hpp"   // for RenderChildren
 #include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/trace.hpp"   // for FTXUI_TRACE
 
 namespace ftxui {
 
-Node::Node() = default;
-Node::Node(Elements children) : children_(std::move(children)) {}
+namespace {
+thread_local size_t g_nodes_constructed = 0;  // NOLINT
+
+// The element laid out by the last Dimension::Fit, and its box. A weak_ptr, so
+// that a different element allocated at the same address never matches.
+thread_local std::weak_ptr<Node> g_kept_layout;  // NOLINT
+thread_local Box g_kept_layout_box;              // NOLINT
+}  // namespace
+
+void KeepLayout(const Element& element, Box box) {
+  g_kept_layout = element;
+  g_kept_layout_box = box;
+}
+
+bool TakeLayout(const Node* node, Box box) {
+  if (g_kept_layout.expired()) {
+    return false;
+  }
+  const bool kept =
+      g_kept_layout.lock().get() == node && g_kept_layout_box == box;
+  g_kept_layout.reset();
+  return kept;
+}
+
+Node::Node() {
+  ++g_nodes_constructed;
+}
+Node::Node(Elements children) : children_(std::move(children)) {
+  ++g_nodes_constructed;
+}
 Node::~Node() = default;
 
 /// @brief Compute how much space an elements needs.
 /// @ingroup dom
 void Node::ComputeRequirement() {
   for (auto& child : children_) {
-    child->ComputeRequirement();
+    child->UpdateRequirement();
   }
 }
 
@@ -30,18 +67,92 @@ void Node::SetBox(Box box) {
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Node::Render(Screen& screen) {
-  for (auto& child : children_) {
-    child->Render(screen);
-  }
+  RenderChildren(screen, children_);
 }
 
 void Node::Check(Status* status) {
   for (auto& child : children_) {
-    child->Check(status);
+    child->UpdateCheck(status);
   }
   status->need_iteration |= (status->iteration == 0);
 }
 
+/// @brief Compute the requirement, unless the layout of this subtree converged.
+/// @ingroup dom
+void Node::UpdateRequirement() {
+  if (!converged_) {
+    ComputeRequirement();
+  }
+}
+
+/// @brief Assign the box, unless the layout of this subtree converged, in the
+/// same box.
+/// @ingroup dom
+void Node::UpdateBox(Box box) {
+  if (converged_ && box == box_) {
+    return;
+  }
+  converged_ = false;
+  SetBox(box);
+}
+
+/// @brief Check whether this subtree needs another iteration, and remember
+/// when it doesn't. The first iteration starts over.
+/// @ingroup dom
+void Node::UpdateCheck(Status* status) {
+  if (status->iteration == 0) {
+    converged_ = false;
+    Check(status);
+    return;
+  }
+  if (converged_) {
+    return;
+  }
+  const bool need_iteration = status->need_iteration;
+  status->need_iteration = false;
+  Check(status);
+  converged_ = !status->need_iteration;
+  status->need_iteration |= need_iteration;
+}
+
+/// @brief The part of the box of this element it covers entirely.
+/// @ingroup dom
+Box Node::OpaqueBox() const {
+  Box out = {0, -1, 0, -1};
+  int out_area = 0;
+  for (const auto& child : children_) {
+    const Box box = Box::Intersection(child->OpaqueBox(), box_);
+    const int area = std::max(0, box.x_max - box.x_min + 1) *
+                     std::max(0, box.y_max - box.y_min + 1);
+    if (area > out_area) {
+      out = box;
+      out_area = area;
+    }
+  }
+  return out;
+}
+
+/// @brief Add this element and its children to |usage|. The elements owning
+/// more than their base Node add the difference.
+/// @ingroup dom
+void Node::MemoryUsage(ElementMemory* usage) const {
+  usage->nodes++;
+  usage->bytes += sizeof(Node) + children_.capacity() * sizeof(Element);
+  for (const auto& child : children_) {
+    child->MemoryUsage(usage);
+  }
+}
+
+/// @brief The number of nodes of |element|, and the bytes they use.
+/// @ingroup dom
+ElementMemory MemoryUsage(const Element& element) {
+  ElementMemory usage;
+  if (element) {
+    element->MemoryUsage(&usage);
+  }
+  return usage;
+}
+
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, const Element& element) {
@@ -51,16 +162,34 @@ void Render(Screen& screen, const Element& element) {
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, Node* node) {
+  Render(screen, node, nullptr);
+}
+
+/// @brief Display an element on a ftxui::Screen, and measure how long each
+/// step takes.
+/// @param screen The screen to draw on.
+/// @param node The element to draw.
+/// @param stats Where to record the measures. Nothing is measured when null.
+/// @ingroup dom
+void Render(Screen& screen, Node* node, RenderStats* stats) {
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start = stats ? Clock::now() : Clock::time_point();
+
   Box box;
   box.x_min = 0;
   box.y_min = 0;
   box.x_max = screen.dimx() - 1;
   box.y_max = screen.dimy() - 1;
 
+  // Skip the layout when Dimension::Fit already computed it in this box.
   Node::Status status;
-  node->Check(&status);
+  if (!TakeLayout(node, box)) {
+    node->Check(&status);
+  }
   const int max_iterations = 20;
   while (status.need_iteration && status.iteration < max_iterations) {
+    FTXUI_TRACE("Layout");
+
     // Step 1: Find what dimension this elements wants to be.
     node->ComputeRequirement();
 
@@ -73,12 +202,97 @@ void Render(Screen& screen, Node* node) {
     node->Check(&status);
   }
 
+  Clock::time_point layout_end;
+  if (stats) {
+    layout_end = Clock::now();
+    stats->layout_iterations = status.iteration;
+    stats->layout = layout_end - start;
+  }
+
   // Step 3: Draw the element.
-  screen.stencil = box;
-  node->Render(screen);
+  {
+    FTXUI_TRACE("Draw elements");
+    screen.stencil = box;
+    node->Render(screen);
+  }
+
+  Clock::time_point draw_end;
+  if (stats) {
+    draw_end = Clock::now();
+    stats->draw = draw_end - layout_end;
+  }
 
   // Step 4: Apply shaders
   screen.ApplyShader();
+
+  if (stats) {
+    stats->shader = Clock::now() - draw_end;
+  }
+}
+
+/// @brief Render |element| over |dimx| columns, as tall as it requires, and
+/// stream it to |sink| like Screen::ToString(sink).
+///
+/// The element is laid out once. It is then drawn in bands of |band_rows|
+/// rows, each serialized before drawing the next one. Only the nodes
+/// overlapping a band are drawn into it. The memory used doesn't grow with the
+/// height of the element, which is useful for printing huge static reports.
+/// @param element The element to draw.
+/// @param dimx The number of columns.
+/// @param band_rows The number of rows drawn at once.
+/// @param sink Called with every consecutive chunk.
+/// @ingroup dom
+void RenderTiled(const Element& element,
+                 int dimx,
+                 int band_rows,
+                 const std::function<void(std::string_view)>& sink) {
+  // Step 1 and 2: Lay out the element, as tall as it requires.
+  Box box;
+  box.x_min = 0;
+  box.y_min = 0;
+  box.x_max = dimx - 1;
+  box.y_max = -1;
+  Node::Status status;
+  element->Check(&status);
+  const int max_iterations = 20;
+  while (status.need_iteration && status.iteration < max_iterations) {
+    element->ComputeRequirement();
+    box.y_max = element->requirement().min_y - 1;
+    element->SetBox(box);
+    status.need_iteration = false;
+    status.iteration++;
+    element->Check(&status);
+  }
+  const int dimy = box.y_max + 1;
+
+  // Step 3: Draw the bands. They are drawn with a row of margin above and
+  // below, so that the borders crossing them still merge with their
+  // neighbors.
+  band_rows = std::max(band_rows, 1);
+  Screen band(dimx, band_rows + 2);
+  for (int y = 0; y < dimy; y += band_rows) {
+    if (y != 0) {
+      sink("\r\n");
+    }
+    // Move the element, so that the row |y| is drawn in the row 1 of the band.
+    Box shifted = box;
+    shifted.y_min -= y - 1;
+    shifted.y_max -= y - 1;
+    element->SetBox(shifted);
+
+    band.Clear();
+    band.stencil = Box{0, dimx - 1, 0, band.dimy() - 1};
+    element->Render(band);
+    band.ApplyShader();
+    band.ToString(sink, 1, 1 + std::min(band_rows, dimy - y));
+  }
+}
+
+/// @brief The number of nodes constructed by the calling thread so far. The
+/// difference between two calls tells how many elements were built in between.
+/// @ingroup dom
+size_t NodesConstructed() {
+  return g_nodes_constructed;
 }
 
 }  // namespace ftxui
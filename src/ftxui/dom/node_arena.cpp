@@ -0,0 +1,123 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/node_arena.hpp"
+
+#include <algorithm>  // for max
+#include <atomic>     // for atomic, memory_order_relaxed, memory_order_acq_rel
+#include <cstddef>    // for size_t
+#include <memory>     // for unique_ptr, align
+#include <vector>     // for vector
+
+namespace ftxui {
+
+namespace {
+thread_local NodeArena* g_current_arena = nullptr;  // NOLINT
+constexpr size_t kBlockSize = 64 * 1024;
+}  // namespace
+
+class NodeArena::Buffer {
+ public:
+  void* Allocate(size_t size, size_t alignment) {
+    // Allocations only happen on the thread of the Scope, while the arena
+    // holds its reference: no ordering is needed.
+    references_.fetch_add(1, std::memory_order_relaxed);
+    while (true) {
+      if (block_ < blocks_.size()) {
+        Block& block = blocks_[block_];
+        void* ptr = block.data.get() + used_;
+        size_t space = block.size - used_;
+        if (std::align(alignment, size, ptr, space)) {
+          used_ = block.size - space + size;
+          return ptr;
+        }
+        ++block_;
+        used_ = 0;
+        continue;
+      }
+
+      const size_t block_size = std::max(kBlockSize, size + alignment);
+      blocks_.push_back({std::unique_ptr<char[]>(new char[block_size]),  // NOLINT
+                         block_size});
+      block_ = blocks_.size() - 1;
+      used_ = 0;
+    }
+  }
+
+  // Reuse the blocks. Must only be called when nothing is allocated.
+  void Rewind() {
+    block_ = 0;
+    used_ = 0;
+  }
+
+  // Whether the arena holds the only reference.
+  bool Unused() const {
+    return references_.load(std::memory_order_acquire) == 1;
+  }
+
+  // Release a reference, from any thread. Delete the buffer with the last one.
+  void Release() {
+    if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;  // NOLINT
+    }
+  }
+
+ private:
+  struct Block {
+    std::unique_ptr<char[]> data;  // NOLINT
+    size_t size;
+  };
+  std::vector<Block> blocks_;
+  size_t block_ = 0;  // The block currently allocated from.
+  size_t used_ = 0;   // The number of bytes used in the current block.
+  std::atomic<size_t> references_{1};  // The arena, and the allocations.
+};
+
+NodeArena::NodeArena() = default;
+
+NodeArena::~NodeArena() {
+  if (buffer_) {
+    buffer_->Release();
+  }
+}
+
+// static
+void* NodeArena::Allocate(Buffer& buffer, size_t size, size_t alignment) {
+  return buffer.Allocate(size, alignment);
+}
+
+// static
+void NodeArena::Deallocate(Buffer& buffer) {
+  buffer.Release();
+}
+
+// static
+NodeArena* NodeArena::Current() {
+  return g_current_arena;
+}
+
+void NodeArena::Reuse() {
+  // The Nodes allocated previously are still referenced. Let them own the
+  // previous buffer and start a new one.
+  if (!buffer_ || !buffer_->Unused()) {
+    if (buffer_) {
+      buffer_->Release();
+    }
+    buffer_ = new Buffer();  // NOLINT
+    return;
+  }
+  buffer_->Rewind();
+}
+
+NodeArena::Scope::Scope(NodeArena* arena) : previous_(g_current_arena) {
+  if (arena && arena != previous_) {
+    arena->Reuse();
+  }
+  g_current_arena = arena;
+}
+
+NodeArena::Scope::~Scope() {
+  g_current_arena = previous_;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,86 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for allocator
+
+#include "ftxui/dom/elements.hpp"    // for text, hbox, border, Element
+#include "ftxui/dom/node.hpp"        // for Render
+#include "ftxui/dom/node_arena.hpp"  // for NodeArena
+#include "ftxui/screen/screen.hpp"   // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(NodeArenaTest, Render) {
+  NodeArena arena;
+  NodeArena::Scope scope(&arena);
+  EXPECT_EQ(NodeArena::Current(), &arena);
+  auto element = hbox({text("a"), text("b")}) | border;
+  Screen screen(4, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "╭──╮\r\n"
+            "│ab│\r\n"
+            "╰──╯");
+}
+
+TEST(NodeArenaTest, NoArena) {
+  EXPECT_EQ(NodeArena::Current(), nullptr);
+  NodeArena arena;
+  NodeArena::Scope scope(&arena);
+  {
+    NodeArena::Scope inner(nullptr);
+    EXPECT_EQ(NodeArena::Current(), nullptr);
+  }
+  EXPECT_EQ(NodeArena::Current(), &arena);
+}
+
+TEST(NodeArenaTest, MemoryReused) {
+  NodeArena arena;
+  Node* first = nullptr;
+  {
+    NodeArena::Scope scope(&arena);
+    first = text("first").get();
+  }
+  {
+    NodeArena::Scope scope(&arena);
+    auto second = text("second");
+    EXPECT_EQ(second.get(), first);
+  }
+}
+
+TEST(NodeArenaTest, ElementOutliveScope) {
+  NodeArena arena;
+  Element kept;
+  {
+    NodeArena::Scope scope(&arena);
+    kept = text("kept");
+  }
+  {
+    NodeArena::Scope scope(&arena);
+    auto other = text("other");
+    EXPECT_NE(other.get(), kept.get());
+  }
+  Screen screen(4, 1);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(), "kept");
+}
+
+TEST(NodeArenaTest, ElementOutliveArena) {
+  Element kept;
+  {
+    NodeArena arena;
+    NodeArena::Scope scope(&arena);
+    kept = hbox({text("a"), text("b")}) | border;
+  }
+  Screen screen(4, 3);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(),
+            "╭──╮\r\n"
+            "│ab│\r\n"
+            "╰──╯");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -18,7 +18,7 @@ void NodeDecorator::ComputeRequirement() {
 
 void NodeDecorator::SetBox(Box box) {
   Node::SetBox(box);
-  children_[0]->SetBox(box);
+  children_[0]->UpdateBox(box);
 }
 
 }  // namespace ftxui
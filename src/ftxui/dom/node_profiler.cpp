@@ -0,0 +1,180 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/node_profiler.hpp"
+
+#include <algorithm>  // for sort, max
+#include <cstdlib>    // for free
+#include <string>     // for string, to_string
+#include <typeinfo>   // for type_info
+#include <vector>     // for vector
+
+#if defined(__GNUG__)
+#include <cxxabi.h>  // for __cxa_demangle
+#endif
+
+namespace ftxui {
+
+namespace {
+thread_local NodeProfiler* g_current_profiler = nullptr;  // NOLINT
+
+void Erase(std::string& name, const std::string& pattern) {
+  size_t position = 0;
+  while ((position = name.find(pattern, position)) != std::string::npos) {
+    name.erase(position, pattern.size());
+  }
+}
+
+// The name of a type, from std::type_info::name(), without the namespaces of
+// FTXUI.
+std::string TypeName(const char* mangled) {
+  std::string name = mangled;
+#if defined(__GNUG__)
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+  if (status == 0) {
+    name = demangled;
+  }
+  std::free(demangled);  // NOLINT
+#endif
+  Erase(name, "class ");
+  Erase(name, "struct ");
+  Erase(name, "ftxui::");
+  Erase(name, "(anonymous namespace)::");
+  Erase(name, "`anonymous namespace'::");
+  return name;
+}
+
+void Add(NodeProfiler::Count& count, size_t bytes) {
+  ++count.nodes;
+  count.bytes += bytes;
+}
+
+// Sort by decreasing bytes, then by name.
+void Sort(std::vector<NodeProfiler::Entry>& entries) {
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+    if (a.count.bytes != b.count.bytes) {
+      return a.count.bytes > b.count.bytes;
+    }
+    return a.name < b.name;
+  });
+}
+
+void Print(std::string& out,
+           const std::string& title,
+           const std::vector<NodeProfiler::Entry>& entries,
+           int frames) {
+  // The Nodes created outside of any Label.
+  auto name = [](const NodeProfiler::Entry& entry) {
+    return entry.name.empty() ? std::string("(none)") : entry.name;
+  };
+  size_t width = title.size();
+  for (const auto& entry : entries) {
+    width = std::max(width, name(entry).size());
+  }
+  auto column = [](std::string value, size_t size) {
+    if (value.size() < size) {
+      value.insert(0, size - value.size(), ' ');
+    }
+    return value;
+  };
+  out += title + std::string(width - title.size(), ' ');
+  out += column("nodes", 12) + column("bytes", 12) + column("bytes/frame", 14);
+  out += "\n";
+  for (const auto& entry : entries) {
+    out += name(entry) + std::string(width - name(entry).size(), ' ');
+    out += column(std::to_string(entry.count.nodes), 12);
+    out += column(std::to_string(entry.count.bytes), 12);
+    const size_t bytes_per_frame = entry.count.bytes / size_t(std::max(frames, 1));
+    out += column(std::to_string(bytes_per_frame), 14);
+    out += "\n";
+  }
+}
+
+}  // namespace
+
+NodeProfiler::NodeProfiler() : label_(&by_label_[""]) {}
+
+NodeProfiler::Scope::Scope(NodeProfiler* profiler)
+    : previous_(g_current_profiler) {
+  g_current_profiler = profiler;
+  if (profiler && profiler != previous_) {
+    profiler->last_frame_ = Count();
+    ++profiler->frames_;
+  }
+}
+
+NodeProfiler::Scope::~Scope() {
+  g_current_profiler = previous_;
+}
+
+NodeProfiler::Label::Label(const std::string& name)
+    : profiler_(g_current_profiler) {
+  if (profiler_) {
+    previous_ = profiler_->label_;
+    profiler_->label_ = &profiler_->by_label_[name];
+  }
+}
+
+NodeProfiler::Label::~Label() {
+  if (profiler_) {
+    profiler_->label_ = previous_;
+  }
+}
+
+// static
+NodeProfiler* NodeProfiler::Current() {
+  return g_current_profiler;
+}
+
+void NodeProfiler::Record(const std::type_info& type, size_t bytes) {
+  Add(by_type_[type], bytes);
+  Add(*label_, bytes);
+  Add(total_, bytes);
+  Add(last_frame_, bytes);
+}
+
+std::vector<NodeProfiler::Entry> NodeProfiler::ByType() const {
+  std::vector<Entry> entries;
+  for (const auto& [type, count] : by_type_) {
+    entries.push_back({TypeName(type.name()), count});
+  }
+  Sort(entries);
+  return entries;
+}
+
+std::vector<NodeProfiler::Entry> NodeProfiler::ByLabel() const {
+  std::vector<Entry> entries;
+  for (const auto& [name, count] : by_label_) {
+    if (count.nodes) {
+      entries.push_back({name, count});
+    }
+  }
+  Sort(entries);
+  return entries;
+}
+
+void NodeProfiler::Clear() {
+  by_type_.clear();
+  for (auto& [name, count] : by_label_) {
+    count = Count();
+  }
+  total_ = Count();
+  last_frame_ = Count();
+  frames_ = 0;
+}
+
+/// @brief Return the counts by type of Node and by label, in a table.
+std::string NodeProfiler::ToString() const {
+  std::string out;
+  Print(out, "type", ByType(), frames_);
+  out += "\n";
+  Print(out, "label", ByLabel(), frames_);
+  out += "\n";
+  out += "total: " + std::to_string(total_.nodes) + " nodes, " +
+         std::to_string(total_.bytes) + " bytes, " + std::to_string(frames_) +
+         " frames\n";
+  return out;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,121 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/dom/elements.hpp"       // for text, hbox, border, Element
+#include "ftxui/dom/node_arena.hpp"     // for NodeArena
+#include "ftxui/dom/node_profiler.hpp"  // for NodeProfiler
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+NodeProfiler::Count Find(const std::vector<NodeProfiler::Entry>& entries,
+                         const std::string& name) {
+  for (const auto& entry : entries) {
+    if (entry.name == name) {
+      return entry.count;
+    }
+  }
+  return {};
+}
+
+}  // namespace
+
+TEST(NodeProfilerTest, ByType) {
+  NodeProfiler profiler;
+  {
+    NodeProfiler::Scope scope(&profiler);
+    EXPECT_EQ(NodeProfiler::Current(), &profiler);
+    auto element = hbox({text("a"), text("b")}) | border;
+  }
+  EXPECT_EQ(NodeProfiler::Current(), nullptr);
+  auto ignored = text("not recorded");
+
+  EXPECT_EQ(profiler.frames(), 1);
+  EXPECT_EQ(profiler.total().nodes, 4u);
+  EXPECT_EQ(profiler.last_frame().nodes, 4u);
+
+  const auto by_type = profiler.ByType();
+  ASSERT_EQ(by_type.size(), 3u);
+  EXPECT_EQ(Find(by_type, "Text").nodes, 2u);
+  EXPECT_EQ(Find(by_type, "HBox").nodes, 1u);
+  EXPECT_EQ(Find(by_type, "Border").nodes, 1u);
+  EXPECT_GT(Find(by_type, "Text").bytes, 0u);
+
+  size_t bytes = 0;
+  for (const auto& entry : by_type) {
+    bytes += entry.count.bytes;
+  }
+  EXPECT_EQ(bytes, profiler.total().bytes);
+}
+
+TEST(NodeProfilerTest, Label) {
+  NodeProfiler profiler;
+  NodeProfiler::Scope scope(&profiler);
+  auto a = text("a");
+  {
+    NodeProfiler::Label outer("outer");
+    auto b = text("b");
+    {
+      NodeProfiler::Label inner("inner");
+      auto c = text("c");
+      auto d = text("d");
+    }
+    auto e = text("e");
+  }
+
+  const auto by_label = profiler.ByLabel();
+  ASSERT_EQ(by_label.size(), 3u);
+  EXPECT_EQ(by_label[0].name, "inner");
+  EXPECT_EQ(Find(by_label, "inner").nodes, 2u);
+  EXPECT_EQ(Find(by_label, "outer").nodes, 2u);
+  EXPECT_EQ(Find(by_label, "").nodes, 1u);
+}
+
+TEST(NodeProfilerTest, Frames) {
+  NodeProfiler profiler;
+  for (int i = 0; i < 3; ++i) {
+    NodeProfiler::Scope scope(&profiler);
+    NodeProfiler::Scope nested(&profiler);  // Not a new frame.
+    auto element = text("a");
+  }
+  EXPECT_EQ(profiler.frames(), 3);
+  EXPECT_EQ(profiler.total().nodes, 3u);
+  EXPECT_EQ(profiler.last_frame().nodes, 1u);
+
+  profiler.Clear();
+  EXPECT_EQ(profiler.frames(), 0);
+  EXPECT_EQ(profiler.total().nodes, 0u);
+  EXPECT_TRUE(profiler.ByType().empty());
+  EXPECT_TRUE(profiler.ByLabel().empty());
+}
+
+TEST(NodeProfilerTest, Arena) {
+  NodeArena arena;
+  NodeProfiler profiler;
+  NodeArena::Scope arena_scope(&arena);
+  NodeProfiler::Scope profiler_scope(&profiler);
+  auto element = hbox({text("a"), text("b")});
+  EXPECT_EQ(profiler.total().nodes, 3u);
+  EXPECT_GT(profiler.total().bytes, 0u);
+}
+
+TEST(NodeProfilerTest, ToString) {
+  NodeProfiler profiler;
+  {
+    NodeProfiler::Scope scope(&profiler);
+    NodeProfiler::Label label("sidebar");
+    auto element = text("a");
+  }
+  const std::string report = profiler.ToString();
+  EXPECT_NE(report.find("Text"), std::string::npos);
+  EXPECT_NE(report.find("sidebar"), std::string::npos);
+  EXPECT_NE(report.find("total: 1 nodes"), std::string::npos);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,135 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>       // for make_shared
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/dom/elements.hpp"   // for text, border, separator, reflect
+#include "ftxui/dom/node.hpp"       // for Node, Render, RenderTiled
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Element Report() {
+  Elements lines;
+  for (int i = 0; i < 100; ++i) {
+    lines.push_back(text("line " + std::to_string(i)));
+    if (i % 10 == 9) {
+      lines.push_back(separator());
+    }
+  }
+  return vbox(std::move(lines)) | border;
+}
+
+// A leaf counting the times it is laid out.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : count_(count) {}
+  void ComputeRequirement() override {
+    (*count_)++;
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+
+ private:
+  int* count_;
+};
+
+// A custom node drawing its child with Render(), offset by one column.
+class Indent : public Node {
+ public:
+  explicit Indent(Element child) : Node({std::move(child)}) {}
+  void ComputeRequirement() override {
+    children_[0]->ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+    requirement_.min_x++;
+  }
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    box.x_min++;
+    children_[0]->SetBox(box);
+  }
+  void Render(Screen& screen) override { children_[0]->Render(screen); }
+};
+
+}  // namespace
+
+TEST(NodeTest, RenderTiled) {
+  auto element = Report();
+  Screen screen(12, 112);
+  Render(screen, element);
+  const std::string expected = screen.ToString();
+
+  // The bands are printed like a single screen, whatever their height. The
+  // borders and the separators still merge across them.
+  for (int band_rows : {1, 7, 50, 112, 500}) {
+    std::string output;
+    RenderTiled(Report(), 12, band_rows,
+                [&](std::string_view chunk) { output += chunk; });
+    EXPECT_EQ(output, expected) << band_rows;
+  }
+}
+
+TEST(NodeTest, OnlyUnconvergedSubtreesIterate) {
+  int count = 0;
+  auto element = vbox({
+      paragraph("a paragraph, wrapped over several lines"),
+      hbox({std::make_shared<Counter>(&count), text("sibling")}),
+  });
+  Screen screen(10, 6);
+  RenderStats stats;
+  Render(screen, element.get(), &stats);
+  EXPECT_EQ(stats.layout_iterations, 2);
+
+  // The paragraph is laid out again, once given its width. The sibling
+  // converged in the first iteration, and is skipped by the second one.
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(screen.ToString(),
+            "a         \r\n"
+            "paragraph,\r\n"
+            "wrapped   \r\n"
+            "over      \r\n"
+            "several   \r\n"
+            "lines     ");
+}
+
+TEST(NodeTest, ReflectInCustomNode) {
+  Box box;
+  Element element = std::make_shared<Indent>(text("text") | reflect(box));
+  Screen screen(6, 1);
+  Render(screen, element);
+  EXPECT_EQ(box, (Box{1, 5, 0, 0}));
+  EXPECT_EQ(screen.ToString(), " text ");
+}
+
+TEST(NodeTest, MemoryUsage) {
+  EXPECT_EQ(MemoryUsage(nullptr).nodes, 0u);
+
+  const std::string long_text(100, 'a');
+  auto element = vbox({
+      text("short"),
+      text(long_text),
+      paragraph(long_text),
+      textView(long_text),
+  });
+  const ElementMemory usage = MemoryUsage(element);
+  EXPECT_EQ(usage.nodes, 5u);
+
+  // The views don't own their text.
+  EXPECT_EQ(usage.strings, 205u);
+  EXPECT_GE(usage.bytes, 5 * sizeof(Node) + usage.strings);
+
+  // The decorators are counted.
+  EXPECT_EQ(MemoryUsage(element | border | bold).nodes, 7u);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,25 +1,259 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <sstream>  // for basic_istream, stringstream
-#include <string>   // for string, allocator, getline
-#include <utility>  // for move
+#include <algorithm>    // for max, min
+#include <cstddef>      // for size_t
+#include <string>       // for string, allocator
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
 
-#include "ftxui/dom/elements.hpp"  // for flexbox, Element, text, Elements, operator|, xflex, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
-#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::JustifyContent, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/elements.hpp"  // for Element, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight, paragraphView
+#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig::JustifyContent, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/node.hpp"            // for Node, Node::Status
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
+#include "ftxui/dom/requirement.hpp"     // for Requirement
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Screen
+#include "ftxui/screen/string.hpp"       // for string_width, Utf8Glyphs
+#include "ftxui/screen/string_internal.hpp"  // for StringHeapBytes
 
 namespace ftxui {
 
 namespace {
-Elements Split(const std::string& the_text) {
-  Elements output;
-  std::stringstream ss(the_text);
-  std::string word;
-  while (std::getline(ss, word, ' ')) {
-    output.push_back(text(word));
+
+using JustifyContent = FlexboxConfig::JustifyContent;
+
+// The words are laid out the same way `flexbox` lays out one `text` per word,
+// with a gap of one cell, but without building any Node.
+class Paragraph : public Node {
+ public:
+  Paragraph(std::string text, JustifyContent justify_content)
+      : owned_(std::move(text)),
+        text_(owned_),
+        justify_content_(justify_content) {
+    Split();
   }
-  return output;
-}
+
+  Paragraph(std::string_view text, JustifyContent justify_content)
+      : text_(text), justify_content_(justify_content) {
+    Split();
+  }
+
+  void ComputeRequirement() override {
+    Layout(asked_, /*requirement=*/true);
+
+    requirement_.min_x = 0;
+    requirement_.min_y = int(lines_.size());
+    for (const Word& word : words_) {
+      requirement_.min_x = std::max(requirement_.min_x, word.x + word.dim);
+    }
+  }
+
+  void MemoryUsage(ElementMemory* usage) const override {
+    Node::MemoryUsage(usage);
+    usage->bytes += sizeof(Paragraph) - sizeof(Node);
+    usage->bytes += StringHeapBytes(owned_);
+    usage->bytes += words_.capacity() * sizeof(Word);
+    usage->bytes += lines_.capacity() * sizeof(Line);
+    usage->strings += owned_.size();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    const int width = box.x_max - box.x_min + 1;
+    const int asked_previous = asked_;
+    asked_ = std::min(asked_, width);
+    need_iteration_ = (asked_ != asked_previous);
+
+    Layout(width, /*requirement=*/false);
+  }
+
+  void Check(Status* status) override {
+    if (status->iteration == 0) {
+      asked_ = 6000;  // NOLINT
+      need_iteration_ = true;
+    }
+    status->need_iteration |= need_iteration_;
+  }
+
+  void Render(Screen& screen) override {
+    for (size_t i = 0; i < lines_.size(); ++i) {
+      const int y = box_.y_min + int(i);
+      if (y > box_.y_max) {
+        return;
+      }
+      for (size_t w = lines_[i].begin; w < lines_[i].end; ++w) {
+        const Word& word = words_[w];
+        int x = box_.x_min + word.x;
+        const int x_max = std::min(box_.x_max, x + word.dim - 1);
+        const std::string_view view = text_.substr(word.start, word.size);
+        for (const std::string_view cell : Utf8Glyphs(view)) {
+          if (x > x_max) {
+            break;
+          }
+          if (cell == "\n") {
+            continue;
+          }
+          screen.PixelAt(x, y).character = cell;
+          ++x;
+        }
+      }
+    }
+  }
+
+ private:
+  struct Word {
+    size_t start;
+    size_t size;
+    int width;
+    bool grow = false;  // Whether it takes the remaining space of its line.
+    int x = 0;
+    int dim = 0;
+  };
+
+  struct Line {
+    size_t begin;
+    size_t end;
+  };
+
+  // Split the text into words, and measure them.
+  void Split() {
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 0;
+
+    size_t start = 0;
+    while (start < text_.size()) {
+      size_t end = text_.find(' ', start);
+      if (end == std::string_view::npos) {
+        end = text_.size();
+      }
+      words_.push_back({
+          start,
+          end - start,
+          string_width(text_.substr(start, end - start)),
+      });
+      start = end + 1;
+    }
+
+    // A justified paragraph ends with an empty word taking the remaining
+    // space, so that its last line stays aligned on the left.
+    if (justify_content_ == JustifyContent::SpaceBetween) {
+      words_.push_back({text_.size(), 0, 0, true});
+    }
+  }
+
+  // Break the words into lines of |width| cells, and place them. The result is
+  // reused, as long as the width and the kind of layout are the same.
+  void Layout(int width, bool requirement) {
+    if (width == layout_width_ && requirement == layout_requirement_) {
+      return;
+    }
+    layout_width_ = width;
+    layout_requirement_ = requirement;
+
+    // Break the lines.
+    lines_.clear();
+    size_t begin = 0;
+    int x = 0;
+    for (size_t i = 0; i < words_.size(); ++i) {
+      if (x + words_[i].width > width) {
+        x = 0;
+        if (i != begin) {
+          lines_.push_back({begin, i});
+          begin = i;
+        }
+      }
+      x += words_[i].width + 1;
+    }
+    if (begin != words_.size()) {
+      lines_.push_back({begin, words_.size()});
+    }
+
+    for (const Line& line : lines_) {
+      PlaceLine(line, width, requirement);
+    }
+  }
+
+  // Distribute the line between its words, as `box_helper::Compute` does,
+  // then align them.
+  void PlaceLine(const Line& line, int width, bool requirement) {
+    int size = 0;
+    bool grow = false;
+    for (size_t i = line.begin; i < line.end; ++i) {
+      size += words_[i].width;
+      grow |= words_[i].grow && !requirement;
+    }
+    int extra_space = width - int(line.end - line.begin - 1) - size;
+    for (size_t i = line.begin; i < line.end; ++i) {
+      Word& word = words_[i];
+      if (extra_space >= 0) {
+        word.dim = word.width;
+        if (word.grow && grow) {
+          word.dim += extra_space;
+        }
+        continue;
+      }
+      // The line is too small. The words are shrunk proportionally:
+      const int added_space = extra_space * word.width / std::max(1, size);
+      extra_space -= added_space;
+      size -= word.width;
+      word.dim = word.width + added_space;
+    }
+
+    int x = 0;
+    for (size_t i = line.begin; i < line.end; ++i) {
+      words_[i].x = x;
+      x += words_[i].dim + 1;
+    }
+
+    if (requirement) {
+      return;
+    }
+    const Word& last = words_[line.end - 1];
+    int remaining_space = width - last.x - last.dim;
+    switch (justify_content_) {
+      case JustifyContent::FlexEnd: {
+        for (size_t i = line.begin; i < line.end; ++i) {
+          words_[i].x += remaining_space;
+        }
+        break;
+      }
+
+      case JustifyContent::Center: {
+        for (size_t i = line.begin; i < line.end; ++i) {
+          words_[i].x += remaining_space / 2;
+        }
+        break;
+      }
+
+      case JustifyContent::SpaceBetween: {
+        for (int i = int(line.end - line.begin) - 1; i >= 1; --i) {
+          words_[line.begin + i].x += remaining_space;
+          remaining_space = remaining_space * (i - 1) / i;
+        }
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+
+  const std::string owned_;
+  const std::string_view text_;  // Either |owned_|, or owned by the caller.
+  const JustifyContent justify_content_;
+  std::vector<Word> words_;
+  std::vector<Line> lines_;
+
+  int layout_width_ = -1;
+  bool layout_requirement_ = false;
+
+  int asked_ = 6000;  // NOLINT
+  bool need_iteration_ = true;
+};
+
 }  // namespace
 
 /// @brief Return an element drawing the paragraph on multiple lines.
@@ -34,8 +268,7 @@ Element paragraph(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignLeft(const std::string& the_text) {
-  static const auto config = FlexboxConfig().SetGap(1, 0);
-  return flexbox(Split(the_text), config);
+  return MakeNode<Paragraph>(the_text, JustifyContent::FlexStart);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
@@ -43,9 +276,7 @@ Element paragraphAlignLeft(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignRight(const std::string& the_text) {
-  static const auto config =
-      FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::FlexEnd);
-  return flexbox(Split(the_text), config);
+  return MakeNode<Paragraph>(the_text, JustifyContent::FlexEnd);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
@@ -53,9 +284,7 @@ Element paragraphAlignRight(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignCenter(const std::string& the_text) {
-  static const auto config =
-      FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::Center);
-  return flexbox(Split(the_text), config);
+  return MakeNode<Paragraph>(the_text, JustifyContent::Center);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned
@@ -64,11 +293,16 @@ Element paragraphAlignCenter(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignJustify(const std::string& the_text) {
-  static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-      FlexboxConfig::JustifyContent::SpaceBetween);
-  Elements words = Split(the_text);
-  words.push_back(text("") | xflex);
-  return flexbox(std::move(words), config);
+  return MakeNode<Paragraph>(the_text, JustifyContent::SpaceBetween);
+}
+
+/// @brief Return an element drawing the paragraph on multiple lines, aligned on
+/// the left, without copying it. The text must outlive the rendering of the
+/// element.
+/// @ingroup dom
+/// @see paragraph.
+Element paragraphView(std::string_view the_text) {
+  return MakeNode<Paragraph>(the_text, JustifyContent::FlexStart);
 }
 
 }  // namespace ftxui
@@ -0,0 +1,97 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/dom/elements.hpp"  // for paragraph, paragraphView, flexbox, text, vbox, border
+#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig
+#include "ftxui/dom/node.hpp"            // for Render
+#include "ftxui/screen/screen.hpp"       // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// The paragraph, as it used to be built: one `text` per word, inside a
+// `flexbox`.
+Element Reference(const std::string& the_text,
+                  FlexboxConfig::JustifyContent justify_content) {
+  Elements words;
+  size_t start = 0;
+  while (start < the_text.size()) {
+    size_t end = the_text.find(' ', start);
+    if (end == std::string::npos) {
+      end = the_text.size();
+    }
+    words.push_back(text(the_text.substr(start, end - start)));
+    start = end + 1;
+  }
+  if (justify_content == FlexboxConfig::JustifyContent::SpaceBetween) {
+    words.push_back(text("") | xflex);
+  }
+  return flexbox(std::move(words),
+                 FlexboxConfig().SetGap(1, 0).Set(justify_content));
+}
+
+std::string Draw(Element element, int width) {
+  auto document = vbox({std::move(element), text("end")}) | border;
+  Screen screen(width, 12);
+  Render(screen, document);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(ParagraphTest, Basic) {
+  Screen screen(10, 3);
+  Render(screen, paragraph("Lorem ipsum dolor sit amet"));
+  EXPECT_EQ(screen.ToString(),
+            "Lorem     \r\n"
+            "ipsum     \r\n"
+            "dolor sit ");
+}
+
+TEST(ParagraphTest, View) {
+  const std::string buffer = "Lorem ipsum dolor sit amet";
+  Screen screen(10, 3);
+  Render(screen, paragraphView(buffer));
+  EXPECT_EQ(screen.ToString(),
+            "Lorem     \r\n"
+            "ipsum     \r\n"
+            "dolor sit ");
+}
+
+TEST(ParagraphTest, SameAsFlexbox) {
+  const std::string texts[] = {
+      "",
+      "a",
+      "Lorem ipsum dolor sit amet, consectetur adipiscing elit.",
+      "a  b   c    d",
+      "averyveryverylongword short",
+      "测试 full width 测试测试",
+      "end with space ",
+  };
+  const FlexboxConfig::JustifyContent justify_contents[] = {
+      FlexboxConfig::JustifyContent::FlexStart,
+      FlexboxConfig::JustifyContent::FlexEnd,
+      FlexboxConfig::JustifyContent::Center,
+      FlexboxConfig::JustifyContent::SpaceBetween,
+  };
+  for (const auto& t : texts) {
+    for (int width = 3; width < 30; ++width) {
+      EXPECT_EQ(Draw(paragraphAlignLeft(t), width),
+                Draw(Reference(t, justify_contents[0]), width));
+      EXPECT_EQ(Draw(paragraphAlignRight(t), width),
+                Draw(Reference(t, justify_contents[1]), width));
+      EXPECT_EQ(Draw(paragraphAlignCenter(t), width),
+                Draw(Reference(t, justify_contents[2]), width));
+      EXPECT_EQ(Draw(paragraphAlignJustify(t), width),
+                Draw(Reference(t, justify_contents[3]), width));
+    }
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
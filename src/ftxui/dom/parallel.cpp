@@ -0,0 +1,183 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/parallel.hpp"
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr
+#include <utility>  // for move
+#include <vector>   // for vector
+
+#include "ftxui/dom/elements.hpp"        // for Element, parallel
+#include "ftxui/dom/node.hpp"            // for Node, Elements
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Screen, Pixel
+#include "ftxui/screen/thread_pool.hpp"  // for Run
+
+namespace ftxui {
+
+namespace {
+
+class Parallel : public NodeDecorator {
+ public:
+  using NodeDecorator::NodeDecorator;
+  bool IsParallel() const override { return true; }
+};
+
+// A Screen a child is rendered into, before being copied to the real one.
+class Target : public Screen {
+ public:
+  Target() : Screen(0, 0) {}
+
+  // Copy the |box| area of |screen|.
+  void Load(const Screen& screen, Box box) {
+    if (dimx_ != screen.dimx() || dimy_ != screen.dimy()) {
+      static_cast<Screen&>(*this) = Screen(screen.dimx(), screen.dimy());
+    }
+    hyperlinks_ = {""};
+    hyperlink_ids_.clear();
+    stencil = box;
+    cursor_ = screen.cursor();
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Pixel& pixel = PixelAt(x, y);
+        pixel = screen.PixelAt(x, y);
+        if (pixel.hyperlink) {
+          pixel.hyperlink =
+              RegisterHyperlink(screen.Hyperlink(pixel.hyperlink));
+        }
+      }
+    }
+  }
+
+  // Copy the |box| area back into |screen|.
+  void Store(Screen& screen, Box box) const {
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Pixel& pixel = screen.PixelAt(x, y);
+        pixel = PixelAt(x, y);
+        if (pixel.hyperlink) {
+          pixel.hyperlink =
+              screen.RegisterHyperlink(Hyperlink(pixel.hyperlink));
+        }
+      }
+    }
+  }
+};
+
+void RenderConcurrently(Screen& screen, const std::vector<Parallel*>& nodes) {
+  // Reused in between frames. This is a reference, because the workers must
+  // use the one of this thread. A batch nested in one of its items gets its
+  // own, since the outer one is still in use.
+  thread_local std::vector<Target> g_targets;  // NOLINT
+  thread_local int g_depth = 0;                // NOLINT
+  std::vector<Target> nested_targets;
+  std::vector<Target>& targets = g_depth == 0 ? g_targets : nested_targets;
+  if (targets.size() < nodes.size()) {
+    targets.resize(nodes.size());
+  }
+
+  std::vector<Box> boxes(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    boxes[i] = Box::Intersection(nodes[i]->box(), screen.stencil);
+  }
+
+  auto render = [&](int i) {
+    targets[i].Load(screen, boxes[i]);
+    nodes[i]->Render(targets[i]);
+  };
+
+  // The workers read |screen| concurrently.
+  screen.ResolveStyles();
+
+  ++g_depth;
+  thread_pool::Run(int(nodes.size()), render);
+  --g_depth;
+
+  const Screen::Cursor cursor = screen.cursor();
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    targets[i].Store(screen, boxes[i]);
+    const Screen::Cursor target_cursor = targets[i].cursor();
+    if (target_cursor.x != cursor.x || target_cursor.y != cursor.y ||
+        target_cursor.shape != cursor.shape) {
+      screen.SetCursor(target_cursor);
+    }
+  }
+}
+
+bool Overlap(Box a, Box b) {
+  const Box intersection = Box::Intersection(a, b);
+  return intersection.x_min <= intersection.x_max &&
+         intersection.y_min <= intersection.y_max;
+}
+
+}  // namespace
+
+void RenderChildren(Screen& screen, const Elements& children) {
+  // The children entirely outside of the stencil, for instance scrolled out
+  // of a frame, draw nothing. They are skipped, with their whole subtree. The
+  // empty ones are kept: they may still move the cursor.
+  auto culled = [&](const Node& child) {
+    const Box& box = child.box();
+    return box.x_min <= box.x_max && box.y_min <= box.y_max &&
+           !Overlap(box, screen.stencil);
+  };
+
+  std::vector<Parallel*> batch;
+  auto flush = [&] {
+    if (batch.size() == 1) {
+      batch[0]->Render(screen);
+    } else if (!batch.empty()) {
+      RenderConcurrently(screen, batch);
+    }
+    batch.clear();
+  };
+
+  for (const auto& child : children) {
+    if (culled(*child)) {
+      continue;
+    }
+    if (!child->IsParallel()) {
+      flush();
+      child->Render(screen);
+      continue;
+    }
+
+    auto* node = static_cast<Parallel*>(child.get());  // NOLINT
+    for (const Parallel* other : batch) {
+      if (Overlap(other->box(), node->box())) {
+        flush();
+        break;
+      }
+    }
+    batch.push_back(node);
+  }
+  flush();
+}
+
+/// @brief Allow |child| to be rendered concurrently with its siblings also
+/// decorated with `parallel`, on other threads. This is useful for expensive
+/// independent areas, like the panes of a dashboard.
+///
+/// Each one is rendered into its own buffer, copied back into the screen
+/// afterward. The number of threads follows
+/// `std::thread::hardware_concurrency()`. The rendering of |child| must not access state shared with the
+/// rest of the document.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = hbox({
+///   BuildPlot(data_a) | parallel | flex,
+///   separator(),
+///   BuildPlot(data_b) | parallel | flex,
+/// });
+/// ```
+Element parallel(Element child) {
+  return MakeNode<Parallel>(std::move(child));
+}
+
+}  // namespace ftxui
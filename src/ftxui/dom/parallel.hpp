@@ -0,0 +1,19 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_PARALLEL_HPP
+#define FTXUI_DOM_PARALLEL_HPP
+
+#include "ftxui/dom/node.hpp"  // for Elements
+
+namespace ftxui {
+class Screen;
+
+// Render |children| in order. The ones outside of the stencil are skipped. The
+// consecutive ones decorated with `parallel`, whose boxes do not overlap, are
+// rendered concurrently.
+void RenderChildren(Screen& screen, const Elements& children);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_PARALLEL_HPP
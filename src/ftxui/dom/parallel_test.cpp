@@ -0,0 +1,99 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for allocator, to_string
+
+#include "ftxui/dom/elements.hpp"  // for parallel, text, hbox, vbox, dbox, border, hyperlink, bgcolor, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+Element Pane(int i) {
+  Elements lines;
+  for (int y = 0; y < 4; ++y) {
+    lines.push_back(text(std::to_string(i * 10 + y)));
+  }
+  return vbox(std::move(lines)) | border;
+}
+}  // namespace
+
+TEST(ParallelTest, SameAsSequential) {
+  auto build = [](bool concurrent) {
+    Elements panes;
+    for (int i = 0; i < 6; ++i) {
+      panes.push_back(concurrent ? Pane(i) | parallel : Pane(i));
+    }
+    return hbox(std::move(panes)) | bgcolor(Color::Red);
+  };
+  Screen expected(30, 6);
+  Render(expected, build(false));
+  Screen screen(30, 6);
+  Render(screen, build(true));
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+TEST(ParallelTest, Nested) {
+  // Batches nested in the items of a batch, on every thread.
+  auto build = [](bool concurrent) {
+    Elements rows;
+    for (int y = 0; y < 4; ++y) {
+      Elements panes;
+      for (int x = 0; x < 4; ++x) {
+        panes.push_back(concurrent ? Pane(y * 4 + x) | parallel
+                                   : Pane(y * 4 + x));
+      }
+      Element row = hbox(std::move(panes)) | border;
+      rows.push_back(concurrent ? row | parallel : row);
+    }
+    return vbox(std::move(rows));
+  };
+  Screen expected(40, 32);
+  Render(expected, build(false));
+  for (int i = 0; i < 10; ++i) {
+    Screen screen(40, 32);
+    Render(screen, build(true));
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+}
+
+TEST(ParallelTest, Overlapping) {
+  auto element = dbox({
+      text("aaaa") | parallel,
+      text("bb") | parallel,
+  });
+  Screen screen(4, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(), "bbaa");
+}
+
+#if !defined(FTXUI_NO_HYPERLINKS)
+TEST(ParallelTest, Hyperlink) {
+  auto element = hbox({
+      text("a") | hyperlink("https://a.com") | parallel,
+      text("b") | hyperlink("https://b.com") | parallel,
+  });
+  Screen screen(2, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.Hyperlink(screen.PixelAt(0, 0).hyperlink), "https://a.com");
+  EXPECT_EQ(screen.Hyperlink(screen.PixelAt(1, 0).hyperlink), "https://b.com");
+}
+#endif
+
+TEST(ParallelTest, Cursor) {
+  auto element = hbox({
+      text("a") | parallel,
+      text("b") | focusCursorBar | parallel,
+  });
+  Screen screen(2, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.cursor().x, 1);
+  EXPECT_EQ(screen.cursor().shape, Screen::Cursor::Bar);
+}
+
+}  // namespace ftxui
+// NOLINTEND
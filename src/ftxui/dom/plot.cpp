@@ -0,0 +1,287 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/plot.hpp"
+
+#include <algorithm>  // for lower_bound, upper_bound, max, min
+#include <cmath>      // for lround
+#include <cstddef>    // for size_t
+#include <limits>     // for numeric_limits
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/canvas.hpp"    // for Canvas
+#include "ftxui/screen/color.hpp"  // for Color
+#include "ftxui/screen/screen.hpp"  // for Pixel
+
+namespace ftxui {
+
+namespace {
+
+// Clip the segment (x1, y1) - (x2, y2) against |viewport|, with the
+// Liang-Barsky algorithm. Return false when it is entirely outside.
+bool Clip(const Plot::Viewport& viewport,
+          double* x1,
+          double* y1,
+          double* x2,
+          double* y2) {
+  const double dx = *x2 - *x1;
+  const double dy = *y2 - *y1;
+  const double p[4] = {-dx, dx, -dy, dy};  // NOLINT
+  const double q[4] = {
+      *x1 - viewport.x_min,
+      viewport.x_max - *x1,
+      *y1 - viewport.y_min,
+      viewport.y_max - *y1,
+  };  // NOLINT
+  double t1 = 0.0;
+  double t2 = 1.0;
+  for (int i = 0; i < 4; ++i) {
+    if (p[i] == 0.0) {  // NOLINT
+      // Parallel to this edge, and outside of it.
+      if (q[i] < 0.0) {  // NOLINT
+        return false;
+      }
+      continue;
+    }
+    const double t = q[i] / p[i];  // NOLINT
+    if (p[i] < 0.0) {              // NOLINT
+      t1 = std::max(t1, t);
+    } else {
+      t2 = std::min(t2, t);
+    }
+    if (t1 > t2) {
+      return false;
+    }
+  }
+  const double x = *x1;
+  const double y = *y1;
+  *x1 = x + t1 * dx;
+  *y1 = y + t1 * dy;
+  *x2 = x + t2 * dx;
+  *y2 = y + t2 * dy;
+  return true;
+}
+
+void DrawDots(Canvas* canvas,
+              int x1,
+              int y1,
+              int x2,
+              int y2,
+              const Canvas::Stylizer* style) {
+  if (style) {
+    canvas->DrawPointLine(x1, y1, x2, y2, *style);
+  } else {
+    canvas->DrawPointLine(x1, y1, x2, y2);
+  }
+}
+
+void DrawLine(Canvas* canvas,
+              const Plot& plot,
+              const Plot::Viewport& viewport,
+              double x1,
+              double y1,
+              double x2,
+              double y2,
+              const Canvas::Stylizer* style) {
+  if (!Clip(viewport, &x1, &y1, &x2, &y2)) {
+    return;
+  }
+  DrawDots(canvas, int(std::lround(plot.DotX(x1))),
+           int(std::lround(plot.DotY(y1))), int(std::lround(plot.DotX(x2))),
+           int(std::lround(plot.DotY(y2))), style);
+}
+
+void DrawSeries(Canvas* canvas,
+                const Plot& plot,
+                const Plot::Viewport& viewport,
+                const PlotSeries& series,
+                const Canvas::Stylizer* style) {
+  const std::vector<double>& xs = series.x();
+  const std::vector<double>& ys = series.y();
+  const int columns = canvas->width();
+  if (columns <= 0 || xs.empty()) {
+    return;
+  }
+
+  // The samples in the viewport, and the one on each side, for the lines
+  // entering and leaving it.
+  size_t begin = size_t(
+      std::lower_bound(xs.begin(), xs.end(), viewport.x_min) - xs.begin());
+  size_t end = size_t(
+      std::upper_bound(xs.begin(), xs.end(), viewport.x_max) - xs.begin());
+  begin = begin > 0 ? begin - 1 : 0;
+  end = std::min(end + 1, xs.size());
+
+  // Sparser than the canvas: the segments joining the samples.
+  if (end - begin <= 2 * size_t(columns)) {
+    if (end - begin == 1) {
+      DrawLine(canvas, plot, viewport, xs[begin], ys[begin], xs[begin],
+               ys[begin], style);
+    }
+    for (size_t i = begin + 1; i < end; ++i) {
+      DrawLine(canvas, plot, viewport, xs[i - 1], ys[i - 1], xs[i], ys[i],
+               style);
+    }
+    return;
+  }
+
+  // Denser: a vertical line per column, from the lowest to the highest sample
+  // under it. The sample preceding the column is included, so that the
+  // consecutive columns are connected.
+  const double step =
+      (viewport.x_max - viewport.x_min) / double(std::max(columns - 1, 1));
+  size_t column_begin = size_t(
+      std::lower_bound(xs.begin(), xs.end(), viewport.x_min - 0.5 * step) -
+      xs.begin());
+  for (int column = 0; column < columns; ++column) {
+    const double right = viewport.x_min + (double(column) + 0.5) * step;
+    const size_t column_end = size_t(
+        std::lower_bound(xs.begin() + std::ptrdiff_t(column_begin), xs.end(),
+                         right) -
+        xs.begin());
+    if (column_end == column_begin) {
+      continue;
+    }
+    const PlotSeries::Range range = series.YRange(
+        column_begin > 0 ? column_begin - 1 : column_begin, column_end);
+    column_begin = column_end;
+    if (range.high < viewport.y_min || range.low > viewport.y_max) {
+      continue;
+    }
+    const double high = std::min(range.high, viewport.y_max);
+    const double low = std::max(range.low, viewport.y_min);
+    DrawDots(canvas, column, int(std::lround(plot.DotY(high))), column,
+             int(std::lround(plot.DotY(low))), style);
+  }
+}
+
+}  // namespace
+
+/// @brief Constructor. The blocks of samples are summarized.
+/// @param x the x of the samples, in increasing order.
+/// @param y the y of the samples.
+PlotSeries::PlotSeries(std::vector<double> x, std::vector<double> y)
+    : x_(std::move(x)), y_(std::move(y)) {
+  y_.resize(x_.size());
+  // Every level summarizes the blocks twice as large as the previous one.
+  for (size_t block = 2; block <= y_.size(); block *= 2) {
+    std::vector<Range> level(y_.size() / block);
+    for (size_t i = 0; i < level.size(); ++i) {
+      if (block == 2) {
+        level[i] = {std::min(y_[2 * i], y_[2 * i + 1]),
+                    std::max(y_[2 * i], y_[2 * i + 1])};
+      } else {
+        const Range& a = levels_.back()[2 * i];
+        const Range& b = levels_.back()[2 * i + 1];
+        level[i] = {std::min(a.low, b.low), std::max(a.high, b.high)};
+      }
+    }
+    levels_.push_back(std::move(level));
+  }
+}
+
+/// @brief The lowest and highest y of the samples [begin, end). It reads
+/// O(log(size)) blocks. An empty range is returned as {+inf, -inf}.
+PlotSeries::Range PlotSeries::YRange(size_t begin, size_t end) const {
+  Range range = {std::numeric_limits<double>::infinity(),
+                 -std::numeric_limits<double>::infinity()};
+  end = std::min(end, y_.size());
+  size_t i = begin;
+  while (i < end) {
+    // The largest block starting at |i|, and ending before |end|.
+    size_t level = 0;
+    while (level < levels_.size() && i % (size_t(2) << level) == 0 &&
+           i + (size_t(2) << level) <= end) {
+      ++level;
+    }
+    if (level == 0) {
+      range.low = std::min(range.low, y_[i]);
+      range.high = std::max(range.high, y_[i]);
+      ++i;
+      continue;
+    }
+    const Range& block = levels_[level - 1][i >> level];
+    range.low = std::min(range.low, block.low);
+    range.high = std::max(range.high, block.high);
+    i += size_t(1) << level;
+  }
+  return range;
+}
+
+/// @brief Constructor.
+/// @param canvas the canvas drawn on. It must outlive the Plot.
+/// @param viewport the part of the data displayed by the canvas.
+Plot::Plot(Canvas* canvas, Viewport viewport)
+    : canvas_(canvas), viewport_(viewport) {}
+
+/// @brief The x of the dot displaying the data |x|.
+double Plot::DotX(double x) const {
+  const double span = viewport_.x_max - viewport_.x_min;
+  if (span == 0.0) {
+    return 0.0;
+  }
+  return (x - viewport_.x_min) / span * double(canvas_->width() - 1);
+}
+
+/// @brief The y of the dot displaying the data |y|. The y axis points up.
+double Plot::DotY(double y) const {
+  const double span = viewport_.y_max - viewport_.y_min;
+  if (span == 0.0) {
+    return 0.0;
+  }
+  return (viewport_.y_max - y) / span * double(canvas_->height() - 1);
+}
+
+/// @brief Draw a line, clipped to the viewport.
+void Plot::DrawLine(double x1, double y1, double x2, double y2) {
+  ftxui::DrawLine(canvas_, *this, viewport_, x1, y1, x2, y2, nullptr);
+}
+
+/// @brief Draw a line, clipped to the viewport.
+/// @param color the color of the line.
+void Plot::DrawLine(double x1,
+                    double y1,
+                    double x2,
+                    double y2,
+                    const Color& color) {
+  const Canvas::Stylizer style = [color](Pixel& p) {
+    p.foreground_color = color;
+  };
+  ftxui::DrawLine(canvas_, *this, viewport_, x1, y1, x2, y2, &style);
+}
+
+/// @brief Draw a line, clipped to the viewport.
+/// @param style the style of the line.
+void Plot::DrawLine(double x1,
+                    double y1,
+                    double x2,
+                    double y2,
+                    const Canvas::Stylizer& style) {
+  ftxui::DrawLine(canvas_, *this, viewport_, x1, y1, x2, y2, &style);
+}
+
+/// @brief Draw the segments joining the samples of |series|. When there are
+/// more of them than dots in the width of the canvas, every column displays
+/// the lowest and highest sample under it instead.
+void Plot::DrawSeries(const PlotSeries& series) {
+  ftxui::DrawSeries(canvas_, *this, viewport_, series, nullptr);
+}
+
+/// @brief Draw the samples of |series|. See `DrawSeries(series)`.
+/// @param color the color of the series.
+void Plot::DrawSeries(const PlotSeries& series, const Color& color) {
+  const Canvas::Stylizer style = [color](Pixel& p) {
+    p.foreground_color = color;
+  };
+  ftxui::DrawSeries(canvas_, *this, viewport_, series, &style);
+}
+
+/// @brief Draw the samples of |series|. See `DrawSeries(series)`.
+/// @param style the style of the series.
+void Plot::DrawSeries(const PlotSeries& series,
+                      const Canvas::Stylizer& style) {
+  ftxui::DrawSeries(canvas_, *this, viewport_, series, &style);
+}
+
+}  // namespace ftxui
@@ -0,0 +1,111 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/plot.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>  // for max, min
+#include <cmath>      // for sin
+#include <cstddef>    // for size_t
+#include <string>     // for string
+#include <vector>     // for vector
+#include "ftxui/dom/canvas.hpp"
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+std::string Characters(const Canvas& canvas) {
+  std::string out;
+  for (int y = 0; y < (canvas.height() + 3) / 4; ++y) {
+    for (int x = 0; x < (canvas.width() + 1) / 2; ++x) {
+      out += canvas.GetPixel(x, y).character;
+    }
+    out += "\n";
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(PlotTest, YRange) {
+  std::vector<double> x;
+  std::vector<double> y;
+  for (int i = 0; i < 37; ++i) {
+    x.push_back(i);
+    y.push_back(std::sin(i * 1.7) * i);
+  }
+  const PlotSeries series(x, y);
+  for (size_t begin = 0; begin < y.size(); ++begin) {
+    for (size_t end = begin + 1; end <= y.size(); ++end) {
+      const PlotSeries::Range range = series.YRange(begin, end);
+      EXPECT_EQ(range.low, *std::min_element(&y[begin], &y[0] + end));
+      EXPECT_EQ(range.high, *std::max_element(&y[begin], &y[0] + end));
+    }
+  }
+}
+
+TEST(PlotTest, ClipLine) {
+  // The part of the line outside of the viewport is not rasterized.
+  Canvas c(20, 20);
+  Plot plot(&c, {.x_min = 0, .x_max = 19, .y_min = 0, .y_max = 19});
+  plot.DrawLine(-1e9, 5, 1e9, 5);
+
+  Canvas expected(20, 20);
+  expected.DrawPointLine(0, 14, 19, 14);
+  EXPECT_EQ(Characters(c), Characters(expected));
+
+  // Entirely outside.
+  Canvas empty(20, 20);
+  Plot(&empty, {.x_min = 0, .x_max = 19, .y_min = 0, .y_max = 19})
+      .DrawLine(-10, -10, 30, -1);
+  EXPECT_EQ(Characters(empty), Characters(Canvas(20, 20)));
+}
+
+TEST(PlotTest, Sparse) {
+  Canvas c(20, 20);
+  Plot plot(&c, {.x_min = 0, .x_max = 19, .y_min = 0, .y_max = 19});
+  plot.DrawSeries(PlotSeries({-5, 5, 10, 100}, {0, 10, 5, 5}));
+
+  Canvas expected(20, 20);
+  Plot(&expected, {.x_min = 0, .x_max = 19, .y_min = 0, .y_max = 19})
+      .DrawLine(-5, 0, 5, 10);
+  expected.DrawPointLine(5, 9, 10, 14);
+  expected.DrawPointLine(10, 14, 19, 14);
+  EXPECT_EQ(Characters(c), Characters(expected));
+}
+
+TEST(PlotTest, Dense) {
+  // Every column displays the lowest and highest sample under it.
+  std::vector<double> x;
+  std::vector<double> y;
+  for (int i = 0; i < 100000; ++i) {
+    x.push_back(i * 0.001);
+    y.push_back(std::sin(i * 0.37));
+  }
+  const Plot::Viewport viewport = {
+      .x_min = 10, .x_max = 50, .y_min = -2, .y_max = 2};
+  Canvas c(40, 40);
+  Plot plot(&c, viewport);
+  plot.DrawSeries(PlotSeries(x, y));
+
+  Canvas expected(40, 40);
+  Plot reference(&expected, viewport);
+  for (int column = 0; column < 40; ++column) {
+    double low = 1e9;
+    double high = -1e9;
+    for (size_t i = 1; i < x.size(); ++i) {
+      const double dot = reference.DotX(x[i]);
+      if (dot >= column - 0.5 && dot < column + 0.5) {
+        low = std::min({low, y[i], y[i - 1]});
+        high = std::max({high, y[i], y[i - 1]});
+      }
+    }
+    expected.DrawPointLine(column, int(reference.DotY(high) + 0.5), column,
+                           int(reference.DotY(low) + 0.5));
+  }
+  EXPECT_EQ(Characters(c), Characters(expected));
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,12 +1,13 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared, __shared_ptr_access
+#include <memory>   // for shared_ptr, __shared_ptr_access
 #include <utility>  // for move
 #include <vector>   // for __alloc_traits<>::value_type
 
 #include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
 #include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Screen
@@ -26,13 +27,14 @@ class Reflect : public Node {
   }
 
   void SetBox(Box box) final {
-    reflected_box_ = box;
+    // Empty, unless it is drawn. It may be culled by its parent.
+    reflected_box_ = Box{0, -1, 0, -1};
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->UpdateBox(box);
   }
 
   void Render(Screen& screen) final {
-    reflected_box_ = Box::Intersection(screen.stencil, reflected_box_);
+    reflected_box_ = Box::Intersection(screen.stencil, box_);
     return Node::Render(screen);
   }
 
@@ -43,7 +45,7 @@ class Reflect : public Node {
 
 Decorator reflect(Box& box) {
   return [&](Element child) -> Element {
-    return std::make_shared<Reflect>(std::move(child), box);
+    return MakeNode<Reflect>(std::move(child), box);
   };
 }
 
@@ -0,0 +1,182 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <initializer_list>  // for initializer_list
+#include <memory>            // for shared_ptr
+#include <utility>           // for move
+#include <vector>            // for vector
+
+#include "ftxui/dom/elements.hpp"        // for Element, retained
+#include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+
+namespace ftxui {
+
+namespace {
+
+bool SamePixel(const Pixel& a, const Pixel& b) {
+  return a.character == b.character &&                //
+         a.background_color == b.background_color &&  //
+         a.foreground_color == b.foreground_color &&  //
+         a.blink == b.blink &&                        //
+         a.bold == b.bold &&                          //
+         a.dim == b.dim &&                            //
+         a.inverted == b.inverted &&                  //
+         a.underlined == b.underlined &&              //
+         a.underlined_double == b.underlined_double &&
+         a.strikethrough == b.strikethrough &&  //
+         a.automerge == b.automerge &&          //
+         a.hyperlink == b.hyperlink;
+}
+
+bool SameCursor(const Screen::Cursor& a, const Screen::Cursor& b) {
+  return a.x == b.x && a.y == b.y && a.shape == b.shape;
+}
+
+// Keep the layout and the pixels of the child in between two frames.
+//
+// Once the layout of the child converged for a given box, its requirement is
+// reused, and the child isn't visited anymore by the layout passes, as long as
+// it is given the same box. Otherwise, its layout restarts from scratch.
+//
+// The pixels are copied back instead of rendering the child again, when:
+// - The visible part of the box is the same.
+// - The pixels below are the same as the ones the child was drawn over.
+// Hyperlinks ids are only meaningful for the frame that registered them, so
+// areas using one are never retained.
+class Retained : public NodeDecorator {
+ public:
+  using NodeDecorator::NodeDecorator;
+
+  void ComputeRequirement() override {
+    if (!layout_valid_) {
+      NodeDecorator::ComputeRequirement();
+    }
+  }
+
+  void SetBox(Box box) override {
+    if (layout_valid_) {
+      if (box == box_) {
+        return;
+      }
+      layout_valid_ = false;
+      child_iteration_ = 0;
+    }
+    child_box_set_ = true;
+    valid_ = false;
+    NodeDecorator::SetBox(box);
+  }
+
+  void Check(Status* status) override {
+    // At least one layout pass is needed, to give this element its box.
+    if (status->iteration == 0) {
+      child_iteration_ = 0;
+      status->need_iteration = true;
+    }
+    if (layout_valid_) {
+      return;
+    }
+
+    // The child counts its own iterations, so that its layout can restart
+    // from scratch in the middle of the parent's one.
+    Status child_status;
+    child_status.iteration = child_iteration_++;
+    Node::Check(&child_status);
+    status->need_iteration |= child_status.need_iteration;
+    layout_valid_ = child_box_set_ && !child_status.need_iteration;
+    child_box_set_ = false;
+  }
+
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(box_, screen.stencil);
+    if (valid_ && box == visible_box_ && SameBelow(screen, box)) {
+      Paint(screen, box);
+      return;
+    }
+
+    visible_box_ = box;
+    Capture(screen, box, &below_);
+    const Screen::Cursor cursor = screen.cursor();
+    Node::Render(screen);
+    Capture(screen, box, &drawn_);
+    set_cursor_ = !SameCursor(cursor, screen.cursor());
+    cursor_ = screen.cursor();
+    valid_ = Cacheable();
+  }
+
+ private:
+  static void Capture(Screen& screen, Box box, std::vector<Pixel>* out) {
+    out->clear();
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        out->push_back(screen.PixelAt(x, y));
+      }
+    }
+  }
+
+  bool SameBelow(Screen& screen, Box box) const {
+    auto it = below_.begin();
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        if (!SamePixel(screen.PixelAt(x, y), *it++)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void Paint(Screen& screen, Box box) const {
+    auto it = drawn_.begin();
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        screen.PixelAt(x, y) = *it++;
+      }
+    }
+    if (set_cursor_) {
+      screen.SetCursor(cursor_);
+    }
+  }
+
+  bool Cacheable() const {
+    for (const auto* pixels : {&below_, &drawn_}) {
+      for (const Pixel& pixel : *pixels) {
+        if (pixel.hyperlink != 0) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool layout_valid_ = false;
+  bool child_box_set_ = false;
+  int child_iteration_ = 0;
+
+  bool valid_ = false;
+  bool set_cursor_ = false;
+  Box visible_box_;
+  Screen::Cursor cursor_;
+  std::vector<Pixel> below_;
+  std::vector<Pixel> drawn_;
+};
+
+}  // namespace
+
+/// @brief Keep the layout and the pixels drawn by |child| in between frames.
+/// When the same element is given the same box again, its layout is reused.
+/// When it is drawn again at the same place, over the same pixels, they are
+/// copied back instead of rendering |child| again.
+///
+/// This is only useful for elements reused across frames, for instance the
+/// ones returned by a component decorated with `Memo`.
+/// @see ftxui::Memo
+/// @ingroup dom
+Element retained(Element child) {
+  return MakeNode<Retained>(std::move(child));
+}
+
+}  // namespace ftxui
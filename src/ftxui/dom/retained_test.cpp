@@ -0,0 +1,111 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+#include <string>  // for allocator
+
+#include "ftxui/dom/elements.hpp"  // for retained, text, hbox, flexbox, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+// A text counting how many times it has been rendered and laid out.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count, int* layout_count = nullptr)
+      : count_(count), layout_count_(layout_count) {}
+  void ComputeRequirement() override {
+    if (layout_count_) {
+      ++*layout_count_;
+    }
+    requirement_.min_x = 3;
+    requirement_.min_y = 1;
+  }
+  void Render(Screen& screen) override {
+    ++*count_;
+    screen.PixelAt(box_.x_min, box_.y_min).character = "a";
+    screen.PixelAt(box_.x_min + 1, box_.y_min).character = "b";
+    screen.PixelAt(box_.x_min + 2, box_.y_min).character = "c";
+  }
+
+ private:
+  int* count_;
+  int* layout_count_;
+};
+}  // namespace
+
+TEST(RetainedTest, ReusePixels) {
+  int count = 0;
+  auto element = retained(std::make_shared<Counter>(&count));
+  Screen screen(5, 1);
+
+  Render(screen, hbox({text("-"), element}));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(screen.ToString(), "-abc ");
+
+  screen.Clear();
+  Render(screen, hbox({text("-"), element}));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(screen.ToString(), "-abc ");
+}
+
+TEST(RetainedTest, Moved) {
+  int count = 0;
+  auto element = retained(std::make_shared<Counter>(&count));
+  Screen screen(5, 1);
+
+  Render(screen, hbox({text("-"), element}));
+  screen.Clear();
+  Render(screen, hbox({text("--"), element}));
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(screen.ToString(), "--abc");
+}
+
+TEST(RetainedTest, BackgroundChanged) {
+  int count = 0;
+  auto element = retained(std::make_shared<Counter>(&count));
+  Screen screen(3, 1);
+
+  Render(screen, element | bgcolor(Color::Red));
+  screen.Clear();
+  Render(screen, element | bgcolor(Color::Blue));
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color::Blue);
+}
+
+TEST(RetainedTest, ReuseLayout) {
+  int count = 0;
+  int layout_count = 0;
+  auto element = retained(std::make_shared<Counter>(&count, &layout_count));
+  Screen screen(5, 1);
+
+  Render(screen, hbox({text("-"), element}));
+  EXPECT_EQ(layout_count, 1);
+
+  screen.Clear();
+  Render(screen, hbox({text("-"), element}));
+  EXPECT_EQ(layout_count, 1);
+  EXPECT_EQ(screen.ToString(), "-abc ");
+}
+
+TEST(RetainedTest, FlexboxResized) {
+  auto build = [] {
+    return flexbox({text("aaa"), text("bbb"), text("ccc")}) | border;
+  };
+  auto element = retained(build());
+  for (int width : {11, 7, 11, 7}) {
+    Screen expected(width, 4);
+    Render(expected, build());
+    Screen screen(width, 4);
+    Render(screen, element);
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
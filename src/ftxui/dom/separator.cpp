@@ -2,12 +2,14 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <array>    // for array, array<>::value_type
-#include <memory>   // for make_shared, allocator
-#include <string>   // for basic_string, string
-#include <utility>  // for move
-
-#include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
-#include "ftxui/dom/node.hpp"      // for Node
+#include <memory>   // for shared_ptr, allocator
+#include <string>       // for basic_string, string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/color.hpp"     // for Color
@@ -16,10 +18,10 @@
 namespace ftxui {
 
 namespace {
-using Charset = std::array<std::string, 2>;  // NOLINT
-using Charsets = std::array<Charset, 6>;     // NOLINT
+using Charset = std::array<std::string_view, 2>;  // NOLINT
+using Charsets = std::array<Charset, 6>;          // NOLINT
 // NOLINTNEXTLINE
-const Charsets charsets = {
+constexpr Charsets charsets = {
     Charset{"│", "─"},  // LIGHT
     Charset{"╏", "╍"},  // DASHED
     Charset{"┃", "━"},  // HEAVY
@@ -38,13 +40,10 @@ class Separator : public Node {
   }
 
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        Pixel& pixel = screen.PixelAt(x, y);
-        pixel.character = value_;
-        pixel.automerge = true;
-      }
-    }
+    screen.ForEachPixel(box_, [&](Pixel& pixel) {
+      pixel.character = value_;
+      pixel.automerge = true;
+    });
   }
 
   std::string value_;
@@ -63,15 +62,12 @@ class SeparatorAuto : public Node {
     const bool is_column = (box_.x_max == box_.x_min);
     const bool is_line = (box_.y_min == box_.y_max);
 
-    const std::string c = charsets[style_][int(is_line && !is_column)];
+    const std::string_view c = charsets[style_][int(is_line && !is_column)];
 
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        Pixel& pixel = screen.PixelAt(x, y);
-        pixel.character = c;
-        pixel.automerge = true;
-      }
-    }
+    screen.ForEachPixel(box_, [&](Pixel& pixel) {
+      pixel.character = c;
+      pixel.automerge = true;
+    });
   }
 
   BorderStyle style_;
@@ -84,11 +80,7 @@ class SeparatorWithPixel : public SeparatorAuto {
     pixel_.automerge = true;
   }
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = pixel_;
-      }
-    }
+    screen.ForEachPixel(box_, [&](Pixel& pixel) { pixel = pixel_; });
   }
 
  private:
@@ -130,7 +122,7 @@ class SeparatorWithPixel : public SeparatorAuto {
 /// down
 /// ```
 Element separator() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -168,7 +160,7 @@ Element separator() {
 /// down
 /// ```
 Element separatorStyled(BorderStyle style) {
-  return std::make_shared<SeparatorAuto>(style);
+  return MakeNode<SeparatorAuto>(style);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -205,7 +197,7 @@ Element separatorStyled(BorderStyle style) {
 /// down
 /// ```
 Element separatorLight() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -242,7 +234,7 @@ Element separatorLight() {
 /// down
 /// ```
 Element separatorDashed() {
-  return std::make_shared<SeparatorAuto>(DASHED);
+  return MakeNode<SeparatorAuto>(DASHED);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -279,7 +271,7 @@ Element separatorDashed() {
 /// down
 /// ```
 Element separatorHeavy() {
-  return std::make_shared<SeparatorAuto>(HEAVY);
+  return MakeNode<SeparatorAuto>(HEAVY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -316,7 +308,7 @@ Element separatorHeavy() {
 /// down
 /// ```
 Element separatorDouble() {
-  return std::make_shared<SeparatorAuto>(DOUBLE);
+  return MakeNode<SeparatorAuto>(DOUBLE);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -353,7 +345,7 @@ Element separatorDouble() {
 /// down
 /// ```
 Element separatorEmpty() {
-  return std::make_shared<SeparatorAuto>(EMPTY);
+  return MakeNode<SeparatorAuto>(EMPTY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -391,7 +383,7 @@ Element separatorEmpty() {
 /// down
 /// ```
 Element separatorCharacter(std::string value) {
-  return std::make_shared<Separator>(std::move(value));
+  return MakeNode<Separator>(std::move(value));
 }
 
 /// @brief Draw a separator in between two element filled with a given pixel.
@@ -422,7 +414,7 @@ Element separatorCharacter(std::string value) {
 /// Down
 /// ```
 Element separator(Pixel pixel) {
-  return std::make_shared<SeparatorWithPixel>(std::move(pixel));
+  return MakeNode<SeparatorWithPixel>(std::move(pixel));
 }
 
 /// @brief Draw an horizontal bar, with the area in between left/right colored
@@ -492,7 +484,7 @@ Element separatorHSelector(float left,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(left, right, unselected_color, selected_color);
+  return MakeNode<Impl>(left, right, unselected_color, selected_color);
 }
 
 /// @brief Draw an vertical bar, with the area in between up/downcolored
@@ -562,7 +554,7 @@ Element separatorVSelector(float up,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(up, down, unselected_color, selected_color);
+  return MakeNode<Impl>(up, down, unselected_color, selected_color);
 }
 
 }  // namespace ftxui
@@ -2,12 +2,13 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <algorithm>  // for min, max
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <memory>     // for shared_ptr, __shared_ptr_access
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
-#include "ftxui/dom/node.hpp"      // for Node, Elements
+#include "ftxui/dom/elements.hpp"     // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
+#include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 
@@ -71,7 +72,7 @@ class Size : public Node {
           break;
       }
     }
-    children_[0]->SetBox(box);
+    children_[0]->UpdateBox(box);
   }
 
  private:
@@ -79,6 +80,31 @@ class Size : public Node {
   Constraint constraint_;
   int value_;
 };
+
+// A box of exactly |width| x |height| cells. The child isn't measured: its
+// layout must only depend on the box it is given.
+class FixedSize : public Node {
+ public:
+  FixedSize(Element child, int width, int height)
+      : Node(unpack(std::move(child))), width_(width), height_(height) {}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    requirement_.min_x = width_;
+    requirement_.min_y = height_;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    box.x_max = std::min(box.x_min + width_ - 1, box.x_max);
+    box.y_max = std::min(box.y_min + height_ - 1, box.y_max);
+    children_[0]->UpdateBox(box);
+  }
+
+ private:
+  int width_;
+  int height_;
+};
 }  // namespace
 
 /// @brief Apply a constraint on the size of an element.
@@ -89,7 +115,25 @@ class Size : public Node {
 /// @ingroup dom
 Decorator size(WidthOrHeight direction, Constraint constraint, int value) {
   return [=](Element e) {
-    return std::make_shared<Size>(std::move(e), direction, constraint, value);
+    return MakeNode<Size>(std::move(e), direction, constraint, value);
+  };
+}
+
+/// @brief Give an element a fixed size, without measuring it.
+///
+/// This is like `size(WIDTH, EQUAL, width) | size(HEIGHT, EQUAL, height)`,
+/// except the requirement of the element is never computed. This saves the
+/// measurement of a deep tree, every frame. This is only correct for the
+/// elements whose layout depends on their box alone, like a `canvas`, a
+/// `text`, or a custom Node. The containers, like `hbox` or `gridbox`, need
+/// the requirements of their children, and the focus inside the element isn't
+/// reported to an enclosing `frame`.
+/// @param width The number of columns.
+/// @param height The number of rows.
+/// @ingroup dom
+Decorator fixedSize(int width, int height) {
+  return [=](Element e) {
+    return MakeNode<FixedSize>(std::move(e), width, height);
   };
 }
 
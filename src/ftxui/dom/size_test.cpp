@@ -0,0 +1,55 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+#include <string>  // for allocator
+
+#include "ftxui/dom/elements.hpp"  // for size, fixedSize, text, hbox, border
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+// Fill its box with 'x', and count how many times it is measured.
+class Fill : public Node {
+ public:
+  explicit Fill(int* measured) : measured_(measured) {}
+  void ComputeRequirement() override { ++*measured_; }
+  void Render(Screen& screen) override {
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (int x = box_.x_min; x <= box_.x_max; ++x) {
+        screen.PixelAt(x, y).character = "x";
+      }
+    }
+  }
+
+ private:
+  int* measured_;
+};
+}  // namespace
+
+TEST(SizeTest, Equal) {
+  auto element = text("abcdef") | size(WIDTH, EQUAL, 3);
+  Screen screen(6, 1);
+  Render(screen, hbox({element, text("|")}));
+  EXPECT_EQ(screen.ToString(), "abc|  ");
+}
+
+TEST(SizeTest, FixedSize) {
+  int measured = 0;
+  auto element = std::make_shared<Fill>(&measured) | fixedSize(3, 2);
+  Screen screen(6, 4);
+  Render(screen, hbox({element, text("|")}) | border);
+  EXPECT_EQ(measured, 0);
+  EXPECT_EQ(screen.ToString(),
+            "╭────╮\r\n"
+            "│xxx|│\r\n"
+            "│xxx │\r\n"
+            "╰────╯");
+}
+
+}  // namespace ftxui
+// NOLINTEND
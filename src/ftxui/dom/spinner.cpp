@@ -1,275 +1,339 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <cstddef>  // for size_t
-#include <memory>   // for allocator, allocator_traits<>::value_type
-#include <string>   // for basic_string, string
-#include <utility>  // for move
-#include <vector>   // for vector, __alloc_traits<>::value_type
+#include <algorithm>    // for max
+#include <cstddef>      // for size_t
+#include <iterator>     // for distance, size
+#include <string_view>  // for string_view
 
-#include "ftxui/dom/elements.hpp"  // for Element, gauge, text, vbox, spinner
+#include "ftxui/dom/elements.hpp"     // for Element, gauge, spinner
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Utf8Glyphs
 
 namespace ftxui {
 
 namespace {
+
+// The number of frames of every spinner, and the number of lines of each of
+// their frames.
+struct Charset {
+  int frames;
+  int lines;
+};
+
 // NOLINTNEXTLINE
-const std::vector<std::vector<std::vector<std::string>>> elements = {
-    {
-        {"Replaced by the gauge"},
-    },
-    {
-        {".  "},
-        {".. "},
-        {"..."},
-    },
-    {
-        {"|"},
-        {"/"},
-        {"-"},
-        {"\\"},
-    },
-    {
-        {"+"},
-        {"x"},
-    },
-    {
-        {"|  "},
-        {"|| "},
-        {"|||"},
-    },
-    {
-        {"←"},
-        {"↖"},
-        {"↑"},
-        {"↗"},
-        {"→"},
-        {"↘"},
-        {"↓"},
-        {"↙"},
-    },
-    {
-        {"▁"},
-        {"▂"},
-        {"▃"},
-        {"▄"},
-        {"▅"},
-        {"▆"},
-        {"▇"},
-        {"█"},
-        {"▇"},
-        {"▆"},
-        {"▅"},
-        {"▄"},
-        {"▃"},
-        {"▁"},
-    },
-    {
-        {"▉"},
-        {"▊"},
-        {"▋"},
-        {"▌"},
-        {"▍"},
-        {"▎"},
-        {"▏"},
-        {"▎"},
-        {"▍"},
-        {"▌"},
-        {"▋"},
-        {"▊"},
-    },
-    {
-        {"▖"},
-        {"▘"},
-        {"▝"},
-        {"▗"},
-    },
-    {
-        {"◢"},
-        {"◣"},
-        {"◤"},
-        {"◥"},
-    },
-    {
-        {"◰"},
-        {"◳"},
-        {"◲"},
-        {"◱"},
-    },
-    {
-        {"◴"},
-        {"◷"},
-        {"◶"},
-        {"◵"},
-    },
-    {
-        {"◐"},
-        {"◓"},
-        {"◑"},
-        {"◒"},
-    },
-    {
-        {"◡"},
-        {"⊙"},
-        {"◠"},
-    },
-    {
-        {"⠁"},
-        {"⠂"},
-        {"⠄"},
-        {"⡀"},
-        {"⢀"},
-        {"⠠"},
-        {"⠐"},
-        {"⠈"},
-    },
-    {
-        {"⠋"},
-        {"⠙"},
-        {"⠹"},
-        {"⠸"},
-        {"⠼"},
-        {"⠴"},
-        {"⠦"},
-        {"⠧"},
-        {"⠇"},
-        {"⠏"},
-    },
-    {
-        {"(*----------)"}, {"(-*---------)"}, {"(--*--------)"},
-        {"(---*-------)"}, {"(----*------)"}, {"(-----*-----)"},
-        {"(------*----)"}, {"(-------*---)"}, {"(--------*--)"},
-        {"(---------*-)"}, {"(----------*)"}, {"(---------*-)"},
-        {"(--------*--)"}, {"(-------*---)"}, {"(------*----)"},
-        {"(-----*-----)"}, {"(----*------)"}, {"(---*-------)"},
-        {"(--*--------)"}, {"(-*---------)"},
-    },
-    {
-        {"[      ]"},
-        {"[=     ]"},
-        {"[==    ]"},
-        {"[===   ]"},
-        {"[====  ]"},
-        {"[===== ]"},
-        {"[======]"},
-        {"[===== ]"},
-        {"[====  ]"},
-        {"[===   ]"},
-        {"[==    ]"},
-        {"[=     ]"},
-    },
-    {
-        {"[      ]"},
-        {"[=     ]"},
-        {"[==    ]"},
-        {"[===   ]"},
-        {"[====  ]"},
-        {"[===== ]"},
-        {"[======]"},
-        {"[ =====]"},
-        {"[  ====]"},
-        {"[   ===]"},
-        {"[    ==]"},
-        {"[     =]"},
-    },
-    {
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {" [==   ]"},
-        {"[  ==  ]"},
-        {"[   == ]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[   ==] "},
-        {"[  ==  ]"},
-        {"[ ==   ]"},
-    },
-    {
-        {
-            " ─╮",
-            "  │",
-            "   ",
-        },
-        {
-            "  ╮",
-            "  │",
-            "  ╯",
-        },
-        {
-            "   ",
-            "  │",
-            " ─╯",
-        },
-        {
-            "   ",
-            "   ",
-            "╰─╯",
-        },
-        {
-            "   ",
-            "│  ",
-            "╰─ ",
-        },
-        {
-            "╭  ",
-            "│  ",
-            "╰  ",
-        },
-        {
-            "╭─ ",
-            "│  ",
-            "   ",
-        },
-        {
-            "╭─╮",
-            "   ",
-            "   ",
-        },
-    },
-    {
-        {
-            "   /\\O ",
-            "    /\\/",
-            "   /\\  ",
-            "  /  \\ ",
-            "LOL  LOL",
-        },
-        {
-            "    _O  ",
-            "   //|_ ",
-            "    |   ",
-            "   /|   ",
-            "   LLOL ",
-        },
-        {
-            "     O  ",
-            "    /_  ",
-            "    |\\  ",
-            "   / |  ",
-            " LOLLOL ",
-        },
-    },
-    {
-        {"       ", "_______", "       "},
-        {"       ", "______/", "       "},
-        {"      _", "_____/ ", "       "},
-        {"     _ ", "____/ \\", "       "},
-        {"    _  ", "___/ \\ ", "      \\"},
-        {"   _   ", "__/ \\  ", "     \\_"},
-        {"  _    ", "_/ \\   ", "    \\_/"},
-        {" _     ", "/ \\   _", "   \\_/ "},
-        {"_      ", " \\   __", "  \\_/  "},
-        {"       ", "\\   ___", " \\_/   "},
-        {"       ", "    ___", "\\_/    "},
-        {"       ", "  _____", "_/     "},
-        {"       ", " ______", "/      "},
-        {"       ", "_______", "       "},
-    },
+constexpr Charset charsets[] = {
+    {1, 1}, {3, 1}, {4, 1}, {2, 1}, {3, 1}, {8, 1}, {14, 1}, {12, 1}, {4, 1},
+    {4, 1}, {4, 1}, {4, 1}, {4, 1}, {3, 1}, {8, 1}, {10, 1}, {20, 1}, {12, 1},
+    {12, 1}, {16, 1}, {8, 3}, {3, 5}, {14, 3},
+};
+
+// The lines of the frames of every spinner, one after the other.
+// NOLINTNEXTLINE
+constexpr std::string_view lines[] = {
+    // 0
+    "Replaced by the gauge",
+    // 1
+    ".  ",
+    ".. ",
+    "...",
+    // 2
+    "|",
+    "/",
+    "-",
+    "\\",
+    // 3
+    "+",
+    "x",
+    // 4
+    "|  ",
+    "|| ",
+    "|||",
+    // 5
+    "←",
+    "↖",
+    "↑",
+    "↗",
+    "→",
+    "↘",
+    "↓",
+    "↙",
+    // 6
+    "▁",
+    "▂",
+    "▃",
+    "▄",
+    "▅",
+    "▆",
+    "▇",
+    "█",
+    "▇",
+    "▆",
+    "▅",
+    "▄",
+    "▃",
+    "▁",
+    // 7
+    "▉",
+    "▊",
+    "▋",
+    "▌",
+    "▍",
+    "▎",
+    "▏",
+    "▎",
+    "▍",
+    "▌",
+    "▋",
+    "▊",
+    // 8
+    "▖",
+    "▘",
+    "▝",
+    "▗",
+    // 9
+    "◢",
+    "◣",
+    "◤",
+    "◥",
+    // 10
+    "◰",
+    "◳",
+    "◲",
+    "◱",
+    // 11
+    "◴",
+    "◷",
+    "◶",
+    "◵",
+    // 12
+    "◐",
+    "◓",
+    "◑",
+    "◒",
+    // 13
+    "◡",
+    "⊙",
+    "◠",
+    // 14
+    "⠁",
+    "⠂",
+    "⠄",
+    "⡀",
+    "⢀",
+    "⠠",
+    "⠐",
+    "⠈",
+    // 15
+    "⠋",
+    "⠙",
+    "⠹",
+    "⠸",
+    "⠼",
+    "⠴",
+    "⠦",
+    "⠧",
+    "⠇",
+    "⠏",
+    // 16
+    "(*----------)",
+    "(-*---------)",
+    "(--*--------)",
+    "(---*-------)",
+    "(----*------)",
+    "(-----*-----)",
+    "(------*----)",
+    "(-------*---)",
+    "(--------*--)",
+    "(---------*-)",
+    "(----------*)",
+    "(---------*-)",
+    "(--------*--)",
+    "(-------*---)",
+    "(------*----)",
+    "(-----*-----)",
+    "(----*------)",
+    "(---*-------)",
+    "(--*--------)",
+    "(-*---------)",
+    // 17
+    "[      ]",
+    "[=     ]",
+    "[==    ]",
+    "[===   ]",
+    "[====  ]",
+    "[===== ]",
+    "[======]",
+    "[===== ]",
+    "[====  ]",
+    "[===   ]",
+    "[==    ]",
+    "[=     ]",
+    // 18
+    "[      ]",
+    "[=     ]",
+    "[==    ]",
+    "[===   ]",
+    "[====  ]",
+    "[===== ]",
+    "[======]",
+    "[ =====]",
+    "[  ====]",
+    "[   ===]",
+    "[    ==]",
+    "[     =]",
+    // 19
+    "[==    ]",
+    "[==    ]",
+    "[==    ]",
+    "[==    ]",
+    "[==    ]",
+    " [==   ]",
+    "[  ==  ]",
+    "[   == ]",
+    "[    ==]",
+    "[    ==]",
+    "[    ==]",
+    "[    ==]",
+    "[    ==]",
+    "[   ==] ",
+    "[  ==  ]",
+    "[ ==   ]",
+    // 20
+    " ─╮",
+    "  │",
+    "   ",
+    "  ╮",
+    "  │",
+    "  ╯",
+    "   ",
+    "  │",
+    " ─╯",
+    "   ",
+    "   ",
+    "╰─╯",
+    "   ",
+    "│  ",
+    "╰─ ",
+    "╭  ",
+    "│  ",
+    "╰  ",
+    "╭─ ",
+    "│  ",
+    "   ",
+    "╭─╮",
+    "   ",
+    "   ",
+    // 21
+    "   /\\O ",
+    "    /\\/",
+    "   /\\  ",
+    "  /  \\ ",
+    "LOL  LOL",
+    "    _O  ",
+    "   //|_ ",
+    "    |   ",
+    "   /|   ",
+    "   LLOL ",
+    "     O  ",
+    "    /_  ",
+    "    |\\  ",
+    "   / |  ",
+    " LOLLOL ",
+    // 22
+    "       ",
+    "_______",
+    "       ",
+    "       ",
+    "______/",
+    "       ",
+    "      _",
+    "_____/ ",
+    "       ",
+    "     _ ",
+    "____/ \\",
+    "       ",
+    "    _  ",
+    "___/ \\ ",
+    "      \\",
+    "   _   ",
+    "__/ \\  ",
+    "     \\_",
+    "  _    ",
+    "_/ \\   ",
+    "    \\_/",
+    " _     ",
+    "/ \\   _",
+    "   \\_/ ",
+    "_      ",
+    " \\   __",
+    "  \\_/  ",
+    "       ",
+    "\\   ___",
+    " \\_/   ",
+    "       ",
+    "    ___",
+    "\\_/    ",
+    "       ",
+    "  _____",
+    "_/     ",
+    "       ",
+    " ______",
+    "/      ",
+    "       ",
+    "_______",
+    "       ",
+};
+
+constexpr size_t LineCount() {
+  size_t count = 0;
+  for (const Charset& charset : charsets) {
+    count += size_t(charset.frames * charset.lines);
+  }
+  return count;
+}
+static_assert(LineCount() == std::size(lines), "The charsets don't match.");
+
+// A frame of a spinner. Its lines are drawn directly from the table, instead
+// of building a text Node for each of them.
+class Spinner : public Node {
+ public:
+  Spinner(const std::string_view* frame, int size)
+      : lines_(frame), size_(size) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 0;
+    for (int i = 0; i < size_; ++i) {
+      const GlyphRange glyphs = Utf8Glyphs(lines_[i]);  // NOLINT
+      requirement_.min_x = std::max(
+          requirement_.min_x, int(std::distance(glyphs.begin(), glyphs.end())));
+    }
+    requirement_.min_y = size_;
+  }
+
+  void Render(Screen& screen) override {
+    for (int i = 0; i < size_; ++i) {
+      const int y = box_.y_min + i;
+      if (y > box_.y_max) {
+        return;
+      }
+      int x = box_.x_min;
+      for (const std::string_view cell : Utf8Glyphs(lines_[i])) {  // NOLINT
+        if (x > box_.x_max) {
+          break;
+        }
+        screen.PixelAt(x++, y).character = cell;
+      }
+    }
+  }
+
+ private:
+  const std::string_view* lines_;
+  int size_;
 };
 
 }  // namespace
@@ -289,13 +353,15 @@ Element spinner(int charset_index, size_t image_index) {
     }
     return gauge(float(image_index) * 0.05F);  // NOLINT
   }
-  charset_index %= int(elements.size());
-  image_index %= int(elements[charset_index].size());
-  std::vector<Element> lines;
-  for (const auto& it : elements[charset_index][image_index]) {
-    lines.push_back(text(it));
+  charset_index %= int(std::size(charsets));
+  const std::string_view* frame = lines;
+  for (int i = 0; i < charset_index; ++i) {
+    frame += charsets[i].frames * charsets[i].lines;  // NOLINT
   }
-  return vbox(std::move(lines));
+  const Charset& charset = charsets[charset_index];
+  image_index %= size_t(charset.frames);
+  frame += image_index * size_t(charset.lines);  // NOLINT
+  return MakeNode<Spinner>(frame, charset.lines);
 }
 
 }  // namespace ftxui
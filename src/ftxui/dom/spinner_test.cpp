@@ -39,5 +39,26 @@ TEST(SpinnerTest, Spinner4) {
   EXPECT_EQ(screen.ToString(), ".   ");
 }
 
+TEST(SpinnerTest, MultipleLines) {
+  auto element = spinner(20, 8 + 1);
+  Screen screen(4, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "  ╮ \r\n"
+            "  │ \r\n"
+            "  ╯ ");
+  EXPECT_EQ(element->requirement().min_x, 3);
+  EXPECT_EQ(element->requirement().min_y, 3);
+}
+
+TEST(SpinnerTest, Clipped) {
+  auto element = spinner(20, 0);
+  Screen screen(2, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            " ─\r\n"
+            "  ");
+}
+
 }  // namespace ftxui
 // NOLINTEND
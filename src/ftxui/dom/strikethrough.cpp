@@ -1,35 +1,20 @@
 // Copyright 2023 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, strikethrough
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"   // for Element, strikethrough
+#include "ftxui/dom/style.hpp"      // for Styled
+#include "ftxui/screen/screen.hpp"  // for PixelStyle
 
 namespace ftxui {
 
 /// @brief Apply a strikethrough to text.
 /// @ingroup dom
 Element strikethrough(Element child) {
-  class Impl : public NodeDecorator {
-   public:
-    using NodeDecorator::NodeDecorator;
-
-    void Render(Screen& screen) override {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).strikethrough = true;
-        }
-      }
-      Node::Render(screen);
-    }
-  };
-
-  return std::make_shared<Impl>(std::move(child));
+  PixelStyle style;
+  style.fields = PixelStyle::kStrikethrough;
+  return Styled(std::move(child), style, {});
 }
 
 }  // namespace ftxui
@@ -0,0 +1,97 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/style.hpp"
+
+#include <cstdint>  // for uint16_t
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, style
+#include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for PixelStyle, Screen
+
+namespace ftxui {
+
+namespace {
+
+bool IsEmpty(const PixelStyle& style) {
+  return style.fields == 0 && !style.invert;
+}
+
+class Style : public NodeDecorator {
+ public:
+  Style(Element child, const PixelStyle& before, const PixelStyle& after)
+      : NodeDecorator(std::move(child)), before_(before), after_(after) {}
+
+  void Render(Screen& screen) override {
+    if (!IsEmpty(before_)) {
+      screen.ApplyStyle(box_, before_);
+    }
+    NodeDecorator::Render(screen);
+    if (!IsEmpty(after_)) {
+      screen.ApplyStyle(box_, after_);
+    }
+  }
+
+  // Wrap this Node with |before| and |after|. The decorator shares the box of
+  // its child, and nothing is drawn in between the styles being merged: the
+  // cells are styled exactly the same way.
+  void Wrap(const PixelStyle& before, const PixelStyle& after) {
+    PixelStyle merged = before;
+    merged.Then(before_);
+    before_ = merged;
+    after_.Then(after);
+  }
+
+ private:
+  PixelStyle before_;
+  PixelStyle after_;
+};
+
+}  // namespace
+
+Element Styled(Element child,
+               const PixelStyle& before,
+               const PixelStyle& after) {
+  if (child.use_count() == 1) {
+    if (auto* style = dynamic_cast<Style*>(child.get())) {
+      style->Wrap(before, after);
+      return child;
+    }
+  }
+  return MakeNode<Style>(std::move(child), before, after);
+}
+
+/// @brief Apply several attributes and colors at once. It is equivalent to
+/// the decorators setting them one by one, like `bold` or `color`, and makes
+/// a single Node with them.
+/// @param style The attributes and colors to set. Its hyperlink is ignored,
+/// use `hyperlink` instead.
+/// @param child The input element.
+/// @ingroup dom
+Element style(const PixelStyle& style, Element child) {
+  PixelStyle before = style;
+  before.fields &= uint16_t(~PixelStyle::kHyperlink);
+  return Styled(std::move(child), before, {});
+}
+
+/// @brief Decorate with several attributes and colors at once.
+/// @param style The attributes and colors to set.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// PixelStyle warning;
+/// warning.fields = PixelStyle::kBold | PixelStyle::kForeground;
+/// warning.foreground_color = Color::Yellow;
+/// Element document = text("Warning") | style(warning);
+/// ```
+Decorator style(const PixelStyle& style) {
+  return [style](Element child) { return ftxui::style(style, std::move(child)); };
+}
+
+}  // namespace ftxui
@@ -0,0 +1,22 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_STYLE_HPP
+#define FTXUI_DOM_STYLE_HPP
+
+#include "ftxui/dom/elements.hpp"   // for Element
+#include "ftxui/screen/screen.hpp"  // for PixelStyle
+
+namespace ftxui {
+
+// Draw |child|, applying |before| to its box before drawing it, and |after|
+// once it is drawn. This is how bold, dim, color, ... are implemented.
+//
+// When |child| was returned by Styled() and isn't shared, its Node is reused:
+// `text("a") | bold | color(Color::Red) | dim` makes a single Node, applying
+// its style in a single pass.
+Element Styled(Element child, const PixelStyle& before, const PixelStyle& after);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_STYLE_HPP
@@ -0,0 +1,83 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <cstddef>  // for size_t
+
+#include "ftxui/dom/elements.hpp"  // for operator|, text, bold, color, dim, inverted, bgcolor, style, Element
+#include "ftxui/dom/node.hpp"       // for Render, NodesConstructed
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+#include "gtest/gtest.h"  // for Test, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, TEST
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(StyleTest, SingleNode) {
+  const size_t before = NodesConstructed();
+  auto element = text("text") | bold | color(Color::Red) | dim | inverted |
+                 bgcolor(Color::Blue) | underlined;
+  EXPECT_EQ(NodesConstructed() - before, size_t(2));
+
+  Screen screen(5, 1);
+  Render(screen, element);
+  const Pixel& pixel = screen.PixelAt(0, 0);
+  EXPECT_TRUE(pixel.bold);
+  EXPECT_TRUE(pixel.dim);
+  EXPECT_TRUE(pixel.inverted);
+  EXPECT_TRUE(pixel.underlined);
+  EXPECT_EQ(pixel.foreground_color, Color(Color::Red));
+  EXPECT_EQ(pixel.background_color, Color(Color::Blue));
+}
+
+TEST(StyleTest, InnerColorWins) {
+  auto element = text("a") | color(Color::Red) | color(Color::Blue);
+  Screen screen(1, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color(Color::Red));
+}
+
+TEST(StyleTest, InvertedTwice) {
+  auto element = text("a") | inverted | inverted;
+  Screen screen(1, 1);
+  Render(screen, element);
+  EXPECT_FALSE(screen.PixelAt(0, 0).inverted);
+}
+
+TEST(StyleTest, SharedElement) {
+  Element shared = text("a") | bold;
+  Element red = shared | color(Color::Red);
+  Screen screen(1, 1);
+  Render(screen, red);
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color(Color::Red));
+
+  // |shared| is not modified by the color applied to it.
+  Screen other(1, 1);
+  Render(other, shared);
+  EXPECT_TRUE(other.PixelAt(0, 0).bold);
+  EXPECT_EQ(other.PixelAt(0, 0).foreground_color, Color());
+}
+
+TEST(StyleTest, Spec) {
+  PixelStyle spec;
+  spec.fields = PixelStyle::kBold | PixelStyle::kBackground;
+  spec.background_color = Color::Blue;
+  spec.invert = true;
+
+  const size_t before = NodesConstructed();
+  auto element = text("a") | style(spec) | color(Color::Red) | dim;
+  EXPECT_EQ(NodesConstructed() - before, size_t(2));
+
+  Screen screen(1, 1);
+  Render(screen, element);
+  const Pixel& pixel = screen.PixelAt(0, 0);
+  EXPECT_TRUE(pixel.bold);
+  EXPECT_TRUE(pixel.dim);
+  EXPECT_TRUE(pixel.inverted);
+  EXPECT_FALSE(pixel.underlined);
+  EXPECT_EQ(pixel.foreground_color, Color(Color::Red));
+  EXPECT_EQ(pixel.background_color, Color(Color::Blue));
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -3,11 +3,24 @@
 // the LICENSE file.
 #include "ftxui/dom/table.hpp"
 
-#include <algorithm>  // for max
+#include <algorithm>   // for max, min
+#include <cstddef>     // for size_t
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
 #include <memory>   // for allocator, shared_ptr, allocator_traits<>::value_type
+#include <string>       // for string
+#include <string_view>  // for string_view
 #include <utility>  // for move, swap
+#include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH
+#include "ftxui/dom/elements.hpp"  // for Element, operator|, text, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH, hbox, separator, virtualList
+#include "ftxui/dom/node.hpp"  // for Node
+#include "ftxui/dom/node_arena.hpp"      // for MakeNode
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/dom/requirement.hpp"     // for Requirement
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Pixel, PixelStyle, Screen
+#include "ftxui/screen/string_internal.hpp"  // for UpgradeLeftRight, UpgradeTopDown
 
 namespace ftxui {
 namespace {
@@ -17,7 +30,7 @@ bool IsCell(int x, int y) {
 }
 
 // NOLINTNEXTLINE
-static std::string charset[6][6] = {
+constexpr std::string_view charset[6][6] = {
     {"┌", "┐", "└", "┘", "─", "│"},  // LIGHT
     {"┏", "┓", "┗", "┛", "╍", "╏"},  // DASHED
     {"┏", "┓", "┗", "┛", "━", "┃"},  // HEAVY
@@ -26,6 +39,11 @@ static std::string charset[6][6] = {
     {" ", " ", " ", " ", " ", " "},  // EMPTY
 };
 
+// The character |index| of the |border| charset.
+std::string_view Glyph(BorderStyle border, int index) {
+  return charset[border][index];  // NOLINT
+}
+
 int Wrap(int input, int modulo) {
   input %= modulo;
   input += modulo;
@@ -41,6 +59,104 @@ void Order(int& a, int& b) {
 
 }  // namespace
 
+// A line, or a corner, of a table. It draws the glyph recorded by the table
+// for its slot. The glyphs of the corners are merged with their lines by
+// Table::Render(), before the layout.
+class TableLine : public Node {
+ public:
+  TableLine(std::shared_ptr<const Table::Glyphs> glyphs, int x, int y)
+      : glyphs_(std::move(glyphs)), x_(x), y_(y) {}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    // The corners take no space. The lines follow the size of the cells.
+    if (IsCorner()) {
+      return;
+    }
+    if (!glyph().empty()) {
+      requirement_.min_x = 1;
+      requirement_.min_y = 1;
+    }
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const std::string& value = glyph();
+    if (value.empty()) {
+      return;
+    }
+    // The pixels are still merged with the elements around the table.
+    screen.ForEachPixel(box_, [&](Pixel& pixel) {
+      pixel.automerge = true;
+      if (!IsCorner()) {
+        pixel.character = value;
+      }
+    });
+    if (IsCorner() && box_.x_min <= box_.x_max && box_.y_min <= box_.y_max) {
+      screen.PixelAt(box_.x_min, box_.y_min).character = value;
+    }
+  }
+
+ private:
+  bool IsCorner() const { return x_ % 2 == 0 && y_ % 2 == 0; }
+  const std::string& glyph() const { return (*glyphs_)[y_][x_]; }
+
+  std::shared_ptr<const Table::Glyphs> glyphs_;
+  int x_;
+  int y_;
+};
+
+// Apply the style rules of a table to the boxes of its elements, before they
+// are drawn, like decorators wrapping them would.
+class TableStyles : public NodeDecorator {
+ public:
+  TableStyles(Element grid,
+              std::vector<std::vector<Element>> elements,
+              std::vector<Table::StyleRule> rules)
+      : NodeDecorator(std::move(grid)),
+        elements_(std::move(elements)),
+        rules_(std::move(rules)) {}
+
+  void Render(Screen& screen) override {
+    for (const Table::StyleRule& rule : rules_) {
+      for (int y = rule.y_min; y <= rule.y_max; ++y) {
+        const std::vector<Element>& row = elements_[y];
+        const Box& row_box = row[rule.x_min]->box();
+        if (row_box.y_max < screen.stencil.y_min ||
+            row_box.y_min > screen.stencil.y_max) {
+          continue;
+        }
+        // The consecutive elements matching the rule are styled at once.
+        int x = rule.x_min;
+        while (x <= rule.x_max) {
+          if (!rule.Contains(x, y)) {
+            ++x;
+            continue;
+          }
+          Box box = row[x]->box();
+          while (++x <= rule.x_max && rule.Contains(x, y)) {
+            box = Box::Union(box, row[x]->box());
+          }
+          screen.ApplyStyle(box, rule.style);
+        }
+      }
+    }
+    NodeDecorator::Render(screen);
+  }
+
+ private:
+  std::vector<std::vector<Element>> elements_;
+  std::vector<Table::StyleRule> rules_;
+};
+
+bool Table::StyleRule::Contains(int x, int y) const {
+  return (!odd_x || x % 2 == 1) && (!odd_y || y % 2 == 1) &&
+         (x / 2) % x_modulo == x_shift && (y / 2) % y_modulo == y_shift;
+}
+
 /// @brief Create an empty table.
 /// @ingroup dom
 Table::Table() {
@@ -83,6 +199,7 @@ void Table::Initialize(std::vector<std::vector<Element>> input) {
   dim_x_ = 2 * input_dim_x_ + 1;
 
   // Reserve space.
+  glyphs_ = std::make_shared<Glyphs>(dim_y_, std::vector<std::string>(dim_x_));
   elements_.resize(dim_y_);
   for (int y = 0; y < dim_y_; ++y) {
     elements_[y].resize(dim_x_);
@@ -101,7 +218,7 @@ void Table::Initialize(std::vector<std::vector<Element>> input) {
     }
   }
 
-  // Add empty element for the border.
+  // Add the elements drawing the lines and the corners.
   for (int y = 0; y < dim_y_; ++y) {
     for (int x = 0; x < dim_x_; ++x) {
       auto& element = elements_[y][x];
@@ -113,11 +230,21 @@ void Table::Initialize(std::vector<std::vector<Element>> input) {
         continue;
       }
 
-      element = emptyElement();
+      element = MakeNode<TableLine>(glyphs_, x, y);
     }
   }
 }
 
+// private
+void Table::SetLine(int x, int y, std::string_view glyph) {
+  (*glyphs_)[y][x] = std::string(glyph);
+  // Like a new line would, this drops the decorators applied so far.
+  Element& element = elements_[y][x];
+  if (!dynamic_cast<TableLine*>(element.get())) {
+    element = MakeNode<TableLine>(glyphs_, x, y);
+  }
+}
+
 /// @brief Select a row of the table.
 /// @param index The index of the row to select.
 /// @note You can use negative index to select from the end.
@@ -204,29 +331,58 @@ TableSelection Table::SelectAll() {
 /// @return The rendered table. This is an element you can draw.
 /// @ingroup dom
 Element Table::Render() {
+  Glyphs& glyphs = *glyphs_;
   for (int y = 0; y < dim_y_; ++y) {
     for (int x = 0; x < dim_x_; ++x) {
-      auto& it = elements_[y][x];
-
-      // Line
-      if ((x + y) % 2 == 1) {
-        it = std::move(it) | flex;
-        continue;
-      }
-
       // Cells
-      if ((x % 2) == 1 && (y % 2) == 1) {
+      if (IsCell(x, y)) {
+        auto& it = elements_[y][x];
         it = std::move(it) | flex_shrink;
         continue;
       }
 
-      // Corners
-      it = std::move(it) | size(WIDTH, EQUAL, 0) | size(HEIGHT, EQUAL, 0);
+      // The decorated lines and corners are constrained like the bare ones.
+      auto& it = elements_[y][x];
+      const bool line = (x + y) % 2 == 1;
+      if (!dynamic_cast<TableLine*>(it.get())) {
+        it = line ? std::move(it) | flex
+                  : std::move(it) | size(WIDTH, EQUAL, 0) |
+                        size(HEIGHT, EQUAL, 0);
+      }
+
+      // Corners: connect them to the lines around, the way automerge would.
+      // The lines are left unchanged, since they are always drawn along the
+      // side they share with the corner.
+      std::string& corner = glyphs[y][x];
+      if (line || corner.empty()) {
+        continue;
+      }
+      if (x > 0) {
+        std::string left = glyphs[y][x - 1];
+        UpgradeLeftRight(left, corner);
+      }
+      if (x + 1 < dim_x_) {
+        std::string right = glyphs[y][x + 1];
+        UpgradeLeftRight(corner, right);
+      }
+      if (y > 0) {
+        std::string top = glyphs[y - 1][x];
+        UpgradeTopDown(top, corner);
+      }
+      if (y + 1 < dim_y_) {
+        std::string down = glyphs[y + 1][x];
+        UpgradeTopDown(corner, down);
+      }
     }
   }
   dim_x_ = 0;
   dim_y_ = 0;
-  return gridbox(std::move(elements_));
+  if (styles_.empty()) {
+    return gridbox(std::move(elements_));
+  }
+  std::vector<std::vector<Element>> elements = elements_;
+  return MakeNode<TableStyles>(gridbox(std::move(elements_)),
+                               std::move(elements), std::move(styles_));
 }
 
 /// @brief Apply the `decorator` to the selection.
@@ -339,6 +495,108 @@ void TableSelection::DecorateCellsAlternateRow(Decorator decorator,
   }
 }
 
+// private
+Table::StyleRule TableSelection::Rule(const PixelStyle& style) const {
+  Table::StyleRule rule;
+  rule.x_min = x_min_;
+  rule.x_max = x_max_;
+  rule.y_min = y_min_;
+  rule.y_max = y_max_;
+  rule.style = style;
+  return rule;
+}
+
+/// @brief Apply the `style` to the selection, like `Decorate` would, without
+/// wrapping the elements into decorators.
+/// This styles the cells, the lines and the corners.
+/// @param style The style to apply.
+/// @ingroup dom
+void TableSelection::Style(const PixelStyle& style) {
+  table_->styles_.push_back(Rule(style));
+}
+
+/// @brief Apply the `style` to the selection, like `DecorateAlternateRow`
+/// would, without wrapping the elements into decorators.
+/// This styles only the rows modulo `modulo` with a shift of `shift`.
+/// @param style The style to apply.
+/// @param modulo The modulo of the rows to style.
+/// @param shift The shift of the rows to style.
+/// @ingroup dom
+void TableSelection::StyleAlternateRow(const PixelStyle& style,
+                                       int modulo,
+                                       int shift) {
+  Table::StyleRule rule = Rule(style);
+  rule.y_min++;
+  rule.y_max--;
+  rule.odd_y = true;
+  rule.y_modulo = modulo;
+  rule.y_shift = shift;
+  table_->styles_.push_back(rule);
+}
+
+/// @brief Apply the `style` to the selection, like `DecorateAlternateColumn`
+/// would, without wrapping the elements into decorators.
+/// This styles only the columns modulo `modulo` with a shift of `shift`.
+/// @param style The style to apply.
+/// @param modulo The modulo of the columns to style.
+/// @param shift The shift of the columns to style.
+/// @ingroup dom
+void TableSelection::StyleAlternateColumn(const PixelStyle& style,
+                                          int modulo,
+                                          int shift) {
+  Table::StyleRule rule = Rule(style);
+  rule.odd_y = true;
+  rule.x_modulo = modulo;
+  rule.x_shift = shift;
+  table_->styles_.push_back(rule);
+}
+
+/// @brief Apply the `style` to the cells of the selection, like
+/// `DecorateCells` would, without wrapping them into decorators.
+/// @param style The style to apply.
+/// @ingroup dom
+void TableSelection::StyleCells(const PixelStyle& style) {
+  Table::StyleRule rule = Rule(style);
+  rule.odd_x = true;
+  rule.odd_y = true;
+  table_->styles_.push_back(rule);
+}
+
+/// @brief Apply the `style` to the cells of the selection, like
+/// `DecorateCellsAlternateColumn` would, without wrapping them into
+/// decorators.
+/// @param style The style to apply.
+/// @param modulo The modulo of the columns to style.
+/// @param shift The shift of the columns to style.
+/// @ingroup dom
+void TableSelection::StyleCellsAlternateColumn(const PixelStyle& style,
+                                               int modulo,
+                                               int shift) {
+  Table::StyleRule rule = Rule(style);
+  rule.odd_x = true;
+  rule.odd_y = true;
+  rule.x_modulo = modulo;
+  rule.x_shift = shift;
+  table_->styles_.push_back(rule);
+}
+
+/// @brief Apply the `style` to the cells of the selection, like
+/// `DecorateCellsAlternateRow` would, without wrapping them into decorators.
+/// @param style The style to apply.
+/// @param modulo The modulo of the rows to style.
+/// @param shift The shift of the rows to style.
+/// @ingroup dom
+void TableSelection::StyleCellsAlternateRow(const PixelStyle& style,
+                                            int modulo,
+                                            int shift) {
+  Table::StyleRule rule = Rule(style);
+  rule.odd_x = true;
+  rule.odd_y = true;
+  rule.y_modulo = modulo;
+  rule.y_shift = shift;
+  table_->styles_.push_back(rule);
+}
+
 /// @brief Apply a `border` around the selection.
 /// @param border The border style to apply.
 /// @ingroup dom
@@ -348,14 +606,10 @@ void TableSelection::Border(BorderStyle border) {
   BorderTop(border);
   BorderBottom(border);
 
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_min_] = text(charset[border][0]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_max_] = text(charset[border][1]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_min_] = text(charset[border][2]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_max_] = text(charset[border][3]) | automerge;
+  table_->SetLine(x_min_, y_min_, Glyph(border, 0));
+  table_->SetLine(x_max_, y_min_, Glyph(border, 1));
+  table_->SetLine(x_min_, y_max_, Glyph(border, 2));
+  table_->SetLine(x_max_, y_max_, Glyph(border, 3));
 }
 
 /// @brief Draw some separator lines in the selection.
@@ -365,10 +619,7 @@ void TableSelection::Separator(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (y % 2 == 0 || x % 2 == 0) {
-        Element& e = table_->elements_[y][x];
-        e = (y % 2 == 1)
-                ? separatorCharacter(charset[border][5]) | automerge   // NOLINT
-                : separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+        table_->SetLine(x, y, Glyph(border, (y % 2 == 1) ? 5 : 4));
       }
     }
   }
@@ -381,8 +632,7 @@ void TableSelection::SeparatorVertical(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (x % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+        table_->SetLine(x, y, Glyph(border, 5));
       }
     }
   }
@@ -395,8 +645,7 @@ void TableSelection::SeparatorHorizontal(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (y % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+        table_->SetLine(x, y, Glyph(border, 4));
       }
     }
   }
@@ -407,8 +656,7 @@ void TableSelection::SeparatorHorizontal(BorderStyle border) {
 /// @ingroup dom
 void TableSelection::BorderLeft(BorderStyle border) {
   for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_min_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+    table_->SetLine(x_min_, y, Glyph(border, 5));
   }
 }
 
@@ -417,8 +665,7 @@ void TableSelection::BorderLeft(BorderStyle border) {
 /// @ingroup dom
 void TableSelection::BorderRight(BorderStyle border) {
   for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_max_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+    table_->SetLine(x_max_, y, Glyph(border, 5));
   }
 }
 
@@ -427,8 +674,7 @@ void TableSelection::BorderRight(BorderStyle border) {
 /// @ingroup dom
 void TableSelection::BorderTop(BorderStyle border) {
   for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_min_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+    table_->SetLine(x, y_min_, Glyph(border, 4));
   }
 }
 
@@ -437,9 +683,74 @@ void TableSelection::BorderTop(BorderStyle border) {
 /// @ingroup dom
 void TableSelection::BorderBottom(BorderStyle border) {
   for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_max_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+    table_->SetLine(x, y_max_, Glyph(border, 4));
+  }
+}
+
+/// @brief Resolve the widths of 0 or less of a virtualTable. They are computed
+/// from a sample of up to 64 rows, evenly spread.
+/// @param rows The number of rows.
+/// @param widths The width of every column.
+/// @param cell A function building the cell at a given row and column.
+/// @see virtualTable
+/// @ingroup dom
+std::vector<int> virtualTableWidths(
+    int rows,
+    std::vector<int> widths,
+    const std::function<Element(int row, int column)>& cell) {
+  const int samples = std::min(rows, 64);  // NOLINT
+  for (size_t x = 0; x < widths.size(); ++x) {
+    if (widths[x] > 0) {
+      continue;
+    }
+    widths[x] = 0;
+    for (int i = 0; i < samples; ++i) {
+      const int row = int(int64_t(i) * rows / samples);
+      Element element = cell(row, int(x));
+      element->ComputeRequirement();
+      widths[x] = std::max(widths[x], element->requirement().min_x);
+    }
   }
+  return widths;
+}
+
+/// @brief A table whose cells are built on demand, only for the rows visible
+/// inside a `frame`. This allows displaying tables with a huge number of rows,
+/// at a cost proportional to the number of visible ones.
+/// @param rows The number of rows. Every row is one cell tall.
+/// @param widths The width of every column. A width of 0 or less is computed
+/// from a sample of the rows.
+/// @param cell A function building the cell at a given row and column.
+/// @param selected The index of the row to scroll to, when inside a `frame`.
+/// @see virtualList
+/// @see virtualTableWidths
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = virtualTable(
+///     metrics.size(), {20, 0}, [&](int row, int column) {
+///       return text(column == 0 ? metrics[row].name : metrics[row].value);
+///     }) | yframe;
+/// ```
+Element virtualTable(int rows,
+                     std::vector<int> widths,
+                     std::function<Element(int row, int column)> cell,
+                     int selected) {
+  widths = virtualTableWidths(rows, std::move(widths), cell);
+  auto row = [widths = std::move(widths), cell = std::move(cell)](int y) {
+    Elements cells;
+    cells.reserve(2 * widths.size());
+    for (size_t x = 0; x < widths.size(); ++x) {
+      if (x != 0) {
+        cells.push_back(separator());
+      }
+      cells.push_back(cell(y, int(x)) | size(WIDTH, EQUAL, widths[x]));
+    }
+    return hbox(std::move(cells));
+  };
+  return virtualList(rows, std::move(row), selected);
 }
 
 }  // namespace ftxui
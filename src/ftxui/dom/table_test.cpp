@@ -3,11 +3,15 @@
 // the LICENSE file.
 #include <gtest/gtest.h>
 #include <memory>  // for allocator
+#include <functional>  // for function
+#include <string>      // for string, to_string
+#include <vector>  // for vector
 
-#include "ftxui/dom/elements.hpp"  // for LIGHT, flex, center, EMPTY, DOUBLE
+#include "ftxui/dom/elements.hpp"  // for LIGHT, flex, center, EMPTY, DOUBLE, text, yframe
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/dom/table.hpp"
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, PixelStyle
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -734,5 +738,131 @@ TEST(TableTest, Merge) {
       screen.ToString());
 }
 
+TEST(TableTest, Virtual) {
+  int built = 0;
+  auto cell = [&](int row, int column) {
+    built++;
+    return text(std::to_string(row * (column + 1)));
+  };
+  auto element = virtualTable(1000, {3, 0}, cell, 500) | yframe;
+  // The second column is sampled from 64 rows.
+  EXPECT_EQ(built, 64);
+
+  Screen screen(8, 3);
+  Render(screen, element);
+  EXPECT_EQ(built, 64 + 6);
+  EXPECT_EQ(
+      "499│998 \r\n"
+      "500│1000\r\n"
+      "501│1002",
+      screen.ToString());
+}
+
+TEST(TableTest, VirtualWidths) {
+  auto cell = [](int row, int column) {
+    return text(std::string(row + column, 'x'));
+  };
+  EXPECT_EQ(virtualTableWidths(3, {0, 5, -1}, cell),
+            std::vector<int>({2, 5, 4}));
+  EXPECT_EQ(virtualTableWidths(0, {0, 5}, cell), std::vector<int>({0, 5}));
+}
+
+namespace {
+
+// Draw a table, whose selection |select| is styled by |style|.
+std::string DrawStyled(
+    const std::function<TableSelection(Table&)>& select,
+    const std::function<void(TableSelection&)>& style) {
+  auto table = Table({
+      {"a", "b", "c", "d"},
+      {"e", "f", "g", "h"},
+      {"i", "j", "k", "l"},
+      {"m", "n", "o", "p"},
+  });
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().Separator(LIGHT);
+  TableSelection selection = select(table);
+  style(selection);
+  Screen screen(9, 9);
+  Render(screen, table.Render());
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(TableTest, Style) {
+  PixelStyle style;
+  style.fields = PixelStyle::kBackground;
+  style.background_color = Color::Blue;
+  const Decorator decorator = bgcolor(Color::Blue);
+
+  const std::vector<std::function<TableSelection(Table&)>> selections = {
+      [](Table& table) { return table.SelectAll(); },
+      [](Table& table) { return table.SelectRows(1, 2); },
+      [](Table& table) { return table.SelectColumns(1, 3); },
+      [](Table& table) { return table.SelectRectangle(1, 2, 0, 2); },
+  };
+  for (const auto& select : selections) {
+    // Styling the selection draws the same as decorating it.
+    auto same = [&](const std::function<void(TableSelection&)>& decorate,
+                    const std::function<void(TableSelection&)>& styled) {
+      EXPECT_EQ(DrawStyled(select, decorate), DrawStyled(select, styled));
+    };
+    same([&](TableSelection& s) { s.Decorate(decorator); },
+         [&](TableSelection& s) { s.Style(style); });
+    same([&](TableSelection& s) { s.DecorateCells(decorator); },
+         [&](TableSelection& s) { s.StyleCells(style); });
+    same([&](TableSelection& s) { s.DecorateAlternateRow(decorator); },
+         [&](TableSelection& s) { s.StyleAlternateRow(style); });
+    same([&](TableSelection& s) { s.DecorateAlternateColumn(decorator, 3, 1); },
+         [&](TableSelection& s) { s.StyleAlternateColumn(style, 3, 1); });
+    same([&](TableSelection& s) { s.DecorateCellsAlternateRow(decorator); },
+         [&](TableSelection& s) { s.StyleCellsAlternateRow(style); });
+    same(
+        [&](TableSelection& s) { s.DecorateCellsAlternateColumn(decorator); },
+        [&](TableSelection& s) { s.StyleCellsAlternateColumn(style); });
+  }
+}
+
+TEST(TableTest, StyleNodes) {
+  PixelStyle style;
+  style.fields = PixelStyle::kBackground;
+  style.background_color = Color::Blue;
+
+  std::vector<std::vector<std::string>> rows(1000, {"a", "b"});
+  auto table = Table(rows);
+  table.SelectAll().StyleAlternateRow(style);
+  const size_t before = NodesConstructed();
+  Element element = table.Render() | yframe;
+  // The flex_shrink decorator of every cell, the gridbox, the styles and the
+  // frame. No node per styled row.
+  EXPECT_EQ(NodesConstructed() - before, size_t(2000 + 3));
+
+  Screen screen(5, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, Color(Color::Blue));
+  EXPECT_EQ(screen.PixelAt(1, 1).background_color, Color());
+}
+
+TEST(TableTest, BorderNodes) {
+  const size_t before = NodesConstructed();
+  std::vector<std::vector<std::string>> rows(100, {"a", "b"});
+  auto table = Table(rows);
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().Separator(LIGHT);
+  Element element = table.Render();
+  // A text and a flex_shrink decorator per cell, a single element per line or
+  // corner, and the gridbox.
+  EXPECT_EQ(NodesConstructed() - before, size_t(201 * 5 + 200 + 1));
+
+  Screen screen(5, 201);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "┌");
+  EXPECT_EQ(screen.PixelAt(1, 1).character, "a");
+  EXPECT_EQ(screen.PixelAt(2, 2).character, "┼");
+  EXPECT_EQ(screen.PixelAt(4, 2).character, "┤");
+  EXPECT_EQ(screen.PixelAt(2, 200).character, "┴");
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -1,60 +1,116 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <algorithm>  // for min
-#include <memory>     // for make_shared
-#include <string>     // for string, wstring
-#include <utility>    // for move
-#include <vector>     // for vector
+#include <algorithm>    // for max, min
+#include <memory>       // for shared_ptr
+#include <string>       // for string, wstring
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
 
 #include "ftxui/dom/deprecated.hpp"   // for text, vtext
-#include "ftxui/dom/elements.hpp"     // for Element, text, vtext
+#include "ftxui/dom/elements.hpp"     // for Element, text, textLines, textView, vtext, vtextView
+#include "ftxui/dom/measured_text.hpp"  // for MeasuredText, InternedString
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, to_string
+#include "ftxui/screen/string.hpp"    // for string_width, Utf8Glyphs, to_string
+#include "ftxui/screen/string_internal.hpp"  // for StringHeapBytes
 
 namespace ftxui {
 
 namespace {
+
+// Add a node of |node_size| bytes owning the text |owned| to |usage|.
+void AddText(ElementMemory* usage,
+             size_t node_size,
+             const std::string& owned) {
+  usage->bytes += node_size - sizeof(Node) + StringHeapBytes(owned);
+  usage->strings += owned.size();
+}
 using ftxui::Screen;
 
+// Draw |glyphs| on the first row of |box|.
+template <class Glyphs>
+void RenderGlyphs(Screen& screen, const Box& box, const Glyphs& glyphs) {
+  int x = box.x_min;
+  const int y = box.y_min;
+  if (y > box.y_max) {
+    return;
+  }
+  for (const std::string_view cell : glyphs) {
+    if (x > box.x_max) {
+      return;
+    }
+    if (cell == "\n") {
+      continue;
+    }
+    screen.PixelAt(x, y).character = cell;
+    ++x;
+  }
+}
+
 class Text : public Node {
  public:
-  explicit Text(std::string text) : text_(std::move(text)) {}
+  explicit Text(std::string text) : owned_(std::move(text)), text_(owned_) {}
+  explicit Text(std::string_view text) : text_(text) {}
 
   void ComputeRequirement() override {
-    requirement_.min_x = string_width(text_);
+    // The layout may be computed several times. The text is measured once.
+    if (width_ < 0) {
+      width_ = string_width(text_);
+    }
+    requirement_.min_x = width_;
     requirement_.min_y = 1;
   }
 
   void Render(Screen& screen) override {
-    int x = box_.x_min;
-    const int y = box_.y_min;
-    if (y > box_.y_max) {
-      return;
-    }
-    for (const auto& cell : Utf8ToGlyphs(text_)) {
-      if (x > box_.x_max) {
-        return;
-      }
-      if (cell == "\n") {
-        continue;
-      }
-      screen.PixelAt(x, y).character = cell;
-      ++x;
-    }
+    RenderGlyphs(screen, box_, Utf8Glyphs(text_));
+  }
+  void MemoryUsage(ElementMemory* usage) const override {
+    Node::MemoryUsage(usage);
+    AddText(usage, sizeof(Text), owned_);
+  }
+
+
+ private:
+  const std::string owned_;
+  const std::string_view text_;  // Either |owned_|, or owned by the caller.
+  int width_ = -1;
+};
+
+// A text measured in advance. Its glyphs are shared with the MeasuredText,
+// owned by |owner_|, or interned.
+class PreMeasuredText : public Node {
+ public:
+  explicit PreMeasuredText(std::shared_ptr<const MeasuredText> text)
+      : owner_(std::move(text)), text_(owner_.get()) {}
+  explicit PreMeasuredText(const MeasuredText* text) : text_(text) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = text_->width();
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    RenderGlyphs(screen, box_, text_->glyphs());
   }
 
  private:
-  std::string text_;
+  const std::shared_ptr<const MeasuredText> owner_;
+  const MeasuredText* const text_;
 };
 
 class VText : public Node {
  public:
   explicit VText(std::string text)
-      : text_(std::move(text)), width_{std::min(string_width(text_), 1)} {}
+      : owned_(std::move(text)),
+        text_(owned_),
+        width_{std::min(string_width(text_), 1)} {}
+  explicit VText(std::string_view text)
+      : text_(text), width_{std::min(string_width(text_), 1)} {}
 
   void ComputeRequirement() override {
     requirement_.min_x = width_;
@@ -67,7 +123,7 @@ class VText : public Node {
     if (x + width_ - 1 > box_.x_max) {
       return;
     }
-    for (const auto& it : Utf8ToGlyphs(text_)) {
+    for (const std::string_view it : Utf8Glyphs(text_)) {
       if (y > box_.y_max) {
         return;
       }
@@ -75,12 +131,94 @@ class VText : public Node {
       y += 1;
     }
   }
+  void MemoryUsage(ElementMemory* usage) const override {
+    Node::MemoryUsage(usage);
+    AddText(usage, sizeof(VText), owned_);
+  }
+
 
  private:
-  std::string text_;
+  const std::string owned_;
+  const std::string_view text_;  // Either |owned_|, or owned by the caller.
   int width_ = 1;
 };
 
+// Lines of text, one below the other. This draws the same thing as a vbox of
+// text, with a single Node: each line is at the offset of its index, and only
+// the lines inside the stencil are drawn.
+class TextLines : public Node {
+ public:
+  explicit TextLines(std::vector<std::string> lines)
+      : lines_(std::move(lines)) {}
+
+  void ComputeRequirement() override {
+    if (width_ < 0) {
+      width_ = 0;
+      for (const std::string& line : lines_) {
+        width_ = std::max(width_, string_width(line));
+      }
+    }
+    requirement_.min_x = width_;
+    requirement_.min_y = int(lines_.size());
+  }
+
+  void Render(Screen& screen) override {
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min({box_.y_max, screen.stencil.y_max,
+                                box_.y_min + int(lines_.size()) - 1});
+    for (int y = y_min; y <= y_max; ++y) {
+      const Box line = {box_.x_min, box_.x_max, y, y};
+      RenderGlyphs(screen, line, Utf8Glyphs(lines_[size_t(y - box_.y_min)]));
+    }
+  }
+  void MemoryUsage(ElementMemory* usage) const override {
+    Node::MemoryUsage(usage);
+    usage->bytes += sizeof(TextLines) - sizeof(Node);
+    usage->bytes += lines_.capacity() * sizeof(std::string);
+    for (const std::string& line : lines_) {
+      AddText(usage, sizeof(Node), line);
+    }
+  }
+
+
+ private:
+  const std::vector<std::string> lines_;
+  int width_ = -1;
+};
+
+// The same |glyph| repeated on |width| cells. The glyph is shared by all the
+// cells, instead of being copied into a string.
+class MaskedText : public Node {
+ public:
+  MaskedText(int width, std::string glyph)
+      : width_(std::max(0, width)), glyph_(std::move(glyph)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = width_;
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const int y = box_.y_min;
+    if (y > box_.y_max) {
+      return;
+    }
+    const int x_max = std::min(box_.x_max, box_.x_min + width_ - 1);
+    for (int x = box_.x_min; x <= x_max; ++x) {
+      screen.PixelAt(x, y).character = glyph_;
+    }
+  }
+  void MemoryUsage(ElementMemory* usage) const override {
+    Node::MemoryUsage(usage);
+    AddText(usage, sizeof(MaskedText), glyph_);
+  }
+
+
+ private:
+  int width_;
+  std::string glyph_;
+};
+
 }  // namespace
 
 /// @brief Display a piece of UTF8 encoded unicode text.
@@ -99,7 +237,7 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::string text) {
-  return std::make_shared<Text>(std::move(text));
+  return MakeNode<Text>(std::move(text));
 }
 
 /// @brief Display a piece of unicode text.
@@ -118,7 +256,88 @@ Element text(std::string text) {
 /// Hello world!
 /// ```
 Element text(std::wstring text) {  // NOLINT
-  return std::make_shared<Text>(to_string(text));
+  return MakeNode<Text>(to_string(text));
+}
+
+/// @brief Display a text measured in advance. It is neither decoded nor
+/// measured again.
+/// @ingroup dom
+/// @see MeasuredText
+///
+/// ### Example
+///
+/// ```cpp
+/// static const auto hello = MeasuredText::Make("Hello world!");
+/// Element document = text(hello);
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// Hello world!
+/// ```
+Element text(std::shared_ptr<const MeasuredText> text) {
+  return MakeNode<PreMeasuredText>(std::move(text));
+}
+
+/// @brief Display an interned string. It was measured when interned, and only
+/// a pointer to it is kept.
+/// @param text The interned string.
+/// @ingroup dom
+/// @see InternedString
+///
+/// ### Example
+///
+/// ```cpp
+/// static const InternedString unit("ms");
+/// Element document = hbox({text(std::to_string(latency)), text(unit)});
+/// ```
+Element text(InternedString text) {
+  return MakeNode<PreMeasuredText>(&text.measured());
+}
+
+/// @brief Display a piece of UTF8 encoded unicode text, without copying it.
+/// The text must outlive the rendering of the element.
+/// @ingroup dom
+/// @see text
+///
+/// ### Example
+///
+/// ```cpp
+/// // The lines stay in the ring buffer of the log.
+/// Elements lines;
+/// for (const std::string& line : log.lines()) {
+///   lines.push_back(textView(line));
+/// }
+/// Element document = vbox(std::move(lines));
+/// ```
+Element textView(std::string_view text) {
+  return MakeNode<Text>(text);
+}
+
+/// @brief Display lines of UTF8 encoded unicode text, one below the other.
+/// This is equivalent to a vbox of text, but uses a single Node: there is no
+/// layout to compute in between the lines, and only the visible ones are drawn.
+/// @ingroup dom
+/// @see text
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = textLines({
+///     "CPU: " + cpu,
+///     "Memory: " + memory,
+/// });
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// CPU: 12%
+/// Memory: 1.2GB
+/// ```
+Element textLines(std::vector<std::string> lines) {
+  return MakeNode<TextLines>(std::move(lines));
 }
 
 /// @brief Display a piece of unicode text vertically.
@@ -148,7 +367,15 @@ Element text(std::wstring text) {  // NOLINT
 /// !
 /// ```
 Element vtext(std::string text) {
-  return std::make_shared<VText>(std::move(text));
+  return MakeNode<VText>(std::move(text));
+}
+
+/// @brief Display a piece of UTF8 encoded unicode text vertically, without
+/// copying it. The text must outlive the rendering of the element.
+/// @ingroup dom
+/// @see vtext
+Element vtextView(std::string_view text) {
+  return MakeNode<VText>(text);
 }
 
 /// @brief Display a piece unicode text vertically.
@@ -178,7 +405,28 @@ Element vtext(std::string text) {
 /// !
 /// ```
 Element vtext(std::wstring text) {  // NOLINT
-  return std::make_shared<VText>(to_string(text));
+  return MakeNode<VText>(to_string(text));
+}
+
+/// @brief Display |glyph| repeated on |width| cells, without building the
+/// corresponding string. This is meant to hide a text, like a password.
+/// @param width The number of cells.
+/// @param glyph The glyph drawn in every cell. It must be one cell wide.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = maskedText(string_width(password));
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// ••••••••
+/// ```
+Element maskedText(int width, std::string glyph) {
+  return MakeNode<MaskedText>(width, std::move(glyph));
 }
 
 }  // namespace ftxui
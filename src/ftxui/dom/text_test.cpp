@@ -2,11 +2,14 @@
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
 #include <gtest/gtest.h>
-#include <string>  // for allocator, string
+#include <string>       // for allocator, string, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
-#include "ftxui/dom/elements.hpp"   // for text, operator|, border, Element
-#include "ftxui/dom/node.hpp"       // for Render
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/dom/elements.hpp"  // for text, textLines, textView, vtextView, operator|, border, yframe, focusPosition, Element
+#include "ftxui/dom/measured_text.hpp"  // for MeasuredText, InternedString
+#include "ftxui/dom/node.hpp"           // for Render, NodesConstructed
+#include "ftxui/screen/screen.hpp"      // for Screen
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -52,6 +55,7 @@ TEST(TextTest, ScreenBigger2) {
 }
 
 // See https://github.com/ArthurSonzogni/FTXUI/issues/2#issuecomment-504871456
+#if !defined(FTXUI_NO_UNICODE_TABLES)
 TEST(TextTest, CJK) {
   auto element = text("测试") | border;
   Screen screen(6, 3);
@@ -62,8 +66,10 @@ TEST(TextTest, CJK) {
       "╰────╯",
       screen.ToString());
 }
+#endif
 
 // See https://github.com/ArthurSonzogni/FTXUI/issues/2#issuecomment-504871456
+#if !defined(FTXUI_NO_UNICODE_TABLES)
 TEST(TextTest, CJK_2) {
   auto element = text("测试") | border;
   Screen screen(5, 3);
@@ -74,8 +80,10 @@ TEST(TextTest, CJK_2) {
       "╰───╯",
       screen.ToString());
 }
+#endif
 
 // See https://github.com/ArthurSonzogni/FTXUI/issues/2#issuecomment-504871456
+#if !defined(FTXUI_NO_UNICODE_TABLES)
 TEST(TextTest, CJK_3) {
   auto element = text("测试") | border;
   Screen screen(4, 3);
@@ -120,6 +128,118 @@ TEST(TextTest, CombiningCharactersWithSpace) {
   Render(screen, element);
   EXPECT_EQ(t, screen.ToString());
 }
+#endif
+
+TEST(TextTest, MaskedText) {
+  auto element = maskedText(3) | border;
+  Screen screen(6, 3);
+  Render(screen, element);
+  EXPECT_EQ(
+      "╭────╮\r\n"
+      "│••• │\r\n"
+      "╰────╯",
+      screen.ToString());
+}
+
+TEST(TextTest, MaskedTextClipped) {
+  auto element = maskedText(5, "*");
+  Screen screen(3, 1);
+  Render(screen, element);
+  EXPECT_EQ("***", screen.ToString());
+}
+
+#if !defined(FTXUI_NO_UNICODE_TABLES)
+TEST(TextTest, MeasuredText) {
+  auto measured = MeasuredText::Make("a测b");
+  EXPECT_EQ(measured->width(), 4);
+  EXPECT_EQ(measured->glyphs().size(), 4u);
+
+  auto element = hbox({text(measured), text("|")});
+  Screen screen(6, 1);
+  Render(screen, element);
+  EXPECT_EQ("a测b| ", screen.ToString());
+}
+#endif
+
+TEST(TextTest, MeasuredTextIntern) {
+  auto a = MeasuredText::Intern("interned");
+  auto b = MeasuredText::Intern(std::string("interned"));
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a->str(), "interned");
+  EXPECT_NE(a, MeasuredText::Intern("other"));
+}
+
+#if !defined(FTXUI_NO_UNICODE_TABLES)
+TEST(TextTest, InternedString) {
+  const InternedString a("a测b");
+  const InternedString b(std::string("a测b"));
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(&a.measured(), &b.measured());
+  EXPECT_EQ(&a.measured(), MeasuredText::Intern("a测b").get());
+  EXPECT_NE(a, InternedString("other"));
+  EXPECT_EQ(a.width(), 4);
+  EXPECT_EQ(InternedString().str(), "");
+
+  // The label is referenced, not copied.
+  const ConstStringRef label = a;
+  EXPECT_EQ(&label(), &a.str());
+
+  auto element = hbox({text(a), text("|")});
+  Screen screen(6, 1);
+  Render(screen, element);
+  EXPECT_EQ("a测b| ", screen.ToString());
+}
+
+TEST(TextTest, TextView) {
+  // The elements point into the buffer, without copying it.
+  const std::string buffer = "line 1\nline 2 测";
+  const std::string_view view(buffer);
+  auto element = vbox({
+      textView(view.substr(0, 6)),
+      textView(view.substr(7)),
+      hbox({vtextView(view.substr(0, 4))}),
+  });
+  Screen screen(9, 6);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "line 1   \r\n"
+            "line 2 测\r\n"
+            "l        \r\n"
+            "i        \r\n"
+            "n        \r\n"
+            "e        ");
+}
+#endif
+
+TEST(TextTest, TextLines) {
+  auto lines = [] { return std::vector<std::string>{"a", "bcd 测", "", "e"}; };
+  Elements texts;
+  for (const std::string& line : lines()) {
+    texts.push_back(text(line));
+  }
+  Screen expected(7, 5);
+  Render(expected, vbox(std::move(texts)) | border);
+
+  const size_t before = NodesConstructed();
+  auto element = textLines(lines());
+  EXPECT_EQ(NodesConstructed() - before, size_t(1));
+  Screen screen(7, 5);
+  Render(screen, element | border);
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+TEST(TextTest, TextLinesFrame) {
+  std::vector<std::string> lines;
+  for (int i = 0; i < 1000; ++i) {
+    lines.push_back("line " + std::to_string(i));
+  }
+  auto element = textLines(std::move(lines)) | focusPosition(0, 500) | yframe;
+  Screen screen(8, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "line 500\r\n"
+            "line 501");
+}
 
 }  // namespace ftxui
 // NOLINTEND
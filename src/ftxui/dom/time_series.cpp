@@ -0,0 +1,42 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/time_series.hpp"
+
+#include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
+#include <mutex>      // for lock_guard, mutex
+
+namespace ftxui {
+
+/// @brief Constructor.
+/// @param capacity the number of samples kept. At least one is kept.
+/// @param min the value displayed at the bottom of the graph.
+/// @param max the value displayed at the top of the graph.
+TimeSeries::TimeSeries(size_t capacity, float min, float max)
+    : values_(std::max(capacity, size_t(1))), min_(min), max_(max) {}
+
+/// @brief Add a sample. The oldest one is dropped when the series is full.
+/// This can be called from any thread.
+void TimeSeries::Push(float value) {
+  value = std::max(min_, std::min(max_, value));
+  const std::lock_guard<std::mutex> lock(mutex_);
+  values_[head_] = value;
+  head_ = (head_ + 1) % values_.size();
+  size_ = std::min(size_ + 1, values_.size());
+}
+
+/// @brief Remove every sample.
+void TimeSeries::Clear() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  head_ = 0;
+  size_ = 0;
+}
+
+/// @brief The number of samples held, at most `capacity()`.
+size_t TimeSeries::size() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,111 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+#include <thread>  // for thread
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"     // for graph
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/time_series.hpp"  // for TimeSeries
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(TimeSeriesTest, Empty) {
+  auto series = std::make_shared<TimeSeries>(6, 0.f, 3.f);
+  Screen screen(3, 2);
+  Render(screen, graph(series));
+  EXPECT_EQ(screen.ToString(), "   \r\n   ");
+}
+
+TEST(TimeSeriesTest, OneSamplePerColumn) {
+  auto series = std::make_shared<TimeSeries>(6, 0.f, 3.f);
+  for (float value : {0.f, 1.f, 2.f, 3.f, 2.f, 1.f}) {
+    series->Push(value);
+  }
+  Screen screen(3, 2);
+  Render(screen, graph(series));
+  EXPECT_EQ(screen.ToString(),
+            " ▟▙\r\n"
+            "▟▘▝");
+}
+
+TEST(TimeSeriesTest, PartiallyFilled) {
+  auto series = std::make_shared<TimeSeries>(6, 0.f, 3.f);
+  series->Push(3.f);
+  series->Push(0.f);
+  EXPECT_EQ(series->size(), 2u);
+  Screen screen(3, 2);
+  Render(screen, graph(series));
+  EXPECT_EQ(screen.ToString(),
+            "  ▜\r\n"
+            "  ▐");
+}
+
+TEST(TimeSeriesTest, RingBuffer) {
+  auto series = std::make_shared<TimeSeries>(2, 0.f, 3.f);
+  for (float value : {3.f, 3.f, 3.f, 0.f, 0.f}) {
+    series->Push(value);
+  }
+  EXPECT_EQ(series->size(), 2u);
+  Screen screen(1, 2);
+  Render(screen, graph(series));
+  EXPECT_EQ(screen.ToString(),
+            " \r\n"
+            "▄");
+
+  series->Clear();
+  EXPECT_EQ(series->size(), 0u);
+  Render(screen, graph(series));
+  EXPECT_EQ(screen.ToString(), " \r\n ");
+}
+
+TEST(TimeSeriesTest, Clamped) {
+  auto series = std::make_shared<TimeSeries>(2, 0.f, 3.f);
+  series->Push(-10.f);
+  series->Push(10.f);
+  Screen screen(1, 2);
+  Render(screen, graph(series));
+  EXPECT_EQ(screen.ToString(),
+            "▐\r\n"
+            "▟");
+}
+
+TEST(TimeSeriesTest, Decimated) {
+  // 25 samples per column. A single spike shows up.
+  auto series = std::make_shared<TimeSeries>(100, 0.f, 3.f);
+  for (int i = 0; i < 100; ++i) {
+    series->Push(i == 60 ? 3.f : 0.f);
+  }
+  Screen screen(2, 2);
+  Render(screen, graph(series));
+  EXPECT_EQ(screen.ToString(),
+            " ▌\r\n"
+            "▄▙");
+}
+
+TEST(TimeSeriesTest, PushFromThreads) {
+  auto series = std::make_shared<TimeSeries>(64, 0.f, 1.f);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 1000; ++i) {
+        series->Push(float(i % 2));
+      }
+    });
+  }
+  Screen screen(8, 4);
+  for (int i = 0; i < 100; ++i) {
+    Render(screen, graph(series));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(series->size(), 64u);
+}
+
+}  // namespace ftxui
+// NOLINTEND
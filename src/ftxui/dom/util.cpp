@@ -9,6 +9,7 @@
 #include <vector>       // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, Elements, operator|, Fit, emptyElement, nothing, operator|=
+#include "ftxui/dom/layout_cache.hpp"  // for KeepLayout
 #include "ftxui/dom/node.hpp"      // for Node, Node::Status
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -97,8 +98,8 @@ Dimensions Dimension::Fit(Element& e) {
   Box box;
   box.x_min = 0;
   box.y_min = 0;
-  box.x_max = fullsize.dimx;
-  box.y_max = fullsize.dimy;
+  box.x_max = fullsize.dimx - 1;
+  box.y_max = fullsize.dimy - 1;
 
   Node::Status status;
   e->Check(&status);
@@ -107,8 +108,8 @@ Dimensions Dimension::Fit(Element& e) {
     e->ComputeRequirement();
 
     // Don't give the element more space than it needs:
-    box.x_max = std::min(box.x_max, e->requirement().min_x);
-    box.y_max = std::min(box.y_max, e->requirement().min_y);
+    box.x_max = std::min(box.x_max, e->requirement().min_x - 1);
+    box.y_max = std::min(box.y_max, e->requirement().min_y - 1);
 
     e->SetBox(box);
     status.need_iteration = false;
@@ -116,17 +117,20 @@ Dimensions Dimension::Fit(Element& e) {
     e->Check(&status);
 
     if (!status.need_iteration) {
+      // The element is laid out in the box of a screen of this size. Render()
+      // can reuse it.
+      KeepLayout(e, box);
       break;
     }
     // Increase the size of the box until it fits, but not more than the with of
     // the terminal emulator:
-    box.x_max = std::min(e->requirement().min_x, fullsize.dimx);
-    box.y_max = std::min(e->requirement().min_y, fullsize.dimy);
+    box.x_max = std::min(e->requirement().min_x, fullsize.dimx) - 1;
+    box.y_max = std::min(e->requirement().min_y, fullsize.dimy) - 1;
   }
 
   return {
-      box.x_max,
-      box.y_max,
+      box.x_max + 1,
+      box.y_max + 1,
   };
 }
 
@@ -3,13 +3,14 @@
 // the LICENSE file.
 #include <algorithm>  // for max
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, vbox
 #include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 
@@ -29,7 +30,7 @@ class VBox : public Node {
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->UpdateRequirement();
       if (requirement_.selection < child->requirement().selection) {
         requirement_.selection = child->requirement().selection;
         requirement_.selected_box = child->requirement().selected_box;
@@ -45,7 +46,7 @@ class VBox : public Node {
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    std::vector<box_helper::Element> elements(children_.size());
+    box_helper::ElementBuffer elements(children_.size());
     for (size_t i = 0; i < children_.size(); ++i) {
       auto& element = elements[i];
       const auto& requirement = children_[i]->requirement();
@@ -54,13 +55,13 @@ class VBox : public Node {
       element.flex_shrink = requirement.flex_shrink_y;
     }
     const int target_size = box.y_max - box.y_min + 1;
-    box_helper::Compute(&elements, target_size);
+    box_helper::Compute(elements.data(), elements.size(), target_size);
 
     int y = box.y_min;
     for (size_t i = 0; i < children_.size(); ++i) {
       box.y_min = y;
       box.y_max = y + elements[i].size - 1;
-      children_[i]->SetBox(box);
+      children_[i]->UpdateBox(box);
       y = box.y_max + 1;
     }
   }
@@ -81,7 +82,7 @@ class VBox : public Node {
 /// });
 /// ```
 Element vbox(Elements children) {
-  return std::make_shared<VBox>(std::move(children));
+  return MakeNode<VBox>(std::move(children));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,103 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>   // for max, min
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, virtualList
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/node_arena.hpp"   // for MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::SELECTED
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/autoreset.hpp"   // for AutoReset
+
+namespace ftxui {
+
+namespace {
+
+class VirtualList : public Node {
+ public:
+  VirtualList(int size, std::function<Element(int)> row, int selected)
+      : size_(std::max(0, size)),
+        row_(std::move(row)),
+        selected_(std::clamp(selected, 0, std::max(0, size - 1))) {}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    requirement_.min_y = size_;
+    requirement_.flex_grow_x = 1;
+    if (size_ != 0) {
+      requirement_.selection = Requirement::SELECTED;
+      requirement_.selected_box.y_min = selected_;
+      requirement_.selected_box.y_max = selected_;
+    }
+  }
+
+  // The rows are only built here, once the visible area is known.
+  void Render(Screen& screen) override {
+    const Box visible = Box::Intersection(box_, screen.stencil);
+    const int begin = std::max(visible.y_min, box_.y_min);
+    const int end = std::min(visible.y_max, box_.y_min + size_ - 1);
+    for (int y = begin; y <= end; ++y) {
+      Box row_box = box_;
+      row_box.y_min = y;
+      row_box.y_max = y;
+
+      Element row = row_(y - box_.y_min);
+      Layout(row.get(), row_box);
+
+      const AutoReset<Box> stencil(&screen.stencil,
+                                   Box::Intersection(row_box, visible));
+      row->Render(screen);
+    }
+  }
+
+ private:
+  static void Layout(Node* node, Box box) {
+    Status status;
+    node->Check(&status);
+    const int max_iterations = 20;
+    while (status.need_iteration && status.iteration < max_iterations) {
+      node->ComputeRequirement();
+      node->SetBox(box);
+      status.need_iteration = false;
+      status.iteration++;
+      node->Check(&status);
+    }
+  }
+
+  const int size_;
+  const std::function<Element(int)> row_;
+  const int selected_;
+};
+
+}  // namespace
+
+/// @brief A vertical list of |size| rows, one cell tall each. The rows are
+/// built on demand by calling |row|, only for the ones visible on the screen.
+/// Since the rows aren't known in advance, the list expands horizontally.
+/// This allows displaying huge lists inside a `frame`, at a cost proportional
+/// to the number of visible rows.
+/// @param size The number of rows.
+/// @param row A function building the row at a given index.
+/// @param selected The index of the row to scroll to, when inside a `frame`.
+/// @see frame
+/// @see yframe
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<std::string> lines = ReadLogFile();
+/// Element document = virtualList(
+///     lines.size(), [&](int i) { return text(lines[i]); }, selected) |
+///     yframe;
+/// ```
+Element virtualList(int size, std::function<Element(int)> row, int selected) {
+  return MakeNode<VirtualList>(size, std::move(row), selected);
+}
+
+}  // namespace ftxui
@@ -0,0 +1,72 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for allocator, to_string
+
+#include "ftxui/dom/elements.hpp"  // for virtualList, text, yframe, border, vbox, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(VirtualListTest, Basic) {
+  int built = 0;
+  auto row = [&](int i) {
+    built++;
+    return text(std::to_string(i));
+  };
+  auto element = virtualList(3, row);
+  Screen screen(2, 4);
+  Render(screen, element);
+  EXPECT_EQ(built, 3);
+  EXPECT_EQ(screen.ToString(),
+            "0 \r\n"
+            "1 \r\n"
+            "2 \r\n"
+            "  ");
+}
+
+TEST(VirtualListTest, OnlyVisibleRowsAreBuilt) {
+  int built = 0;
+  auto row = [&](int i) {
+    built++;
+    return text(std::to_string(i));
+  };
+  auto element = virtualList(100000, row, 50000) | yframe | border;
+  Screen screen(7, 5);
+  Render(screen, element);
+  EXPECT_EQ(built, 3);
+  EXPECT_EQ(screen.ToString(),
+            "╭─────╮\r\n"
+            "│49999│\r\n"
+            "│50000│\r\n"
+            "│50001│\r\n"
+            "╰─────╯");
+}
+
+TEST(VirtualListTest, RowsAreClipped) {
+  auto row = [](int i) {
+    return vbox({text("a" + std::to_string(i)), text("b")});
+  };
+  auto element = virtualList(2, row);
+  Screen screen(2, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "a0\r\n"
+            "a1\r\n"
+            "  ");
+}
+
+TEST(VirtualListTest, Empty) {
+  auto element = virtualList(0, [](int) { return text("x"); }) | yframe;
+  Screen screen(2, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "  \r\n"
+            "  ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
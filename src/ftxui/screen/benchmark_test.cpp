@@ -0,0 +1,97 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <benchmark/benchmark.h>
+#include <string>  // for string
+
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, CellToGlyphIndex, to_wstring
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+// A mix of ASCII, accented, full width and combining characters.
+std::string Sample(int repeat) {
+  std::string content;
+  for (int i = 0; i < repeat; ++i) {
+    content += "Hello, world! éàü ＨＥＬＬＯ 測試 á ";
+  }
+  return content;
+}
+}  // namespace
+
+// Screen serialization ------------------------------------------------------
+
+static void BenchmarkScreenToStringPlain(benchmark::State& state) {
+  Screen screen(state.range(0), state.range(0) / 2);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      screen.PixelAt(x, y).character = char('a' + (x + y) % 26);
+    }
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(screen.ToString());
+  }
+}
+BENCHMARK(BenchmarkScreenToStringPlain)->RangeMultiplier(2)->Range(16, 256);
+
+static void BenchmarkScreenToStringStyled(benchmark::State& state) {
+  Screen screen(state.range(0), state.range(0) / 2);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      Pixel& pixel = screen.PixelAt(x, y);
+      pixel.character = char('a' + (x + y) % 26);
+      pixel.bold = (x % 3) == 0;
+      pixel.underlined = (y % 2) == 0;
+      pixel.foreground_color = Color::RGB(x % 256, y % 256, 128);
+      pixel.background_color = Color::Palette256((x + y) % 256);
+    }
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(screen.ToString());
+  }
+}
+BENCHMARK(BenchmarkScreenToStringStyled)->RangeMultiplier(2)->Range(16, 256);
+
+// String functions ----------------------------------------------------------
+
+static void BenchmarkStringWidth(benchmark::State& state) {
+  const std::string content = Sample(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(string_width(content));
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(content.size()));
+}
+BENCHMARK(BenchmarkStringWidth)->RangeMultiplier(8)->Range(1, 4096);
+
+static void BenchmarkUtf8ToGlyphs(benchmark::State& state) {
+  const std::string content = Sample(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Utf8ToGlyphs(content));
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(content.size()));
+}
+BENCHMARK(BenchmarkUtf8ToGlyphs)->RangeMultiplier(8)->Range(1, 4096);
+
+static void BenchmarkCellToGlyphIndex(benchmark::State& state) {
+  const std::string content = Sample(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CellToGlyphIndex(content));
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(content.size()));
+}
+BENCHMARK(BenchmarkCellToGlyphIndex)->RangeMultiplier(8)->Range(1, 4096);
+
+static void BenchmarkToWString(benchmark::State& state) {
+  const std::string content = Sample(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(to_wstring(content));
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(content.size()));
+}
+BENCHMARK(BenchmarkToWString)->RangeMultiplier(8)->Range(1, 4096);
+
+}  // namespace ftxui
+// NOLINTEND
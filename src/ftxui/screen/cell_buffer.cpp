@@ -0,0 +1,97 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/cell_buffer.hpp"
+
+#include <algorithm>  // for equal, copy
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t, uint8_t
+
+#include "ftxui/screen/color.hpp"          // for Color
+#include "ftxui/screen/compact_pixel.hpp"  // for CompactPixel
+#include "ftxui/screen/screen.hpp"         // for Pixel, Screen
+
+namespace ftxui {
+
+namespace {
+
+// Past this many interned graphemes, the table is cleared, and every cell is
+// converted again.
+constexpr size_t kMaxGraphemes = 4096;
+
+uint32_t ColorWord(const Color& color) {
+  uint8_t red = 0;
+  uint8_t green = 0;
+  uint8_t blue = 0;
+  if (!color.ToRGB(&red, &green, &blue)) {
+    return 0;
+  }
+  return CellBuffer::kColorSet | (uint32_t(red) << 16) |  // NOLINT
+         (uint32_t(green) << 8) | uint32_t(blue);         // NOLINT
+}
+
+void Convert(const Pixel& pixel, GraphemeTable& graphemes, uint32_t* out) {
+  const CompactPixel compact = CompactPixel::Pack(pixel, graphemes);
+  uint32_t flags = 0;
+  flags |= pixel.blink ? uint32_t(CellBuffer::kBlink) : 0U;
+  flags |= pixel.bold ? uint32_t(CellBuffer::kBold) : 0U;
+  flags |= pixel.dim ? uint32_t(CellBuffer::kDim) : 0U;
+  flags |= pixel.inverted ? uint32_t(CellBuffer::kInverted) : 0U;
+  flags |= pixel.underlined ? uint32_t(CellBuffer::kUnderlined) : 0U;
+  flags |=
+      pixel.underlined_double ? uint32_t(CellBuffer::kUnderlinedDouble) : 0U;
+  flags |= pixel.strikethrough ? uint32_t(CellBuffer::kStrikethrough) : 0U;
+  flags |= compact.interned ? uint32_t(CellBuffer::kInterned) : 0U;
+  out[0] = compact.grapheme;
+  out[1] = ColorWord(pixel.foreground_color);
+  out[2] = ColorWord(pixel.background_color);
+  out[3] = flags;
+}
+
+}  // namespace
+
+/// @brief Copy the cells of |screen|, and record the rows that changed.
+/// @return Whether any cell changed.
+/// @ingroup screen
+bool CellBuffer::Update(const Screen& screen) {
+  const Screen::Cursor cursor = screen.cursor();
+  cursor_[0] = cursor.x;
+  cursor_[1] = cursor.y;
+  cursor_[2] = cursor.shape;
+
+  bool all = screen.dimx() != dimx_ || screen.dimy() != dimy_;
+  if (graphemes_.size() > kMaxGraphemes) {
+    graphemes_.Clear();
+    all = true;
+  }
+  if (all) {
+    dimx_ = screen.dimx();
+    dimy_ = screen.dimy();
+    cells_.assign(size_t(dimx_) * size_t(dimy_) * kWordsPerCell, 0);
+    row_frames_.assign(size_t(dimy_), 0);
+  }
+
+  const uint32_t frame = frame_ + 1;
+  bool changed = all;
+  const size_t row_words = size_t(dimx_) * kWordsPerCell;
+  std::vector<uint32_t> row(row_words);
+  for (int y = 0; y < dimy_; ++y) {
+    for (int x = 0; x < dimx_; ++x) {
+      Convert(screen.PixelAt(x, y), graphemes_,
+              row.data() + size_t(x) * kWordsPerCell);
+    }
+    uint32_t* cells = cells_.data() + size_t(y) * row_words;
+    if (!all && std::equal(row.begin(), row.end(), cells)) {
+      continue;
+    }
+    std::copy(row.begin(), row.end(), cells);
+    row_frames_[size_t(y)] = frame;
+    changed = true;
+  }
+  if (changed) {
+    frame_ = frame;
+  }
+  return changed;
+}
+
+}  // namespace ftxui
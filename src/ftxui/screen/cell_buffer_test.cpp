@@ -0,0 +1,91 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/cell_buffer.hpp"
+#include <gtest/gtest.h>
+#include "ftxui/screen/color.hpp"
+#include "ftxui/screen/screen.hpp"
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+const uint32_t* Cell(const CellBuffer& cells, int x, int y) {
+  return cells.cells() + (y * cells.dimx() + x) * CellBuffer::kWordsPerCell;
+}
+
+}  // namespace
+
+TEST(CellBufferTest, Cells) {
+  Screen screen(3, 2);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(0, 0).foreground_color = Color::RGB(1, 2, 3);
+  screen.PixelAt(1, 0).character = "é";
+  screen.PixelAt(1, 0).background_color = Color::Red;
+  screen.PixelAt(0, 1).character = "👨‍👩‍👧";
+  screen.PixelAt(0, 1).underlined_double = true;
+
+  CellBuffer cells;
+  EXPECT_TRUE(cells.Update(screen));
+  EXPECT_EQ(cells.dimx(), 3);
+  EXPECT_EQ(cells.dimy(), 2);
+
+  EXPECT_EQ(Cell(cells, 0, 0)[0], uint32_t('a'));
+  EXPECT_EQ(Cell(cells, 0, 0)[1], 0xFF010203u);
+  EXPECT_EQ(Cell(cells, 0, 0)[2], 0u);
+  EXPECT_EQ(Cell(cells, 0, 0)[3], uint32_t(CellBuffer::kBold));
+
+  // The UTF-8 bytes, from the lowest one.
+  EXPECT_EQ(Cell(cells, 1, 0)[0], 0xA9C3u);
+  EXPECT_EQ(Cell(cells, 1, 0)[1], 0u);
+  EXPECT_EQ(Cell(cells, 1, 0)[2], 0xFF800000u);
+
+  EXPECT_EQ(Cell(cells, 2, 0)[0], uint32_t(' '));
+
+  // The graphemes longer than 4 bytes are interned.
+  const uint32_t* interned = Cell(cells, 0, 1);
+  EXPECT_EQ(interned[3], CellBuffer::kUnderlinedDouble | CellBuffer::kInterned);
+  EXPECT_EQ(cells.Grapheme(interned[0]), "👨‍👩‍👧");
+}
+
+TEST(CellBufferTest, RowFrames) {
+  Screen screen(2, 3);
+  CellBuffer cells;
+  EXPECT_TRUE(cells.Update(screen));
+  EXPECT_EQ(cells.frame(), 1u);
+
+  // Nothing changed.
+  EXPECT_FALSE(cells.Update(screen));
+  EXPECT_EQ(cells.frame(), 1u);
+
+  // Only the rows changed are marked.
+  screen.PixelAt(1, 1).character = "x";
+  EXPECT_TRUE(cells.Update(screen));
+  EXPECT_EQ(cells.frame(), 2u);
+  EXPECT_EQ(cells.row_frames()[0], 1u);
+  EXPECT_EQ(cells.row_frames()[1], 2u);
+  EXPECT_EQ(cells.row_frames()[2], 1u);
+
+  // Resizing changes every row.
+  Screen larger(2, 4);
+  EXPECT_TRUE(cells.Update(larger));
+  EXPECT_EQ(cells.frame(), 3u);
+  for (int y = 0; y < 4; ++y) {
+    EXPECT_EQ(cells.row_frames()[y], 3u);
+  }
+}
+
+TEST(CellBufferTest, Cursor) {
+  Screen screen(4, 4);
+  screen.SetCursor({2, 3, Screen::Cursor::Bar});
+  CellBuffer cells;
+  cells.Update(screen);
+  EXPECT_EQ(cells.cursor()[0], 2);
+  EXPECT_EQ(cells.cursor()[1], 3);
+  EXPECT_EQ(cells.cursor()[2], int(Screen::Cursor::Bar));
+}
+
+}  // namespace ftxui
+// NOLINTEND
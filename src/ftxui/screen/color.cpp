@@ -3,7 +3,8 @@
 // the LICENSE file.
 #include "ftxui/screen/color.hpp"
 
-#include <array>  // for array
+#include <algorithm>  // for min
+#include <array>      // for array
 #include <cmath>
 #include <cstdint>
 #include <string_view>  // for literals
@@ -35,34 +36,151 @@ const std::array<const char*, 33> palette16code = {
     "97", "107",  //
 };
 
-}  // namespace
+// Append the decimal representation of |value|. This is a faster
+// std::to_string, writing directly into |output|.
+void AppendDecimal(std::string& output, uint8_t value) {
+  if (value >= 100) {                       // NOLINT
+    output += char('0' + value / 100);      // NOLINT
+  }
+  if (value >= 10) {                        // NOLINT
+    output += char('0' + value / 10 % 10);  // NOLINT
+  }
+  output += char('0' + value % 10);         // NOLINT
+}
 
-bool Color::operator==(const Color& rhs) const {
-  return red_ == rhs.red_ && green_ == rhs.green_ && blue_ == rhs.blue_ &&
-         type_ == rhs.type_;
+int Distance(int r1, int g1, int b1, int r2, int g2, int b2) {
+  const int dr = r1 - r2;
+  const int dg = g1 - g2;
+  const int db = b1 - b2;
+  return dr * dr + dg * dg + db * db;
+}
+
+// The levels of each channel of the 6x6x6 color cube, colors 16 to 231.
+constexpr std::array<int, 6> cube_levels = {0, 95, 135, 175, 215, 255};
+
+// The index of the cube level closest to |value|, the lowest one on ties.
+int CubeLevel(int value) {
+  if (value < 48) {  // NOLINT
+    return 0;
+  }
+  if (value < 116) {  // NOLINT
+    return 1;
+  }
+  return (value - 36) / 40;  // NOLINT
 }
 
-bool Color::operator!=(const Color& rhs) const {
-  return !operator==(rhs);
+// The color of the 256 colors palette, from 16 to 255, closest to the given
+// one. This is the color with the lowest index minimizing the euclidean
+// distance, but computed from the structure of the palette instead of
+// comparing the 240 colors:
+// - The closest color of the cube uses the closest level of each channel.
+// - The closest of the 24 grays (8, 18, ..., 238) is the one closest to the
+//   mean of the channels.
+int ClosestPalette256(int red, int green, int blue) {
+  const int cube_red = CubeLevel(red);
+  const int cube_green = CubeLevel(green);
+  const int cube_blue = CubeLevel(blue);
+  const int cube_distance = Distance(cube_levels[cube_red],    // NOLINT
+                                     cube_levels[cube_green],  // NOLINT
+                                     cube_levels[cube_blue],   // NOLINT
+                                     red, green, blue);
+
+  const int sum = red + green + blue;
+  const int gray = sum <= 39 ? 0 : std::min(23, (sum - 10) / 30);  // NOLINT
+  const int gray_level = 8 + 10 * gray;                            // NOLINT
+  const int gray_distance =
+      Distance(gray_level, gray_level, gray_level, red, green, blue);
+
+  if (cube_distance <= gray_distance) {
+    return 16 + 36 * cube_red + 6 * cube_green + cube_blue;  // NOLINT
+  }
+  return 232 + gray;  // NOLINT
 }
 
+}  // namespace
+
+/// @brief Return the SGR parameters selecting this color, downsampled to the
+/// colors supported by the terminal.
+/// @param is_background_color Whether this is a background or foreground color.
+/// @ingroup screen
 std::string Color::Print(bool is_background_color) const {
-  switch (type_) {
+  std::string output;
+  Print(is_background_color, output);
+  return output;
+}
+
+/// @brief Append to |output| the SGR parameters selecting this color, without
+/// any intermediate allocations.
+/// @param is_background_color Whether this is a background or foreground color.
+/// @param output The buffer to append to.
+/// @ingroup screen
+void Color::Print(bool is_background_color, std::string& output) const {
+  Print(is_background_color, output, Terminal::ColorSupport());
+}
+
+/// @brief Append to |output| the SGR parameters selecting this color, for a
+/// terminal supporting |color_support|.
+/// @param is_background_color Whether this is a background or foreground color.
+/// @param output The buffer to append to.
+/// @param color_support The colors supported by the terminal.
+/// @ingroup screen
+void Color::Print(bool is_background_color,
+                  std::string& output,
+                  Terminal::Color color_support) const {
+  const Color color = Downsample(color_support);
+  switch (color.type_) {
     case ColorType::Palette1:
-      return is_background_color ? "49"s : "39"s;
+      output += is_background_color ? "49"sv : "39"sv;
+      return;
 
     case ColorType::Palette16:
-      return palette16code[2 * red_ + is_background_color];  // NOLINT;
+      output += palette16code[2 * color.red_ + is_background_color];  // NOLINT;
+      return;
 
     case ColorType::Palette256:
-      return (is_background_color ? "48;5;"s : "38;5;"s) + std::to_string(red_);
+      output += is_background_color ? "48;5;"sv : "38;5;"sv;
+      AppendDecimal(output, color.red_);
+      return;
 
     case ColorType::TrueColor:
     default:
-      return (is_background_color ? "48;2;"s : "38;2;"s)  //
-             + std::to_string(red_) + ";"                 //
-             + std::to_string(green_) + ";"               //
-             + std::to_string(blue_);                     //
+      output += is_background_color ? "48;2;"sv : "38;2;"sv;
+      AppendDecimal(output, color.red_);
+      output += ';';
+      AppendDecimal(output, color.green_);
+      output += ';';
+      AppendDecimal(output, color.blue_);
+      return;
+  }
+}
+
+/// @brief The closest color displayable by a terminal supporting
+/// |color_support|.
+/// @param color_support The colors supported by the terminal.
+/// @ingroup screen
+Color Color::Downsample(Terminal::Color color_support) const {
+  switch (type_) {
+    case ColorType::Palette256:
+      if (color_support >= Terminal::Color::Palette256) {
+        return *this;
+      }
+      return Color::Palette16(GetColorInfo(Color::Palette256(red_)).index_16);
+
+    case ColorType::TrueColor: {
+      if (color_support == Terminal::Color::TrueColor) {
+        return *this;
+      }
+      const auto best = Color::Palette256(ClosestPalette256(red_, green_, blue_));
+      if (color_support == Terminal::Color::Palette256) {
+        return best;
+      }
+      return Color::Palette16(GetColorInfo(best).index_16);
+    }
+
+    case ColorType::Palette1:
+    case ColorType::Palette16:
+    default:
+      return *this;
   }
 }
 
@@ -80,13 +198,7 @@ Color::Color(Palette16 index) : type_(ColorType::Palette16), red_(index) {}
 
 /// @brief Build a transparent using Palette256 colors.
 /// @ingroup screen
-Color::Color(Palette256 index) : type_(ColorType::Palette256), red_(index) {
-  if (Terminal::ColorSupport() >= Terminal::Color::Palette256) {
-    return;
-  }
-  type_ = ColorType::Palette16;
-  red_ = GetColorInfo(Color::Palette256(red_)).index_16;
-}
+Color::Color(Palette256 index) : type_(ColorType::Palette256), red_(index) {}
 
 /// @brief Build a Color from its RGB representation.
 /// https://en.wikipedia.org/wiki/RGB_color_model
@@ -96,37 +208,7 @@ Color::Color(Palette256 index) : type_(ColorType::Palette256), red_(index) {
 /// @param blue The quantity of blue [0,255]
 /// @ingroup screen
 Color::Color(uint8_t red, uint8_t green, uint8_t blue)
-    : type_(ColorType::TrueColor), red_(red), green_(green), blue_(blue) {
-  if (Terminal::ColorSupport() == Terminal::Color::TrueColor) {
-    return;
-  }
-
-  // Find the closest Color from the database:
-  const int max_distance = 256 * 256 * 3;
-  int closest = max_distance;
-  int best = 0;
-  const int database_begin = 16;
-  const int database_end = 256;
-  for (int i = database_begin; i < database_end; ++i) {
-    const ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    const int dr = color_info.red - red;
-    const int dg = color_info.green - green;
-    const int db = color_info.blue - blue;
-    const int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
-
-  if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
-    type_ = ColorType::Palette256;
-    red_ = best;
-  } else {
-    type_ = ColorType::Palette16;
-    red_ = GetColorInfo(Color::Palette256(best)).index_16;
-  }
-}
+    : type_(ColorType::TrueColor), red_(red), green_(green), blue_(blue) {}
 
 /// @brief Build a Color from its RGB representation.
 /// https://en.wikipedia.org/wiki/RGB_color_model
@@ -172,49 +254,69 @@ Color Color::HSV(uint8_t h, uint8_t s, uint8_t v) {
   return {0, 0, 0};
 }
 
-// static
-Color Color::Interpolate(float t, const Color& a, const Color& b) {
-  if (a.type_ == ColorType::Palette1 ||  //
-      b.type_ == ColorType::Palette1) {
-    if (t < 0.5F) {  // NOLINT
-      return a;
-    } else {
-      return b;
+/// @brief Return the red, green and blue components of the color. The palette
+/// colors use the xterm values.
+/// @return false for the terminal's default color, which has none. The
+/// components are then left untouched.
+bool Color::ToRGB(uint8_t* red, uint8_t* green, uint8_t* blue) const {
+  switch (type_) {
+    case ColorType::Palette1:
+      return false;
+
+    case ColorType::Palette16: {
+      const ColorInfo info = GetColorInfo(Color::Palette16(red_));
+      *red = info.red;
+      *green = info.green;
+      *blue = info.blue;
+      return true;
     }
-  }
 
-  auto get_color = [](const Color& color,  //
-                      uint8_t* red, uint8_t* green, uint8_t* blue) {
-    switch (color.type_) {
-      case ColorType::Palette1: {
-        return;
-      }
+    case ColorType::Palette256: {
+      const ColorInfo info = GetColorInfo(Color::Palette256(red_));
+      *red = info.red;
+      *green = info.green;
+      *blue = info.blue;
+      return true;
+    }
 
-      case ColorType::Palette16: {
-        const ColorInfo info = GetColorInfo(Color::Palette16(color.red_));
-        *red = info.red;
-        *green = info.green;
-        *blue = info.blue;
-        return;
-      }
+    case ColorType::TrueColor:
+    default:
+      *red = red_;
+      *green = green_;
+      *blue = blue_;
+      return true;
+  }
+}
 
-      case ColorType::Palette256: {
-        const ColorInfo info = GetColorInfo(Color::Palette256(color.red_));
-        *red = info.red;
-        *green = info.green;
-        *blue = info.blue;
-        return;
-      }
+// static
+Color Color::Interpolate(float t, const Color& a, const Color& b) {
+  Color out;
+  Interpolate(&t, 1, a, b, &out);
+  return out;
+}
 
-      case ColorType::TrueColor:
-      default: {
-        *red = color.red_;
-        *green = color.green_;
-        *blue = color.blue_;
-        return;
-      }
+/// @brief Interpolate in between |a| and |b|, once per value of |t|. This is
+/// the same as calling Interpolate for every value, but the work depending
+/// only on the two colors is done once.
+/// @param t The |size| positions in between |a| and |b|, in [0,1].
+/// @param size The number of colors to interpolate.
+/// @param a The color at 0.
+/// @param b The color at 1.
+/// @param out Receive the |size| colors.
+/// @ingroup screen
+// static
+void Color::Interpolate(const float* t,
+                        size_t size,
+                        const Color& a,
+                        const Color& b,
+                        Color* out) {
+  if (a.type_ == ColorType::Palette1 ||  //
+      b.type_ == ColorType::Palette1) {
+    for (size_t i = 0; i < size; ++i) {
+      out[i] = t[i] < 0.5F ? a : b;  // NOLINT
     }
-  };
+    return;
+  }
 
   uint8_t a_r = 0;
   uint8_t a_g = 0;
@@ -222,22 +324,29 @@ Color Color::Interpolate(float t, const Color& a, const Color& b) {
   uint8_t b_r = 0;
   uint8_t b_g = 0;
   uint8_t b_b = 0;
-  get_color(a, &a_r, &a_g, &a_b);
-  get_color(b, &b_r, &b_g, &b_b);
+  a.ToRGB(&a_r, &a_g, &a_b);
+  b.ToRGB(&b_r, &b_g, &b_b);
 
   // Gamma correction:
   // https://en.wikipedia.org/wiki/Gamma_correction
-  auto interp = [t](uint8_t a_u, uint8_t b_u) {
-    constexpr float gamma = 2.2F;
-    const float a_f = powf(a_u, gamma);
-    const float b_f = powf(b_u, gamma);
-    const float c_f = a_f * (1.0F - t) +  //
-                      b_f * t;
-    return static_cast<uint8_t>(powf(c_f, 1.F / gamma));
-  };
-  return Color::RGB(interp(a_r, b_r),   //
-                    interp(a_g, b_g),   //
-                    interp(a_b, b_b));  //
+  constexpr float gamma = 2.2F;
+  const float a_rf = powf(a_r, gamma);
+  const float a_gf = powf(a_g, gamma);
+  const float a_bf = powf(a_b, gamma);
+  const float b_rf = powf(b_r, gamma);
+  const float b_gf = powf(b_g, gamma);
+  const float b_bf = powf(b_b, gamma);
+  for (size_t i = 0; i < size; ++i) {
+    const float u = t[i];  // NOLINT
+    auto interp = [u](float a_f, float b_f) {
+      const float c_f = a_f * (1.0F - u) +  //
+                        b_f * u;
+      return static_cast<uint8_t>(powf(c_f, 1.F / gamma));
+    };
+    out[i] = Color::RGB(interp(a_rf, b_rf),   // NOLINT
+                        interp(a_gf, b_gf),   //
+                        interp(a_bf, b_bf));  //
+  }
 }
 
 inline namespace literals {
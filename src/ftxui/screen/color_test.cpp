@@ -3,6 +3,10 @@
 // the LICENSE file.
 #include "ftxui/screen/color.hpp"
 #include <gtest/gtest.h>
+#include <string>   // for string, to_string
+#include <utility>  // for pair
+#include <vector>   // for vector
+#include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
 #include "ftxui/screen/terminal.hpp"
 
 namespace ftxui {
@@ -36,11 +40,57 @@ TEST(ColorTest, FallbackTo256) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "38;5;16");
 }
 
+TEST(ColorTest, FallbackTo256Closest) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  // Compare with the closest color of the palette, the first one on ties.
+  for (int r = 0; r < 256; r += 5) {
+    for (int g = 0; g < 256; g += 3) {
+      for (int b = 0; b < 256; b += 7) {
+        int closest = 1 << 30;
+        int best = 0;
+        for (int i = 16; i < 256; ++i) {
+          const ColorInfo info = GetColorInfo(Color::Palette256(i));
+          const int dr = info.red - r;
+          const int dg = info.green - g;
+          const int db = info.blue - b;
+          const int distance = dr * dr + dg * dg + db * db;
+          if (distance < closest) {
+            closest = distance;
+            best = i;
+          }
+        }
+        ASSERT_EQ(Color::RGB(r, g, b).Print(false),
+                  "38;5;" + std::to_string(best))
+            << r << " " << g << " " << b;
+      }
+    }
+  }
+}
+
 TEST(ColorTest, FallbackTo16) {
   Terminal::SetColorSupport(Terminal::Color::Palette16);
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "30");
 }
 
+TEST(ColorTest, Downsample) {
+  // Colors keep their value. They are downsampled when printed.
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const Color color = Color::RGB(1, 2, 3);
+  EXPECT_EQ(color.Downsample(Terminal::Color::TrueColor), color);
+  EXPECT_EQ(color.Downsample(Terminal::Color::Palette256),
+            Color(Color::Grey0));
+  EXPECT_EQ(color.Downsample(Terminal::Color::Palette16), Color(Color::Black));
+
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  EXPECT_EQ(color.Print(false), "38;5;16");
+  std::string output;
+  color.Print(true, output, Terminal::Color::Palette16);
+  EXPECT_EQ(output, "40");
+
+  EXPECT_EQ(Color(Color::DarkRed).Downsample(Terminal::Color::Palette16),
+            Color(Color::Red));
+}
+
 TEST(ColorTest, Litterals) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   using namespace ftxui::literals;
@@ -78,9 +128,35 @@ TEST(ColorTest, Interpolate) {
             "38;2;251;198;225");
 }
 
+TEST(ColorTest, InterpolateBatch) {
+  const float t[] = {0.F, 0.3F, 0.7F, 1.F};
+  const std::vector<std::pair<Color, Color>> pairs = {
+      {Color::RGB(1, 2, 3), Color::RGB(244, 244, 123)},
+      {Color(Color::Red), Color(Color::Plum1)},
+      {Color::Red, Color()},
+  };
+  for (const auto& [a, b] : pairs) {
+    Color out[4];
+    Color::Interpolate(t, 4, a, b, out);
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_EQ(out[i], Color::Interpolate(t[i], a, b));
+    }
+  }
+}
+
 TEST(ColorTest, HSV) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   EXPECT_EQ(Color::HSV(0, 255, 255).Print(false), "38;2;255;0;0");
 }
 
+TEST(ColorTest, PrintAppend) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::string output = "[";
+  Color().Print(false, output);
+  Color(Color::Red).Print(true, output);
+  Color(Color::DarkRed).Print(false, output);
+  Color::RGB(0, 10, 255).Print(true, output);
+  EXPECT_EQ(output, "[394138;5;5248;2;0;10;255");
+}
+
 }  // namespace ftxui
@@ -0,0 +1,129 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/compact_pixel.hpp"
+
+#include <cstdint>  // for uint32_t, uint8_t
+#include <string>   // for string
+
+#include "ftxui/screen/screen.hpp"  // for Pixel
+
+namespace ftxui {
+
+static_assert(sizeof(CompactPixel) <= 16,  // NOLINT
+              "CompactPixel is expected to fit in 16 bytes");
+
+/// @brief Return the id of |grapheme|, storing it if it wasn't already.
+/// @param grapheme The grapheme to store.
+/// @ingroup screen
+uint32_t GraphemeTable::Intern(const std::string& grapheme) {
+  auto [it, inserted] = ids_.try_emplace(grapheme, graphemes_.size());
+  if (inserted) {
+    graphemes_.push_back(grapheme);
+  }
+  return it->second;
+}
+
+/// @brief Return the grapheme identified by |id|, or an empty string if there
+/// are none.
+/// @ingroup screen
+const std::string& GraphemeTable::Get(uint32_t id) const {
+  static const std::string empty;
+  return id < graphemes_.size() ? graphemes_[id] : empty;
+}
+
+/// @brief Remove every graphemes from the table.
+/// @ingroup screen
+void GraphemeTable::Clear() {
+  graphemes_.clear();
+  ids_.clear();
+}
+
+/// @brief Convert a Pixel into a CompactPixel.
+/// @param pixel The pixel to convert.
+/// @param table The table storing the graphemes longer than 4 bytes.
+/// @ingroup screen
+// static
+CompactPixel CompactPixel::Pack(const Pixel& pixel, GraphemeTable& table) {
+  CompactPixel out;
+  out.blink = pixel.blink;
+  out.bold = pixel.bold;
+  out.dim = pixel.dim;
+  out.inverted = pixel.inverted;
+  out.underlined = pixel.underlined;
+  out.underlined_double = pixel.underlined_double;
+  out.strikethrough = pixel.strikethrough;
+  out.automerge = pixel.automerge;
+  out.hyperlink = pixel.hyperlink;
+  out.background_color = pixel.background_color;
+  out.foreground_color = pixel.foreground_color;
+
+  const std::string& character = pixel.character;
+  if (character.size() > sizeof(out.grapheme)) {
+    out.interned = true;
+    out.grapheme = table.Intern(character);
+    return out;
+  }
+
+  out.grapheme = 0;
+  for (size_t i = 0; i < character.size(); ++i) {
+    out.grapheme |= uint32_t(uint8_t(character[i])) << (8 * i);  // NOLINT
+  }
+  return out;
+}
+
+/// @brief Convert a CompactPixel back into a Pixel.
+/// @param table The table used to Pack() this pixel.
+/// @ingroup screen
+Pixel CompactPixel::Unpack(const GraphemeTable& table) const {
+  Pixel out;
+  out.blink = blink;
+  out.bold = bold;
+  out.dim = dim;
+  out.inverted = inverted;
+  out.underlined = underlined;
+  out.underlined_double = underlined_double;
+  out.strikethrough = strikethrough;
+  out.automerge = automerge;
+  out.hyperlink = hyperlink;
+  out.background_color = background_color;
+  out.foreground_color = foreground_color;
+
+  if (interned) {
+    out.character = table.Get(grapheme);
+    return out;
+  }
+
+  out.character.clear();
+  for (uint32_t bytes = grapheme; bytes != 0; bytes >>= 8) {  // NOLINT
+    out.character += char(bytes & 0xFF);                       // NOLINT
+  }
+  return out;
+}
+
+/// @brief Return whether two CompactPixel are identical. Comparing interned
+/// graphemes is only meaningful when both pixels share the same table.
+/// @ingroup screen
+bool CompactPixel::operator==(const CompactPixel& other) const {
+  return grapheme == other.grapheme &&                    //
+         blink == other.blink &&                          //
+         bold == other.bold &&                            //
+         dim == other.dim &&                              //
+         inverted == other.inverted &&                    //
+         underlined == other.underlined &&                //
+         underlined_double == other.underlined_double &&  //
+         strikethrough == other.strikethrough &&          //
+         automerge == other.automerge &&                  //
+         interned == other.interned &&                    //
+         hyperlink == other.hyperlink &&                  //
+         background_color == other.background_color &&    //
+         foreground_color == other.foreground_color;
+}
+
+/// @brief Return whether two CompactPixel are different.
+/// @ingroup screen
+bool CompactPixel::operator!=(const CompactPixel& other) const {
+  return !operator==(other);
+}
+
+}  // namespace ftxui
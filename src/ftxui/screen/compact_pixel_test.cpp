@@ -0,0 +1,64 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/compact_pixel.hpp"
+#include <gtest/gtest.h>
+#include "ftxui/screen/color.hpp"
+#include "ftxui/screen/screen.hpp"
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(CompactPixelTest, Size) {
+  EXPECT_LE(sizeof(CompactPixel), 16u);
+}
+
+TEST(CompactPixelTest, Default) {
+  GraphemeTable table;
+  const Pixel pixel = CompactPixel().Unpack(table);
+  EXPECT_EQ(pixel.character, " ");
+  EXPECT_EQ(CompactPixel::Pack(Pixel(), table), CompactPixel());
+}
+
+TEST(CompactPixelTest, RoundTrip) {
+  GraphemeTable table;
+  for (const char* character : {"", "a", "é", "测", "🎉", "a⃦", "👨‍👩‍👧"}) {
+    Pixel pixel;
+    pixel.character = character;
+    pixel.bold = true;
+    pixel.underlined_double = true;
+    pixel.hyperlink = 1000;
+    pixel.foreground_color = Color::Red;
+    pixel.background_color = Color::RGB(1, 2, 3);
+
+    const Pixel out = CompactPixel::Pack(pixel, table).Unpack(table);
+    EXPECT_EQ(out.character, pixel.character);
+    EXPECT_TRUE(out.bold);
+    EXPECT_FALSE(out.dim);
+    EXPECT_TRUE(out.underlined_double);
+    EXPECT_EQ(out.hyperlink, 1000);
+    EXPECT_EQ(out.foreground_color, pixel.foreground_color);
+    EXPECT_EQ(out.background_color, pixel.background_color);
+  }
+
+  // Only the graphemes longer than 4 bytes are interned.
+  EXPECT_EQ(table.size(), 1u);
+}
+
+TEST(CompactPixelTest, Interned) {
+  GraphemeTable table;
+  Pixel a;
+  a.character = "é⃦";
+  Pixel b;
+  b.character = "è⃦";
+  EXPECT_EQ(CompactPixel::Pack(a, table), CompactPixel::Pack(a, table));
+  EXPECT_NE(CompactPixel::Pack(a, table), CompactPixel::Pack(b, table));
+  EXPECT_EQ(table.size(), 2u);
+
+  table.Clear();
+  EXPECT_EQ(table.size(), 0u);
+  EXPECT_EQ(table.Get(0), "");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,401 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/frame_recorder.hpp"
+
+#include <chrono>       // for microseconds, duration_cast, steady_clock
+#include <cstdint>      // for uint8_t, uint64_t
+#include <cstring>      // for memcpy
+#include <limits>       // for numeric_limits
+#include <mutex>        // for lock_guard, unique_lock
+#include <optional>     // for optional, nullopt
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/screen/color.hpp"          // for Color
+#include "ftxui/screen/compact_pixel.hpp"  // for CompactPixel, GraphemeTable
+#include "ftxui/screen/screen.hpp"         // for Pixel, Screen
+
+namespace ftxui {
+
+// The log starts with a magic and a version byte. Then, every frame is:
+// - A type byte: kKeyframe or kDelta.
+// - The size of the payload, as a varint.
+// - The payload, as varints: the microseconds since the previous frame, the
+//   dimensions, the number of hyperlinks first used by this frame, their URLs,
+//   the number of cells, then the cells. Each cell is preceded by the number
+//   of cells skipped since the previous one, unchanged.
+//
+// The hyperlinks are numbered from 1, in the order they are first used since
+// the last keyframe. A URL is its size, then its bytes.
+//
+// A cell is a byte of style flags, the hyperlink as a varint, the foreground
+// and background colors, then the grapheme size and bytes.
+
+namespace {
+
+constexpr std::string_view kMagic = "FTXF";
+constexpr char kVersion = 2;
+constexpr char kKeyframe = 0;
+constexpr char kDelta = 1;
+
+// Past this many interned graphemes, or hyperlinks, the tables are cleared,
+// and a keyframe is recorded.
+constexpr size_t kMaxGraphemes = 4096;
+constexpr size_t kMaxHyperlinks = 4096;
+
+// A Color is stored as its 4 bytes.
+static_assert(sizeof(Color) == 4, "Color is expected to fit in 4 bytes");
+
+void AppendVarint(std::string& out, uint64_t value) {
+  while (value >= 0x80) {                         // NOLINT
+    out.push_back(char((value & 0x7F) | 0x80));   // NOLINT
+    value >>= 7;                                  // NOLINT
+  }
+  out.push_back(char(value));
+}
+
+// Consume a varint from the front of |data|.
+std::optional<uint64_t> EatVarint(std::string_view& data) {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {  // NOLINT
+    if (data.empty()) {
+      return std::nullopt;
+    }
+    const auto byte = uint8_t(data.front());
+    data.remove_prefix(1);
+    value |= uint64_t(byte & 0x7F) << shift;  // NOLINT
+    if ((byte & 0x80) == 0) {                 // NOLINT
+      return value;
+    }
+  }
+  return std::nullopt;
+}
+
+void AppendColor(std::string& out, const Color& color) {
+  char bytes[sizeof(Color)];  // NOLINT
+  std::memcpy(bytes, &color, sizeof(Color));
+  out.append(bytes, sizeof(Color));
+}
+
+bool EatColor(std::string_view& data, Color* color) {
+  if (data.size() < sizeof(Color)) {
+    return false;
+  }
+  std::memcpy(color, data.data(), sizeof(Color));
+  data.remove_prefix(sizeof(Color));
+  return true;
+}
+
+// Consume a size and as many bytes from the front of |data|.
+std::optional<std::string_view> EatString(std::string_view& data) {
+  const auto size = EatVarint(data);
+  if (!size || *size > data.size()) {
+    return std::nullopt;
+  }
+  const std::string_view value = data.substr(0, *size);
+  data.remove_prefix(*size);
+  return value;
+}
+
+// |hyperlink| is the number of the hyperlink in the log, not in the Screen.
+void AppendCell(std::string& out, const Pixel& pixel, uint16_t hyperlink) {
+  const uint8_t flags = uint8_t((pixel.blink ? 1 << 0 : 0) |              //
+                                (pixel.bold ? 1 << 1 : 0) |               //
+                                (pixel.dim ? 1 << 2 : 0) |                //
+                                (pixel.inverted ? 1 << 3 : 0) |           //
+                                (pixel.underlined ? 1 << 4 : 0) |         //
+                                (pixel.underlined_double ? 1 << 5 : 0) |  //
+                                (pixel.strikethrough ? 1 << 6 : 0) |      //
+                                (pixel.automerge ? 1 << 7 : 0));          //
+  out.push_back(char(flags));
+  AppendVarint(out, hyperlink);
+  AppendColor(out, pixel.foreground_color);
+  AppendColor(out, pixel.background_color);
+  AppendVarint(out, pixel.character.size());
+  out += pixel.character;
+}
+
+bool EatCell(std::string_view& data, Pixel* pixel) {
+  if (data.empty()) {
+    return false;
+  }
+  const auto flags = uint8_t(data.front());
+  data.remove_prefix(1);
+  pixel->blink = flags & (1 << 0);               // NOLINT
+  pixel->bold = flags & (1 << 1);                // NOLINT
+  pixel->dim = flags & (1 << 2);                 // NOLINT
+  pixel->inverted = flags & (1 << 3);            // NOLINT
+  pixel->underlined = flags & (1 << 4);          // NOLINT
+  pixel->underlined_double = flags & (1 << 5);   // NOLINT
+  pixel->strikethrough = flags & (1 << 6);       // NOLINT
+  pixel->automerge = flags & (1 << 7);           // NOLINT
+  const auto hyperlink = EatVarint(data);
+  if (!hyperlink || !EatColor(data, &pixel->foreground_color) ||
+      !EatColor(data, &pixel->background_color)) {
+    return false;
+  }
+  pixel->hyperlink = uint16_t(*hyperlink);
+  const auto character = EatString(data);
+  if (!character) {
+    return false;
+  }
+  pixel->character = std::string(*character);
+  return true;
+}
+
+}  // namespace
+
+/// @brief Start a recording.
+/// @param write Receive the log, piece by piece, on a background thread. With
+/// FTXUI_ENABLE_THREADS=OFF, it is called from Record(), on the calling thread.
+/// @param keyframe_interval Record a keyframe every this many frames. Seeking
+/// to a frame decodes up to this many frames.
+FrameRecorder::FrameRecorder(std::function<void(std::string_view)> write,
+                             int keyframe_interval)
+    : write_(std::move(write)),
+      keyframe_interval_(keyframe_interval > 0 ? keyframe_interval : 1) {
+  std::string header(kMagic);
+  header += kVersion;
+#if defined(FTXUI_NO_THREADS)
+  write_(header);
+#else
+  pending_.push_back(std::move(header));
+  thread_ = std::thread([this] { WriteLoop(); });
+#endif
+}
+
+/// @brief Write the frames recorded, and stop.
+FrameRecorder::~FrameRecorder() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+/// @brief Record a frame. Only the cells that changed since the previous one
+/// are encoded, except for the keyframes.
+void FrameRecorder::Record(const Screen& screen) {
+  const auto now = std::chrono::steady_clock::now();
+  const auto time = frames_ == 0
+                        ? std::chrono::microseconds(0)
+                        : std::chrono::duration_cast<std::chrono::microseconds>(
+                              now - previous_time_);
+  previous_time_ = now;
+
+  bool keyframe = frames_ % size_t(keyframe_interval_) == 0 ||
+                  screen.dimx() != dimx_ || screen.dimy() != dimy_;
+  if (graphemes_.size() > kMaxGraphemes ||
+      hyperlink_ids_.size() > kMaxHyperlinks) {
+    graphemes_.Clear();
+    keyframe = true;
+  }
+  if (keyframe) {
+    dimx_ = screen.dimx();
+    dimy_ = screen.dimy();
+    cells_.assign(size_t(dimx_) * size_t(dimy_), CompactPixel());
+    hyperlink_ids_.clear();
+  }
+  ++frames_;
+
+  // Encode the changed cells. The hyperlinks are compared by their number in
+  // the log, since the Screen may number them differently from one frame to
+  // the next.
+  cells_data_.clear();
+  hyperlinks_data_.clear();
+  size_t hyperlinks = 0;
+  size_t count = 0;
+  size_t next = 0;  // The index following the previous cell encoded.
+  size_t index = 0;
+  for (int y = 0; y < dimy_; ++y) {
+    for (int x = 0; x < dimx_; ++x, ++index) {
+      const Pixel& pixel = screen.PixelAt(x, y);
+      CompactPixel cell = CompactPixel::Pack(pixel, graphemes_);
+      if (pixel.hyperlink) {
+        const std::string& url = screen.Hyperlink(pixel.hyperlink);
+        auto it = hyperlink_ids_.find(url);
+        if (it == hyperlink_ids_.end() &&
+            hyperlink_ids_.size() < std::numeric_limits<uint16_t>::max()) {
+          it = hyperlink_ids_
+                   .emplace(url, uint16_t(hyperlink_ids_.size() + 1))
+                   .first;
+          AppendVarint(hyperlinks_data_, url.size());
+          hyperlinks_data_ += url;
+          ++hyperlinks;
+        }
+        cell.hyperlink = it == hyperlink_ids_.end() ? 0 : it->second;
+      }
+      if (!keyframe && cell == cells_[index]) {
+        continue;
+      }
+      cells_[index] = cell;
+      AppendVarint(cells_data_, index - next);
+      AppendCell(cells_data_, pixel, cell.hyperlink);
+      next = index + 1;
+      ++count;
+    }
+  }
+
+  std::string payload;
+  AppendVarint(payload, uint64_t(time.count()));
+  AppendVarint(payload, uint64_t(dimx_));
+  AppendVarint(payload, uint64_t(dimy_));
+  AppendVarint(payload, hyperlinks);
+  payload += hyperlinks_data_;
+  AppendVarint(payload, count);
+  payload += cells_data_;
+
+  std::string frame;
+  frame.reserve(payload.size() + 11);  // NOLINT
+  frame += keyframe ? kKeyframe : kDelta;
+  AppendVarint(frame, payload.size());
+  frame += payload;
+
+#if defined(FTXUI_NO_THREADS)
+  write_(frame);
+#else
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back(std::move(frame));
+  }
+  cv_.notify_all();
+#endif
+}
+
+/// @brief Wait for the frames recorded to be given to the write function.
+void FrameRecorder::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return pending_.empty() && !writing_; });
+}
+
+void FrameRecorder::WriteLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] { return quit_ || !pending_.empty(); });
+    if (pending_.empty()) {
+      return;
+    }
+    // Write everything pending at once, without holding the lock.
+    std::string data;
+    for (std::string& piece : pending_) {
+      data += piece;
+    }
+    pending_.clear();
+    writing_ = true;
+    lock.unlock();
+    write_(data);
+    lock.lock();
+    writing_ = false;
+    cv_.notify_all();
+  }
+}
+
+/// @brief Index the frames of a log written by a FrameRecorder.
+FrameRecording::FrameRecording(std::string data) : data_(std::move(data)) {
+  std::string_view view = data_;
+  if (view.size() < kMagic.size() + 1 ||
+      view.substr(0, kMagic.size()) != kMagic ||
+      view[kMagic.size()] != kVersion) {
+    return;
+  }
+  view.remove_prefix(kMagic.size() + 1);
+
+  std::chrono::microseconds time{0};
+  size_t keyframe = 0;
+  while (!view.empty()) {
+    const char type = view.front();
+    view.remove_prefix(1);
+    const auto size = EatVarint(view);
+    if (!size || *size > view.size() ||
+        (type != kKeyframe && type != kDelta) ||
+        (type == kDelta && frames_.empty())) {
+      return;
+    }
+    Frame frame;
+    frame.offset = size_t(view.data() - data_.data());
+    std::string_view payload = view.substr(0, *size);
+    view.remove_prefix(*size);
+    const auto delta = EatVarint(payload);
+    if (!delta) {
+      return;
+    }
+    time += std::chrono::microseconds(*delta);
+    frame.time = time;
+    if (type == kKeyframe) {
+      keyframe = frames_.size();
+    }
+    frame.keyframe = keyframe;
+    frames_.push_back(frame);
+  }
+  valid_ = true;
+}
+
+/// @brief The time of the frame |index|, since the first one.
+std::chrono::microseconds FrameRecording::Time(size_t index) const {
+  return index < frames_.size() ? frames_[index].time
+                                : std::chrono::microseconds(0);
+}
+
+/// @brief Decode the frame |index|, from the keyframe before it. An empty
+/// screen is returned when it doesn't exist, or is malformed.
+Screen FrameRecording::At(size_t index) const {
+  Screen screen(0, 0);
+  if (index >= frames_.size()) {
+    return screen;
+  }
+  // The URLs of the hyperlinks, by their number in the log.
+  std::vector<std::string_view> hyperlinks = {""};
+  for (size_t i = frames_[index].keyframe; i <= index; ++i) {
+    std::string_view payload = std::string_view(data_).substr(
+        frames_[i].offset);
+    const auto time = EatVarint(payload);
+    const auto dimx = EatVarint(payload);
+    const auto dimy = EatVarint(payload);
+    const auto new_hyperlinks = EatVarint(payload);
+    if (!time || !dimx || !dimy || !new_hyperlinks) {
+      return Screen(0, 0);
+    }
+    for (uint64_t k = 0; k < *new_hyperlinks; ++k) {
+      const auto url = EatString(payload);
+      if (!url) {
+        return Screen(0, 0);
+      }
+      hyperlinks.push_back(*url);
+    }
+    const auto count = EatVarint(payload);
+    if (!count) {
+      return Screen(0, 0);
+    }
+    if (screen.dimx() != int(*dimx) || screen.dimy() != int(*dimy)) {
+      screen = Screen(int(*dimx), int(*dimy));
+    }
+    const size_t cells = size_t(*dimx) * size_t(*dimy);
+    size_t cell = 0;
+    for (uint64_t k = 0; k < *count; ++k) {
+      const auto skip = EatVarint(payload);
+      if (!skip || cell + *skip >= cells) {
+        return Screen(0, 0);
+      }
+      cell += *skip;
+      Pixel& pixel =
+          screen.PixelAt(int(cell % size_t(*dimx)), int(cell / size_t(*dimx)));
+      if (!EatCell(payload, &pixel) || pixel.hyperlink >= hyperlinks.size()) {
+        return Screen(0, 0);
+      }
+      if (pixel.hyperlink) {
+        pixel.hyperlink =
+            screen.RegisterHyperlink(std::string(hyperlinks[pixel.hyperlink]));
+      }
+      ++cell;
+    }
+  }
+  return screen;
+}
+
+}  // namespace ftxui
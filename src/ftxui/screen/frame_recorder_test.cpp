@@ -0,0 +1,106 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/frame_recorder.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ftxui/screen/color.hpp"
+#include "ftxui/screen/screen.hpp"
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Screen Frame(int i) {
+  Screen screen(8, 4);
+  screen.PixelAt(i % 8, 0).character = "a";
+  screen.PixelAt(i % 8, 0).bold = true;
+  screen.PixelAt(1, 1).character = std::to_string(i % 10);
+  screen.PixelAt(1, 1).foreground_color = Color::RGB(1, 2, 3);
+  screen.PixelAt(2, 2).character = "👨‍👩‍👧";
+  screen.PixelAt(3, 3).background_color = Color::Red;
+  return screen;
+}
+
+std::string Record(const std::vector<Screen>& frames, int keyframe_interval) {
+  std::string data;
+  FrameRecorder recorder([&](std::string_view piece) { data += piece; },
+                         keyframe_interval);
+  for (const Screen& frame : frames) {
+    recorder.Record(frame);
+  }
+  recorder.Flush();
+  return data;
+}
+
+}  // namespace
+
+TEST(FrameRecorderTest, Seek) {
+  std::vector<Screen> frames;
+  for (int i = 0; i < 25; ++i) {
+    frames.push_back(Frame(i));
+  }
+  const FrameRecording recording(Record(frames, 10));
+  ASSERT_TRUE(recording.valid());
+  ASSERT_EQ(recording.size(), frames.size());
+  for (size_t i : {24, 0, 13, 10, 9, 1}) {
+    EXPECT_EQ(recording.At(i).ToString(), frames[i].ToString()) << i;
+  }
+  EXPECT_LE(recording.Time(3), recording.Time(4));
+}
+
+TEST(FrameRecorderTest, OnlyChangedCells) {
+  const std::vector<Screen> same(10, Frame(0));
+  const std::vector<Screen> single = {Frame(0)};
+  const size_t size = Record(same, 100).size();
+  const size_t single_size = Record(single, 100).size();
+  // Every frame following the keyframe only takes a few bytes.
+  EXPECT_LT(size - single_size, 9 * 8);
+}
+
+TEST(FrameRecorderTest, Resize) {
+  const std::vector<Screen> frames = {Frame(0), Screen(2, 2), Frame(3)};
+  const FrameRecording recording(Record(frames, 100));
+  ASSERT_EQ(recording.size(), 3u);
+  EXPECT_EQ(recording.At(1).dimx(), 2);
+  EXPECT_EQ(recording.At(2).ToString(), frames[2].ToString());
+}
+
+TEST(FrameRecorderTest, Hyperlink) {
+  // The two screens number the same URLs differently.
+  Screen first(8, 4);
+  first.PixelAt(0, 0).hyperlink = first.RegisterHyperlink("https://a.com");
+  first.PixelAt(1, 0).hyperlink = first.RegisterHyperlink("https://b.com");
+  Screen second(8, 4);
+  second.PixelAt(1, 0).hyperlink = second.RegisterHyperlink("https://b.com");
+  second.PixelAt(0, 0).hyperlink = second.RegisterHyperlink("https://a.com");
+  second.PixelAt(2, 0).hyperlink = second.RegisterHyperlink("https://c.com");
+
+  const FrameRecording recording(Record({first, second, second}, 100));
+  ASSERT_EQ(recording.size(), 3u);
+  for (size_t i : {2, 0, 1}) {
+    const Screen& expected = i == 0 ? first : second;
+    const Screen screen = recording.At(i);
+    for (int x = 0; x < 3; ++x) {
+      EXPECT_EQ(screen.Hyperlink(screen.PixelAt(x, 0).hyperlink),
+                expected.Hyperlink(expected.PixelAt(x, 0).hyperlink))
+          << i << " " << x;
+    }
+  }
+}
+
+TEST(FrameRecorderTest, Truncated) {
+  std::string data = Record({Frame(0), Frame(1)}, 100);
+  data.pop_back();
+  const FrameRecording recording(data);
+  EXPECT_FALSE(recording.valid());
+  EXPECT_EQ(recording.size(), 1u);
+  EXPECT_EQ(recording.At(0).ToString(), Frame(0).ToString());
+  EXPECT_FALSE(FrameRecording("").valid());
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -1,24 +1,37 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <cstdint>  // for size_t
-#include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
+#include <algorithm>  // for fill
+#include <array>      // for array
+#include <cerrno>     // for errno, EINTR
+#include <cstdlib>    // for abs
+#include <cstdint>    // for size_t
+#include <functional>  // for function, hash
+#include <iostream>  // for operator<<, basic_ostream, flush, cout, ostream
 #include <limits>
-#include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
 #include <memory>   // for allocator, allocator_traits<>::value_type
-#include <sstream>  // IWYU pragma: keep
-#include <utility>  // for pair
+#include <string>   // for string, to_string
+#include <string_view>  // for string_view
+#include <tuple>        // for ignore
+#include <utility>      // for pair
+#include <vector>       // for vector
 
 #include "ftxui/screen/screen.hpp"
-#include "ftxui/screen/string.hpp"    // for string_width
-#include "ftxui/screen/terminal.hpp"  // for Dimensions, Size
+#include "ftxui/screen/string.hpp"       // for string_width
+#include "ftxui/screen/string_internal.hpp"  // for StringHeapBytes
+#include "ftxui/screen/terminal.hpp"     // for Dimensions, Size, ColorSupport
+#include "ftxui/screen/thread_pool.hpp"  // for Concurrency, Run
+#include "ftxui/screen/trace.hpp"        // for FTXUI_TRACE
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
+#include <io.h>  // for _write
 #include <windows.h>
+#else
+#include <unistd.h>  // for write
 #endif
 
 // Macro for hinting that an expression is likely to be false.
@@ -42,8 +55,10 @@ namespace ftxui {
 
 namespace {
 
+// Per thread, so that concurrent renderings do not share it. See
+// ftxui::parallel.
 Pixel& dev_null_pixel() {
-  static Pixel pixel;
+  thread_local Pixel pixel;
   return pixel;
 }
 
@@ -72,53 +87,71 @@ void WindowsEmulateVT100Terminal() {
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void UpdatePixelStyle(const Screen* screen,
-                      std::stringstream& ss,
+                      Terminal::Color color_support,
+                      std::string& output,
                       const Pixel& prev,
                       const Pixel& next) {
+#if !defined(FTXUI_NO_HYPERLINKS)
   // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
   if (FTXUI_UNLIKELY(next.hyperlink != prev.hyperlink)) {
-    ss << "\x1B]8;;" << screen->Hyperlink(next.hyperlink) << "\x1B\\";
+    output += "\x1B]8;;";
+    output += screen->Hyperlink(next.hyperlink);
+    output += "\x1B\\";
   }
+#else
+  std::ignore = screen;
+#endif
 
   // Bold
   if (FTXUI_UNLIKELY((next.bold ^ prev.bold) | (next.dim ^ prev.dim))) {
     // BOLD_AND_DIM_RESET:
-    ss << ((prev.bold && !next.bold) || (prev.dim && !next.dim) ? "\x1B[22m"
-                                                                : "");
-    ss << (next.bold ? "\x1B[1m" : "");  // BOLD_SET
-    ss << (next.dim ? "\x1B[2m" : "");   // DIM_SET
+    output += ((prev.bold && !next.bold) || (prev.dim && !next.dim) ? "\x1B[22m"
+                                                                    : "");
+    output += (next.bold ? "\x1B[1m" : "");  // BOLD_SET
+    output += (next.dim ? "\x1B[2m" : "");   // DIM_SET
   }
 
   // Underline
   if (FTXUI_UNLIKELY(next.underlined != prev.underlined ||
                      next.underlined_double != prev.underlined_double)) {
-    ss << (next.underlined          ? "\x1B[4m"     // UNDERLINE
-           : next.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
-                                    : "\x1B[24m");  // UNDERLINE_RESET
+    output += (next.underlined          ? "\x1B[4m"     // UNDERLINE
+               : next.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
+                                        : "\x1B[24m");  // UNDERLINE_RESET
   }
 
   // Blink
   if (FTXUI_UNLIKELY(next.blink != prev.blink)) {
-    ss << (next.blink ? "\x1B[5m"     // BLINK_SET
-                      : "\x1B[25m");  // BLINK_RESET
+    output += (next.blink ? "\x1B[5m"     // BLINK_SET
+                          : "\x1B[25m");  // BLINK_RESET
   }
 
   // Inverted
   if (FTXUI_UNLIKELY(next.inverted != prev.inverted)) {
-    ss << (next.inverted ? "\x1B[7m"     // INVERTED_SET
-                         : "\x1B[27m");  // INVERTED_RESET
+    output += (next.inverted ? "\x1B[7m"     // INVERTED_SET
+                             : "\x1B[27m");  // INVERTED_RESET
   }
 
   // StrikeThrough
   if (FTXUI_UNLIKELY(next.strikethrough != prev.strikethrough)) {
-    ss << (next.strikethrough ? "\x1B[9m"     // CROSSED_OUT
-                              : "\x1B[29m");  // CROSSED_OUT_RESET
+    output += (next.strikethrough ? "\x1B[9m"     // CROSSED_OUT
+                                  : "\x1B[29m");  // CROSSED_OUT_RESET
   }
 
   if (FTXUI_UNLIKELY(next.foreground_color != prev.foreground_color ||
                      next.background_color != prev.background_color)) {
-    ss << "\x1B[" + next.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next.background_color.Print(true) + "m";
+    // Distinct colors may be displayed identically once downsampled.
+    const Color foreground = next.foreground_color.Downsample(color_support);
+    const Color background = next.background_color.Downsample(color_support);
+    if (foreground == prev.foreground_color.Downsample(color_support) &&
+        background == prev.background_color.Downsample(color_support)) {
+      return;
+    }
+    output += "\x1B[";
+    foreground.Print(false, output, color_support);
+    output += "m";
+    output += "\x1B[";
+    background.Print(true, output, color_support);
+    output += "m";
   }
 }
 
@@ -129,25 +162,20 @@ struct TileEncoding {
   uint8_t down : 2;
   uint8_t round : 1;
 
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
+  // Pack the fields into an int: left, top, right, down, round from the lowest
+  // bits to the highest.
+  constexpr int Pack() const {
+    return left | (top << 2) | (right << 4) | (down << 6) | (round << 8);
   }
-  // clang-format on
+};
+
+struct TileDefinition {
+  std::string_view character;
+  TileEncoding encoding;
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
+constexpr TileDefinition tile_encoding[] = { // NOLINT
     {"─", {1, 0, 1, 0, 0}},
     {"━", {2, 0, 2, 0, 0}},
     {"╍", {2, 0, 2, 0, 0}},
@@ -290,78 +318,411 @@ const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B> input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
+// The box drawing characters are the codepoints U+2500 to U+257F. They are
+// encoded as E2 94 80-BF and E2 95 80-BF, so they are indexed by their last
+// two bytes.
+constexpr int kTileCount = 128;
+constexpr int kTileEncodingCount = 1 << 9;
+
+// Return the index of the box drawing character |c|, or -1.
+int TileIndex(const std::string& c) {
+  if (c.size() != 3 || uint8_t(c[0]) != 0xE2) {  // NOLINT
+    return -1;
   }
-  return output;
+  const int high = uint8_t(c[1]) - 0x94;  // NOLINT
+  const int low = uint8_t(c[2]) - 0x80;   // NOLINT
+  if (high < 0 || high > 1 || low < 0 || low >= 64) {  // NOLINT
+    return -1;
+  }
+  return high * 64 + low;  // NOLINT
 }
 
-const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+// Replace the box drawing character |c| by the one at |index|, in place.
+void SetTile(std::string& c, int index) {
+  c[1] = char(0x94 + index / 64);  // NOLINT
+  c[2] = char(0x80 + index % 64);  // NOLINT
+}
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
-  if (it_left == tile_encoding.end()) {
+struct TileTable {
+  // The packed TileEncoding of every box drawing character, or -1.
+  std::array<int16_t, kTileCount> encoding;
+  // The box drawing character of every packed TileEncoding, or -1. When
+  // several share one, the last is used.
+  std::array<int8_t, kTileEncodingCount> tile;
+};
+
+constexpr TileTable g_tiles = []() constexpr {
+  TileTable table{};
+  for (auto& it : table.encoding) {
+    it = -1;
+  }
+  for (auto& it : table.tile) {
+    it = -1;
+  }
+  for (const TileDefinition& it : tile_encoding) {
+    const int index = (uint8_t(it.character[1]) - 0x94) * 64 +  // NOLINT
+                      (uint8_t(it.character[2]) - 0x80);        // NOLINT
+    const int encoding = it.encoding.Pack();
+    table.encoding[index] = int16_t(encoding);  // NOLINT
+    if (table.tile[encoding] < index) {         // NOLINT
+      table.tile[encoding] = int8_t(index);     // NOLINT
+    }
+  }
+  return table;
+}();
+
+// The shift of the fields of a packed TileEncoding.
+constexpr int kLeft = 0;
+constexpr int kTop = 2;
+constexpr int kRight = 4;
+constexpr int kDown = 6;
+
+// Connect the side |shift_a| of |a| and the side |shift_b| of |b|, when only
+// one of them is drawn.
+void Upgrade(std::string& a, int shift_a, std::string& b, int shift_b) {
+  const int tile_a = TileIndex(a);
+  const int tile_b = TileIndex(b);
+  if (tile_a < 0 || tile_b < 0) {
     return;
   }
-  const auto it_right = tile_encoding.find(right);
-  if (it_right == tile_encoding.end()) {
+  const int encoding_a = g_tiles.encoding[tile_a];  // NOLINT
+  const int encoding_b = g_tiles.encoding[tile_b];  // NOLINT
+  if (encoding_a < 0 || encoding_b < 0) {
     return;
   }
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left = it_left_upgrade->second;
+  const int side_a = (encoding_a >> shift_a) & 3;
+  const int side_b = (encoding_b >> shift_b) & 3;
+  if (side_a == 0 && side_b != 0) {
+    const int encoding = encoding_a | (side_b << shift_a);
+    const int upgrade = g_tiles.tile[encoding];  // NOLINT
+    if (upgrade >= 0) {
+      SetTile(a, upgrade);
     }
   }
-
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right = it_right_upgrade->second;
+  if (side_b == 0 && side_a != 0) {
+    const int encoding = encoding_b | (side_a << shift_b);
+    const int upgrade = g_tiles.tile[encoding];  // NOLINT
+    if (upgrade >= 0) {
+      SetTile(b, upgrade);
     }
   }
 }
 
+}  // namespace
+
+void UpgradeLeftRight(std::string& left, std::string& right) {
+  Upgrade(left, kRight, right, kLeft);
+}
+
 void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
-  if (it_top == tile_encoding.end()) {
-    return;
+  Upgrade(top, kDown, down, kTop);
+}
+
+namespace {
+
+bool ShouldAttemptAutoMerge(Pixel& pixel) {
+  return pixel.automerge && pixel.character.size() == 3;
+}
+
+// Remember whether the characters seen recently are fullwidth. The same few
+// characters are usually repeated along the rows: box drawing, CJK text...
+// This avoids decoding them again for every cell.
+class FullWidthCache {
+ public:
+  bool IsFullWidth(const std::string& character) {
+    // Every single byte character is at most one cell wide.
+    if (character.size() <= 1) {
+      return false;
+    }
+    size_t hash = 0;
+    for (const char c : character) {
+      hash = hash * 31 + static_cast<unsigned char>(c);  // NOLINT
+    }
+    Entry& entry = entries_[hash % entries_.size()];
+    if (entry.character != character) {
+      entry.character = character;
+      entry.fullwidth = (string_width(character) == 2);
+    }
+    return entry.fullwidth;
   }
-  const auto it_down = tile_encoding.find(down);
-  if (it_down == tile_encoding.end()) {
-    return;
+
+ private:
+  struct Entry {
+    std::string character;
+    bool fullwidth = false;
+  };
+  std::array<Entry, 16> entries_;  // NOLINT
+};
+
+// Whether two pixels are displayed identically by the terminal. The hyperlinks
+// are compared by value, since their ids are only valid within their screen.
+bool SamePixel(const Screen& screen_a,
+               const Pixel& a,
+               const Screen& screen_b,
+               const Pixel& b) {
+  return a.blink == b.blink &&                          //
+         a.bold == b.bold &&                            //
+         a.dim == b.dim &&                              //
+         a.inverted == b.inverted &&                    //
+         a.underlined == b.underlined &&                //
+         a.underlined_double == b.underlined_double &&  //
+         a.strikethrough == b.strikethrough &&          //
+         a.character == b.character &&                  //
+         a.foreground_color == b.foreground_color &&    //
+         a.background_color == b.background_color &&    //
+         ((a.hyperlink == 0 && b.hyperlink == 0) ||
+          screen_a.Hyperlink(a.hyperlink) == screen_b.Hyperlink(b.hyperlink));
+}
+
+// Move the cursor |n| cells toward |direction|. One of 'A', 'B', 'C', 'D'. Also
+// used for the other sequences taking a count, like 'G', 'S' and 'T'.
+void MoveCursor(std::string& output, int n, char direction) {
+  if (n > 0) {
+    output += "\x1B[";
+    output += std::to_string(n);
+    output += direction;
+  }
+}
+
+int Digits(int n) {
+  int digits = 1;
+  for (; n >= 10; n /= 10) {  // NOLINT
+    ++digits;
+  }
+  return digits;
+}
+
+// Whether the terminal displays |pixel| like a cell erased with its
+// background: a blank without decoration.
+bool Erasable(const Pixel& pixel) {
+  return pixel.character == " " && !pixel.inverted && !pixel.underlined &&
+         !pixel.underlined_double && !pixel.strikethrough &&
+         pixel.hyperlink == 0;
+}
+
+// Whether |character| is a single code point. REP only repeats the last one.
+bool SingleCodePoint(const std::string& character) {
+  if (character.empty()) {
+    return false;
   }
+  const auto lead = static_cast<unsigned char>(character[0]);
+  const size_t size = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+  return character.size() == size;
+}
 
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top = it_top_down->second;
+// The cells printed by a single sequence.
+struct Run {
+  int cells = 0;    // The cells printed, 0 when none.
+  int advance = 0;  // The columns the cursor moved by.
+};
+
+// Print the cells of |row| from |x| to |end| as a single sequence, when
+// |compression| allows one shorter than the characters themselves:
+// - ECH erases the blanks sharing a background, and EL the ones reaching the
+//   end of the line, when |erase_end|.
+// - REP repeats a glyph.
+// The cursor is on |x|, and the style of |row[x]| already set.
+Run PrintRun(const Screen& screen,
+             Terminal::Compression compression,
+             const Pixel* row,
+             int x,
+             int end,
+             bool erase_end,
+             FullWidthCache& fullwidth_cache,
+             std::string& output) {
+  Run run;
+  if (compression == Terminal::Compression::None) {
+    return run;
+  }
+  const Pixel& pixel = row[x];  // NOLINT
+
+  if (Erasable(pixel)) {
+    int blank_end = x + 1;
+    while (blank_end < end && Erasable(row[blank_end]) &&  // NOLINT
+           row[blank_end].background_color == pixel.background_color) {
+      ++blank_end;
+    }
+    const int blanks = blank_end - x;
+    const int erase_line = 3;
+    if (erase_end && blank_end == end && blanks > erase_line) {
+      output += "\x1B[K";
+      run.cells = blanks;
+      return run;
     }
+    if (blanks > 2 * (3 + Digits(blanks))) {
+      MoveCursor(output, blanks, 'X');
+      MoveCursor(output, blanks, 'C');
+      run.cells = blanks;
+      run.advance = blanks;
+      return run;
+    }
+  }
+
+  if (compression != Terminal::Compression::Repeat ||
+      !SingleCodePoint(pixel.character) ||
+      fullwidth_cache.IsFullWidth(pixel.character)) {
+    return run;
+  }
+  int repeat_end = x + 1;
+  while (repeat_end < end &&
+         SamePixel(screen, row[repeat_end], screen, pixel)) {  // NOLINT
+    ++repeat_end;
+  }
+  const int repeats = repeat_end - x - 1;
+  if (repeats * int(pixel.character.size()) <= 3 + Digits(repeats)) {
+    return run;
   }
+  output += pixel.character;
+  MoveCursor(output, repeats, 'b');
+  run.cells = repeats + 1;
+  run.advance = repeats + 1;
+  return run;
+}
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down = it_down_top->second;
+// Append the |row| of |dimx| pixels. It starts and ends with the default
+// style. With |erase_end|, the blanks ending the row may be erased, leaving the
+// cursor before its end.
+void SerializeRow(const Screen* screen,
+                  Terminal::Color color_support,
+                  Terminal::Compression compression,
+                  const Pixel* row,
+                  int dimx,
+                  bool erase_end,
+                  std::string& output) {
+  const Pixel default_pixel;
+  const Pixel* previous_pixel_ref = &default_pixel;
+  FullWidthCache fullwidth_cache;
+
+  // After printing a fullwith character, we need to skip the next cell.
+  bool previous_fullwidth = false;
+  for (int x = 0; x < dimx; ++x) {
+    const Pixel& pixel = row[x];  // NOLINT
+    if (!previous_fullwidth) {
+      UpdatePixelStyle(screen, color_support, output, *previous_pixel_ref, pixel);
+      previous_pixel_ref = &pixel;
+      const Run run = PrintRun(*screen, compression, row, x, dimx, erase_end,
+                               fullwidth_cache, output);
+      if (run.cells != 0) {
+        x += run.cells - 1;
+        continue;
+      }
+      output += pixel.character;
     }
+    previous_fullwidth = fullwidth_cache.IsFullWidth(pixel.character);
   }
+
+  // Reset the style to default:
+  UpdatePixelStyle(screen, color_support, output, *previous_pixel_ref, default_pixel);
 }
 
-bool ShouldAttemptAutoMerge(Pixel& pixel) {
-  return pixel.automerge && pixel.character.size() == 3;
+// A hash of the characters and the style of a row. The colors and the
+// hyperlinks are left out: the rows with the same hash are compared cell by
+// cell anyway.
+size_t RowHash(const Pixel* row, int dimx) {
+  const std::hash<std::string> hash_string;
+  size_t hash = 0;
+  for (int x = 0; x < dimx; ++x) {
+    const Pixel& pixel = row[x];
+    const size_t style = size_t(pixel.blink) | size_t(pixel.bold) << 1U |
+                         size_t(pixel.dim) << 2U |
+                         size_t(pixel.inverted) << 3U |
+                         size_t(pixel.underlined) << 4U |
+                         size_t(pixel.underlined_double) << 5U |
+                         size_t(pixel.strikethrough) << 6U;
+    hash = hash * 31 + hash_string(pixel.character) + style;  // NOLINT
+  }
+  return hash;
+}
+
+// A vertical shift of the rows displayed by the terminal: the rows [top,
+// bottom] are scrolled by |delta| lines, up when positive. None when |delta|
+// is zero.
+struct Scroll {
+  int top = 0;
+  int bottom = 0;
+  int delta = 0;
+};
+
+// Find the range of rows of |next| displaying the rows of |previous| shifted
+// vertically, saving the most rows from being printed again.
+Scroll FindScroll(const Screen& next, const Screen& previous) {
+  // Scrolling is worth it for a few rows at least.
+  const int min_rows = 3;
+  const int dimx = next.dimx();
+  const int dimy = next.dimy();
+  std::vector<size_t> next_hash(static_cast<size_t>(dimy));
+  std::vector<size_t> previous_hash(static_cast<size_t>(dimy));
+  for (int y = 0; y < dimy; ++y) {
+    next_hash[y] = RowHash(&next.PixelAt(0, y), dimx);
+    previous_hash[y] = RowHash(&previous.PixelAt(0, y), dimx);
+  }
+
+  // The longest run of rows y where next[y] == previous[y + delta], counting
+  // the ones that changed otherwise.
+  Scroll best;
+  int best_saved = min_rows - 1;
+  int run_start = 0;
+  int run_saved = 0;
+  auto end_run = [&](int delta, int end) {
+    if (run_saved > best_saved) {
+      best_saved = run_saved;
+      best.top = std::min(run_start, run_start + delta);
+      best.bottom = std::max(end - 1, end - 1 + delta);
+      best.delta = delta;
+    }
+  };
+  for (int delta = 1 - dimy; delta < dimy; ++delta) {
+    if (delta == 0) {
+      continue;
+    }
+    const int y_min = std::max(0, -delta);
+    const int y_max = std::min(dimy, dimy - delta);
+    run_start = y_min;
+    run_saved = 0;
+    for (int y = y_min; y < y_max; ++y) {
+      if (next_hash[y] != previous_hash[y + delta]) {
+        end_run(delta, y);
+        run_start = y + 1;
+        run_saved = 0;
+        continue;
+      }
+      run_saved += next_hash[y] != previous_hash[y];
+    }
+    end_run(delta, y_max);
+  }
+  if (best.delta == 0) {
+    return best;
+  }
+
+  // Rule out the hash collisions.
+  const int y_min = std::max(best.top, best.top - best.delta);
+  const int y_max = std::min(best.bottom, best.bottom - best.delta);
+  for (int y = y_min; y <= y_max; ++y) {
+    for (int x = 0; x < dimx; ++x) {
+      if (!SamePixel(next, next.PixelAt(x, y), previous,
+                     previous.PixelAt(x, y + best.delta))) {
+        return {};
+      }
+    }
+  }
+  return best;
+}
+
+// Move the cursor from the column |from| to the column |x|, with the shortest
+// sequence. |from| is negative when the column is unknown.
+void MoveToColumn(std::string& output, int from, int x) {
+  if (x == 0) {
+    output += "\r";
+    return;
+  }
+  // The relative moves, or the absolute one: Cursor Horizontal Absolute (CHA).
+  const int delta = x > from ? x - from : from - x;
+  if (from >= 0 && Digits(delta) <= Digits(x + 1)) {
+    MoveCursor(output, delta, x > from ? 'C' : 'D');
+    return;
+  }
+  MoveCursor(output, x + 1, 'G');
 }
 
 }  // namespace
@@ -396,7 +757,8 @@ Screen::Screen(int dimx, int dimy)
     : stencil{0, dimx - 1, 0, dimy - 1},
       dimx_(dimx),
       dimy_(dimy),
-      pixels_(dimy, std::vector<Pixel>(dimx)) {
+      pixels_(dimx * dimy),
+      written_rows_(dimy) {
 #if defined(_WIN32)
   // The placement of this call is a bit weird, however we can assume that
   // anybody who instantiates a Screen object eventually wants to output
@@ -414,40 +776,374 @@ Screen::Screen(int dimx, int dimy)
 /// @note Don't forget to flush stdout. Alternatively, you can use
 /// Screen::Print();
 std::string Screen::ToString() const {
-  std::stringstream ss;
+  std::string output;
+  ToString(output);
+  return output;
+}
+
+/// Append to |output| the string printing the Screen on the terminal. Reusing
+/// the same |output| in between frames avoids allocating memory.
+///
+/// Large screens are serialized by bands of rows, on multiple threads.
+/// @param output The buffer to append to.
+void Screen::ToString(std::string& output) const {
+  ToString(output, Terminal::ColorSupport());
+}
+
+/// Append to |output| the string printing the Screen on a terminal supporting
+/// |color_support|. The colors are downsampled while they are printed, so the
+/// same Screen can be printed for terminals with different capabilities.
+/// @param output The buffer to append to.
+/// @param color_support The colors supported by the terminal.
+void Screen::ToString(std::string& output,
+                      Terminal::Color color_support) const {
+  ToString(output, color_support, Terminal::Compression::None);
+}
+
+/// Append to |output| the string printing the Screen on a terminal supporting
+/// |color_support| and |compression|. The sequences of |compression| print the
+/// runs of blank cells and the repeated glyphs, like the borders, in fewer
+/// bytes. The cursor is left at the same place as without them.
+/// @param output The buffer to append to.
+/// @param color_support The colors supported by the terminal.
+/// @param compression The sequences supported by the terminal to shorten the
+/// output.
+void Screen::ToString(std::string& output,
+                      Terminal::Color color_support,
+                      Terminal::Compression compression) const {
+  ResolveStyles();
+  // Most of the cells are a single byte. Reserve enough for them and the line
+  // breaks up front.
+  output.reserve(output.size() + size_t(dimx_ + 2) * dimy_);
+
+  // Every row starts and ends with the default style, so bands of rows can be
+  // serialized independently, and concatenated in order. Small screens aren't
+  // worth the synchronization.
+  const int min_band_cells = 1 << 12;  // NOLINT
+  const int bands = std::min({thread_pool::Concurrency(), dimy_,
+                              dimx_ * dimy_ / min_band_cells});
+  if (bands <= 1) {
+    for (int y = 0; y < dimy_; ++y) {
+      // New line in between two lines.
+      if (y != 0) {
+        output += "\r\n";
+      }
+      // The cursor is left at the end of the last row.
+      SerializeRow(this, color_support, compression,
+                   pixels_.data() + y * dimx_, dimx_,
+                   /*erase_end=*/y + 1 < dimy_, output);
+    }
+    return;
+  }
+
+  // The first band is written directly to |output|. The others to buffers
+  // reused in between frames.
+  thread_local std::vector<std::string> g_buffers;  // NOLINT
+  std::vector<std::string>& buffers = g_buffers;
+  buffers.resize(bands - 1);
+  thread_pool::Run(bands, [&](int band) {
+    std::string& out = band == 0 ? output : buffers[band - 1];
+    if (band != 0) {
+      out.clear();
+    }
+    const int y_min = dimy_ * band / bands;
+    const int y_max = dimy_ * (band + 1) / bands;
+    for (int y = y_min; y < y_max; ++y) {
+      // New line in between two lines.
+      if (y != 0) {
+        out += "\r\n";
+      }
+      SerializeRow(this, color_support, compression,
+                   pixels_.data() + y * dimx_, dimx_,
+                   /*erase_end=*/y + 1 < dimy_, out);
+    }
+  });
+  for (const std::string& buffer : buffers) {
+    output += buffer;
+  }
+}
+
+/// Stream the string printing the Screen on the terminal to |sink|, in chunks
+/// of bounded size. As opposed to ToString(), the memory used doesn't grow with
+/// the height of the Screen.
+/// @param sink Called with every consecutive chunk.
+void Screen::ToString(const std::function<void(std::string_view)>& sink) const {
+  ToString(sink, 0, dimy_);
+}
+
+/// Stream the string printing the rows [y_begin, y_end) of the Screen to
+/// |sink|, like ToString(sink).
+/// @param sink Called with every consecutive chunk.
+/// @param y_begin The first row printed.
+/// @param y_end The row past the last one printed.
+void Screen::ToString(const std::function<void(std::string_view)>& sink,
+                      int y_begin,
+                      int y_end) const {
+  ResolveStyles();
+  const Terminal::Color color_support = Terminal::ColorSupport();
+  const size_t chunk_size = 1 << 16;  // NOLINT
+  std::string chunk;
+  chunk.reserve(chunk_size + size_t(dimx_ + 2));
+
+  y_begin = std::max(y_begin, 0);
+  y_end = std::min(y_end, dimy_);
+  for (int y = y_begin; y < y_end; ++y) {
+    // New line in between two lines.
+    if (y != y_begin) {
+      chunk += "\r\n";
+    }
+    SerializeRow(this, color_support, Terminal::Compression::None,
+                 pixels_.data() + y * dimx_, dimx_, /*erase_end=*/false,
+                 chunk);
+
+    if (chunk.size() >= chunk_size) {
+      sink(chunk);
+      chunk.clear();
+    }
+  }
+
+  if (!chunk.empty()) {
+    sink(chunk);
+  }
+}
+
+/// Write the Screen on the file descriptor |fd|, in chunks of bounded size.
+/// @param fd The file descriptor to write to. For instance STDOUT_FILENO.
+/// @return Whether everything was written successfully.
+bool Screen::WriteTo(int fd) const {
+  bool success = true;
+  ToString([&](std::string_view chunk) {
+    while (success && !chunk.empty()) {
+#if defined(_WIN32)
+      const auto written =
+          _write(fd, chunk.data(), static_cast<unsigned int>(chunk.size()));
+#else
+      const auto written = write(fd, chunk.data(), chunk.size());
+#endif
+      if (written < 0) {
+        success = (errno == EINTR);
+        continue;
+      }
+      chunk.remove_prefix(size_t(written));
+    }
+  });
+  return success;
+}
+
+/// Produce a std::string updating a terminal currently displaying |previous|,
+/// so that it displays this Screen instead. Only the cells that changed are
+/// printed. The terminal cursor must be at the top left corner of the screen,
+/// like after ResetPosition(). It is left at the same place as after printing
+/// ToString().
+/// @param previous The screen currently displayed by the terminal.
+/// @note Fallback to ToString() when the dimensions differ.
+std::string Screen::ToStringDiff(const Screen& previous) const {
+  std::string output;
+  ToStringDiff(previous, output);
+  return output;
+}
+
+/// Append to |output| the string updating a terminal currently displaying
+/// |previous|, so that it displays this Screen instead.
+/// @param previous The screen currently displayed by the terminal.
+/// @param output The buffer to append to.
+/// @see ToStringDiff(const Screen&)
+void Screen::ToStringDiff(const Screen& previous, std::string& output) const {
+  ToStringDiff(previous, output, Terminal::ColorSupport());
+}
+
+/// Append to |output| the string updating a terminal supporting
+/// |color_support|, currently displaying |previous|, so that it displays this
+/// Screen instead.
+/// @param previous The screen currently displayed by the terminal.
+/// @param output The buffer to append to.
+/// @param color_support The colors supported by the terminal.
+/// @see ToStringDiff(const Screen&)
+void Screen::ToStringDiff(const Screen& previous,
+                          std::string& output,
+                          Terminal::Color color_support) const {
+  ToStringDiff(previous, output, color_support, /*scroll=*/false);
+}
+
+/// Append to |output| the string updating a terminal supporting
+/// |color_support|, currently displaying |previous|, so that it displays this
+/// Screen instead.
+///
+/// With |scroll|, the largest range of rows shifted vertically since
+/// |previous| is moved by scrolling a region of the terminal (DECSTBM, then SU
+/// or SD). Only the rows exposed are printed again, like when tailing a log.
+/// This requires the Screen to be displayed from the top left corner of the
+/// terminal, over its full width, like a fullscreen one.
+/// @param previous The screen currently displayed by the terminal.
+/// @param output The buffer to append to.
+/// @param color_support The colors supported by the terminal.
+/// @param scroll Whether to scroll the rows shifted.
+/// @see ToStringDiff(const Screen&)
+void Screen::ToStringDiff(const Screen& previous,
+                          std::string& output,
+                          Terminal::Color color_support,
+                          bool scroll) const {
+  ToStringDiff(previous, output, color_support, scroll,
+               Terminal::Compression::None);
+}
+
+/// Append to |output| the string updating a terminal supporting
+/// |color_support| and |compression|, currently displaying |previous|, so that
+/// it displays this Screen instead. See ToString() for |compression|.
+/// @param previous The screen currently displayed by the terminal.
+/// @param output The buffer to append to.
+/// @param color_support The colors supported by the terminal.
+/// @param scroll Whether to scroll the rows shifted.
+/// @param compression The sequences supported by the terminal to shorten the
+/// output.
+/// @see ToStringDiff(const Screen&)
+void Screen::ToStringDiff(const Screen& previous,
+                          std::string& output,
+                          Terminal::Color color_support,
+                          bool scroll,
+                          Terminal::Compression compression) const {
+  if (previous.dimx_ != dimx_ || previous.dimy_ != dimy_) {
+    ToString(output, color_support, compression);
+    return;
+  }
+  ResolveStyles();
+  previous.ResolveStyles();
+  if (dimy_ == 0) {
+    return;
+  }
 
   const Pixel default_pixel;
   const Pixel* previous_pixel_ref = &default_pixel;
 
+  const Scroll shift = scroll ? FindScroll(*this, previous) : Scroll();
+  std::vector<Pixel> blank_row;
+  if (shift.delta != 0) {
+    // Setting and resetting the scrolling region moves the cursor to the top
+    // left corner of the terminal.
+    output += "\x1B[";
+    output += std::to_string(shift.top + 1);
+    output += ';';
+    output += std::to_string(shift.bottom + 1);
+    output += 'r';
+    MoveCursor(output, std::abs(shift.delta), shift.delta > 0 ? 'S' : 'T');
+    output += "\x1B[r";
+    blank_row.resize(size_t(dimx_));
+  }
+  // The row of |previous| displayed by the terminal at the row |y|, before
+  // printing anything. -1 for a blank row, scrolled in.
+  auto previous_y = [&](int y) -> int {
+    if (shift.delta != 0 && y >= shift.top && y <= shift.bottom) {
+      y += shift.delta;
+      if (y < shift.top || y > shift.bottom) {
+        return -1;
+      }
+    }
+    return y;
+  };
+
+  // The position of the terminal cursor. When the last column was printed, the
+  // terminal may have kept the cursor on it, so its column is unknown.
+  int cursor_x = 0;
+  int cursor_y = 0;
+  auto move_to = [&](int x, int y) {
+    MoveCursor(output, y - cursor_y, 'B');
+    cursor_y = y;
+    if (x == cursor_x) {
+      return;
+    }
+    MoveToColumn(output, cursor_x >= dimx_ ? -1 : cursor_x, x);
+    cursor_x = x;
+  };
+
+  FullWidthCache fullwidth_cache;
+  std::vector<bool> changed(dimx_);
   for (int y = 0; y < dimy_; ++y) {
-    // New line in between two lines.
-    if (y != 0) {
-      UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
-      previous_pixel_ref = &default_pixel;
-      ss << "\r\n";
+    // Two rows left blank since their screen was cleared are identical.
+    const int row_y = previous_y(y);
+    if (!written_rows_[y] && (row_y < 0 || !previous.written_rows_[row_y])) {
+      continue;
+    }
+
+    // Find the cells that changed. A fullwidth character also covers the next
+    // cell, which must be printed again when it is added or removed.
+    std::fill(changed.begin(), changed.end(), false);
+    const Pixel* row = row_y < 0 ? blank_row.data()
+                                 : previous.pixels_.data() + row_y * dimx_;
+    for (int x = 0; x < dimx_; ++x) {
+      const Pixel& pixel = pixels_[y * dimx_ + x];
+      const Pixel& previous_pixel = row[x];
+      if (SamePixel(*this, pixel, previous, previous_pixel)) {
+        continue;
+      }
+      changed[x] = true;
+      if (x + 1 < dimx_ &&
+          (fullwidth_cache.IsFullWidth(pixel.character) ||
+           fullwidth_cache.IsFullWidth(previous_pixel.character))) {
+        changed[x + 1] = true;
+      }
+    }
+
+    // Printing a few unchanged cells is cheaper than moving the cursor.
+    const int max_gap = 3;
+    int last_changed = -1;
+    for (int x = 0; x < dimx_; ++x) {
+      if (!changed[x]) {
+        continue;
+      }
+      if (last_changed >= 0 && x - last_changed - 1 <= max_gap) {
+        std::fill(changed.begin() + last_changed + 1, changed.begin() + x,
+                  true);
+      }
+      last_changed = x;
     }
 
     // After printing a fullwith character, we need to skip the next cell.
     bool previous_fullwidth = false;
-    for (const auto& pixel : pixels_[y]) {
-      if (!previous_fullwidth) {
-        UpdatePixelStyle(this, ss, *previous_pixel_ref, pixel);
-        previous_pixel_ref = &pixel;
-        ss << pixel.character;
+    // The end of the run of changed cells containing |x|.
+    int changed_end = 0;
+    const Pixel* row_pixels = pixels_.data() + y * dimx_;
+    for (int x = 0; x < dimx_; ++x) {
+      const Pixel& pixel = row_pixels[x];
+      const bool covered = previous_fullwidth;
+      previous_fullwidth = fullwidth_cache.IsFullWidth(pixel.character);
+      if (covered || !changed[x]) {
+        continue;
+      }
+      move_to(x, y);
+      UpdatePixelStyle(this, color_support, output, *previous_pixel_ref, pixel);
+      previous_pixel_ref = &pixel;
+
+      // Only the changed cells can be erased, up to the end of the line when
+      // they reach it.
+      if (changed_end <= x) {
+        changed_end = x + 1;
+        while (changed_end < dimx_ && changed[changed_end]) {
+          ++changed_end;
+        }
+      }
+      const Run run =
+          PrintRun(*this, compression, row_pixels, x, changed_end,
+                   /*erase_end=*/changed_end == dimx_, fullwidth_cache, output);
+      if (run.cells != 0) {
+        cursor_x = x + run.advance;
+        x += run.cells - 1;
+        previous_fullwidth = false;
+        continue;
       }
-      previous_fullwidth = (string_width(pixel.character) == 2);
+      output += pixel.character;
+      cursor_x = x + (previous_fullwidth ? 2 : 1);
     }
   }
 
-  // Reset the style to default:
-  UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
-
-  return ss.str();
+  // Reset the style to default, and move the cursor to the end:
+  UpdatePixelStyle(this, color_support, output, *previous_pixel_ref, default_pixel);
+  move_to(dimx_, dimy_ - 1);
 }
 
 // Print the Screen to the terminal.
 void Screen::Print() const {
-  std::cout << ToString() << '\0' << std::flush;
+  ToString([](std::string_view chunk) { std::cout << chunk; });
+  std::cout << '\0' << std::flush;
 }
 
 /// @brief Access a character in a cell at a given position.
@@ -468,14 +1164,93 @@ const std::string& Screen::at(int x, int y) const {
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
 Pixel& Screen::PixelAt(int x, int y) {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  ResolveStyles();
+  if (!stencil.Contain(x, y)) {
+    return dev_null_pixel();
+  }
+  written_rows_[y] = 1;
+  return pixels_[y * dimx_ + x];
 }
 
 /// @brief Access a cell (Pixel) at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
 const Pixel& Screen::PixelAt(int x, int y) const {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  ResolveStyles();
+  return stencil.Contain(x, y) ? pixels_[y * dimx_ + x] : dev_null_pixel();
+}
+
+/// @brief Apply |style| to every cell of |box| inside the stencil.
+/// The cells are updated once they are accessed. In between, the styles
+/// applied to the same box are merged, so that nested decorators like
+/// `text("a") | bold | color(Color::Red)` visit the cells only once.
+/// @param box The cells to style.
+/// @param style The change to apply.
+void Screen::ApplyStyle(Box box, const PixelStyle& style) {
+  box = Box::Intersection(box, stencil);
+  box = Box::Intersection(box, Box{0, dimx_ - 1, 0, dimy_ - 1});
+  if (box.x_min > box.x_max || box.y_min > box.y_max) {
+    return;
+  }
+  if (!pending_styles_.empty() && pending_styles_.back().box == box) {
+    pending_styles_.back().style.Then(style);
+    return;
+  }
+  pending_styles_.push_back({box, style});
+}
+
+/// @brief Apply the styles deferred by ApplyStyle() to the cells.
+/// This doesn't change what the Screen displays, only how it is stored, so this
+/// is allowed on a const Screen. Drawing an Element ends with it, see
+/// ApplyShader(), so that the Screen drawn is only read afterward.
+void Screen::ResolveStyles() const {
+  if (pending_styles_.empty()) {
+    return;
+  }
+  for (const PendingStyle& pending : pending_styles_) {
+    const Box& box = pending.box;
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      written_rows_[y] = 1;
+      Pixel* row = pixels_.data() + y * dimx_;
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        pending.style.Apply(row[x]);  // NOLINT
+      }
+    }
+  }
+  pending_styles_.clear();
+}
+
+void PixelStyle::Apply(Pixel& pixel) const {
+  if (fields & kForeground) {
+    pixel.foreground_color = foreground_color;
+  }
+  if (fields & kBackground) {
+    pixel.background_color = background_color;
+  }
+  if (fields & kHyperlink) {
+    pixel.hyperlink = hyperlink;
+  }
+  pixel.blink |= bool(fields & kBlink);
+  pixel.bold |= bool(fields & kBold);
+  pixel.dim |= bool(fields & kDim);
+  pixel.underlined |= bool(fields & kUnderlined);
+  pixel.underlined_double |= bool(fields & kUnderlinedDouble);
+  pixel.strikethrough |= bool(fields & kStrikethrough);
+  pixel.inverted ^= invert;
+}
+
+void PixelStyle::Then(const PixelStyle& next) {
+  if (next.fields & kForeground) {
+    foreground_color = next.foreground_color;
+  }
+  if (next.fields & kBackground) {
+    background_color = next.background_color;
+  }
+  if (next.fields & kHyperlink) {
+    hyperlink = next.hyperlink;
+  }
+  fields |= next.fields;
+  invert ^= next.invert;
 }
 
 /// @brief Return a string to be printed in order to reset the cursor position
@@ -495,31 +1270,79 @@ const Pixel& Screen::PixelAt(int x, int y) const {
 /// }
 /// ```
 ///
+/// @param clear Whether to also erase the terminal, from the beginning of the
+///        screen to the bottom.
 /// @return The string to print in order to reset the cursor position to the
 ///         beginning.
 std::string Screen::ResetPosition(bool clear) const {
-  std::stringstream ss;
+  std::string output = "\r";           // MOVE_LEFT
+  MoveCursor(output, dimy_ - 1, 'A');  // MOVE_UP
   if (clear) {
-    ss << "\r";       // MOVE_LEFT;
-    ss << "\x1b[2K";  // CLEAR_SCREEN;
-    for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
-      ss << "\x1B[2K";  // CLEAR_LINE;
-    }
-  } else {
-    ss << "\r";  // MOVE_LEFT;
-    for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
-    }
+    output += "\x1B[J";  // ERASE_BELOW
   }
-  return ss.str();
+  return output;
+}
+
+/// @brief Change the dimensions of the screen, and clear it. Contrary to
+/// building a new Screen, the storage of the cells is reused when they fit in
+/// it, so resizing repeatedly doesn't allocate.
+/// @param dimx The new width.
+/// @param dimy The new height.
+void Screen::Resize(int dimx, int dimy) {
+  stencil = {0, dimx - 1, 0, dimy - 1};
+  dimx_ = dimx;
+  dimy_ = dimy;
+  pending_styles_.clear();
+  pixels_.assign(size_t(dimx) * size_t(dimy), Pixel());
+  written_rows_.assign(size_t(dimy), 0);
+}
+
+/// @brief Release the storage not needed by the current dimensions. Use
+/// Resize(0, 0) first to release it all.
+void Screen::ShrinkToFit() {
+  ResolveStyles();
+  pixels_.shrink_to_fit();
+  written_rows_.shrink_to_fit();
+  pending_styles_.shrink_to_fit();
 }
 
 /// @brief Clear all the pixel from the screen.
 void Screen::Clear() {
-  for (auto& line : pixels_) {
-    for (auto& cell : line) {
-      cell = Pixel();
+  pending_styles_.clear();
+  // The rows not written since the last Clear() are blank already. In the
+  // others, most pixels usually are too. Checking them is cheaper than
+  // overwriting them, and leaves their cache lines clean.
+  const Color default_color = Color::Default;
+  for (int y = 0; y < dimy_; ++y) {
+    if (!written_rows_[y]) {
+      continue;
+    }
+    written_rows_[y] = 0;
+    Pixel* row = pixels_.data() + y * dimx_;
+    for (int x = 0; x < dimx_; ++x) {
+      Pixel& pixel = row[x];  // NOLINT
+      const bool blank =
+          pixel.character.size() == 1 && pixel.character[0] == ' ' &&
+          !(pixel.blink | pixel.bold | pixel.dim | pixel.inverted |
+            pixel.underlined | pixel.underlined_double | pixel.strikethrough |
+            pixel.automerge) &&
+          pixel.hyperlink == 0 && pixel.background_color == default_color &&
+          pixel.foreground_color == default_color;
+      if (blank) {
+        continue;
+      }
+      pixel.blink = false;
+      pixel.bold = false;
+      pixel.dim = false;
+      pixel.inverted = false;
+      pixel.underlined = false;
+      pixel.underlined_double = false;
+      pixel.strikethrough = false;
+      pixel.automerge = false;
+      pixel.hyperlink = 0;
+      pixel.character.assign(1, ' ');
+      pixel.background_color = default_color;
+      pixel.foreground_color = default_color;
     }
   }
   cursor_.x = dimx_ - 1;
@@ -528,27 +1351,30 @@ void Screen::Clear() {
   hyperlinks_ = {
       "",
   };
+  hyperlink_ids_.clear();
 }
 
 // clang-format off
 void Screen::ApplyShader() {
+  FTXUI_TRACE("ApplyShader");
+  ResolveStyles();
   // Merge box characters togethers.
   for (int y = 0; y < dimy_; ++y) {
     for (int x = 0; x < dimx_; ++x) {
       // Box drawing character uses exactly 3 byte.
-      Pixel& cur = pixels_[y][x];
+      Pixel& cur = pixels_[y * dimx_ + x];
       if (!ShouldAttemptAutoMerge(cur)) {
         continue;
       }
 
       if (x > 0) {
-        Pixel& left = pixels_[y][x-1];
+        Pixel& left = pixels_[y * dimx_ + x - 1];
         if (ShouldAttemptAutoMerge(left)) {
           UpgradeLeftRight(left.character, cur.character);
         }
       }
       if (y > 0) {
-        Pixel& top = pixels_[y-1][x];
+        Pixel& top = pixels_[(y - 1) * dimx_ + x];
         if (ShouldAttemptAutoMerge(top)) {
           UpgradeTopDown(top.character, cur.character);
         }
@@ -558,20 +1384,48 @@ void Screen::ApplyShader() {
 }
 // clang-format on
 
-uint8_t Screen::RegisterHyperlink(const std::string& link) {
-  for (size_t i = 0; i < hyperlinks_.size(); ++i) {
-    if (hyperlinks_[i] == link) {
-      return i;
-    }
+uint16_t Screen::RegisterHyperlink(const std::string& link) {
+  if (link.empty()) {
+    return 0;
+  }
+  auto it = hyperlink_ids_.find(link);
+  if (it != hyperlink_ids_.end()) {
+    return it->second;
   }
-  if (hyperlinks_.size() == std::numeric_limits<uint8_t>::max()) {
+  // Past this many hyperlinks, the new ones are dropped.
+  if (hyperlinks_.size() > std::numeric_limits<uint16_t>::max()) {
     return 0;
   }
+  const auto id = static_cast<uint16_t>(hyperlinks_.size());
   hyperlinks_.push_back(link);
-  return hyperlinks_.size() - 1;
+  hyperlink_ids_.emplace(link, id);
+  return id;
+}
+
+/// @brief The bytes allocated by the Screen: its cells, the graphemes too long
+/// to be stored inline, the hyperlinks, and the styles not applied yet.
+/// @ingroup screen
+size_t Screen::MemoryUsage() const {
+  size_t bytes = sizeof(Screen);
+  bytes += pixels_.capacity() * sizeof(Pixel);
+  bytes += written_rows_.capacity();
+  for (const Pixel& pixel : pixels_) {
+    bytes += StringHeapBytes(pixel.character);
+  }
+  bytes += hyperlinks_.capacity() * sizeof(std::string);
+  for (const std::string& link : hyperlinks_) {
+    // Every link is stored twice: in |hyperlinks_| and as a key of
+    // |hyperlink_ids_|.
+    bytes += 2 * StringHeapBytes(link);
+  }
+  using HyperlinkId = decltype(hyperlink_ids_)::value_type;
+  bytes += hyperlink_ids_.bucket_count() * sizeof(void*);
+  bytes += hyperlink_ids_.size() * (sizeof(HyperlinkId) + 2 * sizeof(void*));
+  bytes += pending_styles_.capacity() * sizeof(PendingStyle);
+  return bytes;
 }
 
-const std::string& Screen::Hyperlink(uint8_t id) const {
+const std::string& Screen::Hyperlink(uint16_t id) const {
   if (id >= hyperlinks_.size()) {
     return hyperlinks_[0];
   }
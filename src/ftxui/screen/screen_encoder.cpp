@@ -0,0 +1,78 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/screen_encoder.hpp"
+
+#include <algorithm>  // for min
+#include <limits>     // for numeric_limits
+#include <string>     // for string
+#include <utility>    // for swap
+
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/screen/terminal.hpp"  // for Dimensions, Terminal
+
+namespace ftxui {
+
+ScreenEncoder::ScreenEncoder(Terminal::Color color_support)
+    : color_support_(color_support),
+      dimensions_{std::numeric_limits<int>::max(),
+                  std::numeric_limits<int>::max()} {}
+
+void ScreenEncoder::SetDimensions(Dimensions dimensions) {
+  dimensions_ = dimensions;
+}
+
+void ScreenEncoder::SetScrollRegions(bool enable) {
+  scroll_regions_ = enable;
+}
+
+void ScreenEncoder::SetCompression(Terminal::Compression compression) {
+  compression_ = compression;
+}
+
+void ScreenEncoder::Encode(const Screen& screen, std::string& output) {
+  Crop(screen);
+
+  const bool resized = printed_.dimx() != frame_.dimx() ||
+                       printed_.dimy() != frame_.dimy();
+  if (printed_valid_) {
+    output += printed_.ResetPosition(/*clear=*/resized);
+  }
+  if (printed_valid_ && !resized) {
+    frame_.ToStringDiff(printed_, output, color_support_, scroll_regions_,
+                        compression_);
+  } else {
+    frame_.ToString(output, color_support_, compression_);
+  }
+
+  // Keep the printed frame for the next diff, and reuse the buffer of the
+  // previous one for the next frame.
+  std::swap(printed_, frame_);
+  printed_valid_ = true;
+}
+
+void ScreenEncoder::Reset() {
+  printed_valid_ = false;
+}
+
+void ScreenEncoder::Crop(const Screen& screen) {
+  const int dimx = std::min(screen.dimx(), dimensions_.dimx);
+  const int dimy = std::min(screen.dimy(), dimensions_.dimy);
+  if (frame_.dimx() != dimx || frame_.dimy() != dimy) {
+    frame_ = Screen(dimx, dimy);
+  }
+  for (int y = 0; y < dimy; ++y) {
+    for (int x = 0; x < dimx; ++x) {
+      const Pixel& pixel = screen.PixelAt(x, y);
+      Pixel& copy = frame_.PixelAt(x, y);
+      copy = pixel;
+      // The hyperlink ids are only valid within their screen.
+      if (pixel.hyperlink != 0) {
+        copy.hyperlink =
+            frame_.RegisterHyperlink(screen.Hyperlink(pixel.hyperlink));
+      }
+    }
+  }
+}
+
+}  // namespace ftxui
@@ -0,0 +1,106 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/screen/color.hpp"           // for Color
+#include "ftxui/screen/screen.hpp"          // for Screen
+#include "ftxui/screen/screen_encoder.hpp"  // for ScreenEncoder
+#include "ftxui/screen/terminal.hpp"        // for Terminal::Color
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+std::string Encode(ScreenEncoder& encoder, const Screen& screen) {
+  std::string output;
+  encoder.Encode(screen, output);
+  return output;
+}
+
+}  // namespace
+
+TEST(ScreenEncoderTest, Diff) {
+  Screen screen(3, 2);
+  screen.PixelAt(0, 0).character = "a";
+  ScreenEncoder encoder(Terminal::Color::TrueColor);
+  EXPECT_EQ(Encode(encoder, screen), screen.ToString());
+
+  // Only the cell that changed is printed.
+  Screen previous = screen;
+  screen.PixelAt(2, 1).character = "b";
+  std::string expected = previous.ResetPosition();
+  screen.ToStringDiff(previous, expected);
+  EXPECT_EQ(Encode(encoder, screen), expected);
+
+  // Nothing changed. The cursor is only moved back to the end.
+  EXPECT_EQ(Encode(encoder, screen),
+            screen.ResetPosition() + screen.ToStringDiff(screen));
+
+  // After a reset, the frame is printed fully.
+  encoder.Reset();
+  EXPECT_EQ(Encode(encoder, screen), screen.ToString());
+}
+
+TEST(ScreenEncoderTest, ColorSupport) {
+  Screen screen(1, 1);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(0, 0).foreground_color = Color::RGB(1, 2, 3);
+
+  // The same screen, for terminals with different color support.
+  ScreenEncoder truecolor(Terminal::Color::TrueColor);
+  ScreenEncoder palette16(Terminal::Color::Palette16);
+  EXPECT_EQ(Encode(truecolor, screen),
+            "\x1B[38;2;1;2;3m\x1B[49ma\x1B[39m\x1B[49m");
+  EXPECT_EQ(Encode(palette16, screen), "\x1B[30m\x1B[49ma\x1B[39m\x1B[49m");
+}
+
+TEST(ScreenEncoderTest, Dimensions) {
+  Screen screen(3, 2);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(1, 0).character = "b";
+  screen.PixelAt(2, 0).character = "c";
+  screen.PixelAt(0, 1).character = "d";
+
+  ScreenEncoder encoder(Terminal::Color::TrueColor);
+  encoder.SetDimensions({2, 1});
+  EXPECT_EQ(Encode(encoder, screen), "ab");
+
+  // The terminal is resized. It is cleared, and the frame printed fully.
+  encoder.SetDimensions({3, 2});
+  EXPECT_EQ(Encode(encoder, screen), "\r\x1B[Jabc\r\nd  ");
+}
+
+TEST(ScreenEncoderTest, ScrollRegions) {
+  Screen screen(2, 5);
+  ScreenEncoder encoder(Terminal::Color::TrueColor);
+  encoder.SetScrollRegions(true);
+  for (int y = 0; y < 5; ++y) {
+    screen.PixelAt(0, y).character = std::to_string(y);
+  }
+  Encode(encoder, screen);
+
+  // The log moves up by one line: the other ones are scrolled.
+  for (int y = 0; y < 5; ++y) {
+    screen.PixelAt(0, y).character = std::to_string(y + 1);
+  }
+  EXPECT_EQ(Encode(encoder, screen), screen.ResetPosition() +
+                                         "\x1B[1;5r\x1B[1S\x1B[r"
+                                         "\x1B[4B5\x1B[1C");
+}
+
+TEST(ScreenEncoderTest, Hyperlink) {
+  Screen screen(1, 1);
+  screen.RegisterHyperlink("https://unused.example");
+  screen.PixelAt(0, 0).hyperlink =
+      screen.RegisterHyperlink("https://example.com");
+
+  ScreenEncoder encoder(Terminal::Color::TrueColor);
+  encoder.SetDimensions({1, 1});
+  EXPECT_EQ(Encode(encoder, screen), screen.ToString());
+}
+
+}  // namespace ftxui
+// NOLINTEND
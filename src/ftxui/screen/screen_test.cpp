@@ -0,0 +1,499 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>       // for allocator, string
+#include <string_view>  // for string_view
+
+#if !defined(_WIN32)
+#include <unistd.h>  // for pipe, read, close
+#endif
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/color.hpp"   // for Color, Color::Red
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel, PixelStyle
+#include "ftxui/screen/string.hpp"  // for string_width
+#include "ftxui/screen/terminal.hpp"  // for Terminal::Color
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(ScreenTest, ApplyShader) {
+  Screen screen(3, 2);
+  const char* characters[2][3] = {{"─", "┐", "a"}, {"╺", "│", "│"}};
+  for (int y = 0; y < 2; ++y) {
+    for (int x = 0; x < 3; ++x) {
+      screen.at(x, y) = characters[y][x];
+      screen.PixelAt(x, y).automerge = true;
+    }
+  }
+  screen.PixelAt(2, 1).automerge = false;
+  screen.ApplyShader();
+
+  EXPECT_EQ(screen.at(0, 0), "─");
+  EXPECT_EQ(screen.at(1, 0), "┐");
+  EXPECT_EQ(screen.at(2, 0), "a");
+  EXPECT_EQ(screen.at(0, 1), "╺");
+  EXPECT_EQ(screen.at(1, 1), "┥");
+  EXPECT_EQ(screen.at(2, 1), "│");
+}
+
+TEST(ScreenTest, ToStringAppend) {
+  Screen screen(2, 2);
+  screen.at(0, 0) = "a";
+  screen.PixelAt(1, 1).bold = true;
+
+  std::string output = "prefix";
+  screen.ToString(output);
+  EXPECT_EQ(output, "prefix" + screen.ToString());
+  EXPECT_EQ(screen.ToString(), "a \r\n \x1B[1m \x1B[22m");
+}
+
+TEST(ScreenTest, ToStringSink) {
+  Screen screen(300, 1000);
+  screen.at(10, 10) = "a";
+  screen.PixelAt(20, 500).bold = true;
+
+  std::string output;
+  int chunks = 0;
+  screen.ToString([&](std::string_view chunk) {
+    EXPECT_LE(chunk.size(), 1u << 17);
+    output += chunk;
+    chunks++;
+  });
+  EXPECT_EQ(output, screen.ToString());
+  EXPECT_GT(chunks, 1);
+}
+
+TEST(ScreenTest, ToStringLarge) {
+  Screen screen(400, 120);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      Pixel& pixel = screen.PixelAt(x, y);
+      pixel.character = (x + y) % 7 ? "a" : "\xE6\xB5\x8B";  // NOLINT
+      pixel.foreground_color = Color::RGB(x % 256, y, 0);
+      pixel.bold = y % 2;
+    }
+  }
+
+  // The sink variant is always sequential.
+  std::string expected;
+  screen.ToString([&](std::string_view chunk) { expected += chunk; });
+
+  std::string output = "prefix";
+  screen.ToString(output);
+  EXPECT_EQ(output, "prefix" + expected);
+  output.clear();
+  screen.ToString(output);
+  EXPECT_EQ(output, expected);
+}
+
+#if !defined(_WIN32)
+TEST(ScreenTest, WriteTo) {
+  Screen screen(4, 2);
+  screen.at(1, 1) = "b";
+
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  EXPECT_TRUE(screen.WriteTo(fds[1]));
+  close(fds[1]);
+
+  std::string output;
+  char buffer[64];
+  ssize_t size = 0;
+  while ((size = read(fds[0], buffer, sizeof(buffer))) > 0) {
+    output.append(buffer, size);
+  }
+  close(fds[0]);
+  EXPECT_EQ(output, screen.ToString());
+
+  EXPECT_FALSE(screen.WriteTo(-1));
+}
+#endif
+
+TEST(ScreenTest, ToStringDiffAppend) {
+  Screen previous(2, 1);
+  Screen next(2, 1);
+  next.at(1, 0) = "b";
+
+  std::string output = "prefix";
+  next.ToStringDiff(previous, output);
+  EXPECT_EQ(output, "prefix" + next.ToStringDiff(previous));
+}
+
+TEST(ScreenTest, ToStringDiffIdentical) {
+  Screen previous(4, 2);
+  Screen next(4, 2);
+  previous.at(1, 0) = "a";
+  next.at(1, 0) = "a";
+
+  // Only move the cursor to the end of the screen.
+  EXPECT_EQ(next.ToStringDiff(previous), "\x1B[1B\x1B[4C");
+}
+
+TEST(ScreenTest, ToStringDiffWrittenRows) {
+  // The rows written and cleared since are blank again.
+  Screen previous(4, 3);
+  previous.at(1, 0) = "a";
+  previous.Clear();
+  Screen next(4, 3);
+  EXPECT_EQ(next.ToStringDiff(previous), "\x1B[2B\x1B[4C");
+
+  // Every way of writing a row is seen.
+  PixelStyle invert;
+  invert.invert = true;
+  next.ApplyStyle(Box{0, 0, 1, 1}, invert);
+  next.ForEachPixel(Box{2, 2, 2, 2},
+                    [](Pixel& pixel) { pixel.character = "x"; });
+  EXPECT_EQ(next.ToStringDiff(previous),
+            "\x1B[1B\x1B[7m \x1B[1B\x1B[1C\x1B[27mx\x1B[1C");
+}
+
+TEST(ScreenTest, ToStringDiffSingleCell) {
+  Screen previous(4, 2);
+  Screen next(4, 2);
+  next.at(1, 0) = "x";
+
+  EXPECT_EQ(next.ToStringDiff(previous), "\x1B[1Cx\x1B[1B\x1B[2C");
+}
+
+TEST(ScreenTest, ToStringDiffMergeSmallGaps) {
+  Screen previous(10, 1);
+  Screen next(10, 1);
+  next.at(0, 0) = "a";
+  next.at(2, 0) = "b";
+  next.at(9, 0) = "c";
+
+  EXPECT_EQ(next.ToStringDiff(previous), "a b\x1B[6Cc");
+}
+
+TEST(ScreenTest, ToStringDiffAbsoluteColumn) {
+  Screen previous(100, 2);
+  Screen next(100, 2);
+  next.at(95, 0) = "a";
+  next.at(5, 1) = "b";
+
+  // Moving back to the 6th column is shorter with an absolute move.
+  EXPECT_EQ(next.ToStringDiff(previous),
+            "\x1B[95Ca\x1B[1B\x1B[6Gb\x1B[94C");
+}
+
+TEST(ScreenTest, ToStringDiffScroll) {
+  Screen previous(3, 6);
+  Screen up(3, 6);
+  Screen down(3, 6);
+  const std::string lines = "abcdefg";
+  for (int y = 0; y < 6; ++y) {
+    previous.at(0, y) = lines.substr(y, 1);
+    up.at(0, y) = lines.substr(y + 1, 1);
+    down.at(0, y) = y == 0 ? "z" : lines.substr(y - 1, 1);
+  }
+  const auto diff = [&](const Screen& next, bool scroll) {
+    std::string output;
+    next.ToStringDiff(previous, output, Terminal::Color::Palette1, scroll);
+    return output;
+  };
+
+  // Only the line exposed is printed.
+  EXPECT_EQ(diff(up, true), "\x1B[1;6r\x1B[1S\x1B[r\x1B[5Bg\x1B[2C");
+  EXPECT_EQ(diff(down, true), "\x1B[1;6r\x1B[1T\x1B[r" "z\x1B[5B\x1B[2C");
+  EXPECT_EQ(diff(up, false), up.ToStringDiff(previous));
+
+  // Scrolling two rows isn't worth it.
+  Screen two(3, 6);
+  two.at(0, 0) = "b";
+  two.at(0, 1) = "c";
+  EXPECT_EQ(diff(two, true).find("\x1B[r"), std::string::npos);
+}
+
+TEST(ScreenTest, ResetPosition) {
+  Screen screen(4, 120);
+  EXPECT_EQ(screen.ResetPosition(), "\r\x1B[119A");
+  EXPECT_EQ(screen.ResetPosition(/*clear=*/true), "\r\x1B[119A\x1B[J");
+  EXPECT_EQ(Screen(4, 1).ResetPosition(), "\r");
+}
+
+TEST(ScreenTest, ToStringDiffStyle) {
+  Screen previous(3, 1);
+  Screen next(3, 1);
+  next.PixelAt(1, 0).bold = true;
+  next.PixelAt(2, 0).foreground_color = Color::Red;
+
+  EXPECT_EQ(next.ToStringDiff(previous),
+            "\x1B[1C"         // Move to the cell.
+            "\x1B[1m "        // Bold.
+            "\x1B[22m"        // Bold reset.
+            "\x1B[31m\x1B[49m "  // Red.
+            "\x1B[39m\x1B[49m"   // Color reset.
+  );
+}
+
+#if !defined(FTXUI_NO_UNICODE_TABLES)
+TEST(ScreenTest, ToStringDiffFullWidth) {
+  Screen previous(4, 1);
+  Screen next(4, 1);
+  previous.at(0, 0) = "测";
+  next.at(0, 0) = "a";
+
+  // The cell previously covered by the fullwidth character is printed again.
+  EXPECT_EQ(next.ToStringDiff(previous), "a \x1B[2C");
+}
+#endif
+
+#if !defined(FTXUI_NO_HYPERLINKS)
+TEST(ScreenTest, ToStringDiffHyperlink) {
+  Screen previous(2, 1);
+  Screen next(2, 1);
+  previous.PixelAt(0, 0).hyperlink = previous.RegisterHyperlink("a");
+  next.PixelAt(0, 0).hyperlink = next.RegisterHyperlink("b");
+  previous.PixelAt(1, 0).hyperlink = previous.RegisterHyperlink("c");
+  next.PixelAt(1, 0).hyperlink = next.RegisterHyperlink("c");
+
+  EXPECT_EQ(next.ToStringDiff(previous),
+            "\x1B]8;;b\x1B\\ "  // The hyperlink changed.
+            "\x1B]8;;\x1B\\"    // Reset.
+            "\x1B[1C");
+}
+#endif
+
+TEST(ScreenTest, ToStringDiffDifferentDimensions) {
+  Screen previous(2, 1);
+  Screen next(3, 1);
+  next.at(0, 0) = "a";
+
+  EXPECT_EQ(next.ToStringDiff(previous), next.ToString());
+}
+
+TEST(ScreenTest, ToStringManyFullWidth) {
+  // More distinct characters than the serializer remembers.
+  const std::string characters[] = {
+      "测", "试", "a", "─", "│", "日", "本", "語", "é", "╭", "中", "文",
+      "한", "국", "어", "┼", "ア", "イ", "ウ", "エ", "•", "オ",
+  };
+  Screen screen(44, 1);
+  std::string expected;
+  int x = 0;
+  for (const auto& character : characters) {
+    screen.at(x, 0) = character;
+    expected += character;
+    x += string_width(character);
+  }
+  expected += std::string(44 - x, ' ');
+  EXPECT_EQ(screen.ToString(), expected);
+}
+
+TEST(ScreenTest, Clear) {
+  Screen screen(3, 2);
+  Pixel& pixel = screen.PixelAt(1, 1);
+  pixel.character = "测";
+  pixel.bold = true;
+  pixel.automerge = true;
+  pixel.foreground_color = Color::Red;
+  pixel.background_color = Color::RGB(1, 2, 3);
+  pixel.hyperlink = screen.RegisterHyperlink("https://example.com");
+  screen.PixelAt(2, 0).underlined_double = true;
+  screen.at(0, 0) = "";
+
+  screen.Clear();
+
+  const Pixel blank;
+  for (int y = 0; y < 2; ++y) {
+    for (int x = 0; x < 3; ++x) {
+      const Pixel& p = screen.PixelAt(x, y);
+      EXPECT_EQ(p.character, blank.character);
+      EXPECT_EQ(p.bold, blank.bold);
+      EXPECT_EQ(p.automerge, blank.automerge);
+      EXPECT_EQ(p.underlined_double, blank.underlined_double);
+      EXPECT_EQ(p.hyperlink, blank.hyperlink);
+      EXPECT_EQ(p.foreground_color, blank.foreground_color);
+      EXPECT_EQ(p.background_color, blank.background_color);
+    }
+  }
+  EXPECT_EQ(screen.Hyperlink(1), "");
+  EXPECT_EQ(screen.ToString(), "   \r\n   ");
+}
+
+TEST(ScreenTest, ForEachPixel) {
+  Screen screen(4, 3);
+  screen.stencil = Box{1, 3, 0, 1};
+  int count = 0;
+  screen.ForEachPixel(Box{0, 10, 1, 10}, [&](Pixel& pixel) {
+    pixel.character = "x";
+    ++count;
+  });
+  EXPECT_EQ(count, 3);
+  screen.stencil = Box{0, 3, 0, 2};
+  EXPECT_EQ(screen.ToString(),
+            "    \r\n"
+            " xxx\r\n"
+            "    ");
+
+  screen.ForEachPixel(Box{2, 1, 0, 2}, [&](Pixel&) { ++count; });
+  EXPECT_EQ(count, 3);
+}
+
+TEST(ScreenTest, ApplyStyle) {
+  Screen screen(4, 2);
+  screen.stencil = Box{0, 2, 0, 1};
+
+  PixelStyle red;
+  red.fields = PixelStyle::kForeground;
+  red.foreground_color = Color::Red;
+  PixelStyle bold;
+  bold.fields = PixelStyle::kBold;
+  PixelStyle invert;
+  invert.invert = true;
+
+  // The styles are recorded, then resolved when the cells are accessed.
+  screen.ApplyStyle(Box{0, 9, 0, 0}, red);
+  screen.ApplyStyle(Box{0, 9, 0, 0}, bold);
+  screen.ApplyStyle(Box{1, 1, 0, 1}, invert);
+  screen.ApplyStyle(Box{1, 1, 0, 1}, invert);
+  screen.ApplyStyle(Box{0, 0, 1, 1}, invert);
+
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::Red);
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_TRUE(screen.PixelAt(2, 0).bold);
+  // Outside of the stencil.
+  EXPECT_FALSE(screen.PixelAt(3, 0).bold);
+  EXPECT_EQ(screen.PixelAt(3, 0).foreground_color, Color::Default);
+  // Inverted twice.
+  EXPECT_FALSE(screen.PixelAt(1, 0).inverted);
+  EXPECT_FALSE(screen.PixelAt(1, 1).inverted);
+  EXPECT_TRUE(screen.PixelAt(0, 1).inverted);
+
+  // The styles recorded before Clear() are discarded.
+  PixelStyle dim;
+  dim.fields = PixelStyle::kDim;
+  screen.ApplyStyle(Box{0, 3, 0, 1}, dim);
+  screen.Clear();
+  EXPECT_FALSE(screen.PixelAt(0, 0).dim);
+  EXPECT_EQ(screen.ToString(),
+            "    \r\n"
+            "    ");
+}
+
+TEST(ScreenTest, ToStringColorSupport) {
+  Screen screen(2, 1);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(0, 0).foreground_color = Color::RGB(1, 2, 3);
+  screen.PixelAt(1, 0).character = "b";
+  screen.PixelAt(1, 0).foreground_color = Color::RGB(2, 2, 2);
+
+  // The same screen, printed for different terminals.
+  std::string truecolor;
+  screen.ToString(truecolor, Terminal::Color::TrueColor);
+  EXPECT_EQ(truecolor,
+            "\x1B[38;2;1;2;3m\x1B[49ma"
+            "\x1B[38;2;2;2;2m\x1B[49mb"
+            "\x1B[39m\x1B[49m");
+
+  // Both colors are downsampled to the same one. It is printed once.
+  std::string palette256;
+  screen.ToString(palette256, Terminal::Color::Palette256);
+  EXPECT_EQ(palette256, "\x1B[38;5;16m\x1B[49mab\x1B[39m\x1B[49m");
+
+  std::string palette16;
+  screen.ToString(palette16, Terminal::Color::Palette16);
+  EXPECT_EQ(palette16, "\x1B[30m\x1B[49mab\x1B[39m\x1B[49m");
+}
+
+TEST(ScreenTest, ToStringCompression) {
+  Screen screen(20, 2);
+  for (int x = 0; x < 10; ++x) {
+    screen.at(x, 0) = "─";
+  }
+  screen.at(0, 1) = "a";
+  const auto print = [&](Terminal::Compression compression) {
+    std::string output;
+    screen.ToString(output, Terminal::Color::Palette1, compression);
+    return output;
+  };
+
+  EXPECT_EQ(print(Terminal::Compression::None), screen.ToString());
+
+  // The trailing blanks are erased, except on the last row, where the cursor
+  // must end on the last column.
+  EXPECT_EQ(print(Terminal::Compression::Erase),
+            "──────────\x1B[K\r\n"
+            "a\x1B[19X\x1B[19C");
+  EXPECT_EQ(print(Terminal::Compression::Repeat),
+            "─\x1B[9b\x1B[K\r\n"
+            "a\x1B[19X\x1B[19C");
+
+  // The blanks are erased with their background.
+  screen.PixelAt(15, 1).background_color = Color::Red;
+  EXPECT_EQ(print(Terminal::Compression::Erase),
+            "──────────\x1B[K\r\n"
+            "a\x1B[14X\x1B[14C\x1B[39m\x1B[41m \x1B[39m\x1B[49m    ");
+}
+
+TEST(ScreenTest, ToStringDiffCompression) {
+  Screen blank(20, 1);
+  Screen line(20, 1);
+  for (int x = 0; x < 20; ++x) {
+    line.at(x, 0) = "─";
+  }
+  const auto diff = [&](const Screen& next, const Screen& previous) {
+    std::string output;
+    next.ToStringDiff(previous, output, Terminal::Color::Palette1,
+                      /*scroll=*/false, Terminal::Compression::Repeat);
+    return output;
+  };
+
+  EXPECT_EQ(diff(line, blank), "─\x1B[19b");
+  EXPECT_EQ(diff(blank, line), "\x1B[K\x1B[20C");
+
+  // Only the cells changed are erased.
+  Screen partial = line;
+  for (int x = 2; x < 18; ++x) {
+    partial.at(x, 0) = " ";
+  }
+  EXPECT_EQ(diff(partial, line), "\x1B[2C\x1B[16X\x1B[16C\x1B[2C");
+}
+
+TEST(ScreenTest, MemoryUsage) {
+  Screen screen(10, 10);
+  const size_t empty = screen.MemoryUsage();
+  EXPECT_GE(empty, 100 * sizeof(Pixel));
+
+  // The short graphemes are stored inline.
+  screen.PixelAt(0, 0).character = "a";
+  EXPECT_EQ(screen.MemoryUsage(), empty);
+
+  // The long ones, and the hyperlinks, allocate.
+  screen.PixelAt(0, 0).character = std::string(100, 'a');
+  EXPECT_GT(screen.MemoryUsage(), empty + 100);
+  const size_t long_grapheme = screen.MemoryUsage();
+  screen.RegisterHyperlink("https://github.com/ArthurSonzogni/FTXUI/" +
+                           std::string(100, 'a'));
+  EXPECT_GT(screen.MemoryUsage(), long_grapheme + 200);
+}
+
+TEST(ScreenTest, Resize) {
+  Screen screen(10, 10);
+  screen.PixelAt(1, 1).character = "a";
+  const size_t memory = screen.MemoryUsage();
+
+  // Shrinking keeps the storage.
+  screen.Resize(4, 2);
+  EXPECT_EQ(screen.dimx(), 4);
+  EXPECT_EQ(screen.dimy(), 2);
+  EXPECT_EQ(screen.stencil.x_max, 3);
+  EXPECT_EQ(screen.ToString(), "    \r\n    ");
+  EXPECT_EQ(screen.MemoryUsage(), memory);
+
+  // Growing within it too.
+  screen.Resize(20, 5);
+  EXPECT_EQ(screen.MemoryUsage(), memory);
+  screen.PixelAt(19, 4).character = "b";
+
+  // Until it is given back.
+  screen.Resize(1, 1);
+  screen.ShrinkToFit();
+  EXPECT_LT(screen.MemoryUsage(), memory);
+  EXPECT_EQ(screen.ToString(), " ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -11,11 +11,13 @@
 
 #include "ftxui/screen/string.hpp"
 
-#include <array>    // for array
-#include <cstddef>  // for size_t
-#include <cstdint>  // for uint32_t, uint8_t, uint16_t, int32_t
-#include <string>   // for string, basic_string, wstring
-#include <tuple>    // for _Swallow_assign, ignore
+#include <algorithm>    // for max, min
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t, uint8_t, uint16_t, int32_t, uint64_t
+#include <cstring>      // for memcpy
+#include <string>       // for string, basic_string, wstring
+#include <string_view>  // for string_view
 
 #include "ftxui/screen/deprecated.hpp"       // for wchar_width, wstring_width
 #include "ftxui/screen/string_internal.hpp"  // for WordBreakProperty, EatCodePoint, CodepointToWordBreakProperty, GlyphCount, GlyphIterate, GlyphNext, GlyphPrevious, IsCombining, IsControl, IsFullWidth, Utf8ToWordBreakProperty
@@ -1075,75 +1077,191 @@ constexpr std::array<WordBreakPropertyInterval, 993> g_word_break_intervals = {{
     {0xE0100, 0xE01EF, WBP::Extend},
 }};
 
-// Construct table of just WBP::Extend character intervals
-constexpr auto g_extend_characters{[]() constexpr {
-  // Compute number of extend character intervals
-  constexpr size_t size = []() constexpr {
-    size_t count = 0;
-    for (auto interval : g_word_break_intervals) {
-      if (interval.property == WBP::Extend) {
-        count++;
-      }
+// The properties of every codepoint, packed into a byte:
+// - bits 0-4: its WordBreakProperty.
+// - bit 5: whether it is a fullwidth character.
+//
+// They are stored in a two-stage table. The codepoints are split into blocks
+// of 256. The first stage gives the index of the block inside the second one.
+// Identical blocks are shared, so that the table only takes ~40KB.
+constexpr uint8_t kFullWidthBit = 1 << 5;
+constexpr uint8_t kWordBreakMask = kFullWidthBit - 1;
+constexpr uint32_t kBlockBits = 8;
+constexpr uint32_t kBlockSize = 1 << kBlockBits;
+
+// The codepoints past the last interval have no properties.
+#if defined(FTXUI_NO_UNICODE_TABLES)
+// Only the Latin-1 block is kept, in 256 bytes. The other codepoints are
+// handled as one cell wide letters.
+constexpr uint32_t kBlockCount = 1;
+#else
+constexpr uint32_t kBlockCount =
+    (std::max(g_full_width_characters.back().last,
+              g_word_break_intervals.back().last) >>
+     kBlockBits) +
+    1;
+#endif
+constexpr uint32_t kLastCodepoint = kBlockCount * kBlockSize - 1;
+
+struct Block {
+  // Whether the block is not entirely covered by the same intervals.
+  bool mixed = false;
+  // The properties of every codepoint, when not |mixed|.
+  uint8_t properties = 0;
+};
+
+constexpr void MarkBlocks(std::array<Block, kBlockCount>& blocks,
+                          uint32_t first,
+                          uint32_t last,
+                          uint8_t properties) {
+  last = std::min(last, kLastCodepoint);
+  for (uint32_t i = first >> kBlockBits; i <= last >> kBlockBits; ++i) {
+    const uint32_t block_first = i << kBlockBits;
+    const uint32_t block_last = block_first + kBlockSize - 1;
+    if (first <= block_first && block_last <= last) {
+      blocks[i].properties |= properties;  // NOLINT
+    } else {
+      blocks[i].mixed = true;  // NOLINT
     }
-    return count;
-  }();
+  }
+}
 
-  // Create array of extend character intervals
-  std::array<Interval, size> result{};
-  size_t index = 0;
+constexpr auto g_blocks{[]() constexpr {
+  std::array<Block, kBlockCount> blocks{};
   for (auto interval : g_word_break_intervals) {
-    if (interval.property == WBP::Extend) {
-      result[index++] = {interval.first, interval.last};  // NOLINT
-    }
+    MarkBlocks(blocks, interval.first, interval.last,
+               uint8_t(interval.property));
+  }
+  for (auto interval : g_full_width_characters) {
+    MarkBlocks(blocks, interval.first, interval.last, kFullWidthBit);
   }
-  return result;
+  return blocks;
 }()};
 
-// Find a codepoint inside a sorted list of Interval.
-template <size_t N>
-bool Bisearch(uint32_t ucs, const std::array<Interval, N>& table) {
-  if (ucs < table.front().first || ucs > table.back().last) {  // NOLINT
-    return false;
+// Every mixed block is stored in the second stage. The others are shared in
+// between the ones with the same properties.
+constexpr size_t kStage2BlockCount = []() constexpr {
+  std::array<bool, kWordBreakMask + kFullWidthBit + 1> uniform{};
+  size_t count = 0;
+  for (auto block : g_blocks) {
+    if (block.mixed) {
+      count++;
+    } else if (!uniform[block.properties]) {  // NOLINT
+      uniform[block.properties] = true;       // NOLINT
+      count++;
+    }
+  }
+  return count;
+}();
+static_assert(kStage2BlockCount <= 256, "The first stage must fit a byte.");
+
+struct PropertyTable {
+  std::array<uint8_t, kBlockCount> stage1;
+  std::array<uint8_t, kStage2BlockCount * kBlockSize> stage2;
+};
+
+// Set |properties| to the codepoints of [first, last] inside mixed blocks.
+constexpr void MarkCodepoints(PropertyTable& table,
+                              uint32_t first,
+                              uint32_t last,
+                              uint8_t properties) {
+  last = std::min(last, kLastCodepoint);
+  for (uint32_t i = first >> kBlockBits; i <= last >> kBlockBits; ++i) {
+    if (!g_blocks[i].mixed) {  // NOLINT
+      continue;
+    }
+    const uint32_t block_first = i << kBlockBits;
+    const uint32_t block_last = block_first + kBlockSize - 1;
+    const size_t offset = size_t(table.stage1[i]) * kBlockSize;  // NOLINT
+    for (uint32_t c = std::max(first, block_first);
+         c <= std::min(last, block_last); ++c) {
+      table.stage2[offset + c - block_first] |= properties;  // NOLINT
+    }
   }
+}
 
-  int min = 0;
-  int max = N - 1;
-  while (max >= min) {
-    const int mid = (min + max) / 2;
-    if (ucs > table[mid].last) {  // NOLINT
-      min = mid + 1;
-    } else if (ucs < table[mid].first) {  // NOLINT
-      max = mid - 1;
+constexpr auto g_property_table{[]() constexpr {
+  PropertyTable table{};
+  std::array<int, kWordBreakMask + kFullWidthBit + 1> uniform{};
+  size_t count = 0;
+  for (uint32_t i = 0; i < kBlockCount; ++i) {
+    const Block block = g_blocks[i];  // NOLINT
+    if (!block.mixed && uniform[block.properties] != 0) {  // NOLINT
+      table.stage1[i] = uint8_t(uniform[block.properties] - 1);  // NOLINT
+      continue;
+    }
+    table.stage1[i] = uint8_t(count);  // NOLINT
+    if (!block.mixed) {
+      uniform[block.properties] = int(++count);  // NOLINT
+      for (uint32_t c = 0; c < kBlockSize; ++c) {
+        table.stage2[table.stage1[i] * kBlockSize + c] =  // NOLINT
+            block.properties;
+      }
     } else {
-      return true;
+      ++count;
     }
   }
+  for (auto interval : g_word_break_intervals) {
+    MarkCodepoints(table, interval.first, interval.last,
+                   uint8_t(interval.property));
+  }
+  for (auto interval : g_full_width_characters) {
+    MarkCodepoints(table, interval.first, interval.last, kFullWidthBit);
+  }
+  return table;
+}()};
 
-  return false;
+uint8_t CodepointProperties(uint32_t ucs) {
+  if (ucs >= kBlockCount * kBlockSize) {
+    return 0;
+  }
+  const uint8_t block = g_property_table.stage1[ucs >> kBlockBits];  // NOLINT
+  return g_property_table
+      .stage2[size_t(block) * kBlockSize + (ucs & (kBlockSize - 1))];  // NOLINT
 }
 
-// Find a value inside a sorted list of Interval + property.
-template <class C, size_t N>
-bool Bisearch(uint32_t ucs, const std::array<C, N>& table, C* out) {
-  if (ucs < table.front().first || ucs > table.back().last) {  // NOLINT
-    return false;
-  }
+// Whether |c| is an ASCII character taking exactly one cell: not a control
+// character. The line feed is one cell wide too, but rare enough to be left to
+// the slow path.
+bool IsPrintableAscii(char c) {
+  return c >= 0x20 && c < 0x7F;  // NOLINT
+}
 
-  int min = 0;
-  int max = N - 1;
-  while (max >= min) {
-    const int mid = (min + max) / 2;
-    if (ucs > table[mid].last) {  // NOLINT
-      min = mid + 1;
-    } else if (ucs < table[mid].first) {  // NOLINT
-      max = mid - 1;
-    } else {
-      *out = table[mid];  // NOLINT
-      return true;
+// Whether the 8 bytes of |word| are printable ASCII characters.
+bool IsPrintableAscii(uint64_t word) {
+  constexpr uint64_t kOnes = 0x0101010101010101;   // NOLINT
+  constexpr uint64_t kHighs = 0x8080808080808080;  // NOLINT
+  // The high bit of a byte is set by:
+  // - |word|, for non ASCII bytes.
+  // - |word - 0x20|, for bytes below 0x20.
+  // - |(word ^ 0x7F) - 1|, for the byte 0x7F.
+  // The `& ~word` removes false positives from the non ASCII bytes.
+  const uint64_t below = (word - kOnes * 0x20) & ~word;            // NOLINT
+  const uint64_t del = ((word ^ (kOnes * 0x7F)) - kOnes) & ~word;  // NOLINT
+  return ((word | below | del) & kHighs) == 0;
+}
+
+// Return the end of the run of printable ASCII characters starting at |start|.
+// Most of the text is made of them, so they are checked 16 bytes at a time,
+// without decoding codepoints.
+size_t PrintableAsciiEnd(std::string_view input, size_t start) {
+  const size_t size = input.size();
+  if (start >= size || !IsPrintableAscii(input[start])) {
+    return start;
+  }
+  const char* data = input.data();
+  uint64_t words[2] = {};  // NOLINT
+  while (start + sizeof(words) <= size) {
+    std::memcpy(words, data + start, sizeof(words));  // NOLINT
+    if (!IsPrintableAscii(words[0]) || !IsPrintableAscii(words[1])) {
+      break;
     }
+    start += sizeof(words);
   }
-
-  return false;
+  while (start < size && IsPrintableAscii(data[start])) {  // NOLINT
+    ++start;
+  }
+  return start;
 }
 
 int codepoint_width(uint32_t ucs) {
@@ -1151,11 +1269,12 @@ int codepoint_width(uint32_t ucs) {
     return -1;
   }
 
-  if (ftxui::IsCombining(ucs)) {
+  const uint8_t properties = CodepointProperties(ucs);
+  if ((properties & kWordBreakMask) == uint8_t(WBP::Extend)) {
     return 0;
   }
 
-  if (ftxui::IsFullWidth(ucs)) {
+  if ((properties & kFullWidthBit) != 0) {
     return 2;
   }
 
@@ -1170,7 +1289,7 @@ namespace ftxui {
 // one codepoint. Put the codepoint into |ucs|. Start at |start| and update
 // |end| to represent the beginning of the next byte to eat for consecutive
 // executions.
-bool EatCodePoint(const std::string& input,
+bool EatCodePoint(std::string_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs) {
@@ -1240,7 +1359,7 @@ bool EatCodePoint(const std::string& input,
 // one codepoint. Put the codepoint into |ucs|. Start at |start| and update
 // |end| to represent the beginning of the next byte to eat for consecutive
 // executions.
-bool EatCodePoint(const std::wstring& input,
+bool EatCodePoint(std::wstring_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs) {
@@ -1279,14 +1398,11 @@ bool EatCodePoint(const std::wstring& input,
 }
 
 bool IsCombining(uint32_t ucs) {
-  return Bisearch(ucs, g_extend_characters);
+  return (CodepointProperties(ucs) & kWordBreakMask) == uint8_t(WBP::Extend);
 }
 
 bool IsFullWidth(uint32_t ucs) {
-  if (ucs < 0x0300)  // Quick path: // NOLINT
-    return false;
-
-  return Bisearch(ucs, g_full_width_characters);
+  return (CodepointProperties(ucs) & kFullWidthBit) != 0;
 }
 
 bool IsControl(uint32_t ucs) {
@@ -1304,9 +1420,7 @@ bool IsControl(uint32_t ucs) {
 }
 
 WordBreakProperty CodepointToWordBreakProperty(uint32_t codepoint) {
-  WordBreakPropertyInterval interval = {0, 0, WBP::ALetter};
-  std::ignore = Bisearch(codepoint, g_word_break_intervals, &interval);
-  return interval.property;
+  return WBP(CodepointProperties(codepoint) & kWordBreakMask);
 }
 
 int wchar_width(wchar_t ucs) {
@@ -1326,10 +1440,18 @@ int wstring_width(const std::wstring& text) {
   return width;
 }
 
-int string_width(const std::string& input) {
+int string_width(std::string_view input) {
   int width = 0;
   size_t start = 0;
   while (start < input.size()) {
+    // Fast path: printable ASCII characters are one cell wide.
+    const size_t ascii_end = PrintableAsciiEnd(input, start);
+    width += static_cast<int>(ascii_end - start);
+    start = ascii_end;
+    if (start >= input.size()) {
+      break;
+    }
+
     uint32_t codepoint = 0;
     if (!EatCodePoint(input, start, &start, &codepoint)) {
       continue;
@@ -1355,45 +1477,96 @@ int string_width(const std::string& input) {
 
 std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
   std::vector<std::string> out;
-  const std::string current;
   out.reserve(input.size());
-  size_t start = 0;
-  size_t end = 0;
-  while (start < input.size()) {
-    uint32_t codepoint = 0;
-    if (!EatCodePoint(input, start, &end, &codepoint)) {
-      start = end;
-      continue;
+  Utf8ToGlyphs(input, out);
+  return out;
+}
+
+void Utf8ToGlyphs(std::string_view input, std::vector<std::string>& out) {
+  // Assign the glyphs to the strings already there, to reuse their storage.
+  size_t size = 0;
+  for (const std::string_view glyph : Utf8Glyphs(input)) {
+    if (size < out.size()) {
+      out[size].assign(glyph);
+    } else {
+      out.emplace_back(glyph);
     }
+    ++size;
+  }
+  out.resize(size);
+}
 
-    const std::string append = input.substr(start, end - start);
-    start = end;
+GlyphIterator::GlyphIterator(std::string_view input, size_t start)
+    : input_(input) {
+  Eat(start);
+}
 
-    // Ignore control characters.
-    if (IsControl(codepoint)) {
-      continue;
-    }
+GlyphIterator& GlyphIterator::operator++() {
+  // Fullwidth characters take two cells. The second is made of the empty
+  // string to reserve the space the first is taking.
+  if (fullwidth_ && !filler_) {
+    filler_ = true;
+    glyph_ = input_.substr(end_, 0);
+    return *this;
+  }
+  Eat(end_);
+  return *this;
+}
 
-    // Combining characters are put with the previous glyph they are modifying.
-    if (IsCombining(codepoint)) {
-      if (!out.empty()) {
-        out.back() += append;
-      }
-      continue;
-    }
+GlyphIterator GlyphIterator::operator++(int) {
+  GlyphIterator previous = *this;
+  ++*this;
+  return previous;
+}
 
-    // Fullwidth characters take two cells. The second is made of the empty
-    // string to reserve the space the first is taking.
-    if (IsFullWidth(codepoint)) {
-      out.push_back(append);
-      out.emplace_back("");
+// Move to the glyph starting at, or the first one after |start|.
+void GlyphIterator::Eat(size_t start) {
+  filler_ = false;
+  fullwidth_ = false;
+  const size_t size = input_.size();
+  uint32_t codepoint = 0;
+  size_t end = start;
+
+  // Ignore invalid and control characters. The combining characters without
+  // a preceding glyph to combine with are ignored too.
+  while (start < size) {
+    // Fast path: printable ASCII characters.
+    if (IsPrintableAscii(input_[start])) {
+      end = start + 1;
+      break;
+    }
+    if (!EatCodePoint(input_, start, &end, &codepoint) ||
+        IsControl(codepoint) || IsCombining(codepoint)) {
+      start = end;
       continue;
     }
+    fullwidth_ = IsFullWidth(codepoint);
+    break;
+  }
+  if (start >= size) {
+    start_ = size;
+    end_ = size;
+    glyph_ = {};
+    return;
+  }
 
-    // Normal characters:
-    out.push_back(append);
+  // Combining characters are put with the glyph they are modifying.
+  while (end < size && !IsPrintableAscii(input_[end])) {
+    size_t next = 0;
+    if (!EatCodePoint(input_, end, &next, &codepoint) ||
+        !IsCombining(codepoint)) {
+      break;
+    }
+    end = next;
   }
-  return out;
+
+  start_ = start;
+  end_ = end;
+  glyph_ = input_.substr(start, end - start);
+}
+
+GlyphRange Utf8Glyphs(std::string_view input) {
+  return GlyphRange(input);
 }
 
 size_t GlyphPrevious(const std::string& input, size_t start) {
@@ -1462,9 +1635,15 @@ size_t GlyphIterate(const std::string& input, int glyph_offset, size_t start) {
 }
 
 std::vector<int> CellToGlyphIndex(const std::string& input) {
-  int x = -1;
   std::vector<int> out;
   out.reserve(input.size());
+  CellToGlyphIndex(input, out);
+  return out;
+}
+
+void CellToGlyphIndex(std::string_view input, std::vector<int>& out) {
+  out.clear();
+  int x = -1;
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
@@ -1499,7 +1678,6 @@ std::vector<int> CellToGlyphIndex(const std::string& input) {
     ++x;
     out.push_back(x);
   }
-  return out;
 }
 
 int GlyphCount(const std::string& input) {
@@ -1507,6 +1685,14 @@ int GlyphCount(const std::string& input) {
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
+    // Fast path: printable ASCII characters are glyphs on their own.
+    const size_t ascii_end = PrintableAsciiEnd(input, start);
+    size += static_cast<int>(ascii_end - start);
+    start = ascii_end;
+    if (start >= input.size()) {
+      break;
+    }
+
     uint32_t codepoint = 0;
     const bool eaten = EatCodePoint(input, start, &end, &codepoint);
     start = end;
@@ -1530,10 +1716,25 @@ int GlyphCount(const std::string& input) {
   return size;
 }
 
+size_t StringHeapBytes(const std::string& input) {
+  static const size_t inline_capacity = std::string().capacity();
+  if (input.capacity() <= inline_capacity) {
+    return 0;
+  }
+  return input.capacity() + 1;
+}
+
 std::vector<WordBreakProperty> Utf8ToWordBreakProperty(
     const std::string& input) {
   std::vector<WordBreakProperty> out;
   out.reserve(input.size());
+  Utf8ToWordBreakProperty(input, out);
+  return out;
+}
+
+void Utf8ToWordBreakProperty(std::string_view input,
+                             std::vector<WordBreakProperty>& out) {
+  out.clear();
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
@@ -1554,17 +1755,21 @@ std::vector<WordBreakProperty> Utf8ToWordBreakProperty(
       continue;
     }
 
-    WordBreakPropertyInterval interval = {0, 0, WBP::ALetter};
-    std::ignore = Bisearch(codepoint, g_word_break_intervals, &interval);
-    out.push_back(interval.property);
+    out.push_back(CodepointToWordBreakProperty(codepoint));
   }
-  return out;
 }
 
-/// Convert a UTF8 std::string into a std::wstring.
+/// Convert a std::wstring into a UTF8 std::string.
 std::string to_string(const std::wstring& s) {
   std::string out;
+  to_string(s, out);
+  return out;
+}
 
+/// Convert a std::wstring into a UTF8 std::string, stored into |out|. Its
+/// storage is reused.
+void to_string(std::wstring_view s, std::string& out) {
+  out.clear();
   size_t i = 0;
   uint32_t codepoint = 0;
   while (EatCodePoint(s, i, &i, &codepoint)) {
@@ -1630,13 +1835,19 @@ std::string to_string(const std::wstring& s) {
 
     // Something else?
   }
-  return out;
 }
 
-/// Convert a std::wstring into a UTF8 std::string.
+/// Convert a UTF8 std::string into a std::wstring.
 std::wstring to_wstring(const std::string& s) {
   std::wstring out;
+  to_wstring(s, out);
+  return out;
+}
 
+/// Convert a UTF8 std::string into a std::wstring, stored into |out|. Its
+/// storage is reused.
+void to_wstring(std::string_view s, std::wstring& out) {
+  out.clear();
   size_t i = 0;
   uint32_t codepoint = 0;
   while (EatCodePoint(s, i, &i, &codepoint)) {
@@ -1663,7 +1874,6 @@ std::wstring to_wstring(const std::string& s) {
     out.push_back(p0);                                   // NOLINT
     out.push_back(p1);                                   // NOLINT
   }
-  return out;
 }
 
 }  // namespace ftxui
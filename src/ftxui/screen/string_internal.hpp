@@ -5,14 +5,17 @@
 #define FTXUI_SCREEN_STRING_INTERNAL_HPP
 
 #include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace ftxui {
 
-bool EatCodePoint(const std::string& input,
+bool EatCodePoint(std::string_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs);
-bool EatCodePoint(const std::wstring& input,
+bool EatCodePoint(std::wstring_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs);
@@ -33,6 +36,16 @@ size_t GlyphIterate(const std::string& input,
 // Returns the number of glyphs in |input|.
 int GlyphCount(const std::string& input);
 
+// Returns the bytes |input| allocated outside of itself. The short strings
+// are stored inline, and allocate nothing.
+size_t StringHeapBytes(const std::string& input);
+
+// Connect the box drawing characters |left| and |right|, or |top| and |down|,
+// the way the automerged pixels are: a side drawn by only one of them is
+// drawn by the other too.
+void UpgradeLeftRight(std::string& left, std::string& right);
+void UpgradeTopDown(std::string& top, std::string& down);
+
 // Properties from:
 // https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/WordBreakProperty.txt
 enum class WordBreakProperty : int8_t {
@@ -58,6 +71,8 @@ enum class WordBreakProperty : int8_t {
 WordBreakProperty CodepointToWordBreakProperty(uint32_t codepoint);
 std::vector<WordBreakProperty> Utf8ToWordBreakProperty(
     const std::string& input);
+void Utf8ToWordBreakProperty(std::string_view input,
+                             std::vector<WordBreakProperty>& out);
 
 bool IsWordBreakingCharacter(const std::string& input, size_t glyph_index);
 }  // namespace ftxui
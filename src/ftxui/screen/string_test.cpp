@@ -3,11 +3,14 @@
 // the LICENSE file.
 #include "ftxui/screen/string.hpp"
 #include <gtest/gtest.h>
-#include <string>  // for allocator, string
+#include <string>       // for allocator, string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 #include "ftxui/screen/string_internal.hpp"
 
 namespace ftxui {
 
+#if !defined(FTXUI_NO_UNICODE_TABLES)
 TEST(StringTest, StringWidth) {
   // Basic:
   EXPECT_EQ(0, string_width(""));
@@ -48,6 +51,41 @@ TEST(StringTest, Utf8ToGlyphs) {
   EXPECT_EQ(Utf8ToGlyphs("a\1a"), T({"a", "a"}));
 }
 
+TEST(StringTest, Utf8Glyphs) {
+  using T = std::vector<std::string_view>;
+  auto glyphs = [](std::string_view input) {
+    T out;
+    for (const std::string_view glyph : Utf8Glyphs(input)) {
+      out.push_back(glyph);
+    }
+    return out;
+  };
+  // Basic:
+  EXPECT_EQ(glyphs(""), T({}));
+  EXPECT_EQ(glyphs("a"), T({"a"}));
+  EXPECT_EQ(glyphs("ab"), T({"a", "b"}));
+  // Fullwidth glyphs:
+  EXPECT_EQ(glyphs("测"), T({"测", ""}));
+  EXPECT_EQ(glyphs("测试"), T({"测", "", "试", ""}));
+  // Combining characters:
+  EXPECT_EQ(glyphs("ā"), T({"ā"}));
+  EXPECT_EQ(glyphs("a⃒b"), T({"a⃒", "b"}));
+  EXPECT_EQ(glyphs("̗a"), T({"a"}));
+  // Control characters:
+  EXPECT_EQ(glyphs("\1"), T({}));
+  EXPECT_EQ(glyphs("a\1a"), T({"a", "a"}));
+
+  // The glyphs are views inside the input.
+  const std::string input = "a测";
+  auto it = Utf8Glyphs(input).begin();
+  EXPECT_EQ(it->data(), input.data());
+  EXPECT_EQ(*it++, "a");
+  EXPECT_EQ(it->data(), input.data() + 1);
+  EXPECT_EQ(*++it, "");
+  EXPECT_NE(it, Utf8Glyphs(input).end());
+  EXPECT_EQ(++it, Utf8Glyphs(input).end());
+}
+
 TEST(StringTest, GlyphCount) {
   // Basic:
   EXPECT_EQ(GlyphCount(""), 0);
@@ -65,6 +103,41 @@ TEST(StringTest, GlyphCount) {
   EXPECT_EQ(GlyphCount("a\1a"), 2);
 }
 
+TEST(StringTest, LongAscii) {
+  // Exercise the runs of ASCII characters checked 16 bytes at a time, with
+  // every kind of character at every position.
+  const std::string ascii = "0123456789abcdefghijklmnopqrstuvwxyz";
+  for (const std::string& c : {"\1", "\x7F", "\n", "测", "\xCC\x97", "~"}) {
+    for (size_t i = 0; i <= ascii.size(); ++i) {
+      const std::string input = ascii.substr(0, i) + c + ascii.substr(i);
+      std::vector<std::string> expected;
+      for (size_t j = 0; j < i; ++j) {
+        expected.push_back(ascii.substr(j, 1));
+      }
+      if (c == "测") {
+        expected.push_back(c);
+        expected.push_back("");
+      } else if (c == "\xCC\x97") {
+        if (i != 0) {
+          expected.back() += c;
+        }
+      } else if (c != "\1" && c != "\x7F") {
+        expected.push_back(c);
+      }
+      for (size_t j = i; j < ascii.size(); ++j) {
+        expected.push_back(ascii.substr(j, 1));
+      }
+
+      // A leading combining character is dropped, but still counted.
+      const int glyphs = static_cast<int>(expected.size());
+      EXPECT_EQ(Utf8ToGlyphs(input), expected);
+      EXPECT_EQ(string_width(input), glyphs);
+      EXPECT_EQ(GlyphCount(input), glyphs - (c == "测" ? 1 : 0) +
+                                       (c == "\xCC\x97" && i == 0 ? 1 : 0));
+    }
+  }
+}
+
 TEST(StringTest, GlyphIterate) {
   // Basic:
   EXPECT_EQ(GlyphIterate("", -1), 0);
@@ -142,6 +215,35 @@ TEST(StringTest, Utf8ToWordBreakProperty) {
   EXPECT_EQ(Utf8ToWordBreakProperty("\n"), T({P::LF}));
 }
 
+TEST(StringTest, CodepointProperties) {
+  // Fullwidth:
+  EXPECT_FALSE(IsFullWidth('a'));
+  EXPECT_TRUE(IsFullWidth(0x1100));
+  EXPECT_TRUE(IsFullWidth(0x4E00));
+  EXPECT_TRUE(IsFullWidth(0x3FFFD));
+  EXPECT_FALSE(IsFullWidth(0x3FFFE));
+  EXPECT_FALSE(IsFullWidth(0x10FFFF));
+
+  // Combining:
+  EXPECT_FALSE(IsCombining('a'));
+  EXPECT_TRUE(IsCombining(0x0300));
+  EXPECT_TRUE(IsCombining(0xE01EF));
+  EXPECT_FALSE(IsCombining(0xE01F0));
+  EXPECT_FALSE(IsCombining(0x10FFFF));
+
+  // Word break:
+  EXPECT_EQ(CodepointToWordBreakProperty('a'), WordBreakProperty::ALetter);
+  EXPECT_EQ(CodepointToWordBreakProperty('\n'), WordBreakProperty::LF);
+  EXPECT_EQ(CodepointToWordBreakProperty(' '), WordBreakProperty::WSegSpace);
+  EXPECT_EQ(CodepointToWordBreakProperty(0x30A2),
+            WordBreakProperty::Katakana);
+  EXPECT_EQ(CodepointToWordBreakProperty(0x1F1E6),
+            WordBreakProperty::Regional_Indicator);
+  EXPECT_EQ(CodepointToWordBreakProperty(0x10FFFF),
+            WordBreakProperty::ALetter);
+}
+#endif
+
 TEST(StringTest, to_string) {
   EXPECT_EQ(to_string(L"hello"), "hello");
   EXPECT_EQ(to_string(L"€"), "€");
@@ -164,4 +266,37 @@ TEST(StringTest, to_wstring) {
   EXPECT_EQ(to_wstring(std::string("🎅🎄")), L"🎅🎄");
 }
 
+#if !defined(FTXUI_NO_UNICODE_TABLES)
+TEST(StringTest, OutputBuffers) {
+  std::vector<std::string> glyphs;
+  Utf8ToGlyphs("a long enough string to leave the inline storage", glyphs);
+  Utf8ToGlyphs("测a", glyphs);
+  EXPECT_EQ(glyphs, std::vector<std::string>({"测", "", "a"}));
+
+  std::vector<int> cells;
+  CellToGlyphIndex("abcdef", cells);
+  const size_t capacity = cells.capacity();
+  CellToGlyphIndex("测a", cells);
+  EXPECT_EQ(cells, std::vector<int>({0, 0, 1}));
+  EXPECT_EQ(cells.capacity(), capacity);
+
+  std::vector<WordBreakProperty> properties;
+  Utf8ToWordBreakProperty("a b", properties);
+  Utf8ToWordBreakProperty("0", properties);
+  EXPECT_EQ(properties, Utf8ToWordBreakProperty("0"));
+
+  std::string narrow;
+  to_string(L"a long enough string to leave the inline storage", narrow);
+  const char* data = narrow.data();
+  to_string(L"🎅🎄", narrow);
+  EXPECT_EQ(narrow, "🎅🎄");
+  EXPECT_EQ(narrow.data(), data);
+
+  std::wstring wide;
+  to_wstring("a long enough string to leave the inline storage", wide);
+  to_wstring("🎅🎄", wide);
+  EXPECT_EQ(wide, L"🎅🎄");
+}
+#endif
+
 }  // namespace ftxui
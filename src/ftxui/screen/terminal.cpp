@@ -1,6 +1,7 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <atomic>   // for atomic
 #include <cstdlib>  // for getenv
 #include <string>   // for string, allocator
 
@@ -23,8 +24,13 @@ namespace ftxui {
 
 namespace {
 
-bool g_cached = false;                     // NOLINT
-Terminal::Color g_cached_supported_color;  // NOLINT
+// Atomic, since the output thread reads them while the answers of the
+// terminal to ScreenInteractive::ProbeTerminal() are applied.
+std::atomic<bool> g_cached = false;                       // NOLINT
+std::atomic<Terminal::Color> g_cached_supported_color;    // NOLINT
+std::atomic<bool> g_compression_cached = false;           // NOLINT
+std::atomic<Terminal::Compression> g_cached_compression;  // NOLINT
+std::atomic<bool> g_scroll_region = true;                 // NOLINT
 
 Dimensions& FallbackSize() {
 #if defined(__EMSCRIPTEN__)
@@ -84,6 +90,37 @@ Terminal::Color ComputeColorSupport() {
   return Terminal::Color::Palette16;
 }
 
+Terminal::Compression ComputeCompressionSupport() {
+#if defined(__EMSCRIPTEN__)
+  return Terminal::Compression::Repeat;
+#endif
+
+  // REP isn't part of the VT100 family. Only the terminals known to implement
+  // it are trusted with it.
+  std::string TERM = Safe(std::getenv("TERM"));  // NOLINT
+  if (std::getenv("VTE_VERSION") != nullptr ||      // NOLINT
+      std::getenv("XTERM_VERSION") != nullptr ||    // NOLINT
+      std::getenv("KITTY_WINDOW_ID") != nullptr ||  // NOLINT
+      Contains(TERM, "kitty") || Contains(TERM, "alacritty") ||
+      Contains(TERM, "foot") || Contains(TERM, "wezterm")) {
+    return Terminal::Compression::Repeat;
+  }
+
+  // ECH and EL come from the VT220, emulated by nearly every terminal.
+  if (!TERM.empty() && TERM != "dumb") {
+    return Terminal::Compression::Erase;
+  }
+
+#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
+  // See ComputeColorSupport(). The Windows console supports both.
+  if (TERM.empty()) {
+    return Terminal::Compression::Repeat;
+  }
+#endif
+
+  return Terminal::Compression::None;
+}
+
 }  // namespace
 
 namespace Terminal {
@@ -129,8 +166,8 @@ void SetFallbackSize(const Dimensions& fallbackSize) {
 /// @ingroup screen
 Color ColorSupport() {
   if (!g_cached) {
-    g_cached = true;
     g_cached_supported_color = ComputeColorSupport();
+    g_cached = true;
   }
   return g_cached_supported_color;
 }
@@ -138,8 +175,39 @@ Color ColorSupport() {
 /// @brief Override terminal color support in case auto-detection fails
 /// @ingroup dom
 void SetColorSupport(Color color) {
-  g_cached = true;
   g_cached_supported_color = color;
+  g_cached = true;
+}
+
+/// @brief Get the sequences the terminal supports to print a frame in fewer
+/// bytes.
+/// @ingroup screen
+Compression CompressionSupport() {
+  if (!g_compression_cached) {
+    g_cached_compression = ComputeCompressionSupport();
+    g_compression_cached = true;
+  }
+  return g_cached_compression;
+}
+
+/// @brief Override the compression support in case auto-detection fails.
+/// @ingroup screen
+void SetCompressionSupport(Compression compression) {
+  g_cached_compression = compression;
+  g_compression_cached = true;
+}
+
+/// @brief Whether the terminal supports scrolling a region (DECSTBM). This is
+/// assumed, unless the terminal says otherwise.
+/// @ingroup screen
+bool ScrollRegionSupport() {
+  return g_scroll_region;
+}
+
+/// @brief Override the scroll region support.
+/// @ingroup screen
+void SetScrollRegionSupport(bool supported) {
+  g_scroll_region = supported;
 }
 
 }  // namespace Terminal
@@ -0,0 +1,169 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/thread_pool.hpp"
+
+#include <functional>  // for function
+
+#if !defined(__EMSCRIPTEN__) && !defined(FTXUI_NO_THREADS)
+#include <condition_variable>  // for condition_variable
+#include <deque>               // for deque
+#include <mutex>               // for mutex, unique_lock
+#include <thread>              // for thread
+#include <vector>              // for vector
+#endif
+
+namespace ftxui {
+namespace thread_pool {
+
+#if defined(__EMSCRIPTEN__) || defined(FTXUI_NO_THREADS)
+
+int Concurrency() {
+  return 1;
+}
+
+void Run(int n, const std::function<void(int)>& fn) {
+  for (int i = 0; i < n; ++i) {
+    fn(i);
+  }
+}
+
+#else
+
+namespace {
+
+// Whether this thread is running the items of a batch, as a worker or as the
+// caller of Run().
+thread_local bool g_in_batch = false;  // NOLINT
+
+class ThreadPool {
+ public:
+  static ThreadPool& Get() {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  ~ThreadPool() {
+    {
+      const std::unique_lock<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  int size() const { return int(threads_.size()); }
+
+  void Run(int n, const std::function<void(int)>& fn) {
+    if (n <= 1 || threads_.empty() || g_in_batch) {
+      for (int i = 0; i < n; ++i) {
+        fn(i);
+      }
+      return;
+    }
+
+    Job job(&fn, n);
+    {
+      const std::unique_lock<std::mutex> lock(mutex_);
+      jobs_.push_back(&job);
+    }
+    cv_.notify_all();
+
+    g_in_batch = true;
+    Work(job);
+    g_in_batch = false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    RemoveJob(&job);
+    job.cv.wait(lock, [&] { return job.workers == 0; });
+  }
+
+ private:
+  struct Job {
+    Job(const std::function<void(int)>* f, int n) : fn(f), size(n) {}
+    const std::function<void(int)>* fn;
+    int size;
+    int next = 0;     // The next item to run. Guarded by mutex_.
+    int workers = 0;  // The number of threads running items. Guarded by mutex_.
+    std::condition_variable cv;
+  };
+
+  ThreadPool() {
+    const int size = int(std::thread::hardware_concurrency()) - 1;
+    for (int i = 0; i < size; ++i) {
+      threads_.emplace_back([this] { Loop(); });
+    }
+  }
+
+  void Loop() {
+    g_in_batch = true;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [&] { return quit_ || !jobs_.empty(); });
+      if (quit_) {
+        return;
+      }
+      Job* job = jobs_.front();
+      job->workers++;
+      lock.unlock();
+      Work(*job);
+      lock.lock();
+      RemoveJob(job);
+      if (--job->workers == 0) {
+        job->cv.notify_all();
+      }
+    }
+  }
+
+  void Work(Job& job) {
+    while (true) {
+      int i = 0;
+      {
+        const std::unique_lock<std::mutex> lock(mutex_);
+        if (job.next >= job.size) {
+          return;
+        }
+        i = job.next++;
+      }
+      (*job.fn)(i);
+    }
+  }
+
+  // Must be called with |mutex_| held.
+  void RemoveJob(Job* job) {
+    for (auto it = jobs_.begin(); it != jobs_.end(); ++it) {
+      if (*it == job) {
+        jobs_.erase(it);
+        return;
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Job*> jobs_;
+  std::vector<std::thread> threads_;
+  bool quit_ = false;
+};
+
+}  // namespace
+
+int Concurrency() {
+  return ThreadPool::Get().size() + 1;
+}
+
+void Run(int n, const std::function<void(int)>& fn) {
+  ThreadPool::Get().Run(n, fn);
+}
+
+#endif
+
+}  // namespace thread_pool
+}  // namespace ftxui
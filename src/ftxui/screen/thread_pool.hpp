@@ -0,0 +1,23 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_THREAD_POOL_HPP
+#define FTXUI_SCREEN_THREAD_POOL_HPP
+
+#include <functional>  // for function
+
+namespace ftxui {
+namespace thread_pool {
+
+// The number of threads running the items of Run, the calling one included.
+int Concurrency();
+
+// Call fn(0), ..., fn(n-1), concurrently on a fixed set of threads. The
+// calling thread runs items too, until none are left. The calls nested in an
+// item are sequential, on whichever thread runs it.
+void Run(int n, const std::function<void(int)>& fn);
+
+}  // namespace thread_pool
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_THREAD_POOL_HPP
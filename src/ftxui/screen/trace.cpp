@@ -0,0 +1,114 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/trace.hpp"
+
+#include <atomic>   // for atomic
+#include <chrono>   // for steady_clock, duration_cast, nanoseconds
+#include <cstdint>  // for int64_t
+#include <mutex>    // for mutex, lock_guard
+#include <string>   // for string, to_string
+#include <vector>   // for vector
+
+namespace ftxui::trace {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Event {
+  const char* name;
+  Clock::time_point begin;
+  Clock::duration duration;
+  int thread;
+};
+
+std::atomic<bool> g_recording{false};  // NOLINT
+std::mutex g_mutex;                    // NOLINT
+std::vector<Event> g_events;           // NOLINT
+
+// A small number identifying the calling thread.
+int ThreadId() {
+  static std::atomic<int> next{1};
+  thread_local const int id = next++;
+  return id;
+}
+
+// Microseconds, with the precision of the nanoseconds.
+std::string Microseconds(Clock::duration duration) {
+  const int64_t ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  std::string fraction = std::to_string(ns % 1000);  // NOLINT
+  fraction.insert(0, 3 - fraction.size(), '0');
+  return std::to_string(ns / 1000) + "." + fraction;  // NOLINT
+}
+
+}  // namespace
+
+/// @brief Start recording the trace points, discarding the previous ones.
+/// @ingroup screen
+void Start() {
+  const std::lock_guard<std::mutex> lock(g_mutex);
+  g_events.clear();
+  g_recording = true;
+}
+
+/// @brief Stop recording the trace points, and return them in the Chrome
+/// trace event JSON format.
+/// @ingroup screen
+///
+/// ### Example
+///
+/// ```cpp
+/// ftxui::trace::Start();
+/// screen.Loop(component);
+/// std::ofstream("trace.json") << ftxui::trace::Stop();
+/// ```
+std::string Stop() {
+  g_recording = false;
+  std::vector<Event> events;
+  {
+    const std::lock_guard<std::mutex> lock(g_mutex);
+    std::swap(events, g_events);
+  }
+
+  std::string json = "{\"traceEvents\":[";
+  for (size_t i = 0; i < events.size(); ++i) {
+    const Event& event = events[i];
+    json += i ? ",\n" : "\n";
+    json += "{\"name\":\"";
+    json += event.name;
+    json += "\",\"cat\":\"ftxui\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+    json += std::to_string(event.thread);
+    json += ",\"ts\":";
+    json += Microseconds(event.begin.time_since_epoch());
+    json += ",\"dur\":";
+    json += Microseconds(event.duration);
+    json += "}";
+  }
+  json += "\n]}\n";
+  return json;
+}
+
+/// @brief Whether the trace points are recorded.
+/// @ingroup screen
+bool Recording() {
+  return g_recording.load(std::memory_order_relaxed);
+}
+
+Scope::Scope(const char* name) : name_(name) {
+  if (Recording()) {
+    begin_ = Clock::now();
+  }
+}
+
+Scope::~Scope() {
+  if (begin_ == Clock::time_point() || !Recording()) {
+    return;
+  }
+  const Event event = {name_, begin_, Clock::now() - begin_, ThreadId()};
+  const std::lock_guard<std::mutex> lock(g_mutex);
+  g_events.push_back(event);
+}
+
+}  // namespace ftxui::trace
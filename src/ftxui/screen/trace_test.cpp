@@ -0,0 +1,51 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/trace.hpp"
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(TraceTest, Recording) {
+  EXPECT_FALSE(trace::Recording());
+  {
+    trace::Scope scope("Before");
+  }
+  trace::Start();
+  EXPECT_TRUE(trace::Recording());
+  {
+    trace::Scope scope("During");
+  }
+  const std::string json = trace::Stop();
+  EXPECT_FALSE(trace::Recording());
+  {
+    trace::Scope scope("After");
+  }
+
+  EXPECT_EQ(json.find("{\"traceEvents\":["), 0u);
+  EXPECT_NE(json.find("\"name\":\"During\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(json.find("\"dur\":"), std::string::npos);
+  EXPECT_EQ(json.find("Before"), std::string::npos);
+  EXPECT_EQ(json.find("After"), std::string::npos);
+}
+
+TEST(TraceTest, StartDiscardsPreviousEvents) {
+  trace::Start();
+  {
+    trace::Scope scope("First");
+  }
+  trace::Start();
+  {
+    trace::Scope scope("Second");
+  }
+  const std::string json = trace::Stop();
+  EXPECT_EQ(json.find("First"), std::string::npos);
+  EXPECT_NE(json.find("Second"), std::string::npos);
+  EXPECT_EQ(trace::Stop(), "{\"traceEvents\":[\n]}\n");
+}
+
+}  // namespace ftxui
+// NOLINTEND